@@ -392,7 +392,7 @@ move_into_cache(struct ub_packed_rrset_key* k,
 	ak->entry.data = NULL;
 	ak->rk = k->rk;
 	ak->entry.hash = rrset_key_hash(&k->rk);
-	ak->rk.dname = (uint8_t*)memdup(k->rk.dname, k->rk.dname_len);
+	ak->rk.dname = packed_rrset_name_dup(k->rk.dname, k->rk.dname_len);
 	if(!ak->rk.dname) {
 		log_warn("error out of memory");
 		ub_packed_rrset_parsedelete(ak, &worker->alloc);
@@ -0,0 +1,1370 @@
+/*
+ * daemon/cachesnap.c - binary snapshot of the caches for warm restarts.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains functions to write the caches to a binary snapshot
+ * file and to load them from it.  The file format is described in
+ * cachesnap.h.
+ */
+#include "config.h"
+#include <sys/time.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#ifndef USE_WINSOCK
+#include <sys/mman.h>
+#endif
+#include "daemon/cachesnap.h"
+#include "daemon/daemon.h"
+#include "services/cache/rrset.h"
+#include "services/cache/infra.h"
+#include "services/modstack.h"
+#include "util/module.h"
+#include "validator/val_kcache.h"
+#include "validator/val_kentry.h"
+#include "util/data/msgreply.h"
+#include "util/data/packed_rrset.h"
+#include "util/data/dname.h"
+#include "util/storage/slabhash.h"
+#include "util/config_file.h"
+#include "util/regional.h"
+#include "util/net_help.h"
+#include "util/alloc.h"
+#include "util/log.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+
+/** magic number at the start of the file, "UBCS" */
+#define SNAP_MAGIC 0x55424353
+/** version of the file format */
+#define SNAP_VERSION 1
+/** a chunk is ended when it has grown to this size */
+#define SNAP_CHUNK_SIZE (256*1024)
+/** number of entries that are put in the chunks while a slab is locked,
+ * the slab is unlocked in between to let the workers use it */
+#define SNAP_BATCH 1024
+/** thread number for the alloc cache of the first loader thread.  It is
+ * above the worker thread numbers, so that the ids of the loaded rrsets
+ * are not handed out again by the workers. */
+#define SNAP_LOADER_THRNUM 0xff00
+
+/** kind of chunk in the file */
+enum snap_kind {
+	/** end of the file */
+	SNAP_END = 0,
+	/** rrset cache entries */
+	SNAP_RRSET,
+	/** message cache entries */
+	SNAP_MSG,
+	/** key cache entries */
+	SNAP_KEY,
+	/** infra cache host entries */
+	SNAP_INFRA,
+	/** number of kinds */
+	SNAP_KIND_MAX
+};
+
+/**
+ * The state of the snapshot writer in the background.
+ */
+struct cache_snapshot {
+	/** lock on busy */
+	lock_basic_t lock;
+	/** if the writer is busy, protected by the lock */
+	int busy;
+	/** if there is a writer thread that has to be joined */
+	int have_thr;
+	/** the writer thread */
+	ub_thread_t thr;
+	/** the daemon, for the writer thread */
+	struct daemon* daemon;
+};
+
+/**
+ * A message that is copied while the message cache is locked.  It is put
+ * in the chunk after the lock is released, with its rrsets locked.
+ */
+struct snap_msg {
+	/** next in list */
+	struct snap_msg* next;
+	/** the query, qname is in the region */
+	struct query_info qinfo;
+	/** if the CD flag is part of the hash */
+	uint8_t cd;
+	/** the reply, with the fields that are written */
+	uint16_t flags;
+	/** qdcount of the reply */
+	uint8_t qdcount;
+	/** authoritative flag of the reply */
+	uint8_t authoritative;
+	/** ttl of the reply */
+	time_t ttl;
+	/** prefetch ttl of the reply */
+	time_t prefetch_ttl;
+	/** security status of the reply */
+	enum sec_status security;
+	/** number of rrsets in the answer section */
+	size_t an_numrrsets;
+	/** number of rrsets in the authority section */
+	size_t ns_numrrsets;
+	/** number of rrsets in the additional section */
+	size_t ar_numrrsets;
+	/** number of rrsets */
+	size_t rrset_count;
+	/** the rrsets, in order */
+	struct ub_packed_rrset_key** rrsets;
+	/** the rrsets with their ids, sorted for locking */
+	struct rrset_ref* ref;
+};
+
+/**
+ * Writes the entries into chunks, and the chunks to the file.  The
+ * chunks are made in memory for a batch of SNAP_BATCH entries while
+ * the slab is locked, and are written to the file after the lock is
+ * released.  The next batch starts where that one ended.
+ */
+struct snap_writer {
+	/** the file that is written */
+	FILE* out;
+	/** the chunks that are made, with their headers */
+	sldns_buffer* buf;
+	/** position of the header of the chunk that is being made */
+	size_t start;
+	/** the kind of entries in the chunk */
+	enum snap_kind kind;
+	/** number of entries in the chunk */
+	uint32_t count;
+	/** the time of the snapshot, times are relative to it */
+	time_t save;
+	/** entries that expired before this time are not written */
+	time_t keep;
+	/** region for the messages that are copied */
+	struct regional* region;
+	/** the messages copied in this batch, the last one first */
+	struct snap_msg* msgs;
+	/** if a malloc or write failed */
+	int err;
+	/** number of entries written, per kind */
+	size_t num[SNAP_KIND_MAX];
+};
+
+/** a chunk in the mapped file */
+struct snap_chunk {
+	/** kind of entries */
+	enum snap_kind kind;
+	/** number of entries */
+	uint32_t count;
+	/** the entries */
+	uint8_t* data;
+	/** length of the data */
+	size_t len;
+};
+
+/**
+ * The snapshot that is loaded, shared by the loader threads.
+ */
+struct snap_load {
+	/** the daemon with the caches */
+	struct daemon* daemon;
+	/** the key cache, or NULL if there is no validator */
+	struct key_cache* kcache;
+	/** the chunks in the file */
+	struct snap_chunk* chunks;
+	/** number of chunks */
+	size_t num;
+	/** lock on next */
+	lock_basic_t lock;
+	/** the next chunk to look at, protected by the lock */
+	size_t next;
+	/** 0: load rrsets, keys and hosts, 1: load messages, that need
+	 * the rrsets to be in the cache */
+	int phase;
+	/** the time of the snapshot */
+	time_t save;
+	/** the time now */
+	time_t now;
+	/** rrsets and messages that expired before this are not loaded */
+	time_t keep;
+};
+
+/**
+ * A loader thread.
+ */
+struct snap_loader {
+	/** the snapshot */
+	struct snap_load* load;
+	/** the thread */
+	ub_thread_t thr;
+	/** alloc cache for the rrset keys */
+	struct alloc_cache alloc;
+	/** region for temporary data */
+	struct regional* region;
+	/** number of entries loaded, per kind */
+	size_t num[SNAP_KIND_MAX];
+	/** number of chunks that could not be loaded */
+	size_t bad;
+};
+
+/** the file name, with the chroot removed */
+static const char*
+snap_fname(struct config_file* cfg)
+{
+	const char* fname = cfg->cache_snapshot_file;
+	if(cfg->chrootdir && cfg->chrootdir[0] && strncmp(fname,
+		cfg->chrootdir, strlen(cfg->chrootdir)) == 0)
+		fname += strlen(cfg->chrootdir);
+	return fname;
+}
+
+/** rrsets and messages that expired before this time are not kept */
+static time_t
+snap_keep_time(time_t now)
+{
+	if(!SERVE_EXPIRED)
+		return now;
+	if(SERVE_EXPIRED_TTL && now > SERVE_EXPIRED_TTL)
+		return now - SERVE_EXPIRED_TTL;
+	return 0;
+}
+
+/** the key cache, if the validator is in the module stack */
+static struct key_cache*
+snap_key_cache(struct daemon* daemon)
+{
+	if(modstack_find(&daemon->mods, "validator") == -1)
+		return NULL;
+	return daemon->env->key_cache;
+}
+
+/** put bytes into the chunk */
+static void
+snap_put(struct snap_writer* w, void* data, size_t len)
+{
+	if(w->err || !sldns_buffer_reserve(w->buf, len)) {
+		w->err = 1;
+		return;
+	}
+	sldns_buffer_write(w->buf, data, len);
+}
+
+/** put uint8 into the chunk */
+static void
+snap_put_u8(struct snap_writer* w, uint8_t v)
+{
+	snap_put(w, &v, sizeof(v));
+}
+
+/** put uint16 into the chunk */
+static void
+snap_put_u16(struct snap_writer* w, uint16_t v)
+{
+	if(w->err || !sldns_buffer_reserve(w->buf, sizeof(v))) {
+		w->err = 1;
+		return;
+	}
+	sldns_buffer_write_u16(w->buf, v);
+}
+
+/** put uint32 into the chunk */
+static void
+snap_put_u32(struct snap_writer* w, uint32_t v)
+{
+	if(w->err || !sldns_buffer_reserve(w->buf, sizeof(v))) {
+		w->err = 1;
+		return;
+	}
+	sldns_buffer_write_u32(w->buf, v);
+}
+
+/** put absolute time into the chunk, relative to the snapshot time */
+static void
+snap_put_time(struct snap_writer* w, time_t t)
+{
+	time_t rel = t - w->save;
+	if(rel > (time_t)0x7fffffff)
+		rel = (time_t)0x7fffffff;
+	else if(rel < -(time_t)0x7fffffff)
+		rel = -(time_t)0x7fffffff;
+	snap_put_u32(w, (uint32_t)(int32_t)rel);
+}
+
+/** put a domain name (or string) into the chunk */
+static void
+snap_put_name(struct snap_writer* w, uint8_t* nm, size_t len)
+{
+	snap_put_u16(w, (uint16_t)len);
+	snap_put(w, nm, len);
+}
+
+/** end the chunk that is being made, fill in its header */
+static void
+snap_end(struct snap_writer* w)
+{
+	uint8_t* hdr;
+	if(w->count == 0 || w->err)
+		return;
+	hdr = sldns_buffer_at(w->buf, w->start);
+	sldns_write_uint32(hdr, (uint32_t)w->kind);
+	sldns_write_uint32(hdr+4, w->count);
+	sldns_write_uint32(hdr+8, (uint32_t)(sldns_buffer_position(w->buf)
+		- w->start - 12));
+	w->count = 0;
+}
+
+/** write the chunks to the file, the caches are not locked */
+static void
+snap_flush(struct snap_writer* w)
+{
+	snap_end(w);
+	if(!w->err && sldns_buffer_position(w->buf) != 0 &&
+		fwrite(sldns_buffer_begin(w->buf),
+		sldns_buffer_position(w->buf), 1, w->out) != 1) {
+		log_err("cache snapshot: could not write: %s",
+			strerror(errno));
+		w->err = 1;
+	}
+	sldns_buffer_clear(w->buf);
+	w->count = 0;
+}
+
+/** start an entry of the given kind */
+static void
+snap_start(struct snap_writer* w, enum snap_kind kind)
+{
+	uint8_t hdr[12];
+	if(w->kind != kind) {
+		snap_end(w);
+		w->kind = kind;
+	}
+	if(w->count == 0) {
+		/* room for the header of the new chunk */
+		w->start = sldns_buffer_position(w->buf);
+		memset(hdr, 0, sizeof(hdr));
+		snap_put(w, hdr, sizeof(hdr));
+	}
+}
+
+/** an entry has been put in the chunk */
+static void
+snap_done(struct snap_writer* w)
+{
+	w->count++;
+	w->num[w->kind]++;
+	if(sldns_buffer_position(w->buf) - w->start >= SNAP_CHUNK_SIZE)
+		snap_end(w);
+}
+
+/** put rrset data into the chunk */
+static void
+snap_put_data(struct snap_writer* w, struct packed_rrset_data* d)
+{
+	size_t i;
+	snap_put_time(w, d->ttl);
+	snap_put_u32(w, (uint32_t)d->count);
+	snap_put_u32(w, (uint32_t)d->rrsig_count);
+	snap_put_u8(w, (uint8_t)d->trust);
+	snap_put_u8(w, (uint8_t)d->security);
+	for(i=0; i<d->count + d->rrsig_count; i++) {
+		snap_put_time(w, d->rr_ttl[i]);
+		snap_put_u32(w, (uint32_t)d->rr_len[i]);
+		snap_put(w, d->rr_data[i], d->rr_len[i]);
+	}
+}
+
+/** put an rrset into the chunk, entry is locked by the traverse */
+static void
+snap_rrset_cb(struct lruhash_entry* e, void* arg)
+{
+	struct snap_writer* w = (struct snap_writer*)arg;
+	struct ub_packed_rrset_key* k = (struct ub_packed_rrset_key*)e->key;
+	struct packed_rrset_data* d = (struct packed_rrset_data*)e->data;
+	if(d->ttl < w->keep)
+		return;
+	snap_start(w, SNAP_RRSET);
+	snap_put_name(w, k->rk.dname, k->rk.dname_len);
+	snap_put_u16(w, ntohs(k->rk.type));
+	snap_put_u16(w, ntohs(k->rk.rrset_class));
+	snap_put_u32(w, k->rk.flags);
+	snap_put_data(w, d);
+	snap_done(w);
+}
+
+/** copy a message, entry is locked by the traverse.  The rrsets are not
+ * locked here, the message cache is locked. */
+static void
+snap_msg_cb(struct lruhash_entry* e, void* arg)
+{
+	struct snap_writer* w = (struct snap_writer*)arg;
+	struct query_info* k = (struct query_info*)e->key;
+	struct reply_info* d = (struct reply_info*)e->data;
+	struct snap_msg* m;
+	if(w->err || d->ttl < w->keep || d->rrset_count > RR_COUNT_MAX)
+		return;
+	m = (struct snap_msg*)regional_alloc_zero(w->region, sizeof(*m));
+	if(!m || !(m->qinfo.qname = regional_alloc_init(w->region, k->qname,
+		k->qname_len)) || !(m->rrsets = (struct ub_packed_rrset_key**)
+		regional_alloc_init(w->region, d->rrsets, d->rrset_count *
+		sizeof(struct ub_packed_rrset_key*))) || !(m->ref =
+		(struct rrset_ref*)regional_alloc_init(w->region, d->ref,
+		d->rrset_count * sizeof(struct rrset_ref)))) {
+		w->err = 1;
+		return;
+	}
+	m->qinfo.qname_len = k->qname_len;
+	m->qinfo.qtype = k->qtype;
+	m->qinfo.qclass = k->qclass;
+	/* the CD flag is part of the hash for AAAA queries */
+	m->cd = (uint8_t)(k->qtype == LDNS_RR_TYPE_AAAA &&
+		e->hash == query_info_hash(k, BIT_CD));
+	m->flags = d->flags;
+	m->qdcount = d->qdcount;
+	m->authoritative = d->authoritative;
+	m->ttl = d->ttl;
+	m->prefetch_ttl = d->prefetch_ttl;
+	m->security = d->security;
+	m->an_numrrsets = d->an_numrrsets;
+	m->ns_numrrsets = d->ns_numrrsets;
+	m->ar_numrrsets = d->ar_numrrsets;
+	m->rrset_count = d->rrset_count;
+	m->next = w->msgs;
+	w->msgs = m;
+}
+
+/** put a copied message into the chunk, no cache is locked */
+static void
+snap_write_msg(struct snap_writer* w, struct snap_msg* m)
+{
+	size_t i;
+	if(!rrset_array_lock(m->ref, m->rrset_count, w->keep))
+		return; /* rrsets have timed out or do not exist */
+	snap_start(w, SNAP_MSG);
+	snap_put_name(w, m->qinfo.qname, m->qinfo.qname_len);
+	snap_put_u16(w, m->qinfo.qtype);
+	snap_put_u16(w, m->qinfo.qclass);
+	snap_put_u8(w, m->cd);
+	snap_put_u16(w, m->flags);
+	snap_put_u8(w, m->qdcount);
+	snap_put_u8(w, m->authoritative);
+	snap_put_time(w, m->ttl);
+	snap_put_time(w, m->prefetch_ttl);
+	snap_put_u8(w, (uint8_t)m->security);
+	snap_put_u32(w, (uint32_t)m->an_numrrsets);
+	snap_put_u32(w, (uint32_t)m->ns_numrrsets);
+	snap_put_u32(w, (uint32_t)m->ar_numrrsets);
+	for(i=0; i<m->rrset_count; i++) {
+		struct ub_packed_rrset_key* rk = m->rrsets[i];
+		snap_put_name(w, rk->rk.dname, rk->rk.dname_len);
+		snap_put_u16(w, ntohs(rk->rk.type));
+		snap_put_u16(w, ntohs(rk->rk.rrset_class));
+		snap_put_u32(w, rk->rk.flags);
+	}
+	rrset_array_unlock(m->ref, m->rrset_count);
+	snap_done(w);
+}
+
+/** put the messages that are copied into the chunk, the last copied one
+ * last, and forget them */
+static void
+snap_write_msg_list(struct snap_writer* w)
+{
+	struct snap_msg* m, *prev = NULL, *next;
+	for(m = w->msgs; m; m = next) {
+		next = m->next;
+		m->next = prev;
+		prev = m;
+	}
+	for(m = prev; m && !w->err; m = m->next)
+		snap_write_msg(w, m);
+	w->msgs = NULL;
+	regional_free_all(w->region);
+}
+
+/** put a key entry into the chunk, entry is locked by the traverse */
+static void
+snap_key_cb(struct lruhash_entry* e, void* arg)
+{
+	struct snap_writer* w = (struct snap_writer*)arg;
+	struct key_entry_key* k = (struct key_entry_key*)e->key;
+	struct key_entry_data* d = (struct key_entry_data*)e->data;
+	size_t len;
+	if(d->ttl < w->save)
+		return;
+	snap_start(w, SNAP_KEY);
+	snap_put_name(w, k->name, k->namelen);
+	snap_put_u16(w, k->key_class);
+	snap_put_time(w, d->ttl);
+	snap_put_u16(w, d->rrset_type);
+	snap_put_u8(w, d->isbad);
+	snap_put_u8(w, (uint8_t)(d->rrset_data != NULL));
+	if(d->rrset_data)
+		snap_put_data(w, d->rrset_data);
+	len = d->reason?strlen(d->reason):0;
+	if(len > 0xffff) len = 0xffff;
+	snap_put_name(w, (uint8_t*)d->reason, len);
+	len = d->algo?strlen((char*)d->algo):0;
+	snap_put_name(w, d->algo, len);
+	snap_done(w);
+}
+
+/** put an infra cache host into the chunk, entry is locked by the
+ * traverse */
+static void
+snap_infra_cb(struct lruhash_entry* e, void* arg)
+{
+	struct snap_writer* w = (struct snap_writer*)arg;
+	struct infra_key* k = (struct infra_key*)e->key;
+	struct infra_data* d = (struct infra_data*)e->data;
+	if(d->ttl < w->save)
+		return;
+	snap_start(w, SNAP_INFRA);
+	snap_put_u32(w, (uint32_t)k->addrlen);
+	snap_put(w, &k->addr, (size_t)k->addrlen);
+	snap_put_name(w, k->zonename, k->namelen);
+	snap_put_time(w, d->ttl);
+	if(d->probedelay)
+		snap_put_time(w, d->probedelay);
+	else	snap_put_u32(w, 0);
+	snap_put_u32(w, (uint32_t)d->rtt.srtt);
+	snap_put_u32(w, (uint32_t)d->rtt.rttvar);
+	snap_put_u32(w, (uint32_t)d->rtt.rto);
+	snap_put_u32(w, (uint32_t)d->edns_version);
+	snap_put_u8(w, d->edns_lame_known);
+	snap_put_u8(w, d->isdnsseclame);
+	snap_put_u8(w, d->rec_lame);
+	snap_put_u8(w, d->lame_type_A);
+	snap_put_u8(w, d->lame_other);
+	snap_put_u8(w, d->timeout_A);
+	snap_put_u8(w, d->timeout_AAAA);
+	snap_put_u8(w, d->timeout_other);
+	snap_done(w);
+}
+
+/** write the entries of a cache, a batch at a time, the slab is locked
+ * for the callback and unlocked when the batch is written to the file */
+static void
+snap_write_table(struct snap_writer* w, struct slabhash* sh,
+	void (*func)(struct lruhash_entry*, void*))
+{
+	size_t slab, pos;
+	for(slab=0; slab<sh->size && !w->err; slab++) {
+		pos = 0;
+		do {
+			pos = lruhash_traverse_part(sh->array[slab], 0, pos,
+				SNAP_BATCH, func, w);
+			if(w->msgs)
+				snap_write_msg_list(w);
+			snap_flush(w);
+		} while(pos != 0 && !w->err);
+	}
+}
+
+int
+cache_snapshot_write(struct daemon* daemon)
+{
+	const char* fname = snap_fname(daemon->cfg);
+	struct key_cache* kcache = snap_key_cache(daemon);
+	struct snap_writer w;
+	char tmp[1024];
+	uint8_t hdr[16];
+	struct timeval start, end;
+
+	if(snprintf(tmp, sizeof(tmp), "%s.tmp", fname) >= (int)sizeof(tmp)) {
+		log_err("cache snapshot: filename too long: %s", fname);
+		return 0;
+	}
+	memset(&w, 0, sizeof(w));
+	w.save = time(NULL);
+	w.keep = snap_keep_time(w.save);
+	if(!(w.buf = sldns_buffer_new(SNAP_CHUNK_SIZE)) ||
+		!(w.region = regional_create())) {
+		log_err("cache snapshot: out of memory");
+		sldns_buffer_free(w.buf);
+		regional_destroy(w.region);
+		return 0;
+	}
+	if(!(w.out = fopen(tmp, "wb"))) {
+		log_err("cache snapshot: could not open %s: %s", tmp,
+			strerror(errno));
+		sldns_buffer_free(w.buf);
+		return 0;
+	}
+	if(gettimeofday(&start, NULL) < 0)
+		memset(&start, 0, sizeof(start));
+	sldns_write_uint32(hdr, SNAP_MAGIC);
+	sldns_write_uint32(hdr+4, SNAP_VERSION);
+	sldns_write_uint32(hdr+8, (uint32_t)(((uint64_t)w.save)>>32));
+	sldns_write_uint32(hdr+12, (uint32_t)(((uint64_t)w.save)&0xffffffff));
+	if(fwrite(hdr, sizeof(hdr), 1, w.out) != 1)
+		w.err = 1;
+
+	/* the messages last, they are loaded when the rrsets are there */
+	snap_write_table(&w, &daemon->env->rrset_cache->table,
+		&snap_rrset_cb);
+	if(kcache)
+		snap_write_table(&w, kcache->slab, &snap_key_cb);
+	snap_write_table(&w, daemon->env->infra_cache->hosts,
+		&snap_infra_cb);
+	snap_write_table(&w, daemon->env->msg_cache, &snap_msg_cb);
+	snap_flush(&w);
+	memset(hdr, 0, 12);
+	if(fwrite(hdr, 12, 1, w.out) != 1)
+		w.err = 1;
+	sldns_buffer_free(w.buf);
+	regional_destroy(w.region);
+	if(fclose(w.out) != 0)
+		w.err = 1;
+	if(w.err) {
+		log_err("cache snapshot: could not write %s", tmp);
+		(void)unlink(tmp);
+		return 0;
+	}
+#ifdef USE_WINSOCK
+	(void)unlink(fname); /* windows rename does not replace */
+#endif
+	if(rename(tmp, fname) != 0) {
+		log_err("cache snapshot: could not rename %s to %s: %s",
+			tmp, fname, strerror(errno));
+		(void)unlink(tmp);
+		return 0;
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		memset(&end, 0, sizeof(end));
+	verbose(VERB_OPS, "cache snapshot %s written in %d msec: %u rrsets, "
+		"%u messages, %u keys, %u hosts", fname,
+		(int)((end.tv_sec-start.tv_sec)*1000 +
+		(end.tv_usec-start.tv_usec)/1000),
+		(unsigned)w.num[SNAP_RRSET], (unsigned)w.num[SNAP_MSG],
+		(unsigned)w.num[SNAP_KEY], (unsigned)w.num[SNAP_INFRA]);
+	return 1;
+}
+
+struct cache_snapshot*
+cache_snapshot_create(void)
+{
+	struct cache_snapshot* snap = (struct cache_snapshot*)calloc(1,
+		sizeof(*snap));
+	if(!snap)
+		return NULL;
+	lock_basic_init(&snap->lock);
+	lock_protect(&snap->lock, &snap->busy, sizeof(snap->busy));
+	return snap;
+}
+
+void
+cache_snapshot_delete(struct cache_snapshot* snap)
+{
+	if(!snap)
+		return;
+	cache_snapshot_wait(snap);
+	lock_basic_destroy(&snap->lock);
+	free(snap);
+}
+
+#ifndef THREADS_DISABLED
+/** the background writer thread */
+static void*
+snap_write_thread(void* arg)
+{
+	struct cache_snapshot* snap = (struct cache_snapshot*)arg;
+	ub_thread_blocksigs();
+	(void)cache_snapshot_write(snap->daemon);
+	lock_basic_lock(&snap->lock);
+	snap->busy = 0;
+	lock_basic_unlock(&snap->lock);
+	return NULL;
+}
+#endif /* THREADS_DISABLED */
+
+void
+cache_snapshot_write_bg(struct cache_snapshot* snap, struct daemon* daemon)
+{
+#ifdef THREADS_DISABLED
+	(void)snap;
+	(void)cache_snapshot_write(daemon);
+#else
+	lock_basic_lock(&snap->lock);
+	if(snap->busy) {
+		lock_basic_unlock(&snap->lock);
+		verbose(VERB_OPS, "cache snapshot: previous snapshot is "
+			"still being written");
+		return;
+	}
+	snap->busy = 1;
+	lock_basic_unlock(&snap->lock);
+	cache_snapshot_wait(snap);
+	snap->daemon = daemon;
+	ub_thread_create(&snap->thr, snap_write_thread, snap);
+	snap->have_thr = 1;
+#endif
+}
+
+void
+cache_snapshot_wait(struct cache_snapshot* snap)
+{
+	if(snap->have_thr) {
+		ub_thread_join(snap->thr);
+		snap->have_thr = 0;
+	}
+}
+
+/** get uint8 from the file */
+static int
+snap_get_u8(sldns_buffer* b, uint8_t* v)
+{
+	if(sldns_buffer_remaining(b) < 1)
+		return 0;
+	*v = sldns_buffer_read_u8(b);
+	return 1;
+}
+
+/** get uint16 from the file */
+static int
+snap_get_u16(sldns_buffer* b, uint16_t* v)
+{
+	if(sldns_buffer_remaining(b) < 2)
+		return 0;
+	*v = sldns_buffer_read_u16(b);
+	return 1;
+}
+
+/** get uint32 from the file */
+static int
+snap_get_u32(sldns_buffer* b, uint32_t* v)
+{
+	if(sldns_buffer_remaining(b) < 4)
+		return 0;
+	*v = sldns_buffer_read_u32(b);
+	return 1;
+}
+
+/** get time from the file, that is relative to the snapshot time */
+static int
+snap_get_time(struct snap_load* ld, sldns_buffer* b, time_t* t)
+{
+	uint32_t v;
+	if(!snap_get_u32(b, &v))
+		return 0;
+	*t = ld->save + (time_t)(int32_t)v;
+	return 1;
+}
+
+/** get bytes from the file, returns pointer into the mapped file */
+static int
+snap_get_bytes(sldns_buffer* b, size_t len, uint8_t** p)
+{
+	if(sldns_buffer_remaining(b) < len)
+		return 0;
+	*p = sldns_buffer_current(b);
+	sldns_buffer_skip(b, (ssize_t)len);
+	return 1;
+}
+
+/** get string from the file, copied to the region, NULL if empty */
+static int
+snap_get_str(sldns_buffer* b, struct regional* region, char** s)
+{
+	uint16_t len;
+	uint8_t* p;
+	if(!snap_get_u16(b, &len) || !snap_get_bytes(b, len, &p))
+		return 0;
+	*s = NULL;
+	if(len == 0)
+		return 1;
+	if(!(*s = (char*)regional_alloc_zero(region, (size_t)len+1)))
+		return 0;
+	memmove(*s, p, len);
+	return 1;
+}
+
+/** get domain name from the file, returns pointer into the mapped file */
+static int
+snap_get_name(sldns_buffer* b, uint8_t** nm, size_t* nmlen)
+{
+	uint16_t len;
+	if(!snap_get_u16(b, &len) || len == 0 || !snap_get_bytes(b, len, nm))
+		return 0;
+	*nmlen = len;
+	return dname_valid(*nm, *nmlen) == *nmlen;
+}
+
+/**
+ * Get rrset data from the file, in the packed layout of the cache.
+ * @param ld: the snapshot.
+ * @param b: buffer with the chunk.
+ * @param region: allocate in this region, or if NULL, with malloc.
+ * @param data: the rrset data is returned.
+ * @return false on error.
+ */
+static int
+snap_get_data(struct snap_load* ld, sldns_buffer* b, struct regional* region,
+	struct packed_rrset_data** data)
+{
+	struct packed_rrset_data* d;
+	uint32_t count, rrsig_count, len;
+	uint8_t trust, security, *rd, *p;
+	size_t i, num, s, start;
+	time_t ttl, rrttl;
+	if(!snap_get_time(ld, b, &ttl) || !snap_get_u32(b, &count) ||
+		!snap_get_u32(b, &rrsig_count) || !snap_get_u8(b, &trust) ||
+		!snap_get_u8(b, &security))
+		return 0;
+	if(count > RR_COUNT_MAX || rrsig_count > RR_COUNT_MAX ||
+		count + rrsig_count == 0 || trust > rrset_trust_ultimate ||
+		security > sec_status_secure)
+		return 0;
+	num = (size_t)count + (size_t)rrsig_count;
+	/* check the rdatas and add up the size */
+	start = sldns_buffer_position(b);
+	s = sizeof(*d) + (sizeof(size_t) + sizeof(uint8_t*) +
+		sizeof(time_t)) * num;
+	for(i=0; i<num; i++) {
+		if(!snap_get_time(ld, b, &rrttl) || !snap_get_u32(b, &len) ||
+			len < 2 || !snap_get_bytes(b, len, &rd) ||
+			(size_t)sldns_read_uint16(rd)+2 != (size_t)len)
+			return 0;
+		s += len;
+	}
+	sldns_buffer_set_position(b, start);
+	if(region)
+		d = (struct packed_rrset_data*)regional_alloc(region, s);
+	else	d = (struct packed_rrset_data*)malloc(s);
+	if(!d)
+		return 0;
+	memset(d, 0, sizeof(*d));
+	d->ttl = ttl;
+	d->count = (size_t)count;
+	d->rrsig_count = (size_t)rrsig_count;
+	d->trust = (enum rrset_trust)trust;
+	d->security = (enum sec_status)security;
+	d->rr_len = (size_t*)((uint8_t*)d + sizeof(*d));
+	d->rr_data = (uint8_t**)&(d->rr_len[num]);
+	d->rr_ttl = (time_t*)&(d->rr_data[num]);
+	p = (uint8_t*)&(d->rr_ttl[num]);
+	for(i=0; i<num; i++) {
+		if(!snap_get_time(ld, b, &d->rr_ttl[i]) ||
+			!snap_get_u32(b, &len) ||
+			!snap_get_bytes(b, len, &rd)) {
+			/* the same data was checked above */
+			if(!region)
+				free(d);
+			return 0;
+		}
+		d->rr_len[i] = (size_t)len;
+		d->rr_data[i] = p;
+		memmove(p, rd, len);
+		p += len;
+	}
+	*data = d;
+	return 1;
+}
+
+/** load an rrset */
+static int
+snap_load_rrset(struct snap_loader* l, sldns_buffer* b)
+{
+	struct snap_load* ld = l->load;
+	struct ub_packed_rrset_key* k;
+	struct packed_rrset_data* d;
+	struct rrset_ref ref;
+	uint8_t* nm;
+	size_t nmlen;
+	uint16_t type, dclass;
+	uint32_t flags;
+	if(!snap_get_name(b, &nm, &nmlen) || !snap_get_u16(b, &type) ||
+		!snap_get_u16(b, &dclass) || !snap_get_u32(b, &flags) ||
+		!snap_get_data(ld, b, NULL, &d))
+		return 0;
+	if(d->ttl < ld->keep) {
+		free(d);
+		return 1;
+	}
+	if(!(k = alloc_special_obtain(&l->alloc))) {
+		free(d);
+		return 0;
+	}
+	k->entry.data = NULL;
+	if(!(k->rk.dname = packed_rrset_name_dup(nm, nmlen))) {
+		ub_packed_rrset_parsedelete(k, &l->alloc);
+		free(d);
+		return 0;
+	}
+	k->rk.dname_len = nmlen;
+	k->rk.type = htons(type);
+	k->rk.rrset_class = htons(dclass);
+	k->rk.flags = flags;
+	k->entry.hash = rrset_key_hash(&k->rk);
+	k->entry.data = d;
+	ref.key = k;
+	ref.id = k->id;
+	(void)rrset_cache_update(ld->daemon->env->rrset_cache, &ref,
+		&l->alloc, ld->now);
+	l->num[SNAP_RRSET]++;
+	return 1;
+}
+
+/** load a message, that refers to rrsets in the cache */
+static int
+snap_load_msg(struct snap_loader* l, sldns_buffer* b)
+{
+	struct snap_load* ld = l->load;
+	struct query_info q;
+	struct reply_info* rep;
+	struct msgreply_entry* e;
+	uint8_t cd, qdcount, auth, security, *nm;
+	uint16_t flags, type, dclass;
+	uint32_t an, ns, ar, rflags;
+	time_t ttl, prefetch_ttl;
+	size_t i, nmlen, total;
+	hashvalue_t h;
+	int missing = 0;
+	memset(&q, 0, sizeof(q));
+	if(!snap_get_name(b, &q.qname, &q.qname_len) ||
+		!snap_get_u16(b, &q.qtype) || !snap_get_u16(b, &q.qclass) ||
+		!snap_get_u8(b, &cd) || !snap_get_u16(b, &flags) ||
+		!snap_get_u8(b, &qdcount) || !snap_get_u8(b, &auth) ||
+		!snap_get_time(ld, b, &ttl) ||
+		!snap_get_time(ld, b, &prefetch_ttl) ||
+		!snap_get_u8(b, &security) || !snap_get_u32(b, &an) ||
+		!snap_get_u32(b, &ns) || !snap_get_u32(b, &ar))
+		return 0;
+	if(an > RR_COUNT_MAX || ns > RR_COUNT_MAX || ar > RR_COUNT_MAX)
+		return 0; /* protect against integer overflow in alloc */
+	/* the cached replies have the QR flag, and one or no question */
+	if(!(flags & BIT_QR) || qdcount > 1 || security > sec_status_secure)
+		return 0;
+	total = (size_t)an + (size_t)ns + (size_t)ar;
+	if(!(rep = construct_reply_info_base(NULL, flags, qdcount, ttl,
+		prefetch_ttl, an, ns, ar, total, (enum sec_status)security)))
+		return 0;
+	rep->authoritative = auth;
+	for(i=0; i<total; i++) {
+		struct ub_packed_rrset_key* k;
+		if(!snap_get_name(b, &nm, &nmlen) ||
+			!snap_get_u16(b, &type) || !snap_get_u16(b, &dclass) ||
+			!snap_get_u32(b, &rflags)) {
+			free(rep);
+			return 0;
+		}
+		if(missing)
+			continue;
+		k = rrset_cache_lookup(ld->daemon->env->rrset_cache, nm, nmlen,
+			type, dclass, rflags, ld->keep, 0);
+		if(!k) {
+			/* not found or expired */
+			missing = 1;
+			continue;
+		}
+		rep->rrsets[i] = k;
+		rep->ref[i].key = k;
+		rep->ref[i].id = k->id;
+		lock_rw_unlock(&k->entry.lock);
+	}
+	if(missing || ttl < ld->keep) {
+		free(rep);
+		return 1;
+	}
+	reply_info_sortref(rep);
+	if(!(q.qname = packed_rrset_name_dup(q.qname, q.qname_len))) {
+		free(rep);
+		return 0;
+	}
+	h = query_info_hash(&q, (uint16_t)(cd?BIT_CD:0));
+	if(!(e = query_info_entrysetup(&q, rep, h))) {
+		packed_rrset_name_free(q.qname);
+		free(rep);
+		return 0;
+	}
+	slabhash_insert(ld->daemon->env->msg_cache, h, &e->entry, rep,
+		&l->alloc);
+	l->num[SNAP_MSG]++;
+	return 1;
+}
+
+/** load a key entry */
+static int
+snap_load_key(struct snap_loader* l, sldns_buffer* b)
+{
+	struct snap_load* ld = l->load;
+	struct key_entry_key kk, *k;
+	struct key_entry_data kd;
+	uint8_t has_rrset;
+	char* algo = NULL;
+	memset(&kk, 0, sizeof(kk));
+	memset(&kd, 0, sizeof(kd));
+	if(!snap_get_name(b, &kk.name, &kk.namelen) ||
+		!snap_get_u16(b, &kk.key_class) ||
+		!snap_get_time(ld, b, &kd.ttl) ||
+		!snap_get_u16(b, &kd.rrset_type) ||
+		!snap_get_u8(b, &kd.isbad) || !snap_get_u8(b, &has_rrset))
+		return 0;
+	if(has_rrset && !snap_get_data(ld, b, l->region, &kd.rrset_data))
+		return 0;
+	if(!snap_get_str(b, l->region, &kd.reason) ||
+		!snap_get_str(b, l->region, &algo))
+		return 0;
+	kd.algo = (uint8_t*)algo;
+	if(kd.ttl < ld->now || !ld->kcache)
+		return 1;
+	kk.entry.key = &kk;
+	kk.entry.data = &kd;
+	if(!(k = key_entry_copy(&kk)))
+		return 0;
+	key_entry_hash(k);
+	slabhash_insert(ld->kcache->slab, k->entry.hash, &k->entry,
+		k->entry.data, NULL);
+	l->num[SNAP_KEY]++;
+	return 1;
+}
+
+/** load an infra host entry */
+static int
+snap_load_infra(struct snap_loader* l, sldns_buffer* b)
+{
+	struct snap_load* ld = l->load;
+	struct sockaddr_storage addr;
+	struct infra_data d;
+	uint32_t addrlen, probedelay, srtt, rttvar, rto, edns;
+	uint8_t* p, *nm;
+	size_t nmlen;
+	memset(&d, 0, sizeof(d));
+	if(!snap_get_u32(b, &addrlen) || addrlen > sizeof(addr) ||
+		!snap_get_bytes(b, addrlen, &p))
+		return 0;
+	memset(&addr, 0, sizeof(addr));
+	memmove(&addr, p, addrlen);
+	if(!snap_get_name(b, &nm, &nmlen) || !snap_get_time(ld, b, &d.ttl) ||
+		!snap_get_u32(b, &probedelay) || !snap_get_u32(b, &srtt) ||
+		!snap_get_u32(b, &rttvar) || !snap_get_u32(b, &rto) ||
+		!snap_get_u32(b, &edns) ||
+		!snap_get_u8(b, &d.edns_lame_known) ||
+		!snap_get_u8(b, &d.isdnsseclame) ||
+		!snap_get_u8(b, &d.rec_lame) ||
+		!snap_get_u8(b, &d.lame_type_A) ||
+		!snap_get_u8(b, &d.lame_other) ||
+		!snap_get_u8(b, &d.timeout_A) ||
+		!snap_get_u8(b, &d.timeout_AAAA) ||
+		!snap_get_u8(b, &d.timeout_other))
+		return 0;
+	if(d.ttl < ld->now)
+		return 1;
+	d.probedelay = probedelay?ld->save + (time_t)(int32_t)probedelay:0;
+	d.rtt.srtt = (int)(int32_t)srtt;
+	d.rtt.rttvar = (int)(int32_t)rttvar;
+	d.rtt.rto = (int)(int32_t)rto;
+	d.edns_version = (int)(int32_t)edns;
+	if(!infra_host_insert(ld->daemon->env->infra_cache, &addr,
+		(socklen_t)addrlen, nm, nmlen, &d))
+		return 0;
+	l->num[SNAP_INFRA]++;
+	return 1;
+}
+
+/** load the entries of a chunk */
+static void
+snap_load_chunk(struct snap_loader* l, struct snap_chunk* c)
+{
+	sldns_buffer b;
+	uint32_t i;
+	int r = 0;
+	sldns_buffer_init_frm_data(&b, c->data, c->len);
+	for(i=0; i<c->count; i++) {
+		regional_free_all(l->region);
+		switch(c->kind) {
+		case SNAP_RRSET:
+			r = snap_load_rrset(l, &b);
+			break;
+		case SNAP_MSG:
+			r = snap_load_msg(l, &b);
+			break;
+		case SNAP_KEY:
+			r = snap_load_key(l, &b);
+			break;
+		case SNAP_INFRA:
+			r = snap_load_infra(l, &b);
+			break;
+		default:
+			r = 0;
+		}
+		if(!r) {
+			/* malformed entry or out of memory */
+			l->bad++;
+			return;
+		}
+	}
+}
+
+/** loader thread, loads the chunks of this phase */
+static void*
+snap_loader_thread(void* arg)
+{
+	struct snap_loader* l = (struct snap_loader*)arg;
+	struct snap_load* ld = l->load;
+	struct snap_chunk* c;
+	while(1) {
+		c = NULL;
+		lock_basic_lock(&ld->lock);
+		while(ld->next < ld->num && !c) {
+			if((ld->chunks[ld->next].kind == SNAP_MSG) ==
+				(ld->phase == 1))
+				c = &ld->chunks[ld->next];
+			ld->next++;
+		}
+		lock_basic_unlock(&ld->lock);
+		if(!c)
+			break;
+		snap_load_chunk(l, c);
+	}
+	return NULL;
+}
+
+/** find the chunks in the file, false if the file is not usable */
+static int
+snap_scan(struct snap_load* ld, const char* fname, uint8_t* data,
+	size_t len)
+{
+	sldns_buffer b;
+	uint32_t magic, version, hi, lo, kind, count, clen;
+	size_t max = 0;
+	uint8_t* p;
+	sldns_buffer_init_frm_data(&b, data, len);
+	if(!snap_get_u32(&b, &magic) || magic != SNAP_MAGIC ||
+		!snap_get_u32(&b, &version) || !snap_get_u32(&b, &hi) ||
+		!snap_get_u32(&b, &lo)) {
+		verbose(VERB_OPS, "cache snapshot %s: not a snapshot file",
+			fname);
+		return 0;
+	}
+	if(version != SNAP_VERSION) {
+		verbose(VERB_OPS, "cache snapshot %s: version %u is not "
+			"supported, ignored", fname, (unsigned)version);
+		return 0;
+	}
+	ld->save = (time_t)(((uint64_t)hi<<32) | (uint64_t)lo);
+	while(1) {
+		if(!snap_get_u32(&b, &kind) || !snap_get_u32(&b, &count) ||
+			!snap_get_u32(&b, &clen) ||
+			!snap_get_bytes(&b, clen, &p) ||
+			kind >= SNAP_KIND_MAX) {
+			verbose(VERB_OPS, "cache snapshot %s: file is "
+				"truncated or damaged, ignored", fname);
+			return 0;
+		}
+		if(kind == SNAP_END)
+			return 1;
+		if(ld->num == max) {
+			struct snap_chunk* a;
+			max = max?max*2:64;
+			a = (struct snap_chunk*)realloc(ld->chunks,
+				max*sizeof(*a));
+			if(!a) {
+				log_err("cache snapshot: out of memory");
+				return 0;
+			}
+			ld->chunks = a;
+		}
+		ld->chunks[ld->num].kind = (enum snap_kind)kind;
+		ld->chunks[ld->num].count = count;
+		ld->chunks[ld->num].data = p;
+		ld->chunks[ld->num].len = (size_t)clen;
+		ld->num++;
+	}
+}
+
+/** map the file into memory, or read it where there is no mmap */
+static uint8_t*
+snap_map(int fd, size_t len)
+{
+#ifndef USE_WINSOCK
+	void* p = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+	if(p == MAP_FAILED)
+		return NULL;
+	return (uint8_t*)p;
+#else
+	size_t got = 0;
+	uint8_t* p = (uint8_t*)malloc(len);
+	if(!p)
+		return NULL;
+	while(got < len) {
+		int r = read(fd, p+got, (unsigned)(len-got));
+		if(r <= 0) {
+			free(p);
+			return NULL;
+		}
+		got += (size_t)r;
+	}
+	return p;
+#endif
+}
+
+/** release the mapped file */
+static void
+snap_unmap(uint8_t* data, size_t len)
+{
+#ifndef USE_WINSOCK
+	(void)munmap(data, len);
+#else
+	(void)len;
+	free(data);
+#endif
+}
+
+/** run the loader threads for the current phase */
+static void
+snap_run(struct snap_loader* loaders, int num)
+{
+	int i;
+	loaders[0].load->next = 0;
+	if(num == 1) {
+		(void)snap_loader_thread(&loaders[0]);
+		return;
+	}
+	for(i=0; i<num; i++)
+		ub_thread_create(&loaders[i].thr, snap_loader_thread,
+			&loaders[i]);
+	for(i=0; i<num; i++)
+		ub_thread_join(loaders[i].thr);
+}
+
+int
+cache_snapshot_load(struct daemon* daemon)
+{
+	const char* fname = snap_fname(daemon->cfg);
+	struct snap_load ld;
+	struct snap_loader* loaders;
+	size_t num[SNAP_KIND_MAX], bad = 0;
+	struct stat st;
+	uint8_t* data;
+	size_t len;
+	int fd, i, k, nthr = daemon->cfg->num_threads;
+	struct timeval start, end;
+
+	if((fd = open(fname, O_RDONLY
+#ifdef O_BINARY
+		| O_BINARY
+#endif
+		)) == -1) {
+		if(errno == ENOENT) {
+			verbose(VERB_OPS, "cache snapshot %s: no such file",
+				fname);
+			return 1;
+		}
+		log_err("cache snapshot: could not open %s: %s", fname,
+			strerror(errno));
+		return 0;
+	}
+	if(fstat(fd, &st) != 0 || st.st_size <= 0) {
+		verbose(VERB_OPS, "cache snapshot %s: empty or cannot stat",
+			fname);
+		close(fd);
+		return 0;
+	}
+	len = (size_t)st.st_size;
+	if(!(data = snap_map(fd, len))) {
+		log_err("cache snapshot: could not map %s: %s", fname,
+			strerror(errno));
+		close(fd);
+		return 0;
+	}
+	if(gettimeofday(&start, NULL) < 0)
+		memset(&start, 0, sizeof(start));
+	memset(&ld, 0, sizeof(ld));
+	ld.daemon = daemon;
+	ld.kcache = snap_key_cache(daemon);
+	ld.now = time(NULL);
+	ld.keep = snap_keep_time(ld.now);
+	if(!snap_scan(&ld, fname, data, len)) {
+		free(ld.chunks);
+		snap_unmap(data, len);
+		close(fd);
+		return 0;
+	}
+
+#ifdef THREADS_DISABLED
+	nthr = 1;
+#endif
+	if(nthr > (int)ld.num)
+		nthr = (int)ld.num;
+	if(nthr < 1)
+		nthr = 1;
+	if(!(loaders = (struct snap_loader*)calloc((size_t)nthr,
+		sizeof(*loaders)))) {
+		log_err("cache snapshot: out of memory");
+		free(ld.chunks);
+		snap_unmap(data, len);
+		close(fd);
+		return 0;
+	}
+	lock_basic_init(&ld.lock);
+	lock_protect(&ld.lock, &ld.next, sizeof(ld.next));
+	for(i=0; i<nthr; i++) {
+		loaders[i].load = &ld;
+		alloc_init(&loaders[i].alloc, &daemon->superalloc,
+			SNAP_LOADER_THRNUM + i);
+		if(!(loaders[i].region = regional_create()))
+			fatal_exit("cache snapshot: out of memory");
+	}
+	/* the messages need the rrsets, so they are loaded after them */
+	for(ld.phase = 0; ld.phase < 2; ld.phase++)
+		snap_run(loaders, nthr);
+
+	memset(num, 0, sizeof(num));
+	for(i=0; i<nthr; i++) {
+		for(k=0; k<SNAP_KIND_MAX; k++)
+			num[k] += loaders[i].num[k];
+		bad += loaders[i].bad;
+		alloc_clear(&loaders[i].alloc);
+		regional_destroy(loaders[i].region);
+	}
+	free(loaders);
+	lock_basic_destroy(&ld.lock);
+	free(ld.chunks);
+	snap_unmap(data, len);
+	close(fd);
+
+	if(gettimeofday(&end, NULL) < 0)
+		memset(&end, 0, sizeof(end));
+	if(bad)
+		verbose(VERB_OPS, "cache snapshot %s: %u chunks could not "
+			"be loaded completely", fname, (unsigned)bad);
+	verbose(VERB_OPS, "cache snapshot %s from " ARG_LL "d seconds ago "
+		"loaded in %d msec by %d threads: %u rrsets, %u messages, "
+		"%u keys, %u hosts", fname, (long long)(ld.now - ld.save),
+		(int)((end.tv_sec-start.tv_sec)*1000 +
+		(end.tv_usec-start.tv_usec)/1000), nthr,
+		(unsigned)num[SNAP_RRSET], (unsigned)num[SNAP_MSG],
+		(unsigned)num[SNAP_KEY], (unsigned)num[SNAP_INFRA]);
+	return 1;
+}
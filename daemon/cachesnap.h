@@ -0,0 +1,115 @@
+/*
+ * daemon/cachesnap.h - binary snapshot of the caches for warm restarts.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains functions to write the rrset, message, key and
+ * infra caches to a binary snapshot file, and to load them from it
+ * when the server starts, so that a restart does not begin with a
+ * cold cache.
+ *
+ * The file is written in network byte order, as follows:
+ * header:	magic "UBCS", version, time of the snapshot (64 bit).
+ * [chunk]*	kind, number of entries, length; then the entries.
+ * end:		a chunk of kind SNAP_END, that has no entries.
+ *
+ * A chunk holds entries of one kind, of one batch of that cache. Chunks
+ * are at most about SNAP_CHUNK_SIZE long, so that they can be loaded in
+ * parallel. Times (TTLs) are stored as seconds relative to the time of
+ * the snapshot; because the caches use absolute times, the entries keep
+ * expiring at the same moment, and the time the server was down is
+ * subtracted from the remaining TTLs. Entries that expired meanwhile
+ * are not loaded (or only within serve-expired-ttl with serve-expired).
+ * Messages refer to their rrsets by name, type, class and flags, and
+ * are loaded after the rrsets, when they can point to them in the cache.
+ */
+
+#ifndef DAEMON_CACHESNAP_H
+#define DAEMON_CACHESNAP_H
+struct daemon;
+struct cache_snapshot;
+
+/**
+ * Create the snapshot state, that tracks the background writer.
+ * @return new state or NULL on malloc failure.
+ */
+struct cache_snapshot* cache_snapshot_create(void);
+
+/**
+ * Delete the snapshot state, waits for the background writer.
+ * @param snap: to delete.
+ */
+void cache_snapshot_delete(struct cache_snapshot* snap);
+
+/**
+ * Write the snapshot file, in this thread.  The file is written under
+ * a temporary name and renamed when complete.
+ * @param daemon: the daemon with the caches and the config.
+ * @return false on failure (logged).
+ */
+int cache_snapshot_write(struct daemon* daemon);
+
+/**
+ * Start to write the snapshot file in a background thread.  Does
+ * nothing if the previous snapshot is still being written.  The
+ * threads keep serving; a slab is locked while a batch of its entries
+ * is copied to memory, and the copy is written to the file after the
+ * unlock.  An entry that changes during the walk can be written twice
+ * or missed.
+ * Without threads, the snapshot is written right away.
+ * @param snap: the snapshot state.
+ * @param daemon: the daemon with the caches and the config.
+ */
+void cache_snapshot_write_bg(struct cache_snapshot* snap,
+	struct daemon* daemon);
+
+/**
+ * Wait until the background writer, if any, is done.
+ * @param snap: the snapshot state.
+ */
+void cache_snapshot_wait(struct cache_snapshot* snap);
+
+/**
+ * Load the snapshot file into the caches.  The file is mapped into
+ * memory and its chunks are inserted by num-threads loader threads.
+ * Call this before the worker threads are started.
+ * @param daemon: the daemon with the caches and the config.
+ * @return false on failure (logged); the caches can then hold a part
+ *	of the snapshot.
+ */
+int cache_snapshot_load(struct daemon* daemon);
+
+#endif /* DAEMON_CACHESNAP_H */
@@ -60,6 +60,9 @@
 #include <time.h>
 #endif
 #include <sys/time.h>
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#endif
 
 #ifdef HAVE_NSS
 /* nss3 */
@@ -69,6 +72,7 @@
 #include "daemon/daemon.h"
 #include "daemon/worker.h"
 #include "daemon/remote.h"
+#include "daemon/cachesnap.h"
 #include "daemon/acl_list.h"
 #include "util/log.h"
 #include "util/config_file.h"
@@ -78,8 +82,10 @@
 #include "services/listen_dnsport.h"
 #include "services/cache/rrset.h"
 #include "services/cache/infra.h"
+#include "validator/val_kcache.h"
 #include "services/localzone.h"
 #include "services/modstack.h"
+#include "services/inflight.h"
 #include "util/module.h"
 #include "util/random.h"
 #include "util/tube.h"
@@ -246,6 +252,12 @@ daemon_init(void)
 		free(daemon);
 		return NULL;
 	}
+	if(!(daemon->snap = cache_snapshot_create())) {
+		acl_list_delete(daemon->acl);
+		free(daemon->env);
+		free(daemon);
+		return NULL;
+	}
 	if(gettimeofday(&daemon->time_boot, NULL) < 0)
 		log_err("gettimeofday: %s", strerror(errno));
 	daemon->time_last_stat = daemon->time_boot;
@@ -256,7 +268,10 @@ int
 daemon_open_shared_ports(struct daemon* daemon)
 {
 	log_assert(daemon);
-	if(daemon->cfg->port != daemon->listening_port) {
+	/* with reuseport every thread needs its own ports */
+	if(daemon->cfg->port != daemon->listening_port ||
+		(daemon->reuseport && daemon->num_ports !=
+		(size_t)daemon->cfg->num_threads)) {
 		size_t i;
 		struct listen_port* p0;
 		daemon->reuseport = 0;
@@ -293,7 +308,12 @@ daemon_open_shared_ports(struct daemon* daemon)
 		}
 		daemon->ports[0] = p0;
 		if(daemon->reuseport) {
-			/* continue to use reuseport */
+			/* continue to use reuseport.  The ports of thread i
+			 * are opened i-th, so that its socket is number i in
+			 * the reuseport group, so-reuseport-bpf relies on
+			 * it.  The ports are only reopened all together,
+			 * the kernel changes the order when a socket of a
+			 * group is closed. */
 			for(i=1; i<daemon->num_ports; i++) {
 				if(!(daemon->ports[i]=
 					listening_ports_open(daemon->cfg,
@@ -390,8 +410,20 @@ daemon_create_workers(struct daemon* daemon)
 		daemon->rand = ub_initstate(seed, NULL);
 		if(!daemon->rand)
 			fatal_exit("could not init random generator");
+		/* the seed is kept over reloads, the caches keep their
+		 * entries, and the hash values of those entries */
+		hash_set_raninit((uint32_t)ub_random(daemon->rand));
+		hash_set_seed(((uint64_t)ub_random(daemon->rand)<<32) ^
+			(uint64_t)ub_random(daemon->rand));
+		if(hash_func_lookup(daemon->cfg->hash_function) >= 0)
+			hash_set_func((enum hash_func)hash_func_lookup(
+				daemon->cfg->hash_function));
+	} else if(hash_func_lookup(daemon->cfg->hash_function) !=
+		(int)hash_get_func()) {
+		log_warn("hash-function change takes effect after a "
+			"restart, the caches keep their hash values over a "
+			"reload");
 	}
-	hash_set_raninit((uint32_t)ub_random(daemon->rand));
 	shufport = (int*)calloc(65536, sizeof(int));
 	if(!shufport)
 		fatal_exit("out of memory during daemon init");
@@ -403,7 +435,7 @@ daemon_create_workers(struct daemon* daemon)
 		sizeof(struct worker*));
 	if(daemon->cfg->dnstap) {
 #ifdef USE_DNSTAP
-		daemon->dtenv = dt_create(5354, // TODO: Configure me!
+		daemon->dtenv = dt_create(daemon->cfg,
 			(unsigned int)daemon->num);
 		if (!daemon->dtenv)
 			fatal_exit("dt_create failed");
@@ -419,10 +451,18 @@ daemon_create_workers(struct daemon* daemon)
 			/* the above is not ports/numthr, due to rounding */
 			fatal_exit("could not create worker");
 	}
-
-#ifdef USE_DNSTAP
-	pipe_free(daemon->dtenv->so_pipe);
-#endif
+#ifndef THREADS_DISABLED
+	/* the threads share the queries in progress, the forked
+	 * processes have no shared memory for it */
+	if(daemon->cfg->coalesce_queries && daemon->num > 1) {
+		if(!(daemon->inflight = inflight_create(daemon->num,
+			htonl(worker_cmd_inflight))))
+			fatal_exit("could not create inflight table");
+		for(i=0; i<daemon->num; i++)
+			inflight_set_tube(daemon->inflight, i,
+				daemon->workers[i]->cmd);
+	}
+#endif /* THREADS_DISABLED */
 
 	free(shufport);
 }
@@ -450,6 +490,44 @@ static void close_other_pipes(struct daemon* daemon, int thr)
 }
 #endif /* THREADS_DISABLED */
 
+/**
+ * Pin the calling thread to its CPU from the cpu-affinity list, and
+ * set SO_INCOMING_CPU on its listening ports if configured.
+ * @param daemon: the daemon with the cpu list.
+ * @param thread_num: number of the thread.
+ * @param port_num: the listening ports of the thread.
+ */
+static void
+daemon_pin_thread(struct daemon* daemon, int thread_num, int port_num)
+{
+	int cpu;
+	if(daemon->num_cpus == 0)
+		return;
+	cpu = daemon->cpus[thread_num % daemon->num_cpus];
+#if defined(HAVE_SCHED_SETAFFINITY) && defined(CPU_SET)
+	if(cpu < 0 || cpu >= CPU_SETSIZE) {
+		log_warn("cpu-affinity: cpu %d out of range", cpu);
+		return;
+	} else {
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		if(sched_setaffinity(0, sizeof(set), &set) != 0) {
+			log_warn("cpu-affinity: could not pin thread %d to "
+				"cpu %d: %s", thread_num, cpu, strerror(errno));
+			return;
+		}
+		verbose(VERB_ALGO, "thread %d pinned to cpu %d", thread_num,
+			cpu);
+	}
+#else
+	log_warn("cpu-affinity: not supported on this system");
+	return;
+#endif
+	if(daemon->cfg->so_incoming_cpu && daemon->reuseport)
+		listening_ports_incoming_cpu(daemon->ports[port_num], cpu);
+}
+
 /**
  * Function to start one thread.
  * @param arg: user argument.
@@ -468,11 +546,13 @@ thread_start(void* arg)
 	close_other_pipes(worker->daemon, worker->thread_num);
 #endif
 #ifdef SO_REUSEPORT
-	if(worker->daemon->cfg->so_reuseport)
+	/* the ports were opened per thread if reuseport worked */
+	if(worker->daemon->reuseport)
 		port_num = worker->thread_num;
 	else
 		port_num = 0;
 #endif
+	daemon_pin_thread(worker->daemon, worker->thread_num, port_num);
 	if(!worker_init(worker, worker->daemon->cfg,
 			worker->daemon->ports[port_num], 0))
 		fatal_exit("Could not initialize thread");
@@ -539,12 +619,43 @@ daemon_fork(struct daemon* daemon)
 
 	/* setup modules */
 	daemon_setup_modules(daemon);
+	if(daemon->env->key_cache && modstack_find(&daemon->mods,
+		"validator") == -1) {
+		/* kept from before the reload, but no longer used */
+		key_cache_delete(daemon->env->key_cache);
+		daemon->env->key_cache = NULL;
+	}
 
 	/* first create all the worker structures, so we can pass
 	 * them to the newly created threads.
 	 */
 	daemon_create_workers(daemon);
 
+	/* warm up the caches from the snapshot, when the server starts.
+	 * After the workers are created, they set the hash seed. */
+	if(!daemon->snap_loaded) {
+		daemon->snap_loaded = 1;
+		if(daemon->cfg->cache_snapshot_file &&
+			daemon->cfg->cache_snapshot_file[0])
+			(void)cache_snapshot_load(daemon);
+	}
+
+	/* spread the queries over the sockets of the threads by CPU;
+	 * the groups have a socket for every thread, in thread order */
+	if(daemon->reuseport && daemon->cfg->so_reuseport_bpf &&
+		daemon->num_ports != (size_t)daemon->num) {
+		log_warn("so-reuseport-bpf: %d threads but %d ports, not "
+			"attached", daemon->num, (int)daemon->num_ports);
+	} else if(daemon->reuseport && daemon->cfg->so_reuseport_bpf) {
+		if(!listening_ports_reuseport_bpf(daemon->ports[0],
+			daemon->cpus, daemon->num_cpus, (int)daemon->num_ports))
+			log_warn("so-reuseport-bpf: could not attach program");
+	}
+
+	/* pin the main thread before its worker allocates its structures;
+	 * the other threads inherit it, and pin themselves when they start */
+	daemon_pin_thread(daemon, 0, 0);
+
 #if defined(HAVE_EV_LOOP) || defined(HAVE_EV_DEFAULT_LOOP)
 	/* in libev the first inited base gets signals */
 	if(!worker_init(daemon->workers[0], daemon->cfg, daemon->ports[0], 1))
@@ -577,6 +688,34 @@ daemon_fork(struct daemon* daemon)
 	daemon->need_to_exit = daemon->workers[0]->need_to_exit;
 }
 
+/**
+ * Save the next rrset ID of the worker allocs, the workers that are
+ * created on reload continue with them.
+ * @param daemon: the daemon with the workers.
+ */
+static void
+daemon_save_alloc_ids(struct daemon* daemon)
+{
+	int i;
+	if(daemon->num > daemon->alloc_next_num) {
+		uint64_t* a = (uint64_t*)realloc(daemon->alloc_next_id,
+			sizeof(uint64_t)*(size_t)daemon->num);
+		if(!a) {
+			/* the IDs start again, the old ones have to go */
+			log_err("out of memory, flushing rrset and msg cache");
+			slabhash_clear(&daemon->env->rrset_cache->table);
+			slabhash_clear(daemon->env->msg_cache);
+			return;
+		}
+		memset(a+daemon->alloc_next_num, 0, sizeof(uint64_t)*
+			(size_t)(daemon->num - daemon->alloc_next_num));
+		daemon->alloc_next_id = a;
+		daemon->alloc_next_num = daemon->num;
+	}
+	for(i=0; i<daemon->num; i++)
+		daemon->alloc_next_id[i] = daemon->workers[i]->alloc.next_id;
+}
+
 void
 daemon_cleanup(struct daemon* daemon)
 {
@@ -586,18 +725,24 @@ daemon_cleanup(struct daemon* daemon)
 	   don't die on multiple reload signals for example. */
 	signal_handling_record();
 	log_thread_set(NULL);
-	/* clean up caches because
-	 * a) RRset IDs will be recycled after a reload, causing collisions
-	 * b) validation config can change, thus rrset, msg, keycache clear
-	 * The infra cache is kept, the timing and edns info is still valid */
-	slabhash_clear(&daemon->env->rrset_cache->table);
-	slabhash_clear(daemon->env->msg_cache);
+	/* the snapshot is written before the caches are cleared */
+	cache_snapshot_wait(daemon->snap);
+	if(daemon->need_to_exit && daemon->cfg->cache_snapshot_file &&
+		daemon->cfg->cache_snapshot_file[0])
+		(void)cache_snapshot_write(daemon);
+	/* the caches are kept. The rrset IDs continue where they were,
+	 * so that they do not collide with the IDs in the cache, and if
+	 * the validation config changes, daemon_apply_cfg flushes them */
+	daemon_save_alloc_ids(daemon);
 	local_zones_delete(daemon->local_zones);
 	daemon->local_zones = NULL;
-	/* key cache is cleared by module desetup during next daemon_init() */
 	daemon_remote_clear(daemon->rc);
+	/* the states that are deleted do not wake up the other threads */
+	inflight_close(daemon->inflight);
 	for(i=0; i<daemon->num; i++)
 		worker_delete(daemon->workers[i]);
+	inflight_delete(daemon->inflight);
+	daemon->inflight = NULL;
 	free(daemon->workers);
 	daemon->workers = NULL;
 	daemon->num = 0;
@@ -613,6 +758,7 @@ daemon_delete(struct daemon* daemon)
 	size_t i;
 	if(!daemon)
 		return;
+	cache_snapshot_delete(daemon->snap);
 	modstack_desetup(&daemon->mods, daemon->env);
 	daemon_remote_delete(daemon->rc);
 	for(i = 0; i < daemon->num_ports; i++)
@@ -620,6 +766,7 @@ daemon_delete(struct daemon* daemon)
 	free(daemon->ports);
 	listening_ports_free(daemon->rc_ports);
 	if(daemon->env) {
+		key_cache_delete(daemon->env->key_cache);
 		slabhash_delete(daemon->env->msg_cache);
 		rrset_cache_delete(daemon->env->rrset_cache);
 		infra_delete(daemon->env->infra_cache);
@@ -627,6 +774,9 @@ daemon_delete(struct daemon* daemon)
 	ub_randfree(daemon->rand);
 	alloc_clear(&daemon->superalloc);
 	acl_list_delete(daemon->acl);
+	free(daemon->alloc_next_id);
+	free(daemon->cache_cfg);
+	free(daemon->cpus);
 	free(daemon->chroot);
 	free(daemon->pidfile);
 	free(daemon->env);
@@ -673,6 +823,139 @@ daemon_delete(struct daemon* daemon)
 #endif
 }
 
+/**
+ * Parse the cpu-affinity list into the daemon.
+ * @param daemon: the daemon.
+ * @param cfg: the config with the list.
+ * @return false on malloc failure.
+ */
+static int
+daemon_cpu_list(struct daemon* daemon, struct config_file* cfg)
+{
+	char* s = cfg->cpu_affinity;
+	char* end;
+	int n;
+	free(daemon->cpus);
+	daemon->cpus = NULL;
+	daemon->num_cpus = 0;
+	if(!s || (n = cfg_count_numbers(s)) == 0)
+		return 1;
+	if(!(daemon->cpus = (int*)calloc((size_t)n, sizeof(int))))
+		return 0;
+	while(daemon->num_cpus < n) {
+		daemon->cpus[daemon->num_cpus++] = (int)strtol(s, &end, 10);
+		s = end;
+	}
+	return 1;
+}
+
+/** the options that the contents of the rrset, msg and key caches
+ * depend on; the caches are flushed on reload when they change */
+static const char* cache_cfg_options[] = {
+	"module-config", "root-hints", "trust-anchor", "trust-anchor-file",
+	"auto-trust-anchor-file", "trusted-keys-file", "dlv-anchor",
+	"dlv-anchor-file", "domain-insecure", "val-override-date",
+	"val-sig-skew-min", "val-sig-skew-max", "val-bogus-ttl",
+	"val-clean-additional", "val-permissive-mode",
+	"val-nsec3-keysize-iterations", "harden-glue",
+	"harden-dnssec-stripped", "harden-below-nxdomain",
+	"harden-referral-path", "harden-algo-downgrade", "private-address",
+	"private-domain", "cache-min-ttl", "cache-max-ttl",
+	"cache-max-negative-ttl", NULL };
+
+/** append a stub or forward zone list to the cache config text */
+static int
+cache_cfg_stubs(struct config_strlist_head* list, const char* kind,
+	struct config_stub* s)
+{
+	struct config_strlist* p;
+	char buf[32];
+	for(; s; s = s->next) {
+		snprintf(buf, sizeof(buf), "%s %d %d", kind, s->isprime,
+			s->isfirst);
+		if(!cfg_strlist_append(list, strdup(buf)) ||
+			!cfg_strlist_append(list, strdup(s->name?s->name:"")))
+			return 0;
+		for(p = s->hosts; p; p = p->next)
+			if(!cfg_strlist_append(list, strdup(p->str)))
+				return 0;
+		for(p = s->addrs; p; p = p->next)
+			if(!cfg_strlist_append(list, strdup(p->str)))
+				return 0;
+	}
+	return 1;
+}
+
+/**
+ * Get the config settings that the cached data depends on, as text.
+ * @param cfg: the config.
+ * @return malloced text or NULL on malloc failure.
+ */
+static char*
+cache_cfg_text(struct config_file* cfg)
+{
+	struct config_strlist_head list;
+	char* str, *res = NULL;
+	int i;
+	memset(&list, 0, sizeof(list));
+	for(i=0; cache_cfg_options[i]; i++) {
+		if(config_get_option_collate(cfg, cache_cfg_options[i], &str)
+			!= 0) {
+			log_err("cache config: cannot get %s",
+				cache_cfg_options[i]);
+			goto done;
+		}
+		if(!cfg_strlist_append(&list, strdup(cache_cfg_options[i]))
+			|| !cfg_strlist_append(&list, str))
+			goto done;
+	}
+	if(!cache_cfg_stubs(&list, "stub-zone", cfg->stubs) ||
+		!cache_cfg_stubs(&list, "forward-zone", cfg->forwards))
+		goto done;
+	res = config_collate_cat(list.first);
+done:
+	config_delstrlist(list.first);
+	return res;
+}
+
+/** remove the pre-encoded answer of a msg cache entry */
+static void
+msg_drop_wire(struct lruhash_entry* e, void* ATTR_UNUSED(arg))
+{
+	struct reply_info* rep = (struct reply_info*)e->data;
+	free(rep->wire[0]);
+	free(rep->wire[1]);
+	rep->wire[0] = NULL;
+	rep->wire[1] = NULL;
+}
+
+/**
+ * The caches are kept over a reload. Flush the rrset, msg and key caches
+ * if the config settings that their contents depend on have changed.
+ * @param daemon: the daemon with the caches and the previous settings.
+ * @param cfg: the new config.
+ */
+static void
+daemon_check_cache_cfg(struct daemon* daemon, struct config_file* cfg)
+{
+	char* text = cache_cfg_text(cfg);
+	if(!text || !daemon->cache_cfg || strcmp(text, daemon->cache_cfg)
+		!= 0) {
+		if(daemon->cache_cfg)
+			verbose(VERB_OPS, "cache settings changed, "
+				"flushing rrset, msg and key caches");
+		slabhash_clear(&daemon->env->rrset_cache->table);
+		slabhash_clear(daemon->env->msg_cache);
+		if(daemon->env->key_cache)
+			slabhash_clear(daemon->env->key_cache->slab);
+	}
+	free(daemon->cache_cfg);
+	daemon->cache_cfg = text;
+	/* the pre-encoded answers depend on the settings for the replies,
+	 * they are made again with the new settings */
+	slabhash_traverse(daemon->env->msg_cache, 1, &msg_drop_wire, NULL);
+}
+
 void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 {
         daemon->cfg = cfg;
@@ -680,7 +963,7 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 	if(!daemon->env->msg_cache ||
 	   cfg->msg_cache_size != slabhash_get_size(daemon->env->msg_cache) ||
 	   cfg->msg_cache_slabs != daemon->env->msg_cache->size) {
-		slabhash_delete(daemon->env->msg_cache);
+		struct slabhash* old = daemon->env->msg_cache;
 		daemon->env->msg_cache = slabhash_create(cfg->msg_cache_slabs,
 			HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
 			msgreply_sizefunc, query_info_compare,
@@ -688,11 +971,31 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 		if(!daemon->env->msg_cache) {
 			fatal_exit("malloc failure updating config settings");
 		}
+		/* keep the messages, in the newly sized table */
+		if(old)
+			slabhash_migrate(daemon->env->msg_cache, old, NULL);
+		slabhash_delete(old);
 	}
 	if((daemon->env->rrset_cache = rrset_cache_adjust(
 		daemon->env->rrset_cache, cfg, &daemon->superalloc)) == 0)
 		fatal_exit("malloc failure updating config settings");
+	if(!slabhash_set_read_mostly(daemon->env->msg_cache,
+		cfg->lockfree_cache_lookup) ||
+	   !slabhash_set_read_mostly(&daemon->env->rrset_cache->table,
+		cfg->lockfree_cache_lookup))
+		log_warn("lockfree-cache-lookup could not be enabled");
+	if(!slabhash_set_open_addressing(daemon->env->msg_cache,
+		cfg->cache_open_addressing))
+		log_warn("cache-open-addressing could not be enabled");
+	if(!slabhash_set_admission(daemon->env->msg_cache,
+		cfg->cache_admission) ||
+	   !slabhash_set_admission(&daemon->env->rrset_cache->table,
+		cfg->cache_admission))
+		log_warn("cache-admission could not be enabled");
+	if(!daemon_cpu_list(daemon, cfg))
+		fatal_exit("malloc failure updating config settings");
 	if((daemon->env->infra_cache = infra_adjust(daemon->env->infra_cache,
 		cfg))==0)
 		fatal_exit("malloc failure updating config settings");
+	daemon_check_cache_cfg(daemon, cfg);
 }
@@ -58,6 +58,8 @@ struct acl_list;
 struct local_zones;
 struct ub_randstate;
 struct daemon_remote;
+struct inflight_table;
+struct cache_snapshot;
 
 #include "dnstap/dnstap_config.h"
 #ifdef USE_DNSTAP
@@ -84,6 +86,10 @@ struct daemon {
 	size_t num_ports;
 	/** reuseport is enabled if true */
 	int reuseport;
+	/** CPUs to pin the threads to, from cpu-affinity, or NULL */
+	int* cpus;
+	/** number of elements in cpus */
+	int num_cpus;
 	/** port number for remote that has ports opened. */
 	int rc_port;
 	/** listening ports for remote control */
@@ -114,6 +120,21 @@ struct daemon {
 	struct timeval time_last_stat;
 	/** time when daemon started */
 	struct timeval time_boot;
+	/** writer of the cache snapshot in the background */
+	struct cache_snapshot* snap;
+	/** if the cache snapshot has been loaded (at the first start) */
+	int snap_loaded;
+	/** next rrset id of the worker allocs, by thread number, kept over
+	 * reloads because the caches keep the ids that msgs refer to */
+	uint64_t* alloc_next_id;
+	/** number of thread numbers in alloc_next_id */
+	int alloc_next_num;
+	/** the config settings that the cached data depends on, as text,
+	 * if they change on reload the rrset, msg and key caches are flushed */
+	char* cache_cfg;
+	/** the queries in progress in the threads, shared by the threads,
+	 * or NULL if queries are not coalesced */
+	struct inflight_table* inflight;
 #ifdef USE_DNSTAP
 	/** the dnstap environment master value, copied and changed by threads*/
 	struct dt_env* dtenv;
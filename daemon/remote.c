@@ -715,6 +715,8 @@ print_stats(SSL* ssl, const char* nm, struct stats_info* s)
 		(unsigned long)s->svr.num_queries_missed_cache)) return 0;
 	if(!ssl_printf(ssl, "%s.num.prefetch"SQ"%lu\n", nm, 
 		(unsigned long)s->svr.num_queries_prefetch)) return 0;
+	if(!ssl_printf(ssl, "%s.num.expired"SQ"%lu\n", nm, 
+		(unsigned long)s->svr.num_queries_expired)) return 0;
 	if(!ssl_printf(ssl, "%s.num.recursivereplies"SQ"%lu\n", nm, 
 		(unsigned long)s->mesh_replies_sent)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.avg"SQ"%g\n", nm,
@@ -728,6 +730,8 @@ print_stats(SSL* ssl, const char* nm, struct stats_info* s)
 		(unsigned long)s->mesh_jostled)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.exceeded"SQ"%lu\n", nm,
 		(unsigned long)s->mesh_dropped)) return 0;
+	if(!ssl_printf(ssl, "%s.requestlist.coalesced"SQ"%lu\n", nm,
+		(unsigned long)s->mesh_coalesced)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.current.all"SQ"%lu\n", nm,
 		(unsigned long)s->mesh_num_states)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.current.user"SQ"%lu\n", nm,
@@ -739,6 +743,22 @@ print_stats(SSL* ssl, const char* nm, struct stats_info* s)
 		s->mesh_time_median)) return 0;
 	if(!ssl_printf(ssl, "%s.tcpusage"SQ"%lu\n", nm,
 		(unsigned long)s->svr.tcp_accept_usage)) return 0;
+	if(!ssl_printf(ssl, "%s.tcpusage.max"SQ"%lu\n", nm,
+		(unsigned long)s->svr.tcp_accept_max)) return 0;
+	if(!ssl_printf(ssl, "%s.tcpusage.shed"SQ"%lu\n", nm,
+		(unsigned long)s->svr.tcp_accept_shed)) return 0;
+	if(!ssl_printf(ssl, "%s.tcpusage.full"SQ"%lu\n", nm,
+		(unsigned long)s->svr.tcp_accept_full)) return 0;
+	if(s->svr.dnstap) {
+		if(!ssl_printf(ssl, "%s.dnstap.queued"SQ"%lu\n", nm,
+			(unsigned long)s->svr.dnstap_queued)) return 0;
+		if(!ssl_printf(ssl, "%s.dnstap.sent"SQ"%lu\n", nm,
+			(unsigned long)s->svr.dnstap_sent)) return 0;
+		if(!ssl_printf(ssl, "%s.dnstap.dropped"SQ"%lu\n", nm,
+			(unsigned long)s->svr.dnstap_dropped)) return 0;
+		if(!ssl_printf(ssl, "%s.dnstap.reconnects"SQ"%lu\n", nm,
+			(unsigned long)s->svr.dnstap_reconnects)) return 0;
+	}
 	return 1;
 }
 
@@ -926,6 +946,16 @@ print_ext(SSL* ssl, struct stats_info* s)
 		(unsigned long)s->svr.qtcp)) return 0;
 	if(!ssl_printf(ssl, "num.query.tcpout"SQ"%lu\n", 
 		(unsigned long)s->svr.qtcp_outgoing)) return 0;
+	if(!ssl_printf(ssl, "num.query.tcpout.reuse"SQ"%lu\n", 
+		(unsigned long)s->svr.qtcp_outgoing_reuse)) return 0;
+	if(!ssl_printf(ssl, "num.query.tlsout.resume"SQ"%lu\n", 
+		(unsigned long)s->svr.qtls_resume)) return 0;
+	if(!ssl_printf(ssl, "num.tcpout.open"SQ"%lu\n", 
+		(unsigned long)s->svr.tcp_out_open)) return 0;
+	if(!ssl_printf(ssl, "num.tcpout.idle"SQ"%lu\n", 
+		(unsigned long)s->svr.tcp_out_idle)) return 0;
+	if(!ssl_printf(ssl, "num.query.hedged"SQ"%lu\n", 
+		(unsigned long)s->svr.qhedged)) return 0;
 	if(!ssl_printf(ssl, "num.query.ipv6"SQ"%lu\n", 
 		(unsigned long)s->svr.qipv6)) return 0;
 	/* flags */
@@ -975,6 +1005,10 @@ print_ext(SSL* ssl, struct stats_info* s)
 		(unsigned long)s->svr.ans_bogus)) return 0;
 	if(!ssl_printf(ssl, "num.rrset.bogus"SQ"%lu\n", 
 		(unsigned long)s->svr.rrset_bogus)) return 0;
+	if(!ssl_printf(ssl, "num.query.aggressive.NOERROR"SQ"%lu\n", 
+		(unsigned long)s->svr.num_neg_cache_noerror)) return 0;
+	if(!ssl_printf(ssl, "num.query.aggressive.NXDOMAIN"SQ"%lu\n", 
+		(unsigned long)s->svr.num_neg_cache_nxdomain)) return 0;
 	/* threat detection */
 	if(!ssl_printf(ssl, "unwanted.queries"SQ"%lu\n", 
 		(unsigned long)s->svr.unwanted_queries)) return 0;
@@ -989,6 +1023,23 @@ print_ext(SSL* ssl, struct stats_info* s)
 		(unsigned)s->svr.infra_cache_count)) return 0;
 	if(!ssl_printf(ssl, "key.cache.count"SQ"%u\n",
 		(unsigned)s->svr.key_cache_count)) return 0;
+	/* cache admission */
+	if(!ssl_printf(ssl, "msg.cache.lookups"SQ"%lu\n",
+		(unsigned long)s->svr.msg_cache_lookups)) return 0;
+	if(!ssl_printf(ssl, "msg.cache.hits"SQ"%lu\n",
+		(unsigned long)s->svr.msg_cache_hits)) return 0;
+	if(!ssl_printf(ssl, "msg.cache.admitted"SQ"%lu\n",
+		(unsigned long)s->svr.msg_cache_admitted)) return 0;
+	if(!ssl_printf(ssl, "msg.cache.rejected"SQ"%lu\n",
+		(unsigned long)s->svr.msg_cache_rejected)) return 0;
+	if(!ssl_printf(ssl, "rrset.cache.lookups"SQ"%lu\n",
+		(unsigned long)s->svr.rrset_cache_lookups)) return 0;
+	if(!ssl_printf(ssl, "rrset.cache.hits"SQ"%lu\n",
+		(unsigned long)s->svr.rrset_cache_hits)) return 0;
+	if(!ssl_printf(ssl, "rrset.cache.admitted"SQ"%lu\n",
+		(unsigned long)s->svr.rrset_cache_admitted)) return 0;
+	if(!ssl_printf(ssl, "rrset.cache.rejected"SQ"%lu\n",
+		(unsigned long)s->svr.rrset_cache_rejected)) return 0;
 	return 1;
 }
 
@@ -2097,10 +2148,15 @@ dump_infra_host(struct lruhash_entry* e, void* arg)
 		return;
 	}
 	if(!ssl_printf(a->ssl, "%s %s ttl %lu ping %d var %d rtt %d rto %d "
+		"p50 %d p90 %d p99 %d replies %d lost %d "
 		"tA %d tAAAA %d tother %d "
 		"ednsknown %d edns %d delay %d lame dnssec %d rec %d A %d "
 		"other %d\n", ip_str, name, (unsigned long)(d->ttl - a->now),
 		d->rtt.srtt, d->rtt.rttvar, rtt_notimeout(&d->rtt), d->rtt.rto,
+		rtt_sketch_percentile(&d->sketch, 50),
+		rtt_sketch_percentile(&d->sketch, 90),
+		rtt_sketch_percentile(&d->sketch, 99),
+		(int)d->sketch.replies, (int)d->sketch.lost,
 		d->timeout_A, d->timeout_AAAA, d->timeout_other,
 		(int)d->edns_lame_known, (int)d->edns_version,
 		(int)(a->now<d->probedelay?(d->probedelay - a->now):0),
@@ -56,6 +56,7 @@
 #include "util/timehist.h"
 #include "util/net_help.h"
 #include "validator/validator.h"
+#include "validator/val_neg.h"
 #include "sldns/sbuffer.h"
 #include "services/cache/rrset.h"
 #include "services/cache/infra.h"
@@ -79,6 +80,7 @@ void server_stats_init(struct server_stats* stats, struct config_file* cfg)
 {
 	memset(stats, 0, sizeof(*stats));
 	stats->extended = cfg->stat_extended;
+	stats->dnstap = cfg->dnstap;
 }
 
 void server_stats_querymiss(struct server_stats* stats, struct worker* worker)
@@ -137,6 +139,52 @@ get_rrset_bogus(struct worker* worker)
 	return r;
 }
 
+/** get the number of answers synthesized from the negative cache */
+static void
+get_neg_cache_stats(struct worker* worker, struct server_stats* svr)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "validator");
+	struct val_env* ve;
+	struct val_neg_cache* neg;
+	if(m == -1)
+		return;
+	ve = (struct val_env*)worker->env.modinfo[m];
+	if(!(neg = ve->neg_cache))
+		return;
+	lock_basic_lock(&neg->lock);
+	svr->num_neg_cache_noerror = neg->num_neg_cache_noerror;
+	svr->num_neg_cache_nxdomain = neg->num_neg_cache_nxdomain;
+	if(!worker->env.cfg->stat_cumulative) {
+		neg->num_neg_cache_noerror = 0;
+		neg->num_neg_cache_nxdomain = 0;
+	}
+	lock_basic_unlock(&neg->lock);
+}
+
+/** get the counters of the admission policy of the message and rrset
+ * caches. They are shared by the threads, the first thread gets them. */
+static void
+get_admit_stats(struct worker* worker, struct server_stats* svr, int reset)
+{
+	struct lruhash_admit_stats m, r;
+	memset(&m, 0, sizeof(m));
+	memset(&r, 0, sizeof(r));
+	if(worker->thread_num == 0) {
+		reset = reset && !worker->env.cfg->stat_cumulative;
+		slabhash_get_admit_stats(worker->env.msg_cache, &m, reset);
+		slabhash_get_admit_stats(&worker->env.rrset_cache->table, &r,
+			reset);
+	}
+	svr->msg_cache_lookups = m.lookups;
+	svr->msg_cache_hits = m.hits;
+	svr->msg_cache_admitted = m.admitted;
+	svr->msg_cache_rejected = m.rejected;
+	svr->rrset_cache_lookups = r.lookups;
+	svr->rrset_cache_hits = r.hits;
+	svr->rrset_cache_admitted = r.admitted;
+	svr->rrset_cache_rejected = r.rejected;
+}
+
 void
 server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 {
@@ -148,6 +196,7 @@ server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 	s->mesh_num_reply_states = worker->env.mesh->num_reply_states;
 	s->mesh_jostled = worker->env.mesh->stats_jostled;
 	s->mesh_dropped = worker->env.mesh->stats_dropped;
+	s->mesh_coalesced = worker->env.mesh->stats_coalesced;
 	s->mesh_replies_sent = worker->env.mesh->replies_sent;
 	s->mesh_replies_sum_wait = worker->env.mesh->replies_sum_wait;
 	s->mesh_time_median = timehist_quartile(worker->env.mesh->histogram,
@@ -164,9 +213,16 @@ server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 	/* values from outside network */
 	s->svr.unwanted_replies = worker->back->unwanted_replies;
 	s->svr.qtcp_outgoing = worker->back->num_tcp_outgoing;
+	s->svr.qtcp_outgoing_reuse = worker->back->num_tcp_reuse;
+	s->svr.qtls_resume = worker->back->num_tls_resume;
+	s->svr.qhedged = worker->back->num_hedged;
+	outnet_tcp_get_counts(worker->back, &s->svr.tcp_out_open,
+		&s->svr.tcp_out_idle);
 
 	/* get and reset validator rrset bogus number */
 	s->svr.rrset_bogus = get_rrset_bogus(worker);
+	/* get and reset the aggressive negative cache answers */
+	get_neg_cache_stats(worker, &s->svr);
 
 	/* get cache sizes */
 	s->svr.msg_cache_count = count_slabhash_entries(worker->env.msg_cache);
@@ -175,14 +231,30 @@ server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 	if(worker->env.key_cache)
 		s->svr.key_cache_count = count_slabhash_entries(worker->env.key_cache->slab);
 	else	s->svr.key_cache_count = 0;
+	get_admit_stats(worker, &s->svr, reset);
 
 	/* get tcp accept usage */
 	s->svr.tcp_accept_usage = 0;
+	s->svr.tcp_accept_max = 0;
+	s->svr.tcp_accept_shed = 0;
+	s->svr.tcp_accept_full = 0;
 	for(lp = worker->front->cps; lp; lp = lp->next) {
-		if(lp->com->type == comm_tcp_accept)
+		if(lp->com->type == comm_tcp_accept) {
 			s->svr.tcp_accept_usage += lp->com->cur_tcp_count;
+			s->svr.tcp_accept_max += lp->com->tcp_max_used;
+			s->svr.tcp_accept_shed += lp->com->tcp_num_shed;
+			s->svr.tcp_accept_full += lp->com->tcp_num_full;
+		}
 	}
 
+#ifdef USE_DNSTAP
+	/* get dnstap counters */
+	if(worker->env.cfg->dnstap)
+		dt_stats_get(&worker->dtenv, &s->svr.dnstap_queued,
+			&s->svr.dnstap_sent, &s->svr.dnstap_dropped,
+			&s->svr.dnstap_reconnects);
+#endif
+
 	if(reset && !worker->env.cfg->stat_cumulative) {
 		worker_stats_clear(worker);
 	}
@@ -228,10 +300,15 @@ void server_stats_add(struct stats_info* total, struct stats_info* a)
 	total->svr.num_queries += a->svr.num_queries;
 	total->svr.num_queries_missed_cache += a->svr.num_queries_missed_cache;
 	total->svr.num_queries_prefetch += a->svr.num_queries_prefetch;
+	total->svr.num_queries_expired += a->svr.num_queries_expired;
 	total->svr.sum_query_list_size += a->svr.sum_query_list_size;
 	/* the max size reached is upped to higher of both */
 	if(a->svr.max_query_list_size > total->svr.max_query_list_size)
 		total->svr.max_query_list_size = a->svr.max_query_list_size;
+	total->svr.dnstap_queued += a->svr.dnstap_queued;
+	total->svr.dnstap_sent += a->svr.dnstap_sent;
+	total->svr.dnstap_dropped += a->svr.dnstap_dropped;
+	total->svr.dnstap_reconnects += a->svr.dnstap_reconnects;
 
 	if(a->svr.extended) {
 		int i;
@@ -239,6 +316,11 @@ void server_stats_add(struct stats_info* total, struct stats_info* a)
 		total->svr.qclass_big += a->svr.qclass_big;
 		total->svr.qtcp += a->svr.qtcp;
 		total->svr.qtcp_outgoing += a->svr.qtcp_outgoing;
+		total->svr.qtcp_outgoing_reuse += a->svr.qtcp_outgoing_reuse;
+		total->svr.qtls_resume += a->svr.qtls_resume;
+		total->svr.tcp_out_open += a->svr.tcp_out_open;
+		total->svr.tcp_out_idle += a->svr.tcp_out_idle;
+		total->svr.qhedged += a->svr.qhedged;
 		total->svr.qipv6 += a->svr.qipv6;
 		total->svr.qbit_QR += a->svr.qbit_QR;
 		total->svr.qbit_AA += a->svr.qbit_AA;
@@ -254,9 +336,16 @@ void server_stats_add(struct stats_info* total, struct stats_info* a)
 		total->svr.ans_secure += a->svr.ans_secure;
 		total->svr.ans_bogus += a->svr.ans_bogus;
 		total->svr.rrset_bogus += a->svr.rrset_bogus;
+		total->svr.num_neg_cache_noerror +=
+			a->svr.num_neg_cache_noerror;
+		total->svr.num_neg_cache_nxdomain +=
+			a->svr.num_neg_cache_nxdomain;
 		total->svr.unwanted_replies += a->svr.unwanted_replies;
 		total->svr.unwanted_queries += a->svr.unwanted_queries;
 		total->svr.tcp_accept_usage += a->svr.tcp_accept_usage;
+		total->svr.tcp_accept_max += a->svr.tcp_accept_max;
+		total->svr.tcp_accept_shed += a->svr.tcp_accept_shed;
+		total->svr.tcp_accept_full += a->svr.tcp_accept_full;
 		for(i=0; i<STATS_QTYPE_NUM; i++)
 			total->svr.qtype[i] += a->svr.qtype[i];
 		for(i=0; i<STATS_QCLASS_NUM; i++)
@@ -273,6 +362,7 @@ void server_stats_add(struct stats_info* total, struct stats_info* a)
 	total->mesh_num_reply_states += a->mesh_num_reply_states;
 	total->mesh_jostled += a->mesh_jostled;
 	total->mesh_dropped += a->mesh_dropped;
+	total->mesh_coalesced += a->mesh_coalesced;
 	total->mesh_replies_sent += a->mesh_replies_sent;
 	timeval_add(&total->mesh_replies_sum_wait, &a->mesh_replies_sum_wait);
 	/* the medians are averaged together, this is not as accurate as
@@ -67,6 +67,8 @@ struct server_stats {
 	size_t num_queries_missed_cache;
 	/** number of prefetch queries - cachehits with prefetch */
 	size_t num_queries_prefetch;
+	/** number of answers from expired cache entries (serve-expired) */
+	size_t num_queries_expired;
 
 	/**
 	 * Sum of the querylistsize of the worker for 
@@ -93,6 +95,16 @@ struct server_stats {
 	size_t qtcp;
 	/** number of outgoing queries over TCP */
 	size_t qtcp_outgoing;
+	/** number of outgoing TCP queries sent on an open connection */
+	size_t qtcp_outgoing_reuse;
+	/** number of outgoing TLS connections that resumed a session */
+	size_t qtls_resume;
+	/** number of open outgoing TCP connections */
+	size_t tcp_out_open;
+	/** number of idle outgoing TCP connections, kept open for reuse */
+	size_t tcp_out_idle;
+	/** number of slow outgoing queries that were also sent elsewhere */
+	size_t qhedged;
 	/** number of queries over IPv6 */
 	size_t qipv6;
 	/** number of queries with QR bit */
@@ -125,12 +137,22 @@ struct server_stats {
 	size_t ans_bogus;
 	/** rrsets marked bogus by validator */
 	size_t rrset_bogus;
+	/** NOERROR answers synthesized from the negative cache */
+	size_t num_neg_cache_noerror;
+	/** NXDOMAIN answers synthesized from the negative cache */
+	size_t num_neg_cache_nxdomain;
 	/** unwanted traffic received on server-facing ports */
 	size_t unwanted_replies;
 	/** unwanted traffic received on client-facing ports */
 	size_t unwanted_queries;
 	/** usage of tcp accept list */
 	size_t tcp_accept_usage;
+	/** highest usage of tcp accept list, since the stats were cleared */
+	size_t tcp_accept_max;
+	/** idle incoming tcp connections closed for new connections */
+	size_t tcp_accept_shed;
+	/** times incoming tcp connections had to wait, all were busy */
+	size_t tcp_accept_full;
 
 	/** histogram data exported to array 
 	 * if the array is the same size, no data is lost, and
@@ -146,6 +168,33 @@ struct server_stats {
 	size_t infra_cache_count;
 	/** number of key cache entries */
 	size_t key_cache_count;
+	/** lookups in the message cache, with cache-admission */
+	size_t msg_cache_lookups;
+	/** lookups in the message cache that found the entry */
+	size_t msg_cache_hits;
+	/** new messages that the admission policy kept */
+	size_t msg_cache_admitted;
+	/** new messages that the admission policy did not keep */
+	size_t msg_cache_rejected;
+	/** lookups in the rrset cache, with cache-admission */
+	size_t rrset_cache_lookups;
+	/** lookups in the rrset cache that found the entry */
+	size_t rrset_cache_hits;
+	/** new rrsets that the admission policy kept */
+	size_t rrset_cache_admitted;
+	/** new rrsets that the admission policy did not keep */
+	size_t rrset_cache_rejected;
+
+	/** dnstap stats below (bool) */
+	int dnstap;
+	/** number of dnstap events queued */
+	size_t dnstap_queued;
+	/** number of dnstap events written out */
+	size_t dnstap_sent;
+	/** number of dnstap events dropped */
+	size_t dnstap_dropped;
+	/** number of times the dnstap output was reopened */
+	size_t dnstap_reconnects;
 };
 
 /** 
@@ -164,6 +213,8 @@ struct stats_info {
 	size_t mesh_jostled;
 	/** mesh stats: number of incoming queries dropped */
 	size_t mesh_dropped;
+	/** mesh stats: number of queries that waited for another thread */
+	size_t mesh_coalesced;
 	/** mesh stats: replies sent */
 	size_t mesh_replies_sent;
 	/** mesh stats: sum of waiting times for the replies */
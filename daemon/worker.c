@@ -46,6 +46,7 @@
 #include "daemon/worker.h"
 #include "daemon/daemon.h"
 #include "daemon/remote.h"
+#include "daemon/cachesnap.h"
 #include "daemon/acl_list.h"
 #include "util/netevent.h"
 #include "util/config_file.h"
@@ -402,6 +403,10 @@ worker_handle_control_cmd(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
 		verbose(VERB_ALGO, "got control cmd remote");
 		daemon_remote_exec(worker);
 		break;
+	case worker_cmd_inflight:
+		verbose(VERB_ALGO, "got control cmd inflight");
+		mesh_inflight_continue(worker->env.mesh);
+		break;
 	default:
 		log_err("bad command %d", (int)cmd);
 		break;
@@ -542,15 +547,19 @@ answer_norec_from_cache(struct worker* worker, struct query_info* qinfo,
 	return 1;
 }
 
-/** answer query from the cache */
+/** answer query from the cache, if a new pre-encoded answer is made
+ * it is returned in wire, to be stored when the cache entry is unlocked.
+ * If the answer is expired (serve-expired) that is returned in expired. */
 static int
 answer_from_cache(struct worker* worker, struct query_info* qinfo,
 	struct reply_info* rep, uint16_t id, uint16_t flags,
-	struct comm_reply* repinfo, struct edns_data* edns)
+	struct comm_reply* repinfo, struct edns_data* edns,
+	struct reply_wire** wire, int* expired)
 {
 	time_t timenow = *worker->env.now;
+	time_t locktime = timenow;
 	uint16_t udpsize = edns->udp_size;
-	int secure;
+	int secure, dnssec;
 	int must_validate = (!(flags&BIT_CD) || worker->env.cfg->ignore_cd)
 		&& worker->env.need_to_validate;
 	/* see if it is possible */
@@ -559,9 +568,19 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 		 * we will refetch the message format from the
 		 * authoritative server
 		 */
-		return 0;
+		if(!SERVE_EXPIRED || (SERVE_EXPIRED_TTL &&
+			timenow - rep->ttl > SERVE_EXPIRED_TTL))
+			return 0;
+		/* serve expired positive and nxdomain answers, the
+		 * errors are not worth keeping */
+		if(FLAGS_GET_RCODE(rep->flags) != LDNS_RCODE_NOERROR &&
+			FLAGS_GET_RCODE(rep->flags) != LDNS_RCODE_NXDOMAIN)
+			return 0;
+		/* the rrsets may be expired as well, within the limit */
+		locktime = SERVE_EXPIRED_TTL?timenow - SERVE_EXPIRED_TTL:0;
+		*expired = 1;
 	}
-	if(!rrset_array_lock(rep->ref, rep->rrset_count, timenow))
+	if(!rrset_array_lock(rep->ref, rep->rrset_count, locktime))
 		return 0;
 	/* locked and ids and ttls are OK. */
 	/* check CNAME chain (if any) */
@@ -616,11 +635,22 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 	edns->udp_size = EDNS_ADVERTISED_SIZE;
 	edns->ext_rcode = 0;
 	edns->bits &= EDNS_DO;
-	if(!reply_info_answer_encode(qinfo, rep, id, flags,
+	dnssec = (edns->bits & EDNS_DO)?1:0;
+	if(!*expired && rep->wire[dnssec] && reply_wire_answer(
+		rep->wire[dnssec], qinfo, rep, id, flags, repinfo->c->buffer,
+		timenow, udpsize, edns, dnssec, secure)) {
+		/* answered with the pre-encoded image */
+	} else if(!reply_info_answer_encode(qinfo, rep, id, flags,
 		repinfo->c->buffer, timenow, 1, worker->scratchpad,
-		udpsize, edns, (int)(edns->bits & EDNS_DO), secure)) {
+		udpsize, edns, dnssec, secure)) {
 		error_encode(repinfo->c->buffer, LDNS_RCODE_SERVFAIL,
 			qinfo, id, flags, edns);
+	} else if(worker->env.cfg->msg_cache_wire && !*expired &&
+		(!rep->wire[dnssec] ||
+		!reply_wire_valid(rep->wire[dnssec], rep, timenow))) {
+		*wire = reply_wire_create(qinfo, rep,
+			worker->env.scratch_buffer, timenow,
+			worker->scratchpad, dnssec);
 	}
 	/* cannot send the reply right now, because blocking network syscall
 	 * is bad while holding locks. */
@@ -963,18 +993,32 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 	}
 	h = query_info_hash(&qinfo, sldns_buffer_read_u16_at(c->buffer, 2));
 	if((e=slabhash_lookup(worker->env.msg_cache, h, &qinfo, 0))) {
+		struct reply_info* rep = (struct reply_info*)e->data;
+		struct reply_wire* wire = NULL;
+		int expired = 0;
+		uint16_t qflags = sldns_buffer_read_u16_at(c->buffer, 2);
 		/* answer from cache - we have acquired a readlock on it */
-		if(answer_from_cache(worker, &qinfo,
-			(struct reply_info*)e->data,
+		if(answer_from_cache(worker, &qinfo, rep,
 			*(uint16_t*)(void *)sldns_buffer_begin(c->buffer),
-			sldns_buffer_read_u16_at(c->buffer, 2), repinfo,
-			&edns)) {
-			/* prefetch it if the prefetch TTL expired */
-			if(worker->env.cfg->prefetch && *worker->env.now >=
-				((struct reply_info*)e->data)->prefetch_ttl) {
+			qflags, repinfo, &edns, &wire, &expired)) {
+			/* prefetch it if the prefetch TTL expired, or
+			 * refresh it if the answer was expired */
+			if(expired || (worker->env.cfg->prefetch &&
+				*worker->env.now >= ((struct reply_info*)
+				e->data)->prefetch_ttl)) {
 				time_t leeway = ((struct reply_info*)e->
 					data)->ttl - *worker->env.now;
 				lock_rw_unlock(&e->lock);
+				if(expired) {
+					/* the expired answer is kept if the
+					 * refresh fails */
+					leeway = 0;
+					worker->stats.num_queries_expired++;
+				}
+				if(wire)
+					dns_cache_store_wire(&worker->env,
+						&qinfo, qflags, rep,
+						(edns.bits & EDNS_DO), wire);
 				reply_and_prefetch(worker, &qinfo,
 					sldns_buffer_read_u16_at(c->buffer, 2),
 					repinfo, leeway);
@@ -982,6 +1026,10 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 				goto send_reply_rc;
 			}
 			lock_rw_unlock(&e->lock);
+			if(wire)
+				dns_cache_store_wire(&worker->env, &qinfo,
+					qflags, rep, (edns.bits & EDNS_DO),
+					wire);
 			goto send_reply;
 		}
 		verbose(VERB_ALGO, "answer from the cache failed");
@@ -1085,6 +1133,44 @@ void worker_stat_timer_cb(void* arg)
 	worker_restart_timer(worker);
 }
 
+/** restart the cache snapshot timer */
+static void
+worker_restart_snapshot_timer(struct worker* worker)
+{
+	struct timeval tv;
+#ifndef S_SPLINT_S
+	tv.tv_sec = worker->env.cfg->cache_snapshot_interval;
+	tv.tv_usec = 0;
+#endif
+	comm_timer_set(worker->snap_timer, &tv);
+}
+
+void worker_snapshot_timer_cb(void* arg)
+{
+	struct worker* worker = (struct worker*)arg;
+	cache_snapshot_write_bg(worker->daemon->snap, worker->daemon);
+	worker_restart_snapshot_timer(worker);
+}
+
+/** restart the inflight wait timer */
+static void
+worker_restart_inflight_timer(struct worker* worker)
+{
+	struct timeval tv;
+#ifndef S_SPLINT_S
+	tv.tv_sec = 1;
+	tv.tv_usec = 0;
+#endif
+	comm_timer_set(worker->inflight_timer, &tv);
+}
+
+void worker_inflight_timer_cb(void* arg)
+{
+	struct worker* worker = (struct worker*)arg;
+	mesh_inflight_timeout(worker->env.mesh);
+	worker_restart_inflight_timer(worker);
+}
+
 void worker_probe_timer_cb(void* arg)
 {
 	struct worker* worker = (struct worker*)arg;
@@ -1135,7 +1221,7 @@ worker_create(struct daemon* daemon, int id, int* ports, int n)
 	if(daemon->cfg->dnstap) {
 		log_assert(daemon->dtenv != NULL);
 		memcpy(&worker->dtenv, daemon->dtenv, sizeof(struct dt_env));
-		if(!dt_init(&worker->dtenv))
+		if(!dt_init(&worker->dtenv, (unsigned int)worker->thread_num))
 			fatal_exit("dt_init failed");
 	}
 #endif
@@ -1160,6 +1246,12 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	}
 	comm_base_set_slow_accept_handlers(worker->base, &worker_stop_accept,
 		&worker_start_accept, worker);
+	if(!comm_base_set_udp_batch(worker->base, cfg->udp_batch_size,
+		cfg->msg_buffer_size)) {
+		log_err("could not create udp batch buffers");
+		worker_delete(worker);
+		return 0;
+	}
 	if(do_sigs) {
 #ifdef SIGHUP
 		ub_thread_sig_unblock(SIGHUP);
@@ -1199,8 +1291,8 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	}
 	worker->front = listen_create(worker->base, ports,
 		cfg->msg_buffer_size, (int)cfg->incoming_num_tcp,
-		worker->daemon->listen_sslctx, dtenv, worker_handle_request,
-		worker);
+		cfg->incoming_tcp_pipeline, worker->daemon->listen_sslctx,
+		dtenv, worker_handle_request, worker);
 	if(!worker->front) {
 		log_err("could not create listening sockets");
 		worker_delete(worker);
@@ -1214,7 +1306,9 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		cfg->use_caps_bits_for_id, worker->ports, worker->numports,
 		cfg->unwanted_threshold, &worker_alloc_cleanup, worker,
 		cfg->do_udp, worker->daemon->connect_sslctx, cfg->delay_close,
-		dtenv);
+		dtenv, cfg->tcp_reuse_timeout, cfg->max_reuse_tcp_queries,
+		cfg->outgoing_port_pool, cfg->outgoing_port_lifetime,
+		cfg->hedge_query_budget);
 	if(!worker->back) {
 		log_err("could not create outgoing sockets");
 		worker_delete(worker);
@@ -1246,6 +1340,11 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	alloc_init(&worker->alloc, &worker->daemon->superalloc,
 		worker->thread_num);
 	alloc_set_id_cleanup(&worker->alloc, &worker_alloc_cleanup, worker);
+	/* after a reload, continue with the rrset IDs, the cache has them */
+	if(worker->thread_num < worker->daemon->alloc_next_num &&
+		worker->daemon->alloc_next_id[worker->thread_num])
+		worker->alloc.next_id =
+			worker->daemon->alloc_next_id[worker->thread_num];
 	worker->env = *worker->daemon->env;
 	comm_base_timept(worker->base, &worker->env.now, &worker->env.now_tv);
 	if(worker->thread_num == 0)
@@ -1273,6 +1372,16 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	/* the first thread writes the cache snapshot periodically */
+	if(worker->thread_num == 0 && cfg->cache_snapshot_file &&
+		cfg->cache_snapshot_file[0] &&
+		cfg->cache_snapshot_interval > 0) {
+		worker->snap_timer = comm_timer_create(worker->base,
+			worker_snapshot_timer_cb, worker);
+		if(!worker->snap_timer)
+			log_err("could not create cache snapshot timer");
+		else	worker_restart_snapshot_timer(worker);
+	}
 	/* one probe timer per process -- if we have 5011 anchors */
 	if(autr_get_num_anchors(worker->env.anchors) > 0
 #ifndef THREADS_DISABLED
@@ -1295,6 +1404,18 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	/* coalesce queries in progress with the other threads */
+	worker->env.mesh->inflight = worker->daemon->inflight;
+	worker->env.mesh->inflight_thread = worker->thread_num;
+	/* the states that wait too long for the other threads resolve
+	 * the query themselves */
+	if(worker->env.mesh->inflight) {
+		worker->inflight_timer = comm_timer_create(worker->base,
+			worker_inflight_timer_cb, worker);
+		if(!worker->inflight_timer)
+			log_err("could not create inflight timer");
+		else	worker_restart_inflight_timer(worker);
+	}
 	worker_mem_report(worker, NULL);
 	/* if statistics enabled start timer */
 	if(worker->env.cfg->stat_interval > 0) {
@@ -1331,6 +1452,8 @@ worker_delete(struct worker* worker)
 	comm_signal_delete(worker->comsig);
 	tube_delete(worker->cmd);
 	comm_timer_delete(worker->stat_timer);
+	comm_timer_delete(worker->snap_timer);
+	comm_timer_delete(worker->inflight_timer);
 	comm_timer_delete(worker->env.probe_timer);
 	free(worker->ports);
 	if(worker->thread_num == 0) {
@@ -1343,11 +1466,6 @@ worker_delete(struct worker* worker)
 	ub_randfree(worker->rndstate);
 	alloc_clear(&worker->alloc);
 	regional_destroy(worker->scratchpad);
-
-	#ifdef USE_DNSTAP
-		pipe_producer_free(worker->dtenv.so_producer);
-	#endif
-
 	free(worker);
 }
 
@@ -1384,10 +1502,25 @@ worker_alloc_cleanup(void* arg)
 
 void worker_stats_clear(struct worker* worker)
 {
+	struct listen_list* lp;
 	server_stats_init(&worker->stats, worker->env.cfg);
 	mesh_stats_clear(worker->env.mesh);
 	worker->back->unwanted_replies = 0;
 	worker->back->num_tcp_outgoing = 0;
+	worker->back->num_tcp_reuse = 0;
+	worker->back->num_tls_resume = 0;
+	worker->back->num_hedged = 0;
+	for(lp = worker->front->cps; lp; lp = lp->next) {
+		if(lp->com->type == comm_tcp_accept) {
+			lp->com->tcp_max_used = lp->com->cur_tcp_count;
+			lp->com->tcp_num_shed = 0;
+			lp->com->tcp_num_full = 0;
+		}
+	}
+#ifdef USE_DNSTAP
+	if(worker->env.cfg->dnstap)
+		dt_stats_clear(&worker->dtenv);
+#endif
 }
 
 void worker_start_accept(void* arg)
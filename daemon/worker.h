@@ -71,7 +71,9 @@ enum worker_commands {
 	/** obtain statistics without statsclear */
 	worker_cmd_stats_noreset,
 	/** execute remote control command */
-	worker_cmd_remote
+	worker_cmd_remote,
+	/** continue the queries that waited for another thread */
+	worker_cmd_inflight
 };
 
 /**
@@ -103,6 +105,10 @@ struct worker {
 	struct comm_point* cmd_com;
 	/** timer for statistics */
 	struct comm_timer* stat_timer;
+	/** timer for the cache snapshot, for the first thread */
+	struct comm_timer* snap_timer;
+	/** timer for the queries that wait for another thread */
+	struct comm_timer* inflight_timer;
 	/** ratelimit for errors, time value */
 	time_t err_limit_time;
 	/** ratelimit for errors, packet count */
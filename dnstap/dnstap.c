@@ -43,6 +43,7 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <string.h>
+#include <unistd.h>
 #include <sys/time.h>
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -55,40 +56,292 @@
 #include "util/log.h"
 
 #include "dnstap/dnstap.h"
+#include "dnstap/dtstream.h"
 
-static int
-dt_pack(const Dnstap__Dnstap *d, void **buf, size_t *sz)
+/* protobuf wire types used by the dnstap schema */
+#define DT_PB_VARINT	0
+#define DT_PB_LENDELIM	2
+#define DT_PB_FIXED32	5
+/* all dnstap field numbers are below 16, so a tag is one byte */
+#define DT_PB_TAG(field, wt) ((uint8_t) (((field) << 3) | (wt)))
+
+static size_t
+dt_pb_varint_size(uint64_t v)
+{
+	size_t n = 1;
+	while (v >= 0x80) {
+		v >>= 7;
+		n++;
+	}
+	return n;
+}
+
+static uint8_t *
+dt_pb_varint(uint8_t *p, uint64_t v)
+{
+	while (v >= 0x80) {
+		*p++ = (uint8_t) (v | 0x80);
+		v >>= 7;
+	}
+	*p++ = (uint8_t) v;
+	return p;
+}
+
+static size_t
+dt_pb_bytes_size(const ProtobufCBinaryData *b)
+{
+	return 1 + dt_pb_varint_size(b->len) + b->len;
+}
+
+static uint8_t *
+dt_pb_bytes(uint8_t *p, int field, const ProtobufCBinaryData *b)
+{
+	*p++ = DT_PB_TAG(field, DT_PB_LENDELIM);
+	p = dt_pb_varint(p, b->len);
+	memcpy(p, b->data, b->len);
+	return p + b->len;
+}
+
+static uint8_t *
+dt_pb_uint(uint8_t *p, int field, uint64_t v)
 {
-	ProtobufCBufferSimple sbuf;
-	memset(&sbuf, 0, sizeof(sbuf));
+	*p++ = DT_PB_TAG(field, DT_PB_VARINT);
+	return dt_pb_varint(p, v);
+}
 
-	sbuf.base.append = protobuf_c_buffer_simple_append;
-	sbuf.len = 0;
-	sbuf.alloced = DNSTAP_INITIAL_BUF_SIZE;
-	sbuf.data = malloc(sbuf.alloced);
+static uint8_t *
+dt_pb_fixed32(uint8_t *p, int field, uint32_t v)
+{
+	*p++ = DT_PB_TAG(field, DT_PB_FIXED32);
+	p[0] = (uint8_t) v;
+	p[1] = (uint8_t) (v >> 8);
+	p[2] = (uint8_t) (v >> 16);
+	p[3] = (uint8_t) (v >> 24);
+	return p + 4;
+}
+
+/* Size of the encoded Message, without its tag and length. */
+static size_t
+dt_msg_message_size(const Dnstap__Message *m)
+{
+	size_t sz = 1 + dt_pb_varint_size((uint64_t) m->type);
+	if (m->has_socket_family)
+		sz += 1 + dt_pb_varint_size((uint64_t) m->socket_family);
+	if (m->has_socket_protocol)
+		sz += 1 + dt_pb_varint_size((uint64_t) m->socket_protocol);
+	if (m->has_query_address)
+		sz += dt_pb_bytes_size(&m->query_address);
+	if (m->has_response_address)
+		sz += dt_pb_bytes_size(&m->response_address);
+	if (m->has_query_port)
+		sz += 1 + dt_pb_varint_size(m->query_port);
+	if (m->has_response_port)
+		sz += 1 + dt_pb_varint_size(m->response_port);
+	if (m->has_query_time_sec)
+		sz += 1 + dt_pb_varint_size(m->query_time_sec);
+	if (m->has_query_time_nsec)
+		sz += 1 + 4;
+	if (m->has_query_message)
+		sz += dt_pb_bytes_size(&m->query_message);
+	if (m->has_query_zone)
+		sz += dt_pb_bytes_size(&m->query_zone);
+	if (m->has_response_time_sec)
+		sz += 1 + dt_pb_varint_size(m->response_time_sec);
+	if (m->has_response_time_nsec)
+		sz += 1 + 4;
+	if (m->has_response_message)
+		sz += dt_pb_bytes_size(&m->response_message);
+	return sz;
+}
 
-	if (sbuf.data == NULL) return 0;
-	sbuf.must_free_data = 1;
+/* Size of the encoded Dnstap message; the Message size is returned in msz. */
+static size_t
+dt_msg_size(const dt_msg_t *dm, size_t *msz)
+{
+	const Dnstap__Dnstap *d = &dm->d;
+	size_t sz = 1 + dt_pb_varint_size((uint64_t) d->type);
+	*msz = dt_msg_message_size(&dm->m);
+	if (d->has_identity)
+		sz += dt_pb_bytes_size(&d->identity);
+	if (d->has_version)
+		sz += dt_pb_bytes_size(&d->version);
+	if (d->has_extra)
+		sz += dt_pb_bytes_size(&d->extra);
+	sz += 1 + dt_pb_varint_size(*msz) + *msz;
+	return sz;
+}
 
-	*sz = dnstap__dnstap__pack_to_buffer(d, (ProtobufCBuffer *) &sbuf);
-	if (sbuf.data == NULL) return 0;
+/*
+ * Encode the Dnstap message in protobuf wire format, fields in numeric
+ * order like protobuf-c does. The caller has made room for dt_msg_size().
+ */
+static uint8_t *
+dt_msg_encode(const dt_msg_t *dm, size_t msz, uint8_t *p)
+{
+	const Dnstap__Dnstap *d = &dm->d;
+	const Dnstap__Message *m = &dm->m;
+
+	if (d->has_identity)
+		p = dt_pb_bytes(p, 1, &d->identity);
+	if (d->has_version)
+		p = dt_pb_bytes(p, 2, &d->version);
+	if (d->has_extra)
+		p = dt_pb_bytes(p, 3, &d->extra);
+
+	*p++ = DT_PB_TAG(14, DT_PB_LENDELIM);
+	p = dt_pb_varint(p, msz);
+	p = dt_pb_uint(p, 1, (uint64_t) m->type);
+	if (m->has_socket_family)
+		p = dt_pb_uint(p, 2, (uint64_t) m->socket_family);
+	if (m->has_socket_protocol)
+		p = dt_pb_uint(p, 3, (uint64_t) m->socket_protocol);
+	if (m->has_query_address)
+		p = dt_pb_bytes(p, 4, &m->query_address);
+	if (m->has_response_address)
+		p = dt_pb_bytes(p, 5, &m->response_address);
+	if (m->has_query_port)
+		p = dt_pb_uint(p, 6, m->query_port);
+	if (m->has_response_port)
+		p = dt_pb_uint(p, 7, m->response_port);
+	if (m->has_query_time_sec)
+		p = dt_pb_uint(p, 8, m->query_time_sec);
+	if (m->has_query_time_nsec)
+		p = dt_pb_fixed32(p, 9, m->query_time_nsec);
+	if (m->has_query_message)
+		p = dt_pb_bytes(p, 10, &m->query_message);
+	if (m->has_query_zone)
+		p = dt_pb_bytes(p, 11, &m->query_zone);
+	if (m->has_response_time_sec)
+		p = dt_pb_uint(p, 12, m->response_time_sec);
+	if (m->has_response_time_nsec)
+		p = dt_pb_fixed32(p, 13, m->response_time_nsec);
+	if (m->has_response_message)
+		p = dt_pb_bytes(p, 14, &m->response_message);
+
+	return dt_pb_uint(p, 15, (uint64_t) d->type);
+}
 
-	*buf = sbuf.data;
+static dt_ring_t *
+dt_ring_create(size_t size)
+{
+	dt_ring_t *r;
+	log_assert((size & (size - 1)) == 0);
+	r = (dt_ring_t *) calloc(1, sizeof(*r));
+	if (!r) return NULL;
+	r->slots = (dt_frame_t **) calloc(size, sizeof(dt_frame_t *));
+	if (!r->slots) {
+		free(r);
+		return NULL;
+	}
+	r->mask = size - 1;
+	return r;
+}
+
+/* Called by the producer only. Returns 0 if the queue is full. */
+static int
+dt_ring_push(dt_ring_t *r, dt_frame_t *frame)
+{
+	size_t head = r->head;
+	if (head - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE) > r->mask)
+		return 0;
+	r->slots[head & r->mask] = frame;
+	__atomic_store_n(&r->head, head + 1, __ATOMIC_RELEASE);
 	return 1;
 }
 
+/* Called by the consumer only. Returns NULL if the queue is empty. */
+static dt_frame_t *
+dt_ring_pop(dt_ring_t *r)
+{
+	dt_frame_t *frame;
+	size_t tail = r->tail;
+	if (tail == __atomic_load_n(&r->head, __ATOMIC_ACQUIRE))
+		return NULL;
+	frame = r->slots[tail & r->mask];
+	__atomic_store_n(&r->tail, tail + 1, __ATOMIC_RELEASE);
+	return frame;
+}
+
+/* Number of frames on the queue, as seen from either side. */
+static size_t
+dt_ring_count(dt_ring_t *r)
+{
+	/* the tail is loaded first, the head can only have moved on */
+	size_t tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+	return __atomic_load_n(&r->head, __ATOMIC_ACQUIRE) - tail;
+}
+
 static void
-dt_send(const dt_env_t *env, void *buf, size_t len_buf)
+dt_ring_delete(dt_ring_t *r)
 {
-	verbose(VERB_OPS, "dnstap: %s (unbound@%s)", env->identity, env->version);
+	if (!r) return;
+	free(r->slots);
+	free(r);
+}
 
-	dt_message_t *event = dt_message_alloc(len_buf);
-	event->length = len_buf;
-	event->buffer = buf;
-	verbose(VERB_OPS, "dnstap: queueing event (length %d)", event->length);
+static void
+dt_slab_delete(dt_slab_t *slab)
+{
+	if (!slab) return;
+	dt_ring_delete(slab->queue);
+	dt_ring_delete(slab->free);
+	free(slab->frames);
+	free(slab);
+}
 
-	pipe_push(env->so_producer, &event, 1);
-	verbose(VERB_OPS, "dnstap: queued event");
+static dt_slab_t *
+dt_slab_create(size_t num)
+{
+	size_t i;
+	dt_slab_t *slab = (dt_slab_t *) calloc(1, sizeof(*slab));
+	if (!slab) return NULL;
+	slab->queue = dt_ring_create(num);
+	slab->free = dt_ring_create(num);
+	slab->frames = (dt_frame_t *) malloc(num * sizeof(dt_frame_t));
+	if (!slab->queue || !slab->free || !slab->frames) {
+		dt_slab_delete(slab);
+		return NULL;
+	}
+	for (i = 0; i < num; i++)
+		(void) dt_ring_push(slab->free, &slab->frames[i]);
+	return slab;
+}
+
+static void
+dt_send(const dt_env_t *env, const dt_msg_t *dm)
+{
+	dt_slab_t *slab = env->slab;
+	dt_frame_t *frame;
+	size_t len, msz;
+	uint8_t *end;
+
+	log_assert(slab != NULL);
+	// Above the high watermark the policy decides; drop-oldest is left
+	// to the dt_worker, that owns the other end of the queue.
+	if (DNSTAP_RING_SIZE - dt_ring_count(slab->free) >= env->high_watermark) {
+		if (env->drop_policy == dt_drop_newest ||
+			(env->drop_policy == dt_drop_sample &&
+			++slab->sampled % env->sample_rate != 0)) {
+			slab->dropped++;
+			return;
+		}
+	}
+	len = dt_msg_size(dm, &msz);
+	if (len + 4 > DNSTAP_FRAME_SIZE || !(frame = dt_ring_pop(slab->free))) {
+		/* too large, or the dt_worker is not keeping up; do not
+		 * block the worker */
+		slab->dropped++;
+		return;
+	}
+
+	sldns_write_uint32(frame->data, (uint32_t) len);
+	end = dt_msg_encode(dm, msz, frame->data + 4);
+	frame->len = (size_t) (end - frame->data);
+	log_assert(frame->len == len + 4);
+
+	/* cannot fail, the queue has room for all frames */
+	(void) dt_ring_push(slab->queue, frame);
+	slab->queued++;
 }
 
 static void
@@ -97,8 +350,6 @@ dt_msg_init(const dt_env_t *env,
 	Dnstap__Message__Type mtype)
 {
 	memset(dm, 0, sizeof(*dm));
-	dm->d.base.descriptor = &dnstap__dnstap__descriptor;
-	dm->m.base.descriptor = &dnstap__message__descriptor;
 	dm->d.type = DNSTAP__DNSTAP__TYPE__MESSAGE;
 	dm->d.message = &dm->m;
 	dm->m.type = mtype;
@@ -115,94 +366,226 @@ dt_msg_init(const dt_env_t *env,
 }
 
 dt_env_t *
-dt_create(uint16_t port, uint8_t num_workers)
+dt_create(struct config_file *cfg, unsigned int num_workers)
 {
-	log_assert(port > 0);
+	unsigned int i;
 	log_assert(num_workers > 0);
 
-	dt_env_t *env = (dt_env_t *) malloc(sizeof(dt_env_t));
+	dt_env_t *env = (dt_env_t *) calloc(1, sizeof(dt_env_t));
 	if (!env) return NULL;
 
 	// Flags. Initial valuse are set here, and each is set again, only once,
 	// from another function, possibly in another thread; otherwise,
 	// they're only ever read.
-	env->so_connected = malloc(sizeof(uint8_t));
-	env->dt_stopping = malloc(sizeof(uint8_t));
+	env->dt_stopping = calloc(1, sizeof(uint8_t));
+	env->reconnects = calloc(1, sizeof(size_t));
+	env->slabs = (dt_slab_t **) calloc(num_workers, sizeof(dt_slab_t *));
+	if (!env->dt_stopping || !env->reconnects || !env->slabs) {
+		free(env->dt_stopping);
+		free(env->reconnects);
+		free(env->slabs);
+		free(env);
+		return NULL;
+	}
 
-	*(env->so_connected) = 0;
-	*(env->dt_stopping) = 0;
+	if (strcmp(cfg->dnstap_drop_policy, "drop-oldest") == 0)
+		env->drop_policy = dt_drop_oldest;
+	else if (strcmp(cfg->dnstap_drop_policy, "sample") == 0)
+		env->drop_policy = dt_drop_sample;
+	else	env->drop_policy = dt_drop_newest;
+	env->high_watermark = DNSTAP_RING_SIZE *
+		(size_t) cfg->dnstap_high_watermark / 100;
+	env->sample_rate = cfg->dnstap_sample_rate > 0 ?
+		(unsigned int) cfg->dnstap_sample_rate : 1;
+
+	// Frames and queues per worker, so that no worker ever waits for
+	// another, and no event needs a malloc.
+	env->num_slabs = num_workers;
+	for (i = 0; i < num_workers; i++) {
+		if (!(env->slabs[i] = dt_slab_create(DNSTAP_RING_SIZE))) {
+			while (i > 0)
+				dt_slab_delete(env->slabs[--i]);
+			free(env->dt_stopping);
+			free(env->reconnects);
+			free(env->slabs);
+			free(env);
+			return NULL;
+		}
+	}
 
-	env->so_pipe = pipe_new(sizeof(void *), 0);
+	if (!(env->io = dt_io_create(cfg))) {
+		for (i = 0; i < num_workers; i++)
+			dt_slab_delete(env->slabs[i]);
+		free(env->dt_stopping);
+		free(env->reconnects);
+		free(env->slabs);
+		free(env);
+		return NULL;
+	}
 
-	// These are used in the dt_worker therad. Unbound workers
-	// create their own producers
-	env->so_consumer = pipe_consumer_new(env->so_pipe);
-	env->so_producer = pipe_producer_new(env->so_pipe);
 	pthread_create(&env->dt_worker, NULL, __dt_worker, env);
 
 	return env;
 }
 
-void *
-__dt_worker(void *arg) {
-	verbose(VERB_OPS, "dnstap: starting dt_worker thread");
-
-	dt_env_t *env = (dt_env_t *) arg;
-	struct sockaddr_in so_service;
-
-	so_service.sin_family = AF_INET;
-	so_service.sin_port = htons(5354);
-	so_service.sin_addr.s_addr = inet_addr("127.0.0.1");
-	memset(so_service.sin_zero, 0, sizeof so_service.sin_zero);
-
-	if(!__dt_so_connect(env, so_service)) return NULL;
-
-	// Pop events off of the queue
-	dt_message_t * event;
-
-	while(pipe_pop(env->so_consumer, &event, 1)) {
-		if(send(env->so_socket, event, dt_message_size(event), 0) < 0) {
-			verbose(VERB_OPS, "dnstap: error sending message: %s. Trying to reconnect", strerror(errno));
-
-			// Requeue the event for later
-			pipe_push(env->so_producer, &event, 1);
+/* Hand n frames of the batch back to their workers, counting them as
+ * sent or as discarded. */
+static void
+__dt_worker_release(dt_env_t *env, dt_frame_t **batch, dt_slab_t **owner,
+	int n, int sent)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		if (sent)
+			__atomic_store_n(&owner[i]->sent, owner[i]->sent + 1,
+				__ATOMIC_RELAXED);
+		else	__atomic_store_n(&owner[i]->discarded,
+				owner[i]->discarded + 1, __ATOMIC_RELAXED);
+		(void) dt_ring_push(owner[i]->free, batch[i]);
+	}
+	dt_io_clear(env->io);
+}
 
-			// And try to reconnect
-			close(env->so_socket);
-			if(!__dt_so_connect(env, so_service)) return NULL;
-		} else {
-			verbose(VERB_OPS, "dnstap: sent event to dt_service");
-			dt_message_free(event);
-		}
+/* Discard the oldest queued frames of a worker while it is above the high
+ * watermark, so that it has free frames for new events. */
+static void
+__dt_worker_trim(dt_env_t *env, dt_slab_t *slab)
+{
+	size_t n = dt_ring_count(slab->queue), d = 0;
+	dt_frame_t *frame;
+
+	for (; n > env->high_watermark; n--) {
+		if (!(frame = dt_ring_pop(slab->queue)))
+			break;
+		(void) dt_ring_push(slab->free, frame);
+		d++;
 	}
+	if (d)
+		__atomic_store_n(&slab->discarded, slab->discarded + d,
+			__ATOMIC_RELAXED);
+}
 
-	verbose(VERB_OPS, "dnstap: stopping dt_worker thread");
-	close(env->so_socket);
-	pipe_consumer_free(env->so_consumer);
+/* Try to open the output if the backoff time has passed. On failure the
+ * wait before the next try is doubled, up to DNSTAP_BACKOFF_MAX_MSEC. */
+static void
+__dt_worker_reconnect(dt_env_t *env, struct timeval *now,
+	struct timeval *retry, long *backoff, int *connected)
+{
+	if (now->tv_sec < retry->tv_sec || (now->tv_sec == retry->tv_sec &&
+		now->tv_usec < retry->tv_usec))
+		return;
+	if (dt_io_open(env->io)) {
+		if (*connected)
+			__atomic_store_n(env->reconnects, *env->reconnects + 1,
+				__ATOMIC_RELAXED);
+		*connected = 1;
+		*backoff = 0;
+		return;
+	}
+	*backoff = *backoff ? *backoff * 2 : DNSTAP_BACKOFF_MIN_MSEC;
+	if (*backoff > DNSTAP_BACKOFF_MAX_MSEC)
+		*backoff = DNSTAP_BACKOFF_MAX_MSEC;
+	verbose(VERB_OPS, "dnstap: next connection attempt in %ld msec",
+		*backoff);
+	retry->tv_sec = now->tv_sec + *backoff / 1000;
+	retry->tv_usec = now->tv_usec + (*backoff % 1000) * 1000;
+	if (retry->tv_usec >= 1000000) {
+		retry->tv_sec++;
+		retry->tv_usec -= 1000000;
+	}
 }
 
-uint8_t
-__dt_so_connect(dt_env_t *env, struct sockaddr_in so_service) {
-	while(1) {
-		if(*(env->dt_stopping)) return 0;
+void *
+__dt_worker(void *arg) {
+	verbose(VERB_OPS, "dnstap: starting dt_worker thread");
 
-		verbose(VERB_OPS, "dnstap: trying to connect to %s:%d", "127.0.0.1", 5354);
-		if((env->so_socket = socket(PF_INET, SOCK_STREAM, 0)) < 0) {
-			verbose(VERB_OPS, "dnstap: error creating socket: %s", strerror(errno));
-			return 0;
+	dt_env_t *env = (dt_env_t *) arg;
+	struct dt_io *io = env->io;
+	dt_frame_t *batch[DT_IO_MAX_IOV];
+	dt_slab_t *owner[DT_IO_MAX_IOV];
+	dt_slab_t *slab;
+	dt_frame_t *frame;
+	struct timeval now, retry;
+	unsigned int i, n, idle = 0;
+	size_t taken;
+	long wait, backoff = 0;
+	int num, stopping, connected = 0;
+
+	memset(&retry, 0, sizeof(retry));
+
+	// Take frames off the worker queues in turn, a batch from each, so
+	// that one busy worker cannot starve the others. Frames are collected
+	// until the Frame Streams batch is large or old enough and then
+	// written together; then they go back on the free list of their
+	// worker. While the output is down the queues are not drained, and
+	// the drop policy decides which events are lost.
+	while(1) {
+		stopping = __atomic_load_n(env->dt_stopping, __ATOMIC_ACQUIRE);
+		(void) gettimeofday(&now, NULL);
+		if(env->drop_policy == dt_drop_oldest) {
+			for(i = 0; i < env->num_slabs; i++)
+				__dt_worker_trim(env, env->slabs[i]);
+		}
+		if(io->fd == -1) {
+			if(stopping)
+				break;
+			__dt_worker_reconnect(env, &now, &retry, &backoff,
+				&connected);
+			if(io->fd == -1) {
+				usleep(DNSTAP_IDLE_MAX_USEC);
+				continue;
+			}
 		}
 
-		if(connect(env->so_socket, (struct sockaddr *) &so_service, sizeof so_service) > -1) break;
-		verbose(VERB_OPS, "dnstap: error connecting to socket: %s", strerror(errno));
-
-		// Try again in 5 seconds
-		close(env->so_socket);
-		sleep(5);
+		taken = 0;
+		for(i = 0; i < env->num_slabs; i++) {
+			slab = env->slabs[i];
+			for(n = 0; n < DNSTAP_RING_BATCH; n++) {
+				if(io->num_iov >= DT_IO_MAX_IOV)
+					break;
+				if(!(frame = dt_ring_pop(slab->queue)))
+					break;
+				batch[io->num_iov] = frame;
+				owner[io->num_iov] = slab;
+				(void) dt_io_add(io, frame->data, frame->len);
+				taken++;
+			}
+		}
+		// Only stop once the queues have been drained.
+		if(taken)
+			stopping = 0;
+		if(stopping || dt_io_flush_due(io, &now)) {
+			num = io->num_iov;
+			if(!dt_io_flush(io)) {
+				// Keep the batch for the new connection, and
+				// try that right away.
+				retry = now;
+				continue;
+			}
+			__dt_worker_release(env, batch, owner, num, 1);
+		}
+		if(stopping)
+			break;
+		if(taken) {
+			idle = 0;
+			continue;
+		}
+		// Nothing queued; back off, without taking a lock that the
+		// workers would have to share, but not past the flush time.
+		idle = idle ? idle * 2 : 1;
+		if(idle > DNSTAP_IDLE_MAX_USEC)
+			idle = DNSTAP_IDLE_MAX_USEC;
+		wait = dt_io_flush_wait(io, &now);
+		if(wait > 0 && wait < (long) idle)
+			idle = (unsigned int) wait;
+		usleep(idle);
 	}
 
-	*(env->so_connected) = 1;
-	verbose(VERB_OPS, "dnstap: connected to %s:%d", "127.0.0.1", 5354);
-	return 1;
+	verbose(VERB_OPS, "dnstap: stopping dt_worker thread");
+	__dt_worker_release(env, batch, owner, io->num_iov, 0);
+	dt_io_close(io);
+	return NULL;
 }
 
 void
@@ -244,27 +627,79 @@ dt_apply_cfg(dt_env_t *env, struct config_file *cfg)
 }
 
 int
-dt_init(dt_env_t *env)
+dt_init(dt_env_t *env, unsigned int num)
 {
-	env->so_producer = pipe_producer_new(env->so_pipe);
+	if (num >= env->num_slabs)
+		return 0;
+	env->slab = env->slabs[num];
 	return 1;
 }
 
 void
 dt_delete(dt_env_t *env)
 {
+	unsigned int i;
+	size_t dropped = 0;
 	if (!env) return;
 	verbose(VERB_OPS, "cleanup dnstap environment");
 
+	// Let the dt_worker drain the queues of the (stopped) workers
+	__atomic_store_n(env->dt_stopping, 1, __ATOMIC_RELEASE);
+	pthread_join(env->dt_worker, NULL);
+	dt_io_delete(env->io);
+
+	for (i = 0; i < env->num_slabs; i++) {
+		dropped += env->slabs[i]->dropped +
+			env->slabs[i]->discarded +
+			dt_ring_count(env->slabs[i]->queue);
+		dt_slab_delete(env->slabs[i]);
+	}
+	if (dropped)
+		verbose(VERB_OPS, "dnstap: %u events dropped",
+			(unsigned) dropped);
+
+	free(env->slabs);
 	free(env->identity);
 	free(env->version);
+	free(env->dt_stopping);
+	free(env->reconnects);
+	free(env);
+}
 
-	// Wait for all unbound_workers' producers to drain
-	*(env->dt_stopping) = 1;
+void
+dt_stats_get(dt_env_t *env, size_t *queued, size_t *sent, size_t *dropped,
+	size_t *reconnects)
+{
+	dt_slab_t *slab = env->slab;
+
+	*queued = slab->queued;
+	*sent = __atomic_load_n(&slab->sent, __ATOMIC_RELAXED) -
+		slab->sent_base;
+	*dropped = slab->dropped +
+		__atomic_load_n(&slab->discarded, __ATOMIC_RELAXED) -
+		slab->discarded_base;
+	// The connection is shared, report it with the first worker only,
+	// so that the totals add up.
+	if (slab == env->slabs[0])
+		*reconnects = __atomic_load_n(env->reconnects,
+			__ATOMIC_RELAXED) - slab->reconnects_base;
+	else	*reconnects = 0;
+}
 
-	pipe_producer_free(env->so_producer);
-	pthread_join(env->dt_worker, NULL);
-	free(env);
+void
+dt_stats_clear(dt_env_t *env)
+{
+	dt_slab_t *slab = env->slab;
+
+	// The dt_worker owns the sent and discarded counters, so these are
+	// not reset but remembered.
+	slab->queued = 0;
+	slab->dropped = 0;
+	slab->sent_base = __atomic_load_n(&slab->sent, __ATOMIC_RELAXED);
+	slab->discarded_base = __atomic_load_n(&slab->discarded,
+		__ATOMIC_RELAXED);
+	slab->reconnects_base = __atomic_load_n(env->reconnects,
+		__ATOMIC_RELAXED);
 }
 
 static void
@@ -369,8 +804,7 @@ dt_msg_send_client_query(dt_env_t *env,
 		&dm.m.query_address, &dm.m.has_query_address,
 		&dm.m.query_port, &dm.m.has_query_port);
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	dt_send(env, &dm);
 }
 
 void
@@ -401,8 +835,7 @@ dt_msg_send_client_response(dt_env_t *env,
 			&dm.m.query_address, &dm.m.has_query_address,
 			&dm.m.query_port, &dm.m.has_query_port);
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	dt_send(env, &dm);
 }
 
 void
@@ -449,8 +882,7 @@ dt_msg_send_outside_query(dt_env_t *env,
 			&dm.m.response_address, &dm.m.has_response_address,
 			&dm.m.response_port, &dm.m.has_response_port);
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	dt_send(env, &dm);
 }
 
 void
@@ -505,8 +937,7 @@ dt_msg_send_outside_response(dt_env_t *env,
 			&dm.m.response_address, &dm.m.has_response_address,
 			&dm.m.response_port, &dm.m.has_response_port);
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	dt_send(env, &dm);
 }
 
 #endif /* USE_DNSTAP */
@@ -36,31 +36,105 @@
 #define UNBOUND_DNSTAP_H
 
 #include "dnstap/dnstap_config.h"
-#include "dnstap/dnstap.pb-c.h"
-#include "dnstap/pipe.h"
-#include <pthread.h>
 
 #ifdef USE_DNSTAP
 
+#include "dnstap/dnstap.pb-c.h"
+#include <pthread.h>
+
 struct config_file;
 struct sldns_buffer;
-#define DNSTAP_INITIAL_BUF_SIZE 256
+struct dt_io;
+/** size of a preallocated frame slot: a 4096 byte EDNS answer plus envelope */
+#define DNSTAP_FRAME_SIZE 4608
+/** number of frame slots per worker, must be a power of two */
+#define DNSTAP_RING_SIZE 1024
+/** max events taken from one worker queue before moving to the next */
+#define DNSTAP_RING_BATCH 64
+/** max sleep of the dt_worker thread when all queues are empty, usec */
+#define DNSTAP_IDLE_MAX_USEC 8192
+/** cache line size, keeps producer and consumer indices apart */
+#define DNSTAP_CACHE_LINE 64
+/** first wait before reconnecting to the collector, msec */
+#define DNSTAP_BACKOFF_MIN_MSEC 250
+/** max wait before reconnecting to the collector, msec */
+#define DNSTAP_BACKOFF_MAX_MSEC 32000
+
+/** What to do with events once a worker has many frames in use */
+enum dt_drop_policy {
+	/** drop new events */
+	dt_drop_newest = 0,
+	/** the dt_worker discards the oldest queued events */
+	dt_drop_oldest,
+	/** keep one in sample_rate of the new events */
+	dt_drop_sample
+};
 
 typedef struct dt_msg {
-	void *buf;
-	size_t len_buf;
 	Dnstap__Dnstap d;
 	Dnstap__Message m;
 } dt_msg_t;
 
-typedef struct dt_message {
-	uint16_t length;
-	void *buffer;
-} dt_message_t;
+/**
+ * A dnstap event, encoded in place in a frame slot owned by a worker.
+ * The frame is laid out as a Frame Streams data frame, so it can be
+ * written out as is.
+ */
+typedef struct dt_frame {
+	/** length of data in use, including the length prefix */
+	size_t len;
+	/** big-endian 32 bit payload length, then the encoded Dnstap message */
+	uint8_t data[DNSTAP_FRAME_SIZE];
+} dt_frame_t;
 
-#define dt_message_size(MSG) sizeof(uint16_t) + MSG->length
-#define dt_message_alloc(LENGTH) malloc(sizeof(uint16_t) + LENGTH)
-#define dt_message_free(MSG) free(MSG->buffer); free(MSG)
+/**
+ * Bounded single-producer, single-consumer queue of dnstap frames. Only one
+ * thread pushes and only one other thread pops, so neither side takes a
+ * lock. The indices only ever increase; a slot is found by masking them
+ * with the (power of two) queue size.
+ */
+typedef struct dt_ring {
+	/** next slot to write, only changed by the producer */
+	size_t head;
+	uint8_t pad_head[DNSTAP_CACHE_LINE - sizeof(size_t)];
+	/** next slot to read, only changed by the consumer */
+	size_t tail;
+	uint8_t pad_tail[DNSTAP_CACHE_LINE - sizeof(size_t)];
+	/** queue size - 1 */
+	size_t mask;
+	/** the queued frames */
+	dt_frame_t **slots;
+} dt_ring_t;
+
+/**
+ * The frames of one worker. A frame is taken from the free list, filled
+ * by the worker and put on the queue; the dt_worker writes it out and
+ * hands it back on the free list. Both lists can hold every frame, so
+ * pushing onto them never fails.
+ */
+typedef struct dt_slab {
+	/** filled frames, worker -> dt_worker */
+	dt_ring_t *queue;
+	/** empty frames, dt_worker -> worker */
+	dt_ring_t *free;
+	/** the preallocated frames */
+	dt_frame_t *frames;
+
+	/** number of events queued; worker */
+	size_t queued;
+	/** number of events dropped by the policy, or because there was no
+	 * free frame or the event is too large; worker */
+	size_t dropped;
+	/** events seen above the high watermark, for sampling; worker */
+	unsigned int sampled;
+	/** sent, discarded and reconnects at the last stats clear; worker */
+	size_t sent_base, discarded_base, reconnects_base;
+	uint8_t pad_stats[DNSTAP_CACHE_LINE];
+	/** number of events written out; dt_worker */
+	size_t sent;
+	/** number of queued events discarded; dt_worker */
+	size_t discarded;
+} dt_slab_t;
 
 typedef struct dt_env {
 	uint16_t len_identity;
@@ -68,13 +142,24 @@ typedef struct dt_env {
 	uint16_t len_version;
 	uint8_t *version;
 
-	pipe_t *so_pipe;
-	pipe_producer_t *so_producer;
-	pipe_consumer_t *so_consumer;
+	/** per-worker frames, drained round-robin by dt_worker */
+	dt_slab_t **slabs;
+	/** number of per-worker slabs */
+	unsigned int num_slabs;
+	/** frames of this worker, set by dt_init, NULL in the master copy */
+	dt_slab_t *slab;
 	pthread_t dt_worker;
+	/** Frame Streams output, only used by the dt_worker thread */
+	struct dt_io *io;
+	/** what happens to events above the high watermark */
+	enum dt_drop_policy drop_policy;
+	/** number of frames of a worker in use, before the policy applies */
+	size_t high_watermark;
+	/** with the sample policy, one in this many events is kept */
+	unsigned int sample_rate;
+	/** number of times the output was reopened; dt_worker */
+	size_t *reconnects;
 
-	int so_socket;
-	uint8_t *so_connected;
 	uint8_t *dt_stopping;
 
 	uint8_t log_resolver_query_messages			: 1;
@@ -88,16 +173,15 @@ typedef struct dt_env {
 /**
  * Create dnstap environment object. Afterwards, call dt_apply_cfg() to fill in
  * the config variables and dt_init() to fill in the per-worker state. Each
- * worker needs a copy of this object but with its own I/O queue (the fq field
- * of the structure) to ensure lock-free access to its own per-worker circular
- * queue.  Duplicate the environment object if more than one worker needs to
- * share access to the dnstap I/O socket.
- * @param socket_path: path to dnstap logging socket, must be non-NULL.
+ * worker needs a copy of this object but with its own frames (the slab
+ * field of the structure) to ensure lock-free access to its own per-worker
+ * circular queues.
+ * @param cfg: config with the dnstap output settings.
  * @param num_workers: number of worker threads, must be > 0.
  * @return dt_env object, NULL on failure.
  */
 dt_env_t *
-dt_create(uint16_t port, uint8_t num_workers);
+dt_create(struct config_file *cfg, unsigned int num_workers);
 
 /**
  * Apply config settings.
@@ -109,28 +193,54 @@ dt_apply_cfg(dt_env_t *env, struct config_file *cfg);
 
 /**
  * Initialize per-worker state in dnstap environment object.
- * @param env: dnstap environment object to initialize, created with dt_create().
+ * @param env: dnstap environment object to initialize, a copy of the object
+ *	created with dt_create().
+ * @param num: number of the worker, selects its frames.
  * @return: true on success, false on failure.
  */
 int
-dt_init(dt_env_t *env);
+dt_init(dt_env_t *env, unsigned int num);
 
 /**
- * Delete dnstap environment object. Closes dnstap I/O socket and deletes all
- * per-worker I/O queues.
+ * Delete dnstap environment object. Stops the dt_worker thread after it has
+ * drained the queues, stops the Frame Streams output and deletes all
+ * per-worker frames.
  */
 void
 dt_delete(dt_env_t *env);
 
 /**
- * Worker for writing DNSTap mesasges to a socket
+ * Get the dnstap counters of a worker, since the last dt_stats_clear().
+ * Called by the worker that owns the frames.
+ * @param env: dnstap environment object of the worker.
+ * @param queued: returns number of events queued.
+ * @param sent: returns number of events written out.
+ * @param dropped: returns number of events lost, by the drop policy or
+ *	because the queue was full.
+ * @param reconnects: returns number of times the output was reopened, for
+ *	the first worker only, 0 for the others.
+ */
+void
+dt_stats_get(dt_env_t *env, size_t *queued, size_t *sent, size_t *dropped,
+	size_t *reconnects);
+
+/**
+ * Clear the dnstap counters of a worker.
+ * @param env: dnstap environment object of the worker.
+ */
+void
+dt_stats_clear(dt_env_t *env);
+
+/**
+ * Worker for writing DNSTap mesasges to the Frame Streams output. Takes
+ * events from the per-worker queues in turn into a batch, and writes the
+ * batch when it is large or old enough. Sleeps a little when the queues
+ * are all empty. When the output is down it retries with exponential
+ * backoff, and meanwhile applies the drop policy.
  */
 void *
 __dt_worker(void *);
 
-uint8_t
-__dt_so_connect(dt_env_t *env, struct sockaddr_in so_service);
-
 /**
  * Create and send a new dnstap "Message" event of type CLIENT_QUERY.
  * @param env: dnstap environment object.
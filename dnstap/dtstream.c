@@ -0,0 +1,440 @@
+/*
+ * dnstap/dtstream.c - Frame Streams output for dnstap
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the Frame Streams writer used by the dnstap thread.
+ */
+#include "dnstap/dnstap_config.h"
+
+#ifdef USE_DNSTAP
+
+#include "config.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/time.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "dnstap/dtstream.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/log.h"
+#include "sldns/sbuffer.h"
+
+/** default port of the TCP collector */
+#define DT_IO_DEFAULT_PORT 5354
+
+struct dt_io*
+dt_io_create(struct config_file* cfg)
+{
+	struct dt_io* io = (struct dt_io*)calloc(1, sizeof(*io));
+	if(!io) {
+		log_err("dnstap: out of memory");
+		return NULL;
+	}
+	io->fd = -1;
+	io->flush_size = cfg->dnstap_flush_size;
+	io->flush_time = cfg->dnstap_flush_time;
+	if(cfg->dnstap_file && cfg->dnstap_file[0]) {
+		io->type = dt_io_file;
+		io->path = strdup(cfg->dnstap_file);
+		io->rotate_size = cfg->dnstap_file_rotate_size;
+	} else if(cfg->dnstap_socket_path && cfg->dnstap_socket_path[0]) {
+		io->type = dt_io_unix;
+		io->path = strdup(cfg->dnstap_socket_path);
+		if(io->path && strlen(io->path) >=
+			sizeof(((struct sockaddr_un*)0)->sun_path)) {
+			log_err("dnstap: socket path too long: %s", io->path);
+			dt_io_delete(io);
+			return NULL;
+		}
+	} else {
+		int r;
+		io->type = dt_io_tcp;
+		io->path = strdup(cfg->dnstap_ip?cfg->dnstap_ip:"");
+		if(!io->path) {
+			log_err("dnstap: out of memory");
+			dt_io_delete(io);
+			return NULL;
+		}
+		if(strchr(io->path, '@'))
+			r = extstrtoaddr(io->path, &io->addr, &io->addrlen);
+		else	r = ipstrtoaddr(io->path, DT_IO_DEFAULT_PORT,
+				&io->addr, &io->addrlen);
+		if(!r) {
+			log_err("dnstap: cannot parse dnstap-ip: %s", io->path);
+			dt_io_delete(io);
+			return NULL;
+		}
+	}
+	if(!io->path) {
+		log_err("dnstap: out of memory");
+		dt_io_delete(io);
+		return NULL;
+	}
+	return io;
+}
+
+void
+dt_io_delete(struct dt_io* io)
+{
+	if(!io)
+		return;
+	if(io->fd != -1)
+		dt_io_close(io);
+	free(io->path);
+	free(io);
+}
+
+/** write all of buf, returns false on failure */
+static int
+dt_io_write_all(int fd, uint8_t* buf, size_t len)
+{
+	while(len > 0) {
+		ssize_t r = write(fd, buf, len);
+		if(r == -1) {
+			if(errno == EINTR)
+				continue;
+			return 0;
+		}
+		buf += r;
+		len -= (size_t)r;
+	}
+	return 1;
+}
+
+/** read len bytes into buf, returns false on failure or end of stream */
+static int
+dt_io_read_all(int fd, uint8_t* buf, size_t len)
+{
+	while(len > 0) {
+		ssize_t r = read(fd, buf, len);
+		if(r == -1) {
+			if(errno == EINTR)
+				continue;
+			return 0;
+		}
+		if(r == 0) {
+			errno = ECONNRESET;
+			return 0;
+		}
+		buf += r;
+		len -= (size_t)r;
+	}
+	return 1;
+}
+
+/** write a control frame, with the content type field if not STOP or
+ * FINISH; returns false on failure */
+static int
+dt_io_send_control(struct dt_io* io, uint32_t type)
+{
+	uint8_t buf[64];
+	size_t ctlen = strlen(DT_IO_CONTENT_TYPE), len = 12;
+	/* escape, length of the control frame, control type */
+	sldns_write_uint32(buf, 0);
+	sldns_write_uint32(buf+8, type);
+	if(type != DT_IO_CONTROL_STOP && type != DT_IO_CONTROL_FINISH) {
+		sldns_write_uint32(buf+12, DT_IO_FIELD_CONTENT_TYPE);
+		sldns_write_uint32(buf+16, (uint32_t)ctlen);
+		memmove(buf+20, DT_IO_CONTENT_TYPE, ctlen);
+		len = 20 + ctlen;
+	}
+	sldns_write_uint32(buf+4, (uint32_t)(len - 8));
+	if(!dt_io_write_all(io->fd, buf, len))
+		return 0;
+	if(io->type == dt_io_file)
+		io->written += len;
+	return 1;
+}
+
+/** read a control frame from the collector, and check that it has the
+ * expected type, and that an ACCEPT lists the dnstap content type */
+static int
+dt_io_recv_control(struct dt_io* io, uint32_t type)
+{
+	uint8_t buf[DT_IO_MAX_CONTROL];
+	uint32_t len, pos, flen;
+	if(!dt_io_read_all(io->fd, buf, 8))
+		return 0;
+	len = sldns_read_uint32(buf+4);
+	if(sldns_read_uint32(buf) != 0 || len < 4 || len > sizeof(buf)) {
+		verbose(VERB_OPS, "dnstap: collector sent a malformed "
+			"control frame");
+		return 0;
+	}
+	if(!dt_io_read_all(io->fd, buf, len))
+		return 0;
+	if(sldns_read_uint32(buf) != type) {
+		verbose(VERB_OPS, "dnstap: collector sent control frame %u, "
+			"expected %u", (unsigned)sldns_read_uint32(buf),
+			(unsigned)type);
+		return 0;
+	}
+	if(type != DT_IO_CONTROL_ACCEPT)
+		return 1;
+	for(pos = 4; pos + 8 <= len; pos += 8 + flen) {
+		flen = sldns_read_uint32(buf+pos+4);
+		if(flen > len - pos - 8)
+			break;
+		if(sldns_read_uint32(buf+pos) == DT_IO_FIELD_CONTENT_TYPE &&
+			flen == strlen(DT_IO_CONTENT_TYPE) &&
+			memcmp(buf+pos+8, DT_IO_CONTENT_TYPE, flen) == 0)
+			return 1;
+	}
+	verbose(VERB_OPS, "dnstap: collector does not accept content type %s",
+		DT_IO_CONTENT_TYPE);
+	return 0;
+}
+
+/** name for a file that is rotated out of the way */
+static void
+dt_io_rotate_name(struct dt_io* io, char* buf, size_t len)
+{
+	snprintf(buf, len, "%s.%lld.%u", io->path, (long long)time(NULL),
+		io->rotations++);
+}
+
+/** move the current file out of the way */
+static void
+dt_io_rotate(struct dt_io* io)
+{
+	char buf[1024];
+	dt_io_rotate_name(io, buf, sizeof(buf));
+	if(rename(io->path, buf) == -1)
+		log_err("dnstap: could not rename %s to %s: %s", io->path,
+			buf, strerror(errno));
+	else	verbose(VERB_OPS, "dnstap: rotated %s to %s", io->path, buf);
+}
+
+/** open the file and write the START frame */
+static int
+dt_io_open_file(struct dt_io* io)
+{
+	struct stat st;
+	/* a Frame Streams file has one START frame, do not append to
+	 * what an earlier run left */
+	if(stat(io->path, &st) == 0 && st.st_size > 0)
+		dt_io_rotate(io);
+	io->fd = open(io->path, O_WRONLY|O_CREAT|O_TRUNC, 0640);
+	if(io->fd == -1) {
+		log_err("dnstap: could not open %s: %s", io->path,
+			strerror(errno));
+		return 0;
+	}
+	io->written = 0;
+	if(!dt_io_send_control(io, DT_IO_CONTROL_START)) {
+		log_err("dnstap: could not write %s: %s", io->path,
+			strerror(errno));
+		close(io->fd);
+		io->fd = -1;
+		return 0;
+	}
+	verbose(VERB_OPS, "dnstap: writing to %s", io->path);
+	return 1;
+}
+
+/** connect to the collector and perform the handshake */
+static int
+dt_io_open_socket(struct dt_io* io)
+{
+	struct sockaddr_un usock;
+	struct sockaddr* addr;
+	socklen_t addrlen;
+	struct timeval tv;
+
+	if(io->type == dt_io_unix) {
+		memset(&usock, 0, sizeof(usock));
+		usock.sun_family = AF_UNIX;
+		(void)strlcpy(usock.sun_path, io->path, sizeof(usock.sun_path));
+		addr = (struct sockaddr*)&usock;
+		addrlen = (socklen_t)sizeof(usock);
+	} else {
+		addr = (struct sockaddr*)&io->addr;
+		addrlen = io->addrlen;
+	}
+	verbose(VERB_OPS, "dnstap: trying to connect to %s", io->path);
+	if((io->fd = socket(addr->sa_family, SOCK_STREAM, 0)) == -1) {
+		verbose(VERB_OPS, "dnstap: error creating socket: %s",
+			strerror(errno));
+		return 0;
+	}
+	/* a stalled collector must not block the dnstap thread forever */
+	tv.tv_sec = DT_IO_TIMEOUT;
+	tv.tv_usec = 0;
+	if(setsockopt(io->fd, SOL_SOCKET, SO_SNDTIMEO, (void*)&tv,
+		(socklen_t)sizeof(tv)) == -1 ||
+		setsockopt(io->fd, SOL_SOCKET, SO_RCVTIMEO, (void*)&tv,
+		(socklen_t)sizeof(tv)) == -1)
+		verbose(VERB_OPS, "dnstap: could not set socket timeout: %s",
+			strerror(errno));
+	if(connect(io->fd, addr, addrlen) == -1) {
+		verbose(VERB_OPS, "dnstap: error connecting to %s: %s",
+			io->path, strerror(errno));
+		close(io->fd);
+		io->fd = -1;
+		return 0;
+	}
+	if(!dt_io_send_control(io, DT_IO_CONTROL_READY) ||
+		!dt_io_recv_control(io, DT_IO_CONTROL_ACCEPT) ||
+		!dt_io_send_control(io, DT_IO_CONTROL_START)) {
+		verbose(VERB_OPS, "dnstap: handshake with %s failed: %s",
+			io->path, strerror(errno));
+		close(io->fd);
+		io->fd = -1;
+		return 0;
+	}
+	verbose(VERB_OPS, "dnstap: connected to %s", io->path);
+	return 1;
+}
+
+int
+dt_io_open(struct dt_io* io)
+{
+	log_assert(io->fd == -1);
+	if(io->type == dt_io_file)
+		return dt_io_open_file(io);
+	return dt_io_open_socket(io);
+}
+
+void
+dt_io_close(struct dt_io* io)
+{
+	if(io->fd == -1)
+		return;
+	if(dt_io_send_control(io, DT_IO_CONTROL_STOP) &&
+		io->type != dt_io_file)
+		(void)dt_io_recv_control(io, DT_IO_CONTROL_FINISH);
+	close(io->fd);
+	io->fd = -1;
+}
+
+int
+dt_io_add(struct dt_io* io, void* data, size_t len)
+{
+	if(io->num_iov >= DT_IO_MAX_IOV)
+		return 0;
+	if(io->num_iov == 0)
+		(void)gettimeofday(&io->first, NULL);
+	io->iov[io->num_iov].iov_base = data;
+	io->iov[io->num_iov].iov_len = len;
+	io->num_iov++;
+	io->num_bytes += len;
+	return 1;
+}
+
+long
+dt_io_flush_wait(struct dt_io* io, struct timeval* now)
+{
+	long waited;
+	if(io->num_iov == 0)
+		return 0;
+	waited = (long)(now->tv_sec - io->first.tv_sec)*1000000 +
+		(long)(now->tv_usec - io->first.tv_usec);
+	if(waited < 0 || waited >= (long)io->flush_time*1000)
+		return 0;
+	return (long)io->flush_time*1000 - waited;
+}
+
+int
+dt_io_flush_due(struct dt_io* io, struct timeval* now)
+{
+	if(io->num_iov == 0)
+		return 0;
+	if(io->num_iov >= DT_IO_MAX_IOV || io->num_bytes >= io->flush_size)
+		return 1;
+	return dt_io_flush_wait(io, now) == 0;
+}
+
+void
+dt_io_clear(struct dt_io* io)
+{
+	io->num_iov = 0;
+	io->num_bytes = 0;
+}
+
+int
+dt_io_flush(struct dt_io* io)
+{
+	/* writev may write part of the batch, and then the vector is
+	 * advanced; the batch itself stays intact in case of failure */
+	struct iovec iov[DT_IO_MAX_IOV];
+	struct iovec* v = iov;
+	int n = io->num_iov;
+	ssize_t r;
+	if(n == 0)
+		return 1;
+	if(io->fd == -1)
+		return 0;
+	memmove(iov, io->iov, sizeof(struct iovec)*(size_t)n);
+	while(n > 0) {
+		r = writev(io->fd, v, n);
+		if(r == -1) {
+			if(errno == EINTR)
+				continue;
+			verbose(VERB_OPS, "dnstap: error writing to %s: %s",
+				io->path, strerror(errno));
+			close(io->fd);
+			io->fd = -1;
+			return 0;
+		}
+		while(n > 0 && (size_t)r >= v->iov_len) {
+			r -= (ssize_t)v->iov_len;
+			v++;
+			n--;
+		}
+		if(n > 0) {
+			v->iov_base = (uint8_t*)v->iov_base + r;
+			v->iov_len -= (size_t)r;
+		}
+	}
+	if(io->type == dt_io_file) {
+		io->written += io->num_bytes;
+		if(io->rotate_size && io->written >= io->rotate_size) {
+			dt_io_clear(io);
+			dt_io_close(io);
+			dt_io_rotate(io);
+			/* a failure here is noticed at the next flush */
+			(void)dt_io_open(io);
+			return 1;
+		}
+	}
+	dt_io_clear(io);
+	return 1;
+}
+
+#endif /* USE_DNSTAP */
@@ -0,0 +1,191 @@
+/*
+ * dnstap/dtstream.h - Frame Streams output for dnstap
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the Frame Streams writer used by the dnstap thread.
+ * It performs the control frame handshake with the collector, collects
+ * data frames into a batch and writes the batch with one writev call.
+ * The output is a unix socket, a TCP connection or a local file that is
+ * rotated when it grows too large.
+ */
+
+#ifndef DNSTAP_DTSTREAM_H
+#define DNSTAP_DTSTREAM_H
+#include <sys/uio.h>
+struct config_file;
+
+/** Frame Streams content type of the dnstap data frames */
+#define DT_IO_CONTENT_TYPE "protobuf:dnstap.Dnstap"
+/** max number of data frames written with one writev */
+#define DT_IO_MAX_IOV 256
+/** max length of a control frame that is accepted from the collector */
+#define DT_IO_MAX_CONTROL 512
+/** send and receive timeout on the collector connection, in seconds */
+#define DT_IO_TIMEOUT 5
+
+/** Frame Streams control frame types */
+#define DT_IO_CONTROL_ACCEPT	0x01
+#define DT_IO_CONTROL_START	0x02
+#define DT_IO_CONTROL_STOP	0x03
+#define DT_IO_CONTROL_READY	0x04
+#define DT_IO_CONTROL_FINISH	0x05
+/** Frame Streams control field type for the content type */
+#define DT_IO_FIELD_CONTENT_TYPE 0x01
+
+/** the kind of output */
+enum dt_io_type {
+	/** bidirectional stream over a unix socket */
+	dt_io_unix,
+	/** bidirectional stream over a TCP connection */
+	dt_io_tcp,
+	/** unidirectional stream into a local file */
+	dt_io_file
+};
+
+/**
+ * Frame Streams output. Used by the dnstap thread only, so there is no
+ * locking.
+ */
+struct dt_io {
+	/** kind of output */
+	enum dt_io_type type;
+	/** unix socket path or file name, malloced */
+	char* path;
+	/** address of the TCP collector */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** the open socket or file, -1 if closed */
+	int fd;
+
+	/** file is rotated when it has grown to this size, 0 to never */
+	size_t rotate_size;
+	/** bytes written to the current file */
+	size_t written;
+	/** number of rotations, keeps the rotated file names apart */
+	unsigned rotations;
+
+	/** write the batch once it holds this many bytes */
+	size_t flush_size;
+	/** write the batch once its oldest frame is this old, in msec */
+	int flush_time;
+
+	/** the batch of data frames that is not written yet */
+	struct iovec iov[DT_IO_MAX_IOV];
+	/** number of frames in the batch */
+	int num_iov;
+	/** number of bytes in the batch */
+	size_t num_bytes;
+	/** time the first frame was added to the batch */
+	struct timeval first;
+};
+
+/**
+ * Create Frame Streams output from the config. The file is used if
+ * dnstap-file is set, else the unix socket if dnstap-socket-path is set,
+ * else the TCP collector at dnstap-ip. Nothing is opened yet.
+ * @param cfg: config with the dnstap settings.
+ * @return new dt_io, NULL on failure (logged).
+ */
+struct dt_io* dt_io_create(struct config_file* cfg);
+
+/**
+ * Delete Frame Streams output, closes it if open. The batch is not
+ * written.
+ * @param io: the output.
+ */
+void dt_io_delete(struct dt_io* io);
+
+/**
+ * Open the output and start the stream. For a socket this connects and
+ * performs the READY, ACCEPT, START handshake; for a file this writes the
+ * START frame, after moving an existing file out of the way.
+ * @param io: the output, must be closed.
+ * @return false on failure (logged), the output is closed then.
+ */
+int dt_io_open(struct dt_io* io);
+
+/**
+ * Stop the stream and close the output. Writes the STOP frame, and for
+ * a socket waits briefly for the FINISH frame of the collector.
+ * @param io: the output.
+ */
+void dt_io_close(struct dt_io* io);
+
+/**
+ * Add a data frame to the batch. The data is not copied and has to stay
+ * valid until the batch has been written.
+ * @param io: the output.
+ * @param data: the frame, including its 4 byte length.
+ * @param len: length of data.
+ * @return false if the batch is full and has to be written first.
+ */
+int dt_io_add(struct dt_io* io, void* data, size_t len);
+
+/**
+ * See if the batch has to be written, because it holds enough bytes or
+ * because it is too old.
+ * @param io: the output.
+ * @param now: current time.
+ * @return true if dt_io_flush should be called.
+ */
+int dt_io_flush_due(struct dt_io* io, struct timeval* now);
+
+/**
+ * Time until the batch has to be written.
+ * @param io: the output.
+ * @param now: current time.
+ * @return usec until then, 0 if due now or the batch is empty.
+ */
+long dt_io_flush_wait(struct dt_io* io, struct timeval* now);
+
+/**
+ * Write the batch. On success the batch is empty, and the file is rotated
+ * if it has grown too large.
+ * @param io: the output, must be open.
+ * @return false on a write failure (logged); the output is closed then, but
+ *	the batch is kept, so that it can be written after dt_io_open.
+ */
+int dt_io_flush(struct dt_io* io);
+
+/**
+ * Empty the batch without writing it.
+ * @param io: the output.
+ */
+void dt_io_clear(struct dt_io* io);
+
+#endif /* DNSTAP_DTSTREAM_H */
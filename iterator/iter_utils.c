@@ -435,6 +435,37 @@ iter_server_selection(struct iter_env* iter_env,
 	return a;
 }
 
+struct delegpt_addr*
+iter_server_hedge_selection(struct iter_env* iter_env,
+	struct module_env* env, struct delegpt* dp, uint8_t* name,
+	size_t namelen, uint16_t qtype, struct delegpt_addr* sent,
+	struct sock_list* blacklist)
+{
+	int low_rtt = 0;
+	struct delegpt_addr* a, *prev = NULL, *best = NULL, *bestprev = NULL;
+	if(!iter_fill_rtt(iter_env, env, name, namelen, qtype, *env->now, dp,
+		&low_rtt, blacklist))
+		return NULL;
+	for(a = dp->result_list; a; prev = a, a = a->next_result) {
+		if(a == sent || a->sel_rtt == -1 ||
+			a->sel_rtt >= USEFUL_SERVER_TOP_TIMEOUT)
+			continue;
+		if(!best || a->sel_rtt < best->sel_rtt) {
+			best = a;
+			bestprev = prev;
+		}
+	}
+	if(!best)
+		return NULL;
+	if(++best->attempts < OUTBOUND_MSG_RETRY)
+		return best;
+	/* remove it from the delegation point result list */
+	if(bestprev)
+		bestprev->next_result = best->next_result;
+	else	dp->result_list = best->next_result;
+	return best;
+}
+
 struct dns_msg* 
 dns_alloc_msg(sldns_buffer* pkt, struct msg_parse* msg, 
 	struct regional* region)
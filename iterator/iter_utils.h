@@ -95,6 +95,28 @@ struct delegpt_addr* iter_server_selection(struct iter_env* iter_env,
 	size_t namelen, uint16_t qtype, int* dnssec_lame,
 	int* chase_to_rd, int open_target, struct sock_list* blacklist);
 
+/**
+ * Select the target for a hedge query, sent in parallel when the query
+ * to another target of the delegation point is slow. It picks the
+ * target with the best rtt, and skips the target that is slow, and the
+ * lame, dispreferred and unresponsive targets.
+ *
+ * @param iter_env: iterator module global state, with ip6 enabled and 
+ *	do-not-query-addresses.
+ * @param env: environment with infra cache (lameness, rtt info).
+ * @param dp: delegation point with result list.
+ * @param name: zone name (for lameness check).
+ * @param namelen: length of name.
+ * @param qtype: query type that we want to send.
+ * @param sent: the target that the slow query was sent to.
+ * @param blacklist: the IP blacklist to use.
+ * @return target or NULL if no target.
+ */
+struct delegpt_addr* iter_server_hedge_selection(struct iter_env* iter_env,
+	struct module_env* env, struct delegpt* dp, uint8_t* name,
+	size_t namelen, uint16_t qtype, struct delegpt_addr* sent,
+	struct sock_list* blacklist);
+
 /**
  * Allocate dns_msg from parsed msg, in regional.
  * @param pkt: packet.
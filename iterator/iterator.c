@@ -135,6 +135,8 @@ iter_new(struct module_qstate* qstate, int id)
 	iq->query_restart_count = 0;
 	iq->referral_count = 0;
 	iq->sent_count = 0;
+	iq->sent_target = NULL;
+	iq->hedged = 0;
 	iq->ratelimit_ok = 0;
 	iq->target_count = NULL;
 	iq->wait_priming_stub = 0;
@@ -2003,6 +2005,12 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	outbound_list_insert(&iq->outlist, outq);
 	iq->num_current_queries++;
 	iq->sent_count++;
+	iq->sent_target = target;
+	/* if there is another target, it can get the query too when
+	 * this one is slow */
+	if(qstate->env->cfg->hedge_query_budget > 0 && !iq->caps_fallback &&
+		(iq->dp->result_list != target || target->next_result))
+		outbound_entry_hedge(outq);
 	qstate->ext_state[id] = module_wait_reply;
 
 	return 0;
@@ -2905,6 +2913,90 @@ process_request(struct module_qstate* qstate, struct iter_qstate* iq,
 	iter_handle(qstate, iq, ie, id);
 }
 
+/**
+ * The query to the target is slow, send it to the next best target as
+ * well. The reply that arrives first is used, and the other query is
+ * stopped then.
+ *
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @param id: module id.
+ */
+static void
+process_slow(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, int id)
+{
+	struct delegpt_addr* target;
+	struct outbound_entry* outq;
+
+	/* the slow query continues, wait for it */
+	qstate->ext_state[id] = module_wait_reply;
+	if(iq->num_current_queries != 1 || iq->caps_fallback || !iq->dp ||
+		iq->sent_count >= MAX_SENT_COUNT)
+		return;
+	target = iter_server_hedge_selection(ie, qstate->env, iq->dp,
+		iq->dp->name, iq->dp->namelen, iq->qchase.qtype,
+		iq->sent_target, qstate->blacklist);
+	if(!target) {
+		verbose(VERB_ALGO, "query is slow, no other target to hedge");
+		return;
+	}
+	if(!(iq->chase_flags & BIT_RD) && !iq->ratelimit_ok) {
+		if(!infra_ratelimit_inc(qstate->env->infra_cache, iq->dp->name,
+			iq->dp->namelen, *qstate->env->now)) {
+			verbose(VERB_ALGO, "hedge query exceeded ratelimits");
+			return;
+		}
+	}
+	if(verbosity >= VERB_QUERY) {
+		log_query_info(VERB_QUERY, "sending hedge query:", &iq->qchase);
+		log_name_addr(VERB_QUERY, "sending to target:", iq->dp->name, 
+			&target->addr, target->addrlen);
+	}
+	fptr_ok(fptr_whitelist_modenv_send_query(qstate->env->send_query));
+	outq = (*qstate->env->send_query)(
+		iq->qchase.qname, iq->qchase.qname_len, 
+		iq->qchase.qtype, iq->qchase.qclass, 
+		iq->chase_flags | (iq->chase_to_rd?BIT_RD:0), EDNS_DO|BIT_CD, 
+		iq->dnssec_expected, is_caps_whitelisted(ie, iq),
+		&target->addr, target->addrlen, iq->dp->name,
+		iq->dp->namelen, qstate);
+	if(!outq) {
+		log_addr(VERB_DETAIL, "error sending hedge query to auth server",
+			&target->addr, target->addrlen);
+		if(!(iq->chase_flags & BIT_RD) && !iq->ratelimit_ok)
+		    infra_ratelimit_dec(qstate->env->infra_cache, iq->dp->name,
+			iq->dp->namelen, *qstate->env->now);
+		return;
+	}
+	outbound_list_insert(&iq->outlist, outq);
+	iq->num_current_queries++;
+	iq->sent_count++;
+	iq->hedged = 1;
+}
+
+/**
+ * A reply arrived for a query that was hedged, stop the other query.
+ * @param iq: iterator query state.
+ * @param outbound: the entry that has the reply.
+ */
+static void
+stop_hedge(struct iter_qstate* iq, struct outbound_entry* outbound)
+{
+	struct outbound_entry* e = iq->outlist.first, *next;
+	while(e) {
+		next = e->next;
+		if(e != outbound) {
+			verbose(VERB_ALGO, "stop the other hedged query");
+			outbound_list_remove(&iq->outlist, e);
+			iq->num_current_queries--;
+		}
+		e = next;
+	}
+	iq->hedged = 0;
+}
+
 /** process authoritative server reply */
 static void
 process_response(struct module_qstate* qstate, struct iter_qstate* iq, 
@@ -2987,6 +3079,8 @@ process_response(struct module_qstate* qstate, struct iter_qstate* iq,
 	iq->response = dns_alloc_msg(pkt, prs, qstate->region);
 	if(!iq->response)
 		goto handle_it;
+	if(iq->hedged)
+		stop_hedge(iq, outbound);
 	log_query_info(VERB_DETAIL, "response for", &qstate->qinfo);
 	log_name_addr(VERB_DETAIL, "reply from", iq->dp->name, 
 		&qstate->reply->addr, qstate->reply->addrlen);
@@ -3084,6 +3178,10 @@ iter_operate(struct module_qstate* qstate, enum module_ev event, int id,
 		iter_handle(qstate, iq, ie, id);
 		return;
 	}
+	if(iq && outbound && event == module_event_slow) {
+		process_slow(qstate, iq, ie, id);
+		return;
+	}
 	if(iq && outbound) {
 		process_response(qstate, iq, ie, id, outbound, event);
 		return;
@@ -258,6 +258,13 @@ struct iter_qstate {
 
 	/** number of queries fired off */
 	int sent_count;
+
+	/** the target of the last query that was sent, if it is slow a
+	 * hedge query goes to another target */
+	struct delegpt_addr* sent_target;
+
+	/** if a hedge query was sent, the first reply stops the other */
+	int hedged;
 	
 	/** number of target queries spawned in [1], for this query and its
 	 * subqueries, the malloced-array is shared, [0] refcount. */
@@ -78,6 +78,9 @@ context_finalize(struct ub_ctx* ctx)
 		if(!ctx->env->msg_cache)
 			return UB_NOMEM;
 	}
+	if(!slabhash_set_open_addressing(ctx->env->msg_cache,
+		cfg->cache_open_addressing))
+		return UB_NOMEM;
 	ctx->env->rrset_cache = rrset_cache_adjust(ctx->env->rrset_cache,
 		ctx->env->cfg, ctx->env->alloc);
 	if(!ctx->env->rrset_cache)
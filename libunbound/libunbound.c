@@ -61,6 +61,7 @@
 #include "services/localzone.h"
 #include "services/cache/infra.h"
 #include "services/cache/rrset.h"
+#include "validator/val_kcache.h"
 #include "sldns/sbuffer.h"
 #ifdef HAVE_PTHREAD
 #include <signal.h>
@@ -263,6 +264,7 @@ ub_ctx_delete(struct ub_ctx* ctx)
 	tube_delete(ctx->qq_pipe);
 	tube_delete(ctx->rr_pipe);
 	if(ctx->env) {
+		key_cache_delete(ctx->env->key_cache);
 		slabhash_delete(ctx->env->msg_cache);
 		rrset_cache_delete(ctx->env->rrset_cache);
 		infra_delete(ctx->env->infra_cache);
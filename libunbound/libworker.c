@@ -203,6 +203,11 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct event_base* eb)
 		if(!done_raninit) {
 			done_raninit = 1;
 			hash_set_raninit((uint32_t)ub_random(w->env->rnd));
+			hash_set_seed(((uint64_t)ub_random(w->env->rnd)<<32) ^
+				(uint64_t)ub_random(w->env->rnd));
+			if(hash_func_lookup(cfg->hash_function) >= 0)
+				hash_set_func((enum hash_func)hash_func_lookup(
+					cfg->hash_function));
 		}
 	}
 	seed = 0;
@@ -233,7 +238,9 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct event_base* eb)
 		w->env->infra_cache, w->env->rnd, cfg->use_caps_bits_for_id,
 		ports, numports, cfg->unwanted_threshold,
 		&libworker_alloc_cleanup, w, cfg->do_udp, w->sslctx,
-		cfg->delay_close, NULL);
+		cfg->delay_close, NULL, cfg->tcp_reuse_timeout,
+		cfg->max_reuse_tcp_queries, cfg->outgoing_port_pool,
+		cfg->outgoing_port_lifetime, cfg->hedge_query_budget);
 	if(!w->is_bg || w->is_bg_thread) {
 		lock_basic_unlock(&ctx->cfglock);
 	}
@@ -978,6 +985,16 @@ void worker_probe_timer_cb(void* ATTR_UNUSED(arg))
 	log_assert(0);
 }
 
+void worker_snapshot_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
+void worker_inflight_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void worker_start_accept(void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
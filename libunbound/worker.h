@@ -161,6 +161,12 @@ void worker_stat_timer_cb(void* arg);
 /** probe timer callback handler */
 void worker_probe_timer_cb(void* arg);
 
+/** cache snapshot timer callback handler */
+void worker_snapshot_timer_cb(void* arg);
+
+/** inflight wait timer callback handler */
+void worker_inflight_timer_cb(void* arg);
+
 /** start accept callback handler */
 void worker_start_accept(void* arg);
 
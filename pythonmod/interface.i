@@ -791,6 +791,7 @@ enum module_ext_state {
 %rename ("MODULE_EVENT_REPLY") "module_event_reply";
 %rename ("MODULE_EVENT_NOREPLY") "module_event_noreply";
 %rename ("MODULE_EVENT_CAPSFAIL") "module_event_capsfail";
+%rename ("MODULE_EVENT_SLOW") "module_event_slow";
 %rename ("MODULE_EVENT_MODDONE") "module_event_moddone";
 %rename ("MODULE_EVENT_ERROR") "module_event_error";
 
@@ -800,6 +801,7 @@ enum module_ev {
    module_event_reply,
    module_event_noreply,
    module_event_capsfail,
+   module_event_slow,
    module_event_moddone,
    module_event_error
 };
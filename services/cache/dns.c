@@ -44,6 +44,7 @@
 #include "services/cache/dns.h"
 #include "services/cache/rrset.h"
 #include "util/data/msgreply.h"
+#include "util/data/msgencode.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
 #include "util/module.h"
@@ -104,6 +105,34 @@ store_rrsets(struct module_env* env, struct reply_info* rep, time_t now,
         }
 }
 
+/**
+ * Share the qname of the message with the owner name of the first rrset
+ * in the answer section, that is in the cache, so the name is stored once.
+ * @param qinfo: the query with the qname, from packed_rrset_name_alloc.
+ * @param rep: the message, its refs point to the rrsets in the cache.
+ * @return true if the qname is shared.
+ */
+static int
+msg_share_qname(struct query_info* qinfo, struct reply_info* rep)
+{
+	struct ub_packed_rrset_key* k;
+	uint8_t* nm = NULL;
+	if(rep->an_numrrsets == 0)
+		return 0;
+	k = rep->ref[0].key;
+	lock_rw_rdlock(&k->entry.lock);
+	if(k->id == rep->ref[0].id && k->rk.dname != qinfo->qname &&
+		k->rk.dname_len == qinfo->qname_len &&
+		query_dname_compare(k->rk.dname, qinfo->qname) == 0)
+		nm = packed_rrset_name_ref(k->rk.dname);
+	lock_rw_unlock(&k->entry.lock);
+	if(nm) {
+		packed_rrset_name_free(qinfo->qname);
+		qinfo->qname = nm;
+	}
+	return nm != NULL;
+}
+
 void 
 dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
 	hashvalue_t hash, struct reply_info* rep, time_t leeway, int pside,
@@ -112,6 +141,7 @@ dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
 	struct msgreply_entry* e;
 	time_t ttl = rep->ttl;
 	size_t i;
+	int shared;
 
 	/* store RRsets */
         for(i=0; i<rep->rrset_count; i++) {
@@ -132,11 +162,13 @@ dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
 	}
 
 	/* store msg in the cache */
+	shared = msg_share_qname(qinfo, rep);
 	reply_info_sortref(rep);
 	if(!(e = query_info_entrysetup(qinfo, rep, hash))) {
 		log_err("store_msg: malloc failed");
 		return;
 	}
+	e->qname_shared = shared;
 	slabhash_insert(env->msg_cache, hash, &e->entry, rep, env->alloc);
 }
 
@@ -857,7 +889,8 @@ dns_cache_store(struct module_env* env, struct query_info* msgqinf,
 		hashvalue_t h;
 
 		qinf = *msgqinf;
-		qinf.qname = memdup(msgqinf->qname, msgqinf->qname_len);
+		qinf.qname = packed_rrset_name_dup(msgqinf->qname,
+			msgqinf->qname_len);
 		if(!qinf.qname) {
 			reply_info_parsedelete(rep, env->alloc);
 			return 0;
@@ -871,8 +904,8 @@ dns_cache_store(struct module_env* env, struct query_info* msgqinf,
 		dns_cache_store_msg(env, &qinf, h, rep, leeway, pside, msgrep,
 			region);
 		/* qname is used inside query_info_entrysetup, and set to 
-		 * NULL. If it has not been used, free it. free(0) is safe. */
-		free(qinf.qname);
+		 * NULL. If it has not been used, free it. */
+		packed_rrset_name_free(qinf.qname);
 	}
 	return 1;
 }
@@ -882,8 +915,12 @@ dns_cache_prefetch_adjust(struct module_env* env, struct query_info* qinfo,
         time_t adjust, uint16_t flags)
 {
 	struct msgreply_entry* msg;
+	time_t now = *env->now;
+	/* an expired message that is served is also kept */
+	if(SERVE_EXPIRED)
+		now = SERVE_EXPIRED_TTL?now - SERVE_EXPIRED_TTL:0;
 	msg = msg_cache_lookup(env, qinfo->qname, qinfo->qname_len,
-		qinfo->qtype, qinfo->qclass, flags, *env->now, 1);
+		qinfo->qtype, qinfo->qclass, flags, now, 1);
 	if(msg) {
 		struct reply_info* rep = (struct reply_info*)msg->entry.data;
 		if(rep) {
@@ -895,3 +932,24 @@ dns_cache_prefetch_adjust(struct module_env* env, struct query_info* qinfo,
 	}
 	return 0;
 }
+
+void
+dns_cache_store_wire(struct module_env* env, struct query_info* qinfo,
+	uint16_t flags, struct reply_info* rep, int dnssec,
+	struct reply_wire* wire)
+{
+	struct msgreply_entry* msg;
+	msg = msg_cache_lookup(env, qinfo->qname, qinfo->qname_len,
+		qinfo->qtype, qinfo->qclass, flags, *env->now, 1);
+	if(msg) {
+		/* the entry could have been replaced in the meantime */
+		if((struct reply_info*)msg->entry.data == rep) {
+			free(rep->wire[dnssec?1:0]);
+			rep->wire[dnssec?1:0] = wire;
+			lock_rw_unlock(&msg->entry.lock);
+			return;
+		}
+		lock_rw_unlock(&msg->entry.lock);
+	}
+	free(wire);
+}
@@ -46,6 +46,7 @@
 struct module_env;
 struct query_info;
 struct reply_info;
+struct reply_wire;
 struct regional;
 struct delegpt;
 
@@ -194,4 +195,19 @@ int dns_msg_authadd(struct dns_msg* msg, struct regional* region,
 int dns_cache_prefetch_adjust(struct module_env* env, struct query_info* qinfo,
         time_t adjust, uint16_t flags);
 
+/**
+ * Store a pre-encoded answer with a cached message, replacing the image
+ * that it has for the DO bit, if any.
+ * @param env: module environment with caches and time.
+ * @param qinfo: query info for the query of the cached message.
+ * @param flags: flags with BIT_CD for AAAA queries in dns64 translation.
+ * @param rep: the reply the image was made from.  If the cache entry
+ *	no longer has this reply, the image is deleted.
+ * @param dnssec: the DO bit the image was made for.
+ * @param wire: the image, malloced; this function takes ownership.
+ */
+void dns_cache_store_wire(struct module_env* env, struct query_info* qinfo,
+	uint16_t flags, struct reply_info* rep, int dnssec,
+	struct reply_wire* wire);
+
 #endif /* SERVICES_CACHE_DNS_H */
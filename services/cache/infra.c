@@ -226,6 +226,7 @@ infra_create(struct config_file* cfg)
 		return NULL;
 	}
 	infra->host_ttl = cfg->host_ttl;
+	infra->rtt_percentile = cfg->infra_rtt_percentile;
 	name_tree_init(&infra->domain_limits);
 	infra_dp_ratelimit = cfg->ratelimit;
 	if(cfg->ratelimit != 0) {
@@ -271,16 +272,26 @@ struct infra_cache*
 infra_adjust(struct infra_cache* infra, struct config_file* cfg)
 {
 	size_t maxmem;
-	if(!infra)
-		return infra_create(cfg);
-	infra->host_ttl = cfg->host_ttl;
 	maxmem = cfg->infra_cache_numhosts * (sizeof(struct infra_key)+
 		sizeof(struct infra_data)+INFRA_BYTES_NAME);
-	if(maxmem != slabhash_get_size(infra->hosts) ||
+	if(!infra) {
+		infra = infra_create(cfg);
+	} else if(maxmem != slabhash_get_size(infra->hosts) ||
 		cfg->infra_cache_slabs != infra->hosts->size) {
-		infra_delete(infra);
+		struct infra_cache* old = infra;
 		infra = infra_create(cfg);
-	}
+		if(infra)
+			slabhash_migrate(infra->hosts, old->hosts, NULL);
+		infra_delete(old);
+	} else {
+		infra->host_ttl = cfg->host_ttl;
+		infra->rtt_percentile = cfg->infra_rtt_percentile;
+	}
+	if(infra && (!slabhash_set_open_addressing(infra->hosts,
+		cfg->cache_open_addressing) || (infra->domain_rates &&
+		!slabhash_set_open_addressing(infra->domain_rates,
+		cfg->cache_open_addressing))))
+		log_warn("cache-open-addressing could not be enabled");
 	return infra;
 }
 
@@ -292,14 +303,14 @@ hash_addr(struct sockaddr_storage* addr, socklen_t addrlen)
 	/* select the pieces to hash, some OS have changing data inside */
 	if(addr_is_ip6(addr, addrlen)) {
 		struct sockaddr_in6* in6 = (struct sockaddr_in6*)addr;
-		h = hashlittle(&in6->sin6_family, sizeof(in6->sin6_family), h);
-		h = hashlittle(&in6->sin6_port, sizeof(in6->sin6_port), h);
-		h = hashlittle(&in6->sin6_addr, INET6_SIZE, h);
+		h = hash_bytes(&in6->sin6_family, sizeof(in6->sin6_family), h);
+		h = hash_bytes(&in6->sin6_port, sizeof(in6->sin6_port), h);
+		h = hash_bytes(&in6->sin6_addr, INET6_SIZE, h);
 	} else {
 		struct sockaddr_in* in = (struct sockaddr_in*)addr;
-		h = hashlittle(&in->sin_family, sizeof(in->sin_family), h);
-		h = hashlittle(&in->sin_port, sizeof(in->sin_port), h);
-		h = hashlittle(&in->sin_addr, INET_SIZE, h);
+		h = hash_bytes(&in->sin_family, sizeof(in->sin_family), h);
+		h = hash_bytes(&in->sin_port, sizeof(in->sin_port), h);
+		h = hash_bytes(&in->sin_addr, INET_SIZE, h);
 	}
 	return h;
 }
@@ -335,6 +346,7 @@ data_entry_init(struct infra_cache* infra, struct lruhash_entry* e,
 	struct infra_data* data = (struct infra_data*)e->data;
 	data->ttl = timenow + infra->host_ttl;
 	rtt_init(&data->rtt);
+	rtt_sketch_init(&data->sketch);
 	data->edns_version = 0;
 	data->edns_lame_known = 0;
 	data->probedelay = 0;
@@ -387,6 +399,20 @@ new_entry(struct infra_cache* infra, struct sockaddr_storage* addr,
 	return &key->entry;
 }
 
+int
+infra_host_insert(struct infra_cache* infra, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t* name, size_t namelen,
+	struct infra_data* data)
+{
+	struct lruhash_entry* e = new_entry(infra, addr, addrlen, name,
+		namelen, data->ttl);
+	if(!e)
+		return 0;
+	memcpy(e->data, data, sizeof(*data));
+	slabhash_insert(infra->hosts, e->hash, e, e->data, NULL);
+	return 1;
+}
+
 int 
 infra_host(struct infra_cache* infra, struct sockaddr_storage* addr,
         socklen_t addrlen, uint8_t* nm, size_t nmlen, time_t timenow,
@@ -533,6 +559,7 @@ infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	data = (struct infra_data*)e->data;
 	if(roundtrip == -1) {
 		rtt_lost(&data->rtt, orig_rtt);
+		rtt_sketch_lost(&data->sketch);
 		if(qtype == LDNS_RR_TYPE_A) {
 			if(data->timeout_A < TIMEOUT_COUNT_MAX)
 				data->timeout_A++;
@@ -550,6 +577,7 @@ infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 		if(rtt_unclamped(&data->rtt) >= USEFUL_SERVER_TOP_TIMEOUT)
 			rtt_init(&data->rtt);
 		rtt_update(&data->rtt, roundtrip);
+		rtt_sketch_add(&data->sketch, roundtrip);
 		data->probedelay = 0;
 		if(qtype == LDNS_RR_TYPE_A)
 			data->timeout_A = 0;
@@ -622,6 +650,26 @@ infra_edns_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	return 1;
 }
 
+/**
+ * The rtt to select the server with, from the percentile of its rtt, and
+ * its timeouts, that each wait for the retransmit timeout.
+ * @param infra: infra cache with the percentile.
+ * @param host: the host data.
+ * @param rtt: the rtt from the timeout, used if there are few samples.
+ * @return the rtt in msec.
+ */
+static int
+infra_sketch_rtt(struct infra_cache* infra, struct infra_data* host, int rtt)
+{
+	int p = rtt_sketch_percentile(&host->sketch, infra->rtt_percentile);
+	if(p == -1)
+		return rtt;
+	p += rtt_sketch_loss(&host->sketch)*host->rtt.rto/100;
+	if(p >= USEFUL_SERVER_TOP_TIMEOUT)
+		p = USEFUL_SERVER_TOP_TIMEOUT-1;
+	return p;
+}
+
 int
 infra_get_lame_rtt(struct infra_cache* infra,
         struct sockaddr_storage* addr, socklen_t addrlen,
@@ -635,6 +683,10 @@ infra_get_lame_rtt(struct infra_cache* infra,
 		return 0;
 	host = (struct infra_data*)e->data;
 	*rtt = rtt_unclamped(&host->rtt);
+	/* unless the timeout is backed off, rank with the percentile */
+	if(infra->rtt_percentile > 0 &&
+		rtt_notimeout(&host->rtt) == host->rtt.rto)
+		*rtt = infra_sketch_rtt(infra, host, *rtt);
 	if(host->rtt.rto >= PROBE_MAXRTO && timenow < host->probedelay
 		&& rtt_notimeout(&host->rtt)*4 <= host->rtt.rto) {
 		/* single probe for this domain, and we are not probing */
@@ -75,6 +75,8 @@ struct infra_data {
 	time_t probedelay;
 	/** round trip times for timeout calculation */
 	struct rtt_info rtt;
+	/** rtt distribution and timeouts, for server selection */
+	struct rtt_sketch sketch;
 
 	/** edns version that the host supports, -1 means no EDNS */
 	int edns_version;
@@ -109,6 +111,9 @@ struct infra_cache {
 	struct slabhash* hosts;
 	/** TTL value for host information, in seconds */
 	int host_ttl;
+	/** percentile of the rtt that servers are selected with, 0 to use
+	 * the timeout of the server */
+	int rtt_percentile;
 	/** hash table with query rates per name: rate_key, rate_data */
 	struct slabhash* domain_rates;
 	/** ratelimit settings for domains, struct domain_limit_data */
@@ -203,6 +208,20 @@ struct lruhash_entry* infra_lookup_nottl(struct infra_cache* infra,
 	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
 	size_t namelen, int wr);
 
+/**
+ * Insert a host entry with the given data, for loading the cache.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: domain name of zone.
+ * @param namelen: length of domain name.
+ * @param data: the host data, copied into the new entry.
+ * @return false on malloc failure.
+ */
+int infra_host_insert(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
+	size_t namelen, struct infra_data* data);
+
 /**
  * Find host information to send a packet. Creates new entry if not found.
  * Lameness is empty. EDNS is 0 (try with first), and rtt is returned for 
@@ -83,9 +83,15 @@ struct rrset_cache* rrset_cache_adjust(struct rrset_cache *r,
 	if(!r || !cfg || cfg->rrset_cache_slabs != r->table.size ||
 		cfg->rrset_cache_size != slabhash_get_size(&r->table))
 	{
-		rrset_cache_delete(r);
+		struct rrset_cache* old = r;
 		r = rrset_cache_create(cfg, alloc);
+		if(r && old)
+			slabhash_migrate(&r->table, &old->table, NULL);
+		rrset_cache_delete(old);
 	}
+	if(r && cfg && !slabhash_set_open_addressing(&r->table,
+		cfg->cache_open_addressing))
+		log_warn("cache-open-addressing could not be enabled");
 	return r;
 }
 
@@ -94,6 +100,16 @@ rrset_cache_touch(struct rrset_cache* r, struct ub_packed_rrset_key* key,
         hashvalue_t hash, rrset_id_t id)
 {
 	struct lruhash* table = slabhash_gettable(&r->table, hash);
+	if(table->readers) {
+		/* read-mostly table, the touch sets the reference bit and
+		 * that only needs the entry lock. The id check makes sure
+		 * it is still the same rrset, and not deleted. */
+		lock_rw_rdlock(&key->entry.lock);
+		if(key->id == id && key->entry.hash == hash)
+			lru_touch(table, &key->entry);
+		lock_rw_unlock(&key->entry.lock);
+		return;
+	}
 	/* 
 	 * This leads to locking problems, deadlocks, if the caller is 
 	 * holding any other rrset lock.
@@ -221,6 +237,9 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 		 * cache size values nicely. */
 	}
 	log_assert(ref->key->id != 0);
+	/* this may clear the cache, no locks are held here */
+	((struct packed_rrset_data*)k->entry.data)->version =
+		alloc_get_id(alloc);
 	slabhash_insert(&r->table, h, &k->entry, k->entry.data, alloc);
 	if(e) {
 		/* For NSEC, NSEC3, DNAME, when rdata is updated, update 
@@ -0,0 +1,261 @@
+/*
+ * services/inflight.c - queries in progress, shared by the threads.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the table of the recursive queries in progress,
+ * that is shared by the threads, so that the threads do not resolve the
+ * same query at the same time.
+ */
+#include "config.h"
+#include "services/inflight.h"
+#include "util/log.h"
+#include "util/tube.h"
+
+struct inflight_table*
+inflight_create(int num, uint32_t wake_cmd)
+{
+	struct inflight_table* table = (struct inflight_table*)calloc(1,
+		sizeof(*table));
+	int i;
+	if(!table)
+		return NULL;
+	table->boxes = (struct inflight_box*)calloc((size_t)num,
+		sizeof(struct inflight_box));
+	if(!table->boxes) {
+		free(table);
+		return NULL;
+	}
+	table->num = num;
+	table->wake_cmd = wake_cmd;
+	for(i=0; i<INFLIGHT_SHARDS; i++) {
+		lock_basic_init(&table->shards[i].lock);
+		rbtree_init(&table->shards[i].tree, &inflight_entry_compare);
+		lock_protect(&table->shards[i].lock, &table->shards[i].tree,
+			sizeof(table->shards[i].tree));
+	}
+	for(i=0; i<num; i++) {
+		lock_basic_init(&table->boxes[i].lock);
+		lock_protect(&table->boxes[i].lock, &table->boxes[i].list,
+			sizeof(table->boxes[i].list));
+	}
+	return table;
+}
+
+/** delete an entry, for the rbtree traverse */
+static void
+inflight_entry_del(rbnode_t* n, void* ATTR_UNUSED(arg))
+{
+	free(n);
+}
+
+void
+inflight_delete(struct inflight_table* table)
+{
+	int i;
+	if(!table)
+		return;
+	for(i=0; i<INFLIGHT_SHARDS; i++) {
+		traverse_postorder(&table->shards[i].tree, &inflight_entry_del,
+			NULL);
+		lock_basic_destroy(&table->shards[i].lock);
+	}
+	for(i=0; i<table->num; i++) {
+		struct inflight_done* d, *n;
+		lock_basic_destroy(&table->boxes[i].lock);
+		for(d = table->boxes[i].list; d; d = n) {
+			n = d->next;
+			free(d);
+		}
+	}
+	free(table->boxes);
+	free(table);
+}
+
+void
+inflight_set_tube(struct inflight_table* table, int thread,
+	struct tube* cmd)
+{
+	table->boxes[thread].cmd = cmd;
+}
+
+void
+inflight_close(struct inflight_table* table)
+{
+	int i;
+	if(!table)
+		return;
+	/* the shard locks protect it, it is read under one of them */
+	for(i=0; i<INFLIGHT_SHARDS; i++)
+		lock_basic_lock(&table->shards[i].lock);
+	table->closed = 1;
+	for(i=0; i<INFLIGHT_SHARDS; i++)
+		lock_basic_unlock(&table->shards[i].lock);
+}
+
+int
+inflight_entry_compare(const void* ap, const void* bp)
+{
+	struct inflight_entry* a = (struct inflight_entry*)ap;
+	struct inflight_entry* b = (struct inflight_entry*)bp;
+	if(a->flags != b->flags)
+		return (a->flags < b->flags)? -1 : 1;
+	return query_info_compare(&a->qinfo, &b->qinfo);
+}
+
+/** the shard for the query */
+static struct inflight_shard*
+inflight_shard(struct inflight_table* table, struct query_info* qinfo,
+	uint16_t flags)
+{
+	return &table->shards[query_info_hash(qinfo, flags) %
+		INFLIGHT_SHARDS];
+}
+
+int
+inflight_start(struct inflight_table* table, struct query_info* qinfo,
+	uint16_t flags, int thread)
+{
+	struct inflight_shard* sh = inflight_shard(table, qinfo, flags);
+	struct inflight_entry key, *e;
+	size_t bits = ((size_t)table->num+7)/8;
+	key.node.key = &key;
+	key.qinfo = *qinfo;
+	key.flags = flags;
+	lock_basic_lock(&sh->lock);
+	e = (struct inflight_entry*)rbtree_search(&sh->tree, &key);
+	if(e) {
+		if(e->owner == thread) {
+			/* should not happen, the state of the owner is
+			 * in its mesh */
+			lock_basic_unlock(&sh->lock);
+			return -1;
+		}
+		e->waiting[thread/8] |= (uint8_t)(1<<(thread%8));
+		lock_basic_unlock(&sh->lock);
+		return 0;
+	}
+	e = (struct inflight_entry*)calloc(1, sizeof(*e) + qinfo->qname_len +
+		bits);
+	if(!e) {
+		lock_basic_unlock(&sh->lock);
+		return -1;
+	}
+	e->node.key = e;
+	e->qinfo = *qinfo;
+	e->qinfo.qname = (uint8_t*)e + sizeof(*e);
+	memmove(e->qinfo.qname, qinfo->qname, qinfo->qname_len);
+	e->flags = flags;
+	e->owner = thread;
+	e->waiting = e->qinfo.qname + qinfo->qname_len;
+	(void)rbtree_insert(&sh->tree, &e->node);
+	lock_basic_unlock(&sh->lock);
+	return 1;
+}
+
+/** put the done query in the box of a thread, and wake it up */
+static void
+inflight_wake(struct inflight_table* table, int thread,
+	struct inflight_entry* e)
+{
+	struct inflight_box* box = &table->boxes[thread];
+	struct inflight_done* d = (struct inflight_done*)malloc(sizeof(*d) +
+		e->qinfo.qname_len);
+	int wake;
+	if(d) {
+		d->qinfo = e->qinfo;
+		d->qinfo.qname = (uint8_t*)d + sizeof(*d);
+		memmove(d->qinfo.qname, e->qinfo.qname, e->qinfo.qname_len);
+		d->flags = e->flags;
+	} else	log_err("inflight: malloc failure, wake all");
+	lock_basic_lock(&box->lock);
+	if(d) {
+		d->next = box->list;
+		box->list = d;
+	} else	box->lost = 1;
+	wake = !box->signalled;
+	box->signalled = 1;
+	lock_basic_unlock(&box->lock);
+	if(wake && box->cmd) {
+		uint32_t c = table->wake_cmd;
+		if(!tube_write_msg(box->cmd, (uint8_t*)&c, sizeof(c), 0))
+			log_err("inflight: could not wake up thread %d",
+				thread);
+	}
+}
+
+void
+inflight_done(struct inflight_table* table, struct query_info* qinfo,
+	uint16_t flags, int thread)
+{
+	struct inflight_shard* sh = inflight_shard(table, qinfo, flags);
+	struct inflight_entry key, *e;
+	int i, closed;
+	key.node.key = &key;
+	key.qinfo = *qinfo;
+	key.flags = flags;
+	lock_basic_lock(&sh->lock);
+	e = (struct inflight_entry*)rbtree_search(&sh->tree, &key);
+	if(!e || e->owner != thread) {
+		lock_basic_unlock(&sh->lock);
+		return;
+	}
+	(void)rbtree_delete(&sh->tree, e);
+	closed = table->closed;
+	lock_basic_unlock(&sh->lock);
+	/* the entry is no longer in the table, and the waiting threads
+	 * are woken up outside of the lock */
+	for(i=0; i<table->num && !closed; i++) {
+		if(e->waiting[i/8] & (1<<(i%8)))
+			inflight_wake(table, i, e);
+	}
+	free(e);
+}
+
+struct inflight_done*
+inflight_take(struct inflight_table* table, int thread, int* all)
+{
+	struct inflight_box* box = &table->boxes[thread];
+	struct inflight_done* list;
+	lock_basic_lock(&box->lock);
+	list = box->list;
+	box->list = NULL;
+	*all = box->lost;
+	box->lost = 0;
+	box->signalled = 0;
+	lock_basic_unlock(&box->lock);
+	return list;
+}
@@ -0,0 +1,212 @@
+/*
+ * services/inflight.h - queries in progress, shared by the threads.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the table of the recursive queries in progress,
+ * that is shared by the threads. When more threads get the same query,
+ * the first thread resolves it, and the others wait for it. The result
+ * is put in the shared cache by the owner thread, and when its query is
+ * done, the waiting threads are woken up with a message on their command
+ * tube. They continue their query, and find the answer in the cache; if
+ * the answer could not be cached, they resolve it themselves.
+ */
+
+#ifndef SERVICES_INFLIGHT_H
+#define SERVICES_INFLIGHT_H
+#include "util/locks.h"
+#include "util/rbtree.h"
+#include "util/data/msgreply.h"
+struct tube;
+
+/** number of shards of the table, each with its own lock */
+#define INFLIGHT_SHARDS 16
+/** seconds that a thread waits for the query of another thread, after
+ * that it resolves the query itself */
+#define INFLIGHT_WAIT_TIMEOUT 3
+
+/**
+ * A query in progress, by qname, qtype, qclass and the RD and CD flags.
+ */
+struct inflight_entry {
+	/** rbtree node, key is this structure */
+	rbnode_t node;
+	/** the query, the qname is allocated after the structure */
+	struct query_info qinfo;
+	/** the query flags, BIT_RD and BIT_CD */
+	uint16_t flags;
+	/** the thread that resolves the query */
+	int owner;
+	/** bitmap of the threads that wait for it, after the qname */
+	uint8_t* waiting;
+};
+
+/**
+ * A part of the table, by the hash of the query.
+ */
+struct inflight_shard {
+	/** lock on the tree */
+	lock_basic_t lock;
+	/** tree of struct inflight_entry */
+	rbtree_t tree;
+};
+
+/**
+ * A query that is done, for a thread that waits for it.
+ */
+struct inflight_done {
+	/** next in list */
+	struct inflight_done* next;
+	/** the query, the qname is allocated after the structure */
+	struct query_info qinfo;
+	/** the query flags */
+	uint16_t flags;
+};
+
+/**
+ * The queries that are done for a thread, and the tube to wake it up.
+ */
+struct inflight_box {
+	/** lock on the list and the signalled flag */
+	lock_basic_t lock;
+	/** queries that are done, that the thread waits for */
+	struct inflight_done* list;
+	/** if a done query could not be stored, the thread has to
+	 * continue all the queries that wait */
+	int lost;
+	/** if the thread has been woken up, and has not taken the list.
+	 * There is at most one wakeup message in the tube. */
+	int signalled;
+	/** the command tube of the thread */
+	struct tube* cmd;
+};
+
+/**
+ * The table of queries in progress.
+ */
+struct inflight_table {
+	/** number of threads */
+	int num;
+	/** the command to write on the tube to wake a thread up */
+	uint32_t wake_cmd;
+	/** if closed, the threads are not woken up, because they are
+	 * deleted. Set when the threads have stopped, with all the shard
+	 * locks held; it is read under the lock of a shard. */
+	int closed;
+	/** the shards */
+	struct inflight_shard shards[INFLIGHT_SHARDS];
+	/** per thread, the done queries, array of num */
+	struct inflight_box* boxes;
+};
+
+/**
+ * Create the table of queries in progress.
+ * @param num: number of threads.
+ * @param wake_cmd: the command that is written to the command tube of a
+ *	thread, in network byte order, when queries it waits for are done.
+ * @return new table or NULL on malloc failure.
+ */
+struct inflight_table* inflight_create(int num, uint32_t wake_cmd);
+
+/**
+ * Delete the table, and the entries in it.
+ * @param table: to delete.
+ */
+void inflight_delete(struct inflight_table* table);
+
+/**
+ * Set the command tube of a thread.
+ * @param table: the table.
+ * @param thread: thread number.
+ * @param cmd: the command tube of the thread.
+ */
+void inflight_set_tube(struct inflight_table* table, int thread,
+	struct tube* cmd);
+
+/**
+ * Stop waking up threads, because they are deleted.
+ * @param table: the table.
+ */
+void inflight_close(struct inflight_table* table);
+
+/**
+ * Start a query. If it is not in progress, the thread becomes the owner,
+ * and resolves it. Otherwise the thread waits for it.
+ * @param table: the table.
+ * @param qinfo: the query.
+ * @param flags: the query flags, BIT_RD and BIT_CD.
+ * @param thread: the thread number.
+ * @return 1 if the thread is the owner and resolves it; it has to call
+ *	inflight_done when the query is done. 0 if the thread waits for it,
+ *	and is woken up when the query is done. -1 if it is not in the
+ *	table, on malloc failure, and the thread resolves it itself.
+ */
+int inflight_start(struct inflight_table* table, struct query_info* qinfo,
+	uint16_t flags, int thread);
+
+/**
+ * The owner is done with the query. It is removed from the table, and
+ * the threads that wait for it are woken up.
+ * @param table: the table.
+ * @param qinfo: the query.
+ * @param flags: the query flags.
+ * @param thread: the owner thread number.
+ */
+void inflight_done(struct inflight_table* table, struct query_info* qinfo,
+	uint16_t flags, int thread);
+
+/**
+ * Take the list of done queries that the thread waits for, after the
+ * thread is woken up.
+ * @param table: the table.
+ * @param thread: the thread number.
+ * @param all: set true if all the queries that wait have to continue,
+ *	because a done query could not be stored.
+ * @return list of done queries, to be freed by the caller, with free()
+ *	for every element.
+ */
+struct inflight_done* inflight_take(struct inflight_table* table, int thread,
+	int* all);
+
+/**
+ * Compare two entries, for the rbtree.
+ * @param a: struct inflight_entry.
+ * @param b: struct inflight_entry.
+ * @return -1, 0, +1.
+ */
+int inflight_entry_compare(const void* a, const void* b);
+
+#endif /* SERVICES_INFLIGHT_H */
@@ -59,6 +59,9 @@
 #ifdef HAVE_SYS_UN_H
 #include <sys/un.h>
 #endif
+#ifdef HAVE_LINUX_FILTER_H
+#include <linux/filter.h>
+#endif
 
 /** number of queued TCP connections for listen() */
 #define TCP_BACKLOG 256 
@@ -950,7 +953,7 @@ listen_cp_insert(struct comm_point* c, struct listen_dnsport* front)
 
 struct listen_dnsport* 
 listen_create(struct comm_base* base, struct listen_port* ports,
-	size_t bufsize, int tcp_accept_count, void* sslctx,
+	size_t bufsize, int tcp_accept_count, int tcp_pipeline, void* sslctx,
 	struct dt_env* dtenv, comm_point_callback_t* cb, void *cb_arg)
 {
 	struct listen_dnsport* front = (struct listen_dnsport*)
@@ -985,6 +988,12 @@ listen_create(struct comm_base* base, struct listen_port* ports,
 			listen_delete(front);
 			return NULL;
 		}
+		if(ports->ftype == listen_type_tcp ||
+			ports->ftype == listen_type_ssl)
+			comm_point_tcp_set_pipeline(cp, tcp_pipeline);
+		if(ports->ftype == listen_type_udp ||
+			ports->ftype == listen_type_udpancil)
+			cp->udp_batch = 1;
 		cp->dtenv = dtenv;
 		cp->do_not_close = 1;
 		if(!listen_cp_insert(cp, front)) {
@@ -1128,6 +1137,84 @@ void listening_ports_free(struct listen_port* list)
 	}
 }
 
+void listening_ports_incoming_cpu(struct listen_port* list, int cpu)
+{
+#ifdef SO_INCOMING_CPU
+	for(; list; list = list->next) {
+		if(list->fd == -1)
+			continue;
+		if(setsockopt(list->fd, SOL_SOCKET, SO_INCOMING_CPU,
+			(void*)&cpu, (socklen_t)sizeof(cpu)) < 0)
+			log_warn("setsockopt(.. SO_INCOMING_CPU ..) failed: %s",
+				strerror(errno));
+	}
+#else
+	(void)list;
+	(void)cpu;
+	log_warn("so-incoming-cpu: SO_INCOMING_CPU is not available");
+#endif
+}
+
+int listening_ports_reuseport_bpf(struct listen_port* list, int* cpus,
+	int num_cpus, int num_threads)
+{
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(HAVE_LINUX_FILTER_H)
+	struct sock_filter* code;
+	struct sock_fprog prog;
+	int i, n = 0, num_map = (num_cpus<num_threads?num_cpus:num_threads);
+	if(num_threads < 1)
+		return 0;
+	code = (struct sock_filter*)calloc((size_t)(3 + 2*num_map),
+		sizeof(*code));
+	if(!code) {
+		log_err("reuseport bpf: out of memory");
+		return 0;
+	}
+	/* A = the CPU that received the packet */
+	code[n].code = BPF_LD | BPF_W | BPF_ABS;
+	code[n++].k = (uint32_t)(SKF_AD_OFF + SKF_AD_CPU);
+	/* the CPU of a pinned thread goes to that thread's socket, the
+	 * sockets of a group are in the order the threads opened them */
+	for(i=0; i<num_map; i++) {
+		code[n].code = BPF_JMP | BPF_JEQ | BPF_K;
+		code[n].jt = 0;
+		code[n].jf = 1;
+		code[n++].k = (uint32_t)cpus[i];
+		code[n].code = BPF_RET | BPF_K;
+		code[n++].k = (uint32_t)i;
+	}
+	/* other CPUs: A mod number of threads */
+	code[n].code = BPF_ALU | BPF_MOD | BPF_K;
+	code[n++].k = (uint32_t)num_threads;
+	code[n].code = BPF_RET | BPF_A;
+	n++;
+	prog.len = (unsigned short)n;
+	prog.filter = code;
+	/* the program is for the whole group of sockets bound to the
+	 * address, attach it to every socket of one thread */
+	for(; list; list = list->next) {
+		if(list->fd == -1)
+			continue;
+		if(setsockopt(list->fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+			(void*)&prog, (socklen_t)sizeof(prog)) < 0) {
+			log_err("setsockopt(.. SO_ATTACH_REUSEPORT_CBPF ..) "
+				"failed: %s", strerror(errno));
+			free(code);
+			return 0;
+		}
+	}
+	free(code);
+	return 1;
+#else
+	(void)list;
+	(void)cpus;
+	(void)num_cpus;
+	(void)num_threads;
+	log_err("SO_ATTACH_REUSEPORT_CBPF is not available");
+	return 0;
+#endif
+}
+
 size_t listen_get_mem(struct listen_dnsport* listen)
 {
 	size_t s = sizeof(*listen) + sizeof(*listen->base) + 
@@ -1143,12 +1230,11 @@ size_t listen_get_mem(struct listen_dnsport* listen)
 
 void listen_stop_accept(struct listen_dnsport* listen)
 {
-	/* do not stop the ones that have no tcp_free list
-	 * (they have already stopped listening) */
+	/* the tcp handlers are made when they are needed, an empty
+	 * tcp_free list does not mean it stopped listening */
 	struct listen_list* p;
 	for(p=listen->cps; p; p=p->next) {
-		if(p->com->type == comm_tcp_accept &&
-			p->com->tcp_free != NULL) {
+		if(p->com->type == comm_tcp_accept) {
 			comm_point_stop_listening(p->com);
 		}
 	}
@@ -1156,12 +1242,12 @@ void listen_stop_accept(struct listen_dnsport* listen)
 
 void listen_start_accept(struct listen_dnsport* listen)
 {
-	/* do not start the ones that have no tcp_free list, it is no
-	 * use to listen to them because they have no free tcp handlers */
+	/* also start the ones that have no tcp_free list, a handler can
+	 * be made or an idle stream closed; if all handlers are in use,
+	 * the accept pauses again */
 	struct listen_list* p;
 	for(p=listen->cps; p; p=p->next) {
-		if(p->com->type == comm_tcp_accept &&
-			p->com->tcp_free != NULL) {
+		if(p->com->type == comm_tcp_accept) {
 			comm_point_start_listening(p->com, -1, -1);
 		}
 	}
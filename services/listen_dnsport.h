@@ -120,6 +120,28 @@ struct listen_port* listening_ports_open(struct config_file* cfg,
  */
 void listening_ports_free(struct listen_port* list);
 
+/**
+ * Set SO_INCOMING_CPU on the (list of) listening ports, for the sockets
+ * of a thread that is pinned to that CPU.  Failures are logged.
+ * @param list: the ports of the thread.
+ * @param cpu: the CPU number.
+ */
+void listening_ports_incoming_cpu(struct listen_port* list, int cpu);
+
+/**
+ * Attach a reuseport BPF program to the reuseport groups of the listening
+ * ports, that selects the socket by the CPU that received the packet.
+ * The ports of every thread must have been opened in thread order, so
+ * that the socket of thread i is number i in its reuseport group.
+ * @param list: the ports of one thread, one socket for every group.
+ * @param cpus: the CPU that thread i is pinned to is cpus[i].
+ * @param num_cpus: length of cpus array, can be 0.
+ * @param num_threads: number of threads with sockets in every group.
+ * @return false on failure (it is logged).
+ */
+int listening_ports_reuseport_bpf(struct listen_port* list, int* cpus,
+	int num_cpus, int num_threads);
+
 /**
  * Create commpoints with for this thread for the shared ports.
  * @param base: the comm_base that provides event functionality.
@@ -128,6 +150,8 @@ void listening_ports_free(struct listen_port* list);
  * @param bufsize: size of datagram buffer.
  * @param tcp_accept_count: max number of simultaneous TCP connections 
  * 	from clients.
+ * @param tcp_pipeline: max number of queries in flight per TCP connection,
+ *	1 reads a query after the previous one is answered.
  * @param sslctx: nonNULL if ssl context.
  * @param dtenv: nonNULL if dnstap enabled.
  * @param cb: callback function when a request arrives. It is passed
@@ -137,8 +161,8 @@ void listening_ports_free(struct listen_port* list);
  */
 struct listen_dnsport* listen_create(struct comm_base* base,
 	struct listen_port* ports, size_t bufsize, int tcp_accept_count,
-	void* sslctx, struct dt_env *dtenv, comm_point_callback_t* cb,
-	void* cb_arg);
+	int tcp_pipeline, void* sslctx, struct dt_env *dtenv,
+	comm_point_callback_t* cb, void* cb_arg);
 
 /**
  * delete the listening structure
@@ -46,6 +46,7 @@
 #include "services/mesh.h"
 #include "services/outbound_list.h"
 #include "services/cache/dns.h"
+#include "services/inflight.h"
 #include "util/log.h"
 #include "util/net_help.h"
 #include "util/module.h"
@@ -367,8 +368,21 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 			s->list_select = mesh_jostle_list;
 		}
 	}
-	if(added)
+	if(added) {
+		if(mesh->inflight) {
+			/* is another thread resolving the query already */
+			int r = inflight_start(mesh->inflight, &s->s.qinfo,
+				s->s.query_flags, mesh->inflight_thread);
+			if(r == 0) {
+				s->inflight = mesh_inflight_wait;
+				s->inflight_time = *mesh->env->now;
+				mesh->stats_coalesced++;
+				return;
+			} else if(r == 1)
+				s->inflight = mesh_inflight_owner;
+		}
 		mesh_run(mesh, s, module_event_new, NULL);
+	}
 }
 
 int 
@@ -491,6 +505,8 @@ void mesh_report_reply(struct mesh_area* mesh, struct outbound_entry* e,
 		event = module_event_noreply;
 		if(what == NETEVENT_CAPSFAIL)
 			event = module_event_capsfail;
+		else if(what == NETEVENT_SLOW)
+			event = module_event_slow;
 	}
 	mesh_run(mesh, e->qstate->mesh_info, event, e);
 }
@@ -559,6 +575,12 @@ mesh_state_cleanup(struct mesh_state* mstate)
 	if(!mstate)
 		return;
 	mesh = mstate->s.env->mesh;
+	/* wake up the threads that wait for this query */
+	if(mstate->inflight == mesh_inflight_owner && mesh->inflight) {
+		inflight_done(mesh->inflight, &mstate->s.qinfo,
+			mstate->s.query_flags, mesh->inflight_thread);
+		mstate->inflight = mesh_inflight_none;
+	}
 	/* drop unsent replies */
 	if(!mstate->replies_sent) {
 		struct mesh_reply* rep;
@@ -721,8 +743,27 @@ int mesh_attach_sub(struct module_qstate* qstate, struct query_info* qinfo,
 		rbtree_insert(&mesh->run, &sub->run_node);
 		log_assert(n != NULL);
 		*newq = &sub->s;
-	} else
+	} else {
 		*newq = NULL;
+		/* it waits for another thread, that may wait for a query
+		 * of this thread in turn; resolve it here, so that the
+		 * threads cannot wait for each other */
+		if(sub->inflight == mesh_inflight_wait) {
+#ifdef UNBOUND_DEBUG
+			struct rbnode_t* n;
+#endif
+			log_query_info(VERB_ALGO, "inflight sub resolved here",
+				&sub->s.qinfo);
+			sub->inflight = mesh_inflight_none;
+#ifdef UNBOUND_DEBUG
+			n =
+#else
+			(void)
+#endif
+			rbtree_insert(&mesh->run, &sub->run_node);
+			log_assert(n != NULL);
+		}
+	}
 	was_detached = (sub->super_set.count == 0);
 	if(!mesh_state_attachment(qstate->mesh_info, sub))
 		return 0;
@@ -1105,6 +1146,101 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 	}
 }
 
+/** continue a state that waited for another thread */
+static void
+mesh_inflight_run(struct mesh_area* mesh, struct mesh_state* m)
+{
+	m->inflight = mesh_inflight_none;
+	mesh_run(mesh, m, module_event_new, NULL);
+}
+
+/**
+ * List the states that wait for another thread, in one pass.  The list
+ * holds a copy of the query, because a state that is continued can
+ * delete the other states.
+ * @param mesh: the mesh area.
+ * @param timeout: if true, only the states that waited too long.
+ * @return the list, free the elements with free().
+ */
+static struct inflight_done*
+mesh_inflight_waiting(struct mesh_area* mesh, int timeout)
+{
+	struct inflight_done* list = NULL, *d;
+	struct mesh_state* m;
+	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
+		if(m->inflight != mesh_inflight_wait || (timeout &&
+			*mesh->env->now - m->inflight_time <
+			INFLIGHT_WAIT_TIMEOUT))
+			continue;
+		d = (struct inflight_done*)malloc(sizeof(*d) +
+			m->s.qinfo.qname_len);
+		if(!d) {
+			/* the others continue at the next timeout */
+			log_err("mesh_inflight_waiting: malloc failure");
+			break;
+		}
+		d->qinfo = m->s.qinfo;
+		d->qinfo.qname = (uint8_t*)d + sizeof(*d);
+		memmove(d->qinfo.qname, m->s.qinfo.qname,
+			m->s.qinfo.qname_len);
+		d->flags = m->s.query_flags;
+		d->next = list;
+		list = d;
+	}
+	return list;
+}
+
+/**
+ * Continue the states of the list that still wait, and free the list.
+ * @param mesh: the mesh area.
+ * @param list: the list of queries.
+ * @param str: the log string for a state that continues.
+ */
+static void
+mesh_inflight_list_run(struct mesh_area* mesh, struct inflight_done* list,
+	const char* str)
+{
+	struct inflight_done* d;
+	struct mesh_state* m;
+	while(list) {
+		d = list;
+		list = list->next;
+		m = mesh_area_find(mesh, &d->qinfo, d->flags, 0, 0);
+		/* the state may have been deleted, or was resolved here */
+		if(m && m->inflight == mesh_inflight_wait) {
+			log_query_info(VERB_ALGO, str, &m->s.qinfo);
+			mesh_inflight_run(mesh, m);
+		}
+		free(d);
+	}
+}
+
+void
+mesh_inflight_continue(struct mesh_area* mesh)
+{
+	struct inflight_done* list;
+	int all = 0;
+	if(!mesh->inflight)
+		return;
+	list = inflight_take(mesh->inflight, mesh->inflight_thread, &all);
+	mesh_inflight_list_run(mesh, list, "continue after inflight");
+	if(!all)
+		return;
+	/* a done query was lost, continue all the states that wait */
+	verbose(VERB_ALGO, "continue all inflight states");
+	mesh_inflight_list_run(mesh, mesh_inflight_waiting(mesh, 0),
+		"continue after inflight");
+}
+
+void
+mesh_inflight_timeout(struct mesh_area* mesh)
+{
+	if(!mesh->inflight)
+		return;
+	mesh_inflight_list_run(mesh, mesh_inflight_waiting(mesh, 1),
+		"inflight wait timed out");
+}
+
 void 
 mesh_log_list(struct mesh_area* mesh)
 {
@@ -1161,6 +1297,7 @@ mesh_stats_clear(struct mesh_area* mesh)
 	mesh->replies_sum_wait.tv_usec = 0;
 	mesh->stats_jostled = 0;
 	mesh->stats_dropped = 0;
+	mesh->stats_coalesced = 0;
 	timehist_clear(mesh->histogram);
 	mesh->ans_secure = 0;
 	mesh->ans_bogus = 0;
@@ -59,6 +59,7 @@ struct query_info;
 struct reply_info;
 struct outbound_entry;
 struct timehist;
+struct inflight_table;
 
 /**
  * Maximum number of mesh state activations. Any more is likely an
@@ -109,6 +110,9 @@ struct mesh_area {
 	size_t stats_jostled;
 	/** stats, cumulative number of incoming client msgs dropped */
 	size_t stats_dropped;
+	/** stats, cumulative number of queries that waited for the same
+	 * query in progress in another thread */
+	size_t stats_coalesced;
 	/** number of replies sent */
 	size_t replies_sent;
 	/** sum of waiting times for the replies */
@@ -141,6 +145,12 @@ struct mesh_area {
 	struct mesh_state* jostle_last;
 	/** timeout for jostling. if age is lower, it does not get jostled. */
 	struct timeval jostle_max;
+
+	/** table of queries in progress in the threads, shared between
+	 * the threads, or NULL if queries are not coalesced */
+	struct inflight_table* inflight;
+	/** the thread number of this mesh in the inflight table */
+	int inflight_thread;
 };
 
 /**
@@ -180,6 +190,12 @@ struct mesh_state {
 	/** if this state is in the forever list, jostle list, or neither */
 	enum mesh_list_select { mesh_no_list, mesh_forever_list, 
 		mesh_jostle_list } list_select;
+	/** if this state resolves the query for the other threads, waits
+	 * for another thread to resolve it, or neither */
+	enum mesh_inflight { mesh_inflight_none, mesh_inflight_owner,
+		mesh_inflight_wait } inflight;
+	/** the time the state started to wait for another thread */
+	time_t inflight_time;
 
 	/** true if replies have been sent out (at end for alignment) */
 	uint8_t replies_sent;
@@ -493,6 +509,24 @@ int mesh_state_add_cb(struct mesh_state* s, struct edns_data* edns,
 void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate, 
 	enum module_ev ev, struct outbound_entry* e);
 
+/**
+ * Continue the query states that wait for queries that another thread
+ * has finished. Called when the thread is woken up by the inflight table.
+ * The states run again, and find the answer in the cache, or resolve
+ * the query themselves if it was not cached.
+ * @param mesh: the mesh area.
+ */
+void mesh_inflight_continue(struct mesh_area* mesh);
+
+/**
+ * Continue the query states that have waited for another thread for
+ * longer than INFLIGHT_WAIT_TIMEOUT. The other thread may be stuck, or
+ * wait for a query of this thread itself; the states resolve the query
+ * themselves. Called periodically by the worker.
+ * @param mesh: the mesh area.
+ */
+void mesh_inflight_timeout(struct mesh_area* mesh);
+
 /**
  * Print some stats about the mesh to the log.
  * @param mesh: the mesh to print it for.
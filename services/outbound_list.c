@@ -87,3 +87,9 @@ outbound_list_remove(struct outbound_list* list, struct outbound_entry* e)
 	else	list->first = e->next;
 	/* in region, no free needed */
 }
+
+void
+outbound_entry_hedge(struct outbound_entry* e)
+{
+	outnet_serviced_query_hedge(e->qsent, e);
+}
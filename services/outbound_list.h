@@ -102,4 +102,11 @@ void outbound_list_insert(struct outbound_list* list,
 void outbound_list_remove(struct outbound_list* list, 
 	struct outbound_entry* e);
 
+/**
+ * Ask for a hedge on the entry, the query state gets a slow event when
+ * the serviced query has no reply after a while.
+ * @param e: the entry in the list.
+ */
+void outbound_entry_hedge(struct outbound_entry* e);
+
 #endif /* SERVICES_OUTBOUND_LIST_H */
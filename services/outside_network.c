@@ -74,6 +74,9 @@
 #define MAX_PORT_RETRY 10000
 /** number of retries on outgoing UDP queries */
 #define OUTBOUND_UDP_RETRY 1
+/** max number of queries outstanding on one tcp connection, if more,
+ * another connection to the server is opened */
+#define TCP_REUSE_MAX_INFLIGHT 64
 
 /** initiate TCP transaction for serviced query */
 static void serviced_tcp_initiate(struct serviced_query* sq, sldns_buffer* buff);
@@ -125,6 +128,16 @@ serviced_cmp(const void* key1, const void* key2)
 	return sockaddr_cmp(&q1->addr, q1->addrlen, &q2->addr, q2->addrlen);
 }
 
+int
+reuse_cmp(const void* key1, const void* key2)
+{
+	struct pending_tcp* r1 = (struct pending_tcp*)key1;
+	struct pending_tcp* r2 = (struct pending_tcp*)key2;
+	if(r1->ssl_upstream != r2->ssl_upstream)
+		return r1->ssl_upstream < r2->ssl_upstream ? -1 : 1;
+	return sockaddr_cmp(&r1->addr, r1->addrlen, &r2->addr, r2->addrlen);
+}
+
 /** delete waiting_tcp entry. Does not unlink from waiting list. 
  * @param w: to delete.
  */
@@ -141,24 +154,24 @@ waiting_tcp_delete(struct waiting_tcp* w)
  * Pick random outgoing-interface of that family, and bind it.
  * port set to 0 so OS picks a port number for us.
  * if it is the ANY address, do not bind.
- * @param w: tcp structure with destination address.
+ * @param pend: tcp connection with destination address.
  * @param s: socket fd.
  * @return false on error, socket closed.
  */
 static int
-pick_outgoing_tcp(struct waiting_tcp* w, int s)
+pick_outgoing_tcp(struct pending_tcp* pend, int s)
 {
 	struct port_if* pi = NULL;
 	int num;
 #ifdef INET6
-	if(addr_is_ip6(&w->addr, w->addrlen))
-		num = w->outnet->num_ip6;
+	if(addr_is_ip6(&pend->addr, pend->addrlen))
+		num = pend->outnet->num_ip6;
 	else
 #endif
-		num = w->outnet->num_ip4;
+		num = pend->outnet->num_ip4;
 	if(num == 0) {
 		log_err("no TCP outgoing interfaces of family");
-		log_addr(VERB_OPS, "for addr", &w->addr, w->addrlen);
+		log_addr(VERB_OPS, "for addr", &pend->addr, pend->addrlen);
 #ifndef USE_WINSOCK
 		close(s);
 #else
@@ -167,11 +180,11 @@ pick_outgoing_tcp(struct waiting_tcp* w, int s)
 		return 0;
 	}
 #ifdef INET6
-	if(addr_is_ip6(&w->addr, w->addrlen))
-		pi = &w->outnet->ip6_ifs[ub_random_max(w->outnet->rnd, num)];
+	if(addr_is_ip6(&pend->addr, pend->addrlen))
+		pi = &pend->outnet->ip6_ifs[ub_random_max(pend->outnet->rnd, num)];
 	else
 #endif
-		pi = &w->outnet->ip4_ifs[ub_random_max(w->outnet->rnd, num)];
+		pi = &pend->outnet->ip4_ifs[ub_random_max(pend->outnet->rnd, num)];
 	log_assert(pi);
 	if(addr_is_any(&pi->addr, pi->addrlen)) {
 		/* binding to the ANY interface is for listening sockets */
@@ -196,15 +209,123 @@ pick_outgoing_tcp(struct waiting_tcp* w, int s)
 	return 1;
 }
 
-/** use next free buffer to service a tcp query */
+/** find the open connection that queries to the server are sent on */
+static struct pending_tcp*
+reuse_tcp_find(struct outside_network* outnet, struct sockaddr_storage* addr,
+	socklen_t addrlen, int ssl_upstream)
+{
+	struct pending_tcp key;
+	memcpy(&key.addr, addr, addrlen);
+	key.addrlen = addrlen;
+	key.ssl_upstream = ssl_upstream;
+	key.node.key = &key;
+	return (struct pending_tcp*)rbtree_search(&outnet->tcp_reuse, &key);
+}
+
+/** remove connection from the reuse tree, no new queries are sent on it */
+static void
+reuse_tree_remove(struct pending_tcp* pend)
+{
+	if(!pend->in_reuse_tree)
+		return;
+	(void)rbtree_delete(&pend->outnet->tcp_reuse, pend);
+	pend->in_reuse_tree = 0;
+}
+
+/** remove connection from the idle list */
+static void
+tcp_idle_remove(struct pending_tcp* pend)
+{
+	struct outside_network* outnet = pend->outnet;
+	if(!pend->is_idle)
+		return;
+	if(pend->idle_prev)
+		pend->idle_prev->idle_next = pend->idle_next;
+	else	outnet->tcp_idle_first = pend->idle_next;
+	if(pend->idle_next)
+		pend->idle_next->idle_prev = pend->idle_prev;
+	else	outnet->tcp_idle_last = pend->idle_prev;
+	pend->idle_prev = NULL;
+	pend->idle_next = NULL;
+	pend->is_idle = 0;
+	comm_timer_disable(pend->idle_timer);
+}
+
+/** put the connection at the front of the idle list, start idle timer */
+static void
+tcp_idle_insert(struct pending_tcp* pend)
+{
+	struct outside_network* outnet = pend->outnet;
+	struct timeval tv;
+	log_assert(!pend->is_idle);
+	pend->idle_prev = NULL;
+	pend->idle_next = outnet->tcp_idle_first;
+	if(outnet->tcp_idle_first)
+		outnet->tcp_idle_first->idle_prev = pend;
+	else	outnet->tcp_idle_last = pend;
+	outnet->tcp_idle_first = pend;
+	pend->is_idle = 1;
+#ifndef S_SPLINT_S
+	tv.tv_sec = outnet->tcp_reuse_timeout/1000;
+	tv.tv_usec = (outnet->tcp_reuse_timeout%1000)*1000;
+#endif
+	comm_timer_set(pend->idle_timer, &tv);
+}
+
+#ifdef HAVE_SSL
+/** keep the session of the tls connection, so a new connection to the
+ * server can resume it, that saves a full handshake. */
+static void
+tcp_ssl_session_save(struct pending_tcp* pend)
+{
+	SSL_SESSION* sess;
+	if(pend->c->ssl_shake_state != comm_ssl_shake_none ||
+		!SSL_is_init_finished((SSL*)pend->c->ssl))
+		return;
+	if(!(sess = SSL_get1_session((SSL*)pend->c->ssl)))
+		return;
+	if(pend->ssl_session)
+		SSL_SESSION_free((SSL_SESSION*)pend->ssl_session);
+	pend->ssl_session = sess;
+	memcpy(&pend->ssl_session_addr, &pend->addr, pend->addrlen);
+	pend->ssl_session_addrlen = pend->addrlen;
+}
+
+/** use a stored session to that server, if any, for the new connection */
+static void
+tcp_ssl_session_resume(struct pending_tcp* pend)
+{
+	struct outside_network* outnet = pend->outnet;
+	size_t i;
+	for(i=0; i<outnet->num_tcp; i++) {
+		struct pending_tcp* p = outnet->tcp_conns[i];
+		if(p->ssl_session && sockaddr_cmp(&p->ssl_session_addr,
+			p->ssl_session_addrlen, &pend->addr,
+			pend->addrlen) == 0) {
+			if(!SSL_set_session((SSL*)pend->c->ssl,
+				(SSL_SESSION*)p->ssl_session))
+				log_crypto_err("could not SSL_set_session");
+			return;
+		}
+	}
+}
+#endif /* HAVE_SSL */
+
+/** open a tcp connection to the server of the query, with the first
+ * free buffer. The connection is put in the reuse tree.
+ * @return false on error, the buffer stays free. */
 static int
-outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
+outnet_tcp_connect(struct waiting_tcp* w)
 {
-	struct pending_tcp* pend = w->outnet->tcp_free;
+	struct outside_network* outnet = w->outnet;
+	struct pending_tcp* pend = outnet->tcp_free;
+	struct pending_tcp* old;
 	int s;
 	log_assert(pend);
-	log_assert(pkt);
 	log_assert(w->addrlen > 0);
+	memcpy(&pend->addr, &w->addr, w->addrlen);
+	pend->addrlen = w->addrlen;
+	pend->ssl_upstream = w->ssl_upstream;
 	/* open socket */
 #ifdef INET6
 	if(addr_is_ip6(&w->addr, w->addrlen))
@@ -220,10 +341,13 @@ outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
 		log_err_addr("outgoing tcp: socket", 
 			wsa_strerror(WSAGetLastError()), &w->addr, w->addrlen);
 #endif
+		pend->addrlen = 0;
 		return 0;
 	}
-	if(!pick_outgoing_tcp(w, s))
+	if(!pick_outgoing_tcp(pend, s)) {
+		pend->addrlen = 0;
 		return 0;
+	}
 
 	fd_set_nonblock(s);
 	if(connect(s, (struct sockaddr*)&w->addr, w->addrlen) == -1) {
@@ -243,36 +367,178 @@ outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
 			WSAGetLastError() != WSAEWOULDBLOCK) {
 			closesocket(s);
 #endif
+			pend->addrlen = 0;
 			return 0;
 		}
 	}
-	if(w->outnet->sslctx && w->ssl_upstream) {
-		pend->c->ssl = outgoing_ssl_fd(w->outnet->sslctx, s);
+	if(outnet->sslctx && w->ssl_upstream) {
+		pend->c->ssl = outgoing_ssl_fd(outnet->sslctx, s);
 		if(!pend->c->ssl) {
 			pend->c->fd = s;
 			comm_point_close(pend->c);
+			pend->addrlen = 0;
 			return 0;
 		}
+#ifdef HAVE_SSL
+		tcp_ssl_session_resume(pend);
+#endif
 #ifdef USE_WINSOCK
 		comm_point_tcp_win_bio_cb(pend->c, pend->c->ssl);
 #endif
 		pend->c->ssl_shake_state = comm_ssl_shake_write;
 	}
-	w->pkt = NULL;
-	w->next_waiting = (void*)pend;
-	pend->id = LDNS_ID_WIRE(pkt);
-	w->outnet->num_tcp_outgoing++;
-	w->outnet->tcp_free = pend->next_free;
+	outnet->tcp_free = pend->next_free;
 	pend->next_free = NULL;
-	pend->query = w;
+	pend->num_queries = 0;
+	pend->num_replies = 0;
 	pend->c->repinfo.addrlen = w->addrlen;
 	memcpy(&pend->c->repinfo.addr, &w->addr, w->addrlen);
 	sldns_buffer_clear(pend->c->buffer);
-	sldns_buffer_write(pend->c->buffer, pkt, pkt_len);
-	sldns_buffer_flip(pend->c->buffer);
-	pend->c->tcp_is_reading = 0;
+	pend->c->tcp_is_reading = 1;
 	pend->c->tcp_byte_count = 0;
+	pend->c->tcp_check_nb_connect = 1;
 	comm_point_start_listening(pend->c, s, -1);
+
+	/* new queries for the server go on this connection, a previous
+	 * one that is full is closed when it is done */
+	if((old = reuse_tcp_find(outnet, &pend->addr, pend->addrlen,
+		pend->ssl_upstream)) != NULL)
+		reuse_tree_remove(old);
+	pend->node.key = pend;
+	(void)rbtree_insert(&outnet->tcp_reuse, &pend->node);
+	pend->in_reuse_tree = 1;
+	return 1;
+}
+
+/** see if the ID is in use on the connection */
+static int
+tcp_conn_has_id(struct pending_tcp* pend, uint16_t id)
+{
+	struct waiting_tcp* w;
+	for(w = pend->write_first; w; w = w->next_waiting)
+		if(w->id == id)
+			return 1;
+	for(w = pend->inflight; w; w = w->next_waiting)
+		if(w->id == id)
+			return 1;
+	return 0;
+}
+
+/** add query to the connection, and write it when the previous queries
+ * are written */
+static void
+tcp_conn_add_query(struct pending_tcp* pend, struct waiting_tcp* w)
+{
+	int tries = 0;
+	/* the ID has to be unique on the connection */
+	while(tcp_conn_has_id(pend, w->id) && tries++ < MAX_ID_RETRY)
+		w->id = ((unsigned)ub_random(pend->outnet->rnd)>>8) & 0xffff;
+	LDNS_ID_SET(w->pkt+sizeof(uint16_t), w->id);
+	tcp_idle_remove(pend);
+	w->pend = pend;
+	w->written = 0;
+	w->next_waiting = NULL;
+	if(pend->write_last)
+		pend->write_last->next_waiting = w;
+	else	pend->write_first = w;
+	pend->write_last = w;
+	pend->num_inflight++;
+	pend->num_queries++;
+	pend->outnet->num_tcp_outgoing++;
+	if(!pend->c->tcp_write_pkt)
+		comm_point_tcp_write_pkt(pend->c, w->pkt, w->pkt_len);
+}
+
+/** remove query from the write or inflight list of its connection.
+ * It must not be the query that is being written. */
+static void
+tcp_conn_remove_query(struct pending_tcp* pend, struct waiting_tcp* w)
+{
+	struct waiting_tcp* p, *prev = NULL;
+	p = w->written?pend->inflight:pend->write_first;
+	while(p) {
+		if(p == w) {
+			if(prev)
+				prev->next_waiting = w->next_waiting;
+			else if(w->written)
+				pend->inflight = w->next_waiting;
+			else	pend->write_first = w->next_waiting;
+			if(!w->written && pend->write_last == w)
+				pend->write_last = prev;
+			pend->num_inflight--;
+			break;
+		}
+		prev = p;
+		p = p->next_waiting;
+	}
+	w->pend = NULL;
+	w->next_waiting = NULL;
+}
+
+/** close the tcp connection, the buffer is not put on the free list */
+static void
+tcp_conn_close(struct pending_tcp* pend)
+{
+	reuse_tree_remove(pend);
+	tcp_idle_remove(pend);
+	if(pend->c->ssl) {
+#ifdef HAVE_SSL
+		tcp_ssl_session_save(pend);
+		SSL_shutdown(pend->c->ssl);
+		SSL_free(pend->c->ssl);
+		pend->c->ssl = NULL;
+#endif
+	}
+	comm_point_close(pend->c);
+	pend->c->tcp_write_pkt = NULL;
+	pend->c->tcp_write_pkt_len = 0;
+	pend->c->tcp_write_byte_count = 0;
+	pend->addrlen = 0;
+}
+
+/** decomission a tcp buffer that has no queries left, closes the
+ * connection and puts the buffer on the free list */
+static void
+decomission_pending_tcp(struct outside_network* outnet, 
+	struct pending_tcp* pend)
+{
+	log_assert(pend->num_inflight == 0);
+	tcp_conn_close(pend);
+	pend->next_free = outnet->tcp_free;
+	outnet->tcp_free = pend;
+}
+
+/** use an open connection or a free buffer to service a tcp query.
+ * @return 1 if the query is on a connection, 0 if no buffer is available,
+ *	and -1 if the connection could not be made. */
+static int
+outnet_tcp_take_into_use(struct waiting_tcp* w)
+{
+	struct outside_network* outnet = w->outnet;
+	struct pending_tcp* pend = reuse_tcp_find(outnet, &w->addr,
+		w->addrlen, w->ssl_upstream);
+	if(pend && pend->num_queries >= outnet->tcp_reuse_max) {
+		/* enough queries on it, it is closed when they are done */
+		reuse_tree_remove(pend);
+		pend = NULL;
+	}
+	if(pend && pend->num_inflight < TCP_REUSE_MAX_INFLIGHT) {
+		outnet->num_tcp_reuse++;
+		tcp_conn_add_query(pend, w);
+		return 1;
+	}
+	/* open a new connection, close the least recently used idle
+	 * connection if that is needed to get a buffer */
+	if(!outnet->tcp_free && outnet->tcp_idle_last) {
+		verbose(VERB_ALGO, "outnettcp: close idle connection for "
+			"buffer");
+		decomission_pending_tcp(outnet, outnet->tcp_idle_last);
+	}
+	if(!(pend = outnet->tcp_free))
+		return 0;
+	if(!outnet_tcp_connect(w))
+		return -1;
+	tcp_conn_add_query(pend, w);
 	return 1;
 }
 
@@ -281,13 +547,23 @@ static void
 use_free_buffer(struct outside_network* outnet)
 {
 	struct waiting_tcp* w;
-	while(outnet->tcp_free && outnet->tcp_wait_first 
-		&& !outnet->want_to_quit) {
+	int r;
+	while(outnet->tcp_wait_first && !outnet->want_to_quit) {
 		w = outnet->tcp_wait_first;
 		outnet->tcp_wait_first = w->next_waiting;
 		if(outnet->tcp_wait_last == w)
 			outnet->tcp_wait_last = NULL;
-		if(!outnet_tcp_take_into_use(w, w->pkt, w->pkt_len)) {
+		w->next_waiting = NULL;
+		r = outnet_tcp_take_into_use(w);
+		if(r == 0) {
+			/* no buffer for it, put it back at the front */
+			w->next_waiting = outnet->tcp_wait_first;
+			outnet->tcp_wait_first = w;
+			if(!outnet->tcp_wait_last)
+				outnet->tcp_wait_last = w;
+			return;
+		}
+		if(r == -1) {
 			comm_point_callback_t* cb = w->cb;
 			void* cb_arg = w->cb_arg;
 			waiting_tcp_delete(w);
@@ -297,23 +573,73 @@ use_free_buffer(struct outside_network* outnet)
 	}
 }
 
-/** decomission a tcp buffer, closes commpoint and frees waiting_tcp entry */
+/** the connection has no more queries, keep it for reuse or close it */
 static void
-decomission_pending_tcp(struct outside_network* outnet, 
-	struct pending_tcp* pend)
+tcp_conn_check_idle(struct pending_tcp* pend)
 {
-	if(pend->c->ssl) {
-#ifdef HAVE_SSL
-		SSL_shutdown(pend->c->ssl);
-		SSL_free(pend->c->ssl);
-		pend->c->ssl = NULL;
-#endif
+	struct outside_network* outnet = pend->outnet;
+	if(pend->addrlen == 0 || pend->num_inflight != 0 || pend->is_idle)
+		return;
+	if(pend->in_reuse_tree && outnet->tcp_reuse_timeout > 0 &&
+		pend->num_queries < outnet->tcp_reuse_max &&
+		!outnet->want_to_quit) {
+		tcp_idle_insert(pend);
+		return;
+	}
+	decomission_pending_tcp(outnet, pend);
+	use_free_buffer(outnet);
+}
+
+/** the tcp connection failed or closed, report error for its queries.
+ * Queries sent on a reused connection, that the server may have closed
+ * when it was idle, are tried again on a new connection. */
+static void
+tcp_conn_fail(struct pending_tcp* pend, int error)
+{
+	struct outside_network* outnet = pend->outnet;
+	int reused = (pend->num_replies > 0);
+	struct waiting_tcp* w;
+	comm_point_callback_t* cb;
+	void* cb_arg;
+	verbose(VERB_ALGO, "outnettcp: connection closed, %d queries",
+		(int)pend->num_inflight);
+	/* close it, but the buffer is not free while the callbacks run */
+	tcp_conn_close(pend);
+	while(pend->write_first || pend->inflight) {
+		w = pend->write_first?pend->write_first:pend->inflight;
+		tcp_conn_remove_query(pend, w);
+		if(!w->cb) {
+			waiting_tcp_delete(w);
+			continue;
+		}
+		if(reused && !w->requeued && error == NETEVENT_CLOSED &&
+			!outnet->want_to_quit) {
+			w->requeued = 1;
+			w->written = 0;
+			if(outnet->tcp_wait_last)
+				outnet->tcp_wait_last->next_waiting = w;
+			else	outnet->tcp_wait_first = w;
+			outnet->tcp_wait_last = w;
+			continue;
+		}
+		cb = w->cb;
+		cb_arg = w->cb_arg;
+		waiting_tcp_delete(w);
+		fptr_ok(fptr_whitelist_pending_tcp(cb));
+		(void)(*cb)(NULL, cb_arg, error, NULL);
 	}
-	comm_point_close(pend->c);
 	pend->next_free = outnet->tcp_free;
 	outnet->tcp_free = pend;
-	waiting_tcp_delete(pend->query);
-	pend->query = NULL;
+	use_free_buffer(outnet);
+}
+
+void
+outnet_tcp_idle_timeout(void* arg)
+{
+	struct pending_tcp* pend = (struct pending_tcp*)arg;
+	struct outside_network* outnet = pend->outnet;
+	verbose(VERB_ALGO, "outnettcp: close idle connection");
+	decomission_pending_tcp(outnet, pend);
 	use_free_buffer(outnet);
 }
 
@@ -322,37 +648,87 @@ outnet_tcp_cb(struct comm_point* c, void* arg, int error,
 	struct comm_reply *reply_info)
 {
 	struct pending_tcp* pend = (struct pending_tcp*)arg;
-	struct outside_network* outnet = pend->query->outnet;
+	struct outside_network* outnet = pend->outnet;
+	struct waiting_tcp* w, *prev = NULL;
+	uint16_t id;
 	verbose(VERB_ALGO, "outnettcp cb");
+	if(error == NETEVENT_PKT_WRITTEN) {
+		/* the first query is written, wait for its reply */
+		w = pend->write_first;
+		log_assert(w);
+		pend->write_first = w->next_waiting;
+		if(pend->write_last == w)
+			pend->write_last = NULL;
+		if(!w->cb) {
+			/* cancelled while it was written */
+			pend->num_inflight--;
+			waiting_tcp_delete(w);
+		} else {
+			w->written = 1;
+			w->next_waiting = pend->inflight;
+			pend->inflight = w;
+		}
+		if(pend->write_first)
+			comm_point_tcp_write_pkt(c, pend->write_first->pkt,
+				pend->write_first->pkt_len);
+		else	tcp_conn_check_idle(pend);
+		return 0;
+	}
 	if(error != NETEVENT_NOERROR) {
 		verbose(VERB_QUERY, "outnettcp got tcp error %d", error);
-		/* pass error below and exit */
-	} else {
-		/* check ID */
-		if(sldns_buffer_limit(c->buffer) < sizeof(uint16_t) ||
-			LDNS_ID_WIRE(sldns_buffer_begin(c->buffer))!=pend->id) {
-			log_addr(VERB_QUERY, 
-				"outnettcp: bad ID in reply, from:",
-				&pend->query->addr, pend->query->addrlen);
-			error = NETEVENT_CLOSED;
-		}
+		tcp_conn_fail(pend, error);
+		return 0;
 	}
-	fptr_ok(fptr_whitelist_pending_tcp(pend->query->cb));
-	(void)(*pend->query->cb)(c, pend->query->cb_arg, error, reply_info);
-	decomission_pending_tcp(outnet, pend);
+	/* find the query with the ID, replies can come in any order */
+	if(sldns_buffer_limit(c->buffer) < sizeof(uint16_t)) {
+		log_addr(VERB_QUERY, "outnettcp: short reply, from:",
+			&pend->addr, pend->addrlen);
+		tcp_conn_fail(pend, NETEVENT_CLOSED);
+		return 0;
+	}
+	id = LDNS_ID_WIRE(sldns_buffer_begin(c->buffer));
+	for(w = pend->inflight; w; prev = w, w = w->next_waiting)
+		if(w->id == id)
+			break;
+	if(!w) {
+		/* late reply for a query that timed out or was cancelled */
+		log_addr(VERB_ALGO, "outnettcp: reply with unknown ID, from:",
+			&pend->addr, pend->addrlen);
+		return 0;
+	}
+	if(prev)
+		prev->next_waiting = w->next_waiting;
+	else	pend->inflight = w->next_waiting;
+	pend->num_inflight--;
+#ifdef HAVE_SSL
+	if(pend->num_replies == 0 && c->ssl && SSL_session_reused((SSL*)c->ssl)){
+		verbose(VERB_ALGO, "outnettcp: tls session resumed");
+		outnet->num_tls_resume++;
+	}
+#endif
+	pend->num_replies++;
+	w->pend = NULL;
+	fptr_ok(fptr_whitelist_pending_tcp(w->cb));
+	(void)(*w->cb)(c, w->cb_arg, NETEVENT_NOERROR, reply_info);
+	waiting_tcp_delete(w);
+	tcp_conn_check_idle(pend);
+	use_free_buffer(outnet);
 	return 0;
 }
 
-/** lower use count on pc, see if it can be closed */
+/** see if the port has been in the pool for its lifetime */
+static int
+portcomm_expired(struct outside_network* outnet, struct port_comm* pc)
+{
+	return outnet->port_lifetime > 0 &&
+		*outnet->now_secs - pc->opened >= (time_t)outnet->port_lifetime;
+}
+
+/** close pc and put it in the unused list */
 static void
-portcomm_loweruse(struct outside_network* outnet, struct port_comm* pc)
+portcomm_close(struct outside_network* outnet, struct port_comm* pc)
 {
 	struct port_if* pif;
-	pc->num_outstanding--;
-	if(pc->num_outstanding > 0) {
-		return;
-	}
-	/* close it and replace in unused list */
 	verbose(VERB_ALGO, "close of port %d", pc->number);
 	comm_point_close(pc->cp);
 	pif = pc->pif;
@@ -365,6 +741,37 @@ portcomm_loweruse(struct outside_network* outnet, struct port_comm* pc)
 	outnet->unused_fds = pc;
 }
 
+/** lower use count on pc, see if it can be closed */
+static void
+portcomm_loweruse(struct outside_network* outnet, struct port_comm* pc)
+{
+	pc->num_outstanding--;
+	if(pc->num_outstanding > 0) {
+		return;
+	}
+	if(pc->retired) {
+		pc->retired = 0;
+		pc->pif->retired--;
+	} else if(outnet->port_pool && !portcomm_expired(outnet, pc)) {
+		/* keep it open in the pool for the next queries */
+		return;
+	}
+	portcomm_close(outnet, pc);
+}
+
+/** rotate the port out of the pool, it is closed when it is not used */
+static void
+portcomm_retire(struct outside_network* outnet, struct port_comm* pc)
+{
+	verbose(VERB_ALGO, "rotate port %d out of the pool", pc->number);
+	if(pc->num_outstanding == 0) {
+		portcomm_close(outnet, pc);
+		return;
+	}
+	pc->retired = 1;
+	pc->pif->retired++;
+}
+
 /** try to send waiting UDP queries */
 static void
 outnet_send_wait_udp(struct outside_network* outnet)
@@ -557,11 +964,19 @@ create_pending_tcp(struct outside_network* outnet, size_t bufsize)
 			return 0;
 		outnet->tcp_conns[i]->next_free = outnet->tcp_free;
 		outnet->tcp_free = outnet->tcp_conns[i];
+		outnet->tcp_conns[i]->outnet = outnet;
 		outnet->tcp_conns[i]->c = comm_point_create_tcp_out(
 			outnet->base, bufsize, outnet_tcp_cb, 
 			outnet->tcp_conns[i]);
 		if(!outnet->tcp_conns[i]->c)
 			return 0;
+		/* queries are pipelined, replies read in any order */
+		outnet->tcp_conns[i]->c->tcp_write_and_read = 1;
+		outnet->tcp_conns[i]->idle_timer = comm_timer_create_wheel(
+			outnet->base, outnet_tcp_idle_timeout,
+			outnet->tcp_conns[i]);
+		if(!outnet->tcp_conns[i]->idle_timer)
+			return 0;
 	}
 	return 1;
 }
@@ -592,7 +1007,9 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	struct ub_randstate* rnd, int use_caps_for_id, int* availports, 
 	int numavailports, size_t unwanted_threshold,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
-	void* sslctx, int delayclose, struct dt_env* dtenv)
+	void* sslctx, int delayclose, struct dt_env* dtenv,
+	int tcp_reuse_timeout, size_t tcp_reuse_max, int port_pool,
+	int port_lifetime, int hedge_budget)
 {
 	struct outside_network* outnet = (struct outside_network*)
 		calloc(1, sizeof(struct outside_network));
@@ -605,6 +1022,14 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	outnet->base = base;
 	outnet->num_tcp = num_tcp;
 	outnet->num_tcp_outgoing = 0;
+	outnet->num_tcp_reuse = 0;
+	outnet->num_tls_resume = 0;
+	outnet->tcp_reuse_timeout = tcp_reuse_timeout;
+	outnet->tcp_reuse_max = tcp_reuse_max;
+	rbtree_init(&outnet->tcp_reuse, reuse_cmp);
+	outnet->hedge_budget = hedge_budget;
+	outnet->hedge_credit = 0;
+	outnet->num_hedged = 0;
 	outnet->infra = infra;
 	outnet->rnd = rnd;
 	outnet->sslctx = sslctx;
@@ -637,6 +1062,19 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 #endif
 	calc_num46(ifs, num_ifs, do_ip4, do_ip6, 
 		&outnet->num_ip4, &outnet->num_ip6);
+	if(port_pool > 0 && outnet->num_ip4+outnet->num_ip6 > 0) {
+		/* leave half of the commpoints for the ports that are
+		 * rotated out of the pool and still have queries */
+		int max = (int)num_ports/2/(outnet->num_ip4+outnet->num_ip6);
+		if(port_pool > max) {
+			verbose(VERB_OPS, "outgoing-port-pool %d is more than "
+				"half of the outgoing-range per interface, "
+				"using %d", port_pool, max);
+			port_pool = max;
+		}
+		outnet->port_pool = port_pool;
+		outnet->port_lifetime = port_lifetime;
+	}
 	if(outnet->num_ip4 != 0) {
 		if(!(outnet->ip4_ifs = (struct port_if*)calloc(
 			(size_t)outnet->num_ip4, sizeof(struct port_if)))) {
@@ -739,6 +1177,7 @@ serviced_node_del(rbnode_t* node, void* ATTR_UNUSED(arg))
 {
 	struct serviced_query* sq = (struct serviced_query*)node;
 	struct service_callback* p = sq->cblist, *np;
+	comm_timer_delete(sq->hedge_timer);
 	free(sq->qbuf);
 	free(sq->zone);
 	while(p) {
@@ -818,9 +1257,24 @@ outside_network_delete(struct outside_network* outnet)
 		size_t i;
 		for(i=0; i<outnet->num_tcp; i++)
 			if(outnet->tcp_conns[i]) {
-				comm_point_delete(outnet->tcp_conns[i]->c);
-				waiting_tcp_delete(outnet->tcp_conns[i]->query);
-				free(outnet->tcp_conns[i]);
+				struct pending_tcp* pend = outnet->tcp_conns[i];
+				struct waiting_tcp* p, *np;
+				comm_point_delete(pend->c);
+				comm_timer_delete(pend->idle_timer);
+				for(p = pend->write_first; p; p = np) {
+					np = p->next_waiting;
+					waiting_tcp_delete(p);
+				}
+				for(p = pend->inflight; p; p = np) {
+					np = p->next_waiting;
+					waiting_tcp_delete(p);
+				}
+#ifdef HAVE_SSL
+				if(pend->ssl_session)
+					SSL_SESSION_free((SSL_SESSION*)
+						pend->ssl_session);
+#endif
+				free(pend);
 			}
 		free(outnet->tcp_conns);
 	}
@@ -948,10 +1402,50 @@ select_ifport(struct outside_network* outnet, struct pending* pend,
 	while(1) {
 		my_if = ub_random_max(outnet->rnd, num_if);
 		pif = &ifs[my_if];
+		if(outnet->port_pool &&
+			pif->inuse - pif->retired >= outnet->port_pool) {
+			/* the pool is full, use a random port of it */
+			pend->pc = pif->out[ub_random_max(outnet->rnd,
+				pif->inuse)];
+			if(!pend->pc->retired &&
+				!portcomm_expired(outnet, pend->pc)) {
+				verbose(VERB_ALGO, "using pool UDP if=%d "
+					"port=%d", my_if, pend->pc->number);
+				break;
+			}
+			if(pend->pc->retired) {
+				/* pick again */
+				pend->pc = NULL;
+				if(++tries == MAX_PORT_RETRY) {
+					log_err("failed to find an open port, "
+						"drop msg");
+					return 0;
+				}
+				continue;
+			}
+			/* replace it with a new random port */
+			portcomm_retire(outnet, pend->pc);
+			pend->pc = NULL;
+		}
 		my_port = ub_random_max(outnet->rnd, pif->avail_total);
 		if(my_port < pif->inuse) {
 			/* port already open */
 			pend->pc = pif->out[my_port];
+			if(pend->pc->retired) {
+				pend->pc = NULL;
+				if(++tries == MAX_PORT_RETRY) {
+					log_err("failed to find an open port, "
+						"drop msg");
+					return 0;
+				}
+				continue;
+			}
+			if(portcomm_expired(outnet, pend->pc)) {
+				/* rotate it out, and pick again */
+				portcomm_retire(outnet, pend->pc);
+				pend->pc = NULL;
+				continue;
+			}
 			verbose(VERB_ALGO, "using UDP if=%d port=%d", 
 				my_if, pend->pc->number);
 			break;
@@ -977,6 +1471,8 @@ select_ifport(struct outside_network* outnet, struct pending* pend,
 			pend->pc->pif = pif;
 			pend->pc->index = pif->inuse;
 			pend->pc->num_outstanding = 0;
+			pend->pc->opened = *outnet->now_secs;
+			pend->pc->retired = 0;
 			comm_point_start_listening(pend->pc->cp, fd, -1);
 
 			/* grab port in interface */
@@ -1061,8 +1557,8 @@ pending_udp_query(struct serviced_query* sq, struct sldns_buffer* packet,
 	pend->cb = cb;
 	pend->cb_arg = cb_arg;
 	pend->node.key = pend;
-	pend->timer = comm_timer_create(sq->outnet->base, pending_udp_timer_cb,
-		pend);
+	pend->timer = comm_timer_create_wheel(sq->outnet->base,
+		pending_udp_timer_cb, pend);
 	if(!pend->timer) {
 		free(pend);
 		return NULL;
@@ -1100,52 +1596,89 @@ outnet_tcptimer(void* arg)
 {
 	struct waiting_tcp* w = (struct waiting_tcp*)arg;
 	struct outside_network* outnet = w->outnet;
+	struct pending_tcp* pend = w->pend;
 	comm_point_callback_t* cb;
 	void* cb_arg;
-	if(w->pkt) {
+	if(pend && !w->written) {
+		/* the connection did not get the query written in time,
+		 * it does not work, fail the queries on it */
+		tcp_conn_fail(pend, NETEVENT_TIMEOUT);
+		return;
+	}
+	if(!pend) {
 		/* it is on the waiting list */
 		waiting_list_remove(outnet, w);
 	} else {
-		/* it was in use */
-		struct pending_tcp* pend=(struct pending_tcp*)w->next_waiting;
-		comm_point_close(pend->c);
-		pend->query = NULL;
-		pend->next_free = outnet->tcp_free;
-		outnet->tcp_free = pend;
+		/* no reply in time, send no new queries on the connection */
+		tcp_conn_remove_query(pend, w);
+		reuse_tree_remove(pend);
 	}
 	cb = w->cb;
 	cb_arg = w->cb_arg;
 	waiting_tcp_delete(w);
-	fptr_ok(fptr_whitelist_pending_tcp(cb));
-	(void)(*cb)(NULL, cb_arg, NETEVENT_TIMEOUT, NULL);
+	if(cb) {
+		fptr_ok(fptr_whitelist_pending_tcp(cb));
+		(void)(*cb)(NULL, cb_arg, NETEVENT_TIMEOUT, NULL);
+	}
+	if(pend)
+		tcp_conn_check_idle(pend);
 	use_free_buffer(outnet);
 }
 
+/** cancel tcp query, no callback is made for it */
+static void
+waiting_tcp_cancel(struct waiting_tcp* w)
+{
+	struct pending_tcp* pend = w->pend;
+	if(!pend) {
+		waiting_list_remove(w->outnet, w);
+		waiting_tcp_delete(w);
+		return;
+	}
+	if(!w->written && pend->write_first == w) {
+		/* it is being written, the stream needs the rest of it,
+		 * it is removed when written */
+		w->cb = NULL;
+		return;
+	}
+	tcp_conn_remove_query(pend, w);
+	waiting_tcp_delete(w);
+	tcp_conn_check_idle(pend);
+}
+
 struct waiting_tcp*
 pending_tcp_query(struct serviced_query* sq, sldns_buffer* packet,
 	int timeout, comm_point_callback_t* callback, void* callback_arg)
 {
-	struct pending_tcp* pend = sq->outnet->tcp_free;
 	struct waiting_tcp* w;
 	struct timeval tv;
-	uint16_t id;
-	/* if no buffer is free allocate space to store query */
+	int r;
+	/* the packet is stored with the tcp length in front of it, so
+	 * it can be written on a connection when that is possible */
 	w = (struct waiting_tcp*)malloc(sizeof(struct waiting_tcp) 
-		+ (pend?0:sldns_buffer_limit(packet)));
+		+ sizeof(uint16_t) + sldns_buffer_limit(packet));
 	if(!w) {
 		return NULL;
 	}
-	if(!(w->timer = comm_timer_create(sq->outnet->base, outnet_tcptimer, w))) {
+	if(!(w->timer = comm_timer_create_wheel(sq->outnet->base,
+		outnet_tcptimer, w))) {
 		free(w);
 		return NULL;
 	}
-	w->pkt = NULL;
-	w->pkt_len = 0;
-	id = ((unsigned)ub_random(sq->outnet->rnd)>>8) & 0xffff;
-	LDNS_ID_SET(sldns_buffer_begin(packet), id);
+	w->id = ((unsigned)ub_random(sq->outnet->rnd)>>8) & 0xffff;
+	LDNS_ID_SET(sldns_buffer_begin(packet), w->id);
+	w->pkt = (uint8_t*)w + sizeof(struct waiting_tcp);
+	w->pkt_len = sizeof(uint16_t) + sldns_buffer_limit(packet);
+	sldns_write_uint16(w->pkt, (uint16_t)sldns_buffer_limit(packet));
+	memmove(w->pkt+sizeof(uint16_t), sldns_buffer_begin(packet),
+		sldns_buffer_limit(packet));
 	memcpy(&w->addr, &sq->addr, sq->addrlen);
 	w->addrlen = sq->addrlen;
 	w->outnet = sq->outnet;
+	w->pend = NULL;
+	w->written = 0;
+	w->requeued = 0;
+	w->next_waiting = NULL;
 	w->cb = callback;
 	w->cb_arg = callback_arg;
 	w->ssl_upstream = sq->ssl_upstream;
@@ -1154,34 +1687,42 @@ pending_tcp_query(struct serviced_query* sq, sldns_buffer* packet,
 	tv.tv_usec = 0;
 #endif
 	comm_timer_set(w->timer, &tv);
-	if(pend) {
-		/* we have a buffer available right now */
-		if(!outnet_tcp_take_into_use(w, sldns_buffer_begin(packet),
-			sldns_buffer_limit(packet))) {
-			waiting_tcp_delete(w);
-			return NULL;
-		}
-#ifdef USE_DNSTAP
-		if(sq->outnet->dtenv &&
-		   (sq->outnet->dtenv->log_resolver_query_messages ||
-		    sq->outnet->dtenv->log_forwarder_query_messages))
-		dt_msg_send_outside_query(sq->outnet->dtenv, &sq->addr,
-		comm_tcp, sq->zone, sq->zonelen, packet);
-#endif
-	} else {
+	r = outnet_tcp_take_into_use(w);
+	if(r == -1) {
+		waiting_tcp_delete(w);
+		return NULL;
+	} else if(r == 0) {
 		/* queue up */
-		w->pkt = (uint8_t*)w + sizeof(struct waiting_tcp);
-		w->pkt_len = sldns_buffer_limit(packet);
-		memmove(w->pkt, sldns_buffer_begin(packet), w->pkt_len);
-		w->next_waiting = NULL;
 		if(sq->outnet->tcp_wait_last)
 			sq->outnet->tcp_wait_last->next_waiting = w;
 		else	sq->outnet->tcp_wait_first = w;
 		sq->outnet->tcp_wait_last = w;
 	}
+#ifdef USE_DNSTAP
+	if(sq->outnet->dtenv &&
+	   (sq->outnet->dtenv->log_resolver_query_messages ||
+	    sq->outnet->dtenv->log_forwarder_query_messages))
+	dt_msg_send_outside_query(sq->outnet->dtenv, &sq->addr,
+	comm_tcp, sq->zone, sq->zonelen, packet);
+#endif
 	return w;
 }
 
+void
+outnet_tcp_get_counts(struct outside_network* outnet, size_t* num_open,
+	size_t* num_idle)
+{
+	size_t i;
+	*num_open = 0;
+	*num_idle = 0;
+	for(i=0; i<outnet->num_tcp; i++) {
+		if(outnet->tcp_conns[i]->addrlen != 0)
+			(*num_open)++;
+		if(outnet->tcp_conns[i]->is_idle)
+			(*num_idle)++;
+	}
+}
+
 /** create query for serviced queries */
 static void
 serviced_gen_query(sldns_buffer* buff, uint8_t* qname, size_t qnamelen, 
@@ -1254,6 +1795,7 @@ serviced_create(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 	sq->outnet = outnet;
 	sq->cblist = NULL;
 	sq->pending = NULL;
+	sq->hedge_timer = NULL;
 	sq->status = serviced_initial;
 	sq->retry = 0;
 	sq->to_be_deleted = 0;
@@ -1306,15 +1848,7 @@ serviced_delete(struct serviced_query* sq)
 			 * mesh */
 			outnet_send_wait_udp(sq->outnet);
 		} else {
-			struct waiting_tcp* p = (struct waiting_tcp*)
-				sq->pending;
-			if(p->pkt == NULL) {
-				decomission_pending_tcp(sq->outnet, 
-					(struct pending_tcp*)p->next_waiting);
-			} else {
-				waiting_list_remove(sq->outnet, p);
-				waiting_tcp_delete(p);
-			}
+			waiting_tcp_cancel((struct waiting_tcp*)sq->pending);
 		}
 	}
 	/* does not delete from tree, caller has to do that */
@@ -1900,10 +2434,15 @@ outnet_serviced_query(struct outside_network* outnet,
 				return NULL;
 			}
 		}
+		/* every query sent adds to the budget for hedges */
+		if(outnet->hedge_budget > 0 &&
+			outnet->hedge_credit < HEDGE_CREDIT_MAX)
+			outnet->hedge_credit += outnet->hedge_budget;
 	}
 	/* add callback to list of callbacks */
 	cb->cb = callback;
 	cb->cb_arg = callback_arg;
+	cb->hedge = 0;
 	cb->next = sq->cblist;
 	sq->cblist = cb;
 	return sq;
@@ -1943,6 +2482,85 @@ void outnet_serviced_query_stop(struct serviced_query* sq, void* cb_arg)
 	}
 }
 
+void
+serviced_hedge_timeout(void* arg)
+{
+	struct serviced_query* sq = (struct serviced_query*)arg;
+	struct outside_network* outnet = sq->outnet;
+	struct service_callback* p;
+	/* the callbacks can remove themselves, and send new queries,
+	 * keep the serviced query until the list is done */
+	sq->to_be_deleted = 1;
+	for(;;) {
+		/* the list can change in the callback, start again */
+		for(p = sq->cblist; p && !p->hedge; p = p->next)
+			;
+		if(!p)
+			break;
+		p->hedge = 0;
+		if(outnet->hedge_credit < 100) {
+			verbose(VERB_ALGO, "hedge budget is used up");
+			continue;
+		}
+		outnet->hedge_credit -= 100;
+		outnet->num_hedged++;
+		verbose(VERB_ALGO, "svcd query is slow, hedge it");
+		fptr_ok(fptr_whitelist_serviced_query(p->cb));
+		(void)(*p->cb)(NULL, p->cb_arg, NETEVENT_SLOW, NULL);
+	}
+	sq->to_be_deleted = 0;
+	if(!sq->cblist) {
+#ifdef UNBOUND_DEBUG
+		rbnode_t* rem =
+#else
+		(void)
+#endif
+		rbtree_delete(outnet->serviced, sq);
+		log_assert(rem); /* should be present */
+		serviced_delete(sq);
+	}
+}
+
+void
+outnet_serviced_query_hedge(struct serviced_query* sq, void* cb_arg)
+{
+	struct service_callback* p;
+	struct rtt_info rtt;
+	struct timeval tv;
+	int delay, tA, tAAAA, tother, msec;
+	if(!sq || sq->outnet->hedge_budget <= 0)
+		return;
+	for(p = sq->cblist; p; p = p->next)
+		if(p->cb_arg == cb_arg)
+			break;
+	if(!p)
+		return;
+	if(!sq->hedge_timer) {
+		sq->hedge_timer = comm_timer_create_wheel(sq->outnet->base,
+			serviced_hedge_timeout, sq);
+		if(!sq->hedge_timer)
+			return;
+	}
+	p->hedge = 1;
+	/* a timer that is set already, is for the same server and is
+	 * not later than this one */
+	if(comm_timer_is_set(sq->hedge_timer))
+		return;
+	/* most replies of the server are faster than the smoothed rtt
+	 * with twice the deviation, that is before the retransmit */
+	rtt_init(&rtt);
+	if(infra_get_host_rto(sq->outnet->infra, &sq->addr, sq->addrlen,
+		sq->zone, sq->zonelen, &rtt, &delay, *sq->outnet->now_secs,
+		&tA, &tAAAA, &tother) < 0)
+		rtt_init(&rtt);
+	msec = rtt.srtt + 2*rtt.rttvar;
+	if(msec < HEDGE_MIN_DELAY)
+		msec = HEDGE_MIN_DELAY;
+	tv.tv_sec = msec/1000;
+	tv.tv_usec = (msec%1000)*1000;
+	comm_timer_set(sq->hedge_timer, &tv);
+}
+
 /** get memory used by waiting tcp entry (in use or not) */
 static size_t
 waiting_tcp_get_mem(struct waiting_tcp* w)
@@ -2005,8 +2623,11 @@ size_t outnet_get_mem(struct outside_network* outnet)
 	for(i=0; i<outnet->num_tcp; i++) {
 		s += sizeof(struct pending_tcp);
 		s += comm_point_get_mem(outnet->tcp_conns[i]->c);
-		if(outnet->tcp_conns[i]->query)
-			s += waiting_tcp_get_mem(outnet->tcp_conns[i]->query);
+		s += comm_timer_get_mem(outnet->tcp_conns[i]->idle_timer);
+		for(w=outnet->tcp_conns[i]->write_first; w; w=w->next_waiting)
+			s += waiting_tcp_get_mem(w);
+		for(w=outnet->tcp_conns[i]->inflight; w; w=w->next_waiting)
+			s += waiting_tcp_get_mem(w);
 	}
 	for(w=outnet->tcp_wait_first; w; w = w->next_waiting)
 		s += waiting_tcp_get_mem(w);
@@ -2031,6 +2652,8 @@ serviced_get_mem(struct serviced_query* sq)
 	s = sizeof(*sq) + sq->qbuflen;
 	for(sb = sq->cblist; sb; sb = sb->next)
 		s += sizeof(*sb);
+	if(sq->hedge_timer)
+		s += comm_timer_get_mem(sq->hedge_timer);
 	if(sq->status == serviced_query_UDP_EDNS ||
 		sq->status == serviced_query_UDP ||
 		sq->status == serviced_query_PROBE_EDNS ||
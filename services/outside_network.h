@@ -102,6 +102,19 @@ struct outside_network {
 	int delayclose;
 	/** timeout for delayclose */
 	struct timeval delay_tv;
+	/** number of udp ports kept open per interface for the queries,
+	 * 0 if every query opens a port, that is closed after use */
+	int port_pool;
+	/** seconds that a port in the pool is used for new queries */
+	int port_lifetime;
+	/** percentage of the queries that may get a hedge, a second query
+	 * to another server when the first one is slow. 0 is off. */
+	int hedge_budget;
+	/** credit for hedges, in percent of a query, every new query adds
+	 * the hedge_budget, every hedge takes off 100. */
+	int hedge_credit;
+	/** number of hedges that were allowed (for statistics) */
+	size_t num_hedged;
 
 	/** array of outgoing IP4 interfaces */
 	struct port_if* ip4_ifs;
@@ -142,14 +155,34 @@ struct outside_network {
 	struct pending_tcp **tcp_conns;
 	/** number of tcp communication points. */
 	size_t num_tcp;
-	/** number of tcp communication points in use. */
+	/** number of queries sent over tcp (for statistics) */
 	size_t num_tcp_outgoing;
+	/** number of tcp queries sent on an already open connection
+	 * (for statistics) */
+	size_t num_tcp_reuse;
+	/** number of tls connections that resumed a session (statistics) */
+	size_t num_tls_resume;
 	/** list of tcp comm points that are free for use */
 	struct pending_tcp* tcp_free;
 	/** list of tcp queries waiting for a buffer */
 	struct waiting_tcp* tcp_wait_first;
 	/** last of waiting query list */
 	struct waiting_tcp* tcp_wait_last;
+	/** open tcp connections that new queries to that destination are
+	 * sent on, one per destination. Sorted by addr and ssl, the key
+	 * is the pending_tcp. */
+	rbtree_t tcp_reuse;
+	/** idle open tcp connections, most recently used first. These are
+	 * closed when the idle timeout expires, or when their buffer is
+	 * needed for another destination. */
+	struct pending_tcp* tcp_idle_first;
+	/** least recently used idle tcp connection */
+	struct pending_tcp* tcp_idle_last;
+	/** timeout for idle tcp connections, in msec. If 0, connections
+	 * are closed when they have no more queries. */
+	int tcp_reuse_timeout;
+	/** max number of queries sent on one tcp connection */
+	size_t tcp_reuse_max;
 };
 
 /**
@@ -175,6 +208,9 @@ struct port_if {
 	int maxout;
 	/** number of commpoints (and thus also ports) in use */
 	int inuse;
+	/** number of the ports in use that are rotated out of the pool,
+	 * and are closed when their outstanding queries are done */
+	int retired;
 };
 
 /**
@@ -191,6 +227,10 @@ struct port_comm {
 	int index;
 	/** number of outstanding queries on this port */
 	int num_outstanding;
+	/** time the port was opened, for the rotation of the pool */
+	time_t opened;
+	/** if the port is rotated out of the pool, no new queries */
+	int retired;
 	/** UDP commpoint, fd=-1 if not in use */
 	struct comm_point* cp;
 };
@@ -234,26 +274,67 @@ struct pending {
 };
 
 /**
- * Pending TCP query to server.
+ * Outgoing TCP connection to a server, with the queries that are
+ * pipelined on it. Replies can arrive in any order, they are matched by ID.
  */
 struct pending_tcp {
+	/** rbtree node in the tcp_reuse tree of the outnet, key is this
+	 * structure. Must be first member. */
+	rbnode_t node;
+	/** if the connection is in the tcp_reuse tree */
+	int in_reuse_tree;
 	/** next in list of free tcp comm points, or NULL. */
 	struct pending_tcp* next_free;
-	/** the ID for the query; checked in reply */
-	uint16_t id;
 	/** tcp comm point it was sent on (and reply must come back on). */
 	struct comm_point* c;
-	/** the query being serviced, NULL if the pending_tcp is unused. */
-	struct waiting_tcp* query;
+	/** the outside network it is part of */
+	struct outside_network* outnet;
+	/** remote address of the connection */
+	struct sockaddr_storage addr;
+	/** length of addr field in use, 0 if the pending_tcp is unused. */
+	socklen_t addrlen;
+	/** if the connection uses ssl */
+	int ssl_upstream;
+	/** queries that are written and wait for their reply, in any order.
+	 * linked with next_waiting. */
+	struct waiting_tcp* inflight;
+	/** number of queries on the connection, in the write and inflight
+	 * lists */
+	size_t num_inflight;
+	/** queries to write on the connection, the first is being written.
+	 * linked with next_waiting. */
+	struct waiting_tcp* write_first;
+	/** last query in the write list */
+	struct waiting_tcp* write_last;
+	/** number of queries sent on this connection */
+	size_t num_queries;
+	/** number of replies received on this connection */
+	size_t num_replies;
+	/** if the connection is idle, in the outnet idle list */
+	int is_idle;
+	/** previous in idle list, more recently used */
+	struct pending_tcp* idle_prev;
+	/** next in idle list, less recently used */
+	struct pending_tcp* idle_next;
+	/** timer that closes the connection when it has been idle */
+	struct comm_timer* idle_timer;
+	/** ssl session of the last tls connection closed with this buffer,
+	 * that can be resumed by a new connection to that server. */
+	void* ssl_session;
+	/** the server that ssl_session is for */
+	struct sockaddr_storage ssl_session_addr;
+	/** length of ssl_session_addr */
+	socklen_t ssl_session_addrlen;
 };
 
 /**
- * Query waiting for TCP buffer.
+ * Query waiting for TCP buffer, waiting to be written on a connection,
+ * or waiting for its reply.
  */
 struct waiting_tcp {
 	/** 
-	 * next in waiting list.
-	 * if pkt==0, this points to the pending_tcp structure.
+	 * next in waiting list of the outnet, or in the write list or
+	 * inflight list of the connection.
 	 */
 	struct waiting_tcp* next_waiting;
 	/** timeout event; timer keeps running whether the query is
@@ -261,20 +342,29 @@ struct waiting_tcp {
 	struct comm_timer* timer;
 	/** the outside network it is part of */
 	struct outside_network* outnet;
+	/** the connection the query is on, NULL if on the waiting list */
+	struct pending_tcp* pend;
+	/** if the query is written and is in the inflight list of pend */
+	int written;
+	/** if the query was moved back to the waiting list, because the
+	 * reused connection it was on closed. */
+	int requeued;
 	/** remote address. */
 	struct sockaddr_storage addr;
 	/** length of addr field in use. */
 	socklen_t addrlen;
 	/** 
-	 * The query itself, the query packet to send.
+	 * The query itself, the query packet to send, with the two byte
+	 * tcp length in front of it.
 	 * allocated after the waiting_tcp structure.
-	 * set to NULL when the query is serviced and it part of pending_tcp.
-	 * if this is NULL, the next_waiting points to the pending_tcp.
 	 */
 	uint8_t* pkt;
-	/** length of query packet. */
+	/** length of query packet, with the tcp length bytes. */
 	size_t pkt_len;
-	/** callback for the timeout, error or reply to the message */
+	/** the ID of the query on the connection */
+	uint16_t id;
+	/** callback for the timeout, error or reply to the message.
+	 * NULL if the query was cancelled, but is still being written. */
 	comm_point_callback_t* cb;
 	/** callback user argument */
 	void* cb_arg;
@@ -292,8 +382,16 @@ struct service_callback {
 	comm_point_callback_t* cb;
 	/** user argument for callback function */
 	void* cb_arg;
+	/** if the caller wants a NETEVENT_SLOW callback when the hedge
+	 * timer of the serviced query fires */
+	int hedge;
 };
 
+/** the burst of hedges the budget allows, in percent of a query */
+#define HEDGE_CREDIT_MAX 1000
+/** minimum delay before a hedge, in msec */
+#define HEDGE_MIN_DELAY 10
+
 /** fallback size for fragmentation for EDNS in IPv4 */
 #define EDNS_FRAG_SIZE_IP4 1472
 /** fallback size for EDNS in IPv6, fits one fragment with ip6-tunnel-ids */
@@ -371,6 +469,8 @@ struct serviced_query {
 	struct service_callback* cblist;
 	/** the UDP or TCP query that is pending, see status which */
 	void* pending;
+	/** timer for the callers that want to hedge a slow query, or NULL */
+	struct comm_timer* hedge_timer;
 };
 
 /**
@@ -397,6 +497,13 @@ struct serviced_query {
  * @param delayclose: if not 0, udp sockets are delayed before timeout closure.
  * 	msec to wait on timeouted udp sockets.
  * @param dtenv: environment to send dnstap events with (if enabled).
+ * @param tcp_reuse_timeout: msec idle tcp connections are kept open for
+ *	reuse, 0 closes them when no queries are left.
+ * @param tcp_reuse_max: max number of queries sent on one tcp connection.
+ * @param port_pool: number of udp ports kept open per interface, 0 to
+ *	open a port for every query.
+ * @param port_lifetime: seconds a port in the pool is used.
+ * @param hedge_budget: percentage of queries that can get a hedge query.
  * @return: the new structure (with no pending answers) or NULL on error.
  */
 struct outside_network* outside_network_create(struct comm_base* base,
@@ -405,7 +512,9 @@ struct outside_network* outside_network_create(struct comm_base* base,
 	struct ub_randstate* rnd, int use_caps_for_id, int* availports, 
 	int numavailports, size_t unwanted_threshold,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
-	void* sslctx, int delayclose, struct dt_env *dtenv);
+	void* sslctx, int delayclose, struct dt_env *dtenv,
+	int tcp_reuse_timeout, size_t tcp_reuse_max, int port_pool,
+	int port_lifetime, int hedge_budget);
 
 /**
  * Delete outside_network structure.
@@ -434,8 +543,9 @@ struct pending* pending_udp_query(struct serviced_query* sq,
 	void* callback_arg);
 
 /**
- * Send TCP query. May wait for TCP buffer. Selects ID to be random, and 
- * checks id.
+ * Send TCP query. Uses an open connection to the server if there is one,
+ * the query is pipelined on it. May wait for TCP buffer. Selects ID to
+ * be random, and unique on the connection.
  * @param sq: serviced query.
  * @param packet: wireformat query to send to destination. copied from.
  * @param timeout: in seconds from now.
@@ -503,6 +613,18 @@ struct serviced_query* outnet_serviced_query(struct outside_network* outnet,
  */
 void outnet_serviced_query_stop(struct serviced_query* sq, void* cb_arg);
 
+/**
+ * Ask for a hedge on a serviced query. If there is no answer after a delay
+ * that follows the rtt of the server, the callback is called with
+ * NETEVENT_SLOW, and the query continues. The caller can then send the
+ * query to another server as well. The callback is only made if the
+ * hedge budget allows for another query.
+ * @param sq: serviced query.
+ * @param cb_arg: callback argument of the caller that wants the hedge.
+ *	same as the callback_arg to outnet_serviced_query().
+ */
+void outnet_serviced_query_hedge(struct serviced_query* sq, void* cb_arg);
+
 /**
  * Get memory size in use by outside network.
  * Counts buffers and outstanding query (serviced queries) malloced data.
@@ -551,4 +673,22 @@ int pending_cmp(const void* key1, const void* key2);
 /** compare function of serviced query rbtree */
 int serviced_cmp(const void* key1, const void* key2);
 
+/** compare function of tcp reuse rbtree */
+int reuse_cmp(const void* key1, const void* key2);
+
+/** callback for idle tcp connection timeout */
+void outnet_tcp_idle_timeout(void* arg);
+
+/** callback for the hedge timer of a serviced query */
+void serviced_hedge_timeout(void* arg);
+
+/**
+ * Get number of open and idle outgoing tcp connections.
+ * @param outnet: outside network.
+ * @param num_open: returns number of open connections.
+ * @param num_idle: returns number of those that are idle.
+ */
+void outnet_tcp_get_counts(struct outside_network* outnet, size_t* num_open,
+	size_t* num_idle);
+
 #endif /* OUTSIDE_NETWORK_H */
@@ -141,6 +141,7 @@ repevt_string(enum replay_event_type t)
 	case repevt_assign:	 return "ASSIGN";
 	case repevt_traffic:	 return "TRAFFIC";
 	case repevt_infra_rtt:	 return "INFRA_RTT";
+	case repevt_slow:	 return "SLOW";
 	default:		 return "UNKNOWN";
 	}
 }
@@ -425,6 +426,12 @@ fake_pending_callback(struct replay_runtime* runtime,
 	comm_point_callback_t* cb;
 
 	memset(&c, 0, sizeof(c));
+	/* with an address, it is for the query sent to that address */
+	if(todo->addrlen != 0) {
+		while(p && sockaddr_cmp(&p->addr, p->addrlen, &todo->addr,
+			todo->addrlen) != 0)
+			p = p->next;
+	}
 	if(!p) fatal_exit("No pending queries.");
 	cb_arg = p->cb_arg;
 	cb = p->callback;
@@ -448,6 +455,24 @@ fake_pending_callback(struct replay_runtime* runtime,
 	sldns_buffer_free(c.buffer);
 }
 
+/**
+ * The pending query that asked for a hedge is slow, do the callback for
+ * it.  The query stays pending, the reply can still arrive.
+ */
+static void
+fake_pending_slow(struct replay_runtime* runtime)
+{
+	struct fake_pending* p = runtime->pending_list;
+	while(p && !p->hedge)
+		p = p->next;
+	if(!p) fatal_exit("No pending query that asked for a hedge.");
+	p->hedge = 0;
+	log_addr(0, "slow query to", &p->addr, p->addrlen);
+	if((*p->callback)(NULL, p->cb_arg, NETEVENT_SLOW, NULL)) {
+		fatal_exit("unexpected: pending callback returned 1");
+	}
+}
+
 /** pass time */
 static void
 moment_assign(struct replay_runtime* runtime, struct replay_moment* mom)
@@ -651,6 +676,10 @@ do_moment_and_advance(struct replay_runtime* runtime)
 		advance_moment(runtime);
 		fake_pending_callback(runtime, mom, NETEVENT_CLOSED);
 		break;
+	case repevt_slow:
+		advance_moment(runtime);
+		fake_pending_slow(runtime);
+		break;
 	case repevt_time_passes:
 		time_passes(runtime, runtime->now);
 		advance_moment(runtime);
@@ -734,7 +763,7 @@ run_scenario(struct replay_runtime* runtime)
 struct listen_dnsport* 
 listen_create(struct comm_base* base, struct listen_port* ATTR_UNUSED(ports),
 	size_t bufsize, int ATTR_UNUSED(tcp_accept_count),
-	void* ATTR_UNUSED(sslctx), struct dt_env* ATTR_UNUSED(dtenv),
+	int ATTR_UNUSED(tcp_pipeline), void* ATTR_UNUSED(sslctx), struct dt_env* ATTR_UNUSED(dtenv),
 	comm_point_callback_t* cb, void* cb_arg)
 {
 	struct replay_runtime* runtime = (struct replay_runtime*)base;
@@ -902,7 +931,10 @@ outside_network_create(struct comm_base* base, size_t bufsize,
 	int ATTR_UNUSED(numavailports), size_t ATTR_UNUSED(unwanted_threshold),
 	void (*unwanted_action)(void*), void* ATTR_UNUSED(unwanted_param),
 	int ATTR_UNUSED(do_udp), void* ATTR_UNUSED(sslctx),
-	int ATTR_UNUSED(delayclose), struct dt_env* ATTR_UNUSED(dtenv))
+	int ATTR_UNUSED(delayclose), struct dt_env* ATTR_UNUSED(dtenv),
+	int ATTR_UNUSED(tcp_reuse_timeout), size_t ATTR_UNUSED(tcp_reuse_max),
+	int ATTR_UNUSED(port_pool), int ATTR_UNUSED(port_lifetime),
+	int ATTR_UNUSED(hedge_budget))
 {
 	struct replay_runtime* runtime = (struct replay_runtime*)base;
 	struct outside_network* outnet =  calloc(1, 
@@ -1144,6 +1176,14 @@ void outnet_serviced_query_stop(struct serviced_query* sq, void* cb_arg)
 	log_info("double delete of pending serviced query");
 }
 
+void outnet_serviced_query_hedge(struct serviced_query* sq,
+	void* ATTR_UNUSED(cb_arg))
+{
+	/* replays have no timer for the hedge, the SLOW step makes the
+	 * query slow */
+	((struct fake_pending*)sq)->hedge = 1;
+}
+
 struct listen_port* listening_ports_open(struct config_file* ATTR_UNUSED(cfg),
 	int* ATTR_UNUSED(reuseport))
 {
@@ -1155,6 +1195,18 @@ void listening_ports_free(struct listen_port* list)
 	free(list);
 }
 
+void listening_ports_incoming_cpu(struct listen_port* ATTR_UNUSED(list),
+	int ATTR_UNUSED(cpu))
+{
+}
+
+int listening_ports_reuseport_bpf(struct listen_port* ATTR_UNUSED(list),
+	int* ATTR_UNUSED(cpus), int ATTR_UNUSED(num_cpus),
+	int ATTR_UNUSED(num_threads))
+{
+	return 1;
+}
+
 struct comm_point* comm_point_create_local(struct comm_base* ATTR_UNUSED(base),
         int ATTR_UNUSED(fd), size_t ATTR_UNUSED(bufsize),
         comm_point_callback_t* ATTR_UNUSED(callback), 
@@ -1241,6 +1293,23 @@ void outnet_tcptimer(void* ATTR_UNUSED(arg))
 	log_assert(0);
 }
 
+void outnet_tcp_idle_timeout(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
+void serviced_hedge_timeout(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
+void outnet_tcp_get_counts(struct outside_network* ATTR_UNUSED(outnet),
+	size_t* num_open, size_t* num_idle)
+{
+	*num_open = 0;
+	*num_idle = 0;
+}
+
 void comm_point_udp_callback(int ATTR_UNUSED(fd), short ATTR_UNUSED(event), 
 	void* ATTR_UNUSED(arg))
 {
@@ -1271,6 +1340,12 @@ void comm_timer_callback(int ATTR_UNUSED(fd),
 	log_assert(0);
 }
 
+void comm_wheel_callback(int ATTR_UNUSED(fd), 
+	short ATTR_UNUSED(event), void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void comm_signal_callback(int ATTR_UNUSED(fd), 
 	short ATTR_UNUSED(event), void* ATTR_UNUSED(arg))
 {
@@ -1295,6 +1370,11 @@ void comm_base_handle_slow_accept(int ATTR_UNUSED(fd),
 	log_assert(0);
 }
 
+void comm_point_tcp_accept_retry(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 int serviced_udp_callback(struct comm_point* ATTR_UNUSED(c), 
 	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
         struct comm_reply* ATTR_UNUSED(reply_info))
@@ -1323,6 +1403,12 @@ int serviced_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
 	return 0;
 }
 
+int reuse_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
+{
+	log_assert(0);
+	return 0;
+}
+
 /* timers in testbound for autotrust. statistics tested in tpkg. */
 struct comm_timer* comm_timer_create(struct comm_base* base, 
 	void (*cb)(void*), void* cb_arg)
@@ -1338,6 +1424,12 @@ struct comm_timer* comm_timer_create(struct comm_base* base,
 	return (struct comm_timer*)t;
 }
 
+struct comm_timer* comm_timer_create_wheel(struct comm_base* base, 
+	void (*cb)(void*), void* cb_arg)
+{
+	return comm_timer_create(base, cb, cb_arg);
+}
+
 void comm_timer_disable(struct comm_timer* timer)
 {
 	struct fake_timer* t = (struct fake_timer*)timer;
@@ -1386,6 +1478,13 @@ void comm_base_set_slow_accept_handlers(struct comm_base* ATTR_UNUSED(b),
 	(void)start_acc;
 }
 
+int comm_base_set_udp_batch(struct comm_base* ATTR_UNUSED(b),
+	int ATTR_UNUSED(num), size_t ATTR_UNUSED(bufsize))
+{
+	/* testbound answers one query at a time */
+	return 1;
+}
+
 struct event_base* comm_base_internal(struct comm_base* ATTR_UNUSED(b))
 {
 	/* no pipe comm possible in testbound */
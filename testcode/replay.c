@@ -325,6 +325,8 @@ replay_moment_read(char* remain, FILE* in, const char* name,
 		read_file_content(in, &pstate->lineno, mom);
 	} else if(parse_keyword(&remain, "ERROR")) {
 		mom->evt_type = repevt_error;
+	} else if(parse_keyword(&remain, "SLOW")) {
+		mom->evt_type = repevt_slow;
 	} else if(parse_keyword(&remain, "TRAFFIC")) {
 		mom->evt_type = repevt_traffic;
 	} else if(parse_keyword(&remain, "ASSIGN")) {
@@ -65,7 +65,8 @@
  *	o QUERY - followed by entry
  *	o CHECK_ANSWER - followed by entry
  *	o CHECK_OUT_QUERY - followed by entry (if copy-id it is also reply).
- *	o REPLY - followed by entry
+ *	o REPLY - followed by entry, with ADDRESS it is the reply for the
+ *		query to that address, otherwise for the last query.
  *      o TIMEOUT
  *      o TIME_PASSES ELAPSE [seconds] - increase 'now' time counter, can be 
  *      			a floating point number.
@@ -77,6 +78,8 @@
  *      	The file contents is macro expanded before match.
  *      o INFRA_RTT [ip] [dp] [rtt] - update infra cache entry with rtt.
  *      o ERROR
+ *      o SLOW - the outbound query that asked for a hedge is slow, the
+ *      	resolver can send a hedge query.  It stays pending.
  * ; following entry starts on the next line, ENTRY_BEGIN.
  * ; more STEP items
  * SCENARIO_END
@@ -202,7 +205,9 @@ struct replay_moment {
 		/** store infra rtt cache entry: addr and string (int) */
 		repevt_infra_rtt,
 		/** cause traffic to flow */
-		repevt_traffic
+		repevt_traffic,
+		/** the outbound query that asked for a hedge is slow */
+		repevt_slow
 	}
 		/** variable with what is to happen this moment */
 		evt_type;
@@ -340,6 +345,8 @@ struct fake_pending {
 	enum transport_type transport;
 	/** if this is a serviced query */
 	int serviced;
+	/** if the caller asked for a hedge when the query is slow */
+	int hedge;
 	/** the runtime structure this is part of */
 	struct replay_runtime* runtime;
 };
@@ -0,0 +1,409 @@
+/*
+ * testcode/unitcachesnap.c - unit test for the cache snapshot.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * \file
+ * Calls the cache snapshot unit tests. Exits with code 1 on a failure.
+ * The caches are written to a snapshot file and loaded into new caches,
+ * and truncated and damaged files are loaded.
+ */
+
+#include "config.h"
+#include "util/log.h"
+#include "testcode/unitmain.h"
+#include "daemon/cachesnap.h"
+#include "daemon/daemon.h"
+#include "services/cache/dns.h"
+#include "services/cache/rrset.h"
+#include "services/cache/infra.h"
+#include "util/module.h"
+#include "util/data/msgreply.h"
+#include "util/data/packed_rrset.h"
+#include "util/storage/slabhash.h"
+#include "util/config_file.h"
+#include "util/regional.h"
+#include "util/net_help.h"
+#include "util/alloc.h"
+#include "sldns/sbuffer.h"
+#include "sldns/str2wire.h"
+#include "sldns/pkthdr.h"
+#include "sldns/rrdef.h"
+
+/** number of messages in the test caches */
+#define SNAP_TEST_NUM 20
+/** TTL of the test messages */
+#define SNAP_TEST_TTL 3600
+
+/** the time for the caches */
+static time_t snap_test_now;
+
+/** create a daemon with the caches, the parts that the snapshot uses */
+static struct daemon*
+snap_daemon_create(struct config_file* cfg)
+{
+	struct daemon* d = (struct daemon*)calloc(1, sizeof(*d));
+	unit_assert(d);
+	d->cfg = cfg;
+	alloc_init(&d->superalloc, NULL, 0);
+	d->env = (struct module_env*)calloc(1, sizeof(*d->env));
+	unit_assert(d->env);
+	d->env->cfg = cfg;
+	d->env->now = &snap_test_now;
+	d->env->alloc = (struct alloc_cache*)calloc(1,
+		sizeof(struct alloc_cache));
+	unit_assert(d->env->alloc);
+	alloc_init(d->env->alloc, &d->superalloc, 1);
+	d->env->rrset_cache = rrset_cache_create(cfg, &d->superalloc);
+	d->env->msg_cache = slabhash_create(cfg->msg_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
+		msgreply_sizefunc, query_info_compare, query_entry_delete,
+		reply_info_delete, NULL);
+	d->env->infra_cache = infra_create(cfg);
+	unit_assert(d->env->rrset_cache && d->env->msg_cache &&
+		d->env->infra_cache);
+	return d;
+}
+
+/** delete the test daemon */
+static void
+snap_daemon_delete(struct daemon* d)
+{
+	slabhash_delete(d->env->msg_cache);
+	rrset_cache_delete(d->env->rrset_cache);
+	infra_delete(d->env->infra_cache);
+	alloc_clear(d->env->alloc);
+	free(d->env->alloc);
+	free(d->env);
+	alloc_clear(&d->superalloc);
+	free(d);
+}
+
+/** empty the caches of the test daemon */
+static void
+snap_daemon_clear(struct daemon* d)
+{
+	slabhash_clear(d->env->msg_cache);
+	slabhash_clear(&d->env->rrset_cache->table);
+	slabhash_clear(d->env->infra_cache->hosts);
+}
+
+/** number of entries in the hash table */
+static size_t
+snap_count(struct slabhash* sh)
+{
+	size_t i, n = 0;
+	for(i=0; i<sh->size; i++) {
+		lock_quick_lock(&sh->array[i]->lock);
+		n += sh->array[i]->num;
+		lock_quick_unlock(&sh->array[i]->lock);
+	}
+	return n;
+}
+
+/** the name of the test message */
+static void
+snap_name(int i, char* buf, size_t len)
+{
+	snprintf(buf, len, "w%d.example.com.", i);
+}
+
+/** the address of the test server */
+static void
+snap_addr(int i, struct sockaddr_storage* addr, socklen_t* len)
+{
+	char buf[32];
+	snprintf(buf, sizeof(buf), "192.0.2.%d", i+1);
+	unit_assert(ipstrtoaddr(buf, 53, addr, len));
+}
+
+/** put a domain name in the packet */
+static void
+snap_put_dname(sldns_buffer* pkt, const char* str)
+{
+	size_t len = 0;
+	uint8_t* nm = sldns_str2wire_dname(str, &len);
+	unit_assert(nm);
+	sldns_buffer_write(pkt, nm, len);
+	free(nm);
+}
+
+/** make the answer packet for the test message */
+static void
+snap_make_pkt(sldns_buffer* pkt, int i)
+{
+	char name[64];
+	snap_name(i, name, sizeof(name));
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, 0); /* id */
+	sldns_buffer_write_u16(pkt, BIT_QR|BIT_RD|BIT_RA);
+	sldns_buffer_write_u16(pkt, 1); /* qdcount */
+	sldns_buffer_write_u16(pkt, 1); /* ancount */
+	sldns_buffer_write_u16(pkt, 1); /* nscount */
+	sldns_buffer_write_u16(pkt, 0); /* arcount */
+	snap_put_dname(pkt, name);
+	sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_A);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	/* answer: name A 192.0.2.i */
+	snap_put_dname(pkt, name);
+	sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_A);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	sldns_buffer_write_u32(pkt, SNAP_TEST_TTL);
+	sldns_buffer_write_u16(pkt, 4);
+	sldns_buffer_write_u8(pkt, 192);
+	sldns_buffer_write_u8(pkt, 0);
+	sldns_buffer_write_u8(pkt, 2);
+	sldns_buffer_write_u8(pkt, (uint8_t)i);
+	/* authority: example.com. NS ns.example.com. */
+	snap_put_dname(pkt, "example.com.");
+	sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_NS);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	sldns_buffer_write_u32(pkt, SNAP_TEST_TTL);
+	sldns_buffer_write_u16(pkt, 16);
+	snap_put_dname(pkt, "ns.example.com.");
+	sldns_buffer_flip(pkt);
+}
+
+/** fill the caches with the test messages and hosts */
+static void
+snap_fill(struct daemon* d)
+{
+	struct regional* region = regional_create();
+	sldns_buffer* pkt = sldns_buffer_new(512);
+	struct query_info qinfo;
+	struct reply_info* rep;
+	struct edns_data edns;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	uint8_t zone[] = "\007example\003com";
+	int i, vs, to;
+	uint8_t lame;
+	unit_assert(region && pkt);
+	for(i=0; i<SNAP_TEST_NUM; i++) {
+		snap_make_pkt(pkt, i);
+		unit_assert(reply_info_parse(pkt, d->env->alloc, &qinfo, &rep,
+			region, &edns) == 0);
+		unit_assert(dns_cache_store(d->env, &qinfo, rep, 0, 0, 0,
+			NULL, 0));
+		query_info_clear(&qinfo);
+		reply_info_parsedelete(rep, d->env->alloc);
+		regional_free_all(region);
+
+		snap_addr(i, &addr, &addrlen);
+		unit_assert(infra_host(d->env->infra_cache, &addr, addrlen,
+			zone, sizeof(zone), snap_test_now, &vs, &lame, &to));
+		unit_assert(infra_rtt_update(d->env->infra_cache, &addr,
+			addrlen, zone, sizeof(zone), LDNS_RR_TYPE_A, 10+i, to,
+			snap_test_now));
+	}
+	sldns_buffer_free(pkt);
+	regional_destroy(region);
+}
+
+/** check that the caches have the test messages and hosts */
+static void
+snap_check(struct daemon* d, struct daemon* orig)
+{
+	struct regional* region = regional_create();
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	uint8_t zone[] = "\007example\003com";
+	char name[64];
+	int i;
+	unit_assert(region);
+	for(i=0; i<SNAP_TEST_NUM; i++) {
+		struct dns_msg* msg;
+		struct packed_rrset_data* data;
+		struct rtt_info rtt, ortt;
+		int delay, tA, tAAAA, tother;
+		size_t len = 0;
+		uint8_t* qname;
+		snap_name(i, name, sizeof(name));
+		qname = sldns_str2wire_dname(name, &len);
+		unit_assert(qname);
+		msg = dns_cache_lookup(d->env, qname, len, LDNS_RR_TYPE_A,
+			LDNS_RR_CLASS_IN, 0, region, region);
+		free(qname);
+		unit_assert(msg && msg->rep->an_numrrsets == 1 &&
+			msg->rep->ns_numrrsets == 1);
+		data = (struct packed_rrset_data*)msg->rep->rrsets[0]->
+			entry.data;
+		unit_assert(data->count == 1 && data->rr_len[0] == 6);
+		unit_assert(data->rr_data[0][5] == (uint8_t)i);
+		/* the TTLs keep counting down from the snapshot */
+		unit_assert(data->ttl <= SNAP_TEST_TTL &&
+			data->ttl + 10 >= SNAP_TEST_TTL);
+		regional_free_all(region);
+
+		snap_addr(i, &addr, &addrlen);
+		unit_assert(infra_get_host_rto(d->env->infra_cache, &addr,
+			addrlen, zone, sizeof(zone), &rtt, &delay,
+			snap_test_now, &tA, &tAAAA, &tother) > 0);
+		unit_assert(infra_get_host_rto(orig->env->infra_cache, &addr,
+			addrlen, zone, sizeof(zone), &ortt, &delay,
+			snap_test_now, &tA, &tAAAA, &tother) > 0);
+		unit_assert(rtt.srtt == ortt.srtt && rtt.rttvar == ortt.rttvar
+			&& rtt.rto == ortt.rto);
+	}
+	unit_assert(snap_count(d->env->msg_cache) ==
+		snap_count(orig->env->msg_cache));
+	unit_assert(snap_count(&d->env->rrset_cache->table) ==
+		snap_count(&orig->env->rrset_cache->table));
+	unit_assert(snap_count(d->env->infra_cache->hosts) ==
+		snap_count(orig->env->infra_cache->hosts));
+	regional_destroy(region);
+}
+
+/** read the file into memory */
+static uint8_t*
+snap_read_file(const char* fname, size_t* len)
+{
+	FILE* in = fopen(fname, "rb");
+	uint8_t* data;
+	long sz;
+	unit_assert(in);
+	unit_assert(fseek(in, 0, SEEK_END) == 0);
+	sz = ftell(in);
+	unit_assert(sz > 0);
+	rewind(in);
+	data = (uint8_t*)malloc((size_t)sz);
+	unit_assert(data);
+	unit_assert(fread(data, (size_t)sz, 1, in) == 1);
+	fclose(in);
+	*len = (size_t)sz;
+	return data;
+}
+
+/** write the data to the file */
+static void
+snap_write_file(const char* fname, uint8_t* data, size_t len)
+{
+	FILE* out = fopen(fname, "wb");
+	unit_assert(out);
+	if(len > 0)
+		unit_assert(fwrite(data, len, 1, out) == 1);
+	unit_assert(fclose(out) == 0);
+}
+
+/** write the caches and load them into new caches */
+static void
+snap_roundtrip_test(struct daemon* orig, struct config_file* cfg)
+{
+	struct daemon* d = snap_daemon_create(cfg);
+	struct daemon* d2 = snap_daemon_create(cfg);
+	unit_show_func("daemon/cachesnap.c", "cache_snapshot_write");
+	unit_assert(cache_snapshot_write(orig));
+	unit_show_func("daemon/cachesnap.c", "cache_snapshot_load");
+	unit_assert(cache_snapshot_load(d));
+	snap_check(d, orig);
+	/* the loaded caches give the same snapshot */
+	unit_assert(cache_snapshot_write(d));
+	unit_assert(cache_snapshot_load(d2));
+	snap_check(d2, orig);
+	snap_daemon_delete(d);
+	snap_daemon_delete(d2);
+}
+
+/** load truncated and damaged files */
+static void
+snap_damage_test(struct daemon* orig, struct config_file* cfg)
+{
+	struct daemon* d = snap_daemon_create(cfg);
+	const char* fname = cfg->cache_snapshot_file;
+	uint8_t* data, *bad;
+	size_t len, i;
+	unit_show_func("daemon/cachesnap.c", "cache_snapshot_load damaged");
+	unit_assert(cache_snapshot_write(orig));
+	data = snap_read_file(fname, &len);
+	bad = (uint8_t*)malloc(len);
+	unit_assert(bad);
+
+	/* without the end chunk the file is not used at all */
+	for(i=0; i<len; i++) {
+		snap_write_file(fname, data, i);
+		unit_assert(!cache_snapshot_load(d));
+		unit_assert(snap_count(d->env->msg_cache) == 0 &&
+			snap_count(&d->env->rrset_cache->table) == 0 &&
+			snap_count(d->env->infra_cache->hosts) == 0);
+	}
+
+	/* a damaged byte anywhere is not loaded wrongly, the checks on
+	 * the entries stop at the damage */
+	for(i=0; i<len; i++) {
+		memmove(bad, data, len);
+		bad[i] ^= 0xff;
+		snap_write_file(fname, bad, len);
+		(void)cache_snapshot_load(d);
+		snap_daemon_clear(d);
+	}
+	memmove(bad, data, len);
+	bad[0] ^= 0xff;
+	snap_write_file(fname, bad, len);
+	unit_assert(!cache_snapshot_load(d));
+
+	/* the undamaged file loads afterwards */
+	snap_write_file(fname, data, len);
+	unit_assert(cache_snapshot_load(d));
+	snap_check(d, orig);
+	free(bad);
+	free(data);
+	snap_daemon_delete(d);
+}
+
+void
+cachesnap_test(void)
+{
+	struct config_file* cfg;
+	struct daemon* orig;
+	char fname[256];
+	unit_show_feature("cache snapshot");
+	snap_test_now = time(NULL);
+	cfg = config_create();
+	unit_assert(cfg);
+	cfg->num_threads = 2;
+	snprintf(fname, sizeof(fname), "/tmp/unbound.unittest.snap.%u",
+		(unsigned)getpid());
+	cfg->cache_snapshot_file = strdup(fname);
+	unit_assert(cfg->cache_snapshot_file);
+	orig = snap_daemon_create(cfg);
+	snap_fill(orig);
+	unit_assert(snap_count(orig->env->msg_cache) == SNAP_TEST_NUM);
+
+	snap_roundtrip_test(orig, cfg);
+	snap_damage_test(orig, cfg);
+
+	(void)unlink(fname);
+	snap_daemon_delete(orig);
+	config_delete(cfg);
+}
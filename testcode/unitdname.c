@@ -39,9 +39,12 @@
  */
 
 #include "config.h"
+#include <ctype.h>
+#include <sys/time.h>
 #include "util/log.h"
 #include "testcode/unitmain.h"
 #include "util/data/dname.h"
+#include "util/storage/lookup3.h"
 #include "sldns/sbuffer.h"
 #include "sldns/str2wire.h"
 
@@ -830,6 +833,178 @@ dname_setup_bufs(sldns_buffer* loopbuf, sldns_buffer* boundbuf)
 	sldns_buffer_flip(boundbuf);
 }
 
+/** the byte at a time dname compare, to check the faster one against */
+static int
+ref_dname_compare(uint8_t* d1, uint8_t* d2)
+{
+	uint8_t lab1 = *d1++, lab2 = *d2++;
+	while(lab1 != 0 || lab2 != 0) {
+		if(lab1 != lab2)
+			return (lab1 < lab2)? -1 : 1;
+		while(lab1--) {
+			if(tolower((unsigned char)*d1) != tolower((unsigned char)*d2))
+				return (tolower((unsigned char)*d1) <
+					tolower((unsigned char)*d2))? -1 : 1;
+			d1++;
+			d2++;
+		}
+		lab1 = *d1++;
+		lab2 = *d2++;
+	}
+	return 0;
+}
+
+/** the byte at a time dname hash, to check the faster one against */
+static hashvalue_t
+ref_dname_hash(uint8_t* dname, hashvalue_t h)
+{
+	uint8_t labuf[LDNS_MAX_LABELLEN+1];
+	uint8_t lablen = *dname++;
+	int i;
+	while(lablen) {
+		labuf[0] = lablen;
+		i = 0;
+		while(lablen--)
+			labuf[++i] = (uint8_t)tolower((unsigned char)*dname++);
+		h = hash_bytes(labuf, labuf[0] + 1, h);
+		lablen = *dname++;
+	}
+	return h;
+}
+
+/** characters for the random names, with the ones around the letters */
+static const char dname_rnd_chars[] = "aAbBzZ09-_@[`{\200\301\332\372";
+
+/** make a random dname, returns length. Labels are short, or long to use
+ * the 8 and 16 byte steps */
+static size_t
+dname_random(uint8_t* d)
+{
+	static const uint8_t lens[] = {1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 63};
+	int labs = 1 + random()%5, i;
+	size_t len = 0;
+	while(labs-- && len + LDNS_MAX_LABELLEN+2 <= LDNS_MAX_DOMAINLEN) {
+		uint8_t lablen = lens[random()%sizeof(lens)];
+		d[len++] = lablen;
+		for(i=0; i<lablen; i++)
+			d[len++] = (uint8_t)dname_rnd_chars[random()%
+				(sizeof(dname_rnd_chars)-1)];
+	}
+	d[len++] = 0;
+	return len;
+}
+
+/** check the lowercasing compare, hash and tolower against the byte at
+ * a time versions */
+static void
+dname_test_fold(void)
+{
+	uint8_t d1[LDNS_MAX_DOMAINLEN], d2[LDNS_MAX_DOMAINLEN],
+		d3[LDNS_MAX_DOMAINLEN];
+	size_t i, j, len;
+	int n;
+	sldns_buffer pkt;
+	unit_show_func("util/data/dname.c", "memlowercmp");
+	for(n=0; n<10000; n++) {
+		int c, r;
+		len = dname_random(d1);
+		memmove(d2, d1, len);
+		/* flip case, or change one byte, or use another name */
+		switch(random()%3) {
+		case 0:
+			for(i=0; i<len; i+=d2[i]+1)
+				for(j=i+1; j<=i+d2[i]; j++)
+					if(isalpha(d2[j]) && random()%2)
+						d2[j] ^= 0x20;
+			break;
+		case 1:
+			/* a byte in the last label, not the label length */
+			for(i=0; d2[i+d2[i]+1] != 0; i+=d2[i]+1)
+				;
+			if(d2[i] != 0)
+				d2[i+1+random()%d2[i]] = (uint8_t)dname_rnd_chars[
+					random()%(sizeof(dname_rnd_chars)-1)];
+			break;
+		default:
+			(void)dname_random(d2);
+		}
+		c = query_dname_compare(d1, d2);
+		r = ref_dname_compare(d1, d2);
+		unit_assert(c == r);
+		unit_assert(query_dname_compare(d2, d1) == -r);
+		sldns_buffer_init_frm_data(&pkt, d1, len);
+		unit_assert(dname_pkt_compare(&pkt, d1, d2) == r);
+		unit_assert(dname_query_hash(d1, 1234) ==
+			ref_dname_hash(d1, 1234));
+		unit_assert(dname_pkt_hash(&pkt, d1, 1234) ==
+			ref_dname_hash(d1, 1234));
+		/* the label lengths stay the same */
+		len = 1;
+		for(i=0; d2[i]; i+=d2[i]+1)
+			len += d2[i]+1;
+		memmove(d3, d2, len);
+		for(i=0; i<len; i+=d3[i]+1)
+			for(j=i+1; j<=i+d3[i]; j++)
+				d3[j] = (uint8_t)tolower((unsigned char)d3[j]);
+		query_dname_tolower(d2);
+		unit_assert(memcmp(d2, d3, len) == 0);
+	}
+}
+
+/** number of operations for the dname benchmark */
+#define BENCH_DNAME_OPS 500000
+
+/** time in msec since start */
+static double
+bench_msec(struct timeval* start)
+{
+	struct timeval end;
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)(end.tv_sec - start->tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start->tv_usec)/1000.;
+}
+
+/** benchmark compare and hash of names that differ in case, as for the
+ * cache lookups, against the byte at a time versions */
+static void
+dname_bench(const char* str1, const char* str2)
+{
+	uint8_t d1[LDNS_MAX_DOMAINLEN], d2[LDNS_MAX_DOMAINLEN];
+	size_t len1 = sizeof(d1), len2 = sizeof(d2);
+	double cmp, refcmp, hash, refhash;
+	struct timeval start;
+	hashvalue_t h = 0;
+	int i, c = 0;
+	unit_assert(sldns_str2wire_dname_buf(str1, d1, &len1) == 0);
+	unit_assert(sldns_str2wire_dname_buf(str2, d2, &len2) == 0);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<BENCH_DNAME_OPS; i++)
+		c |= query_dname_compare(d1, d2);
+	cmp = bench_msec(&start);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<BENCH_DNAME_OPS; i++)
+		c |= ref_dname_compare(d1, d2);
+	refcmp = bench_msec(&start);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<BENCH_DNAME_OPS; i++)
+		h = dname_query_hash(d1, h);
+	hash = bench_msec(&start);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<BENCH_DNAME_OPS; i++)
+		h = ref_dname_hash(d1, h);
+	refhash = bench_msec(&start);
+	unit_assert(c == 0);
+	printf("dname %s (%u bytes): %u compares in %g msec, byte at a "
+		"time %g msec; hashes in %g msec, byte at a time %g msec\n",
+		str1, (unsigned)len1, (unsigned)BENCH_DNAME_OPS, cmp, refcmp,
+		hash, refhash);
+}
+
 void dname_test(void)
 {
 	sldns_buffer* loopbuf = sldns_buffer_new(14);
@@ -855,6 +1030,10 @@ void dname_test(void)
 	dname_test_canoncmp();
 	dname_test_topdomain();
 	dname_test_valid();
+	dname_test_fold();
+	dname_bench("www.Example.COM.", "www.example.com.");
+	dname_bench("a-somewhat-longer-Label.IN.a.longer-domain.Example.com.",
+		"a-somewhat-longer-label.in.a.longer-domain.example.COM.");
 	sldns_buffer_free(buff);
 	sldns_buffer_free(loopbuf);
 	sldns_buffer_free(boundbuf);
@@ -39,10 +39,12 @@
  */
 
 #include "config.h"
+#include <sys/time.h>
 #include "testcode/unitmain.h"
 #include "util/log.h"
 #include "util/storage/lruhash.h"
 #include "util/storage/slabhash.h" /* for the test structures */
+#include "util/storage/lookup3.h"
 
 /** use this type for the lruhash test key */
 typedef struct slabhash_testkey testkey_t;
@@ -272,6 +274,59 @@ testlookup(struct lruhash* table, testdata_t* ref[])
 	delkey(key);
 }
 
+/** check that the overflow counts of the groups of the open addressing
+ * index match the probe sequences of the entries */
+static void
+check_index(struct lruhash* table)
+{
+	struct lruhash_index* idx = table->index;
+	size_t* count = (size_t*)calloc(idx->mask+1, sizeof(size_t));
+	size_t i, g, step, c = 0;
+	unit_assert(count);
+	for(i=0; i<table->size; i++) {
+		struct lruhash_group* grp = &idx->groups[i/LRUHASH_GROUP];
+		struct lruhash_entry* e = grp->entries[i%LRUHASH_GROUP];
+		if(grp->tags[i%LRUHASH_GROUP] == 0)
+			continue;
+		unit_assert(e && grp->tags[i%LRUHASH_GROUP] ==
+			(e->hash ? e->hash : 1));
+		c++;
+		/* the groups before the one of the entry are passed */
+		g = e->hash & idx->mask;
+		step = 0;
+		while(g != i/LRUHASH_GROUP) {
+			count[g]++;
+			step++;
+			unit_assert(step <= idx->mask);
+			g = (g + step) & idx->mask;
+		}
+	}
+	unit_assert(c == table->num);
+	for(g=0; g<=idx->mask; g++)
+		unit_assert(idx->groups[g].overflow == count[g]);
+	free(count);
+}
+
+/** check that the window of the admission policy is the front of the
+ * LRU list, and that its size is counted */
+static void
+check_window(struct lruhash* table)
+{
+	struct lruhash_entry* p = table->lru_start;
+	size_t used = 0;
+	int end = (table->admit->win_end == NULL);
+	while(p && !end) {
+		unit_assert(p->window);
+		used += test_slabhash_sizefunc(p->key, p->data);
+		end = (p == table->admit->win_end);
+		p = p->lru_next;
+	}
+	unit_assert(end);
+	unit_assert(used == table->admit->win_used);
+	for(; p; p = p->lru_next)
+		unit_assert(!p->window);
+}
+
 /** check integrity of hash table */
 static void
 check_table(struct lruhash* table)
@@ -301,6 +356,10 @@ check_table(struct lruhash* table)
 		p = p->lru_next;
 	}
 	unit_assert(c == table->num);
+	if(table->index)
+		check_index(table);
+	if(table->admit)
+		check_window(table);
 
 	/* this assertion is specific to the unit test */
 	unit_assert( table->space_used == 
@@ -477,6 +536,453 @@ test_threaded_table(struct lruhash* table)
 	if(0) lruhash_status(table, "hashtest", 1);
 }
 
+#ifdef LRUHASH_READ_MOSTLY
+/** see if the key is in the table, with a read-mostly lookup */
+static int
+rm_present(struct lruhash* table, int id)
+{
+	testkey_t* key = newkey(id);
+	struct lruhash_entry* en = lruhash_lookup(table, myhash(id), key, 0);
+	if(en) { lock_rw_unlock(&en->lock); }
+	delkey(key);
+	return en != NULL;
+}
+
+/** test the read-mostly mode, reference bits and retired entries */
+static void
+test_read_mostly(void)
+{
+	size_t sz = test_slabhash_sizefunc(NULL, NULL);
+	struct lruhash* table = lruhash_create(2, 4*sz,
+		test_slabhash_sizefunc, test_slabhash_compfunc,
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	int i;
+	testkey_t* k;
+	unit_assert(table);
+	unit_assert(lruhash_set_read_mostly(table, 1));
+	for(i=1; i<=4; i++) {
+		testdata_t* d = newdata(i);
+		k = newkey(i);
+		k->entry.data = d;
+		lruhash_insert(table, myhash(i), &k->entry, d, NULL);
+	}
+	/* lookup does not change the lru order, but sets the ref bit */
+	unit_assert(rm_present(table, 1));
+	lock_quick_lock(&table->lock);
+	unit_assert(table->lru_end->key && 
+		((testkey_t*)table->lru_end->key)->id == 1);
+	unit_assert(table->lru_end->ref);
+	lock_quick_unlock(&table->lock);
+
+	/* 1 was referenced and gets a second chance, 2 is evicted */
+	k = newkey(5);
+	k->entry.data = newdata(5);
+	lruhash_insert(table, myhash(5), &k->entry, k->entry.data, NULL);
+	unit_assert(rm_present(table, 1));
+	unit_assert(!rm_present(table, 2));
+	unit_assert(rm_present(table, 3));
+	check_table(table);
+
+	/* removed entry is retired, and deleted one epoch later */
+	k = newkey(3);
+	lruhash_remove(table, myhash(3), k);
+	unit_assert(!rm_present(table, 3));
+	lock_quick_lock(&table->lock);
+	unit_assert(table->retired_old != NULL || table->retired != NULL);
+	lock_quick_unlock(&table->lock);
+	k->id = 4;
+	lruhash_remove(table, myhash(4), k);
+	k->id = 5;
+	lruhash_remove(table, myhash(5), k);
+	delkey(k);
+	unit_assert(!rm_present(table, 4));
+	check_table(table);
+
+	/* the other tests work the same in read-mostly mode */
+	test_short_table(table);
+	lruhash_delete(table);
+
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	unit_assert(lruhash_set_read_mostly(table, 1));
+	test_long_table(table);
+	unit_assert(lruhash_set_read_mostly(table, 0));
+	unit_assert(table->readers == NULL && table->retired == NULL &&
+		table->retired_old == NULL);
+	lruhash_delete(table);
+
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	unit_assert(lruhash_set_read_mostly(table, 1));
+	test_threaded_table(table);
+	lruhash_delete(table);
+}
+#endif /* LRUHASH_READ_MOSTLY */
+
+/** test the open addressing mode, with the other tests */
+static void
+test_open_addressing(void)
+{
+	struct lruhash* table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	struct lruhash_entry* e;
+	size_t mem;
+	int i;
+	testkey_t* k;
+	unit_assert(table);
+	/* entries are moved into the index and back to the bins */
+	for(i=0; i<10; i++) {
+		k = newkey(i);
+		k->entry.data = newdata(i);
+		lruhash_insert(table, myhash(i), &k->entry, k->entry.data,
+			NULL);
+	}
+	unit_assert(lruhash_set_open_addressing(table, 1));
+	unit_assert(table->index && table->stripes && !table->array);
+	unit_assert(table->size >= LRUHASH_GROUP);
+	check_table(table);
+	/* the memory has the index and no bins, and the admission
+	 * policy is counted with it */
+	mem = lruhash_get_mem(table);
+	unit_assert(mem > sizeof(struct lruhash) + table->space_used);
+	unit_assert(lruhash_set_admission(table, 1));
+	unit_assert(lruhash_get_mem(table) > mem);
+	unit_assert(lruhash_set_admission(table, 0));
+	unit_assert(lruhash_get_mem(table) == mem);
+	for(i=0; i<10; i++) {
+		k = newkey(i);
+		e = lruhash_lookup(table, myhash(i), k, 0);
+		unit_assert(e && e->key && ((testkey_t*)e->key)->id == i);
+		lock_rw_unlock(&e->lock);
+		delkey(k);
+	}
+	/* a removed slot does not end the probe sequence, the overflow
+	 * counts do; the bad test hash puts the entries in few groups */
+	k = newkey(3);
+	lruhash_remove(table, myhash(3), k);
+	unit_assert(lruhash_lookup(table, myhash(3), k, 0) == NULL);
+	k->id = 9;
+	e = lruhash_lookup(table, myhash(9), k, 0);
+	unit_assert(e && e->key && ((testkey_t*)e->key)->id == 9);
+	lock_rw_unlock(&e->lock);
+	delkey(k);
+	unit_assert(lruhash_set_open_addressing(table, 0));
+	unit_assert(!table->index && !table->stripes && table->array);
+	check_table(table);
+	unit_assert(table->num == 9);
+	unit_assert(lruhash_set_open_addressing(table, 1));
+	lruhash_clear(table);
+	unit_assert(table->num == 0);
+	check_table(table);
+	test_short_table(table);
+	test_long_table(table);
+	lruhash_delete(table);
+
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	unit_assert(lruhash_set_open_addressing(table, 1));
+	test_threaded_table(table);
+	lruhash_delete(table);
+#ifdef LRUHASH_READ_MOSTLY
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	unit_assert(lruhash_set_open_addressing(table, 1));
+	unit_assert(lruhash_set_read_mostly(table, 1));
+	test_long_table(table);
+	lruhash_delete(table);
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	unit_assert(lruhash_set_read_mostly(table, 1));
+	unit_assert(lruhash_set_open_addressing(table, 1));
+	test_threaded_table(table);
+	lruhash_delete(table);
+#endif
+}
+
+/** hash for the admission test, the test hash has too few values */
+static hashvalue_t adm_hash(int id) {return hashlittle(&id, sizeof(id), 0);}
+
+/** look up the id in the admission test, returns true if found */
+static int
+adm_lookup(struct lruhash* table, int id)
+{
+	testkey_t* k = newkey(id);
+	struct lruhash_entry* e = lruhash_lookup(table, adm_hash(id), k, 0);
+	delkey(k);
+	if(!e)
+		return 0;
+	lock_rw_unlock(&e->lock);
+	return 1;
+}
+
+/** add the id in the admission test */
+static void
+adm_add(struct lruhash* table, int id)
+{
+	testkey_t* k = newkey(id);
+	k->entry.hash = adm_hash(id);
+	k->entry.data = newdata(id);
+	lruhash_insert(table, k->entry.hash, &k->entry, k->entry.data, NULL);
+}
+
+/** number of entries that fit in the table of the admission test */
+#define ADM_SPACE 1000
+/** number of hot entries in the admission test */
+#define ADM_HOT 20
+/** number of new entries, that are used once, in the admission test */
+#define ADM_FLOOD 40000
+/** the hot entries are used once every this number of new entries */
+#define ADM_INTERVAL 100
+
+/** run the admission test, a flood of entries that are used once, with
+ * the hot entries used again after more than the table holds, so that
+ * LRU order pushes them out. Returns number of hot entries in the table
+ * at the end. */
+static int
+admission_run(int on, int open, struct lruhash_admit_stats* st)
+{
+	struct lruhash* table = lruhash_create(1024,
+		ADM_SPACE*test_slabhash_sizefunc(NULL, NULL),
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	int i, hot = 0;
+	unit_assert(table);
+	unit_assert(lruhash_set_admission(table, on));
+	unit_assert(lruhash_set_open_addressing(table, open));
+	for(i=0; i<ADM_HOT; i++) {
+		(void)adm_lookup(table, i);
+		adm_add(table, i);
+	}
+	for(i=ADM_HOT; i<ADM_SPACE; i++)
+		adm_add(table, i);
+	check_table(table);
+	for(i=0; i<ADM_FLOOD; i++) {
+		int id = ADM_SPACE + i;
+		if(!adm_lookup(table, id))
+			adm_add(table, id);
+		if(i%ADM_INTERVAL == 0) {
+			id = (i/ADM_INTERVAL)%ADM_HOT;
+			if(!adm_lookup(table, id))
+				adm_add(table, id);
+		}
+	}
+	check_table(table);
+	memset(st, 0, sizeof(*st));
+	lruhash_get_admit_stats(table, st, 1);
+	for(i=0; i<ADM_HOT; i++)
+		hot += adm_lookup(table, i);
+	lruhash_delete(table);
+	return hot;
+}
+
+/** test the admission policy */
+static void
+test_admission(void)
+{
+	struct lruhash* table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	struct lruhash_admit_stats st;
+	int i, lru;
+	unit_assert(table);
+	for(i=0; i<10; i++)
+		adm_add(table, i);
+	unit_assert(lruhash_set_admission(table, 1));
+	unit_assert(table->admit && table->admit->win_used == 0);
+	/* the new entries are in the window, the old ones are not */
+	for(i=10; i<20; i++)
+		adm_add(table, i);
+	check_table(table);
+	unit_assert(table->admit->win_end);
+	unit_assert(lruhash_set_admission(table, 0));
+	unit_assert(!table->admit);
+	check_table(table);
+	unit_assert(lruhash_set_admission(table, 1));
+	lruhash_clear(table);
+	check_table(table);
+	test_short_table(table);
+	test_long_table(table);
+	lruhash_delete(table);
+
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	unit_assert(lruhash_set_admission(table, 1));
+	test_threaded_table(table);
+	lruhash_delete(table);
+#ifdef LRUHASH_READ_MOSTLY
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	unit_assert(lruhash_set_admission(table, 1));
+	unit_assert(lruhash_set_read_mostly(table, 1));
+	test_threaded_table(table);
+	lruhash_delete(table);
+#endif
+
+	/* LRU order loses the hot entries, the admission keeps them */
+	lru = admission_run(0, 0, &st);
+	unit_assert(lru < ADM_HOT);
+	unit_assert(st.lookups == 0 && st.admitted == 0);
+	unit_assert(admission_run(1, 0, &st) == ADM_HOT);
+	unit_assert(st.lookups == ADM_HOT + ADM_FLOOD +
+		ADM_FLOOD/ADM_INTERVAL);
+	/* the sketch size follows the bytes of the entries, with larger
+	 * entries (lock checks) a hot entry can miss once after the start */
+	unit_assert(st.hits >= ADM_FLOOD/ADM_INTERVAL - 2*ADM_HOT);
+	unit_assert(st.admitted > 0 && st.rejected > 0);
+	unit_assert(admission_run(1, 1, &st) == ADM_HOT);
+	unit_assert(st.rejected > 0);
+}
+
+/** number of entries for the lookup benchmark */
+#define BENCH_ENTRIES 100000
+/** number of lookups for the lookup benchmark, of hits and of misses */
+#define BENCH_LOOKUPS 1000000
+/** the lookups are timed this many times, the fastest round counts, so
+ * that the other processes on the machine matter less */
+#define BENCH_ROUNDS 3
+
+/** time in msec since start */
+static double
+bench_msec(struct timeval* start)
+{
+	struct timeval end;
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)(end.tv_sec - start->tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start->tv_usec)/1000.;
+}
+
+/** benchmark lookups of the ids, return time in msec */
+static double
+bench_lookup_ids(struct lruhash* table, int* ids, int hit)
+{
+	testkey_t* key = newkey(0);
+	struct timeval start;
+	size_t i, found = 0;
+	double dt;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<BENCH_LOOKUPS; i++) {
+		struct lruhash_entry* e;
+		key->id = ids[i];
+		e = lruhash_lookup(table, hashlittle(&key->id, sizeof(key->id),
+			0), key, 0);
+		if(e) {
+			found++;
+			lock_rw_unlock(&e->lock);
+		}
+	}
+	dt = bench_msec(&start);
+	unit_assert(found == (hit?BENCH_LOOKUPS:0));
+	delkey(key);
+	return dt;
+}
+
+/** benchmark inserts and lookups, with the bins or with open addressing,
+ * with the hash function and entry locks of the caches */
+static void
+bench_lookup(int open)
+{
+	struct lruhash* table = lruhash_create(1024, (size_t)-1,
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	int* hits = (int*)malloc(sizeof(int)*BENCH_LOOKUPS);
+	int* misses = (int*)malloc(sizeof(int)*BENCH_LOOKUPS);
+	struct timeval start;
+	double dt_ins, dt_hit = 0, dt_miss = 0, dt;
+	size_t i;
+	unit_assert(table && hits && misses);
+	unit_assert(lruhash_set_open_addressing(table, open));
+	srandom(48);
+	for(i=0; i<BENCH_LOOKUPS; i++) {
+		hits[i] = (int)(random() % BENCH_ENTRIES);
+		misses[i] = (int)(BENCH_ENTRIES + random() % BENCH_ENTRIES);
+	}
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<BENCH_ENTRIES; i++) {
+		testkey_t* k = newkey((int)i);
+		k->entry.hash = hashlittle(&k->id, sizeof(k->id), 0);
+		k->entry.data = newdata((int)i);
+		lruhash_insert(table, k->entry.hash, &k->entry,
+			k->entry.data, NULL);
+	}
+	dt_ins = bench_msec(&start);
+	for(i=0; i<BENCH_ROUNDS; i++) {
+		dt = bench_lookup_ids(table, hits, 1);
+		if(i == 0 || dt < dt_hit)
+			dt_hit = dt;
+		dt = bench_lookup_ids(table, misses, 0);
+		if(i == 0 || dt < dt_miss)
+			dt_miss = dt;
+	}
+	printf("lruhash %s: %u inserts in %g msec, %u lookups in %g msec "
+		"for %f hit/sec, %g msec for %f miss/sec\n",
+		(open?"open addressing":"bins"), (unsigned)BENCH_ENTRIES,
+		dt_ins, (unsigned)BENCH_LOOKUPS, dt_hit,
+		(double)BENCH_LOOKUPS / (dt_hit/1000.), dt_miss,
+		(double)BENCH_LOOKUPS / (dt_miss/1000.));
+	free(hits);
+	free(misses);
+	lruhash_delete(table);
+}
+
+/** number of entries for the traverse test */
+#define TRAV_NUM 100
+
+/** count the visit of an entry */
+static void
+trav_count(struct lruhash_entry* e, void* arg)
+{
+	int* seen = (int*)arg;
+	int id = ((testkey_t*)e->key)->id;
+	unit_assert(id >= 0 && id < TRAV_NUM);
+	seen[id]++;
+}
+
+/** test the traverse in parts, every entry is visited once */
+static void
+test_traverse_part(int open)
+{
+	struct lruhash* table = lruhash_create(2, 1024*1024,
+		test_slabhash_sizefunc, test_slabhash_compfunc,
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	int seen[TRAV_NUM];
+	size_t pos = 0, calls = 0;
+	int i;
+	testkey_t* k;
+	unit_show_func("util/storage/lruhash.c", "lruhash_traverse_part");
+	unit_assert(table);
+	if(open)
+		unit_assert(lruhash_set_open_addressing(table, 1));
+	for(i=0; i<TRAV_NUM; i++) {
+		k = newkey(i);
+		k->entry.hash = adm_hash(i);
+		k->entry.data = newdata(i);
+		lruhash_insert(table, k->entry.hash, &k->entry,
+			k->entry.data, NULL);
+	}
+	unit_assert(table->num == TRAV_NUM);
+	memset(seen, 0, sizeof(seen));
+	do {
+		pos = lruhash_traverse_part(table, 0, pos, 7, &trav_count,
+			seen);
+		calls++;
+	} while(pos != 0);
+	unit_assert(calls > 1);
+	for(i=0; i<TRAV_NUM; i++)
+		unit_assert(seen[i] == 1);
+	lruhash_delete(table);
+}
+
 void lruhash_test(void)
 {
 	/* start very very small array, so it can do lots of table_grow() */
@@ -496,4 +1002,13 @@ void lruhash_test(void)
 		test_slabhash_delkey, test_slabhash_deldata, NULL);
 	test_threaded_table(table);
 	lruhash_delete(table);
+#ifdef LRUHASH_READ_MOSTLY
+	test_read_mostly();
+#endif
+	test_open_addressing();
+	test_admission();
+	test_traverse_part(0);
+	test_traverse_part(1);
+	bench_lookup(0);
+	bench_lookup(1);
 }
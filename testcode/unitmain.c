@@ -108,6 +108,48 @@ alloc_test(void) {
 	alloc_clear(&major);
 }
 
+#include "util/data/packed_rrset.h"
+#include "util/data/msgreply.h"
+/** test the shared names of the cache */
+static void
+rrset_name_test(void)
+{
+	uint8_t nm[] = "\003www\007example\003com";
+	uint8_t* a, *b;
+	struct query_info q;
+	struct reply_info* rep;
+	struct msgreply_entry* e;
+	size_t s;
+	unit_show_feature("packed_rrset_name");
+	a = packed_rrset_name_dup(nm, sizeof(nm));
+	unit_assert(a && memcmp(a, nm, sizeof(nm)) == 0);
+	b = packed_rrset_name_ref(a);
+	if(b) {
+		unit_assert(b == a);
+		packed_rrset_name_free(a);
+		/* still in use by b */
+		unit_assert(memcmp(b, nm, sizeof(nm)) == 0);
+		packed_rrset_name_free(b);
+	} else	packed_rrset_name_free(a);
+	packed_rrset_name_free(NULL);
+
+	/* a message counts its qname in its size, unless it shares it with
+	 * an rrset, that counts it */
+	memset(&q, 0, sizeof(q));
+	q.qname = packed_rrset_name_dup(nm, sizeof(nm));
+	q.qname_len = sizeof(nm);
+	unit_assert(q.qname);
+	unit_assert( (rep = construct_reply_info_base(NULL, 0, 1, 0, 0, 0,
+		0, 0, 0, sec_status_unchecked)) );
+	unit_assert( (e = query_info_entrysetup(&q, rep, 0)) );
+	unit_assert(!e->qname_shared);
+	s = msgreply_sizefunc(e, rep);
+	e->qname_shared = 1;
+	unit_assert(msgreply_sizefunc(e, rep) + sizeof(nm) == s);
+	query_entry_delete(e, NULL);
+	reply_info_delete(rep, NULL);
+}
+
 #include "util/net_help.h"
 /** test net code */
 static void 
@@ -406,6 +448,51 @@ rtt_test(void)
 	}
 }
 
+/** test the rtt sketch */
+static void
+rtt_sketch_test(void)
+{
+	struct rtt_sketch sk;
+	int i, p;
+	unit_show_func("util/rtt.c", "rtt_sketch_percentile");
+	rtt_sketch_init(&sk);
+	unit_assert( rtt_sketch_percentile(&sk, 50) == -1 );
+	unit_assert( rtt_sketch_loss(&sk) == 0 );
+	/* 90 fast replies and a slow tail of 10 */
+	for(i=0; i<90; i++)
+		rtt_sketch_add(&sk, 20);
+	for(i=0; i<10; i++)
+		rtt_sketch_add(&sk, 400);
+	p = rtt_sketch_percentile(&sk, 50);
+	unit_assert( p >= 16 && p < 24 );
+	p = rtt_sketch_percentile(&sk, 90);
+	unit_assert( p >= 16 && p <= 24 );
+	p = rtt_sketch_percentile(&sk, 99);
+	unit_assert( p >= 384 && p < 512 );
+	unit_assert( rtt_sketch_percentile(&sk, 100) <= 512 );
+	/* one in five is lost */
+	for(i=0; i<25; i++)
+		rtt_sketch_lost(&sk);
+	unit_assert( rtt_sketch_loss(&sk) == 20 );
+	/* the counts decay, and follow the new rtt */
+	for(i=0; i<2000; i++)
+		rtt_sketch_add(&sk, 3000);
+	p = rtt_sketch_percentile(&sk, 50);
+	unit_assert( p >= 2048 && p < 3072+1024 );
+	unit_assert( rtt_sketch_percentile(&sk, 1) >= 2048 );
+	unit_assert( rtt_sketch_loss(&sk) < 2 );
+	unit_assert( sk.replies + sk.lost <= RTT_SKETCH_TOTAL_MAX );
+	/* the extremes */
+	rtt_sketch_init(&sk);
+	for(i=0; i<10; i++) {
+		rtt_sketch_add(&sk, 0);
+		rtt_sketch_add(&sk, RTT_MAX_TIMEOUT);
+	}
+	unit_assert( rtt_sketch_percentile(&sk, 1) == 0 );
+	p = rtt_sketch_percentile(&sk, 100);
+	unit_assert( p >= 98304 && p <= 131072 );
+}
+
 #include "services/cache/infra.h"
 #include "util/config_file.h"
 
@@ -443,6 +530,7 @@ infra_test(void)
 	struct infra_key* k;
 	struct infra_data* d;
 	int init = 376;
+	int i, lame, dlame, rlame, rtt;
 
 	unit_show_feature("infra cache");
 	unit_assert(ipstrtoaddr("127.0.0.1", 53, &one, &onelen));
@@ -500,6 +588,26 @@ infra_test(void)
 			now, &vs, &edns_lame, &to) );
 	unit_assert( vs == 0 && to == init && edns_lame == 1 );
 
+	/* rank the server with the percentile of the rtt and the loss */
+	now += cfg->host_ttl + 10;
+	slab->rtt_percentile = 90;
+	for(i=0; i<20; i++)
+		unit_assert( infra_rtt_update(slab, &one, onelen, zone,
+			zonelen, LDNS_RR_TYPE_A, (i%10==9)?400:20, init, now) );
+	unit_assert( infra_get_lame_rtt(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, &lame, &dlame, &rlame, &rtt, now) );
+	unit_assert( rtt >= 16 && rtt <= 24 );
+	for(i=0; i<5; i++)
+		unit_assert( infra_rtt_update(slab, &one, onelen, zone,
+			zonelen, LDNS_RR_TYPE_A, -1, init, now) );
+	unit_assert( infra_get_lame_rtt(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, &lame, &dlame, &rlame, &rtt, now) );
+	unit_assert( rtt > 24 );
+	slab->rtt_percentile = 0;
+	unit_assert( infra_get_lame_rtt(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, &lame, &dlame, &rlame, &rtt, now) );
+	unit_assert( rtt > 24 );
+
 	infra_delete(slab);
 	config_delete(cfg);
 }
@@ -536,6 +644,622 @@ rnd_test(void)
 	ub_randfree(r);
 }
 
+#include "util/storage/lookup3.h"
+/** test the hash functions for the hash tables */
+static void
+hash_test(void)
+{
+	uint8_t buf[64];
+	uint32_t h[65], h0;
+	size_t i, j;
+	int f;
+	unit_show_feature("hash_bytes");
+	unit_assert(hash_func_lookup("wyhash") == (int)hash_func_wyhash);
+	unit_assert(hash_func_lookup("lookup3") == (int)hash_func_lookup3);
+	unit_assert(hash_func_lookup("md5") == -1);
+	for(i=0; i<sizeof(buf); i++)
+		buf[i] = (uint8_t)i;
+	for(f=0; f<2; f++) {
+		hash_set_func(f?hash_func_wyhash:hash_func_lookup3);
+		for(i=0; i<=sizeof(buf); i++) {
+			/* every length, every byte and the previous hash
+			 * change the value */
+			h[i] = hash_bytes(buf, i, 0);
+			unit_assert(h[i] == hash_bytes(buf, i, 0));
+			unit_assert(h[i] != hash_bytes(buf, i, 1));
+			for(j=0; j<i; j++) {
+				unit_assert(h[i] != h[j]);
+				buf[j] ^= 0x80;
+				unit_assert(h[i] != hash_bytes(buf, i, 0));
+				buf[j] ^= 0x80;
+			}
+		}
+	}
+	/* the seed changes the values */
+	hash_set_seed(1);
+	h0 = hash_bytes(buf, 16, 0);
+	hash_set_seed(2);
+	unit_assert(h0 != hash_bytes(buf, 16, 0));
+}
+
+#include "services/inflight.h"
+#include "util/tube.h"
+/** test the table of queries in progress in the threads */
+static void
+inflight_test(void)
+{
+	struct inflight_table* table;
+	struct inflight_done* list;
+	struct tube* cmd;
+	struct query_info qinfo, q2;
+	uint8_t* msg = NULL;
+	uint32_t len = 0;
+	int all = 1;
+	unit_show_feature("inflight");
+	memset(&qinfo, 0, sizeof(qinfo));
+	qinfo.qname = (uint8_t*)"\007example\003com\000";
+	qinfo.qname_len = 13;
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	qinfo.qclass = LDNS_RR_CLASS_IN;
+	q2 = qinfo;
+	q2.qtype = LDNS_RR_TYPE_AAAA;
+	table = inflight_create(3, 42);
+	unit_assert(table);
+	cmd = tube_create();
+	unit_assert(cmd);
+	inflight_set_tube(table, 1, cmd);
+
+	/* the first thread resolves it, the others wait for it */
+	unit_assert(inflight_start(table, &qinfo, BIT_RD, 0) == 1);
+	unit_assert(inflight_start(table, &qinfo, BIT_RD, 1) == 0);
+	unit_assert(inflight_start(table, &qinfo, BIT_RD, 2) == 0);
+	unit_assert(inflight_start(table, &qinfo, BIT_RD, 0) == -1);
+	unit_assert(inflight_start(table, &qinfo, BIT_RD|BIT_CD, 1) == 1);
+	unit_assert(inflight_start(table, &q2, BIT_RD, 2) == 1);
+	unit_assert(inflight_start(table, &q2, BIT_RD, 1) == 0);
+	unit_assert(!tube_poll(cmd));
+
+	/* only the owner is done with it */
+	inflight_done(table, &qinfo, BIT_RD, 1);
+	list = inflight_take(table, 1, &all);
+	unit_assert(!list && !all);
+	inflight_done(table, &qinfo, BIT_RD, 0);
+	unit_assert(tube_poll(cmd));
+	unit_assert(tube_read_msg(cmd, &msg, &len, 0));
+	unit_assert(len == sizeof(uint32_t) && *(uint32_t*)msg == 42);
+	free(msg);
+
+	/* one wakeup for more done queries */
+	inflight_done(table, &q2, BIT_RD, 2);
+	unit_assert(!tube_poll(cmd));
+	list = inflight_take(table, 1, &all);
+	unit_assert(list && list->next && !list->next->next && !all);
+	unit_assert(query_info_compare(&list->qinfo, &q2) == 0 &&
+		list->flags == BIT_RD);
+	unit_assert(query_info_compare(&list->next->qinfo, &qinfo) == 0 &&
+		list->next->flags == BIT_RD);
+	free(list->next);
+	free(list);
+	list = inflight_take(table, 2, &all);
+	unit_assert(list && !list->next && !all);
+	unit_assert(query_info_compare(&list->qinfo, &qinfo) == 0);
+	free(list);
+	unit_assert(!inflight_take(table, 0, &all));
+
+	/* it can be resolved again, the waiters are deleted with it */
+	unit_assert(inflight_start(table, &qinfo, BIT_RD, 2) == 1);
+	unit_assert(inflight_start(table, &qinfo, BIT_RD, 1) == 0);
+	inflight_close(table);
+	inflight_done(table, &qinfo, BIT_RD, 2);
+	unit_assert(!inflight_take(table, 1, &all));
+	unit_assert(!tube_poll(cmd));
+	inflight_delete(table);
+	tube_delete(cmd);
+}
+
+#include "services/outside_network.h"
+#include "util/netevent.h"
+#include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+#include "util/fptr_wlist.h"
+#include <sys/time.h>
+
+/** send a query on the outgoing port pool */
+static struct pending*
+pool_query(struct serviced_query* sq, sldns_buffer* pkt)
+{
+	struct pending* p = pending_udp_query(sq, pkt, 1000, NULL, NULL);
+	unit_assert(p && p->pc && p->pc->num_outstanding > 0);
+	return p;
+}
+
+/** number of ports in the pool, not retired, opened at the time */
+static int
+pool_opened_at(struct port_if* pif, time_t now)
+{
+	int i, n = 0;
+	for(i=0; i<pif->inuse; i++)
+		if(!pif->out[i]->retired && pif->out[i]->opened == now)
+			n++;
+	return n;
+}
+
+/** test the pool of outgoing ports, and its rotation */
+static void
+outnet_pool_test(void)
+{
+	struct comm_base* base;
+	struct ub_randstate* rnd;
+	struct config_file* cfg;
+	struct outside_network* outnet;
+	struct serviced_query sq;
+	struct pending* p, *keep;
+	struct port_comm* old;
+	struct port_if* pif;
+	sldns_buffer* pkt;
+	char* ifs[1];
+	int* ports = NULL;
+	int numports, i;
+	time_t now = 1000;
+	unit_show_feature("outgoing port pool");
+	ifs[0] = "127.0.0.1";
+	unit_assert( (base = comm_base_create(0)) );
+	unit_assert( (rnd = ub_initstate((unsigned)time(NULL), NULL)) );
+	unit_assert( (cfg = config_create()) );
+	numports = cfg_condense_ports(cfg, &ports);
+	unit_assert(numports > 0 && ports);
+	/* a pool of 2 ports, that are used for 60 seconds */
+	outnet = outside_network_create(base, 4096, 8, ifs, 1, 1, 0, 0,
+		NULL, rnd, 0, ports, numports, 0, NULL, NULL, 1, NULL, 0,
+		NULL, 0, 0, 2, 60, 0);
+	unit_assert(outnet && outnet->port_pool == 2);
+	outnet->now_secs = &now;
+	pif = &outnet->ip4_ifs[0];
+	memset(&sq, 0, sizeof(sq));
+	sq.outnet = outnet;
+	unit_assert(ipstrtoaddr("127.0.0.1", 9, &sq.addr, &sq.addrlen));
+	unit_assert( (pkt = sldns_buffer_new(512)) );
+	sldns_buffer_clear(pkt);
+	for(i=0; i<LDNS_HEADER_SIZE; i++)
+		sldns_buffer_write_u8(pkt, 0);
+	sldns_buffer_write_u8(pkt, 0);
+	sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_A);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	sldns_buffer_flip(pkt);
+
+	/* the pool fills, and then the queries use its ports */
+	for(i=0; i<6; i++) {
+		p = pool_query(&sq, pkt);
+		unit_assert(pif->inuse <= 2 && pif->retired == 0);
+		unit_assert(p->pc == pif->out[0] || p->pc == pif->out[1]);
+		/* the timeout lowers the use, the port stays open */
+		pending_udp_timer_cb(p);
+		unit_assert(pif->inuse >= 1);
+	}
+	unit_assert(pif->inuse == 2);
+	unit_assert(pif->out[0]->num_outstanding == 0 &&
+		pif->out[1]->num_outstanding == 0);
+
+	/* a query keeps one of the ports in use, after the lifetime
+	 * the pool ports are rotated, the busy one is retired */
+	keep = pool_query(&sq, pkt);
+	old = keep->pc;
+	now += 60;
+	for(i=0; i<100 && (pif->retired != 1 ||
+		pool_opened_at(pif, now) != 2); i++) {
+		p = pool_query(&sq, pkt);
+		unit_assert(p->pc != old && !p->pc->retired);
+		unit_assert(p->pc->opened == now);
+		pending_udp_timer_cb(p);
+	}
+	unit_assert(i < 100);
+	unit_assert(old->retired && old->num_outstanding == 1);
+	unit_assert(pif->inuse == 3 && pif->retired == 1);
+	/* the retired port is not used for new queries */
+	for(i=0; i<10; i++) {
+		p = pool_query(&sq, pkt);
+		unit_assert(p->pc != old && p->pc->opened == now);
+		pending_udp_timer_cb(p);
+	}
+	/* it is closed when its query is done */
+	pending_udp_timer_cb(keep);
+	unit_assert(pif->inuse == 2 && pif->retired == 0);
+	unit_assert(!old->retired && old->cp->fd == -1);
+
+	/* when the pool is not full, an open port can be picked again,
+	 * but not after its lifetime; only the open ports are available,
+	 * and the arrays of the interface are not used after this */
+	outnet->port_pool = 3;
+	pif->avail_total = pif->inuse;
+	now += 60;
+	for(i=0; i<10; i++) {
+		p = pool_query(&sq, pkt);
+		unit_assert(p->pc->opened == now);
+		pending_udp_timer_cb(p);
+	}
+
+	outside_network_delete(outnet);
+	sldns_buffer_free(pkt);
+	free(ports);
+	config_delete(cfg);
+	ub_randfree(rnd);
+	comm_base_delete(base);
+}
+
+/** number of datagrams the udp batch test callback has seen */
+static int udp_batch_seen;
+/** the udp batch test callback closes the comm point at this datagram */
+static int udp_batch_close_at;
+
+/** udp batch test callback, answers with the query */
+static int
+udp_batch_test_cb(struct comm_point* c, void* ATTR_UNUSED(arg),
+	int ATTR_UNUSED(error), struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	if(++udp_batch_seen == udp_batch_close_at) {
+		comm_point_close(c);
+		return 0;
+	}
+	return 1;
+}
+
+/** timer callback that stops the event loop, arg is the comm base */
+static void
+test_exit_timer_cb(void* arg)
+{
+	comm_base_exit((struct comm_base*)arg);
+}
+
+/** run the event loop of the base for msec */
+void
+test_base_run(struct comm_base* base, int msec)
+{
+	struct comm_timer* t;
+	struct timeval tv, *now;
+	time_t* tt;
+	/* the timer is relative to the time of the base, that is not
+	 * updated outside of the event loop */
+	comm_base_timept(base, &tt, &now);
+	unit_assert(gettimeofday(now, NULL) == 0);
+	*tt = now->tv_sec;
+	fptr_whitelist_test_add((fptr_test_func_type)&test_exit_timer_cb);
+	unit_assert( (t = comm_timer_create(base, test_exit_timer_cb, base)) );
+	tv.tv_sec = msec/1000;
+	tv.tv_usec = (msec%1000)*1000;
+	comm_timer_set(t, &tv);
+	comm_base_dispatch(base);
+	comm_timer_delete(t);
+}
+
+/** send num datagrams to a batched comm point, run it, return the
+ * number of answers */
+static int
+udp_batch_run(int close_at, int num)
+{
+	struct comm_base* base;
+	struct sockaddr_in a;
+	socklen_t alen = (socklen_t)sizeof(a);
+	struct comm_point* c;
+	sldns_buffer* buf;
+	char pkt[12];
+	int s, cl, i, n = 0;
+	memset(&a, 0, sizeof(a));
+	a.sin_family = AF_INET;
+	a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	unit_assert( (s = socket(AF_INET, SOCK_DGRAM, 0)) != -1);
+	unit_assert( (cl = socket(AF_INET, SOCK_DGRAM, 0)) != -1);
+	unit_assert(bind(s, (struct sockaddr*)&a, alen) == 0);
+	unit_assert(getsockname(s, (struct sockaddr*)&a, &alen) == 0);
+	unit_assert(fd_set_nonblock(s));
+	unit_assert( (base = comm_base_create(0)) );
+	unit_assert(comm_base_set_udp_batch(base, 8, 512));
+	unit_assert( (buf = sldns_buffer_new(512)) );
+	unit_assert( (c = comm_point_create_udp(base, s, buf,
+		udp_batch_test_cb, NULL)) );
+	c->udp_batch = 1;
+	udp_batch_seen = 0;
+	udp_batch_close_at = close_at;
+	memset(pkt, 0, sizeof(pkt));
+	for(i=0; i<num; i++) {
+		pkt[0] = (char)i;
+		unit_assert(sendto(cl, pkt, sizeof(pkt), 0,
+			(struct sockaddr*)&a, alen) == (ssize_t)sizeof(pkt));
+	}
+	test_base_run(base, 50);
+	while(recv(cl, pkt, sizeof(pkt), MSG_DONTWAIT) == (ssize_t)sizeof(pkt))
+		unit_assert(pkt[0] == (char)n++);
+	comm_point_delete(c);
+	comm_base_delete(base);
+	sldns_buffer_free(buf);
+	close(cl);
+	return n;
+}
+
+/** test the udp batch, and a callback that closes the comm point */
+static void
+udp_batch_test(void)
+{
+	unit_show_feature("udp batch");
+	fptr_whitelist_test_add((fptr_test_func_type)&udp_batch_test_cb);
+	/* in batches of 8 */
+	unit_assert(udp_batch_run(0, 20) == 20);
+	/* the replies queued before the close are sent */
+	unit_assert(udp_batch_run(3, 5) == 2);
+	unit_assert(udp_batch_run(1, 5) == 0);
+}
+
+#include "services/listen_dnsport.h"
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#endif
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(HAVE_LINUX_FILTER_H) && \
+	defined(HAVE_SCHED_SETAFFINITY) && defined(CPU_SET)
+/** send a datagram to the reuseport group, from the cpu this thread is
+ * pinned to, and return the number of the socket that got it */
+static int
+reuseport_recv(struct listen_port* lp, int num, struct sockaddr_in* a)
+{
+	char pkt[12];
+	int cl, i, r = -1;
+	memset(pkt, 0, sizeof(pkt));
+	unit_assert( (cl = socket(AF_INET, SOCK_DGRAM, 0)) != -1);
+	unit_assert(sendto(cl, pkt, sizeof(pkt), 0, (struct sockaddr*)a,
+		(socklen_t)sizeof(*a)) == (ssize_t)sizeof(pkt));
+	for(i=0; i<num; i++) {
+		if(recv(lp[i].fd, pkt, sizeof(pkt), MSG_DONTWAIT) ==
+			(ssize_t)sizeof(pkt)) {
+			unit_assert(r == -1);
+			r = i;
+		}
+	}
+	close(cl);
+	return r;
+}
+
+/** test that the reuseport bpf program selects the socket of the thread
+ * that is pinned to the cpu, in the order the sockets are opened */
+static void
+reuseport_bpf_test(void)
+{
+	struct listen_port lp[3];
+	struct sockaddr_in a;
+	socklen_t alen = (socklen_t)sizeof(a);
+	cpu_set_t old, set;
+	int cpus[3], cpu, i, t, inuse, noproto, reuse;
+	unit_show_feature("reuseport bpf");
+	/* the loopback packets are received on the cpu of the sender */
+	unit_assert(sched_getaffinity(0, sizeof(old), &old) == 0);
+	for(cpu=0; cpu<CPU_SETSIZE && !CPU_ISSET(cpu, &old); cpu++)
+		;
+	unit_assert(cpu < CPU_SETSIZE);
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	unit_assert(sched_setaffinity(0, sizeof(set), &set) == 0);
+	memset(&a, 0, sizeof(a));
+	a.sin_family = AF_INET;
+	a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	/* the sockets of the threads, opened in thread order */
+	for(i=0; i<3; i++) {
+		reuse = 1;
+		lp[i].next = NULL;
+		lp[i].ftype = listen_type_udp;
+		lp[i].fd = create_udp_sock(AF_INET, SOCK_DGRAM,
+			(struct sockaddr*)&a, alen, 0, &inuse, &noproto, 0, 0,
+			1, &reuse, 0);
+		unit_assert(lp[i].fd != -1 && reuse);
+		if(i == 0)
+			unit_assert(getsockname(lp[0].fd, (struct sockaddr*)&a,
+				&alen) == 0);
+	}
+	/* thread t is pinned to the cpu */
+	for(t=0; t<3; t++) {
+		for(i=0; i<3; i++)
+			cpus[i] = (i==t)?cpu:cpu+1+i;
+		unit_assert(listening_ports_reuseport_bpf(&lp[0], cpus, 3, 3));
+		unit_assert(reuseport_recv(lp, 3, &a) == t);
+	}
+	/* no thread is pinned to the cpu */
+	for(i=0; i<3; i++)
+		cpus[i] = cpu+1+i;
+	unit_assert(listening_ports_reuseport_bpf(&lp[0], cpus, 3, 3));
+	unit_assert(reuseport_recv(lp, 3, &a) == cpu%3);
+	for(i=0; i<3; i++)
+		close(lp[i].fd);
+	unit_assert(sched_setaffinity(0, sizeof(old), &old) == 0);
+}
+#endif /* SO_ATTACH_REUSEPORT_CBPF && HAVE_LINUX_FILTER_H && affinity */
+
+/** the state of a timer in the timer wheel test */
+struct comm_timer_testdata {
+	/** the timer */
+	struct comm_timer* timer;
+	/** the base of the timer */
+	struct comm_base* base;
+	/** number of times the callback ran */
+	int fired;
+	/** the msec of the wheel that the callback ran for last; if the
+	 * wheel runs late, it is earlier than the time of the base */
+	uint64_t when;
+	/** if not NULL, the callback disables this timer */
+	struct comm_timer* disable;
+	/** if not NULL, the callback sets the timer again with it */
+	struct timeval* reset;
+};
+
+/** timer callback for the timer wheel test, arg is comm_timer_testdata */
+static void
+test_comm_timer_cb(void* arg)
+{
+	struct comm_timer_testdata* d = (struct comm_timer_testdata*)arg;
+	d->fired++;
+	d->when = comm_wheel_cur(d->base);
+	if(d->disable)
+		comm_timer_disable(d->disable);
+	if(d->reset)
+		comm_timer_set(d->timer, d->reset);
+}
+
+/** set the msec time of the base, the time of day is not used */
+static void
+wheel_set_time(struct comm_base* base, uint64_t ms)
+{
+	time_t* tt;
+	struct timeval* tv;
+	comm_base_timept(base, &tt, &tv);
+	tv->tv_sec = (time_t)(ms/1000);
+	tv->tv_usec = (int)(ms%1000)*1000;
+	*tt = tv->tv_sec;
+}
+
+/** run the wheel at the msec time */
+static void
+wheel_run_at(struct comm_base* base, uint64_t ms)
+{
+	wheel_set_time(base, ms);
+	comm_wheel_run(base);
+}
+
+/** set the timer for msec */
+static void
+wheel_set(struct comm_timer_testdata* d, uint64_t ms)
+{
+	struct timeval tv;
+	tv.tv_sec = (time_t)(ms/1000);
+	tv.tv_usec = (int)(ms%1000)*1000;
+	comm_timer_set(d->timer, &tv);
+}
+
+/** check that a timer set for msec runs then, and not before */
+static void
+wheel_expire_test(struct comm_base* base, struct comm_timer_testdata* d,
+	uint64_t start, uint64_t ms)
+{
+	d->fired = 0;
+	d->when = 0;
+	wheel_set_time(base, start);
+	wheel_set(d, ms);
+	unit_assert(comm_timer_is_set(d->timer));
+	/* in steps, so that the slots cascade on the way */
+	wheel_run_at(base, start + ms/3);
+	wheel_run_at(base, start + ms - 1);
+	unit_assert(d->fired == 0 && comm_timer_is_set(d->timer));
+	wheel_run_at(base, start + ms);
+	unit_assert(d->fired == 1 && d->when == start + ms);
+	unit_assert(!comm_timer_is_set(d->timer));
+}
+
+/** test the timer wheel with a fake time */
+static void
+timer_wheel_test(void)
+{
+	/* around the boundaries of the levels, and above the 2**24 msec
+	 * of the wheel, that cascade again from the top level */
+	uint64_t ms[] = {1, 2, 63, 64, 65, 127, 128, 4095, 4096, 4097,
+		262143, 262144, 262145, 16777215, 16777216, 16777217,
+		3*16777216+12345};
+	struct comm_timer_testdata d[4];
+	struct comm_base* base;
+	struct timeval rs;
+	/* not aligned to the slots */
+	uint64_t now = (uint64_t)1000000*1000 + 12345;
+	size_t i, k;
+	unit_show_feature("timer wheel");
+	unit_assert( (base = comm_base_create(0)) );
+	wheel_set_time(base, now);
+	memset(d, 0, sizeof(d));
+	fptr_whitelist_test_add((fptr_test_func_type)&test_comm_timer_cb);
+	for(i=0; i<4; i++) {
+		d[i].base = base;
+		d[i].timer = comm_timer_create_wheel(base, test_comm_timer_cb,
+			&d[i]);
+		unit_assert(d[i].timer);
+	}
+
+	/* one timer at a time, and with a timer that waits longer, so
+	 * that the wheel is not empty when it is set */
+	for(i=0; i<sizeof(ms)/sizeof(ms[0]); i++) {
+		wheel_expire_test(base, &d[0], now, ms[i]);
+		now += ms[i];
+	}
+	wheel_set(&d[1], (uint64_t)1000000000);
+	for(i=0; i<sizeof(ms)/sizeof(ms[0]); i++) {
+		for(k=0; k<3; k++) {
+			wheel_expire_test(base, &d[0], now, ms[i]);
+			now += ms[i] + 1 + k*7;
+		}
+	}
+	unit_assert(d[1].fired == 0);
+	comm_timer_disable(d[1].timer);
+	unit_assert(!comm_timer_is_set(d[1].timer));
+
+	/* the event of the wheel is late, the timers run in one go */
+	for(i=0; i<4; i++)
+		d[i].fired = 0;
+	wheel_set_time(base, now);
+	wheel_set(&d[0], 5);
+	wheel_set(&d[1], 70);
+	wheel_set(&d[2], 4100);
+	wheel_set(&d[3], 300000);
+	wheel_run_at(base, now + 400000);
+	for(i=0; i<4; i++)
+		unit_assert(d[i].fired == 1);
+	unit_assert(d[0].when == now + 5 && d[1].when == now + 70 &&
+		d[2].when == now + 4100 && d[3].when == now + 300000);
+	now += 400000;
+
+	/* the time moves on and the wheel has not run, its cur lags,
+	 * a new timer is relative to the time, not to cur */
+	for(i=0; i<4; i++)
+		d[i].fired = 0;
+	wheel_set_time(base, now);
+	wheel_set(&d[0], 10000);
+	wheel_set_time(base, now + 5000);
+	wheel_set(&d[1], 100);
+	wheel_run_at(base, now + 5099);
+	unit_assert(d[0].fired == 0 && d[1].fired == 0);
+	wheel_run_at(base, now + 5100);
+	unit_assert(d[0].fired == 0 && d[1].fired == 1 &&
+		d[1].when == now + 5100);
+	wheel_run_at(base, now + 9999);
+	unit_assert(d[0].fired == 0);
+	wheel_run_at(base, now + 10000);
+	unit_assert(d[0].fired == 1 && d[0].when == now + 10000);
+	now += 10000;
+
+	/* the callback disables a timer of the same msec, and of a later
+	 * msec, and sets its own timer again; the wheel runs late, the
+	 * timers run in the msec they are set for */
+	for(i=0; i<4; i++)
+		d[i].fired = 0;
+	wheel_set_time(base, now);
+	wheel_set(&d[0], 100);
+	wheel_set(&d[1], 100);
+	wheel_set(&d[2], 150);
+	d[0].disable = d[1].timer;
+	rs.tv_sec = 0;
+	rs.tv_usec = 50000;
+	d[0].reset = &rs;
+	d[3].disable = d[2].timer;
+	wheel_set(&d[3], 120);
+	wheel_run_at(base, now + 100);
+	unit_assert(d[0].fired == 1 && d[1].fired == 0);
+	unit_assert(comm_timer_is_set(d[0].timer));
+	unit_assert(!comm_timer_is_set(d[1].timer));
+	wheel_run_at(base, now + 149);
+	unit_assert(d[3].fired == 1 && d[3].when == now + 120);
+	unit_assert(!comm_timer_is_set(d[2].timer));
+	d[0].reset = NULL;
+	wheel_run_at(base, now + 1000);
+	unit_assert(d[0].fired == 2 && d[0].when == now + 150);
+	unit_assert(d[1].fired == 0 && d[2].fired == 0);
+	for(i=0; i<4; i++)
+		unit_assert(!comm_timer_is_set(d[i].timer));
+
+	for(i=0; i<4; i++)
+		comm_timer_delete(d[i].timer);
+	comm_base_delete(base);
+}
+
 void unit_show_func(const char* file, const char* func)
 {
 	printf("test %s:%s\n", file, func);
@@ -577,17 +1301,30 @@ main(int argc, char* argv[])
 	checklock_start();
 	neg_test();
 	rnd_test();
+	hash_test();
 	verify_test();
 	net_test();
 	config_memsize_test();
 	dname_test();
 	rtt_test();
+	rtt_sketch_test();
 	anchors_test();
 	alloc_test();
+	rrset_name_test();
 	regional_test();
 	lruhash_test();
 	slabhash_test();
 	infra_test();
+	inflight_test();
+	cachesnap_test();
+	outnet_pool_test();
+	udp_batch_test();
+	tcp_test();
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(HAVE_LINUX_FILTER_H) && \
+	defined(HAVE_SCHED_SETAFFINITY) && defined(CPU_SET)
+	reuseport_bpf_test();
+#endif
+	timer_wheel_test();
 	ldns_test();
 	msgparse_test();
 	checklock_stop();
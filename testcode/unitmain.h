@@ -41,6 +41,7 @@
 #ifndef TESTCODE_UNITMAIN_H
 #define TESTCODE_UNITMAIN_H
 #include "util/log.h"
+struct comm_base;
 
 /** number of tests done */
 extern int testcount;
@@ -74,5 +75,11 @@ void neg_test(void);
 void regional_test(void);
 /** unit test for ldns functions */
 void ldns_test(void);
+/** unit test for the cache snapshot */
+void cachesnap_test(void);
+/** unit test for the tcp streams */
+void tcp_test(void);
+/** run the event loop of the base for msec milliseconds */
+void test_base_run(struct comm_base* base, int msec);
 
 #endif /* TESTCODE_UNITMAIN_H */
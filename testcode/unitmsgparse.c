@@ -309,6 +309,55 @@ check_the_rrsigs(struct query_info* qinfo, struct reply_info* rep)
 	}
 }
 
+/** check that the pre-encoded answer is the same as the encoded answer */
+static void
+check_wire(struct query_info* qi, struct reply_info* rep, uint16_t id,
+	uint16_t flags, size_t cap, struct regional* region,
+	struct edns_data* edns)
+{
+	sldns_buffer* wbuf, *ebuf;
+	struct reply_wire* w;
+	int dnssec = (edns->bits & EDNS_DO)?1:0;
+	time_t later = 5;
+	/* only responses are stored in the cache and answered from it */
+	if(!(rep->flags & BIT_QR))
+		return;
+	wbuf = sldns_buffer_new(cap);
+	ebuf = sldns_buffer_new(cap);
+	unit_assert(wbuf && ebuf);
+	w = reply_wire_create(qi, rep, ebuf, 0, region, dnssec);
+	if(!w) {
+		/* only if it does not fit */
+		sldns_buffer_free(wbuf);
+		sldns_buffer_free(ebuf);
+		return;
+	}
+	unit_assert(reply_wire_valid(w, rep, later));
+	unit_assert(!reply_wire_valid(w, rep, -1));
+	if(rep->rrset_count > 0) {
+		/* new data with the same address and ttl is stale */
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			rep->rrsets[0]->entry.data;
+		d->version++;
+		unit_assert(!reply_wire_valid(w, rep, later));
+		d->version--;
+	}
+	unit_assert(reply_wire_answer(w, qi, rep, id, flags, wbuf, later,
+		65535, edns, dnssec, 0));
+	unit_assert(reply_info_answer_encode(qi, rep, id, flags, ebuf, later,
+		1, region, 65535, edns, dnssec, 0));
+	unit_assert(sldns_buffer_limit(ebuf) == sldns_buffer_limit(wbuf));
+	unit_assert(memcmp(sldns_buffer_begin(ebuf), sldns_buffer_begin(wbuf),
+		sldns_buffer_limit(ebuf)) == 0);
+	/* an answer that does not fit is left to the normal encoder */
+	if(w->len > LDNS_HEADER_SIZE)
+		unit_assert(!reply_wire_answer(w, qi, rep, id, flags, wbuf,
+			later, (uint16_t)w->len - 1, edns, dnssec, 0));
+	free(w);
+	sldns_buffer_free(wbuf);
+	sldns_buffer_free(ebuf);
+}
+
 /** test a packet */
 static void
 testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out, 
@@ -352,6 +401,9 @@ testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
 			test_buffers(pkt, out);
 		if(check_rrsigs)
 			check_the_rrsigs(&qi, rep);
+		if(!RRSET_ROUNDROBIN)
+			check_wire(&qi, rep, id, flags,
+				sldns_buffer_capacity(out), region, &edns);
 
 		if(sldns_buffer_limit(out) > lim) {
 			ret = reply_info_encode(&qi, rep, id, flags, out, 
@@ -191,6 +191,54 @@ check_table(struct slabhash* table)
 		check_lru_table(table->array[i]);
 }
 
+/** test moving the entries to tables with other sizes and slabs */
+static void
+test_migrate(void)
+{
+	size_t sz = test_slabhash_sizefunc(NULL, NULL);
+	struct slabhash* a, *b, *c;
+	struct lruhash_entry* e;
+	testkey_t* k;
+	int i;
+	a = slabhash_create(4, 2, 100*sz, test_slabhash_sizefunc,
+		test_slabhash_compfunc, test_slabhash_delkey,
+		test_slabhash_deldata, NULL);
+	b = slabhash_create(2, 2, 100*sz, test_slabhash_sizefunc,
+		test_slabhash_compfunc, test_slabhash_delkey,
+		test_slabhash_deldata, NULL);
+	c = slabhash_create(1, 2, 5*sz, test_slabhash_sizefunc,
+		test_slabhash_compfunc, test_slabhash_delkey,
+		test_slabhash_deldata, NULL);
+	unit_assert(a && b && c);
+	for(i=0; i<20; i++) {
+		k = newkey(i);
+		k->entry.data = newdata(i);
+		slabhash_insert(a, myhash(i), &k->entry, k->entry.data, NULL);
+	}
+	/* larger: all entries are kept */
+	slabhash_migrate(b, a, NULL);
+	unit_assert(count_slabhash_entries(a) == 0);
+	unit_assert(count_slabhash_entries(b) == 20);
+	check_table(a);
+	check_table(b);
+	k = newkey(0);
+	for(i=0; i<20; i++) {
+		k->id = i;
+		e = slabhash_lookup(b, myhash(i), k, 0);
+		unit_assert(e && ((testdata_t*)e->data)->data == i);
+		lock_rw_unlock(&e->lock);
+	}
+	/* smaller: the entries that do not fit are deleted */
+	slabhash_migrate(c, b, NULL);
+	unit_assert(count_slabhash_entries(b) == 0);
+	unit_assert(count_slabhash_entries(c) == 5);
+	check_table(c);
+	delkey(k);
+	slabhash_delete(a);
+	slabhash_delete(b);
+	slabhash_delete(c);
+}
+
 /** test adding a random element (unlimited range) */
 static void
 testadd_unlim(struct slabhash* table, testdata_t** ref)
@@ -373,4 +421,5 @@ void slabhash_test(void)
 		test_slabhash_delkey, test_slabhash_deldata, NULL);
 	test_threaded_table(table);
 	slabhash_delete(table);
+	test_migrate();
 }
@@ -0,0 +1,662 @@
+/*
+ * testcode/unittcp.c - unit test for the tcp streams.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * \file
+ * Tests the tcp streams over the loopback interface.  The replay tests
+ * run with a fake network and cannot reach this code, here the test
+ * is the peer on the other end of the stream, it reads and writes with
+ * blocking calls while the event loop of the code under test is not
+ * running.
+ */
+
+#include "config.h"
+#include <sys/time.h>
+#include <signal.h>
+#include "testcode/unitmain.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "util/netevent.h"
+#include "util/config_file.h"
+#include "util/random.h"
+#include "util/fptr_wlist.h"
+#include "services/outside_network.h"
+#include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+#include "sldns/rrdef.h"
+
+/** open a listening tcp socket on the loopback address, with a port
+ * picked by the system, that is returned in addr */
+static int
+tcp_test_listen(struct sockaddr_storage* addr, socklen_t* addrlen)
+{
+	struct sockaddr_in a;
+	socklen_t alen = (socklen_t)sizeof(a);
+	int s;
+	memset(&a, 0, sizeof(a));
+	a.sin_family = AF_INET;
+	a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	unit_assert( (s = socket(AF_INET, SOCK_STREAM, 0)) != -1);
+	unit_assert(bind(s, (struct sockaddr*)&a, alen) == 0);
+	unit_assert(getsockname(s, (struct sockaddr*)&a, &alen) == 0);
+	unit_assert(listen(s, 8) == 0);
+	memcpy(addr, &a, alen);
+	*addrlen = alen;
+	return s;
+}
+
+/** set a timeout on the blocking reads of the test, so that a stream
+ * that does not get the data fails the test, and does not hang it */
+static void
+tcp_test_rcvtimeo(int s)
+{
+	struct timeval tv;
+	tv.tv_sec = 2;
+	tv.tv_usec = 0;
+	unit_assert(setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (void*)&tv,
+		(socklen_t)sizeof(tv)) == 0);
+}
+
+/** connect to the listening socket, with a blocking stream */
+static int
+tcp_test_connect(struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	int fd;
+	unit_assert( (fd = socket(AF_INET, SOCK_STREAM, 0)) != -1);
+	unit_assert(connect(fd, (struct sockaddr*)addr, addrlen) == 0);
+	tcp_test_rcvtimeo(fd);
+	return fd;
+}
+
+/** accept a connection on the listening socket */
+static int
+tcp_test_accept(int s)
+{
+	int fd;
+	tcp_test_rcvtimeo(s);
+	unit_assert( (fd = accept(s, NULL, NULL)) != -1);
+	tcp_test_rcvtimeo(fd);
+	return fd;
+}
+
+/** read len bytes from the stream */
+static void
+tcp_test_read(int fd, uint8_t* buf, size_t len)
+{
+	size_t done = 0;
+	ssize_t r;
+	while(done < len) {
+		r = recv(fd, (void*)(buf+done), len-done, 0);
+		unit_assert(r > 0);
+		done += (size_t)r;
+	}
+}
+
+/** read a dns message, with the tcp length in front of it, into buf,
+ * that has room for max bytes; returns the length of the message */
+static size_t
+tcp_test_read_msg(int fd, uint8_t* buf, size_t max)
+{
+	uint8_t l[2];
+	size_t len;
+	tcp_test_read(fd, l, sizeof(l));
+	len = (size_t)sldns_read_uint16(l);
+	unit_assert(len >= LDNS_HEADER_SIZE && len <= max);
+	tcp_test_read(fd, buf, len);
+	return len;
+}
+
+/** write a dns message, with the tcp length in front of it */
+static void
+tcp_test_write_msg(int fd, uint8_t* msg, size_t len)
+{
+	uint8_t l[2];
+	sldns_write_uint16(l, (uint16_t)len);
+	unit_assert(send(fd, (void*)l, sizeof(l), 0) == (ssize_t)sizeof(l));
+	unit_assert(send(fd, (void*)msg, len, 0) == (ssize_t)len);
+}
+
+/** write the answer to the query, that is the query with the QR flag */
+static void
+tcp_test_answer(int fd, uint8_t* qry, size_t len)
+{
+	LDNS_QR_SET(qry);
+	tcp_test_write_msg(fd, qry, len);
+}
+
+/** make a query for the root A record */
+static void
+tcp_test_make_query(sldns_buffer* pkt, uint16_t id)
+{
+	int i;
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, id);
+	for(i=2; i<LDNS_HEADER_SIZE; i++)
+		sldns_buffer_write_u8(pkt, 0);
+	sldns_buffer_write_at(pkt, 5, "\001", 1); /* qdcount 1 */
+	sldns_buffer_write_u8(pkt, 0);
+	sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_A);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	sldns_buffer_flip(pkt);
+}
+
+/** the state of a query to the upstream test server */
+struct outnet_tcp_testq {
+	/** the query, the ID is in it */
+	struct waiting_tcp* w;
+	/** the ID of the query, as it is sent on the stream */
+	uint16_t id;
+	/** number of callbacks */
+	int num_cb;
+	/** the error of the callback */
+	int error;
+	/** the order in which the reply came in */
+	int order;
+};
+
+/** number of replies the outnet tcp test has seen */
+static int outnet_tcp_test_replies;
+
+/** callback for the queries of the outnet tcp test */
+static int
+outnet_tcp_test_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	struct outnet_tcp_testq* q = (struct outnet_tcp_testq*)arg;
+	q->num_cb++;
+	q->error = error;
+	if(error == NETEVENT_NOERROR) {
+		/* the reply is matched to the query by its ID */
+		unit_assert(c && sldns_buffer_limit(c->buffer) >=
+			LDNS_HEADER_SIZE);
+		unit_assert(LDNS_ID_WIRE(sldns_buffer_begin(c->buffer)) ==
+			q->id);
+		unit_assert(LDNS_QR_WIRE(sldns_buffer_begin(c->buffer)));
+		q->order = ++outnet_tcp_test_replies;
+	}
+	return 0;
+}
+
+/** send a query on the outnet tcp streams */
+static void
+outnet_tcp_test_query(struct serviced_query* sq, sldns_buffer* pkt,
+	struct outnet_tcp_testq* q)
+{
+	memset(q, 0, sizeof(*q));
+	tcp_test_make_query(pkt, 0);
+	q->w = pending_tcp_query(sq, pkt, 5, outnet_tcp_test_cb, q);
+	unit_assert(q->w);
+	q->id = q->w->id;
+}
+
+/** read a query from the stream, that is one of the two test queries,
+ * and return the one it is; the message is put in buf */
+static struct outnet_tcp_testq*
+outnet_tcp_test_read(int fd, uint8_t* buf, size_t* len,
+	struct outnet_tcp_testq* q1, struct outnet_tcp_testq* q2)
+{
+	*len = tcp_test_read_msg(fd, buf, 512);
+	if(LDNS_ID_WIRE(buf) == q1->id)
+		return q1;
+	unit_assert(LDNS_ID_WIRE(buf) == q2->id);
+	return q2;
+}
+
+/** check the number of open and idle upstream connections */
+static void
+outnet_tcp_test_counts(struct outside_network* outnet, size_t num_open,
+	size_t num_idle)
+{
+	size_t o, i;
+	outnet_tcp_get_counts(outnet, &o, &i);
+	unit_assert(o == num_open && i == num_idle);
+}
+
+/** test the reuse of upstream tcp streams: pipelined queries that are
+ * answered out of order, requeue of the queries on a reused stream that
+ * the server closes, and the close of an idle stream */
+static void
+outnet_tcp_test(void)
+{
+	struct comm_base* base;
+	struct ub_randstate* rnd;
+	struct config_file* cfg;
+	struct outside_network* outnet;
+	struct serviced_query sq;
+	struct outnet_tcp_testq q1, q2, *a, *b;
+	struct pending_tcp* pend;
+	sldns_buffer* pkt;
+	uint8_t m1[512], m2[512];
+	size_t l1, l2;
+	char* ifs[1];
+	int* ports = NULL;
+	int numports, s, fd;
+	unit_show_feature("upstream tcp reuse");
+	ifs[0] = "127.0.0.1";
+	unit_assert( (base = comm_base_create(0)) );
+	unit_assert( (rnd = ub_initstate((unsigned)time(NULL), NULL)) );
+	unit_assert( (cfg = config_create()) );
+	numports = cfg_condense_ports(cfg, &ports);
+	unit_assert(numports > 0 && ports);
+	/* two tcp buffers, idle streams are kept for 200 msec */
+	outnet = outside_network_create(base, 4096, 8, ifs, 1, 1, 0, 2,
+		NULL, rnd, 0, ports, numports, 0, NULL, NULL, 1, NULL, 0,
+		NULL, 200, 100, 0, 0, 0);
+	unit_assert(outnet);
+	fptr_whitelist_test_add((fptr_test_func_type)&outnet_tcp_test_cb);
+	memset(&sq, 0, sizeof(sq));
+	sq.outnet = outnet;
+	s = tcp_test_listen(&sq.addr, &sq.addrlen);
+	unit_assert( (pkt = sldns_buffer_new(512)) );
+
+	/* two queries are pipelined on one stream, the server answers
+	 * the second one first */
+	outnet_tcp_test_replies = 0;
+	outnet_tcp_test_query(&sq, pkt, &q1);
+	outnet_tcp_test_query(&sq, pkt, &q2);
+	unit_assert(q1.w->pend && q1.w->pend == q2.w->pend);
+	unit_assert(q1.id != q2.id);
+	pend = q1.w->pend;
+	test_base_run(base, 50);
+	fd = tcp_test_accept(s);
+	a = outnet_tcp_test_read(fd, m1, &l1, &q1, &q2);
+	b = outnet_tcp_test_read(fd, m2, &l2, &q1, &q2);
+	unit_assert(a != b);
+	tcp_test_answer(fd, m2, l2);
+	tcp_test_answer(fd, m1, l1);
+	test_base_run(base, 50);
+	unit_assert(q1.num_cb == 1 && q1.error == NETEVENT_NOERROR);
+	unit_assert(q2.num_cb == 1 && q2.error == NETEVENT_NOERROR);
+	unit_assert(b->order == 1 && a->order == 2);
+	/* the stream is kept open, for the next queries */
+	outnet_tcp_test_counts(outnet, 1, 1);
+
+	/* the queries are sent on the reused stream, the server closes
+	 * it without an answer, they are sent again on a new stream */
+	outnet_tcp_test_query(&sq, pkt, &q1);
+	outnet_tcp_test_query(&sq, pkt, &q2);
+	unit_assert(q1.w->pend == pend && q2.w->pend == pend);
+	outnet_tcp_test_counts(outnet, 1, 0);
+	test_base_run(base, 50);
+	(void)outnet_tcp_test_read(fd, m1, &l1, &q1, &q2);
+	(void)outnet_tcp_test_read(fd, m2, &l2, &q1, &q2);
+	close(fd);
+	test_base_run(base, 50);
+	unit_assert(q1.num_cb == 0 && q2.num_cb == 0);
+	fd = tcp_test_accept(s);
+	a = outnet_tcp_test_read(fd, m1, &l1, &q1, &q2);
+	b = outnet_tcp_test_read(fd, m2, &l2, &q1, &q2);
+	unit_assert(a != b);
+	tcp_test_answer(fd, m1, l1);
+	tcp_test_answer(fd, m2, l2);
+	test_base_run(base, 50);
+	unit_assert(q1.num_cb == 1 && q1.error == NETEVENT_NOERROR);
+	unit_assert(q2.num_cb == 1 && q2.error == NETEVENT_NOERROR);
+	unit_assert(a->order == 3 && b->order == 4);
+	outnet_tcp_test_counts(outnet, 1, 1);
+
+	/* the idle stream is closed after the reuse timeout */
+	test_base_run(base, 400);
+	outnet_tcp_test_counts(outnet, 0, 0);
+	unit_assert(recv(fd, (void*)m1, sizeof(m1), 0) == 0);
+	close(fd);
+
+	outside_network_delete(outnet);
+	close(s);
+	sldns_buffer_free(pkt);
+	free(ports);
+	config_delete(cfg);
+	ub_randfree(rnd);
+	comm_base_delete(base);
+}
+
+/** the maximum number of queries the incoming tcp tests read */
+#define TCP_IN_TEST_MAX 16
+/** number of queries the incoming tcp test callback has read */
+static int tcp_in_num;
+/** number of errors the incoming tcp test callback has seen */
+static int tcp_in_err;
+/** the reply info of the queries, in the order they are read */
+static struct comm_reply tcp_in_rep[TCP_IN_TEST_MAX];
+/** the IDs of the queries, in the order they are read */
+static uint16_t tcp_in_id[TCP_IN_TEST_MAX];
+
+/** callback for the incoming tcp test, keeps the query, and answers it
+ * later, like the mesh does */
+static int
+tcp_in_test_cb(struct comm_point* c, void* ATTR_UNUSED(arg), int error,
+	struct comm_reply* repinfo)
+{
+	if(error != NETEVENT_NOERROR) {
+		tcp_in_err++;
+		return 0;
+	}
+	unit_assert(tcp_in_num < TCP_IN_TEST_MAX);
+	unit_assert(sldns_buffer_limit(c->buffer) >= LDNS_HEADER_SIZE);
+	tcp_in_id[tcp_in_num] = LDNS_ID_WIRE(sldns_buffer_begin(c->buffer));
+	tcp_in_rep[tcp_in_num] = *repinfo;
+	tcp_in_num++;
+	return 0;
+}
+
+/** answer the i-th query of the incoming tcp test */
+static void
+tcp_in_answer(int i)
+{
+	sldns_buffer* buf = tcp_in_rep[i].c->buffer;
+	tcp_test_make_query(buf, tcp_in_id[i]);
+	LDNS_QR_SET(sldns_buffer_begin(buf));
+	comm_point_send_reply(&tcp_in_rep[i]);
+}
+
+/** send a query with the ID from the client */
+static void
+tcp_in_send(int fd, sldns_buffer* pkt, uint16_t id)
+{
+	tcp_test_make_query(pkt, id);
+	tcp_test_write_msg(fd, sldns_buffer_begin(pkt),
+		sldns_buffer_limit(pkt));
+}
+
+/** read the answer with the ID on the client */
+static void
+tcp_in_recv(int fd, uint16_t id)
+{
+	uint8_t buf[512];
+	(void)tcp_test_read_msg(fd, buf, sizeof(buf));
+	unit_assert(LDNS_ID_WIRE(buf) == id && LDNS_QR_WIRE(buf));
+}
+
+/** create the tcp accept comm point of the incoming tcp test, with
+ * the pipeline setting, the address is returned in addr */
+static struct comm_point*
+tcp_in_create(struct comm_base* base, int num, int pipeline,
+	struct sockaddr_storage* addr, socklen_t* addrlen)
+{
+	struct comm_point* c;
+	int s = tcp_test_listen(addr, addrlen);
+	unit_assert(fd_set_nonblock(s));
+	unit_assert( (c = comm_point_create_tcp(base, s, num, 4096,
+		tcp_in_test_cb, NULL)) );
+	comm_point_tcp_set_pipeline(c, pipeline);
+	tcp_in_num = 0;
+	tcp_in_err = 0;
+	return c;
+}
+
+/** test pipelined incoming tcp: queries are read while earlier ones
+ * are resolved, answers are written when they are done */
+static void
+tcp_in_pipeline_test(void)
+{
+	struct comm_base* base;
+	struct comm_point* c, *h;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct linger lin;
+	sldns_buffer* pkt;
+	uint8_t part[512];
+	size_t partlen;
+	int cl;
+	unit_show_feature("incoming tcp pipeline");
+	unit_assert( (base = comm_base_create(0)) );
+	unit_assert( (pkt = sldns_buffer_new(512)) );
+	c = tcp_in_create(base, 2, 32, &addr, &addrlen);
+	unit_assert(c->tcp_pipeline_max == 32);
+
+	/* three queries are read before one of them is answered, and
+	 * the answers are written in the order they are done */
+	cl = tcp_test_connect(&addr, addrlen);
+	tcp_in_send(cl, pkt, 1);
+	tcp_in_send(cl, pkt, 2);
+	tcp_in_send(cl, pkt, 3);
+	test_base_run(base, 50);
+	unit_assert(tcp_in_num == 3);
+	unit_assert(tcp_in_id[0] == 1 && tcp_in_id[1] == 2 &&
+		tcp_in_id[2] == 3);
+	/* a query that is partly read is kept apart from the answers,
+	 * that are encoded in the shared buffer */
+	tcp_in_send(cl, pkt, 4);
+	test_base_run(base, 50);
+	unit_assert(tcp_in_num == 4);
+	tcp_test_make_query(pkt, 5);
+	sldns_write_uint16(part, (uint16_t)sldns_buffer_limit(pkt));
+	memmove(part+2, sldns_buffer_begin(pkt), sldns_buffer_limit(pkt));
+	partlen = sldns_buffer_limit(pkt)+2;
+	unit_assert(send(cl, (void*)part, 5, 0) == 5);
+	test_base_run(base, 50);
+	unit_assert(tcp_in_num == 4);
+	tcp_in_answer(2);
+	tcp_in_answer(0);
+	tcp_in_answer(3);
+	tcp_in_answer(1);
+	tcp_in_recv(cl, 3);
+	tcp_in_recv(cl, 1);
+	tcp_in_recv(cl, 4);
+	tcp_in_recv(cl, 2);
+	unit_assert(send(cl, (void*)(part+5), partlen-5, 0) ==
+		(ssize_t)partlen-5);
+	test_base_run(base, 50);
+	unit_assert(tcp_in_num == 5 && tcp_in_id[4] == 5);
+	tcp_in_answer(4);
+	tcp_in_recv(cl, 5);
+
+	/* at EOF, the outstanding answers are written, and then the
+	 * stream is closed */
+	tcp_in_send(cl, pkt, 6);
+	tcp_in_send(cl, pkt, 7);
+	unit_assert(shutdown(cl, SHUT_WR) == 0);
+	test_base_run(base, 50);
+	unit_assert(tcp_in_num == 7 && c->cur_tcp_count == 1);
+	tcp_in_answer(6);
+	tcp_in_answer(5);
+	tcp_in_recv(cl, 7);
+	tcp_in_recv(cl, 6);
+	unit_assert(recv(cl, (void*)part, 1, 0) == 0);
+	unit_assert(c->cur_tcp_count == 0 && tcp_in_err == 0);
+	close(cl);
+
+	/* the client is gone with the queries still being resolved, the
+	 * stream is closed, and the handler is free when they are done */
+	cl = tcp_test_connect(&addr, addrlen);
+	tcp_in_send(cl, pkt, 8);
+	tcp_in_send(cl, pkt, 9);
+	test_base_run(base, 50);
+	unit_assert(tcp_in_num == 9 && c->cur_tcp_count == 1);
+	h = tcp_in_rep[7].c;
+	lin.l_onoff = 1;
+	lin.l_linger = 0;
+	unit_assert(setsockopt(cl, SOL_SOCKET, SO_LINGER, (void*)&lin,
+		(socklen_t)sizeof(lin)) == 0);
+	close(cl);
+	test_base_run(base, 50);
+	tcp_in_answer(8);
+	unit_assert(h->fd == -1 && c->cur_tcp_count == 1);
+	unit_assert(c->tcp_free != h);
+	tcp_in_answer(7);
+	unit_assert(c->cur_tcp_count == 0 && c->tcp_free == h);
+
+	comm_point_delete(c);
+	sldns_buffer_free(pkt);
+	comm_base_delete(base);
+}
+
+/** test incoming-tcp-pipeline: 1, a query is read after the previous
+ * one is answered */
+static void
+tcp_in_sequential_test(void)
+{
+	struct comm_base* base;
+	struct comm_point* c;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	sldns_buffer* pkt;
+	int cl;
+	unit_show_feature("incoming tcp sequential");
+	unit_assert( (base = comm_base_create(0)) );
+	unit_assert( (pkt = sldns_buffer_new(512)) );
+	c = tcp_in_create(base, 2, 1, &addr, &addrlen);
+	unit_assert(c->tcp_pipeline_max == 0);
+
+	cl = tcp_test_connect(&addr, addrlen);
+	tcp_in_send(cl, pkt, 1);
+	tcp_in_send(cl, pkt, 2);
+	test_base_run(base, 50);
+	unit_assert(tcp_in_num == 1 && tcp_in_id[0] == 1);
+	tcp_in_answer(0);
+	test_base_run(base, 50);
+	tcp_in_recv(cl, 1);
+	unit_assert(tcp_in_num == 2 && tcp_in_id[1] == 2);
+	tcp_in_answer(1);
+	test_base_run(base, 50);
+	tcp_in_recv(cl, 2);
+	unit_assert(tcp_in_err == 0);
+	close(cl);
+
+	comm_point_delete(c);
+	sldns_buffer_free(pkt);
+	comm_base_delete(base);
+}
+
+/** test the tcp handlers of the accept comm point: they are created
+ * when connections need them, the stream that is idle the longest is
+ * closed when they are all in use, and accept waits when none is idle,
+ * until a stream is idle or closed */
+static void
+tcp_in_handlers_test(void)
+{
+	struct comm_base* base;
+	struct comm_point* c, *h0, *h1;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct timeval* now;
+	time_t* tt;
+	sldns_buffer* pkt;
+	uint8_t b[1];
+	int cl1, cl2, cl3, cl4, cl5;
+	unit_show_feature("incoming tcp handlers");
+	unit_assert( (base = comm_base_create(0)) );
+	unit_assert( (pkt = sldns_buffer_new(512)) );
+	c = tcp_in_create(base, 2, 32, &addr, &addrlen);
+	comm_base_timept(base, &tt, &now);
+
+	/* a handler is made for a connection, and it encodes answers in
+	 * the buffer of the accept comm point */
+	unit_assert(!c->tcp_handlers[0] && !c->tcp_handlers[1]);
+	cl1 = tcp_test_connect(&addr, addrlen);
+	test_base_run(base, 50);
+	unit_assert( (h0 = c->tcp_handlers[0]) && !c->tcp_handlers[1]);
+	unit_assert(c->cur_tcp_count == 1 && h0->buffer == c->buffer);
+	cl2 = tcp_test_connect(&addr, addrlen);
+	test_base_run(base, 50);
+	unit_assert( (h1 = c->tcp_handlers[1]) && c->cur_tcp_count == 2);
+	unit_assert(h1->buffer == c->buffer);
+
+	/* the handlers are all in use, the stream that is idle the
+	 * longest is closed for the new connection */
+	h0->tcp_last_active = *tt - 10;
+	h1->tcp_last_active = *tt - 5;
+	cl3 = tcp_test_connect(&addr, addrlen);
+	test_base_run(base, 50);
+	unit_assert(c->tcp_num_shed == 1 && c->cur_tcp_count == 2);
+	unit_assert(recv(cl1, (void*)b, 1, 0) == 0);
+	tcp_in_send(cl3, pkt, 3);
+	test_base_run(base, 50);
+	unit_assert(tcp_in_num == 1 && tcp_in_id[0] == 3);
+	unit_assert(tcp_in_rep[0].c == h0);
+
+	/* no stream is idle, accept waits for a handler */
+	tcp_in_send(cl2, pkt, 2);
+	test_base_run(base, 50);
+	unit_assert(tcp_in_num == 2 && tcp_in_rep[1].c == h1);
+	h0->tcp_last_active = *tt - 10;
+	h1->tcp_last_active = *tt - 10;
+	cl4 = tcp_test_connect(&addr, addrlen);
+	tcp_in_send(cl4, pkt, 4);
+	test_base_run(base, 50);
+	unit_assert(c->tcp_num_full == 1 && c->tcp_num_shed == 1);
+	unit_assert(tcp_in_num == 2 && c->cur_tcp_count == 2);
+
+	/* when a stream is idle, accept is tried again, and the waiting
+	 * connection gets its handler */
+	tcp_in_answer(0);
+	tcp_in_recv(cl3, 3);
+	test_base_run(base, 1500);
+	unit_assert(c->tcp_num_full == 1 && c->tcp_num_shed == 2);
+	unit_assert(tcp_in_num == 3 && tcp_in_id[2] == 4);
+	unit_assert(tcp_in_rep[2].c == h0 && c->cur_tcp_count == 2);
+	unit_assert(recv(cl3, (void*)b, 1, 0) == 0);
+
+	/* when a stream is done, the connection is accepted right away */
+	cl5 = tcp_test_connect(&addr, addrlen);
+	tcp_in_send(cl5, pkt, 5);
+	test_base_run(base, 50);
+	unit_assert(c->tcp_num_full == 2 && tcp_in_num == 3);
+	tcp_in_answer(1);
+	tcp_in_recv(cl2, 2);
+	close(cl2);
+	test_base_run(base, 50);
+	unit_assert(tcp_in_num == 4 && tcp_in_id[3] == 5);
+	unit_assert(tcp_in_rep[3].c == h1 && c->cur_tcp_count == 2);
+	tcp_in_answer(2);
+	tcp_in_recv(cl4, 4);
+	tcp_in_answer(3);
+	tcp_in_recv(cl5, 5);
+	unit_assert(c->tcp_num_full == 2 && c->tcp_num_shed == 2);
+	close(cl1);
+	close(cl3);
+	close(cl4);
+	close(cl5);
+
+	comm_point_delete(c);
+	sldns_buffer_free(pkt);
+	comm_base_delete(base);
+}
+
+void
+tcp_test(void)
+{
+	unit_show_func("services/outside_network.c", "pending_tcp_query");
+	outnet_tcp_test();
+#ifdef SIGPIPE
+	/* the answer to a client that is gone fails, not the test */
+	(void)signal(SIGPIPE, SIG_IGN);
+#endif
+	unit_show_func("util/netevent.c", "comm_point_tcp_set_pipeline");
+	fptr_whitelist_test_add((fptr_test_func_type)&tcp_in_test_cb);
+	tcp_in_pipeline_test();
+	tcp_in_sequential_test();
+	tcp_in_handlers_test();
+}
@@ -56,6 +56,7 @@
 #include "util/fptr_wlist.h"
 #include "util/data/dname.h"
 #include "util/rtt.h"
+#include "util/storage/lookup3.h"
 #include "services/cache/infra.h"
 #include "sldns/wire2str.h"
 #include "sldns/parseutil.h"
@@ -121,10 +122,20 @@ config_create(void)
 	cfg->outgoing_num_tcp = 2; /* leaves 64-52=12 for: 4if,1stop,thread4 */
 	cfg->incoming_num_tcp = 2; 
 #endif
+	cfg->incoming_tcp_pipeline = 32;
+	cfg->tcp_reuse_timeout = 60000;
+	cfg->max_reuse_tcp_queries = 200;
 	cfg->edns_buffer_size = 4096; /* 4k from rfc recommendation */
 	cfg->msg_buffer_size = 65552; /* 64 k + a small margin */
 	cfg->msg_cache_size = 4 * 1024 * 1024;
 	cfg->msg_cache_slabs = 4;
+	cfg->lockfree_cache_lookup = 0;
+	cfg->msg_cache_wire = 0;
+	cfg->cache_open_addressing = 0;
+	cfg->cache_admission = 0;
+	cfg->coalesce_queries = 0;
+	cfg->outgoing_port_pool = 0;
+	cfg->outgoing_port_lifetime = 60;
 	cfg->jostle_time = 200;
 	cfg->rrset_cache_size = 4 * 1024 * 1024;
 	cfg->rrset_cache_slabs = 4;
@@ -135,9 +146,16 @@ config_create(void)
 	cfg->max_negative_ttl = 3600;
 	cfg->prefetch = 0;
 	cfg->prefetch_key = 0;
+	cfg->serve_expired = 0;
+	cfg->serve_expired_ttl = 86400;
+	cfg->serve_expired_reply_ttl = 30;
+	cfg->cache_snapshot_file = NULL;
+	cfg->cache_snapshot_interval = 3600;
 	cfg->infra_cache_slabs = 4;
 	cfg->infra_cache_numhosts = 10000;
 	cfg->infra_cache_min_rtt = 50;
+	cfg->infra_rtt_percentile = 0;
+	cfg->hedge_query_budget = 0;
 	cfg->delay_close = 0;
 	if(!(cfg->outgoing_avail_ports = (int*)calloc(65536, sizeof(int))))
 		goto error_exit;
@@ -158,6 +176,10 @@ config_create(void)
 	cfg->so_rcvbuf = 0;
 	cfg->so_sndbuf = 0;
 	cfg->so_reuseport = 0;
+	cfg->so_reuseport_bpf = 0;
+	cfg->so_incoming_cpu = 0;
+	cfg->cpu_affinity = NULL;
+	cfg->udp_batch_size = 0;
 	cfg->ip_transparent = 0;
 	cfg->num_ifs = 0;
 	cfg->ifs = NULL;
@@ -203,6 +225,7 @@ config_create(void)
 	cfg->key_cache_size = 4 * 1024 * 1024;
 	cfg->key_cache_slabs = 4;
 	cfg->neg_cache_size = 1 * 1024 * 1024;
+	cfg->aggressive_nsec = 0;
 	cfg->local_zones = NULL;
 	cfg->local_zones_nodefault = NULL;
 	cfg->local_data = NULL;
@@ -225,12 +248,21 @@ config_create(void)
 		goto error_exit;
 
 	if(!(cfg->module_conf = strdup("validator iterator"))) goto error_exit;
+	if(!(cfg->hash_function = strdup("wyhash"))) goto error_exit;
 	if(!(cfg->val_nsec3_key_iterations = 
 		strdup("1024 150 2048 500 4096 2500"))) goto error_exit;
 #if defined(DNSTAP_SOCKET_PATH)
 	if(!(cfg->dnstap_socket_path = strdup(DNSTAP_SOCKET_PATH)))
 		goto error_exit;
 #endif
+	if(!(cfg->dnstap_ip = strdup("127.0.0.1@5354"))) goto error_exit;
+	cfg->dnstap_file = NULL;
+	cfg->dnstap_file_rotate_size = 0;
+	cfg->dnstap_flush_size = 64*1024;
+	cfg->dnstap_flush_time = 100;
+	if(!(cfg->dnstap_drop_policy = strdup("drop-newest"))) goto error_exit;
+	cfg->dnstap_high_watermark = 75;
+	cfg->dnstap_sample_rate = 10;
 	cfg->ratelimit = 0;
 	cfg->ratelimit_slabs = 4;
 	cfg->ratelimit_size = 4*1024*1024;
@@ -372,22 +404,56 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("do-daemonize:", do_daemonize)
 	else S_NUMBER_NONZERO("port:", port)
 	else S_NUMBER_NONZERO("outgoing-range:", outgoing_num_ports)
+	else if(strcmp(opt, "outgoing-port-pool:") == 0) {
+	    IS_NUMBER_OR_ZERO;
+	    if(atoi(val) < 0) return 0;
+	    cfg->outgoing_port_pool = atoi(val);
+	}
+	else if(strcmp(opt, "outgoing-port-lifetime:") == 0) {
+	    IS_NUMBER_OR_ZERO;
+	    if(atoi(val) < 0) return 0;
+	    cfg->outgoing_port_lifetime = atoi(val);
+	}
 	else S_SIZET_OR_ZERO("outgoing-num-tcp:", outgoing_num_tcp)
 	else S_SIZET_OR_ZERO("incoming-num-tcp:", incoming_num_tcp)
+	else S_NUMBER_NONZERO("incoming-tcp-pipeline:", incoming_tcp_pipeline)
+	else S_NUMBER_OR_ZERO("tcp-reuse-timeout:", tcp_reuse_timeout)
+	else S_SIZET_NONZERO("max-reuse-tcp-queries:", max_reuse_tcp_queries)
 	else S_SIZET_NONZERO("edns-buffer-size:", edns_buffer_size)
 	else S_SIZET_NONZERO("msg-buffer-size:", msg_buffer_size)
 	else S_MEMSIZE("msg-cache-size:", msg_cache_size)
 	else S_POW2("msg-cache-slabs:", msg_cache_slabs)
+	else S_YNO("lockfree-cache-lookup:", lockfree_cache_lookup)
+	else S_YNO("msg-cache-wire:", msg_cache_wire)
+	else S_YNO("cache-open-addressing:", cache_open_addressing)
+	else S_YNO("cache-admission:", cache_admission)
+	else S_YNO("coalesce-queries:", coalesce_queries)
+	else if(strcmp(opt, "hash-function:") == 0) {
+	    if(hash_func_lookup(val) < 0) return 0;
+	    free(cfg->hash_function);
+	    return (cfg->hash_function = strdup(val)) != NULL;
+	}
 	else S_SIZET_NONZERO("num-queries-per-thread:",num_queries_per_thread)
 	else S_SIZET_OR_ZERO("jostle-timeout:", jostle_time)
 	else S_MEMSIZE("so-rcvbuf:", so_rcvbuf)
 	else S_MEMSIZE("so-sndbuf:", so_sndbuf)
 	else S_YNO("so-reuseport:", so_reuseport)
+	else S_YNO("so-reuseport-bpf:", so_reuseport_bpf)
+	else S_YNO("so-incoming-cpu:", so_incoming_cpu)
+	else S_STR("cpu-affinity:", cpu_affinity)
+	else S_NUMBER_OR_ZERO("udp-batch-size:", udp_batch_size)
 	else S_YNO("ip-transparent:", ip_transparent)
 	else S_MEMSIZE("rrset-cache-size:", rrset_cache_size)
 	else S_POW2("rrset-cache-slabs:", rrset_cache_slabs)
 	else S_YNO("prefetch:", prefetch)
 	else S_YNO("prefetch-key:", prefetch_key)
+	else S_YNO("serve-expired:", serve_expired)
+	else S_NUMBER_OR_ZERO("serve-expired-ttl:", serve_expired_ttl)
+	else S_NUMBER_OR_ZERO("serve-expired-reply-ttl:",
+		serve_expired_reply_ttl)
+	else S_STR("cache-snapshot-file:", cache_snapshot_file)
+	else S_NUMBER_OR_ZERO("cache-snapshot-interval:",
+		cache_snapshot_interval)
 	else if(strcmp(opt, "cache-max-ttl:") == 0)
 	{ IS_NUMBER_OR_ZERO; cfg->max_ttl = atoi(val); MAX_TTL=(time_t)cfg->max_ttl;}
 	else if(strcmp(opt, "cache-max-negative-ttl:") == 0)
@@ -398,6 +464,16 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	    IS_NUMBER_OR_ZERO; cfg->infra_cache_min_rtt = atoi(val);
 	    RTT_MIN_TIMEOUT=cfg->infra_cache_min_rtt;
 	}
+	else if(strcmp(opt, "infra-rtt-percentile:") == 0) {
+	    IS_NUMBER_OR_ZERO;
+	    if(atoi(val) < 0 || atoi(val) > 100) return 0;
+	    cfg->infra_rtt_percentile = atoi(val);
+	}
+	else if(strcmp(opt, "hedge-query-budget:") == 0) {
+	    IS_NUMBER_OR_ZERO;
+	    if(atoi(val) < 0 || atoi(val) > 100) return 0;
+	    cfg->hedge_query_budget = atoi(val);
+	}
 	else S_NUMBER_OR_ZERO("infra-host-ttl:", host_ttl)
 	else S_POW2("infra-cache-slabs:", infra_cache_slabs)
 	else S_SIZET_NONZERO("infra-cache-numhosts:", infra_cache_numhosts)
@@ -447,6 +523,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_MEMSIZE("key-cache-size:", key_cache_size)
 	else S_POW2("key-cache-slabs:", key_cache_slabs)
 	else S_MEMSIZE("neg-cache-size:", neg_cache_size)
+	else S_YNO("aggressive-nsec:", aggressive_nsec)
 	else S_YNO("minimal-responses:", minimal_responses)
 	else S_YNO("rrset-roundrobin:", rrset_roundrobin)
 	else S_STRLIST("local-data:", local_data)
@@ -638,28 +715,50 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "interface-automatic", if_automatic)
 	else O_DEC(opt, "port", port)
 	else O_DEC(opt, "outgoing-range", outgoing_num_ports)
+	else O_DEC(opt, "outgoing-port-pool", outgoing_port_pool)
+	else O_DEC(opt, "outgoing-port-lifetime", outgoing_port_lifetime)
 	else O_DEC(opt, "outgoing-num-tcp", outgoing_num_tcp)
 	else O_DEC(opt, "incoming-num-tcp", incoming_num_tcp)
+	else O_DEC(opt, "incoming-tcp-pipeline", incoming_tcp_pipeline)
+	else O_DEC(opt, "tcp-reuse-timeout", tcp_reuse_timeout)
+	else O_DEC(opt, "max-reuse-tcp-queries", max_reuse_tcp_queries)
 	else O_DEC(opt, "edns-buffer-size", edns_buffer_size)
 	else O_DEC(opt, "msg-buffer-size", msg_buffer_size)
 	else O_MEM(opt, "msg-cache-size", msg_cache_size)
 	else O_DEC(opt, "msg-cache-slabs", msg_cache_slabs)
+	else O_YNO(opt, "lockfree-cache-lookup", lockfree_cache_lookup)
+	else O_YNO(opt, "msg-cache-wire", msg_cache_wire)
+	else O_YNO(opt, "cache-open-addressing", cache_open_addressing)
+	else O_YNO(opt, "cache-admission", cache_admission)
+	else O_YNO(opt, "coalesce-queries", coalesce_queries)
+	else O_STR(opt, "hash-function", hash_function)
 	else O_DEC(opt, "num-queries-per-thread", num_queries_per_thread)
 	else O_UNS(opt, "jostle-timeout", jostle_time)
 	else O_MEM(opt, "so-rcvbuf", so_rcvbuf)
 	else O_MEM(opt, "so-sndbuf", so_sndbuf)
 	else O_YNO(opt, "so-reuseport", so_reuseport)
+	else O_YNO(opt, "so-reuseport-bpf", so_reuseport_bpf)
+	else O_YNO(opt, "so-incoming-cpu", so_incoming_cpu)
+	else O_STR(opt, "cpu-affinity", cpu_affinity)
+	else O_DEC(opt, "udp-batch-size", udp_batch_size)
 	else O_YNO(opt, "ip-transparent", ip_transparent)
 	else O_MEM(opt, "rrset-cache-size", rrset_cache_size)
 	else O_DEC(opt, "rrset-cache-slabs", rrset_cache_slabs)
 	else O_YNO(opt, "prefetch-key", prefetch_key)
 	else O_YNO(opt, "prefetch", prefetch)
+	else O_YNO(opt, "serve-expired", serve_expired)
+	else O_DEC(opt, "serve-expired-ttl", serve_expired_ttl)
+	else O_DEC(opt, "serve-expired-reply-ttl", serve_expired_reply_ttl)
+	else O_STR(opt, "cache-snapshot-file", cache_snapshot_file)
+	else O_DEC(opt, "cache-snapshot-interval", cache_snapshot_interval)
 	else O_DEC(opt, "cache-max-ttl", max_ttl)
 	else O_DEC(opt, "cache-max-negative-ttl", max_negative_ttl)
 	else O_DEC(opt, "cache-min-ttl", min_ttl)
 	else O_DEC(opt, "infra-host-ttl", host_ttl)
 	else O_DEC(opt, "infra-cache-slabs", infra_cache_slabs)
 	else O_DEC(opt, "infra-cache-min-rtt", infra_cache_min_rtt)
+	else O_DEC(opt, "infra-rtt-percentile", infra_rtt_percentile)
+	else O_DEC(opt, "hedge-query-budget", hedge_query_budget)
 	else O_MEM(opt, "infra-cache-numhosts", infra_cache_numhosts)
 	else O_UNS(opt, "delay-close", delay_close)
 	else O_YNO(opt, "do-ip4", do_ip4)
@@ -708,6 +807,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_MEM(opt, "key-cache-size", key_cache_size)
 	else O_DEC(opt, "key-cache-slabs", key_cache_slabs)
 	else O_MEM(opt, "neg-cache-size", neg_cache_size)
+	else O_YNO(opt, "aggressive-nsec", aggressive_nsec)
 	else O_YNO(opt, "control-enable", remote_control_enable)
 	else O_DEC(opt, "control-port", control_port)
 	else O_STR(opt, "server-key-file", server_key_file)
@@ -904,6 +1004,7 @@ config_delete(struct config_file* cfg)
 	free(cfg->pidfile);
 	free(cfg->target_fetch_policy);
 	free(cfg->ssl_service_key);
+	free(cfg->cache_snapshot_file);
 	free(cfg->ssl_service_pem);
 	if(cfg->ifs) {
 		int i;
@@ -924,6 +1025,7 @@ config_delete(struct config_file* cfg)
 	free(cfg->identity);
 	free(cfg->version);
 	free(cfg->module_conf);
+	free(cfg->hash_function);
 	free(cfg->outgoing_avail_ports);
 	config_delstrlist(cfg->caps_whitelist);
 	config_delstrlist(cfg->private_address);
@@ -937,6 +1039,7 @@ config_delete(struct config_file* cfg)
 	config_delstrlist(cfg->dlv_anchor_list);
 	config_deldblstrlist(cfg->acls);
 	free(cfg->val_nsec3_key_iterations);
+	free(cfg->cpu_affinity);
 	config_deldblstrlist(cfg->local_zones);
 	config_delstrlist(cfg->local_zones_nodefault);
 	config_delstrlist(cfg->local_data);
@@ -947,6 +1050,9 @@ config_delete(struct config_file* cfg)
 	free(cfg->control_cert_file);
 	free(cfg->dns64_prefix);
 	free(cfg->dnstap_socket_path);
+	free(cfg->dnstap_ip);
+	free(cfg->dnstap_file);
+	free(cfg->dnstap_drop_policy);
 	free(cfg->dnstap_identity);
 	free(cfg->dnstap_version);
 	config_deldblstrlist(cfg->ratelimit_for_domain);
@@ -1242,6 +1348,9 @@ config_apply(struct config_file* config)
 	EDNS_ADVERTISED_SIZE = (uint16_t)config->edns_buffer_size;
 	MINIMAL_RESPONSES = config->minimal_responses;
 	RRSET_ROUNDROBIN = config->rrset_roundrobin;
+	SERVE_EXPIRED = config->serve_expired;
+	SERVE_EXPIRED_TTL = (time_t)config->serve_expired_ttl;
+	SERVE_EXPIRED_REPLY_TTL = (time_t)config->serve_expired_reply_ttl;
 	log_set_time_asc(config->log_time_ascii);
 }
 
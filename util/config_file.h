@@ -90,10 +90,20 @@ struct config_file {
 
 	/** outgoing port range number of ports (per thread) */
 	int outgoing_num_ports;
+	/** number of outgoing udp ports kept open (per thread, interface) */
+	int outgoing_port_pool;
+	/** seconds an outgoing udp port in the pool is used */
+	int outgoing_port_lifetime;
 	/** number of outgoing tcp buffers per (per thread) */
 	size_t outgoing_num_tcp;
 	/** number of incoming tcp buffers per (per thread) */
 	size_t incoming_num_tcp;
+	/** max number of queries in flight on one incoming tcp connection */
+	int incoming_tcp_pipeline;
+	/** msec idle outgoing tcp connections are kept open for reuse */
+	int tcp_reuse_timeout;
+	/** max number of queries sent on one outgoing tcp connection */
+	size_t max_reuse_tcp_queries;
 	/** allowed udp port numbers, array with 0 if not allowed */
 	int* outgoing_avail_ports;
 
@@ -105,8 +115,21 @@ struct config_file {
 	size_t msg_cache_size;
 	/** slabs in the message cache. */
 	size_t msg_cache_slabs;
+	/** lookups in the message and rrset cache do not lock the tables */
+	int lockfree_cache_lookup;
+	/** store pre-encoded answers with the message cache entries */
+	int msg_cache_wire;
+	/** the msg, rrset, infra, ratelimit and key caches use the open
+	 * addressing hash table */
+	int cache_open_addressing;
+	/** the msg and rrset caches admit new entries by their frequency */
+	int cache_admission;
+	/** hash function for the cache keys, wyhash or lookup3 */
+	char* hash_function;
 	/** number of queries every thread can service */
 	size_t num_queries_per_thread;
+	/** a query that is in progress in another thread waits for it */
+	int coalesce_queries;
 	/** number of msec to wait before items can be jostled out */
 	size_t jostle_time;
 	/** size of the rrset cache */
@@ -121,6 +144,11 @@ struct config_file {
 	size_t infra_cache_numhosts;
 	/** min value for infra cache rtt */
 	int infra_cache_min_rtt;
+	/** percentile of the rtt for server selection, 0 uses the timeout */
+	int infra_rtt_percentile;
+	/** percentage of upstream queries that can get a hedge query to
+	 * another server when they are slow, 0 is off */
+	int hedge_query_budget;
 	/** delay close of udp-timeouted ports, if 0 no delayclose. in msec */
 	int delay_close;
 
@@ -136,6 +164,15 @@ struct config_file {
 	size_t so_sndbuf;
 	/** SO_REUSEPORT requested on port 53 sockets */
 	int so_reuseport;
+	/** reuseport BPF program that spreads queries by CPU is attached */
+	int so_reuseport_bpf;
+	/** SO_INCOMING_CPU set on the port 53 sockets of pinned threads */
+	int so_incoming_cpu;
+	/** CPU numbers to pin the threads to, list of numbers, or NULL */
+	char* cpu_affinity;
+	/** number of datagrams read with one recvmmsg on port 53 UDP
+	 * sockets, 0 or 1 reads them one at a time */
+	int udp_batch_size;
 	/** IP_TRANSPARENT socket option requested on port 53 sockets */
 	int ip_transparent;
 
@@ -197,6 +234,17 @@ struct config_file {
 	int prefetch;
 	/** if prefetching of DNSKEYs should be performed. */
 	int prefetch_key;
+	/** serve expired answers from the cache, while refreshing them */
+	int serve_expired;
+	/** seconds after expiry that answers are still served, 0 no limit */
+	int serve_expired_ttl;
+	/** TTL of the records in expired answers */
+	int serve_expired_reply_ttl;
+	/** file with the binary cache snapshot, NULL or "" for none */
+	char* cache_snapshot_file;
+	/** seconds between snapshots written in the background, 0 only
+	 * at exit */
+	int cache_snapshot_interval;
 
 	/** chrootdir, if not "" or chroot will be done */
 	char* chrootdir;
@@ -276,6 +324,8 @@ struct config_file {
 	size_t key_cache_slabs;
 	/** size of the neg cache */
 	size_t neg_cache_size;
+	/** use the neg cache to synthesize NXDOMAIN and NODATA answers */
+	int aggressive_nsec;
 
 	/** local zones config */
 	struct config_str2list* local_zones;
@@ -328,6 +378,23 @@ struct config_file {
 	int dnstap;
 	/** dnstap socket path */
 	char* dnstap_socket_path;
+	/** dnstap TCP collector address, with @port, if no socket path */
+	char* dnstap_ip;
+	/** dnstap output file, used instead of a collector if set */
+	char* dnstap_file;
+	/** size at which the dnstap file is rotated, 0 for never */
+	size_t dnstap_file_rotate_size;
+	/** dnstap output is written once this many bytes are batched */
+	size_t dnstap_flush_size;
+	/** dnstap output is written once batched this long, in msec */
+	int dnstap_flush_time;
+	/** dnstap drop policy: drop-newest, drop-oldest or sample */
+	char* dnstap_drop_policy;
+	/** percentage of a thread's dnstap frames in use before the drop
+	 * policy applies */
+	int dnstap_high_watermark;
+	/** with the sample drop policy, keep one in this many events */
+	int dnstap_sample_rate;
 	/** true to send "identity" via dnstap */
 	int dnstap_send_identity;
 	/** true to send "version" via dnstap */
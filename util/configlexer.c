@@ -363,8 +363,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 174
-#define YY_END_OF_BUFFER 175
+#define YY_NUM_RULES 205
+#define YY_END_OF_BUFFER 206
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -372,198 +372,237 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[1731] =
+static yyconst flex_int16_t yy_accept[2086] =
     {   0,
-        1,    1,  156,  156,  160,  160,  164,  164,  168,  168,
-        1,    1,  175,  172,    1,  154,  154,  173,    2,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  173,  156,
-      157,  157,  158,  173,  160,  161,  161,  162,  173,  167,
-      164,  165,  165,  166,  173,  168,  169,  169,  170,  173,
-      171,  155,    2,  159,  171,  173,  172,    0,    1,    2,
-        2,    2,    2,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  156,    0,  160,    0,  167,    0,  164,
-      168,    0,  171,    0,    2,    2,  171,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  171,  172,  172,  172,
-
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  171,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,   70,  172,  172,  172,  172,  172,    6,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  171,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  171,  172,  172,  172,  172,  172,   30,
-      172,  172,  172,  172,  172,  172,  172,  172,  135,  172,
-       12,   13,  172,   15,   14,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,  172,  128,  172,  172,  172,  172,  172,  172,
-        3,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  171,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  163,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,   33,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,   34,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,   85,  163,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,   84,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,   68,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,   20,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,   31,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,   32,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-       22,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  148,  172,  172,
-      172,  172,  172,  172,   26,  172,   27,  172,  172,  172,
-       71,  172,   72,  172,   69,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-        5,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,   87,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-       23,  172,  172,  172,  172,  172,  112,  111,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-       35,  172,  172,  172,  172,  172,  172,  172,  172,   74,
-       73,  172,  172,  172,  172,  172,  172,  172,  108,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-       53,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,  172,  172,   57,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  110,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,    4,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  105,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  121,  172,  106,  172,  133,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,   21,  172,  172,  172,
-
-      172,   76,  172,   77,   75,  172,  172,  172,  172,  172,
-      172,  172,   83,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  107,  172,  172,  172,  172,  132,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,   67,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,   28,  172,  172,   17,  172,
-      172,  172,   16,  172,   92,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,   42,
-       44,  172,  172,  172,  172,  172,  172,  172,  172,  136,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,  172,   78,  172,  172,  172,  172,  172,  172,
-       82,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,   86,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  127,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,   96,  172,  100,  172,  172,  172,  172,   81,  172,
-      172,   63,  172,  119,  172,  172,  172,  172,  134,  172,
-      172,  172,  172,  172,  172,  172,  141,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,   99,  172,
-
-      172,  172,  172,  172,   45,   46,  172,   29,   52,  101,
-      172,  113,  109,  172,  172,   38,  172,  103,  172,  172,
-      172,  172,  172,    7,  172,   66,  172,  172,  172,  150,
-      172,  118,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,   88,
-      140,  172,  172,  172,  172,  172,  172,  172,  172,  129,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  102,  172,   37,   39,  172,  172,
-      172,  172,  172,   65,  172,  172,  172,  149,  172,  172,
-
-      172,  172,  123,   18,   19,  172,  172,  172,  172,  172,
-      172,  172,   62,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  125,  122,  172,  172,  172,  172,  172,
-      172,  172,  172,   36,  172,  172,  172,  172,  172,  172,
-      172,   11,  172,  172,  172,  172,  172,  172,  172,  172,
-       10,  172,  172,  172,  153,  172,   40,  172,  131,  124,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,   95,   94,  172,  172,  126,  120,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,   47,  172,  130,  172,  172,
-
-      172,  172,  172,  172,   41,  172,  172,  172,   89,   91,
-      114,  172,  172,  172,   93,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  137,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,   24,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  139,  172,
-      172,  117,  172,  172,  172,  172,  172,  172,  172,   50,
-      172,   25,  172,    9,  172,  172,  172,  172,  115,   54,
-      172,  172,  172,   98,  172,  172,  172,  172,  172,  172,
-      172,  138,   79,  172,  172,  172,  172,   56,   60,   55,
-
-      172,   48,  172,    8,  172,  151,  172,  172,   97,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,   61,
-       59,  172,   49,  172,  172,  116,  172,  172,   90,   43,
-      172,  172,  172,  172,  172,  172,   80,   58,   51,  152,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,   64,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  104,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
-
-      172,  172,  172,  172,  144,  172,  172,  172,  172,  172,
-      172,  172,  172,  172,  172,  172,  172,  172,  142,  172,
-      145,  146,  172,  172,  172,  172,  172,  143,  147,    0
+        1,    1,  187,  187,  191,  191,  195,  195,  199,  199,
+        1,    1,  206,  203,    1,  185,  185,  204,    2,  204,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  187,
+      188,  188,  189,  204,  191,  192,  192,  193,  204,  198,
+      195,  196,  196,  197,  204,  199,  200,  200,  201,  204,
+      202,  186,    2,  190,  204,  202,  203,    0,    1,    2,
+        2,    2,    2,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  187,    0,
+      187,  191,    0,  191,  198,    0,  195,  198,  199,    0,
+      199,  202,    0,    2,    2,  202,  202,    2,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,    2,  202,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  202,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,   92,  203,  203,  203,
+      203,  203,    6,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  202,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      202,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+
+       37,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  158,  203,   15,   16,  203,   18,   17,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  151,  203,  203,  203,  203,  203,  203,  203,    3,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  202,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      194,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,   40,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,   41,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  107,  194,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      106,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,  203,  203,  203,   85,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,   23,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,   38,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,   39,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  161,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,   25,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  179,  203,  203,  203,
+      203,  203,  203,  203,  203,   29,  203,   30,  203,  203,
+      203,   93,  203,   94,  203,   91,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,    5,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,  109,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,   26,  203,
+      203,  203,  203,  203,  135,  134,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,   42,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,   96,   95,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  131,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,   70,  203,  203,  203,  203,  203,  203,  162,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,   74,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  133,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,    4,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  128,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  144,  203,   34,  129,  203,  156,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,   24,  203,  203,  203,  203,
+       98,  203,   99,   97,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  105,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,  203,  130,  203,  203,
+      203,  203,  203,  203,  155,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,   84,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,   31,  203,  203,   20,  203,  203,
+      203,  203,   19,  203,  114,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,   57,   59,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  159,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  100,  203,  203,  203,  203,
+      203,  203,   51,  203,  104,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  108,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  150,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,   86,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  118,  203,  122,  203,
+      203,  203,  203,  103,  203,  203,  203,  203,  203,  203,
+       80,  203,  203,  142,  203,  203,  203,  203,  157,  203,
+
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  172,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  121,  203,  203,  203,  203,
+      203,  203,   60,   61,  203,  203,   36,   69,  123,  203,
+      136,  203,  132,  203,  203,  203,   45,  203,   48,  125,
+      203,  203,  203,  203,  203,  203,    7,  203,   83,  203,
+      203,  203,  181,  203,  141,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,   35,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  126,  203,   50,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  110,  203,  203,  203,  203,  203,
+      171,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      152,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  124,  203,
+      203,  203,   44,   46,  203,  203,  203,  203,  203,  203,
+      203,   82,  203,  203,  203,  180,  203,  203,  203,  203,
+      203,  203,  146,   33,  203,   21,   22,  203,  203,  203,
+      203,  203,  203,  203,  203,   79,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,   52,  203,  203,
+      148,  145,  203,  203,  203,  203,  203,  203,  203,  203,
+
+      203,  203,  203,  203,  203,  203,   43,  203,  203,  203,
+      203,  203,  203,  203,  203,   11,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,   10,  203,
+      203,  203,  203,  203,  184,  203,   55,  203,  154,  203,
+      203,  147,   32,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  117,  116,  203,  203,  203,
+      203,  203,  149,  143,  203,  203,  164,  165,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+       62,  203,  203,  203,  203,  153,  203,  203,  203,  203,
+
+      203,  203,  203,  203,   56,  203,   87,  203,  203,  203,
+       13,  111,  113,  137,  203,  203,  203,  115,  203,  203,
+      203,  203,  203,  203,  166,  203,  203,  203,  203,  203,
+      203,  168,  203,  203,  160,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,   67,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,   27,  203,  203,  203,   53,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,   89,  203,  203,  203,  203,  203,  203,  203,
+      203,  170,  203,  203,  140,  203,  203,  203,  203,  203,
+      203,  203,  203,   65,  203,  203,   28,  203,  203,  203,
+
+        9,  203,  203,  203,  203,  203,  203,  138,   71,  203,
+      203,  203,  120,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  169,  101,  203,  203,  203,  203,
+       73,   77,   72,  203,  203,   63,   66,  203,  203,  203,
+      203,    8,  203,  182,  203,  203,  203,  119,  203,  203,
+      203,   49,  203,  203,  167,  203,  203,  203,  203,  203,
+      203,  203,   78,   76,  203,   12,   64,   47,   14,  203,
+      203,  203,  203,  139,  203,  203,  112,   58,  203,  203,
+      203,  203,  203,  203,  203,  203,  102,   75,   68,   54,
+      183,  203,  203,  203,   90,  163,  203,  203,  203,  203,
+
+      203,  203,   88,  203,  203,  203,  203,  203,  203,  203,
+      203,   81,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      127,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  175,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  173,  203,  176,  177,  203,  203,  203,
+      203,  203,  174,  178,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -574,14 +613,14 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    2,    1,    5,    6,    1,    1,    1,    7,    1,
         1,    1,    1,    1,    8,    1,    1,    1,    1,    1,
         9,   10,    1,   11,    1,    1,    1,   12,    1,    1,
-        1,    1,    1,    1,   13,   14,   15,   16,   17,   18,
-       19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
-       29,   30,   31,   32,   33,   34,   35,   36,   37,   38,
-        1,   39,    1,    1,    1,    1,   40,   41,   42,   43,
-
-       44,   45,   46,   47,   48,   49,   50,   51,   52,   53,
-       54,   55,   56,   57,   58,   59,   60,   61,   62,   63,
-       64,   65,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,   13,    1,    1,    1,    1,   14,   15,   16,   17,
+
+       18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
+       28,   29,   30,   31,   32,   33,   34,   35,   36,   37,
+       38,   39,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -598,1531 +637,1124 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int32_t yy_meta[66] =
+static yyconst flex_int32_t yy_meta[40] =
     {   0,
-        1,    2,    3,    4,    5,    1,    6,    1,    1,    1,
-        1,    7,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
+        1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[1745] =
+static yyconst flex_int16_t yy_base[2086] =
     {   0,
-        0,    0,   63,   66,   69,   71,   77,   83,   88,   91,
-      129,  135,  378,  309,   95, 5006, 5006, 5006,  107,  110,
-      142,  180,  108,   50,  145,  172,  118,  148,  121,  181,
-      197,  166,  217,  233,  252,  236,  164,  269,  116,  298,
-     5006, 5006, 5006,   94,  295, 5006, 5006, 5006,   96,  249,
-      265, 5006, 5006, 5006,  238,  216, 5006, 5006, 5006,  102,
-      214, 5006,  290, 5006,  259,  257,  209,  312,  111,    0,
-      316,    0,    0,  265,  170,  283,  310,  296,  301,  306,
-      302,  297,  308,  325,  317,  312,  330,  333,  345,  329,
-      336,  361,  250,  343,  368,  376,  347,  341,  365,  377,
-
-      372,  380,  388,  370,  382,  398,  413,  399,  403,  408,
-      409,  410,  414,  260,  415,  437,  426,  436,  412,  445,
-      450,  449,  439,  193,  159,  177,  169,  141,  298,  165,
-      122,  174,  115,  488,  497,    0,  464,  470,  262,  471,
-      485,  477,  484,  480,  505,  498,  435,  509,  553,  513,
-      491,  511,  492,  517,  523,  508,  519,  539,  541,  526,
-      544,  543,  549,  556,  568,  579,  581,  578,  561,  583,
-      588,  601,  602,  592,  597,  584,  607,  594,  609,  618,
-      610,  612,  622,  611,  628,  626,  615,  639,  644,  652,
-      637,  645,  660,  662,  667,  663,  658,  650,  668,  671,
-
-      681,  679,  678,  673,  694,  674,  701,  709,  213,  711,
-      713,  700,  707,  720,  715,  708,  728,  718,  724,  743,
-      734,  733,  736,  735,  744,  763,  740,  761,  750,  760,
-      770,  766,  762,  759,  773,  777,  781,  790,  808,  778,
-      804,  795,  799,  809,  813,  819,  822,  801,  820,  828,
-      831,  833,  825,  851,  847,  846,  855,  870,  858,  850,
-      849,  857,  873,  876,  888,  928,  878,  877,  880,  889,
-      894,  890,  922,  896,  905,  897,  911,  937,  907,  934,
-      945,  935,  954,  967,  936,  952,  957,  962,  958,  978,
-      970,  963,  971,  983,  986,  995,  987, 1005, 1000,  998,
-
-     1007, 1011, 1004, 1020, 1015, 1003, 1019, 1025, 1032, 1038,
-     1035, 1029, 1044, 5006, 1048, 1033, 1053, 1059, 1046, 5006,
-     1062, 1063, 1043, 1060, 1073, 1066, 1095, 1076, 1070, 1077,
-     1075, 1084, 1102, 1096, 1089, 1139, 1097, 1111, 1132, 1130,
-     1116, 1114, 1121, 1148, 1135, 1141, 1143, 1142, 1129, 1166,
-     1170, 1162, 1168, 1180, 1190, 1175, 1173, 1186, 1188, 1194,
-     1189, 1192, 1200, 1197, 1202, 1206, 1238, 1223, 1220, 1235,
-     1213, 1237, 1241, 1246, 1224, 1239, 1249, 1247, 1250, 1243,
-     1240, 1259, 1251, 1255, 1276, 1289, 1267, 1277, 1262, 1283,
-     1294, 1296, 1293, 1286, 1302, 1312, 1318, 1305, 1308, 1306,
-
-     1334, 1326, 1320, 1329, 1335, 1339, 1341, 1348, 1347, 1354,
-     1350, 1373, 1382, 1361, 1352, 1370, 1362, 1365, 1366, 1374,
-     1392, 1375, 1389, 1387, 1393, 1399, 1398, 1412, 1402, 1411,
-     1410, 1414, 1409, 1421, 1420, 1419, 1436, 1440, 1447, 1432,
-     1446, 1449, 1442, 1455, 1459, 1461, 1454, 1489, 1457, 5006,
-     1468, 1474, 1479, 1476, 1488, 1481, 1482, 1530, 5006, 1485,
-     5006, 5006, 1487, 5006, 5006, 1501, 1505, 1493, 1517, 1579,
-     1514, 1518, 1523, 1526, 1533, 1540, 1550, 1528, 1557, 1562,
-     1563, 1569, 1567, 1574, 1592, 1601, 1584, 1585, 1577, 1605,
-     1534, 1544, 1613, 1611, 1614, 1615, 1618, 1626, 1627, 1621,
-
-     1625, 1639, 1628, 5006, 1637, 1648, 1642, 1658, 1650, 1668,
-     5006, 1641, 1667, 1649, 1660, 1666, 1664, 1673, 1677, 1678,
-     1683, 1692, 1676, 1706, 1693, 1700, 1720, 1722, 1717, 1705,
-     1718, 1726, 1715, 1733, 1729, 1732, 1719, 1725, 1747, 1746,
-     1750, 1754, 1740, 1764, 1751, 1745, 1757, 1756, 1801, 1782,
-     1760, 1763, 1765, 1784, 1791, 1794, 1796, 1799, 1815, 1819,
-     1811, 1813, 1829, 1839, 1823, 1847, 1842, 1831, 1850, 1856,
-     1858, 1857, 1852, 1851, 1869, 1867, 1872, 5006, 1875, 1887,
-     1874, 1884, 1899, 1879, 1889, 1900, 1891, 1902, 1892, 1894,
-     1913, 1917, 5006, 1911, 1915, 1926, 1918, 1938, 1942, 1919,
-
-     1950, 1952, 5006, 1956, 1957, 1959, 1944, 1939, 1953, 1960,
-     1955, 1967, 1970, 1986, 1977, 1989, 1996, 1997, 1980, 2002,
-     1983, 1990, 1988, 1999, 2013, 2016, 2019, 2011, 2020, 2015,
-     2034, 2038, 2029, 2049, 2032, 2036, 2040,  120, 2035, 2046,
-     2041, 2045, 5006,   76, 2061, 2042, 2054, 2087, 2089, 2081,
-     2085, 2077, 2078, 2088, 2079, 2076, 2083, 2080, 2096, 2082,
-     2105, 2104, 2127, 2125, 2122, 2119, 2131, 2117, 2132, 2137,
-     2120, 2138, 2121, 2146, 2136, 2156, 2159, 2168, 2164, 2160,
-     2157, 2162, 2182, 2166, 2165, 2187, 5006, 2186, 2183, 2191,
-     2184, 2189, 2229, 2200, 2216, 2207, 2213, 2232, 2234, 2225,
-
-     2228, 2236, 2239, 2240, 2224, 2223, 2243, 2246, 2249, 2265,
-     2268, 2247, 5006, 2267, 2263, 2261, 2287, 2266, 2270, 2283,
-     2285, 2290, 2275, 2301, 2288, 2319, 5006, 2317, 2316, 2304,
-     2322, 2305, 2324, 2328, 2329, 2314, 2331, 2330, 2332, 2339,
-     2327, 2347, 2335, 5006, 2343, 2372, 2366, 2377, 2367, 2356,
-     2368, 2378, 2361, 2359, 2388, 2387, 2365, 2384, 2373, 2389,
-     2393, 2394, 2404, 2405, 2402, 2421, 5006, 2439, 2415, 2428,
-     2431, 2416, 2442, 2423, 2434, 2437, 2441, 2444, 2454, 2447,
-     2450, 2469, 2457, 2460, 2464, 2461, 2480, 2463, 2488, 2491,
-     2494, 2483, 2502, 2489, 2506, 2487, 2514, 2517, 2521, 2522,
-
-     5006, 2524, 2509, 2525, 2518, 2515, 2547, 2537, 2536, 2539,
-     2541, 2543, 2550, 2544, 2546, 2553, 2557, 2559, 2561, 2560,
-     2564, 2568, 2585, 2589, 2584, 2591, 2607, 5006, 2594, 2598,
-     2596, 2606, 2595, 2608, 5006, 2611, 5006, 2625, 2618, 2635,
-     5006, 2632, 5006, 2639, 5006, 2640, 2646, 2633, 2624, 2636,
-     2653, 2654, 2644, 2641, 2663, 2656, 2668, 2680, 2667, 2660,
-     5006, 2671, 2683, 2681, 2688, 2692, 2694, 2690, 2698, 2700,
-     2696, 2676, 2710, 2704, 2708, 2732, 2727, 5006, 2716, 2735,
-     2726, 2724, 2752, 2746, 2729, 2739, 2742, 2725, 2761, 2772,
-     2775, 2760, 2762, 2763, 2779, 2790, 2769, 2788, 2780, 2789,
-
-     2777, 2798, 2803, 2786, 2797, 2799, 2802, 2808, 2811, 2813,
-     5006, 2827, 2822, 2826, 2835, 2825, 5006, 5006, 2842, 2840,
-     2846, 2849, 2839, 2853, 2870, 2854, 2850, 2856, 2864, 2873,
-     2867, 2874, 2862, 2875, 2894, 2880, 2898, 2904, 2915, 2890,
-     5006, 2902, 2910, 2914, 2912, 2906, 2920, 2921, 2935, 5006,
-     5006, 2932, 2923, 2925, 2930, 2960, 2942, 2946, 5006, 2948,
-     2962, 2967, 2969, 2973, 2970, 2954, 2965, 2982, 2976, 2981,
-     2971, 2999, 2993, 3006, 3001, 2996, 3010, 3018, 3019, 3021,
-     5006, 3015, 3025, 3017, 3026, 3023, 3035, 3039, 3050, 3048,
-     3040, 3046, 3036, 3038, 3051, 3049, 3044, 3069, 3059, 3080,
-
-     3083, 3081, 3093, 3087, 5006, 3096, 3076, 3097, 3073, 3101,
-     3103, 3106, 3122, 3091, 3095, 3099, 3102, 3118, 3105, 3121,
-     3126, 3117, 5006, 3131, 3150, 3142, 3144, 3143, 3129, 3158,
-     3146, 3149, 5006, 3170, 3164, 3160, 3174, 3183, 3184, 3179,
-     3173, 3178, 3191, 3177, 3186, 3197, 3199, 3200, 3208, 3203,
-     3220, 3228, 3221, 3231, 3213, 3224, 3246, 3233, 3249, 3247,
-     3226, 3242, 3248, 3245, 3258, 3251, 3241, 3271, 3255, 3274,
-     3268, 5006, 3283, 3287, 3291, 3292, 3276, 3293, 3289, 3300,
-     3302, 5006, 3303, 5006, 3285, 5006, 3305, 3309, 3314, 3313,
-     3310, 3312, 3321, 3337, 3275, 3329, 5006, 3345, 3332, 3338,
-
-     3344, 5006, 3351, 5006, 5006, 3339, 3348, 3349, 3365, 3359,
-     3361, 3367, 5006, 3372, 3371, 3384, 3374, 3375, 3381, 3388,
-     3392, 3380, 3394, 3397, 5006, 3398, 3411, 3408, 3407, 5006,
-     3415, 3405, 3410, 3423, 3431, 3434, 3440, 3430, 3427, 3450,
-     3444, 5006, 3432, 3438, 3462, 3453, 3461, 3473, 3459, 3480,
-     3458, 3475, 3488, 3474, 3486, 5006, 3489, 3491, 5006, 3479,
-     3485, 3477, 5006, 3497, 5006, 3516, 3511, 3502, 3519, 3531,
-     3524, 3534, 3517, 3535, 3532, 3529, 3540, 3544, 3521, 5006,
-     5006, 3545, 3538, 3550, 3556, 3558, 3555, 3571, 3575, 5006,
-     3553, 3581, 3564, 3574, 3583, 3572, 3577, 3592, 3591, 3579,
-
-     3602, 3585, 3604, 5006, 3601, 3603, 3606, 3605, 3628, 3614,
-     5006, 3609, 3634, 3629, 3630, 3632, 3638, 3643, 3646, 3636,
-     3647, 3648, 3658, 3641, 3677, 3678, 3661, 5006, 3674, 3681,
-     3663, 3683, 3666, 3685, 3686, 3698, 3692, 3675, 3695, 5006,
-     3673, 3688, 3693, 3717, 3708, 3728, 3705, 3732, 3720, 3722,
-     3735, 3711, 3724, 3718, 3738, 3742, 3741, 3744, 3758, 3746,
-     3748, 5006, 3754, 5006, 3767, 3777, 3786, 3782, 5006, 3773,
-     3780, 5006, 3775, 5006, 3790, 3792, 3801, 3795, 5006, 3796,
-     3784, 3805, 3800, 3815, 3807, 3830, 5006, 3832, 3834, 3808,
-     3833, 3820, 3827, 3839, 3824, 3845, 3849, 3846, 5006, 3853,
-
-     3857, 3859, 3866, 3873, 5006, 5006, 3877, 5006, 5006, 5006,
-     3881, 5006, 5006, 3880, 3882, 5006, 3883, 5006, 3891, 3887,
-     3876, 3868, 3889, 5006, 3897, 5006, 3895, 3893, 3898, 5006,
-     3899, 5006, 3901, 3921, 3915, 3922, 3930, 3931, 3932, 3924,
-     3916, 3925, 3933, 3935, 3939, 3926, 3941, 3956, 3943, 3955,
-     3954, 3952, 3963, 3960, 3958, 3979, 3981, 3988, 3989, 5006,
-     5006, 3971, 3982, 3990, 3994, 3992, 4002, 4005, 3998, 5006,
-     3993, 4015, 4003, 4016, 4017, 4018, 4030, 4021, 4033, 4038,
-     4029, 4037, 4034, 4039, 5006, 4049, 5006, 5006, 4050, 4051,
-     4055, 4056, 4057, 5006, 4065, 4072, 4074, 5006, 4085, 4081,
-
-     4088, 4089, 5006, 5006, 5006, 4090, 4082, 4084, 4098, 4101,
-     4086, 4099, 5006, 4095, 4114, 4116, 4108, 4124, 4129, 4140,
-     4133, 4139, 4142, 5006, 5006, 4144, 4141, 4147, 4146, 4134,
-     4150, 4148, 4151, 5006, 4154, 4165, 4173, 4161, 4178, 4188,
-     4182, 5006, 4174, 4175, 4177, 4194, 4190, 4198, 4200, 4201,
-     5006, 4202, 4217, 4192, 5006, 4223, 5006, 4212, 5006, 5006,
-     4216, 4231, 4234, 4240, 4241, 4242, 4227, 4233, 4235, 4246,
-     4244, 5006, 5006, 4243, 4256, 5006, 5006, 4260, 4261, 4262,
-     4259, 4267, 4255, 4265, 4282, 4272, 4294, 4296, 4269, 4293,
-     4283, 4274, 4304, 4299, 4308, 5006, 4311, 5006, 4315, 4302,
-
-     4312, 4323, 4321, 4327, 5006, 4335, 4325, 4320, 5006, 5006,
-     5006, 4346, 4348, 4347, 5006, 4352, 4358, 4350, 4359, 4360,
-     4363, 4362, 4341, 4369, 5006, 4372, 4373, 4382, 4394, 4386,
-     4385, 4383, 4396, 4400, 4390, 4403, 4387, 4411, 4414, 5006,
-     4420, 4415, 4423, 4412, 4418, 4434, 4436, 4425, 4437, 4428,
-     4454, 4445, 4438, 4451, 4441, 4463, 4452, 4466, 5006, 4473,
-     4455, 5006, 4472, 4475, 4481, 4480, 4488, 4491, 4487, 5006,
-     4494, 5006, 4497, 5006, 4495, 4496, 4503, 4501, 5006, 5006,
-     4502, 4509, 4507, 5006, 4515, 4499, 4513, 4519, 4526, 4524,
-     4522, 5006, 5006, 4521, 4550, 4552, 4551, 5006, 5006, 5006,
-
-     4556, 5006, 4553, 5006, 4546, 5006, 4559, 4548, 5006, 4547,
-     4561, 4564, 4542, 4566, 4568, 4571, 4580, 4577, 4597, 5006,
-     5006, 4599, 5006, 4600, 4601, 5006, 4590, 4604, 5006, 5006,
-     4610, 4595, 4606, 4594, 4607, 4603, 5006, 5006, 5006, 5006,
-     4614, 4615, 4626, 4624, 4629, 4628, 4623, 4634, 4654, 4650,
-     4652, 4653, 4638, 4645, 4668, 4655, 5006, 4673, 4664, 4671,
-     4672, 4675, 4665, 4674, 4680, 4684, 4691, 4695, 4687, 4692,
-     4707, 4690, 4722, 4720, 4721, 4724, 4713, 4717, 4727, 4730,
-     4719, 4736, 4745, 4739, 4747, 5006, 4756, 4743, 4748, 4763,
-     4741, 4766, 4754, 4777, 4779, 4781, 4784, 4782, 4792, 4788,
-
-     4789, 4783, 4794, 4793, 5006, 4809, 4819, 4798, 4808, 4829,
-     4813, 4815, 4836, 4831, 4826, 4838, 4843, 4840, 5006, 4844,
-     5006, 5006, 4845, 4854, 4856, 4852, 4855, 5006, 5006, 5006,
-     4914, 4921, 4928, 4935, 4942,   82, 4949, 4956, 4963, 4970,
-     4977, 4984, 4991, 4998
+        0,    0,   39,    0,   78,    0,  117,    0,  156,    0,
+      195,    0, 2855,  234,  235,    0,    0,    0,  273,  312,
+      336,  340,  337,  340,  208,  349,  355,  210,  221,  218,
+      359,  360,  242,  357,  362,  368,  383,  375,  390,  409,
+        0,    0,    0,  448,  487,    0,    0,    0,  526,  565,
+      313,    0,    0,    0,  604,  643,    0,    0,    0,  682,
+      721,    0,  760,    0,  799,  331,    0,    0,    0,  838,
+        0,    0,  877,    0,  344,  349,  363,  356,  901,  367,
+      904,  369,  380,  375,  374,  380,  911,  386,  418,  459,
+      536,  474,  477,  511,  542,  905,  562,  540,  902,  708,
+
+      570,  619,  630,  628,  659,  703,  699,  693,  746,  771,
+      904,  808,  847,  897,  897,  895,  897,  921,  907,  919,
+      903,  906,  902,  910,  926,  924,  918,  913,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  959,    0,  929,    0,  928,  939,
+      917,  921,  929,  919,  924,  929,  922,  948,  991,  939,
+      950,  989,  984,  945,  970,  985,  968,  990,  987,  989,
+      992,  985,  985,  991,  983,  997, 1006,  988,  994, 1016,
+     1011, 1018, 1019, 1006,  995, 1022, 1013, 1024, 1025, 1014,
+     1017, 1005, 1021, 1006, 1021, 1025, 1016, 1012, 1028, 1012,
+
+     1026, 1041, 1017, 1036, 1032, 1045, 1022, 1047, 1031, 1045,
+     1052, 1053, 1047,    0, 1038, 1032, 1044, 1048, 1059, 1050,
+     1061, 1042, 1053, 1041, 1059, 1053, 1037, 1060, 1063, 1068,
+     1066, 1067, 1053, 1056, 1069, 1069, 1065, 1080, 1062, 1076,
+     1073, 1084, 1075, 1086, 1062, 1065, 1063, 1072, 1085, 1069,
+     1084, 1071, 1078, 1096, 1089, 1081, 1088, 1078, 1087, 1079,
+     1086, 1089, 1100, 1105, 1102, 1089, 1092, 1099, 1111, 1106,
+     1111, 1098, 1102, 1095, 1121, 1097, 1113, 1105, 1117, 1107,
+     1107, 1115, 1130, 1122, 1111, 1110, 1129, 1118, 1120, 1132,
+     1122, 1138, 1122, 1129, 1118, 1123, 1128, 1125, 1125, 1151,
+
+     1124, 1128, 1130, 1140, 1150, 1143, 1164, 1140, 1147, 1167,
+     1147, 1159, 1168, 1147, 1152, 1153, 1156, 1169, 1168, 1155,
+     1160, 1169, 1181, 1168, 1169, 1174, 1176, 1172, 1187, 1177,
+     1180, 1184, 1181, 1174, 1187, 1194, 1173, 1171, 1184, 1182,
+     1190, 1192, 1196, 1193, 1178, 1199,    0, 1200, 1181, 1195,
+     1195, 1193,    0, 1186, 1187, 1194, 1200, 1205, 1203, 1217,
+     1218, 1211, 1193, 1195, 1213, 1203, 1214, 1204, 1202, 1221,
+     1203, 1219, 1209, 1233, 1225, 1227, 1211, 1231, 1208, 1233,
+     1220, 1227, 1225, 1222, 1220, 1238, 1235, 1226, 1231, 1244,
+     1254, 1238, 1232, 1234, 1252, 1246, 1256, 1253, 1245, 1252,
+
+     1247, 1257, 1246, 1259, 1247, 1269, 1256, 1271, 1273, 1278,
+     1275, 1276, 1281, 1256, 1273, 1275, 1285, 1260, 1265, 1279,
+     1279, 1265, 1291, 1282, 1274, 1286, 1289, 1273, 1278, 1298,
+     1286, 1293, 1293, 1294, 1295, 1288, 1297, 1282, 1289, 1294,
+     1312, 1302, 1306, 1307, 1306, 1294, 1299, 1309, 1312, 1311,
+     1322, 1305, 1325, 1313, 1320, 1319, 1330, 1311, 1325, 1309,
+     1328, 1313, 1314, 1314, 1314, 1331, 1327, 1322, 1321, 1325,
+     1346, 1321, 1324, 1343, 1341, 1326, 1336, 1343, 1333, 1331,
+     1338, 1345, 1348, 1347, 1350, 1351, 1339, 1351, 1350, 1346,
+     1356, 1359, 1359, 1355, 1344, 1362, 1366, 1352, 1355, 1361,
+
+        0, 1366, 1377, 1364, 1370, 1364, 1359, 1370, 1361, 1355,
+     1377,    0, 1369,    0,    0, 1370,    0,    0, 1379, 1384,
+     1387, 1397, 1393, 1379, 1377, 1396, 1384, 1378, 1401, 1407,
+     1400, 1407, 1394, 1409, 1393, 1411, 1410, 1397, 1397, 1399,
+     1411, 1419, 1406, 1417, 1405, 1419, 1426, 1407, 1432, 1433,
+     1426, 1424, 1423, 1424, 1415, 1429, 1428, 1437, 1429, 1443,
+     1420,    0, 1431, 1438, 1428, 1442, 1429, 1421, 1443,    0,
+     1434, 1427, 1444, 1429, 1431, 1430, 1433, 1446, 1452, 1439,
+     1439, 1450, 1446, 1455, 1443, 1443, 1450, 1470, 1463, 1472,
+     1464, 1450, 1458, 1466, 1451, 1472, 1479, 1472, 1458, 1464,
+
+     1483, 1459, 1481, 1482, 1467, 1479, 1462, 1466, 1473, 1463,
+     1474, 1484, 1489, 1471, 1497, 1490, 1480, 1492, 1482, 1473,
+     1485, 1497, 1489, 1486, 1491, 1498, 1499, 1505, 1497, 1512,
+     1509, 1501, 1495, 1504, 1513, 1525, 1522, 1510, 1519, 1511,
+     1514, 1528, 1526, 1524, 1530, 1529, 1521, 1517, 1538, 1534,
+        0, 1544, 1537, 1522, 1529, 1523, 1539, 1526, 1530, 1538,
+     1530, 1545, 1531, 1538, 1558, 1545, 1560,    0, 1551, 1538,
+     1540, 1544, 1555, 1556, 1557, 1554, 1563, 1570,    0, 1571,
+     1567, 1564, 1549, 1557, 1553, 1571, 1554, 1560, 1572, 1573,
+     1570, 1574, 1565, 1576, 1584, 1575, 1567, 1583, 1569, 1569,
+
+     1569, 1577, 1586, 1587, 1588, 1576, 1592, 1585, 1589, 1586,
+     1604, 1605, 1586, 1603, 1584, 1590, 1593, 1610, 1589, 1599,
+     1590, 1585,    0,    0, 1597, 1597, 1608, 1594, 1606, 1621,
+     1622, 1604, 1603, 1615, 1604, 1617, 1609, 1610, 1620, 1611,
+     1608, 1619, 1614, 1611, 1632, 1614, 1627, 1614, 1620, 1635,
+     1625, 1617, 1632, 1635, 1642, 1635, 1630, 1630, 1642, 1628,
+     1638, 1643, 1630, 1645, 1632, 1648, 1644, 1639, 1640, 1649,
+     1645, 1639, 1638, 1642, 1655, 1647, 1643, 1646, 1645, 1657,
+        0, 1672, 1654, 1661, 1650, 1666, 1677, 1678, 1656, 1675,
+     1665, 1670, 1685, 1680, 1677, 1680, 1679, 1684, 1691, 1678,
+
+     1683, 1675, 1672, 1696, 1697, 1688, 1690, 1686, 1685,    0,
+     1693, 1683, 1681, 1706, 1689, 1687, 1699, 1694, 1700, 1692,
+     1686, 1698, 1714, 1699, 1716,    0, 1713, 1712, 1699, 1720,
+     1700, 1722, 1717, 1724, 1704, 1730, 1721, 1719, 1723, 1734,
+     1729, 1713, 1726, 1726,    0, 1739, 1740, 1731, 1742, 1729,
+     1720, 1729, 1742, 1722, 1720, 1749, 1750, 1727, 1733, 1728,
+     1754, 1731, 1739, 1731, 1736, 1754, 1736, 1732, 1740, 1754,
+     1740, 1738, 1757,    0, 1768, 1755, 1757, 1750, 1766, 1764,
+     1751, 1763, 1758,    0, 1778, 1758, 1771, 1765, 1758, 1752,
+     1761, 1775, 1763, 1762, 1779, 1766, 1766, 1772, 1772, 1773,
+
+     1770, 1785, 1784, 1787, 1775, 1785, 1770, 1787, 1782, 1792,
+     1778, 1797, 1796, 1807, 1808, 1788, 1804,    0, 1807, 1789,
+     1803, 1795, 1791, 1816, 1813, 1812, 1795, 1797, 1797, 1792,
+     1800, 1814, 1826, 1803, 1804, 1805, 1806, 1813, 1807, 1814,
+     1829, 1826, 1828, 1820, 1825, 1833,    0, 1816, 1838, 1833,
+     1836, 1823, 1822, 1848, 1837,    0, 1827,    0, 1841, 1846,
+     1853,    0, 1850,    0, 1851,    0, 1848, 1833, 1853, 1840,
+     1831, 1838, 1844, 1854, 1845, 1862, 1842, 1862, 1842, 1854,
+     1862, 1848, 1863,    0, 1851, 1856, 1857, 1871, 1854, 1869,
+     1855, 1856, 1876, 1870, 1870, 1875, 1861, 1880, 1878, 1889,
+
+     1865, 1891, 1862, 1874, 1890, 1884,    0, 1867, 1891, 1898,
+     1882, 1900, 1888, 1902, 1878, 1897, 1889, 1907, 1899, 1896,
+     1901, 1882, 1905, 1914, 1909, 1893, 1893, 1893, 1909, 1921,
+     1894, 1913, 1920, 1915, 1903, 1902, 1908, 1929, 1905, 1912,
+     1915, 1915, 1913, 1935, 1911, 1912, 1928, 1913,    0, 1930,
+     1921, 1930, 1929, 1923,    0,    0, 1937, 1943, 1940, 1941,
+     1940, 1930, 1938, 1929, 1940, 1941, 1942, 1958, 1955, 1935,
+     1943, 1939, 1944, 1934, 1942, 1960, 1946, 1958, 1963, 1956,
+     1948,    0, 1972, 1951, 1965, 1976, 1966, 1978, 1954, 1980,
+     1963, 1974,    0,    0, 1971, 1971, 1968, 1964, 1965, 1976,
+
+     1991, 1971, 1970,    0, 1969, 1986, 1986, 1987, 1988, 1985,
+     1972, 1981, 1998, 1979, 1985, 1991, 1994, 1990, 1991, 2000,
+     1990, 1987, 1989, 2013, 1997, 1992, 2005, 2013, 2010, 2015,
+     2016,    0, 2007, 2018, 2006, 2003, 2015, 2003,    0, 2027,
+     2000, 2015, 2013, 2011, 2022, 2023, 2020, 2010, 2016, 2033,
+     2038, 2013, 2016, 2016, 2038, 2018, 2040, 2041, 2037, 2048,
+     2041,    0, 2050, 2028, 2052, 2034, 2047, 2025, 2052, 2051,
+     2058, 2059, 2043, 2038, 2039, 2042, 2041, 2049, 2043, 2066,
+     2040, 2066, 2048, 2061,    0, 2061, 2055, 2073, 2058, 2067,
+     2066, 2050, 2076, 2060, 2053, 2064,    0, 2076, 2087, 2063,
+
+     2077, 2086, 2081, 2078, 2068, 2077, 2087, 2073, 2066, 2092,
+     2079, 2076, 2081, 2093, 2092, 2090, 2097, 2106, 2091, 2104,
+     2083, 2092, 2113, 2096, 2111, 2116, 2117, 2087, 2088, 2104,
+     2122, 2106, 2115, 2108, 2096, 2127, 2101, 2129, 2113,    0,
+     2121, 2124, 2113, 2128, 2131, 2132, 2128, 2113, 2114, 2126,
+     2130, 2132, 2132, 2130,    0, 2135,    0,    0, 2129,    0,
+     2130, 2128, 2145, 2130, 2127, 2147, 2129, 2141, 2133, 2133,
+     2158, 2150, 2150, 2161, 2143,    0, 2157, 2141, 2151, 2152,
+        0, 2163,    0,    0, 2148, 2150, 2170, 2149, 2166, 2166,
+     2171, 2150, 2173,    0, 2166, 2154, 2159, 2175, 2168, 2157,
+
+     2167, 2168, 2169, 2179, 2168, 2164, 2165,    0, 2181, 2185,
+     2170, 2184, 2181, 2196,    0, 2178, 2194, 2168, 2190, 2194,
+     2192, 2193, 2194, 2182, 2181, 2207, 2198,    0, 2185, 2191,
+     2207, 2192, 2188, 2214, 2205, 2209, 2200, 2204, 2212, 2220,
+     2208, 2206, 2204, 2219,    0, 2217, 2218,    0, 2211, 2205,
+     2210, 2222,    0, 2222,    0, 2223, 2225, 2216, 2207, 2224,
+     2235, 2226, 2237, 2218, 2234, 2234, 2227, 2242, 2239, 2235,
+     2230, 2225,    0,    0, 2228, 2252, 2249, 2244, 2241, 2252,
+     2251, 2241, 2236, 2250, 2257, 2245,    0, 2238, 2250, 2251,
+     2241, 2237, 2258, 2241, 2250, 2248, 2262, 2250, 2253, 2271,
+
+     2267, 2257, 2268, 2248, 2256,    0, 2253, 2253, 2259, 2258,
+     2268, 2260,    0, 2278,    0, 2284, 2281, 2276, 2273, 2273,
+     2275, 2288, 2291, 2292, 2287, 2280, 2295, 2296, 2297, 2278,
+     2299, 2304, 2301, 2284, 2283,    0, 2298, 2305, 2286, 2307,
+     2308, 2290, 2303, 2307, 2310, 2313, 2294, 2315,    0, 2292,
+     2301, 2313, 2319, 2300, 2321, 2295, 2322, 2315, 2307,    0,
+     2316, 2324, 2309, 2315, 2307, 2320, 2313, 2330, 2321, 2322,
+     2329, 2330, 2341, 2327, 2347, 2339,    0, 2324,    0, 2336,
+     2345, 2352, 2347,    0, 2350, 2335, 2352, 2343, 2348, 2348,
+        0, 2336, 2346,    0, 2356, 2355, 2341, 2363,    0, 2354,
+
+     2363, 2339, 2353, 2362, 2369, 2355, 2369, 2359, 2371, 2359,
+     2355, 2374,    0, 2372, 2374, 2379, 2374, 2360, 2367, 2378,
+     2363, 2379, 2390, 2380, 2380,    0, 2372, 2373, 2385, 2396,
+     2384, 2391,    0,    0, 2380, 2394,    0,    0,    0, 2397,
+        0, 2385,    0, 2377, 2394, 2401,    0, 2402,    0,    0,
+     2407, 2402, 2388, 2383, 2397, 2402,    0, 2409,    0, 2414,
+     2392, 2396,    0, 2413,    0, 2408, 2412, 2401, 2411, 2398,
+     2414, 2421, 2422, 2416, 2424, 2425, 2413, 2408, 2415, 2407,
+     2417, 2418,    0, 2426, 2412, 2434, 2425, 2409, 2416, 2424,
+     2414, 2425,    0, 2422,    0, 2419, 2423, 2434, 2430, 2446,
+
+     2441, 2442, 2449, 2450,    0, 2447, 2431, 2447, 2448, 2436,
+        0, 2435, 2438, 2435, 2438, 2439, 2451, 2441, 2444, 2462,
+        0, 2465, 2456, 2459, 2452, 2450, 2451, 2454, 2452, 2467,
+     2474, 2469, 2480, 2458, 2462, 2459, 2459, 2460,    0, 2466,
+     2477, 2464,    0,    0, 2464, 2482, 2487, 2472, 2482, 2471,
+     2475,    0, 2487, 2493, 2480,    0, 2495, 2476, 2497, 2481,
+     2486, 2500,    0,    0, 2501,    0,    0, 2500, 2480, 2494,
+     2484, 2500, 2501, 2488, 2500,    0, 2494, 2505, 2506, 2497,
+     2514, 2515, 2520, 2511, 2498, 2506, 2499,    0, 2521, 2522,
+        0,    0, 2497, 2518, 2525, 2526, 2513, 2532, 2524, 2524,
+
+     2525, 2522, 2517, 2525, 2529, 2523,    0, 2533, 2519, 2525,
+     2530, 2531, 2540, 2533, 2523,    0, 2532, 2526, 2526, 2528,
+     2549, 2540, 2541, 2536, 2534, 2554, 2546, 2550,    0, 2547,
+     2552, 2545, 2547, 2545,    0, 2560,    0, 2563,    0, 2551,
+     2565,    0,    0, 2545, 2565, 2564, 2569, 2570, 2571, 2572,
+     2554, 2559, 2579, 2576, 2572,    0,    0, 2571, 2583, 2570,
+     2575, 2576,    0,    0, 2583, 2588,    0,    0, 2583, 2568,
+     2582, 2570, 2590, 2570, 2577, 2593, 2574, 2586, 2576, 2595,
+     2596, 2582, 2594, 2580, 2575, 2603, 2594, 2595, 2585, 2586,
+        0, 2595, 2605, 2598, 2601,    0, 2593, 2613, 2609, 2594,
+
+     2606, 2617, 2604, 2609,    0, 2594,    0, 2611, 2609, 2597,
+        0,    0,    0,    0, 2618, 2623, 2616,    0, 2621, 2618,
+     2608, 2615, 2631, 2613,    0, 2613, 2615, 2613, 2630, 2618,
+     2642,    0, 2613, 2640,    0, 2621, 2626, 2643, 2639, 2635,
+     2629, 2627, 2639, 2643,    0, 2635, 2624, 2652, 2633, 2648,
+     2655, 2634, 2651, 2652,    0, 2659, 2650, 2640,    0, 2660,
+     2648, 2668, 2642, 2666, 2667, 2648, 2656, 2649, 2671, 2659,
+     2652, 2666,    0, 2652, 2666, 2665, 2672, 2659, 2684, 2663,
+     2683,    0, 2684, 2665,    0, 2680, 2672, 2682, 2689, 2690,
+     2691, 2686, 2687,    0, 2694, 2695,    0, 2679, 2677, 2696,
+
+        0, 2685, 2700, 2691, 2702, 2682, 2698,    0,    0, 2696,
+     2706, 2701,    0, 2702, 2696, 2710, 2709, 2685, 2713, 2695,
+     2698, 2698, 2696, 2713,    0,    0, 2699, 2721, 2722, 2718,
+        0,    0,    0, 2724, 2725,    0,    0, 2726, 2727, 2723,
+     2723,    0, 2715,    0, 2710, 2732, 2717,    0, 2715, 2735,
+     2736,    0, 2724, 2732,    0, 2713, 2724, 2719, 2736, 2737,
+     2724, 2745,    0,    0, 2746,    0,    0,    0,    0, 2747,
+     2748, 2749, 2737,    0, 2738, 2750,    0,    0, 2753, 2754,
+     2759, 2741, 2751, 2738, 2740, 2743,    0,    0,    0,    0,
+        0, 2761, 2757, 2742,    0,    0, 2750, 2745, 2747, 2750,
+
+     2742, 2753,    0, 2770, 2761, 2766, 2767, 2748, 2759, 2780,
+     2762,    0, 2762, 2759, 2784, 2785, 2767, 2769, 2764, 2770,
+     2766, 2773, 2774, 2769, 2784, 2785, 2772, 2791, 2788, 2789,
+     2790, 2777, 2802, 2799, 2792, 2781, 2782, 2807, 2784, 2791,
+        0, 2800, 2787, 2788, 2795, 2808, 2805, 2792, 2811, 2812,
+     2809, 2808, 2797, 2818, 2811, 2812, 2801, 2816, 2803,    0,
+     2818, 2819, 2806, 2807, 2826, 2809, 2810, 2829, 2832, 2825,
+     2834, 2835, 2828,    0, 2831,    0,    0, 2832, 2819, 2820,
+     2841, 2842,    0,    0, 2855
     } ;
 
-static yyconst flex_int16_t yy_def[1745] =
+static yyconst flex_int16_t yy_def[2086] =
     {   0,
-     1730,    1, 1731, 1731, 1732, 1732, 1733, 1733, 1734, 1734,
-     1735, 1735, 1730, 1736, 1730, 1730, 1730, 1730, 1737, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1738,
-     1730, 1730, 1730, 1738, 1739, 1730, 1730, 1730, 1739, 1740,
-     1730, 1730, 1730, 1730, 1740, 1741, 1730, 1730, 1730, 1741,
-     1742, 1730, 1743, 1730, 1742, 1742, 1736, 1736, 1730, 1744,
-     1737, 1744, 1737, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1738, 1738, 1739, 1739, 1740, 1740, 1730,
-     1741, 1741, 1742, 1742, 1743, 1743, 1742, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1742, 1736, 1736, 1736,
-
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1742, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1730,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1742, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1742, 1736, 1736, 1736, 1736, 1736, 1730,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736,
-     1730, 1730, 1736, 1730, 1730, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736,
-     1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1742, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1730, 1742, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736,
-     1736, 1736, 1736, 1736, 1730, 1736, 1730, 1736, 1736, 1736,
-     1730, 1736, 1730, 1736, 1730, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1730, 1736, 1736, 1736, 1736, 1736, 1730, 1730, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730,
-     1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1730, 1736, 1730, 1736, 1730, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736,
-
-     1736, 1730, 1736, 1730, 1730, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1730,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736, 1730, 1736,
-     1736, 1736, 1730, 1736, 1730, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730,
-     1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736,
-     1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1730, 1736, 1730, 1736, 1736, 1736, 1736, 1730, 1736,
-     1736, 1730, 1736, 1730, 1736, 1736, 1736, 1736, 1730, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736,
-
-     1736, 1736, 1736, 1736, 1730, 1730, 1736, 1730, 1730, 1730,
-     1736, 1730, 1730, 1736, 1736, 1730, 1736, 1730, 1736, 1736,
-     1736, 1736, 1736, 1730, 1736, 1730, 1736, 1736, 1736, 1730,
-     1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730,
-     1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1730, 1736, 1730, 1730, 1736, 1736,
-     1736, 1736, 1736, 1730, 1736, 1736, 1736, 1730, 1736, 1736,
-
-     1736, 1736, 1730, 1730, 1730, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1730, 1730, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1730, 1736, 1736, 1736, 1730, 1736, 1730, 1736, 1730, 1730,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1730, 1730, 1736, 1736, 1730, 1730, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1730, 1736, 1730, 1736, 1736,
-
-     1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736, 1730, 1730,
-     1730, 1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736,
-     1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730,
-     1736, 1730, 1736, 1730, 1736, 1736, 1736, 1736, 1730, 1730,
-     1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1730, 1730, 1736, 1736, 1736, 1736, 1730, 1730, 1730,
-
-     1736, 1730, 1736, 1730, 1736, 1730, 1736, 1736, 1730, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730,
-     1730, 1736, 1730, 1736, 1736, 1730, 1736, 1736, 1730, 1730,
-     1736, 1736, 1736, 1736, 1736, 1736, 1730, 1730, 1730, 1730,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736,
-
-     1736, 1736, 1736, 1736, 1730, 1736, 1736, 1736, 1736, 1736,
-     1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1730, 1736,
-     1730, 1730, 1736, 1736, 1736, 1736, 1736, 1730, 1730,    0,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730
+     2085,    1, 2085,    3, 2085,    5, 2085,    7, 2085,    9,
+     2085,   11, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2085,
+     2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085,
+     2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085,
+     2085, 2085, 2085, 2085, 2085,   61,   14,   20,   15, 2085,
+       19,   70, 2085,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   40,   44,
+       40,   45,   49,   45,   50,   55,   51,   50,   56,   60,
+       56,   61,   65,   63, 2085,   61,   61,   19,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   63,   61,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   61,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2085,   14,   14,   14,
+       14,   14, 2085,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   61,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       61,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+     2085,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2085,   14, 2085, 2085,   14, 2085, 2085,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2085,   14,   14,   14,   14,   14,   14,   14, 2085,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   61,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2085,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14, 2085,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2085,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2085,   61,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2085,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2085,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2085,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2085,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2085,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2085,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14, 2085,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2085,   14,   14,   14,
+       14,   14,   14,   14,   14, 2085,   14, 2085,   14,   14,
+       14, 2085,   14, 2085,   14, 2085,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2085,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14, 2085,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2085,   14,
+       14,   14,   14,   14, 2085, 2085,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2085,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2085, 2085,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14, 2085,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2085,   14,   14,   14,   14,   14,   14, 2085,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2085,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2085,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2085,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2085,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2085,   14, 2085, 2085,   14, 2085,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2085,   14,   14,   14,   14,
+     2085,   14, 2085, 2085,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2085,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14, 2085,   14,   14,
+       14,   14,   14,   14, 2085,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14, 2085,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2085,   14,   14, 2085,   14,   14,
+       14,   14, 2085,   14, 2085,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2085, 2085,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2085,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14, 2085,   14,   14,   14,   14,
+       14,   14, 2085,   14, 2085,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2085,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2085,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2085,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2085,   14, 2085,   14,
+       14,   14,   14, 2085,   14,   14,   14,   14,   14,   14,
+     2085,   14,   14, 2085,   14,   14,   14,   14, 2085,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2085,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2085,   14,   14,   14,   14,
+       14,   14, 2085, 2085,   14,   14, 2085, 2085, 2085,   14,
+     2085,   14, 2085,   14,   14,   14, 2085,   14, 2085, 2085,
+       14,   14,   14,   14,   14,   14, 2085,   14, 2085,   14,
+       14,   14, 2085,   14, 2085,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2085,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2085,   14, 2085,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14, 2085,   14,   14,   14,   14,   14,
+     2085,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2085,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2085,   14,
+       14,   14, 2085, 2085,   14,   14,   14,   14,   14,   14,
+       14, 2085,   14,   14,   14, 2085,   14,   14,   14,   14,
+       14,   14, 2085, 2085,   14, 2085, 2085,   14,   14,   14,
+       14,   14,   14,   14,   14, 2085,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14, 2085,   14,   14,
+     2085, 2085,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14, 2085,   14,   14,   14,
+       14,   14,   14,   14,   14, 2085,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2085,   14,
+       14,   14,   14,   14, 2085,   14, 2085,   14, 2085,   14,
+       14, 2085, 2085,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2085, 2085,   14,   14,   14,
+       14,   14, 2085, 2085,   14,   14, 2085, 2085,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2085,   14,   14,   14,   14, 2085,   14,   14,   14,   14,
+
+       14,   14,   14,   14, 2085,   14, 2085,   14,   14,   14,
+     2085, 2085, 2085, 2085,   14,   14,   14, 2085,   14,   14,
+       14,   14,   14,   14, 2085,   14,   14,   14,   14,   14,
+       14, 2085,   14,   14, 2085,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2085,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2085,   14,   14,   14, 2085,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2085,   14,   14,   14,   14,   14,   14,   14,
+       14, 2085,   14,   14, 2085,   14,   14,   14,   14,   14,
+       14,   14,   14, 2085,   14,   14, 2085,   14,   14,   14,
+
+     2085,   14,   14,   14,   14,   14,   14, 2085, 2085,   14,
+       14,   14, 2085,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2085, 2085,   14,   14,   14,   14,
+     2085, 2085, 2085,   14,   14, 2085, 2085,   14,   14,   14,
+       14, 2085,   14, 2085,   14,   14,   14, 2085,   14,   14,
+       14, 2085,   14,   14, 2085,   14,   14,   14,   14,   14,
+       14,   14, 2085, 2085,   14, 2085, 2085, 2085, 2085,   14,
+       14,   14,   14, 2085,   14,   14, 2085, 2085,   14,   14,
+       14,   14,   14,   14,   14,   14, 2085, 2085, 2085, 2085,
+     2085,   14,   14,   14, 2085, 2085,   14,   14,   14,   14,
+
+       14,   14, 2085,   14,   14,   14,   14,   14,   14,   14,
+       14, 2085,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2085,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2085,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2085,   14, 2085, 2085,   14,   14,   14,
+       14,   14, 2085, 2085,    0
     } ;
 
-static yyconst flex_int16_t yy_nxt[5072] =
+static yyconst flex_int16_t yy_nxt[2895] =
     {   0,
        14,   15,   16,   17,   18,   19,   18,   14,   14,   14,
-       14,   18,   20,   14,   21,   22,   23,   24,   14,   25,
-       26,   27,   28,   29,   30,   31,   32,   33,   14,   34,
-       35,   36,   37,   38,   14,   14,   14,   14,   39,   20,
-       14,   21,   22,   23,   24,   14,   25,   26,   27,   28,
-       29,   30,   31,   32,   33,   14,   34,   35,   36,   37,
-       38,   14,   14,   14,   14,   41,   42,   43,   41,   42,
-       43,   46,   47,   46,   47,   48,   87,   48,   51,   52,
-       53,   54,   67,   18,   51,   52,   53,   54,   68,   18,
-       57,   58,   59,   57,   58,   59,   69,  124,  124,  126,
-
-       70,   44,  126,   87,   44,  131,  131,   49,   72,   49,
-       72,   72,   69,   72,  134,   55,   70,   67,   72,   67,
-       67,   55,   67,   85,   74,   75,   60,   67,  748,   60,
-       15,   16,   17,   62,   63,   64,   15,   16,   17,   62,
-       63,   64,   76,   86,   94,   73,   68,   96,   68,   65,
-       85,   74,   75,  134,   77,   65,   68,   88,   68,   68,
-      132,   78,  124,  124,   95,   89,  130,   66,   79,   76,
-       86,   94,  126,   66,   96,  126,   65,  131,  131,  129,
-       68,   77,   65,   68,   88,  139,   68,   90,   78,  120,
-       91,   95,   89,   97,  121,   79,   80,   92,  104,   93,
-
-       81,   98,   68,   82,   68,   83,   84,   99,   68,  101,
-       68,  100,  139,  102,   90,  127,  120,   91,   68,   68,
-       97,  121,  281,   80,   92,  104,   93,   81,   98,  103,
-       82,  125,   83,   84,   99,   68,  101,  105,  100,  128,
-      102,  128,  128,  106,  128,  109,  107,   68,  117,  110,
-      118,   68,  134,  108,  132,   68,  103,  161,  133,  111,
-      133,  133,  112,  133,  105,  119,  130,  185,  113,  199,
-      106,   68,  109,  107,   68,  117,  110,  118,  114,  138,
-      108,  122,  115,  116,  137,  123,  111,  129,   68,  112,
-       68,   72,  119,   72,   72,  113,   72,  134,   68,  128,
-
-       68,  128,  128,   68,  128,  114,  138,   68,  122,  115,
-      116,  137,  123,   67,  140,   67,   67,   72,   67,   72,
-       72,   68,   72,   67,  141,  143,  144,   72,  136,  145,
-      147,  146,  149,  127,   68,   68,  125,  142,  148,   68,
-       68,  140,  151,  152,   68,  156,   68,   68,   68,  150,
-       68,  141,  143,  144,   73,   68,  145,  147,  146,  153,
-      155,  157,  154,   68,  142,  148,  168,   68,   68,  151,
-      152,   68,  156,  162,   68,  158,  150, 1730,  159,   68,
-      169,   68,  167,   68,  163,   68,  153,  155,  157,  154,
-      165, 1730,  160,  168,  166,  170,  171,  175,  172,   68,
-
-      162,  174,  158,   68,  164,  159,   68,  169,   68,  167,
-       68,  163,  173, 1730,   68,   68, 1730,  165,   68,  160,
-       68,  166,  170,  171,  175,  172,   68,  176,  174,  177,
-      179,  164,  181,  178,  180,  182,   68,   68,  186,  173,
-      183,   68,  208,  184,  191, 1730,   68,   68,   68,  187,
-       68,   68,   68,   68,  176,  189,  177,  179,  192,  181,
-      178,  180,  182,  190,   68,  186,  194,  183,  196,  188,
-      184,  191,  195,   68,   68,   68,  187,   68,  197,  193,
-     1730, 1730,  189,   68, 1730,  192,  198,   68,   68,  133,
-      190,  133,  133,  194,  133,  196,  188,  200,   72,  195,
-
-       72,   72,  134,   72,  201,  197,  193,  202,   68,   68,
-      203,  204,  205,  198,  207,   68, 1730,  206,   68,  209,
-     1730,  217,   68,   68,  200,  216,  219,  218, 1730,   68,
-       68,  201,  220,  222,  202,  136,   68,  203,  204,  221,
-      210,  207,  227,   68,  206,  223,   68,   68,  217,   68,
-     1730,   68,  216,  219,  218,   68,  228,   68, 1730,  220,
-      222,   68,  224,  232,   68,  225,  221,  210,  211,  227,
-      226, 1730,  223,  212,  230,  229,  231,   68,  213,   68,
-      233,   68,   68,  228,  214,  215,  234,   68,  236,  224,
-      239,   68,  225,  238,   68,  211,  235,  226,  237,   68,
-
-      212,  230,  229,  231,  240,  213,   68,  233,  241,  242,
-      243,  214,  215, 1730,  244,  245,   68,   68, 1730,   68,
-      238,   68,   68,  235,  246,  237,   68,  247,  248, 1730,
-       68,  240,   68,  256,  249,   68,  250,  243,  252,   68,
-       68,  244,  245,  251,  253,   68,  257,   68,   68,   68,
-       68,  246,  258,   68,  247,  248,   68,  254,  255,  260,
-       68,  249,  259,  250,   68,  252,   68,  261,  262,  264,
-      251,  253,  263,  257,  266,   68,  267,   68,  272,  258,
-      270,  269,   68,   68,  254,  255,  274,  271,   68,  259,
-       68,  265, 1730,  268,  261,  262,  134,  273,   68,  263,
-
-       68,   68,  276,  267,  275,   68,   68,  270,  269,   68,
-      278,   68,   68,  277,  271,  279,   68,   68,  265,   68,
-      268,  280, 1730,  282,  273,  283, 1730,  284,  288,  276,
-      287,  275,   68,  285,  286,  289,  291,  278,   68,   68,
-      277,  293,  279,  290, 1730,   68,   68,   68,  280,   68,
-      282,   68,  283,   68,  284,  288,   68,  287,   68,  292,
-      285,  286,   68,  291,  294,  295,   68,  296,  297,  299,
-      290,   68,   68,   68,   68,  298,  300,  303,   68,  301,
-      304,   68,   68,  302, 1730,  305,  292,  306,   68,  314,
-      307,  294,  295,  308,  296,  297,  299,   68,   68,   68,
-
-       68,   68,  298,  300,   68,  310,  301,  304,   68,  309,
-      302,   68,  305,  311,  306,   68,   68,  307,  315,   68,
-      308,  312,  313,  316,  320,  318,  317,  323,   68,  319,
-     1730, 1730,  310,   68,  322,  321,  309,   68,  326,   68,
-      311,  328,   68,  324, 1730,  315,   68,   68,  312,  313,
-      316,   68,  318,  317,  323, 1730,  319,   68,   68,  325,
-       68,  322,  321,   68,  327,  329,   68,  330,  328,   68,
-      324,   68,  331,  332,  337,  335,  333,  336,  334, 1730,
-      339, 1730,  338,  340,   68,   68,  325,   68,   68,   68,
-      342,  327,  329,   68,  330,   68,   68,  353,  341,  331,
-
-      332,  337,  335,  333,  352,  334,  343,  339,   68,  338,
-      340,   68,  354,  344,   68,   68,   68,  342,  134,  355,
-      356,  357, 1730,  361,  353,  341,   68,   68,   68,  358,
-      359,  352,   68,  343,   68,   68,  360,  362,  364,  354,
-      344,  345,  346,   68,  363,   68,  355,  356,  357,   68,
-      361,  347,  366,  348,  349,  350, 1730,  359,  351,  365,
-       68, 1730,  367,  360,  362,  364,   68,  371,  345,  346,
-      368,  375,   68,   68,   68,   68,  369,  370,  347,  372,
-      348,  349,  350,   68,  373,  351,  365,  374,  378,  367,
-       68,  379,   68,  376,  371,   68,   68,  368,  375,  377,
-
-       68,   68,  382,  381,  380,   68,  372,  384,   68,   68,
-      383,  373,  385,  387,  374,  378,   68,  386,  379,  388,
-      376,   68,  392, 1730,   68,   68,  377,  389,  390,  382,
-      381,  380,  391,   68,  384,  393,   68,  383,   68,  394,
-      387,   68,   68,   68,  386,   68,  388,  396,  395,   68,
-      397,  398, 1730,   68,  389,  390,  400,   68,   68,  391,
-      401,  399,  393,   68, 1730,  402,  394,   68,  408,  405,
-       68,   68,  403,   68,  396,  395,   68,  397,  398,  404,
-      409,   68,   68,  400,   68,  411,   68,  401,  399,  410,
-      416,   68,  402,  406,  407,  408,  405,   68,   68,  403,
-
-       68,   68,  412,  414,   68,  413,  404,  409,   68,  415,
-      417,   68,  411,   68,   68,   68,  410,  416,  418,  420,
-      406,  407,   68,  419, 1730, 1730,  432,   68,  426, 1730,
-      414, 1730,  413,   68,   68,   68,  415,  417,  427,  428,
-       68, 1730, 1730, 1730,  430,  418,  420,  431,  429,   68,
-      419,  421,   68,  432,   68,  426,  422,  433,  423,   68,
-      434,  435,  439, 1730,  436,  427,  424,   68,   68,  437,
-       68,  430,  438,   68,  431,  429,  425,   68,  421,   68,
-       68,   68,  440,  422,  433,  423,   68,  434,  435,  439,
-      441,  436,  442,  424,  443,  444,  437,  445,  446,  438,
-
-       68, 1730,  447,  425,   68,  450,   68,  449,   68,  440,
-      448,   68,  451,   68,  453,  452,  455,  441,  134,  442,
-      463,  443,  444,  454,   68,  446,   68,   68,   68,  447,
-       68,  461,   68,  456,  449,   68,  457,  448,   68,  451,
-       68,  453,  452,  455,   68,  458,  462,  460,  464,  459,
-      454,   68,  465,  466,  470,  468,  467, 1730,   68,  472,
-      456,   68,   68,  457,  469,  471,  474,  475, 1730,  483,
-     1730,  473, 1730,   68,  460,   68,   68,   68,   68,   68,
-      476,   68,  468,  467,   68,   68,  472,   68,   68,   68,
-      477,  469,  471,   68,  475,  478,  481,   68,  473,  479,
-
-       68,  480,  482,  484, 1730,   68, 1730,  476,  485,  488,
-      489,  486,  493, 1730,   68,   68, 1730,  477,  490, 1730,
-      495,   68,  478,  481,   68,  494,  479,   68,  480,  482,
-      484,   68,   68,  487,   68,  485,  488,  489,  486,  491,
-       68,  492,  497,   68,   68,  490,   68,  495,  496,  498,
-       68,  500,  494,  501,  499,  503,   68,  502,   68,  504,
-      487,  506, 1730, 1730,   68, 1730,  491,   68,  492,  497,
-      507,  505,   68,   68,  512,  496,  498,   68,  500,   68,
-      501,  499,  513,  514,  502,   68,   68,  508,   68,  510,
-       68,  515,   68,  511,  516,  520,  517,  507,  505,   68,
-
-       68,  512,  509,   68,   68,  518,  524,  519,   68,  513,
-      514,   68,   68,   68,  508,  521,  522,  527,  515,  523,
-       68,  516,  520,  517,  526,   68,  529,   68,  525,  509,
-       68,   68,  518,  528,  519,  534,   68,   68,  533,  531,
-       68,  530,  521,  522,  527,  532,  523,   68,   68,   68,
-       68,  526,   68,  529,  535,  525,  536,   68,   68,   68,
-      528,  538,  534,  537,  539,  533,  531,  541,  530,  540,
-       68,  542,  532,  543,   68,  549,  544,  548,   68, 1730,
-       68,  535, 1730,  536,   68,   68,  545,   68,  538,  550,
-      537,  539,   68,  134,  541,   68,  540,   68,  542,   68,
-
-      543,  546,  551,  544,  548,  552,   68,  553,  565,  547,
-      554,  561,   68,  545,   68,  562,  550,   68,  555,   68,
-       68,  563,  564,   68,  566,   68,   68,   68,  546,  551,
-      574,   68,  552, 1730,  553,  565,  547,  554,  561,   68,
-      577,  594,  562,   68,  578,  555,  556,  575,  563,  564,
-      557,  595,   68,  558,  581,   68,   68,  574,  579,  576,
-      559,   68,  580,  560,   68, 1730,   68,  577,   68,  582,
-     1730,   68,   68,  556,  575, 1730,  583,  557,   68,  584,
-      558,  581,   68, 1730, 1730,  579,  576,  559,   68,  580,
-      560,  567,  568,  592,  569,   68,  582,  570,  586,  585,
-
-       68,   68,  571,  583,  587,   68,  584,   68,  572,  573,
-      590,  588,   68,  589,  591,   68,  593,   68,  567,  568,
-      592,  569,   68,   68,  570,  586,  585,  596,  597,  571,
-       68,  587,  603,  598,  599,  572,  573,  590,  588,   68,
-      589,  591,  601,   68,  604,  602,  605,  600, 1730,   68,
-     1730,   68,   68,   68,  596,  597,   68,  607,  606,   68,
-      598,  599,  608,   68,   68,   68,   68,  609, 1730,  601,
-      610,  604,  602,  614,  600,   68,  611,   68, 1730,   68,
-       68,  616,  612,  615,  607,  606,   68,   68,   68,  608,
-      613,  617,  621,  620,  609,  619,   68,  610,   68,  618,
-
-      614,  625,   68,  611,   68,   68,   68,  622,  616,  612,
-      615,   68,  624,  623,   68,   68,   68,  613,  617,  621,
-      620,   68,  619,  626,  627,  628,  618,  629,  625,  630,
-       68,   68,  631, 1730,  622,  632,  637, 1730,   68,  624,
-      623,  633,  634,   68,   68,  636,  638,  635,  639,  640,
-      626,  627,  628,   68,  641,   68,   68,   68,   68,  631,
-       68,  643,  632,   68,   68,  644,  645,   68,  633,  634,
-       68,   68,  636,  638,  635,  639,  640,  642,   68,  646,
-      648,  647,  649,   68,   68,   68,  658,  650,   68,   68,
-     1730,  660,  134,  645,   68,   68, 1730,  657,   68,  659,
-
-      661,   68,   68,   68,  642, 1730,  646,  648,  647,  649,
-     1730,  664, 1730,  658,  650,  651,  662,  652,  660,  663,
-       68,  653,   68,  654,  657,  665,  659,  661,  655,   68,
-      673,  666,   68,  656,   68,  668,  669,   68,  664,   68,
-     1730,  667,  651,  662,  652,  670,  663,  679,  653,   68,
-      654,   68,  665,   68,  671,  655,  672,   68,  666,  674,
-      656,   68,  668,  669,  675,  678,  676,   68,  667,   68,
-      682,  684,  670,  683,  679,  680,  685,   68,  687,  681,
-       68,  671,  689,  672,  677,   68,  674,  688,   68,   68,
-       68,  675,  678,  676,   68,   68,   68,  682,  684,  686,
-
-      683,  690,  680,  685,  691,   68,  681,   68,  692,  694,
-       68,  677,   68,   68,  688,  693,  695,   68,  698,  700,
-      696,  697,   68,  699,  702,   68,  686,   68,  690,   68,
-       68,  691,   68,  701,  706,  692,  694,   68,   68,  709,
-       68,  703,  693,  695,  704,  698,  700,  696,  697,   68,
-      699,   68,  705,   68,  707,   68,   68,   68,  708,  711,
-      701,  706,  710,  712,   68,  718,  709,  713,  703,  714,
-     1730,  704,  715,  716,  720,  717,   68,   68, 1730,  705,
-       68,  707,   68,  722,  719,  708,  723,  721,   68,  710,
-       68,   68,  718,   68,   68,   68,  714,   68,   68,  715,
-
-      716,  720,  717,  724,  725,   68,  726,  727,   68,  729,
-      722,  719,  731,  723,  721,   68,  730,  728,   68,  733,
-      732,   68, 1730,  734,   68,  738,   68,   68,   68,  735,
-      724,  725,  736,  726,   68,   68,  729,   68,  740,  731,
-       68,  741,  739,  730,  728,  742,  733,  732,  737,   68,
-      734,   68,  738,   68,   68,  743,  735,   68,   68,  736,
-      744,  746,  745,  747,  749,  740,  750,   68,  754,  739,
-       68,  751,   68,   68,   68,  737,   68, 1730,   68,   68,
-       68,  752,  743,   68,   68,  755,  753,   68,  746,  745,
-      747,  749,   68,  750,  756,  754,  757,  758,  751,   68,
-
-     1730,  759,  760,  761,  762,  763,  764,  767,  752,  765,
-      766,  768,  755,  753,   68,   68,   68,   68,   68,   68,
-       68,   68,  769,   68,  758,   68,   68,   68,  759,  760,
-      761,  762,  763,  764,   68,  770,  765,  766,  768,  771,
-      773,  772,   68,   68,  774,  775,  776, 1730, 1730,  769,
-      779,  781,  777,  778,  780,   68,  783,   68,   68,   68,
-       68,  782,  770,   68, 1730,   68,  771,  773,  772,   68,
-       68,  774,  775,  776,   68,   68,   68,  779,  781,  777,
-      778,  780,  784,  783,   68,  785,  786,  787,  782,  789,
-      788,  790,  792,  795,   68,   68,  793,   68,   68,  791,
-
-       68, 1730,   68,   68,   68,  799,   68,  794,  796,  784,
-      797, 1730,  785,  786,  787,  798,  789,  788,  790,  792,
-       68,   68,   68,  793,   68,   68,  791,   68,  803,   68,
-      802,  804,  799,  805,  794,  796,  800,  797,   68,  806,
-      801,  808,  798, 1730,  809,   68,  807, 1730,  810,  813,
-      815,   68,  814,  816,   68,  803,  812,  802,  804,  811,
-      805,   68,   68,   68, 1730,  817,   68,   68,  808,  823,
-       68,  809,   68,  807,   68,  810,  813,   68,   68,  814,
-      818,   68,  824,  812,   68,   68,  811,   68,  819,  825,
-      826,  829,  817,  820,  827,  821,  823,  822,  828,   68,
-
-      830,   68,  831,   68,   68,   68,   68,  818,   68,  824,
-      832,  834,  835,   68,  836,  819,  825,  826,  829,  833,
-      820,   68,  821,   68,  822,   68,   68,  830,   68,  831,
-      837,  838,  839,  841,  840,  843,  842,  832,  834,   68,
-      845,  836,   68,   68,  844,  846,  833,  847,  849,  848,
-      854,  850,   68,  853,   68,   68,  851,   68,  838,  839,
-       68,  840,   68,  842,  852,   68,   68,   68,   68,   68,
-       68,  844,  846,   68,  847,  849,  848,   68,  850,  855,
-      853,   68,  856,  851,  857,   68,  859,  858, 1730,  861,
-      860,  852,  862,  863,   68,  864,  867,   68, 1730,   68,
-
-     1730,  870,  869,   68,   68,   68,   68,  868, 1730,  856,
-       68,   68,  865,  859,  858,   68,   68,  860,  866,  862,
-      863,  874,   68,  867,  871,   68,   68,   68,  870,  869,
-      872,   68,   68,  873,  868,  879,  875,  876,  884,  865,
-       68,  882,   68,   68,  881,  866,  877,  880,  874,  883,
-      878,  871, 1730,   68,   68, 1730,  885,  872, 1730,   68,
-      873,   68,  879,  875,  876,  884,   68,  886,  882,   68,
-      889,  881,   68,  888,  880,   68,  890,   68,  887,   68,
-       68,  891,   68,  885,  892,   68,  893,  896,   68,  895,
-      894, 1730,   68,  898,  886,   68, 1730,  889,   68,   68,
-
-      888,   68,   68,  890,  899,  887,  897,   68,  891,  900,
-      901,  892,  902,  893,  896,  904,  895,  894,   68,  906,
-      898,   68,  903,  905,  908,   68,   68,   68,  909,   68,
-      907,  899,   68,  897,  910,  911,  900,  901,  912,  902,
-       68,  913,  904,  914,   68,  915,  906,   68,  918,  903,
-      905,  924,   68,   68,  916,   68,   68,  907,  917,   68,
-       68,  910,   68,   68, 1730,  912,  919,  923,  913,  920,
-      914, 1730,  915,  922,   68,   68,  925,   68,  921,   68,
-      932,   68,   68,  926,   68,   68,  929,  927,   68,  928,
-      931,   68,  930,  919,  923,   68,  920,   68,   68,   68,
-
-      922,  933,   68,  925,  934,  921,   68,  932,  935,  941,
-      926,  936,  942,  929,  927,  945,  928,  931, 1730,  930,
-      937,  943,   68,   68,  938,  940,  944,   68,  933,   68,
-      948,  934,   68,   68,   68,  935,   68,  939,  936,  942,
-      946,  947,  949,  950,   68,   68,   68,  937,  943,   68,
-      951,  938,  940,  944,  952,  959,   68,  948,  953,  954,
-      955,  956,   68,   68,  939, 1730, 1730,  946,  947,  957,
-       68,   68,  960,   68,   68,  961,  966,   68,   68,   68,
-      958,  952,   68,  977,   68,  953,  954,  955,  956,  962,
-      963,   68,   68,  969,   68,  964,  957,  965,   68,  960,
-
-      967,   68,  961,  966,  970,   68,   68,  958,  968,   68,
-      973,  979,  976,  975,   68, 1730,  962,  963,   68,   68,
-      969,   68,  964,  971,  965,  972,   68,  967,   68,  974,
-       68,  970,   68,  980,   68,  968,   68,  973,   68,  976,
-      975,  978,   68,  981,  982,  991,   68,  984,   68,  985,
-      971,  983,  972,  990,   68,  986,  974, 1730,  993,  992,
-      980,  994,   68,   68,   68,   68,  987,   68,  978,  988,
-       68,  982,  991,   68,  984,  995,  985,   68,  983,  996,
-       68,  989,  986, 1730,   68,  993,  992,  997,  994,  998,
-       68, 1005,  999,  987, 1000, 1001,  988, 1002,   68,   68,
-
-       68,   68,  995, 1003, 1004, 1006, 1007,   68,  989, 1013,
-       68, 1010, 1730,   68,  997,   68,  998,   68,   68,  999,
-     1011, 1000, 1001, 1012,   68, 1730,   68,   68,   68, 1008,
-     1003, 1004, 1006, 1007, 1009,   68,   68,   68, 1010, 1014,
-       68,   68, 1015, 1017, 1019, 1016,   68, 1011, 1018,   68,
-     1012,   68, 1022, 1023, 1024, 1020, 1008, 1032, 1021, 1027,
-       68, 1009, 1025,   68,   68,   68, 1014, 1033, 1730, 1015,
-     1017, 1019, 1016,   68, 1031, 1018, 1026,   68,   68, 1022,
-       68, 1024, 1020, 1028,   68, 1021, 1027,   68,   68, 1025,
-     1029,   68,   68, 1030,   68, 1034, 1036, 1035, 1038, 1037,
-
-       68, 1031,   68, 1026, 1039,   68, 1040, 1041,   68, 1048,
-     1028,   68,   68,   68, 1042, 1730, 1043, 1029,   68, 1047,
-     1030, 1050, 1034, 1036, 1035, 1038, 1037, 1053,   68, 1051,
-     1044, 1039,   68, 1040, 1041, 1045,   68, 1052, 1046, 1049,
-       68, 1042,   68, 1043,   68, 1054, 1047, 1058,   68, 1055,
-       68, 1057,   68,   68, 1059, 1056, 1051, 1044,   68,   68,
-     1060,   68, 1045,   68, 1052, 1046, 1049, 1061,   68, 1062,
-       68, 1730, 1054,   68, 1058, 1063, 1055, 1065, 1057, 1064,
-       68, 1059, 1056, 1066,   68, 1067,   68, 1060, 1070, 1068,
-     1069, 1071,   68, 1072, 1075, 1730, 1062, 1730,   68, 1074,
-
-       68, 1073, 1063,   68, 1065,   68, 1064,   68,   68,   68,
-     1066,   68, 1067, 1078,   68, 1070, 1068, 1069, 1071,   68,
-       68, 1075, 1076, 1077, 1079, 1080, 1074, 1081, 1073, 1082,
-     1730,   68, 1084, 1083,   68, 1085, 1086,   68, 1730,   68,
-     1087, 1730, 1088, 1089,   68, 1098, 1730, 1097,   68, 1076,
-     1077, 1079, 1080,   68, 1081,   68,   68,   68, 1090,   68,
-     1083,   68, 1085,   68,   68, 1091, 1092, 1087, 1093, 1088,
-     1089, 1095, 1096,   68,   68, 1101,   68,   68,   68, 1100,
-     1102, 1094,   68, 1099,   68, 1090,   68,   68,   68,   68,
-     1103, 1104, 1091, 1092, 1105, 1093, 1106,   68, 1095, 1096,
-
-     1107, 1108, 1101, 1109, 1111, 1110, 1100,   68, 1094, 1112,
-     1099,   68, 1113, 1115,   68, 1114, 1125, 1103,   68,   68,
-     1730,   68, 1120, 1106, 1730,   68, 1121, 1123, 1108,   68,
-     1122,   68, 1110,   68,   68,   68, 1112,   68, 1127,   68,
-       68,   68, 1114,   68,   68, 1116, 1117, 1118, 1128, 1120,
-     1124, 1129, 1119, 1121, 1123,   68,   68, 1122, 1126,   68,
-       68, 1130, 1132, 1133,   68, 1127, 1134,   68, 1131,   68,
-     1135, 1139, 1116, 1117, 1118, 1128, 1137, 1124, 1129, 1119,
-       68,   68,   68, 1136,   68, 1126, 1138,   68,   68, 1132,
-     1133, 1140, 1141, 1134, 1142, 1131,   68, 1135,   68, 1144,
-
-     1143, 1146,   68, 1137, 1145, 1147, 1148, 1730,   68, 1150,
-     1136,   68,   68, 1138, 1730,   68,   68,   68, 1140, 1141,
-     1154,   68,   68, 1149,   68, 1151, 1144, 1143, 1146,   68,
-     1152, 1145, 1147, 1148, 1153,   68, 1150,   68,   68, 1156,
-     1155,   68, 1159, 1157, 1163, 1160,   68, 1154, 1158, 1161,
-     1149,   68, 1151, 1162, 1166, 1169, 1164, 1152,   68,   68,
-     1165, 1153,   68, 1167,   68, 1168,   68, 1155, 1170,   68,
-     1157,   68, 1160, 1171, 1172, 1158, 1161, 1173, 1174,   68,
-       68, 1176, 1197,   68,   68,   68,   68,   68, 1175,   68,
-     1167, 1177, 1168,   68, 1730, 1170,   68, 1178, 1730, 1179,
-
-     1171, 1172, 1180, 1181, 1173, 1184,   68, 1182, 1188,   68,
-     1183, 1730,   68,   68,   68, 1175, 1730, 1185, 1177, 1187,
-     1190,   68, 1186,   68, 1178,   68, 1179,   68, 1189,   68,
-       68,   68, 1184, 1192, 1182, 1188, 1195, 1183,   68, 1193,
-       68,   68, 1194,   68, 1185, 1191, 1187,   68,   68, 1186,
-       68,   68,   68, 1196, 1198, 1189, 1207, 1199, 1202,   68,
-     1192, 1201, 1204, 1195, 1203, 1205, 1193,   68, 1200, 1194,
-       68, 1209, 1191, 1206, 1210,   68,   68,   68, 1211, 1730,
-     1196, 1198,   68,   68, 1199, 1202,   68,   68, 1201,   68,
-     1212, 1203, 1205, 1208, 1215, 1200, 1214,   68, 1209,   68,
-
-     1206, 1210, 1213,   68, 1217,   68, 1220, 1216, 1730,   68,
-       68, 1218,   68,   68, 1223, 1219, 1228, 1212,   68,   68,
-     1208, 1215,   68, 1214, 1224, 1221,   68, 1226, 1222, 1213,
-       68, 1217,   68, 1220, 1216,   68,   68, 1225, 1218, 1230,
-     1227, 1223, 1219,   68, 1231,   68,   68, 1229,   68,   68,
-     1232, 1224, 1221,   68, 1226, 1222, 1233, 1236, 1235, 1234,
-     1237,   68, 1238, 1239, 1225,   68, 1230, 1227,   68,   68,
-       68, 1231,   68, 1240, 1229, 1244,   68, 1232,   68, 1241,
-     1243, 1246,   68, 1233, 1730, 1235, 1234, 1237,   68, 1238,
-     1239,   68, 1242, 1245, 1250, 1247,   68,   68, 1248,   68,
-
-       68, 1249, 1244, 1254, 1256, 1252, 1241, 1253, 1246, 1251,
-     1730,   68,   68,   68, 1257,   68, 1255,   68,   68, 1242,
-     1245, 1250, 1247,   68,   68, 1248,   68,   68, 1249,   68,
-     1254, 1256, 1252, 1258, 1253,   68, 1251, 1259, 1260, 1261,
-       68, 1257, 1262, 1255, 1263, 1264, 1730, 1265, 1267,   68,
-     1266, 1269, 1271, 1268,   68,   68, 1272,   68, 1273,   68,
-     1258, 1274,   68, 1270, 1259, 1260, 1261,   68, 1275,   68,
-       68, 1263,   68,   68, 1265, 1267,   68, 1266,   68, 1271,
-     1268, 1276,   68,   68, 1277, 1273, 1279, 1278,   68, 1280,
-     1270,   68, 1730,   68,   68, 1275,   68, 1281, 1282, 1284,
-
-     1283, 1285,   68, 1287, 1286, 1289, 1288, 1730, 1276,   68,
-       68, 1277,   68,   68, 1278,   68, 1280,   68, 1290,   68,
-     1299,   68, 1291,   68, 1281, 1282, 1284, 1283, 1285,   68,
-       68, 1286, 1289, 1288, 1292, 1293, 1295, 1296, 1294,   68,
-       68,   68,   68,   68,   68, 1290, 1298,   68, 1300, 1291,
-     1304, 1297,   68, 1301, 1305, 1302, 1303, 1306, 1308, 1309,
-     1307, 1292, 1293, 1295, 1296, 1294,   68,   68,   68, 1310,
-       68, 1311,   68, 1298,   68, 1300,   68, 1304, 1297,   68,
-     1301,   68, 1302, 1303,   68,   68,   68, 1307, 1312, 1313,
-     1315, 1314, 1316, 1317, 1318, 1319,   68, 1730, 1311,   68,
-
-     1321,   68, 1320, 1324,   68, 1325, 1326, 1327, 1329, 1730,
-     1322,   68,   68,   68, 1328,   68,   68, 1315, 1314,   68,
-     1317,   68, 1319,   68,   68, 1323,   68, 1321, 1330, 1320,
-       68,   68, 1325,   68, 1327, 1329,   68, 1322, 1331, 1332,
-     1335, 1328, 1333,   68, 1334, 1336,   68, 1338, 1339,   68,
-     1340, 1337, 1323, 1346, 1341,   68,   68, 1730,   68, 1730,
-       68, 1343,   68, 1347, 1344, 1331,   68, 1335, 1342, 1333,
-       68, 1334, 1336,   68, 1338, 1339,   68, 1340, 1337,   68,
-       68, 1341,   68, 1345,   68, 1348,   68, 1349, 1343, 1350,
-     1347, 1344,   68, 1351, 1352, 1342,   68, 1730, 1356, 1354,
-
-     1355, 1730, 1353, 1730, 1357,   68, 1360, 1361, 1358, 1362,
-     1345,   68, 1348,   68, 1349,   68, 1350, 1363,   68, 1370,
-       68, 1352,   68, 1364,   68, 1356, 1354, 1355,   68, 1353,
-       68, 1357, 1359,   68,   68, 1358, 1362, 1366,   68,   68,
-     1365, 1730, 1367,   68, 1363,   68,   68, 1368, 1369, 1371,
-     1364, 1372, 1373,   68, 1374, 1375, 1377, 1730,   68, 1359,
-     1730, 1376,   68, 1378, 1366,   68, 1381, 1365,   68, 1367,
-       68,   68,   68, 1380, 1368, 1369, 1371,   68, 1372, 1373,
-     1379, 1374, 1375,   68,   68, 1382, 1383,   68, 1376, 1384,
-     1378,   68, 1385, 1387, 1388,   68, 1386,   68, 1389, 1390,
-
-     1380, 1392, 1395, 1391,   68, 1393,   68, 1379, 1394, 1730,
-     1398,   68, 1382, 1383,   68,   68, 1384, 1399,   68,   68,
-       68,   68, 1396, 1386, 1397,   68, 1390,   68, 1392,   68,
-     1391,   68, 1393,   68, 1400,   68,   68,   68, 1402,   68,
-     1401, 1403, 1404, 1405, 1399, 1407, 1730, 1406, 1408, 1396,
-     1730, 1397, 1413,   68,   68, 1411, 1409, 1412, 1410,   68,
-       68, 1400,   68,   68,   68, 1402, 1730, 1401,   68,   68,
-       68,   68, 1407,   68, 1406, 1408, 1414,   68, 1417,   68,
-     1415,   68, 1411, 1409, 1412, 1410, 1416, 1418, 1419, 1420,
-       68, 1421,   68,   68,   68, 1422,   68, 1423,   68, 1424,
-
-     1425,   68, 1426, 1414, 1434, 1417, 1730, 1415, 1730,   68,
-     1433, 1427, 1430, 1416, 1418, 1419, 1420,   68, 1421,   68,
-       68, 1436, 1422, 1428, 1423, 1429,   68,   68,   68, 1426,
-       68,   68,   68, 1431, 1432, 1435,   68, 1433, 1427, 1430,
-       68,   68, 1437,   68, 1442, 1443, 1438, 1439, 1436, 1730,
-     1428, 1441, 1429,   68,   68,   68,   68, 1440, 1444,   68,
-     1431, 1432, 1435, 1445, 1446, 1450, 1451,   68,   68, 1437,
-     1447,   68,   68, 1438, 1439,   68,   68,   68, 1441, 1448,
-     1454, 1449, 1452, 1455, 1440, 1444, 1453,   68,   68,   68,
-     1445, 1446, 1450,   68,   68,   68, 1457, 1447, 1456, 1459,
-
-     1460, 1730, 1461,   68, 1463, 1730, 1448, 1454, 1449, 1452,
-       68, 1458,   68, 1453, 1464, 1462, 1466, 1465, 1467,   68,
-       68, 1468,   68,   68,   68, 1456,   68,   68,   68, 1461,
-     1469, 1463, 1470,   68, 1471, 1472,   68,   68, 1458,   68,
-     1473, 1464, 1462, 1466, 1465, 1467,   68, 1474, 1468, 1475,
-     1476, 1478,   68, 1477,   68, 1730, 1479, 1469, 1730, 1470,
-     1482, 1471,   68, 1480, 1484, 1730, 1481,   68, 1486, 1483,
-     1730,   68,   68, 1730, 1485, 1730, 1475,   68,   68,   68,
-       68, 1489,   68, 1479,   68,   68,   68, 1482,   68,   68,
-     1480, 1484,   68, 1481, 1487, 1486, 1483, 1488, 1490,   68,
-
-     1491, 1485, 1492,   68, 1493, 1496, 1494, 1495, 1489, 1498,
-     1497,   68,   68,   68, 1730,   68,   68, 1500, 1503, 1499,
-       68, 1487, 1501, 1505, 1488, 1490,   68, 1491,   68, 1492,
-       68, 1493,   68, 1494, 1495, 1504,   68, 1497,   68,   68,
-       68, 1502, 1514, 1507, 1500, 1503, 1499, 1506, 1508, 1501,
-       68, 1509, 1510, 1511,   68,   68, 1512, 1515, 1513, 1516,
-     1517,   68, 1504, 1518, 1730,   68, 1525, 1730, 1502,   68,
-     1507,   68,   68,   68, 1506, 1508, 1730, 1521,   68,   68,
-       68,   68,   68, 1512,   68, 1513, 1516, 1517, 1519, 1520,
-     1523, 1522, 1524,   68,   68, 1526, 1531,   68,   68,   68,
-
-       68, 1527, 1528,   68, 1521,   68, 1529,   68, 1530, 1532,
-       68, 1534,   68, 1540, 1533, 1519, 1520, 1523, 1522, 1524,
-       68,   68, 1526, 1531, 1535, 1538, 1730, 1541, 1527, 1528,
-     1536,   68,   68, 1529,   68, 1530, 1532,   68, 1534, 1537,
-       68, 1533,   68, 1542, 1539, 1543,   68, 1544, 1546,   68,
-       68, 1535, 1538,   68, 1541, 1545, 1547, 1536,   68,   68,
-     1549,   68, 1548,   68, 1730,   68, 1537, 1550, 1551, 1557,
-     1542, 1539, 1543,   68, 1544, 1546, 1555, 1558, 1552,   68,
-     1559, 1553, 1545, 1547,   68,   68,   68, 1549,   68, 1548,
-       68, 1554, 1556, 1562, 1550, 1551,   68,   68,   68, 1561,
-
-       68,   68, 1560, 1555, 1558, 1552, 1564,   68, 1553, 1563,
-       68,   68, 1565, 1566, 1570, 1567, 1568, 1571, 1554, 1556,
-       68,   68, 1572,   68,   68,   68, 1561, 1569,   68, 1560,
-     1573, 1574,   68, 1564,   68, 1576, 1563, 1577,   68, 1565,
-     1566,   68, 1567, 1568, 1571, 1579, 1575, 1580, 1730,   68,
-       68, 1578,   68,   68, 1569, 1581,   68, 1573,   68, 1583,
-     1582,   68, 1576,   68, 1577, 1584,   68, 1587, 1585, 1586,
-     1589, 1588,   68, 1575,   68,   68,   68, 1592, 1578,   68,
-     1590, 1591, 1581,   68, 1593, 1594, 1583, 1582, 1595,   68,
-       68, 1598,   68,   68, 1587, 1585, 1586, 1597, 1588, 1599,
-
-     1596,   68, 1600, 1601,   68, 1602, 1604, 1590, 1591, 1603,
-       68,   68, 1594,   68, 1606, 1595, 1605, 1607,   68,   68,
-     1609, 1608, 1612, 1610, 1597,   68,   68, 1596, 1730,   68,
-     1601, 1611,   68,   68,   68,   68, 1603,   68, 1618,   68,
-       68,   68, 1613, 1605, 1607,   68, 1614,   68, 1608, 1612,
-     1610,   68, 1619,   68, 1615, 1616, 1617,   68, 1611,   68,
-       68, 1620,   68, 1621,   68, 1618, 1622, 1623, 1624, 1613,
-     1626, 1625, 1629, 1614, 1627, 1630, 1628, 1730, 1631, 1619,
-       68, 1615, 1616, 1617,   68,   68,   68, 1634,   68,   68,
-       68,   68, 1632, 1622,   68, 1624, 1635,   68, 1625,   68,
-
-     1633, 1627,   68, 1628,   68, 1631,   68, 1636, 1637,   68,
-     1638, 1639, 1640, 1641, 1634,   68, 1642, 1643,   68, 1632,
-     1644, 1730, 1645, 1635, 1646, 1730, 1730, 1633,   68, 1649,
-     1648, 1730,   68,   68, 1636,   68, 1647,   68,   68,   68,
-     1641,   68,   68, 1642,   68,   68, 1650, 1644,   68, 1645,
-     1651, 1646,   68,   68, 1652, 1654, 1649, 1648, 1653, 1655,
-     1656,   68,   68, 1647,   68, 1657,   68,   68, 1659, 1660,
-     1658, 1662,   68, 1650, 1661, 1663,   68, 1651, 1667, 1668,
-     1664, 1652, 1654,   68, 1730, 1653, 1655, 1656,   68, 1670,
-       68,   68,   68,   68, 1666, 1659, 1660, 1658, 1662, 1665,
-
-     1669, 1661,   68,   68, 1671, 1672,   68, 1664, 1677,   68,
-       68,   68,   68,   68, 1673, 1674, 1670, 1676,   68, 1675,
-     1679, 1666,   68, 1678, 1685,   68, 1665, 1669,   68,   68,
-       68, 1671, 1672,   68, 1680, 1677, 1681, 1682, 1686, 1730,
-     1683, 1673, 1674, 1684, 1676,   68, 1675, 1679, 1687, 1688,
-     1678,   68, 1690, 1697, 1730,   68, 1730,   68,   68,   68,
-       68, 1680,   68, 1681, 1682,   68, 1689, 1683,   68, 1691,
-     1684, 1692, 1693, 1694,   68, 1687, 1688,   68, 1695,   68,
-     1697,   68, 1698,   68, 1699,   68,   68, 1696, 1730, 1700,
-     1730, 1701,   68, 1689,   68, 1730, 1691, 1702, 1692, 1693,
-
-     1694,   68, 1703, 1705,   68, 1695, 1706, 1707, 1730, 1698,
-     1709, 1699, 1704, 1708, 1696,   68, 1700,   68, 1701,   68,
-       68,   68,   68, 1710, 1702, 1711,   68,   68, 1713, 1703,
-       68,   68,   68, 1706, 1707, 1712,   68, 1709, 1714, 1704,
-     1708, 1715, 1719, 1716, 1720, 1717,   68,   68, 1718, 1721,
-     1710,   68, 1711,   68, 1722, 1713, 1730,   68, 1723, 1730,
-     1724, 1725, 1712, 1728,   68, 1714, 1729,   68, 1715,   68,
-     1716, 1720, 1717, 1730,   68, 1718,   68, 1730,   68, 1730,
-     1730,   68,   68,   68, 1726, 1723, 1727, 1724, 1725, 1730,
-       68, 1730,   68,   68,   68, 1730, 1730, 1730, 1730, 1730,
-
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1726, 1730, 1727,   40,   40,   40,   40,   40,   40,
-       40,   45,   45,   45,   45,   45,   45,   45,   50,   50,
-       50,   50,   50,   50,   50,   56,   56,   56,   56,   56,
-       56,   56,   61,   61,   61,   61,   61,   61,   61,   71,
-       71, 1730,   71,   71,   71,   71,  124,  124, 1730, 1730,
-     1730,  124,  124,  126,  126, 1730, 1730,  126, 1730,  126,
-      128, 1730, 1730, 1730, 1730, 1730,  128,  131,  131, 1730,
-     1730, 1730,  131,  131,  133, 1730, 1730, 1730, 1730, 1730,
-      133,  135,  135, 1730,  135,  135,  135,  135,   72,   72,
-
-     1730,   72,   72,   72,   72,   13, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730
+       14,   18,   20,   21,   14,   22,   23,   24,   25,   14,
+       26,   27,   28,   29,   30,   31,   32,   33,   34,   14,
+       35,   36,   37,   38,   39,   14,   14,   14,   14,   40,
+       40,   41,   42,   43,   40,   40,   40,   40,   40,   40,
+       40,   44,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   45,   45,
+       46,   47,   45,   45,   48,   45,   45,   45,   45,   45,
+       49,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   50,   51,   52,
+       53,   54,   50,   18,   50,   50,   50,   50,   50,   55,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   56,   56,   57,   58,
+       59,   56,   56,   56,   56,   56,   56,   56,   60,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   61,   15,   16,   17,   62,
+
+       63,   64,   61,   61,   61,   61,   61,   65,   61,   61,
+       61,   61,   61,   61,   61,   61,   66,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   67,   90,   69,   98,   99,   67,
+       70,   67,   67,   67,   67,  100,   68,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   71,   72,  108,   72,   72,   71,   72,
+       71,   71,   71,   71,   72,   73,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   74,   74,  137,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   75,   76,   79,   83,   77,   88,  147,   84,  149,
+       80,   85,   91,   86,   87,  150,   92,   81,   82,   78,
+       93,   94,  101,  105,   95,  113,   89,  106,  109,  114,
+      102,   96,  151,   97,  110,  117,  103,  111,  152,  115,
+      104,  124,  116,  107,  112,  118,  121,  155,  122,  119,
+
+      120,  125,  158,  127,  159,  160,  126,  128,  161,  129,
+      129,  162,  165,  123,  129,  129,  129,  129,  129,  129,
+      129,  130,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  131,  131,
+      166,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  132,  132,  167,
+      170,  132,  132,  171,  132,  132,  132,  132,  132,  133,
+
+      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+      132,  132,  132,  132,  132,  132,  134,  134,  172,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  135,  168,  169,  173,  177,
+      135,  178,  135,  135,  135,  135,  135,  136,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+
+      135,  135,  135,  135,  138,  138,  183,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  139,  139,  184,  185,  186,  139,  139,
+      139,  139,  139,  139,  139,  140,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  141,  141,  187,  141,  141,  141,  141,  141,
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+      141,  142,  188,  181,  189,  190,  142,  182,  142,  142,
+      142,  142,  142,  143,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      144,   72,  191,   72,   72,  144,   72,  144,  144,  144,
+      144,  144,  145,  144,  144,  144,  144,  144,  144,  144,
+      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+      144,  144,  144,  144,  144,  144,  144,  144,  144,  146,
+
+      146,  192,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,   72,   72,
+      195,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,  148,  148,  196,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  148,  148,  148,  148,  153,  156,  163,  179,
+      174,  193,  197,  175,  198,  194,  199,  200,  201,  154,
+      157,  202,  203,  205,  206,  207,  164,  176,  208,  180,
+      209,  211,  212,  213,  215,  216,  217,  218,  219,  220,
+      221,  222,  204,  223,  224,  225,  228,  229,  237,  214,
+      214,  210,  214,  214,  214,  214,  214,  214,  214,  214,
+      214,  214,  214,  214,  214,  214,  214,  214,  214,  214,
+      214,  214,  214,  214,  214,  214,  214,  214,  214,  214,
+      214,  214,  214,  214,  214,  214,  214,  214,  226,  230,
+
+      232,  238,  239,  240,  227,  233,  241,  242,  243,  244,
+      234,  245,  246,  249,  250,  247,  235,  236,  248,  251,
+      253,  231,  254,  255,  256,  258,  260,  261,  262,  263,
+      264,  265,  266,  267,  257,  268,  259,  269,  252,  270,
+      271,  272,  273,  274,  275,  276,  277,  278,  281,  282,
+      283,  284,  285,  286,  287,  288,  279,  280,  289,  290,
+      292,  293,  295,  296,  297,  298,  299,  300,  301,  302,
+      303,  304,  305,  306,  307,  308,  309,  310,  294,  311,
+      312,  313,  291,  314,  315,  316,  317,  318,  319,  320,
+      321,  322,  323,  324,  325,  326,  327,  328,  329,  330,
+
+      331,  332,  333,  334,  335,  336,  337,  338,  340,  341,
+      339,  343,  342,  344,  345,  346,  347,  348,  349,  351,
+      352,  350,  353,  354,  355,  356,  357,  358,  359,  360,
+      361,  362,  363,  365,  364,  366,  369,  370,  367,  371,
+      368,  372,  374,  375,  373,  376,  377,  378,  380,  388,
+      389,  390,  381,  382,  391,  392,  393,  394,  395,  396,
+      397,  398,  383,  379,  384,  385,  386,  399,  400,  387,
+      401,  402,  403,  404,  405,  406,  407,  408,  409,  410,
+      411,  412,  413,  414,  415,  416,  417,  418,  419,  420,
+      422,  423,  424,  425,  426,  427,  428,  429,  430,  431,
+
+      432,  433,  421,  434,  435,  436,  437,  438,  439,  440,
+      441,  442,  443,  444,  445,  446,  447,  448,  449,  450,
+      451,  452,  453,  454,  455,  456,  458,  459,  460,  461,
+      462,  463,  464,  465,  466,  471,  472,  473,  476,  467,
+      474,  468,  477,  478,  479,  480,  481,  482,  457,  469,
+      475,  483,  484,  485,  486,  487,  488,  489,  490,  470,
+      491,  492,  493,  494,  495,  496,  500,  501,  502,  503,
+      504,  505,  506,  507,  508,  509,  511,  497,  510,  498,
+      512,  513,  514,  499,  515,  516,  517,  518,  519,  520,
+      521,  522,  523,  524,  525,  526,  527,  528,  529,  530,
+
+      531,  532,  536,  537,  538,  539,  533,  540,  541,  542,
+      534,  544,  545,  546,  547,  548,  535,  549,  550,  551,
+      552,  553,  554,  555,  556,  557,  558,  559,  560,  561,
+      563,  543,  564,  562,  565,  566,  568,  569,  571,  572,
+      573,  570,  574,  575,  576,  577,  578,  579,  580,  581,
+      567,  582,  583,  584,  585,  586,  587,  588,  589,  590,
+      591,  592,  593,  594,  595,  596,  597,  598,  599,  600,
+      601,  602,  603,  604,  605,  606,  607,  608,  609,  610,
+      612,  613,  614,  615,  616,  617,  618,  611,  619,  620,
+      621,  622,  623,  624,  625,  626,  632,  627,  628,  633,
+
+      634,  629,  635,  636,  637,  645,  638,  639,  630,  640,
+      646,  631,  641,  647,  648,  649,  650,  642,  651,  652,
+      653,  654,  655,  643,  644,  656,  657,  658,  659,  660,
+      661,  662,  663,  664,  665,  666,  667,  668,  669,  670,
+      671,  672,  673,  674,  675,  676,  677,  678,  679,  680,
+      681,  682,  683,  684,  685,  686,  687,  688,  689,  691,
+      692,  693,  694,  695,  696,  697,  690,  698,  699,  700,
+      701,  702,  703,  704,  705,  706,  707,  708,  709,  710,
+      711,  712,  713,  714,  715,  716,  717,  718,  719,  720,
+      721,  722,  723,  724,  725,  726,  727,  728,  729,  730,
+
+      731,  732,  733,  734,  735,  736,  742,  737,  743,  744,
+      745,  738,  746,  739,  747,  748,  749,  750,  740,  751,
+      753,  754,  752,  741,  756,  757,  760,  761,  762,  758,
+      763,  764,  765,  755,  770,  766,  771,  772,  773,  759,
+      767,  774,  768,  775,  776,  777,  778,  779,  780,  781,
+      782,  783,  784,  785,  786,  787,  788,  789,  790,  791,
+      769,  792,  793,  794,  795,  796,  797,  798,  799,  800,
+      801,  802,  803,  804,  805,  806,  807,  808,  809,  813,
+      811,  814,  810,  812,  815,  816,  817,  818,  819,  820,
+      821,  822,  823,  824,  825,  826,  827,  828,  829,  830,
+
+      831,  832,  833,  834,  835,  836,  837,  838,  839,  840,
+      841,  842,  843,  844,  845,  846,  847,  848,  849,  850,
+      851,  852,  853,  854,  855,  856,  857,  858,  859,  860,
+      861,  862,  863,  864,  865,  866,  867,  868,  869,  870,
+      871,  872,  873,  874,  875,  876,  877,  878,  879,  880,
+      881,  882,  883,  884,  885,  886,  887,  888,  889,  890,
+      891,  892,  893,  894,  895,  896,  897,  898,  899,  900,
+      901,  902,  903,  904,  905,  906,  907,  908,  909,  910,
+      911,  913,  914,  915,  916,  917,  912,  919,  920,  918,
+      921,  922,  923,  924,  925,  926,  927,  928,  929,  930,
+
+      931,  932,  933,  934,  935,  936,  937,  938,  942,  943,
+      944,  945,  939,  946,  940,  948,  941,  947,  949,  950,
+      951,  952,  953,  954,  955,  956,  957,  958,  959,  960,
+      961,  962,  963,  964,  965,  966,  967,  968,  969,  970,
+      971,  972,  973,  974,  975,  976,  977,  978,  979,  980,
+      981,  982,  983,  984,  985,  986,  987,  988,  989,  990,
+      992,  993,  994,  995,  996,  991,  997,  998,  999, 1000,
+     1001, 1002, 1003, 1004, 1005, 1006, 1008, 1009, 1010, 1007,
+     1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020,
+     1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030,
+
+     1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
+     1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050,
+     1051, 1052, 1053, 1054, 1056, 1057, 1058, 1055, 1059, 1060,
+     1061, 1062, 1063, 1064, 1065, 1067, 1068, 1069, 1066, 1070,
+     1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1081, 1082,
+     1083, 1079, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091,
+     1092, 1093, 1094, 1095, 1080, 1096, 1097, 1098, 1099, 1100,
+     1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110,
+     1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120,
+     1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130,
+
+     1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1140, 1141,
+     1142, 1139, 1143, 1146, 1147, 1144, 1148, 1149, 1150, 1151,
+     1152, 1153, 1154, 1155, 1156, 1157, 1158, 1145, 1159, 1160,
+     1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170,
+     1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180,
+     1181, 1183, 1184, 1182, 1185, 1186, 1187, 1188, 1189, 1190,
+     1191, 1192, 1194, 1195, 1193, 1196, 1197, 1198, 1199, 1200,
+     1201, 1202, 1203, 1204, 1205, 1206, 1207, 1209, 1211, 1212,
+     1210, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221,
+     1208, 1223, 1224, 1225, 1226, 1222, 1227, 1228, 1229, 1230,
+
+     1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240,
+     1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250,
+     1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260,
+     1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270,
+     1271, 1272, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281,
+     1282, 1283, 1284, 1285, 1273, 1286, 1287, 1288, 1289, 1290,
+     1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300,
+     1302, 1303, 1304, 1305, 1301, 1306, 1307, 1308, 1309, 1310,
+     1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320,
+     1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330,
+
+     1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340,
+     1341, 1342, 1343, 1344, 1346, 1348, 1349, 1345, 1350, 1347,
+     1351, 1352, 1353, 1354, 1356, 1357, 1358, 1355, 1359, 1360,
+     1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370,
+     1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380,
+     1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390,
+     1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400,
+     1401, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411,
+     1412, 1402, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420,
+     1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430,
+
+     1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440,
+     1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450,
+     1451, 1452, 1453, 1454, 1455, 1456, 1458, 1459, 1457, 1461,
+     1462, 1460, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470,
+     1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480,
+     1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490,
+     1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500,
+     1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510,
+     1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520,
+     1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530,
+
+     1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540,
+     1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550,
+     1551, 1552, 1553, 1554, 1557, 1558, 1559, 1560, 1561, 1562,
+     1563, 1564, 1565, 1566, 1555, 1567, 1568, 1569, 1556, 1570,
+     1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580,
+     1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590,
+     1591, 1593, 1594, 1595, 1596, 1597, 1598, 1600, 1592, 1599,
+     1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610,
+     1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620,
+     1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630,
+
+     1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640,
+     1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650,
+     1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1651,
+     1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670,
+     1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680,
+     1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690,
+     1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700,
+     1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710,
+     1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720,
+     1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730,
+
+     1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740,
+     1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750,
+     1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760,
+     1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770,
+     1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780,
+     1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790,
+     1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800,
+     1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810,
+     1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820,
+     1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830,
+
+     1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840,
+     1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850,
+     1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860,
+     1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870,
+     1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880,
+     1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890,
+     1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900,
+     1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910,
+     1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920,
+     1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930,
+
+     1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940,
+     1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950,
+     1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960,
+     1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970,
+     1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980,
+     1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990,
+     1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000,
+     2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010,
+     2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020,
+     2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030,
+
+     2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040,
+     2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050,
+     2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060,
+     2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070,
+     2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080,
+     2081, 2082, 2083, 2084,   13, 2085, 2085, 2085, 2085, 2085,
+     2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085,
+     2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085,
+     2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085,
+     2085, 2085, 2085, 2085
+
     } ;
 
-static yyconst flex_int16_t yy_chk[5072] =
+static yyconst flex_int16_t yy_chk[2895] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    3,    3,    3,    4,    4,
-        4,    5,    5,    6,    6,    5,   24,    6,    7,    7,
-        7,    7, 1736,    7,    8,    8,    8,    8,   24,    8,
-        9,    9,    9,   10,   10,   10,   15,   44,   44,   49,
-
-       15,    3,   49,   24,    4,   60,   60,    5,   19,    6,
-       19,   19,   69,   19,  644,    7,   69,   39,   19,   39,
-       39,    8,   39,   23,   20,   20,    9,   39,  638,   10,
-       11,   11,   11,   11,   11,   11,   12,   12,   12,   12,
-       12,   12,   20,   23,   27,   19,   23,   29,   20,   11,
-       23,   20,   20,  133,   21,   12,   27,   25,  638,   29,
-      131,   21,  125,  125,   28,   25,  130,   11,   21,   20,
-       23,   27,  127,   12,   29,  127,   11,  132,  132,  128,
-       21,   21,   12,   25,   25,   75,   28,   26,   21,   37,
-       26,   28,   25,   30,   37,   21,   22,   26,   32,   26,
-
-       22,   30,   37,   22,   32,   22,   22,   30,   75,   31,
-       26,   30,   75,   31,   26,  126,   37,   26,   22,   30,
-       30,   37,  209,   22,   26,   32,   26,   22,   30,   31,
-       22,  124,   22,   22,   30,   31,   31,   33,   30,   55,
-       31,   55,   55,   33,   55,   34,   33,   67,   36,   34,
-       36,  209,   61,   33,   56,   33,   31,   93,   66,   34,
-       66,   66,   34,   66,   33,   36,   51,  114,   35,  139,
-       33,   34,   34,   33,   36,   36,   34,   36,   35,   74,
-       33,   38,   35,   35,   65,   38,   34,   50,   93,   34,
-       35,   63,   36,   63,   63,   35,   63,   65,  114,  129,
-
-      139,  129,  129,   74,  129,   35,   74,   38,   38,   35,
-       35,   65,   38,   68,   76,   68,   68,   71,   68,   71,
-       71,   76,   71,   68,   77,   78,   79,   71,   63,   80,
-       82,   81,   84,   45,   78,   82,   40,   77,   83,   79,
-       81,   76,   85,   86,   80,   90,   83,   14,   77,   84,
-       86,   77,   78,   79,   71,   85,   80,   82,   81,   87,
-       89,   91,   88,   84,   77,   83,   98,   90,   87,   85,
-       86,   88,   90,   94,   91,   92,   84,   13,   92,   98,
-       99,   94,   97,   89,   95,   97,   87,   89,   91,   88,
-       96,    0,   92,   98,   96,  100,  101,  105,  102,   92,
-
-       94,  104,   92,   99,   95,   92,   95,   99,  104,   97,
-      101,   95,  103,    0,   96,  100,    0,   96,  102,   92,
-      105,   96,  100,  101,  105,  102,  103,  106,  104,  107,
-      108,   95,  110,  107,  109,  111,  106,  108,  115,  103,
-      112,  109,  147,  113,  119,    0,  110,  111,  112,  116,
-      119,  107,  113,  115,  106,  117,  107,  108,  120,  110,
-      107,  109,  111,  118,  117,  115,  121,  112,  123,  116,
-      113,  119,  122,  147,  118,  116,  116,  123,  137,  120,
-        0,    0,  117,  120,    0,  120,  138,  122,  121,  134,
-      118,  134,  134,  121,  134,  123,  116,  140,  135,  122,
-
-      135,  135,  137,  135,  141,  137,  120,  142,  138,  140,
-      143,  144,  145,  138,  146,  142,    0,  145,  144,  148,
-        0,  151,  143,  141,  140,  150,  153,  152,    0,  151,
-      153,  141,  154,  156,  142,  135,  146,  143,  144,  155,
-      148,  146,  160,  145,  145,  157,  156,  148,  151,  152,
-        0,  150,  150,  153,  152,  154,  161,  157,    0,  154,
-      156,  155,  158,  164,  160,  158,  155,  148,  149,  160,
-      159,    0,  157,  149,  162,  161,  163,  158,  149,  159,
-      165,  162,  161,  161,  149,  149,  166,  163,  167,  158,
-      170,  149,  158,  169,  164,  149,  166,  159,  168,  169,
-
-      149,  162,  161,  163,  171,  149,  165,  165,  172,  173,
-      174,  149,  149,    0,  175,  176,  168,  166,    0,  167,
-      169,  170,  176,  166,  177,  168,  171,  178,  179,    0,
-      174,  171,  178,  186,  180,  175,  181,  174,  183,  172,
-      173,  175,  176,  182,  184,  177,  187,  179,  181,  184,
-      182,  177,  188,  187,  178,  179,  180,  185,  185,  190,
-      183,  180,  189,  181,  186,  183,  185,  191,  192,  194,
-      182,  184,  193,  187,  195,  191,  196,  188,  200,  188,
-      198,  197,  189,  192,  185,  185,  202,  199,  198,  189,
-      190,  194,    0,  196,  191,  192,  197,  201,  193,  193,
-
-      194,  196,  204,  196,  203,  195,  199,  198,  197,  200,
-      206,  204,  206,  205,  199,  207,  203,  202,  194,  201,
-      196,  208,    0,  210,  201,  211,    0,  212,  216,  204,
-      215,  203,  205,  213,  214,  217,  219,  206,  212,  207,
-      205,  221,  207,  218,    0,  213,  216,  208,  208,  210,
-      210,  211,  211,  215,  212,  216,  218,  215,  214,  220,
-      213,  214,  219,  219,  222,  223,  217,  224,  225,  227,
-      218,  222,  221,  224,  223,  226,  228,  231,  227,  229,
-      232,  220,  225,  230,    0,  233,  220,  234,  229,  240,
-      234,  222,  223,  235,  224,  225,  227,  234,  230,  228,
-
-      233,  226,  226,  228,  232,  237,  229,  232,  231,  236,
-      230,  235,  233,  238,  234,  236,  240,  234,  241,  237,
-      235,  239,  239,  242,  245,  243,  242,  248,  238,  244,
-        0,    0,  237,  242,  247,  246,  236,  243,  251,  248,
-      238,  253,  241,  249,    0,  241,  239,  244,  239,  239,
-      242,  245,  243,  242,  248,    0,  244,  246,  249,  250,
-      247,  247,  246,  253,  252,  254,  250,  254,  253,  251,
-      249,  252,  255,  256,  259,  257,  256,  258,  256,    0,
-      261,    0,  260,  262,  256,  255,  250,  261,  260,  254,
-      264,  252,  254,  257,  254,  262,  259,  268,  263,  255,
-
-      256,  259,  257,  256,  267,  256,  264,  261,  258,  260,
-      262,  263,  269,  265,  264,  268,  267,  264,  269,  270,
-      271,  272,    0,  276,  268,  263,  265,  270,  272,  273,
-      274,  267,  271,  264,  274,  276,  275,  277,  279,  269,
-      265,  266,  266,  275,  278,  279,  270,  271,  272,  277,
-      276,  266,  281,  266,  266,  266,    0,  274,  266,  280,
-      273,    0,  282,  275,  277,  279,  266,  285,  266,  266,
-      283,  289,  280,  282,  285,  278,  284,  284,  266,  286,
-      266,  266,  266,  281,  287,  266,  280,  288,  292,  282,
-      286,  293,  283,  290,  285,  287,  289,  283,  289,  291,
-
-      288,  292,  295,  294,  293,  284,  286,  297,  291,  293,
-      296,  287,  298,  300,  288,  292,  290,  299,  293,  301,
-      290,  294,  305,    0,  295,  297,  291,  302,  303,  295,
-      294,  293,  304,  296,  297,  306,  300,  296,  299,  307,
-      300,  306,  303,  298,  299,  301,  301,  309,  308,  302,
-      310,  311,    0,  305,  302,  303,  313,  307,  304,  304,
-      315,  312,  306,  308,    0,  316,  307,  312,  323,  319,
-      309,  316,  317,  311,  309,  308,  310,  310,  311,  318,
-      324,  323,  313,  313,  319,  326,  315,  315,  312,  325,
-      331,  317,  316,  321,  322,  323,  319,  318,  324,  317,
-
-      321,  322,  327,  329,  326,  328,  318,  324,  329,  330,
-      332,  325,  326,  331,  328,  330,  325,  331,  333,  335,
-      321,  322,  332,  334,    0,    0,  342,  335,  337,    0,
-      329,    0,  328,  327,  334,  337,  330,  332,  338,  339,
-      333,    0,    0,    0,  340,  333,  335,  341,  339,  338,
-      334,  336,  342,  342,  341,  337,  336,  343,  336,  343,
-      344,  345,  349,    0,  346,  338,  336,  349,  340,  347,
-      339,  340,  348,  345,  341,  339,  336,  336,  336,  346,
-      348,  347,  350,  336,  343,  336,  344,  344,  345,  349,
-      351,  346,  352,  336,  353,  354,  347,  355,  356,  348,
-
-      352,    0,  357,  336,  350,  360,  353,  359,  351,  350,
-      358,  357,  361,  356,  363,  362,  365,  351,  354,  352,
-      371,  353,  354,  364,  358,  356,  359,  361,  355,  357,
-      362,  369,  360,  366,  359,  364,  366,  358,  363,  361,
-      365,  363,  362,  365,  366,  367,  370,  368,  372,  367,
-      364,  371,  373,  374,  378,  376,  375,    0,  369,  380,
-      366,  368,  375,  366,  377,  379,  382,  383,    0,  389,
-        0,  381,    0,  370,  368,  372,  367,  376,  381,  373,
-      384,  380,  376,  375,  374,  378,  380,  377,  379,  383,
-      385,  377,  379,  384,  383,  385,  387,  382,  381,  385,
-
-      389,  386,  388,  390,    0,  387,    0,  384,  391,  393,
-      394,  392,  398,    0,  385,  388,    0,  385,  395,    0,
-      400,  390,  385,  387,  394,  399,  385,  386,  386,  388,
-      390,  393,  391,  392,  392,  391,  393,  394,  392,  396,
-      395,  397,  402,  398,  400,  395,  399,  400,  401,  403,
-      396,  405,  399,  406,  404,  408,  397,  407,  403,  408,
-      392,  410,    0,    0,  402,    0,  396,  404,  397,  402,
-      411,  409,  401,  405,  414,  401,  403,  406,  405,  407,
-      406,  404,  415,  416,  407,  409,  408,  412,  411,  413,
-      415,  417,  410,  413,  418,  422,  419,  411,  409,  414,
-
-      417,  414,  412,  418,  419,  420,  426,  421,  416,  415,
-      416,  412,  420,  422,  412,  423,  424,  429,  417,  425,
-      413,  418,  422,  419,  428,  424,  431,  423,  427,  412,
-      421,  425,  420,  430,  421,  436,  427,  426,  435,  433,
-      429,  432,  423,  424,  429,  434,  425,  433,  431,  430,
-      428,  428,  432,  431,  437,  427,  438,  436,  435,  434,
-      430,  440,  436,  439,  441,  435,  433,  443,  432,  442,
-      440,  444,  434,  445,  437,  451,  446,  449,  438,    0,
-      443,  437,    0,  438,  441,  439,  447,  442,  440,  452,
-      439,  441,  447,  444,  443,  449,  442,  445,  444,  446,
-
-      445,  448,  453,  446,  449,  454,  451,  455,  468,  448,
-      456,  460,  452,  447,  454,  463,  452,  453,  457,  456,
-      457,  466,  467,  460,  469,  463,  455,  448,  448,  453,
-      471,  468,  454,    0,  455,  468,  448,  456,  460,  466,
-      474,  491,  463,  467,  475,  457,  458,  472,  466,  467,
-      458,  492,  471,  458,  478,  469,  472,  471,  476,  473,
-      458,  473,  477,  458,  474,    0,  478,  474,  458,  479,
-        0,  475,  491,  458,  472,    0,  480,  458,  476,  481,
-      458,  478,  492,    0,    0,  476,  473,  458,  477,  477,
-      458,  470,  470,  489,  470,  479,  479,  470,  483,  482,
-
-      480,  481,  470,  480,  484,  483,  481,  482,  470,  470,
-      487,  485,  484,  486,  488,  489,  490,  470,  470,  470,
-      489,  470,  487,  488,  470,  483,  482,  493,  494,  470,
-      485,  484,  500,  495,  496,  470,  470,  487,  485,  486,
-      486,  488,  498,  490,  501,  499,  502,  497,    0,  494,
-        0,  493,  495,  496,  493,  494,  497,  505,  503,  500,
-      495,  496,  506,  501,  498,  499,  503,  507,    0,  498,
-      508,  501,  499,  512,  497,  505,  509,  502,    0,  512,
-      507,  514,  510,  513,  505,  503,  506,  514,  509,  506,
-      510,  515,  519,  518,  507,  517,  508,  508,  515,  516,
-
-      512,  523,  517,  509,  516,  513,  510,  520,  514,  510,
-      513,  518,  522,  521,  523,  519,  520,  510,  515,  519,
-      518,  521,  517,  524,  525,  526,  516,  527,  523,  528,
-      522,  525,  529,    0,  520,  530,  535,    0,  526,  522,
-      521,  531,  532,  530,  524,  534,  536,  533,  537,  538,
-      524,  525,  526,  533,  539,  529,  531,  537,  527,  529,
-      528,  541,  530,  538,  532,  542,  543,  535,  531,  532,
-      536,  534,  534,  536,  533,  537,  538,  540,  543,  544,
-      546,  545,  547,  546,  540,  539,  551,  548,  541,  545,
-        0,  553,  542,  543,  548,  547,    0,  550,  551,  552,
-
-      554,  552,  544,  553,  540,    0,  544,  546,  545,  547,
-        0,  557,    0,  551,  548,  549,  555,  549,  553,  556,
-      550,  549,  554,  549,  550,  558,  552,  554,  549,  555,
-      565,  559,  556,  549,  557,  560,  561,  558,  557,  549,
-        0,  559,  549,  555,  549,  562,  556,  568,  549,  561,
-      549,  562,  558,  559,  563,  549,  564,  560,  559,  566,
-      549,  565,  560,  561,  566,  567,  566,  563,  559,  568,
-      571,  573,  562,  572,  568,  569,  574,  564,  576,  570,
-      567,  563,  579,  564,  566,  566,  566,  577,  569,  574,
-      573,  566,  567,  566,  570,  572,  571,  571,  573,  575,
-
-      572,  580,  569,  574,  581,  576,  570,  575,  582,  584,
-      577,  566,  581,  579,  577,  583,  585,  584,  588,  590,
-      586,  587,  582,  589,  592,  580,  575,  585,  580,  587,
-      589,  581,  590,  591,  597,  582,  584,  583,  586,  600,
-      588,  594,  583,  585,  595,  588,  590,  586,  587,  594,
-      589,  591,  596,  595,  598,  592,  597,  600,  599,  602,
-      591,  597,  601,  604,  596,  608,  600,  604,  594,  605,
-        0,  595,  605,  606,  610,  607,  598,  608,    0,  596,
-      599,  598,  607,  612,  609,  599,  613,  611,  601,  601,
-      602,  609,  608,  611,  604,  605,  605,  606,  610,  605,
-
-      606,  610,  607,  614,  615,  612,  616,  617,  613,  619,
-      612,  609,  621,  613,  611,  615,  620,  618,  619,  623,
-      622,  621,    0,  624,  614,  628,  623,  616,  622,  625,
-      614,  615,  626,  616,  617,  618,  619,  624,  630,  621,
-      620,  631,  629,  620,  618,  632,  623,  622,  627,  628,
-      624,  625,  628,  630,  626,  633,  625,  627,  629,  626,
-      634,  636,  635,  637,  639,  630,  640,  633,  646,  629,
-      635,  641,  631,  639,  636,  627,  632,    0,  637,  641,
-      646,  642,  633,  642,  640,  647,  645,  634,  636,  635,
-      637,  639,  647,  640,  648,  646,  649,  650,  641,  645,
-
-        0,  651,  652,  653,  654,  655,  656,  659,  642,  657,
-      658,  660,  647,  645,  656,  652,  653,  655,  658,  650,
-      660,  657,  661,  651,  650,  648,  654,  649,  651,  652,
-      653,  654,  655,  656,  659,  662,  657,  658,  660,  663,
-      665,  664,  662,  661,  666,  667,  668,    0,    0,  661,
-      671,  673,  669,  670,  672,  668,  675,  666,  671,  673,
-      665,  674,  662,  664,    0,  663,  663,  665,  664,  667,
-      669,  666,  667,  668,  675,  670,  672,  671,  673,  669,
-      670,  672,  676,  675,  674,  677,  678,  679,  674,  681,
-      680,  682,  684,  688,  676,  681,  685,  677,  680,  683,
-
-      682,    0,  679,  685,  684,  692,  678,  686,  689,  676,
-      690,    0,  677,  678,  679,  691,  681,  680,  682,  684,
-      683,  689,  691,  685,  688,  686,  683,  692,  695,  690,
-      694,  696,  692,  697,  686,  689,  693,  690,  694,  698,
-      693,  700,  691,    0,  701,  696,  699,    0,  702,  705,
-      707,  697,  706,  708,  695,  695,  704,  694,  696,  703,
-      697,  706,  705,  700,    0,  709,  701,  693,  700,  712,
-      698,  701,  699,  699,  702,  702,  705,  703,  704,  706,
-      710,  707,  714,  704,  708,  712,  703,  709,  711,  715,
-      716,  718,  709,  711,  717,  711,  712,  711,  717,  716,
-
-      719,  715,  720,  710,  718,  714,  711,  710,  719,  714,
-      721,  723,  724,  723,  725,  711,  715,  716,  718,  722,
-      711,  720,  711,  721,  711,  717,  725,  719,  722,  720,
-      726,  728,  729,  731,  730,  733,  732,  721,  723,  724,
-      735,  725,  730,  732,  734,  736,  722,  737,  739,  738,
-      745,  740,  736,  743,  729,  728,  741,  726,  728,  729,
-      731,  730,  733,  732,  742,  741,  734,  735,  738,  737,
-      739,  734,  736,  743,  737,  739,  738,  740,  740,  746,
-      743,  745,  747,  741,  748,  742,  750,  749,    0,  752,
-      751,  742,  753,  754,  750,  755,  757,  754,    0,  753,
-
-        0,  760,  759,  757,  747,  749,  751,  758,    0,  747,
-      746,  759,  756,  750,  749,  748,  752,  751,  756,  753,
-      754,  764,  758,  757,  761,  756,  755,  760,  760,  759,
-      762,  761,  762,  763,  758,  769,  765,  766,  774,  756,
-      765,  772,  763,  764,  771,  756,  768,  770,  764,  773,
-      768,  761,    0,  769,  772,    0,  775,  762,    0,  766,
-      763,  774,  769,  765,  766,  774,  770,  776,  772,  771,
-      779,  771,  775,  778,  770,  776,  780,  768,  777,  777,
-      773,  781,  778,  775,  782,  780,  783,  786,  781,  785,
-      784,    0,  779,  788,  776,  783,    0,  779,  784,  786,
-
-      778,  788,  785,  780,  789,  777,  787,  782,  781,  790,
-      791,  782,  792,  783,  786,  794,  785,  784,  787,  796,
-      788,  792,  793,  795,  798,  796,  789,  794,  799,  790,
-      797,  789,  791,  787,  800,  802,  790,  791,  803,  792,
-      793,  804,  794,  805,  795,  806,  796,  803,  808,  793,
-      795,  814,  797,  806,  807,  798,  805,  797,  807,  799,
-      800,  800,  802,  804,    0,  803,  809,  813,  804,  810,
-      805,    0,  806,  812,  809,  808,  815,  810,  811,  811,
-      822,  812,  814,  816,  815,  807,  819,  817,  813,  818,
-      821,  816,  820,  809,  813,  817,  810,  818,  820,  819,
-
-      812,  823,  821,  815,  824,  811,  822,  822,  825,  830,
-      816,  826,  831,  819,  817,  834,  818,  821,    0,  820,
-      827,  832,  825,  823,  827,  829,  833,  824,  823,  826,
-      839,  824,  829,  833,  831,  825,  830,  827,  826,  831,
-      836,  838,  840,  842,  832,  827,  834,  827,  832,  836,
-      844,  827,  829,  833,  846,  853,  839,  839,  847,  848,
-      849,  850,  849,  838,  827,    0,    0,  836,  838,  851,
-      842,  848,  854,  840,  850,  855,  860,  844,  846,  854,
-      852,  846,  853,  872,  847,  847,  848,  849,  850,  856,
-      857,  851,  852,  864,  856,  858,  851,  859,  860,  854,
-
-      862,  855,  855,  860,  865,  859,  857,  852,  863,  862,
-      868,  874,  871,  870,  872,    0,  856,  857,  858,  864,
-      864,  863,  858,  866,  859,  867,  865,  862,  868,  869,
-      866,  865,  867,  875,  871,  863,  869,  868,  870,  871,
-      870,  873,  874,  876,  877,  885,  875,  880,  873,  881,
-      866,  879,  867,  884,  879,  882,  869,    0,  887,  886,
-      875,  888,  882,  888,  881,  877,  883,  885,  873,  883,
-      876,  877,  885,  880,  880,  889,  881,  886,  879,  890,
-      887,  883,  882,    0,  884,  887,  886,  891,  888,  892,
-      883,  899,  893,  883,  894,  895,  883,  896,  892,  889,
-
-      893,  894,  889,  897,  898,  900,  901,  897,  883,  907,
-      890,  904,    0,  891,  891,  901,  892,  895,  899,  893,
-      905,  894,  895,  906,  904,    0,  898,  900,  896,  902,
-      897,  898,  900,  901,  903,  905,  902,  906,  904,  908,
-      907,  903,  909,  912,  914,  910,  908,  905,  913,  909,
-      906,  910,  916,  919,  920,  915,  902,  927,  915,  923,
-      913,  903,  921,  916,  914,  912,  908,  928,    0,  909,
-      912,  914,  910,  915,  926,  913,  922,  923,  920,  916,
-      919,  920,  915,  924,  921,  915,  923,  922,  927,  921,
-      925,  924,  926,  925,  928,  929,  931,  930,  933,  932,
-
-      933,  926,  929,  922,  934,  931,  935,  936,  925,  942,
-      924,  930,  932,  934,  937,    0,  938,  925,  936,  940,
-      925,  944,  929,  931,  930,  933,  932,  947,  940,  945,
-      938,  934,  935,  935,  936,  939,  937,  946,  939,  943,
-      942,  937,  938,  938,  946,  948,  940,  953,  943,  949,
-      945,  952,  944,  939,  954,  949,  945,  938,  947,  948,
-      955,  953,  939,  954,  946,  939,  943,  956,  955,  957,
-      952,    0,  948,  949,  953,  958,  949,  961,  952,  960,
-      957,  954,  949,  962,  958,  963,  960,  955,  966,  964,
-      965,  967,  966,  968,  971,    0,  957,    0,  956,  970,
-
-      961,  969,  958,  967,  961,  962,  960,  963,  965,  971,
-      962,  964,  963,  974,  969,  966,  964,  965,  967,  970,
-      968,  971,  972,  973,  975,  976,  970,  977,  969,  978,
-        0,  973,  980,  979,  976,  982,  983,  972,    0,  975,
-      984,    0,  985,  986,  974,  994,    0,  993,  977,  972,
-      973,  975,  976,  982,  977,  984,  978,  979,  987,  980,
-      979,  986,  982,  983,  985,  988,  989,  984,  990,  985,
-      986,  991,  992,  987,  993,  997,  994,  988,  991,  996,
-      998,  990,  997,  995,  992,  987,  990,  996,  989,  995,
-      999, 1000,  988,  989, 1001,  990, 1002,  999,  991,  992,
-
-     1003, 1004,  997, 1006, 1008, 1007,  996,  998,  990, 1009,
-      995, 1009, 1010, 1012, 1007, 1011, 1019,  999, 1000, 1002,
-        0, 1001, 1014, 1002,    0, 1004, 1015, 1017, 1004, 1014,
-     1016, 1003, 1007, 1015, 1006, 1008, 1009, 1016, 1021, 1010,
-     1017, 1011, 1011, 1019, 1012, 1013, 1013, 1013, 1022, 1014,
-     1018, 1024, 1013, 1015, 1017, 1022, 1018, 1016, 1020, 1020,
-     1013, 1025, 1027, 1028, 1021, 1021, 1029, 1029, 1026, 1024,
-     1030, 1035, 1013, 1013, 1013, 1022, 1032, 1018, 1024, 1013,
-     1026, 1028, 1027, 1031, 1031, 1020, 1034, 1032, 1025, 1027,
-     1028, 1036, 1037, 1029, 1038, 1026, 1030, 1030, 1036, 1040,
-
-     1039, 1042, 1035, 1032, 1041, 1043, 1044,    0, 1034, 1046,
-     1031, 1041, 1037, 1034,    0, 1044, 1042, 1040, 1036, 1037,
-     1050, 1038, 1039, 1045, 1045, 1047, 1040, 1039, 1042, 1043,
-     1048, 1041, 1043, 1044, 1049, 1046, 1046, 1047, 1048, 1052,
-     1051, 1050, 1054, 1053, 1058, 1055, 1049, 1050, 1053, 1056,
-     1045, 1055, 1047, 1057, 1060, 1063, 1059, 1048, 1051, 1053,
-     1059, 1049, 1056, 1061, 1061, 1062, 1052, 1051, 1064, 1054,
-     1053, 1058, 1055, 1065, 1066, 1053, 1056, 1067, 1068, 1067,
-     1062, 1070, 1095, 1064, 1057, 1060, 1063, 1059, 1069, 1066,
-     1061, 1071, 1062, 1069,    0, 1064, 1065, 1073,    0, 1074,
-
-     1065, 1066, 1075, 1076, 1067, 1079, 1071, 1077, 1085, 1068,
-     1078,    0, 1070, 1095, 1077, 1069,    0, 1080, 1071, 1083,
-     1088, 1073, 1081, 1085, 1073, 1074, 1074, 1079, 1087, 1075,
-     1076, 1078, 1079, 1090, 1077, 1085, 1093, 1078, 1080, 1091,
-     1081, 1083, 1092, 1087, 1080, 1089, 1083, 1088, 1091, 1081,
-     1092, 1090, 1089, 1094, 1096, 1087, 1108, 1098, 1100, 1093,
-     1090, 1099, 1103, 1093, 1101, 1106, 1091, 1096, 1098, 1092,
-     1099, 1110, 1089, 1107, 1111, 1094, 1100, 1106, 1112,    0,
-     1094, 1096, 1101, 1098, 1098, 1100, 1107, 1108, 1099, 1103,
-     1114, 1101, 1106, 1109, 1117, 1098, 1116, 1110, 1110, 1111,
-
-     1107, 1111, 1115, 1109, 1119, 1112, 1122, 1118,    0, 1115,
-     1114, 1120, 1117, 1118, 1126, 1121, 1132, 1114, 1122, 1119,
-     1109, 1117, 1116, 1116, 1127, 1123, 1120, 1129, 1124, 1115,
-     1121, 1119, 1123, 1122, 1118, 1124, 1126, 1128, 1120, 1134,
-     1131, 1126, 1121, 1132, 1135, 1129, 1128, 1133, 1133, 1127,
-     1136, 1127, 1123, 1131, 1129, 1124, 1137, 1140, 1139, 1138,
-     1141, 1134, 1143, 1144, 1128, 1139, 1134, 1131, 1138, 1135,
-     1143, 1135, 1136, 1145, 1133, 1149, 1144, 1136, 1137, 1146,
-     1148, 1151, 1141, 1137,    0, 1139, 1138, 1141, 1140, 1143,
-     1144, 1146, 1147, 1150, 1154, 1152, 1151, 1149, 1152, 1147,
-
-     1145, 1153, 1149, 1160, 1162, 1157, 1146, 1158, 1151, 1155,
-        0, 1148, 1154, 1152, 1164, 1162, 1161, 1160, 1150, 1147,
-     1150, 1154, 1152, 1161, 1155, 1152, 1153, 1157, 1153, 1158,
-     1160, 1162, 1157, 1166, 1158, 1164, 1155, 1167, 1168, 1169,
-     1168, 1164, 1170, 1161, 1171, 1172,    0, 1173, 1175, 1167,
-     1174, 1177, 1179, 1176, 1166, 1173, 1182, 1169, 1183, 1179,
-     1166, 1184, 1171, 1178, 1167, 1168, 1169, 1176, 1185, 1170,
-     1175, 1171, 1172, 1174, 1173, 1175, 1183, 1174, 1177, 1179,
-     1176, 1186, 1178, 1182, 1187, 1183, 1189, 1188, 1184, 1191,
-     1178, 1191,    0, 1187, 1185, 1185, 1186, 1192, 1193, 1195,
-
-     1194, 1196, 1193, 1198, 1197, 1200, 1199,    0, 1186, 1188,
-     1196, 1187, 1194, 1189, 1188, 1197, 1191, 1200, 1201, 1192,
-     1212, 1195, 1202, 1202, 1192, 1193, 1195, 1194, 1196, 1199,
-     1198, 1197, 1200, 1199, 1203, 1205, 1207, 1208, 1206, 1205,
-     1201, 1206, 1203, 1208, 1207, 1201, 1210, 1212, 1213, 1202,
-     1217, 1209, 1210, 1214, 1218, 1215, 1216, 1219, 1221, 1222,
-     1220, 1203, 1205, 1207, 1208, 1206, 1209, 1214, 1215, 1223,
-     1216, 1224, 1213, 1210, 1220, 1213, 1217, 1217, 1209, 1224,
-     1214, 1218, 1215, 1216, 1219, 1221, 1222, 1220, 1225, 1226,
-     1229, 1227, 1230, 1231, 1232, 1233, 1223,    0, 1224, 1227,
-
-     1235, 1231, 1234, 1237, 1233, 1238, 1239, 1241, 1243,    0,
-     1236, 1241, 1229, 1238, 1242, 1225, 1226, 1229, 1227, 1230,
-     1231, 1232, 1233, 1234, 1235, 1236, 1242, 1235, 1244, 1234,
-     1237, 1243, 1238, 1239, 1241, 1243, 1236, 1236, 1245, 1246,
-     1249, 1242, 1247, 1247, 1248, 1250, 1245, 1252, 1253, 1252,
-     1254, 1251, 1236, 1260, 1255, 1244, 1254,    0, 1249,    0,
-     1250, 1257, 1253, 1261, 1258, 1245, 1246, 1249, 1256, 1247,
-     1248, 1248, 1250, 1251, 1252, 1253, 1255, 1254, 1251, 1257,
-     1256, 1255, 1258, 1259, 1260, 1263, 1261, 1265, 1257, 1266,
-     1261, 1258, 1263, 1267, 1268, 1256, 1259,    0, 1273, 1270,
-
-     1271,    0, 1268,    0, 1275, 1265, 1278, 1280, 1276, 1281,
-     1259, 1270, 1263, 1273, 1265, 1266, 1266, 1282, 1271, 1290,
-     1268, 1268, 1281, 1283, 1267, 1273, 1270, 1271, 1275, 1268,
-     1276, 1275, 1277, 1278, 1280, 1276, 1281, 1285, 1283, 1277,
-     1284,    0, 1286, 1282, 1282, 1285, 1290, 1288, 1289, 1291,
-     1283, 1292, 1293, 1284, 1294, 1295, 1297,    0, 1292, 1277,
-        0, 1296, 1295, 1298, 1285, 1293, 1302, 1284, 1286, 1286,
-     1288, 1291, 1289, 1301, 1288, 1289, 1291, 1294, 1292, 1293,
-     1300, 1294, 1295, 1296, 1298, 1303, 1304, 1297, 1296, 1307,
-     1298, 1300, 1311, 1315, 1317, 1301, 1314, 1302, 1319, 1320,
-
-     1301, 1322, 1327, 1321, 1303, 1323, 1322, 1300, 1325,    0,
-     1331, 1304, 1303, 1304, 1321, 1307, 1307, 1333, 1314, 1311,
-     1315, 1317, 1328, 1314, 1329, 1320, 1320, 1323, 1322, 1319,
-     1321, 1328, 1323, 1327, 1334, 1325, 1329, 1331, 1336, 1333,
-     1335, 1337, 1338, 1339, 1333, 1341,    0, 1340, 1342, 1328,
-        0, 1329, 1347, 1335, 1341, 1345, 1343, 1346, 1344, 1334,
-     1336, 1334, 1340, 1342, 1346, 1336,    0, 1335, 1337, 1338,
-     1339, 1343, 1341, 1344, 1340, 1342, 1348, 1345, 1351, 1347,
-     1349, 1349, 1345, 1343, 1346, 1344, 1350, 1352, 1353, 1354,
-     1352, 1355, 1351, 1350, 1348, 1356, 1355, 1357, 1354, 1358,
-
-     1359, 1353, 1362, 1348, 1371, 1351,    0, 1349,    0, 1362,
-     1369, 1363, 1366, 1350, 1352, 1353, 1354, 1356, 1355, 1357,
-     1363, 1373, 1356, 1364, 1357, 1365, 1358, 1359, 1364, 1362,
-     1366, 1371, 1365, 1367, 1368, 1372, 1369, 1369, 1363, 1366,
-     1367, 1373, 1374, 1368, 1379, 1380, 1375, 1376, 1373,    0,
-     1364, 1378, 1365, 1372, 1374, 1375, 1376, 1377, 1381, 1378,
-     1367, 1368, 1372, 1382, 1383, 1390, 1391, 1381, 1377, 1374,
-     1384, 1379, 1383, 1375, 1376, 1382, 1380, 1384, 1378, 1386,
-     1395, 1389, 1392, 1396, 1377, 1381, 1393, 1386, 1389, 1390,
-     1382, 1383, 1390, 1391, 1392, 1393, 1399, 1384, 1397, 1401,
-
-     1402,    0, 1406, 1395, 1408,    0, 1386, 1395, 1389, 1392,
-     1396, 1400, 1397, 1393, 1409, 1407, 1411, 1410, 1412, 1400,
-     1407, 1414, 1408, 1399, 1411, 1397, 1401, 1402, 1406, 1406,
-     1415, 1408, 1416, 1414, 1417, 1418, 1409, 1412, 1400, 1410,
-     1419, 1409, 1407, 1411, 1410, 1412, 1417, 1420, 1414, 1421,
-     1422, 1426, 1415, 1423, 1416,    0, 1427, 1415,    0, 1416,
-     1430, 1417, 1418, 1428, 1432,    0, 1429, 1419, 1435, 1431,
-        0, 1421, 1430,    0, 1433,    0, 1421, 1422, 1420, 1427,
-     1423, 1438, 1426, 1427, 1429, 1428, 1432, 1430, 1431, 1433,
-     1428, 1432, 1435, 1429, 1436, 1435, 1431, 1437, 1439, 1438,
-
-     1440, 1433, 1441, 1436, 1443, 1446, 1444, 1445, 1438, 1448,
-     1447, 1437, 1443, 1444,    0, 1445, 1439, 1450, 1454, 1449,
-     1441, 1436, 1452, 1458, 1437, 1439, 1440, 1440, 1447, 1441,
-     1454, 1443, 1446, 1444, 1445, 1456, 1448, 1447, 1449, 1450,
-     1452, 1453, 1469, 1462, 1450, 1454, 1449, 1461, 1463, 1452,
-     1458, 1464, 1465, 1466, 1461, 1453, 1467, 1470, 1468, 1471,
-     1474, 1456, 1456, 1475,    0, 1467, 1483,    0, 1453, 1462,
-     1462, 1468, 1463, 1469, 1461, 1463,    0, 1479, 1464, 1465,
-     1466, 1474, 1471, 1467, 1470, 1468, 1471, 1474, 1478, 1478,
-     1481, 1480, 1482, 1483, 1475, 1484, 1489, 1481, 1478, 1479,
-
-     1480, 1485, 1486, 1484, 1479, 1482, 1487, 1489, 1488, 1490,
-     1486, 1492, 1492, 1500, 1491, 1478, 1478, 1481, 1480, 1482,
-     1485, 1491, 1484, 1489, 1493, 1497,    0, 1501, 1485, 1486,
-     1494, 1490, 1487, 1487, 1488, 1488, 1490, 1494, 1492, 1495,
-     1500, 1491, 1493, 1502, 1499, 1503, 1495, 1504, 1507, 1497,
-     1501, 1493, 1497, 1499, 1501, 1506, 1508, 1494, 1508, 1503,
-     1513, 1502, 1512, 1507,    0, 1504, 1495, 1514, 1516, 1522,
-     1502, 1499, 1503, 1506, 1504, 1507, 1520, 1523, 1517, 1523,
-     1524, 1518, 1506, 1508, 1512, 1514, 1513, 1513, 1518, 1512,
-     1516, 1519, 1521, 1528, 1514, 1516, 1517, 1519, 1520, 1527,
-
-     1522, 1521, 1526, 1520, 1523, 1517, 1530, 1524, 1518, 1529,
-     1526, 1527, 1531, 1532, 1536, 1533, 1534, 1537, 1519, 1521,
-     1528, 1532, 1538, 1531, 1530, 1537, 1527, 1535, 1535, 1526,
-     1539, 1541, 1529, 1530, 1533, 1543, 1529, 1544, 1534, 1531,
-     1532, 1536, 1533, 1534, 1537, 1546, 1542, 1547,    0, 1538,
-     1544, 1545, 1539, 1542, 1535, 1548, 1545, 1539, 1541, 1550,
-     1549, 1543, 1543, 1548, 1544, 1551, 1550, 1554, 1552, 1553,
-     1556, 1555, 1546, 1542, 1547, 1549, 1553, 1558, 1545, 1555,
-     1557, 1557, 1548, 1552, 1560, 1561, 1550, 1549, 1563, 1554,
-     1557, 1566, 1551, 1561, 1554, 1552, 1553, 1565, 1555, 1567,
-
-     1564, 1556, 1568, 1569, 1558, 1571, 1575, 1557, 1557, 1573,
-     1563, 1560, 1561, 1564, 1577, 1563, 1576, 1578, 1566, 1565,
-     1582, 1581, 1586, 1583, 1565, 1569, 1567, 1564,    0, 1568,
-     1569, 1585, 1571, 1575, 1576, 1573, 1573, 1586, 1591, 1578,
-     1581, 1577, 1587, 1576, 1578, 1583, 1588, 1582, 1581, 1586,
-     1583, 1587, 1594, 1585, 1589, 1589, 1590, 1588, 1585, 1594,
-     1591, 1595, 1590, 1596, 1589, 1591, 1597, 1601, 1603, 1587,
-     1607, 1605, 1611, 1588, 1608, 1612, 1610,    0, 1613, 1594,
-     1613, 1589, 1589, 1590, 1605, 1610, 1608, 1616, 1595, 1597,
-     1596, 1603, 1614, 1597, 1601, 1603, 1617, 1607, 1605, 1611,
-
-     1615, 1608, 1612, 1610, 1614, 1613, 1615, 1618, 1619, 1616,
-     1622, 1624, 1625, 1627, 1616, 1618, 1628, 1631, 1617, 1614,
-     1632,    0, 1633, 1617, 1634,    0,    0, 1615, 1627, 1641,
-     1636,    0, 1634, 1632, 1618, 1619, 1635, 1622, 1624, 1625,
-     1627, 1636, 1628, 1628, 1633, 1635, 1642, 1632, 1631, 1633,
-     1643, 1634, 1641, 1642, 1644, 1646, 1641, 1636, 1645, 1647,
-     1648, 1647, 1644, 1635, 1643, 1649, 1646, 1645, 1651, 1652,
-     1650, 1654, 1648, 1642, 1653, 1655, 1653, 1643, 1660, 1661,
-     1656, 1644, 1646, 1654,    0, 1645, 1647, 1648, 1650, 1663,
-     1651, 1652, 1649, 1656, 1659, 1651, 1652, 1650, 1654, 1658,
-
-     1662, 1653, 1659, 1663, 1664, 1665, 1655, 1656, 1670, 1660,
-     1661, 1658, 1664, 1662, 1666, 1667, 1663, 1669, 1665, 1668,
-     1672, 1659, 1666, 1671, 1678, 1669, 1658, 1662, 1672, 1667,
-     1670, 1664, 1665, 1668, 1673, 1670, 1674, 1675, 1679,    0,
-     1676, 1666, 1667, 1677, 1669, 1671, 1668, 1672, 1680, 1681,
-     1671, 1677, 1683, 1691,    0, 1678,    0, 1681, 1674, 1675,
-     1673, 1673, 1676, 1674, 1675, 1679, 1682, 1676, 1680, 1684,
-     1677, 1685, 1687, 1688, 1682, 1680, 1681, 1684, 1689, 1691,
-     1691, 1688, 1692, 1683, 1693, 1685, 1689, 1690,    0, 1694,
-        0, 1695, 1693, 1682, 1687,    0, 1684, 1696, 1685, 1687,
-
-     1688, 1690, 1697, 1699, 1692, 1689, 1700, 1701,    0, 1692,
-     1703, 1693, 1698, 1702, 1690, 1694, 1694, 1695, 1695, 1696,
-     1698, 1702, 1697, 1704, 1696, 1706, 1700, 1701, 1708, 1697,
-     1699, 1704, 1703, 1700, 1701, 1707, 1708, 1703, 1709, 1698,
-     1702, 1710, 1714, 1711, 1715, 1712, 1709, 1706, 1713, 1716,
-     1704, 1711, 1706, 1712, 1717, 1708,    0, 1707, 1718,    0,
-     1720, 1723, 1707, 1726, 1715, 1709, 1727, 1710, 1710, 1714,
-     1711, 1715, 1712,    0, 1713, 1713, 1716,    0, 1718,    0,
-        0, 1717, 1720, 1723, 1724, 1718, 1725, 1720, 1723,    0,
-     1726,    0, 1724, 1727, 1725,    0,    0,    0,    0,    0,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,   11,   11,   11,   11,   11,
+
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   14,   25,   15,   28,   29,   14,
+       15,   14,   14,   14,   14,   30,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   19,   19,   33,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   20,   20,   51,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   21,   21,   22,   23,   21,   24,   66,   23,   75,
+       22,   23,   26,   23,   23,   76,   26,   22,   22,   21,
+       26,   27,   31,   32,   27,   35,   24,   32,   34,   35,
+       31,   27,   77,   27,   34,   36,   31,   34,   78,   35,
+       31,   38,   35,   32,   34,   36,   37,   80,   37,   36,
+
+       36,   38,   82,   39,   83,   84,   38,   39,   85,   40,
+       40,   86,   88,   37,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   44,   44,
+       89,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   45,   45,   90,
+       92,   45,   45,   93,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   49,   49,   94,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   50,   91,   91,   95,   97,
+       50,   98,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   55,   55,  101,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   56,   56,  102,  103,  104,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   60,   60,  105,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   61,  106,  100,  107,  108,   61,  100,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       63,   63,  109,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   65,
+
+       65,  110,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   70,   70,
+      112,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   73,   73,  113,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   79,   81,   87,   99,
+       96,  111,  114,   96,  115,  111,  116,  117,  118,   79,
+       81,  119,  120,  121,  122,  123,   87,   96,  124,   99,
+      125,  126,  127,  128,  147,  149,  150,  151,  152,  153,
+      154,  155,  120,  156,  157,  158,  160,  161,  164,  145,
+      145,  125,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  159,  162,
+
+      163,  165,  166,  167,  159,  163,  168,  169,  170,  171,
+      163,  172,  173,  175,  176,  174,  163,  163,  174,  177,
+      178,  162,  179,  180,  181,  182,  183,  184,  185,  186,
+      187,  188,  189,  190,  181,  191,  182,  192,  177,  193,
+      194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+      204,  205,  206,  207,  208,  209,  201,  201,  210,  211,
+      212,  213,  215,  216,  217,  218,  219,  220,  221,  222,
+      223,  224,  225,  226,  227,  228,  229,  230,  213,  231,
+      232,  233,  211,  234,  235,  236,  237,  238,  239,  240,
+      241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+
+      251,  252,  253,  254,  255,  256,  257,  258,  259,  260,
+      258,  261,  260,  262,  263,  263,  264,  265,  266,  267,
+      268,  266,  269,  270,  271,  272,  273,  274,  275,  276,
+      277,  278,  279,  280,  279,  281,  282,  283,  281,  284,
+      281,  285,  286,  287,  285,  288,  289,  290,  291,  293,
+      294,  295,  292,  292,  296,  297,  298,  299,  300,  301,
+      302,  303,  292,  290,  292,  292,  292,  304,  305,  292,
+      306,  307,  308,  309,  310,  311,  312,  313,  313,  314,
+      315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+      325,  326,  327,  328,  329,  330,  331,  332,  333,  334,
+
+      335,  336,  324,  337,  338,  339,  340,  341,  342,  343,
+      344,  345,  346,  348,  349,  350,  351,  352,  354,  355,
+      356,  357,  358,  359,  360,  361,  362,  363,  364,  365,
+      366,  367,  368,  369,  370,  371,  372,  373,  375,  370,
+      374,  370,  376,  377,  378,  379,  380,  381,  361,  370,
+      374,  382,  383,  384,  385,  386,  387,  388,  389,  370,
+      390,  391,  392,  393,  394,  395,  396,  397,  398,  399,
+      400,  401,  402,  403,  404,  405,  406,  395,  405,  395,
+      406,  407,  408,  395,  409,  410,  411,  412,  413,  414,
+      415,  416,  417,  418,  419,  420,  421,  422,  423,  424,
+
+      425,  426,  427,  428,  429,  430,  426,  431,  432,  433,
+      426,  434,  435,  436,  437,  438,  426,  439,  440,  441,
+      442,  443,  444,  445,  446,  447,  448,  449,  450,  451,
+      452,  433,  453,  451,  454,  455,  456,  457,  458,  459,
+      460,  457,  461,  462,  463,  464,  465,  466,  467,  468,
+      455,  469,  470,  471,  472,  473,  474,  475,  476,  477,
+      478,  479,  480,  481,  482,  483,  484,  485,  486,  487,
+      488,  489,  490,  491,  492,  493,  494,  495,  496,  497,
+      498,  499,  500,  502,  503,  504,  505,  497,  506,  507,
+      508,  509,  510,  511,  511,  511,  513,  511,  511,  516,
+
+      519,  511,  520,  521,  522,  524,  523,  523,  511,  523,
+      525,  511,  523,  526,  527,  528,  529,  523,  530,  531,
+      532,  533,  534,  523,  523,  535,  536,  537,  538,  539,
+      540,  541,  542,  543,  544,  545,  546,  547,  548,  549,
+      550,  551,  552,  553,  554,  555,  556,  557,  558,  559,
+      560,  561,  563,  564,  565,  566,  567,  568,  569,  571,
+      572,  573,  574,  575,  576,  577,  569,  578,  579,  580,
+      581,  582,  583,  584,  585,  586,  587,  588,  589,  590,
+      591,  592,  593,  594,  595,  596,  597,  598,  599,  600,
+      601,  602,  603,  604,  605,  606,  607,  608,  609,  610,
+
+      611,  612,  613,  614,  615,  616,  617,  616,  618,  619,
+      620,  616,  621,  616,  622,  623,  624,  625,  616,  626,
+      627,  628,  626,  616,  629,  630,  631,  632,  633,  630,
+      634,  635,  636,  628,  638,  637,  639,  640,  641,  630,
+      637,  642,  637,  643,  644,  645,  646,  647,  648,  649,
+      650,  652,  653,  654,  655,  656,  657,  658,  659,  660,
+      637,  661,  662,  663,  664,  665,  666,  667,  669,  670,
+      671,  672,  673,  674,  675,  676,  677,  678,  680,  682,
+      681,  683,  680,  681,  684,  685,  686,  687,  688,  689,
+      690,  691,  692,  693,  694,  695,  696,  697,  698,  699,
+
+      700,  701,  702,  703,  704,  705,  706,  707,  708,  709,
+      710,  711,  712,  713,  714,  715,  716,  717,  718,  719,
+      720,  721,  722,  725,  726,  727,  728,  729,  730,  731,
+      732,  733,  734,  735,  736,  737,  738,  739,  740,  741,
+      742,  743,  744,  745,  746,  747,  748,  749,  750,  751,
+      752,  753,  754,  755,  756,  757,  758,  759,  760,  761,
+      762,  763,  764,  765,  766,  767,  768,  769,  770,  771,
+      772,  773,  774,  775,  776,  777,  778,  779,  780,  782,
+      783,  784,  785,  786,  787,  788,  783,  789,  790,  788,
+      791,  792,  793,  794,  795,  796,  797,  798,  799,  800,
+
+      801,  802,  803,  804,  805,  806,  807,  808,  809,  811,
+      812,  813,  808,  814,  808,  815,  808,  814,  816,  817,
+      818,  819,  820,  821,  822,  823,  824,  825,  827,  828,
+      829,  830,  831,  832,  833,  834,  835,  836,  837,  838,
+      839,  840,  841,  842,  843,  844,  846,  847,  848,  849,
+      850,  851,  852,  853,  854,  855,  856,  857,  858,  859,
+      860,  861,  862,  863,  864,  859,  865,  866,  867,  868,
+      869,  870,  871,  872,  873,  875,  876,  877,  878,  875,
+      879,  880,  881,  882,  883,  885,  886,  887,  888,  889,
+      890,  891,  892,  893,  894,  895,  896,  897,  898,  899,
+
+      900,  901,  902,  903,  904,  905,  906,  907,  908,  909,
+      910,  911,  912,  913,  914,  915,  916,  917,  919,  920,
+      921,  922,  923,  924,  925,  926,  927,  924,  928,  929,
+      930,  931,  932,  933,  934,  935,  936,  937,  934,  938,
+      939,  940,  941,  942,  943,  944,  945,  946,  948,  949,
+      950,  946,  951,  952,  953,  954,  955,  957,  959,  960,
+      961,  963,  965,  967,  946,  968,  969,  970,  971,  972,
+      973,  974,  975,  976,  977,  978,  979,  980,  981,  982,
+      983,  985,  986,  987,  988,  989,  990,  991,  992,  993,
+      994,  995,  996,  997,  998,  999, 1000, 1001, 1002, 1003,
+
+     1004, 1005, 1006, 1008, 1009, 1010, 1011, 1012, 1013, 1014,
+     1015, 1012, 1016, 1017, 1018, 1016, 1019, 1020, 1021, 1022,
+     1023, 1024, 1025, 1026, 1027, 1028, 1029, 1016, 1030, 1031,
+     1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041,
+     1042, 1043, 1044, 1045, 1046, 1047, 1048, 1050, 1051, 1052,
+     1053, 1054, 1057, 1053, 1058, 1059, 1060, 1061, 1062, 1063,
+     1064, 1065, 1066, 1067, 1065, 1068, 1069, 1070, 1071, 1072,
+     1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1083,
+     1080, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
+     1079, 1095, 1096, 1097, 1098, 1092, 1099, 1100, 1101, 1102,
+
+     1103, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
+     1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
+     1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1133, 1134,
+     1135, 1136, 1137, 1138, 1140, 1141, 1142, 1143, 1144, 1145,
+     1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155,
+     1156, 1157, 1158, 1159, 1147, 1160, 1161, 1163, 1164, 1165,
+     1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1173, 1173,
+     1174, 1175, 1176, 1177, 1173, 1178, 1179, 1180, 1181, 1182,
+     1183, 1184, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
+     1194, 1195, 1196, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
+
+     1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214,
+     1215, 1216, 1217, 1218, 1219, 1220, 1221, 1218, 1222, 1219,
+     1223, 1224, 1225, 1226, 1227, 1228, 1229, 1226, 1230, 1231,
+     1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1241, 1242,
+     1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252,
+     1253, 1254, 1256, 1259, 1261, 1262, 1263, 1264, 1265, 1265,
+     1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275,
+     1277, 1278, 1279, 1280, 1282, 1285, 1286, 1287, 1288, 1289,
+     1290, 1277, 1291, 1292, 1293, 1295, 1296, 1297, 1298, 1299,
+     1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1309, 1310,
+
+     1311, 1312, 1313, 1314, 1316, 1317, 1318, 1319, 1320, 1321,
+     1322, 1323, 1324, 1325, 1326, 1327, 1329, 1330, 1331, 1332,
+     1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1338, 1341,
+     1342, 1340, 1343, 1344, 1346, 1347, 1349, 1350, 1351, 1352,
+     1354, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
+     1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1375, 1376,
+     1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386,
+     1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397,
+     1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1407, 1408,
+     1409, 1410, 1411, 1412, 1414, 1416, 1417, 1418, 1419, 1420,
+
+     1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430,
+     1431, 1432, 1433, 1434, 1435, 1437, 1438, 1439, 1440, 1441,
+     1442, 1443, 1444, 1445, 1446, 1447, 1448, 1450, 1451, 1452,
+     1453, 1454, 1455, 1456, 1445, 1457, 1458, 1459, 1445, 1459,
+     1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470,
+     1471, 1472, 1473, 1474, 1475, 1476, 1478, 1480, 1481, 1482,
+     1483, 1485, 1486, 1487, 1488, 1489, 1490, 1492, 1483, 1490,
+     1493, 1495, 1496, 1497, 1498, 1500, 1501, 1502, 1503, 1504,
+     1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1514, 1515,
+     1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525,
+
+     1527, 1528, 1529, 1530, 1531, 1532, 1535, 1536, 1540, 1542,
+     1544, 1545, 1546, 1548, 1551, 1552, 1553, 1554, 1555, 1556,
+     1558, 1560, 1561, 1562, 1564, 1566, 1567, 1568, 1569, 1556,
+     1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579,
+     1580, 1581, 1582, 1584, 1585, 1586, 1587, 1588, 1589, 1590,
+     1591, 1592, 1594, 1596, 1597, 1598, 1599, 1600, 1601, 1602,
+     1603, 1604, 1606, 1607, 1608, 1609, 1610, 1612, 1613, 1614,
+     1615, 1616, 1617, 1618, 1619, 1620, 1622, 1623, 1624, 1625,
+     1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635,
+     1636, 1637, 1638, 1640, 1641, 1642, 1645, 1646, 1647, 1648,
+
+     1649, 1650, 1651, 1653, 1654, 1655, 1657, 1658, 1659, 1660,
+     1661, 1662, 1665, 1668, 1669, 1670, 1671, 1672, 1673, 1674,
+     1675, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685,
+     1686, 1687, 1689, 1690, 1693, 1694, 1695, 1696, 1697, 1698,
+     1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1708, 1709,
+     1710, 1711, 1712, 1713, 1714, 1715, 1717, 1718, 1719, 1720,
+     1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1730, 1731,
+     1732, 1733, 1734, 1736, 1738, 1740, 1741, 1744, 1745, 1746,
+     1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1758,
+     1759, 1760, 1761, 1762, 1765, 1766, 1769, 1770, 1770, 1771,
+
+     1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781,
+     1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1792,
+     1793, 1794, 1795, 1797, 1798, 1799, 1800, 1801, 1802, 1803,
+     1804, 1806, 1808, 1809, 1810, 1815, 1816, 1817, 1819, 1820,
+     1821, 1822, 1823, 1824, 1826, 1827, 1828, 1829, 1830, 1831,
+     1833, 1834, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843,
+     1844, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854,
+     1856, 1857, 1858, 1860, 1861, 1862, 1863, 1864, 1865, 1866,
+     1867, 1868, 1869, 1870, 1871, 1872, 1874, 1875, 1876, 1877,
+     1878, 1879, 1880, 1880, 1881, 1883, 1884, 1886, 1887, 1888,
+
+     1889, 1890, 1891, 1892, 1893, 1895, 1896, 1898, 1899, 1900,
+     1902, 1903, 1904, 1905, 1906, 1907, 1910, 1911, 1912, 1914,
+     1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1922, 1923,
+     1924, 1927, 1928, 1929, 1930, 1934, 1935, 1938, 1939, 1940,
+     1941, 1943, 1945, 1946, 1947, 1949, 1950, 1951, 1953, 1954,
+     1956, 1957, 1958, 1959, 1960, 1961, 1962, 1965, 1970, 1971,
+     1972, 1973, 1975, 1976, 1979, 1980, 1981, 1982, 1983, 1984,
+     1985, 1986, 1992, 1993, 1994, 1997, 1998, 1999, 2000, 2001,
+     2002, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2013,
+     2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023,
+
+     2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033,
+     2034, 2035, 2036, 2037, 2038, 2039, 2040, 2042, 2043, 2044,
+     2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054,
+     2055, 2056, 2057, 2058, 2059, 2061, 2062, 2063, 2064, 2065,
+     2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2075, 2078,
+     2079, 2080, 2081, 2082, 2085, 2085, 2085, 2085, 2085, 2085,
+     2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085,
+     2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085,
+     2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085,
+     2085, 2085, 2085, 2085
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0, 1724,    0, 1725, 1731, 1731, 1731, 1731, 1731, 1731,
-     1731, 1732, 1732, 1732, 1732, 1732, 1732, 1732, 1733, 1733,
-     1733, 1733, 1733, 1733, 1733, 1734, 1734, 1734, 1734, 1734,
-     1734, 1734, 1735, 1735, 1735, 1735, 1735, 1735, 1735, 1737,
-     1737,    0, 1737, 1737, 1737, 1737, 1738, 1738,    0,    0,
-        0, 1738, 1738, 1739, 1739,    0,    0, 1739,    0, 1739,
-     1740,    0,    0,    0,    0,    0, 1740, 1741, 1741,    0,
-        0,    0, 1741, 1741, 1742,    0,    0,    0,    0,    0,
-     1742, 1743, 1743,    0, 1743, 1743, 1743, 1743, 1744, 1744,
-
-        0, 1744, 1744, 1744, 1744, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
-     1730
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -2323,7 +1955,7 @@ static void config_end_include(void)
 #define YY_NO_INPUT 1
 #endif
 
-#line 2325 "<stdout>"
+#line 1957 "<stdout>"
 
 #define INITIAL 0
 #define quotedstring 1
@@ -2510,7 +2142,7 @@ YY_DECL
     
 #line 197 "util/configlexer.lex"
 
-#line 2512 "<stdout>"
+#line 2144 "<stdout>"
 
 	if ( !(yy_init) )
 		{
@@ -2569,13 +2201,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1731 )
+				if ( yy_current_state >= 2086 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 5006 );
+		while ( yy_base[yy_current_state] != 2855 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -2660,755 +2292,910 @@ YY_RULE_SETUP
 case 12:
 YY_RULE_SETUP
 #line 212 "util/configlexer.lex"
-{ YDVAR(1, VAR_DO_IP4) }
+{ YDVAR(1, VAR_INCOMING_TCP_PIPELINE) }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
 #line 213 "util/configlexer.lex"
-{ YDVAR(1, VAR_DO_IP6) }
+{ YDVAR(1, VAR_TCP_REUSE_TIMEOUT) }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
 #line 214 "util/configlexer.lex"
-{ YDVAR(1, VAR_DO_UDP) }
+{ YDVAR(1, VAR_MAX_REUSE_TCP_QUERIES) }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
 #line 215 "util/configlexer.lex"
-{ YDVAR(1, VAR_DO_TCP) }
+{ YDVAR(1, VAR_DO_IP4) }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
 #line 216 "util/configlexer.lex"
-{ YDVAR(1, VAR_TCP_UPSTREAM) }
+{ YDVAR(1, VAR_DO_IP6) }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
 #line 217 "util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_DO_UDP) }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
 #line 218 "util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
+{ YDVAR(1, VAR_DO_TCP) }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
 #line 219 "util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
+{ YDVAR(1, VAR_TCP_UPSTREAM) }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
 #line 220 "util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_PORT) }
+{ YDVAR(1, VAR_SSL_UPSTREAM) }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
 #line 221 "util/configlexer.lex"
-{ YDVAR(1, VAR_DO_DAEMONIZE) }
+{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
 #line 222 "util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
 #line 223 "util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_SSL_PORT) }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
 #line 224 "util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
+{ YDVAR(1, VAR_DO_DAEMONIZE) }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
 #line 225 "util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
 #line 226 "util/configlexer.lex"
-{ YDVAR(1, VAR_SO_RCVBUF) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
 #line 227 "util/configlexer.lex"
-{ YDVAR(1, VAR_SO_SNDBUF) }
+{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
 #line 228 "util/configlexer.lex"
-{ YDVAR(1, VAR_SO_REUSEPORT) }
+{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
 #line 229 "util/configlexer.lex"
-{ YDVAR(1, VAR_IP_TRANSPARENT) }
+{ YDVAR(1, VAR_SO_RCVBUF) }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
 #line 230 "util/configlexer.lex"
-{ YDVAR(1, VAR_CHROOT) }
+{ YDVAR(1, VAR_SO_SNDBUF) }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
 #line 231 "util/configlexer.lex"
-{ YDVAR(1, VAR_USERNAME) }
+{ YDVAR(1, VAR_SO_REUSEPORT) }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
 #line 232 "util/configlexer.lex"
-{ YDVAR(1, VAR_DIRECTORY) }
+{ YDVAR(1, VAR_SO_REUSEPORT_BPF) }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
 #line 233 "util/configlexer.lex"
-{ YDVAR(1, VAR_LOGFILE) }
+{ YDVAR(1, VAR_SO_INCOMING_CPU) }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
 #line 234 "util/configlexer.lex"
-{ YDVAR(1, VAR_PIDFILE) }
+{ YDVAR(1, VAR_CPU_AFFINITY) }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
 #line 235 "util/configlexer.lex"
-{ YDVAR(1, VAR_ROOT_HINTS) }
+{ YDVAR(1, VAR_UDP_BATCH_SIZE) }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
 #line 236 "util/configlexer.lex"
-{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
+{ YDVAR(1, VAR_IP_TRANSPARENT) }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
 #line 237 "util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
+{ YDVAR(1, VAR_CHROOT) }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
 #line 238 "util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
+{ YDVAR(1, VAR_USERNAME) }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
 #line 239 "util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
+{ YDVAR(1, VAR_DIRECTORY) }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 240 "util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
+{ YDVAR(1, VAR_LOGFILE) }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 241 "util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
+{ YDVAR(1, VAR_PIDFILE) }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
 #line 242 "util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_TTL) }
+{ YDVAR(1, VAR_ROOT_HINTS) }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
 #line 243 "util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
+{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
 #line 244 "util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MIN_TTL) }
+{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
 #line 245 "util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_HOST_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
 #line 246 "util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_LAME_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 247 "util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
+{ YDVAR(1, VAR_LOCKFREE_CACHE_LOOKUP) }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 248 "util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
+{ YDVAR(1, VAR_MSG_CACHE_WIRE) }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
 #line 249 "util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
+{ YDVAR(1, VAR_CACHE_OPEN_ADDRESSING) }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
 #line 250 "util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
+{ YDVAR(1, VAR_CACHE_ADMISSION) }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
 #line 251 "util/configlexer.lex"
-{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
+{ YDVAR(1, VAR_HASH_FUNCTION) }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
 #line 252 "util/configlexer.lex"
-{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
+{ YDVAR(1, VAR_COALESCE_QUERIES) }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
 #line 253 "util/configlexer.lex"
-{ YDVAR(1, VAR_DELAY_CLOSE) }
+{ YDVAR(1, VAR_OUTGOING_PORT_POOL) }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
 #line 254 "util/configlexer.lex"
-{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
+{ YDVAR(1, VAR_OUTGOING_PORT_LIFETIME) }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
 #line 255 "util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
+{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
 #line 256 "util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
+{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 257 "util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_GLUE) }
+{ YDVAR(1, VAR_CACHE_MAX_TTL) }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 258 "util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
+{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 259 "util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
+{ YDVAR(1, VAR_CACHE_MIN_TTL) }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 260 "util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
+{ YDVAR(1, VAR_INFRA_HOST_TTL) }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 261 "util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
+{ YDVAR(1, VAR_INFRA_LAME_TTL) }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 262 "util/configlexer.lex"
-{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
+{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 263 "util/configlexer.lex"
-{ YDVAR(1, VAR_CAPS_WHITELIST) }
+{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 264 "util/configlexer.lex"
-{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
+{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 265 "util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
+{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 266 "util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
+{ YDVAR(1, VAR_INFRA_RTT_PERCENTILE) }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 267 "util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH_KEY) }
+{ YDVAR(1, VAR_HEDGE_QUERY_BUDGET) }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
 #line 268 "util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH) }
+{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
 #line 269 "util/configlexer.lex"
-{ YDVAR(0, VAR_STUB_ZONE) }
+{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 270 "util/configlexer.lex"
-{ YDVAR(1, VAR_NAME) }
+{ YDVAR(1, VAR_DELAY_CLOSE) }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 271 "util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_ADDR) }
+{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 272 "util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_HOST) }
+{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 273 "util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_PRIME) }
+{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 274 "util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_FIRST) }
+{ YDVAR(1, VAR_HARDEN_GLUE) }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 275 "util/configlexer.lex"
-{ YDVAR(0, VAR_FORWARD_ZONE) }
+{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 276 "util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_ADDR) }
+{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 277 "util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_HOST) }
+{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 278 "util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_FIRST) }
+{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 279 "util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
+{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 280 "util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
+{ YDVAR(1, VAR_CAPS_WHITELIST) }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 281 "util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL) }
+{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 282 "util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_IDENTITY) }
+{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 283 "util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_VERSION) }
+{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 284 "util/configlexer.lex"
-{ YDVAR(1, VAR_IDENTITY) }
+{ YDVAR(1, VAR_PREFETCH_KEY) }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 285 "util/configlexer.lex"
-{ YDVAR(1, VAR_VERSION) }
+{ YDVAR(1, VAR_PREFETCH) }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 286 "util/configlexer.lex"
-{ YDVAR(1, VAR_MODULE_CONF) }
+{ YDVAR(1, VAR_SERVE_EXPIRED) }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 287 "util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR) }
+{ YDVAR(1, VAR_SERVE_EXPIRED_TTL) }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 288 "util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
+{ YDVAR(1, VAR_SERVE_EXPIRED_REPLY_TTL) }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 289 "util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_CACHE_SNAPSHOT_FILE) }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 290 "util/configlexer.lex"
-{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_CACHE_SNAPSHOT_INTERVAL) }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 291 "util/configlexer.lex"
-{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
+{ YDVAR(0, VAR_STUB_ZONE) }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 292 "util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR) }
+{ YDVAR(1, VAR_NAME) }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 293 "util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
+{ YDVAR(1, VAR_STUB_ADDR) }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 294 "util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
+{ YDVAR(1, VAR_STUB_HOST) }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 295 "util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
+{ YDVAR(1, VAR_STUB_PRIME) }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 296 "util/configlexer.lex"
-{ YDVAR(1, VAR_BOGUS_TTL) }
+{ YDVAR(1, VAR_STUB_FIRST) }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 297 "util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
+{ YDVAR(0, VAR_FORWARD_ZONE) }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 298 "util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
+{ YDVAR(1, VAR_FORWARD_ADDR) }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 299 "util/configlexer.lex"
-{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
+{ YDVAR(1, VAR_FORWARD_HOST) }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 300 "util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
+{ YDVAR(1, VAR_FORWARD_FIRST) }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 301 "util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
 #line 302 "util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 303 "util/configlexer.lex"
-{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
+{ YDVAR(2, VAR_ACCESS_CONTROL) }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 304 "util/configlexer.lex"
-{ 
-				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
+{ YDVAR(1, VAR_HIDE_IDENTITY) }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
-#line 306 "util/configlexer.lex"
-{ YDVAR(1, VAR_ADD_HOLDDOWN) }
+#line 305 "util/configlexer.lex"
+{ YDVAR(1, VAR_HIDE_VERSION) }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
-#line 307 "util/configlexer.lex"
-{ YDVAR(1, VAR_DEL_HOLDDOWN) }
+#line 306 "util/configlexer.lex"
+{ YDVAR(1, VAR_IDENTITY) }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
-#line 308 "util/configlexer.lex"
-{ YDVAR(1, VAR_KEEP_MISSING) }
+#line 307 "util/configlexer.lex"
+{ YDVAR(1, VAR_VERSION) }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
-#line 309 "util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSLOG) }
+#line 308 "util/configlexer.lex"
+{ YDVAR(1, VAR_MODULE_CONF) }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
-#line 310 "util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TIME_ASCII) }
+#line 309 "util/configlexer.lex"
+{ YDVAR(1, VAR_DLV_ANCHOR) }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
-#line 311 "util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_QUERIES) }
+#line 310 "util/configlexer.lex"
+{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
-#line 312 "util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE) }
+#line 311 "util/configlexer.lex"
+{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
-#line 313 "util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA) }
+#line 312 "util/configlexer.lex"
+{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
-#line 314 "util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
+#line 313 "util/configlexer.lex"
+{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
-#line 315 "util/configlexer.lex"
-{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
+#line 314 "util/configlexer.lex"
+{ YDVAR(1, VAR_TRUST_ANCHOR) }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
-#line 316 "util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
+#line 315 "util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
-#line 317 "util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+#line 316 "util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
-#line 318 "util/configlexer.lex"
-{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
+#line 317 "util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
-#line 319 "util/configlexer.lex"
-{ YDVAR(0, VAR_REMOTE_CONTROL) }
+#line 318 "util/configlexer.lex"
+{ YDVAR(1, VAR_BOGUS_TTL) }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
-#line 320 "util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_ENABLE) }
+#line 319 "util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
-#line 321 "util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+#line 320 "util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
-#line 322 "util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_PORT) }
+#line 321 "util/configlexer.lex"
+{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
-#line 323 "util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_USE_CERT) }
+#line 322 "util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
-#line 324 "util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+#line 323 "util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
-#line 325 "util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+#line 324 "util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
-#line 326 "util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+#line 325 "util/configlexer.lex"
+{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
-#line 327 "util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+#line 326 "util/configlexer.lex"
+{ YDVAR(1, VAR_AGGRESSIVE_NSEC) }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
-#line 328 "util/configlexer.lex"
-{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+#line 327 "util/configlexer.lex"
+{ 
+				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 329 "util/configlexer.lex"
-{ YDVAR(0, VAR_PYTHON) }
+{ YDVAR(1, VAR_ADD_HOLDDOWN) }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 330 "util/configlexer.lex"
-{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+{ YDVAR(1, VAR_DEL_HOLDDOWN) }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 331 "util/configlexer.lex"
-{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+{ YDVAR(1, VAR_KEEP_MISSING) }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 332 "util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+{ YDVAR(1, VAR_USE_SYSLOG) }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 333 "util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+{ YDVAR(1, VAR_LOG_TIME_ASCII) }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 334 "util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_PREFIX) }
+{ YDVAR(1, VAR_LOG_QUERIES) }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
 #line 335 "util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+{ YDVAR(2, VAR_LOCAL_ZONE) }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 336 "util/configlexer.lex"
-{ YDVAR(0, VAR_DNSTAP) }
+{ YDVAR(1, VAR_LOCAL_DATA) }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 337 "util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 338 "util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 339 "util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
+{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 340 "util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
+{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 341 "util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
+{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 342 "util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_VERSION) }
+{ YDVAR(0, VAR_REMOTE_CONTROL) }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 343 "util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
+{ YDVAR(1, VAR_CONTROL_ENABLE) }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
+#line 344 "util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+	YY_BREAK
+case 144:
+YY_RULE_SETUP
 #line 345 "util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_PORT) }
+	YY_BREAK
+case 145:
+YY_RULE_SETUP
+#line 346 "util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_USE_CERT) }
+	YY_BREAK
+case 146:
+YY_RULE_SETUP
+#line 347 "util/configlexer.lex"
+{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+	YY_BREAK
+case 147:
+YY_RULE_SETUP
+#line 348 "util/configlexer.lex"
+{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+	YY_BREAK
+case 148:
+YY_RULE_SETUP
+#line 349 "util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+	YY_BREAK
+case 149:
+YY_RULE_SETUP
+#line 350 "util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+	YY_BREAK
+case 150:
+YY_RULE_SETUP
+#line 351 "util/configlexer.lex"
+{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+	YY_BREAK
+case 151:
+YY_RULE_SETUP
+#line 352 "util/configlexer.lex"
+{ YDVAR(0, VAR_PYTHON) }
+	YY_BREAK
+case 152:
+YY_RULE_SETUP
+#line 353 "util/configlexer.lex"
+{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+	YY_BREAK
+case 153:
+YY_RULE_SETUP
+#line 354 "util/configlexer.lex"
+{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+	YY_BREAK
+case 154:
+YY_RULE_SETUP
+#line 355 "util/configlexer.lex"
+{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+	YY_BREAK
+case 155:
+YY_RULE_SETUP
+#line 356 "util/configlexer.lex"
+{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+	YY_BREAK
+case 156:
+YY_RULE_SETUP
+#line 357 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_PREFIX) }
+	YY_BREAK
+case 157:
+YY_RULE_SETUP
+#line 358 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+	YY_BREAK
+case 158:
+YY_RULE_SETUP
+#line 359 "util/configlexer.lex"
+{ YDVAR(0, VAR_DNSTAP) }
+	YY_BREAK
+case 159:
+YY_RULE_SETUP
+#line 360 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+	YY_BREAK
+case 160:
+YY_RULE_SETUP
+#line 361 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+	YY_BREAK
+case 161:
+YY_RULE_SETUP
+#line 362 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_IP) }
+	YY_BREAK
+case 162:
+YY_RULE_SETUP
+#line 363 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_FILE) }
+	YY_BREAK
+case 163:
+YY_RULE_SETUP
+#line 364 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_FILE_ROTATE_SIZE) }
+	YY_BREAK
+case 164:
+YY_RULE_SETUP
+#line 365 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_FLUSH_SIZE) }
+	YY_BREAK
+case 165:
+YY_RULE_SETUP
+#line 366 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_FLUSH_TIME) }
+	YY_BREAK
+case 166:
+YY_RULE_SETUP
+#line 367 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_DROP_POLICY) }
+	YY_BREAK
+case 167:
+YY_RULE_SETUP
+#line 368 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_HIGH_WATERMARK) }
+	YY_BREAK
+case 168:
+YY_RULE_SETUP
+#line 369 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SAMPLE_RATE) }
+	YY_BREAK
+case 169:
+YY_RULE_SETUP
+#line 370 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
+	YY_BREAK
+case 170:
+YY_RULE_SETUP
+#line 371 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
+	YY_BREAK
+case 171:
+YY_RULE_SETUP
+#line 372 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
+	YY_BREAK
+case 172:
+YY_RULE_SETUP
+#line 373 "util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_VERSION) }
+	YY_BREAK
+case 173:
+YY_RULE_SETUP
+#line 374 "util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
+	YY_BREAK
+case 174:
+YY_RULE_SETUP
+#line 376 "util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 144:
+case 175:
 YY_RULE_SETUP
-#line 347 "util/configlexer.lex"
+#line 378 "util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
 	YY_BREAK
-case 145:
+case 176:
 YY_RULE_SETUP
-#line 349 "util/configlexer.lex"
+#line 380 "util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 146:
+case 177:
 YY_RULE_SETUP
-#line 351 "util/configlexer.lex"
+#line 382 "util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
 	YY_BREAK
-case 147:
+case 178:
 YY_RULE_SETUP
-#line 353 "util/configlexer.lex"
+#line 384 "util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 148:
+case 179:
 YY_RULE_SETUP
-#line 355 "util/configlexer.lex"
+#line 386 "util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT) }
 	YY_BREAK
-case 149:
+case 180:
 YY_RULE_SETUP
-#line 356 "util/configlexer.lex"
+#line 387 "util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SLABS) }
 	YY_BREAK
-case 150:
+case 181:
 YY_RULE_SETUP
-#line 357 "util/configlexer.lex"
+#line 388 "util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SIZE) }
 	YY_BREAK
-case 151:
+case 182:
 YY_RULE_SETUP
-#line 358 "util/configlexer.lex"
+#line 389 "util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_FOR_DOMAIN) }
 	YY_BREAK
-case 152:
+case 183:
 YY_RULE_SETUP
-#line 359 "util/configlexer.lex"
+#line 390 "util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_BELOW_DOMAIN) }
 	YY_BREAK
-case 153:
+case 184:
 YY_RULE_SETUP
-#line 360 "util/configlexer.lex"
+#line 391 "util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 154:
-/* rule 154 can match eol */
+case 185:
+/* rule 185 can match eol */
 YY_RULE_SETUP
-#line 361 "util/configlexer.lex"
+#line 392 "util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++; }
 	YY_BREAK
 /* Quoted strings. Strip leading and ending quotes */
-case 155:
+case 186:
 YY_RULE_SETUP
-#line 364 "util/configlexer.lex"
+#line 395 "util/configlexer.lex"
 { BEGIN(quotedstring); LEXOUT(("QS ")); }
 	YY_BREAK
 case YY_STATE_EOF(quotedstring):
-#line 365 "util/configlexer.lex"
+#line 396 "util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 156:
+case 187:
 YY_RULE_SETUP
-#line 370 "util/configlexer.lex"
+#line 401 "util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 157:
-/* rule 157 can match eol */
+case 188:
+/* rule 188 can match eol */
 YY_RULE_SETUP
-#line 371 "util/configlexer.lex"
+#line 402 "util/configlexer.lex"
 { yyerror("newline inside quoted string, no end \""); 
 			  cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 158:
+case 189:
 YY_RULE_SETUP
-#line 373 "util/configlexer.lex"
+#line 404 "util/configlexer.lex"
 {
         LEXOUT(("QE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -3421,34 +3208,34 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* Single Quoted strings. Strip leading and ending quotes */
-case 159:
+case 190:
 YY_RULE_SETUP
-#line 385 "util/configlexer.lex"
+#line 416 "util/configlexer.lex"
 { BEGIN(singlequotedstr); LEXOUT(("SQS ")); }
 	YY_BREAK
 case YY_STATE_EOF(singlequotedstr):
-#line 386 "util/configlexer.lex"
+#line 417 "util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 160:
+case 191:
 YY_RULE_SETUP
-#line 391 "util/configlexer.lex"
+#line 422 "util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 161:
-/* rule 161 can match eol */
+case 192:
+/* rule 192 can match eol */
 YY_RULE_SETUP
-#line 392 "util/configlexer.lex"
+#line 423 "util/configlexer.lex"
 { yyerror("newline inside quoted string, no end '"); 
 			     cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 162:
+case 193:
 YY_RULE_SETUP
-#line 394 "util/configlexer.lex"
+#line 425 "util/configlexer.lex"
 {
         LEXOUT(("SQE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -3461,38 +3248,38 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* include: directive */
-case 163:
+case 194:
 YY_RULE_SETUP
-#line 406 "util/configlexer.lex"
+#line 437 "util/configlexer.lex"
 { 
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include); }
 	YY_BREAK
 case YY_STATE_EOF(include):
-#line 408 "util/configlexer.lex"
+#line 439 "util/configlexer.lex"
 {
         yyerror("EOF inside include directive");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 164:
+case 195:
 YY_RULE_SETUP
-#line 412 "util/configlexer.lex"
+#line 443 "util/configlexer.lex"
 { LEXOUT(("ISP ")); /* ignore */ }
 	YY_BREAK
-case 165:
-/* rule 165 can match eol */
+case 196:
+/* rule 196 can match eol */
 YY_RULE_SETUP
-#line 413 "util/configlexer.lex"
+#line 444 "util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++;}
 	YY_BREAK
-case 166:
+case 197:
 YY_RULE_SETUP
-#line 414 "util/configlexer.lex"
+#line 445 "util/configlexer.lex"
 { LEXOUT(("IQS ")); BEGIN(include_quoted); }
 	YY_BREAK
-case 167:
+case 198:
 YY_RULE_SETUP
-#line 415 "util/configlexer.lex"
+#line 446 "util/configlexer.lex"
 {
 	LEXOUT(("Iunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext);
@@ -3500,27 +3287,27 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_quoted):
-#line 420 "util/configlexer.lex"
+#line 451 "util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 168:
+case 199:
 YY_RULE_SETUP
-#line 424 "util/configlexer.lex"
+#line 455 "util/configlexer.lex"
 { LEXOUT(("ISTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 169:
-/* rule 169 can match eol */
+case 200:
+/* rule 200 can match eol */
 YY_RULE_SETUP
-#line 425 "util/configlexer.lex"
+#line 456 "util/configlexer.lex"
 { yyerror("newline before \" in include name"); 
 				  cfg_parser->line++; BEGIN(inc_prev); }
 	YY_BREAK
-case 170:
+case 201:
 YY_RULE_SETUP
-#line 427 "util/configlexer.lex"
+#line 458 "util/configlexer.lex"
 {
 	LEXOUT(("IQE "));
 	yytext[yyleng - 1] = '\0';
@@ -3530,7 +3317,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(val):
-#line 433 "util/configlexer.lex"
+#line 464 "util/configlexer.lex"
 {
 	LEXOUT(("LEXEOF "));
 	yy_set_bol(1); /* Set beginning of line, so "^" rules match.  */
@@ -3542,33 +3329,33 @@ case YY_STATE_EOF(val):
 	}
 }
 	YY_BREAK
-case 171:
+case 202:
 YY_RULE_SETUP
-#line 444 "util/configlexer.lex"
+#line 475 "util/configlexer.lex"
 { LEXOUT(("unquotedstr(%s) ", yytext)); 
 			if(--num_args == 0) { BEGIN(INITIAL); }
 			yylval.str = strdup(yytext); return STRING_ARG; }
 	YY_BREAK
-case 172:
+case 203:
 YY_RULE_SETUP
-#line 448 "util/configlexer.lex"
+#line 479 "util/configlexer.lex"
 {
 	ub_c_error_msg("unknown keyword '%s'", yytext);
 	}
 	YY_BREAK
-case 173:
+case 204:
 YY_RULE_SETUP
-#line 452 "util/configlexer.lex"
+#line 483 "util/configlexer.lex"
 {
 	ub_c_error_msg("stray '%s'", yytext);
 	}
 	YY_BREAK
-case 174:
+case 205:
 YY_RULE_SETUP
-#line 456 "util/configlexer.lex"
+#line 487 "util/configlexer.lex"
 ECHO;
 	YY_BREAK
-#line 3570 "<stdout>"
+#line 3357 "<stdout>"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3858,7 +3645,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1731 )
+			if ( yy_current_state >= 2086 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -3886,11 +3673,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1731 )
+		if ( yy_current_state >= 2086 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 1730);
+	yy_is_jam = (yy_current_state == 2085);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -4523,7 +4310,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 456 "util/configlexer.lex"
+#line 487 "util/configlexer.lex"
 
 
 
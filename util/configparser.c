@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.7.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2012 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.7"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,7 @@
 
 
 
-/* Copy the first part of user declarations.  */
-/* Line 371 of yacc.c  */
+/* First part of user prologue.  */
 #line 38 "util/configparser.y"
 
 #include "config.h"
@@ -76,6 +80,7 @@
 #include "util/configyyrename.h"
 #include "util/config_file.h"
 #include "util/net_help.h"
+#include "util/storage/lookup3.h"
 
 int ub_c_lex(void);
 void ub_c_error(const char *message);
@@ -90,434 +95,514 @@ extern struct config_parser_state* cfg_parser;
 #endif
 
 
-/* Line 371 of yacc.c  */
-#line 95 "util/configparser.c"
+#line 99 "util/configparser.c"
 
-# ifndef YY_NULL
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULL nullptr
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULL 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
+#include "configparser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SPACE = 3,                      /* SPACE  */
+  YYSYMBOL_LETTER = 4,                     /* LETTER  */
+  YYSYMBOL_NEWLINE = 5,                    /* NEWLINE  */
+  YYSYMBOL_COMMENT = 6,                    /* COMMENT  */
+  YYSYMBOL_COLON = 7,                      /* COLON  */
+  YYSYMBOL_ANY = 8,                        /* ANY  */
+  YYSYMBOL_ZONESTR = 9,                    /* ZONESTR  */
+  YYSYMBOL_STRING_ARG = 10,                /* STRING_ARG  */
+  YYSYMBOL_VAR_SERVER = 11,                /* VAR_SERVER  */
+  YYSYMBOL_VAR_VERBOSITY = 12,             /* VAR_VERBOSITY  */
+  YYSYMBOL_VAR_NUM_THREADS = 13,           /* VAR_NUM_THREADS  */
+  YYSYMBOL_VAR_PORT = 14,                  /* VAR_PORT  */
+  YYSYMBOL_VAR_OUTGOING_RANGE = 15,        /* VAR_OUTGOING_RANGE  */
+  YYSYMBOL_VAR_INTERFACE = 16,             /* VAR_INTERFACE  */
+  YYSYMBOL_VAR_DO_IP4 = 17,                /* VAR_DO_IP4  */
+  YYSYMBOL_VAR_DO_IP6 = 18,                /* VAR_DO_IP6  */
+  YYSYMBOL_VAR_DO_UDP = 19,                /* VAR_DO_UDP  */
+  YYSYMBOL_VAR_DO_TCP = 20,                /* VAR_DO_TCP  */
+  YYSYMBOL_VAR_CHROOT = 21,                /* VAR_CHROOT  */
+  YYSYMBOL_VAR_USERNAME = 22,              /* VAR_USERNAME  */
+  YYSYMBOL_VAR_DIRECTORY = 23,             /* VAR_DIRECTORY  */
+  YYSYMBOL_VAR_LOGFILE = 24,               /* VAR_LOGFILE  */
+  YYSYMBOL_VAR_PIDFILE = 25,               /* VAR_PIDFILE  */
+  YYSYMBOL_VAR_MSG_CACHE_SIZE = 26,        /* VAR_MSG_CACHE_SIZE  */
+  YYSYMBOL_VAR_MSG_CACHE_SLABS = 27,       /* VAR_MSG_CACHE_SLABS  */
+  YYSYMBOL_VAR_NUM_QUERIES_PER_THREAD = 28, /* VAR_NUM_QUERIES_PER_THREAD  */
+  YYSYMBOL_VAR_RRSET_CACHE_SIZE = 29,      /* VAR_RRSET_CACHE_SIZE  */
+  YYSYMBOL_VAR_RRSET_CACHE_SLABS = 30,     /* VAR_RRSET_CACHE_SLABS  */
+  YYSYMBOL_VAR_OUTGOING_NUM_TCP = 31,      /* VAR_OUTGOING_NUM_TCP  */
+  YYSYMBOL_VAR_INFRA_HOST_TTL = 32,        /* VAR_INFRA_HOST_TTL  */
+  YYSYMBOL_VAR_INFRA_LAME_TTL = 33,        /* VAR_INFRA_LAME_TTL  */
+  YYSYMBOL_VAR_INFRA_CACHE_SLABS = 34,     /* VAR_INFRA_CACHE_SLABS  */
+  YYSYMBOL_VAR_INFRA_CACHE_NUMHOSTS = 35,  /* VAR_INFRA_CACHE_NUMHOSTS  */
+  YYSYMBOL_VAR_INFRA_CACHE_LAME_SIZE = 36, /* VAR_INFRA_CACHE_LAME_SIZE  */
+  YYSYMBOL_VAR_NAME = 37,                  /* VAR_NAME  */
+  YYSYMBOL_VAR_STUB_ZONE = 38,             /* VAR_STUB_ZONE  */
+  YYSYMBOL_VAR_STUB_HOST = 39,             /* VAR_STUB_HOST  */
+  YYSYMBOL_VAR_STUB_ADDR = 40,             /* VAR_STUB_ADDR  */
+  YYSYMBOL_VAR_TARGET_FETCH_POLICY = 41,   /* VAR_TARGET_FETCH_POLICY  */
+  YYSYMBOL_VAR_HARDEN_SHORT_BUFSIZE = 42,  /* VAR_HARDEN_SHORT_BUFSIZE  */
+  YYSYMBOL_VAR_HARDEN_LARGE_QUERIES = 43,  /* VAR_HARDEN_LARGE_QUERIES  */
+  YYSYMBOL_VAR_FORWARD_ZONE = 44,          /* VAR_FORWARD_ZONE  */
+  YYSYMBOL_VAR_FORWARD_HOST = 45,          /* VAR_FORWARD_HOST  */
+  YYSYMBOL_VAR_FORWARD_ADDR = 46,          /* VAR_FORWARD_ADDR  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_ADDRESS = 47,  /* VAR_DO_NOT_QUERY_ADDRESS  */
+  YYSYMBOL_VAR_HIDE_IDENTITY = 48,         /* VAR_HIDE_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_VERSION = 49,          /* VAR_HIDE_VERSION  */
+  YYSYMBOL_VAR_IDENTITY = 50,              /* VAR_IDENTITY  */
+  YYSYMBOL_VAR_VERSION = 51,               /* VAR_VERSION  */
+  YYSYMBOL_VAR_HARDEN_GLUE = 52,           /* VAR_HARDEN_GLUE  */
+  YYSYMBOL_VAR_MODULE_CONF = 53,           /* VAR_MODULE_CONF  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_FILE = 54,     /* VAR_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_TRUST_ANCHOR = 55,          /* VAR_TRUST_ANCHOR  */
+  YYSYMBOL_VAR_VAL_OVERRIDE_DATE = 56,     /* VAR_VAL_OVERRIDE_DATE  */
+  YYSYMBOL_VAR_BOGUS_TTL = 57,             /* VAR_BOGUS_TTL  */
+  YYSYMBOL_VAR_VAL_CLEAN_ADDITIONAL = 58,  /* VAR_VAL_CLEAN_ADDITIONAL  */
+  YYSYMBOL_VAR_VAL_PERMISSIVE_MODE = 59,   /* VAR_VAL_PERMISSIVE_MODE  */
+  YYSYMBOL_VAR_INCOMING_NUM_TCP = 60,      /* VAR_INCOMING_NUM_TCP  */
+  YYSYMBOL_VAR_MSG_BUFFER_SIZE = 61,       /* VAR_MSG_BUFFER_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SIZE = 62,        /* VAR_KEY_CACHE_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SLABS = 63,       /* VAR_KEY_CACHE_SLABS  */
+  YYSYMBOL_VAR_TRUSTED_KEYS_FILE = 64,     /* VAR_TRUSTED_KEYS_FILE  */
+  YYSYMBOL_VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 65, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+  YYSYMBOL_VAR_USE_SYSLOG = 66,            /* VAR_USE_SYSLOG  */
+  YYSYMBOL_VAR_OUTGOING_INTERFACE = 67,    /* VAR_OUTGOING_INTERFACE  */
+  YYSYMBOL_VAR_ROOT_HINTS = 68,            /* VAR_ROOT_HINTS  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_LOCALHOST = 69, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+  YYSYMBOL_VAR_CACHE_MAX_TTL = 70,         /* VAR_CACHE_MAX_TTL  */
+  YYSYMBOL_VAR_HARDEN_DNSSEC_STRIPPED = 71, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+  YYSYMBOL_VAR_ACCESS_CONTROL = 72,        /* VAR_ACCESS_CONTROL  */
+  YYSYMBOL_VAR_LOCAL_ZONE = 73,            /* VAR_LOCAL_ZONE  */
+  YYSYMBOL_VAR_LOCAL_DATA = 74,            /* VAR_LOCAL_DATA  */
+  YYSYMBOL_VAR_INTERFACE_AUTOMATIC = 75,   /* VAR_INTERFACE_AUTOMATIC  */
+  YYSYMBOL_VAR_STATISTICS_INTERVAL = 76,   /* VAR_STATISTICS_INTERVAL  */
+  YYSYMBOL_VAR_DO_DAEMONIZE = 77,          /* VAR_DO_DAEMONIZE  */
+  YYSYMBOL_VAR_USE_CAPS_FOR_ID = 78,       /* VAR_USE_CAPS_FOR_ID  */
+  YYSYMBOL_VAR_STATISTICS_CUMULATIVE = 79, /* VAR_STATISTICS_CUMULATIVE  */
+  YYSYMBOL_VAR_OUTGOING_PORT_PERMIT = 80,  /* VAR_OUTGOING_PORT_PERMIT  */
+  YYSYMBOL_VAR_OUTGOING_PORT_AVOID = 81,   /* VAR_OUTGOING_PORT_AVOID  */
+  YYSYMBOL_VAR_DLV_ANCHOR_FILE = 82,       /* VAR_DLV_ANCHOR_FILE  */
+  YYSYMBOL_VAR_DLV_ANCHOR = 83,            /* VAR_DLV_ANCHOR  */
+  YYSYMBOL_VAR_NEG_CACHE_SIZE = 84,        /* VAR_NEG_CACHE_SIZE  */
+  YYSYMBOL_VAR_HARDEN_REFERRAL_PATH = 85,  /* VAR_HARDEN_REFERRAL_PATH  */
+  YYSYMBOL_VAR_PRIVATE_ADDRESS = 86,       /* VAR_PRIVATE_ADDRESS  */
+  YYSYMBOL_VAR_PRIVATE_DOMAIN = 87,        /* VAR_PRIVATE_DOMAIN  */
+  YYSYMBOL_VAR_REMOTE_CONTROL = 88,        /* VAR_REMOTE_CONTROL  */
+  YYSYMBOL_VAR_CONTROL_ENABLE = 89,        /* VAR_CONTROL_ENABLE  */
+  YYSYMBOL_VAR_CONTROL_INTERFACE = 90,     /* VAR_CONTROL_INTERFACE  */
+  YYSYMBOL_VAR_CONTROL_PORT = 91,          /* VAR_CONTROL_PORT  */
+  YYSYMBOL_VAR_SERVER_KEY_FILE = 92,       /* VAR_SERVER_KEY_FILE  */
+  YYSYMBOL_VAR_SERVER_CERT_FILE = 93,      /* VAR_SERVER_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_KEY_FILE = 94,      /* VAR_CONTROL_KEY_FILE  */
+  YYSYMBOL_VAR_CONTROL_CERT_FILE = 95,     /* VAR_CONTROL_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_USE_CERT = 96,      /* VAR_CONTROL_USE_CERT  */
+  YYSYMBOL_VAR_EXTENDED_STATISTICS = 97,   /* VAR_EXTENDED_STATISTICS  */
+  YYSYMBOL_VAR_LOCAL_DATA_PTR = 98,        /* VAR_LOCAL_DATA_PTR  */
+  YYSYMBOL_VAR_JOSTLE_TIMEOUT = 99,        /* VAR_JOSTLE_TIMEOUT  */
+  YYSYMBOL_VAR_STUB_PRIME = 100,           /* VAR_STUB_PRIME  */
+  YYSYMBOL_VAR_UNWANTED_REPLY_THRESHOLD = 101, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+  YYSYMBOL_VAR_LOG_TIME_ASCII = 102,       /* VAR_LOG_TIME_ASCII  */
+  YYSYMBOL_VAR_DOMAIN_INSECURE = 103,      /* VAR_DOMAIN_INSECURE  */
+  YYSYMBOL_VAR_PYTHON = 104,               /* VAR_PYTHON  */
+  YYSYMBOL_VAR_PYTHON_SCRIPT = 105,        /* VAR_PYTHON_SCRIPT  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MIN = 106,     /* VAR_VAL_SIG_SKEW_MIN  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MAX = 107,     /* VAR_VAL_SIG_SKEW_MAX  */
+  YYSYMBOL_VAR_CACHE_MIN_TTL = 108,        /* VAR_CACHE_MIN_TTL  */
+  YYSYMBOL_VAR_VAL_LOG_LEVEL = 109,        /* VAR_VAL_LOG_LEVEL  */
+  YYSYMBOL_VAR_AUTO_TRUST_ANCHOR_FILE = 110, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_KEEP_MISSING = 111,         /* VAR_KEEP_MISSING  */
+  YYSYMBOL_VAR_ADD_HOLDDOWN = 112,         /* VAR_ADD_HOLDDOWN  */
+  YYSYMBOL_VAR_DEL_HOLDDOWN = 113,         /* VAR_DEL_HOLDDOWN  */
+  YYSYMBOL_VAR_SO_RCVBUF = 114,            /* VAR_SO_RCVBUF  */
+  YYSYMBOL_VAR_EDNS_BUFFER_SIZE = 115,     /* VAR_EDNS_BUFFER_SIZE  */
+  YYSYMBOL_VAR_PREFETCH = 116,             /* VAR_PREFETCH  */
+  YYSYMBOL_VAR_PREFETCH_KEY = 117,         /* VAR_PREFETCH_KEY  */
+  YYSYMBOL_VAR_SO_SNDBUF = 118,            /* VAR_SO_SNDBUF  */
+  YYSYMBOL_VAR_SO_REUSEPORT = 119,         /* VAR_SO_REUSEPORT  */
+  YYSYMBOL_VAR_HARDEN_BELOW_NXDOMAIN = 120, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+  YYSYMBOL_VAR_IGNORE_CD_FLAG = 121,       /* VAR_IGNORE_CD_FLAG  */
+  YYSYMBOL_VAR_LOG_QUERIES = 122,          /* VAR_LOG_QUERIES  */
+  YYSYMBOL_VAR_TCP_UPSTREAM = 123,         /* VAR_TCP_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_UPSTREAM = 124,         /* VAR_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_SERVICE_KEY = 125,      /* VAR_SSL_SERVICE_KEY  */
+  YYSYMBOL_VAR_SSL_SERVICE_PEM = 126,      /* VAR_SSL_SERVICE_PEM  */
+  YYSYMBOL_VAR_SSL_PORT = 127,             /* VAR_SSL_PORT  */
+  YYSYMBOL_VAR_FORWARD_FIRST = 128,        /* VAR_FORWARD_FIRST  */
+  YYSYMBOL_VAR_STUB_FIRST = 129,           /* VAR_STUB_FIRST  */
+  YYSYMBOL_VAR_MINIMAL_RESPONSES = 130,    /* VAR_MINIMAL_RESPONSES  */
+  YYSYMBOL_VAR_RRSET_ROUNDROBIN = 131,     /* VAR_RRSET_ROUNDROBIN  */
+  YYSYMBOL_VAR_MAX_UDP_SIZE = 132,         /* VAR_MAX_UDP_SIZE  */
+  YYSYMBOL_VAR_DELAY_CLOSE = 133,          /* VAR_DELAY_CLOSE  */
+  YYSYMBOL_VAR_UNBLOCK_LAN_ZONES = 134,    /* VAR_UNBLOCK_LAN_ZONES  */
+  YYSYMBOL_VAR_INFRA_CACHE_MIN_RTT = 135,  /* VAR_INFRA_CACHE_MIN_RTT  */
+  YYSYMBOL_VAR_DNS64_PREFIX = 136,         /* VAR_DNS64_PREFIX  */
+  YYSYMBOL_VAR_DNS64_SYNTHALL = 137,       /* VAR_DNS64_SYNTHALL  */
+  YYSYMBOL_VAR_DNSTAP = 138,               /* VAR_DNSTAP  */
+  YYSYMBOL_VAR_DNSTAP_ENABLE = 139,        /* VAR_DNSTAP_ENABLE  */
+  YYSYMBOL_VAR_DNSTAP_SOCKET_PATH = 140,   /* VAR_DNSTAP_SOCKET_PATH  */
+  YYSYMBOL_VAR_DNSTAP_SEND_IDENTITY = 141, /* VAR_DNSTAP_SEND_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_SEND_VERSION = 142,  /* VAR_DNSTAP_SEND_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_IDENTITY = 143,      /* VAR_DNSTAP_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_VERSION = 144,       /* VAR_DNSTAP_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 145, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 146, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 147, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 148, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 149, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 150, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_IP = 151,            /* VAR_DNSTAP_IP  */
+  YYSYMBOL_VAR_DNSTAP_FILE = 152,          /* VAR_DNSTAP_FILE  */
+  YYSYMBOL_VAR_DNSTAP_FILE_ROTATE_SIZE = 153, /* VAR_DNSTAP_FILE_ROTATE_SIZE  */
+  YYSYMBOL_VAR_DNSTAP_FLUSH_SIZE = 154,    /* VAR_DNSTAP_FLUSH_SIZE  */
+  YYSYMBOL_VAR_DNSTAP_FLUSH_TIME = 155,    /* VAR_DNSTAP_FLUSH_TIME  */
+  YYSYMBOL_VAR_DNSTAP_DROP_POLICY = 156,   /* VAR_DNSTAP_DROP_POLICY  */
+  YYSYMBOL_VAR_DNSTAP_HIGH_WATERMARK = 157, /* VAR_DNSTAP_HIGH_WATERMARK  */
+  YYSYMBOL_VAR_DNSTAP_SAMPLE_RATE = 158,   /* VAR_DNSTAP_SAMPLE_RATE  */
+  YYSYMBOL_VAR_HARDEN_ALGO_DOWNGRADE = 159, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+  YYSYMBOL_VAR_IP_TRANSPARENT = 160,       /* VAR_IP_TRANSPARENT  */
+  YYSYMBOL_VAR_RATELIMIT = 161,            /* VAR_RATELIMIT  */
+  YYSYMBOL_VAR_RATELIMIT_SLABS = 162,      /* VAR_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_RATELIMIT_SIZE = 163,       /* VAR_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT_FOR_DOMAIN = 164, /* VAR_RATELIMIT_FOR_DOMAIN  */
+  YYSYMBOL_VAR_RATELIMIT_BELOW_DOMAIN = 165, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+  YYSYMBOL_VAR_RATELIMIT_FACTOR = 166,     /* VAR_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_CAPS_WHITELIST = 167,       /* VAR_CAPS_WHITELIST  */
+  YYSYMBOL_VAR_CACHE_MAX_NEGATIVE_TTL = 168, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+  YYSYMBOL_VAR_UDP_BATCH_SIZE = 169,       /* VAR_UDP_BATCH_SIZE  */
+  YYSYMBOL_VAR_LOCKFREE_CACHE_LOOKUP = 170, /* VAR_LOCKFREE_CACHE_LOOKUP  */
+  YYSYMBOL_VAR_MSG_CACHE_WIRE = 171,       /* VAR_MSG_CACHE_WIRE  */
+  YYSYMBOL_VAR_SO_REUSEPORT_BPF = 172,     /* VAR_SO_REUSEPORT_BPF  */
+  YYSYMBOL_VAR_SO_INCOMING_CPU = 173,      /* VAR_SO_INCOMING_CPU  */
+  YYSYMBOL_VAR_CPU_AFFINITY = 174,         /* VAR_CPU_AFFINITY  */
+  YYSYMBOL_VAR_SERVE_EXPIRED = 175,        /* VAR_SERVE_EXPIRED  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_TTL = 176,    /* VAR_SERVE_EXPIRED_TTL  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_REPLY_TTL = 177, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
+  YYSYMBOL_VAR_AGGRESSIVE_NSEC = 178,      /* VAR_AGGRESSIVE_NSEC  */
+  YYSYMBOL_VAR_TCP_REUSE_TIMEOUT = 179,    /* VAR_TCP_REUSE_TIMEOUT  */
+  YYSYMBOL_VAR_MAX_REUSE_TCP_QUERIES = 180, /* VAR_MAX_REUSE_TCP_QUERIES  */
+  YYSYMBOL_VAR_INCOMING_TCP_PIPELINE = 181, /* VAR_INCOMING_TCP_PIPELINE  */
+  YYSYMBOL_VAR_CACHE_SNAPSHOT_FILE = 182,  /* VAR_CACHE_SNAPSHOT_FILE  */
+  YYSYMBOL_VAR_CACHE_SNAPSHOT_INTERVAL = 183, /* VAR_CACHE_SNAPSHOT_INTERVAL  */
+  YYSYMBOL_VAR_CACHE_OPEN_ADDRESSING = 184, /* VAR_CACHE_OPEN_ADDRESSING  */
+  YYSYMBOL_VAR_CACHE_ADMISSION = 185,      /* VAR_CACHE_ADMISSION  */
+  YYSYMBOL_VAR_HASH_FUNCTION = 186,        /* VAR_HASH_FUNCTION  */
+  YYSYMBOL_VAR_COALESCE_QUERIES = 187,     /* VAR_COALESCE_QUERIES  */
+  YYSYMBOL_VAR_OUTGOING_PORT_POOL = 188,   /* VAR_OUTGOING_PORT_POOL  */
+  YYSYMBOL_VAR_OUTGOING_PORT_LIFETIME = 189, /* VAR_OUTGOING_PORT_LIFETIME  */
+  YYSYMBOL_VAR_HEDGE_QUERY_BUDGET = 190,   /* VAR_HEDGE_QUERY_BUDGET  */
+  YYSYMBOL_VAR_INFRA_RTT_PERCENTILE = 191, /* VAR_INFRA_RTT_PERCENTILE  */
+  YYSYMBOL_YYACCEPT = 192,                 /* $accept  */
+  YYSYMBOL_toplevelvars = 193,             /* toplevelvars  */
+  YYSYMBOL_toplevelvar = 194,              /* toplevelvar  */
+  YYSYMBOL_serverstart = 195,              /* serverstart  */
+  YYSYMBOL_contents_server = 196,          /* contents_server  */
+  YYSYMBOL_content_server = 197,           /* content_server  */
+  YYSYMBOL_stubstart = 198,                /* stubstart  */
+  YYSYMBOL_contents_stub = 199,            /* contents_stub  */
+  YYSYMBOL_content_stub = 200,             /* content_stub  */
+  YYSYMBOL_forwardstart = 201,             /* forwardstart  */
+  YYSYMBOL_contents_forward = 202,         /* contents_forward  */
+  YYSYMBOL_content_forward = 203,          /* content_forward  */
+  YYSYMBOL_server_num_threads = 204,       /* server_num_threads  */
+  YYSYMBOL_server_verbosity = 205,         /* server_verbosity  */
+  YYSYMBOL_server_statistics_interval = 206, /* server_statistics_interval  */
+  YYSYMBOL_server_statistics_cumulative = 207, /* server_statistics_cumulative  */
+  YYSYMBOL_server_extended_statistics = 208, /* server_extended_statistics  */
+  YYSYMBOL_server_port = 209,              /* server_port  */
+  YYSYMBOL_server_interface = 210,         /* server_interface  */
+  YYSYMBOL_server_outgoing_interface = 211, /* server_outgoing_interface  */
+  YYSYMBOL_server_outgoing_range = 212,    /* server_outgoing_range  */
+  YYSYMBOL_server_outgoing_port_permit = 213, /* server_outgoing_port_permit  */
+  YYSYMBOL_server_outgoing_port_avoid = 214, /* server_outgoing_port_avoid  */
+  YYSYMBOL_server_outgoing_num_tcp = 215,  /* server_outgoing_num_tcp  */
+  YYSYMBOL_server_incoming_num_tcp = 216,  /* server_incoming_num_tcp  */
+  YYSYMBOL_server_incoming_tcp_pipeline = 217, /* server_incoming_tcp_pipeline  */
+  YYSYMBOL_server_tcp_reuse_timeout = 218, /* server_tcp_reuse_timeout  */
+  YYSYMBOL_server_max_reuse_tcp_queries = 219, /* server_max_reuse_tcp_queries  */
+  YYSYMBOL_server_interface_automatic = 220, /* server_interface_automatic  */
+  YYSYMBOL_server_do_ip4 = 221,            /* server_do_ip4  */
+  YYSYMBOL_server_do_ip6 = 222,            /* server_do_ip6  */
+  YYSYMBOL_server_do_udp = 223,            /* server_do_udp  */
+  YYSYMBOL_server_do_tcp = 224,            /* server_do_tcp  */
+  YYSYMBOL_server_tcp_upstream = 225,      /* server_tcp_upstream  */
+  YYSYMBOL_server_ssl_upstream = 226,      /* server_ssl_upstream  */
+  YYSYMBOL_server_ssl_service_key = 227,   /* server_ssl_service_key  */
+  YYSYMBOL_server_ssl_service_pem = 228,   /* server_ssl_service_pem  */
+  YYSYMBOL_server_ssl_port = 229,          /* server_ssl_port  */
+  YYSYMBOL_server_do_daemonize = 230,      /* server_do_daemonize  */
+  YYSYMBOL_server_use_syslog = 231,        /* server_use_syslog  */
+  YYSYMBOL_server_log_time_ascii = 232,    /* server_log_time_ascii  */
+  YYSYMBOL_server_log_queries = 233,       /* server_log_queries  */
+  YYSYMBOL_server_chroot = 234,            /* server_chroot  */
+  YYSYMBOL_server_username = 235,          /* server_username  */
+  YYSYMBOL_server_directory = 236,         /* server_directory  */
+  YYSYMBOL_server_logfile = 237,           /* server_logfile  */
+  YYSYMBOL_server_pidfile = 238,           /* server_pidfile  */
+  YYSYMBOL_server_root_hints = 239,        /* server_root_hints  */
+  YYSYMBOL_server_dlv_anchor_file = 240,   /* server_dlv_anchor_file  */
+  YYSYMBOL_server_dlv_anchor = 241,        /* server_dlv_anchor  */
+  YYSYMBOL_server_auto_trust_anchor_file = 242, /* server_auto_trust_anchor_file  */
+  YYSYMBOL_server_trust_anchor_file = 243, /* server_trust_anchor_file  */
+  YYSYMBOL_server_trusted_keys_file = 244, /* server_trusted_keys_file  */
+  YYSYMBOL_server_trust_anchor = 245,      /* server_trust_anchor  */
+  YYSYMBOL_server_domain_insecure = 246,   /* server_domain_insecure  */
+  YYSYMBOL_server_hide_identity = 247,     /* server_hide_identity  */
+  YYSYMBOL_server_hide_version = 248,      /* server_hide_version  */
+  YYSYMBOL_server_identity = 249,          /* server_identity  */
+  YYSYMBOL_server_version = 250,           /* server_version  */
+  YYSYMBOL_server_so_rcvbuf = 251,         /* server_so_rcvbuf  */
+  YYSYMBOL_server_so_sndbuf = 252,         /* server_so_sndbuf  */
+  YYSYMBOL_server_so_reuseport = 253,      /* server_so_reuseport  */
+  YYSYMBOL_server_so_reuseport_bpf = 254,  /* server_so_reuseport_bpf  */
+  YYSYMBOL_server_so_incoming_cpu = 255,   /* server_so_incoming_cpu  */
+  YYSYMBOL_server_cpu_affinity = 256,      /* server_cpu_affinity  */
+  YYSYMBOL_server_udp_batch_size = 257,    /* server_udp_batch_size  */
+  YYSYMBOL_server_ip_transparent = 258,    /* server_ip_transparent  */
+  YYSYMBOL_server_edns_buffer_size = 259,  /* server_edns_buffer_size  */
+  YYSYMBOL_server_msg_buffer_size = 260,   /* server_msg_buffer_size  */
+  YYSYMBOL_server_msg_cache_size = 261,    /* server_msg_cache_size  */
+  YYSYMBOL_server_msg_cache_slabs = 262,   /* server_msg_cache_slabs  */
+  YYSYMBOL_server_cache_open_addressing = 263, /* server_cache_open_addressing  */
+  YYSYMBOL_server_cache_admission = 264,   /* server_cache_admission  */
+  YYSYMBOL_server_hash_function = 265,     /* server_hash_function  */
+  YYSYMBOL_server_outgoing_port_pool = 266, /* server_outgoing_port_pool  */
+  YYSYMBOL_server_outgoing_port_lifetime = 267, /* server_outgoing_port_lifetime  */
+  YYSYMBOL_server_infra_rtt_percentile = 268, /* server_infra_rtt_percentile  */
+  YYSYMBOL_server_hedge_query_budget = 269, /* server_hedge_query_budget  */
+  YYSYMBOL_server_coalesce_queries = 270,  /* server_coalesce_queries  */
+  YYSYMBOL_server_lockfree_cache_lookup = 271, /* server_lockfree_cache_lookup  */
+  YYSYMBOL_server_msg_cache_wire = 272,    /* server_msg_cache_wire  */
+  YYSYMBOL_server_num_queries_per_thread = 273, /* server_num_queries_per_thread  */
+  YYSYMBOL_server_jostle_timeout = 274,    /* server_jostle_timeout  */
+  YYSYMBOL_server_delay_close = 275,       /* server_delay_close  */
+  YYSYMBOL_server_unblock_lan_zones = 276, /* server_unblock_lan_zones  */
+  YYSYMBOL_server_rrset_cache_size = 277,  /* server_rrset_cache_size  */
+  YYSYMBOL_server_rrset_cache_slabs = 278, /* server_rrset_cache_slabs  */
+  YYSYMBOL_server_infra_host_ttl = 279,    /* server_infra_host_ttl  */
+  YYSYMBOL_server_infra_lame_ttl = 280,    /* server_infra_lame_ttl  */
+  YYSYMBOL_server_infra_cache_numhosts = 281, /* server_infra_cache_numhosts  */
+  YYSYMBOL_server_infra_cache_lame_size = 282, /* server_infra_cache_lame_size  */
+  YYSYMBOL_server_infra_cache_slabs = 283, /* server_infra_cache_slabs  */
+  YYSYMBOL_server_infra_cache_min_rtt = 284, /* server_infra_cache_min_rtt  */
+  YYSYMBOL_server_target_fetch_policy = 285, /* server_target_fetch_policy  */
+  YYSYMBOL_server_harden_short_bufsize = 286, /* server_harden_short_bufsize  */
+  YYSYMBOL_server_harden_large_queries = 287, /* server_harden_large_queries  */
+  YYSYMBOL_server_harden_glue = 288,       /* server_harden_glue  */
+  YYSYMBOL_server_harden_dnssec_stripped = 289, /* server_harden_dnssec_stripped  */
+  YYSYMBOL_server_harden_below_nxdomain = 290, /* server_harden_below_nxdomain  */
+  YYSYMBOL_server_harden_referral_path = 291, /* server_harden_referral_path  */
+  YYSYMBOL_server_harden_algo_downgrade = 292, /* server_harden_algo_downgrade  */
+  YYSYMBOL_server_use_caps_for_id = 293,   /* server_use_caps_for_id  */
+  YYSYMBOL_server_caps_whitelist = 294,    /* server_caps_whitelist  */
+  YYSYMBOL_server_private_address = 295,   /* server_private_address  */
+  YYSYMBOL_server_private_domain = 296,    /* server_private_domain  */
+  YYSYMBOL_server_prefetch = 297,          /* server_prefetch  */
+  YYSYMBOL_server_prefetch_key = 298,      /* server_prefetch_key  */
+  YYSYMBOL_server_serve_expired = 299,     /* server_serve_expired  */
+  YYSYMBOL_server_serve_expired_ttl = 300, /* server_serve_expired_ttl  */
+  YYSYMBOL_server_serve_expired_reply_ttl = 301, /* server_serve_expired_reply_ttl  */
+  YYSYMBOL_server_cache_snapshot_file = 302, /* server_cache_snapshot_file  */
+  YYSYMBOL_server_cache_snapshot_interval = 303, /* server_cache_snapshot_interval  */
+  YYSYMBOL_server_unwanted_reply_threshold = 304, /* server_unwanted_reply_threshold  */
+  YYSYMBOL_server_do_not_query_address = 305, /* server_do_not_query_address  */
+  YYSYMBOL_server_do_not_query_localhost = 306, /* server_do_not_query_localhost  */
+  YYSYMBOL_server_access_control = 307,    /* server_access_control  */
+  YYSYMBOL_server_module_conf = 308,       /* server_module_conf  */
+  YYSYMBOL_server_val_override_date = 309, /* server_val_override_date  */
+  YYSYMBOL_server_val_sig_skew_min = 310,  /* server_val_sig_skew_min  */
+  YYSYMBOL_server_val_sig_skew_max = 311,  /* server_val_sig_skew_max  */
+  YYSYMBOL_server_cache_max_ttl = 312,     /* server_cache_max_ttl  */
+  YYSYMBOL_server_cache_max_negative_ttl = 313, /* server_cache_max_negative_ttl  */
+  YYSYMBOL_server_cache_min_ttl = 314,     /* server_cache_min_ttl  */
+  YYSYMBOL_server_bogus_ttl = 315,         /* server_bogus_ttl  */
+  YYSYMBOL_server_val_clean_additional = 316, /* server_val_clean_additional  */
+  YYSYMBOL_server_val_permissive_mode = 317, /* server_val_permissive_mode  */
+  YYSYMBOL_server_ignore_cd_flag = 318,    /* server_ignore_cd_flag  */
+  YYSYMBOL_server_val_log_level = 319,     /* server_val_log_level  */
+  YYSYMBOL_server_val_nsec3_keysize_iterations = 320, /* server_val_nsec3_keysize_iterations  */
+  YYSYMBOL_server_add_holddown = 321,      /* server_add_holddown  */
+  YYSYMBOL_server_del_holddown = 322,      /* server_del_holddown  */
+  YYSYMBOL_server_keep_missing = 323,      /* server_keep_missing  */
+  YYSYMBOL_server_key_cache_size = 324,    /* server_key_cache_size  */
+  YYSYMBOL_server_key_cache_slabs = 325,   /* server_key_cache_slabs  */
+  YYSYMBOL_server_neg_cache_size = 326,    /* server_neg_cache_size  */
+  YYSYMBOL_server_aggressive_nsec = 327,   /* server_aggressive_nsec  */
+  YYSYMBOL_server_local_zone = 328,        /* server_local_zone  */
+  YYSYMBOL_server_local_data = 329,        /* server_local_data  */
+  YYSYMBOL_server_local_data_ptr = 330,    /* server_local_data_ptr  */
+  YYSYMBOL_server_minimal_responses = 331, /* server_minimal_responses  */
+  YYSYMBOL_server_rrset_roundrobin = 332,  /* server_rrset_roundrobin  */
+  YYSYMBOL_server_max_udp_size = 333,      /* server_max_udp_size  */
+  YYSYMBOL_server_dns64_prefix = 334,      /* server_dns64_prefix  */
+  YYSYMBOL_server_dns64_synthall = 335,    /* server_dns64_synthall  */
+  YYSYMBOL_server_ratelimit = 336,         /* server_ratelimit  */
+  YYSYMBOL_server_ratelimit_size = 337,    /* server_ratelimit_size  */
+  YYSYMBOL_server_ratelimit_slabs = 338,   /* server_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_for_domain = 339, /* server_ratelimit_for_domain  */
+  YYSYMBOL_server_ratelimit_below_domain = 340, /* server_ratelimit_below_domain  */
+  YYSYMBOL_server_ratelimit_factor = 341,  /* server_ratelimit_factor  */
+  YYSYMBOL_stub_name = 342,                /* stub_name  */
+  YYSYMBOL_stub_host = 343,                /* stub_host  */
+  YYSYMBOL_stub_addr = 344,                /* stub_addr  */
+  YYSYMBOL_stub_first = 345,               /* stub_first  */
+  YYSYMBOL_stub_prime = 346,               /* stub_prime  */
+  YYSYMBOL_forward_name = 347,             /* forward_name  */
+  YYSYMBOL_forward_host = 348,             /* forward_host  */
+  YYSYMBOL_forward_addr = 349,             /* forward_addr  */
+  YYSYMBOL_forward_first = 350,            /* forward_first  */
+  YYSYMBOL_rcstart = 351,                  /* rcstart  */
+  YYSYMBOL_contents_rc = 352,              /* contents_rc  */
+  YYSYMBOL_content_rc = 353,               /* content_rc  */
+  YYSYMBOL_rc_control_enable = 354,        /* rc_control_enable  */
+  YYSYMBOL_rc_control_port = 355,          /* rc_control_port  */
+  YYSYMBOL_rc_control_interface = 356,     /* rc_control_interface  */
+  YYSYMBOL_rc_control_use_cert = 357,      /* rc_control_use_cert  */
+  YYSYMBOL_rc_server_key_file = 358,       /* rc_server_key_file  */
+  YYSYMBOL_rc_server_cert_file = 359,      /* rc_server_cert_file  */
+  YYSYMBOL_rc_control_key_file = 360,      /* rc_control_key_file  */
+  YYSYMBOL_rc_control_cert_file = 361,     /* rc_control_cert_file  */
+  YYSYMBOL_dtstart = 362,                  /* dtstart  */
+  YYSYMBOL_contents_dt = 363,              /* contents_dt  */
+  YYSYMBOL_content_dt = 364,               /* content_dt  */
+  YYSYMBOL_dt_dnstap_enable = 365,         /* dt_dnstap_enable  */
+  YYSYMBOL_dt_dnstap_socket_path = 366,    /* dt_dnstap_socket_path  */
+  YYSYMBOL_dt_dnstap_ip = 367,             /* dt_dnstap_ip  */
+  YYSYMBOL_dt_dnstap_file = 368,           /* dt_dnstap_file  */
+  YYSYMBOL_dt_dnstap_file_rotate_size = 369, /* dt_dnstap_file_rotate_size  */
+  YYSYMBOL_dt_dnstap_flush_size = 370,     /* dt_dnstap_flush_size  */
+  YYSYMBOL_dt_dnstap_flush_time = 371,     /* dt_dnstap_flush_time  */
+  YYSYMBOL_dt_dnstap_drop_policy = 372,    /* dt_dnstap_drop_policy  */
+  YYSYMBOL_dt_dnstap_high_watermark = 373, /* dt_dnstap_high_watermark  */
+  YYSYMBOL_dt_dnstap_sample_rate = 374,    /* dt_dnstap_sample_rate  */
+  YYSYMBOL_dt_dnstap_send_identity = 375,  /* dt_dnstap_send_identity  */
+  YYSYMBOL_dt_dnstap_send_version = 376,   /* dt_dnstap_send_version  */
+  YYSYMBOL_dt_dnstap_identity = 377,       /* dt_dnstap_identity  */
+  YYSYMBOL_dt_dnstap_version = 378,        /* dt_dnstap_version  */
+  YYSYMBOL_dt_dnstap_log_resolver_query_messages = 379, /* dt_dnstap_log_resolver_query_messages  */
+  YYSYMBOL_dt_dnstap_log_resolver_response_messages = 380, /* dt_dnstap_log_resolver_response_messages  */
+  YYSYMBOL_dt_dnstap_log_client_query_messages = 381, /* dt_dnstap_log_client_query_messages  */
+  YYSYMBOL_dt_dnstap_log_client_response_messages = 382, /* dt_dnstap_log_client_response_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_query_messages = 383, /* dt_dnstap_log_forwarder_query_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_response_messages = 384, /* dt_dnstap_log_forwarder_response_messages  */
+  YYSYMBOL_pythonstart = 385,              /* pythonstart  */
+  YYSYMBOL_contents_py = 386,              /* contents_py  */
+  YYSYMBOL_content_py = 387,               /* content_py  */
+  YYSYMBOL_py_script = 388                 /* py_script  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* In a future release of Bison, this section will be replaced
-   by #include "configparser.h".  */
-#ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-# define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     SPACE = 258,
-     LETTER = 259,
-     NEWLINE = 260,
-     COMMENT = 261,
-     COLON = 262,
-     ANY = 263,
-     ZONESTR = 264,
-     STRING_ARG = 265,
-     VAR_SERVER = 266,
-     VAR_VERBOSITY = 267,
-     VAR_NUM_THREADS = 268,
-     VAR_PORT = 269,
-     VAR_OUTGOING_RANGE = 270,
-     VAR_INTERFACE = 271,
-     VAR_DO_IP4 = 272,
-     VAR_DO_IP6 = 273,
-     VAR_DO_UDP = 274,
-     VAR_DO_TCP = 275,
-     VAR_CHROOT = 276,
-     VAR_USERNAME = 277,
-     VAR_DIRECTORY = 278,
-     VAR_LOGFILE = 279,
-     VAR_PIDFILE = 280,
-     VAR_MSG_CACHE_SIZE = 281,
-     VAR_MSG_CACHE_SLABS = 282,
-     VAR_NUM_QUERIES_PER_THREAD = 283,
-     VAR_RRSET_CACHE_SIZE = 284,
-     VAR_RRSET_CACHE_SLABS = 285,
-     VAR_OUTGOING_NUM_TCP = 286,
-     VAR_INFRA_HOST_TTL = 287,
-     VAR_INFRA_LAME_TTL = 288,
-     VAR_INFRA_CACHE_SLABS = 289,
-     VAR_INFRA_CACHE_NUMHOSTS = 290,
-     VAR_INFRA_CACHE_LAME_SIZE = 291,
-     VAR_NAME = 292,
-     VAR_STUB_ZONE = 293,
-     VAR_STUB_HOST = 294,
-     VAR_STUB_ADDR = 295,
-     VAR_TARGET_FETCH_POLICY = 296,
-     VAR_HARDEN_SHORT_BUFSIZE = 297,
-     VAR_HARDEN_LARGE_QUERIES = 298,
-     VAR_FORWARD_ZONE = 299,
-     VAR_FORWARD_HOST = 300,
-     VAR_FORWARD_ADDR = 301,
-     VAR_DO_NOT_QUERY_ADDRESS = 302,
-     VAR_HIDE_IDENTITY = 303,
-     VAR_HIDE_VERSION = 304,
-     VAR_IDENTITY = 305,
-     VAR_VERSION = 306,
-     VAR_HARDEN_GLUE = 307,
-     VAR_MODULE_CONF = 308,
-     VAR_TRUST_ANCHOR_FILE = 309,
-     VAR_TRUST_ANCHOR = 310,
-     VAR_VAL_OVERRIDE_DATE = 311,
-     VAR_BOGUS_TTL = 312,
-     VAR_VAL_CLEAN_ADDITIONAL = 313,
-     VAR_VAL_PERMISSIVE_MODE = 314,
-     VAR_INCOMING_NUM_TCP = 315,
-     VAR_MSG_BUFFER_SIZE = 316,
-     VAR_KEY_CACHE_SIZE = 317,
-     VAR_KEY_CACHE_SLABS = 318,
-     VAR_TRUSTED_KEYS_FILE = 319,
-     VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 320,
-     VAR_USE_SYSLOG = 321,
-     VAR_OUTGOING_INTERFACE = 322,
-     VAR_ROOT_HINTS = 323,
-     VAR_DO_NOT_QUERY_LOCALHOST = 324,
-     VAR_CACHE_MAX_TTL = 325,
-     VAR_HARDEN_DNSSEC_STRIPPED = 326,
-     VAR_ACCESS_CONTROL = 327,
-     VAR_LOCAL_ZONE = 328,
-     VAR_LOCAL_DATA = 329,
-     VAR_INTERFACE_AUTOMATIC = 330,
-     VAR_STATISTICS_INTERVAL = 331,
-     VAR_DO_DAEMONIZE = 332,
-     VAR_USE_CAPS_FOR_ID = 333,
-     VAR_STATISTICS_CUMULATIVE = 334,
-     VAR_OUTGOING_PORT_PERMIT = 335,
-     VAR_OUTGOING_PORT_AVOID = 336,
-     VAR_DLV_ANCHOR_FILE = 337,
-     VAR_DLV_ANCHOR = 338,
-     VAR_NEG_CACHE_SIZE = 339,
-     VAR_HARDEN_REFERRAL_PATH = 340,
-     VAR_PRIVATE_ADDRESS = 341,
-     VAR_PRIVATE_DOMAIN = 342,
-     VAR_REMOTE_CONTROL = 343,
-     VAR_CONTROL_ENABLE = 344,
-     VAR_CONTROL_INTERFACE = 345,
-     VAR_CONTROL_PORT = 346,
-     VAR_SERVER_KEY_FILE = 347,
-     VAR_SERVER_CERT_FILE = 348,
-     VAR_CONTROL_KEY_FILE = 349,
-     VAR_CONTROL_CERT_FILE = 350,
-     VAR_CONTROL_USE_CERT = 351,
-     VAR_EXTENDED_STATISTICS = 352,
-     VAR_LOCAL_DATA_PTR = 353,
-     VAR_JOSTLE_TIMEOUT = 354,
-     VAR_STUB_PRIME = 355,
-     VAR_UNWANTED_REPLY_THRESHOLD = 356,
-     VAR_LOG_TIME_ASCII = 357,
-     VAR_DOMAIN_INSECURE = 358,
-     VAR_PYTHON = 359,
-     VAR_PYTHON_SCRIPT = 360,
-     VAR_VAL_SIG_SKEW_MIN = 361,
-     VAR_VAL_SIG_SKEW_MAX = 362,
-     VAR_CACHE_MIN_TTL = 363,
-     VAR_VAL_LOG_LEVEL = 364,
-     VAR_AUTO_TRUST_ANCHOR_FILE = 365,
-     VAR_KEEP_MISSING = 366,
-     VAR_ADD_HOLDDOWN = 367,
-     VAR_DEL_HOLDDOWN = 368,
-     VAR_SO_RCVBUF = 369,
-     VAR_EDNS_BUFFER_SIZE = 370,
-     VAR_PREFETCH = 371,
-     VAR_PREFETCH_KEY = 372,
-     VAR_SO_SNDBUF = 373,
-     VAR_SO_REUSEPORT = 374,
-     VAR_HARDEN_BELOW_NXDOMAIN = 375,
-     VAR_IGNORE_CD_FLAG = 376,
-     VAR_LOG_QUERIES = 377,
-     VAR_TCP_UPSTREAM = 378,
-     VAR_SSL_UPSTREAM = 379,
-     VAR_SSL_SERVICE_KEY = 380,
-     VAR_SSL_SERVICE_PEM = 381,
-     VAR_SSL_PORT = 382,
-     VAR_FORWARD_FIRST = 383,
-     VAR_STUB_FIRST = 384,
-     VAR_MINIMAL_RESPONSES = 385,
-     VAR_RRSET_ROUNDROBIN = 386,
-     VAR_MAX_UDP_SIZE = 387,
-     VAR_DELAY_CLOSE = 388,
-     VAR_UNBLOCK_LAN_ZONES = 389,
-     VAR_INFRA_CACHE_MIN_RTT = 390,
-     VAR_DNS64_PREFIX = 391,
-     VAR_DNS64_SYNTHALL = 392,
-     VAR_DNSTAP = 393,
-     VAR_DNSTAP_ENABLE = 394,
-     VAR_DNSTAP_SOCKET_PATH = 395,
-     VAR_DNSTAP_SEND_IDENTITY = 396,
-     VAR_DNSTAP_SEND_VERSION = 397,
-     VAR_DNSTAP_IDENTITY = 398,
-     VAR_DNSTAP_VERSION = 399,
-     VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 400,
-     VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 401,
-     VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 402,
-     VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 403,
-     VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 404,
-     VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 405,
-     VAR_HARDEN_ALGO_DOWNGRADE = 406,
-     VAR_IP_TRANSPARENT = 407,
-     VAR_RATELIMIT = 408,
-     VAR_RATELIMIT_SLABS = 409,
-     VAR_RATELIMIT_SIZE = 410,
-     VAR_RATELIMIT_FOR_DOMAIN = 411,
-     VAR_RATELIMIT_BELOW_DOMAIN = 412,
-     VAR_RATELIMIT_FACTOR = 413,
-     VAR_CAPS_WHITELIST = 414,
-     VAR_CACHE_MAX_NEGATIVE_TTL = 415
-   };
-#endif
-/* Tokens.  */
-#define SPACE 258
-#define LETTER 259
-#define NEWLINE 260
-#define COMMENT 261
-#define COLON 262
-#define ANY 263
-#define ZONESTR 264
-#define STRING_ARG 265
-#define VAR_SERVER 266
-#define VAR_VERBOSITY 267
-#define VAR_NUM_THREADS 268
-#define VAR_PORT 269
-#define VAR_OUTGOING_RANGE 270
-#define VAR_INTERFACE 271
-#define VAR_DO_IP4 272
-#define VAR_DO_IP6 273
-#define VAR_DO_UDP 274
-#define VAR_DO_TCP 275
-#define VAR_CHROOT 276
-#define VAR_USERNAME 277
-#define VAR_DIRECTORY 278
-#define VAR_LOGFILE 279
-#define VAR_PIDFILE 280
-#define VAR_MSG_CACHE_SIZE 281
-#define VAR_MSG_CACHE_SLABS 282
-#define VAR_NUM_QUERIES_PER_THREAD 283
-#define VAR_RRSET_CACHE_SIZE 284
-#define VAR_RRSET_CACHE_SLABS 285
-#define VAR_OUTGOING_NUM_TCP 286
-#define VAR_INFRA_HOST_TTL 287
-#define VAR_INFRA_LAME_TTL 288
-#define VAR_INFRA_CACHE_SLABS 289
-#define VAR_INFRA_CACHE_NUMHOSTS 290
-#define VAR_INFRA_CACHE_LAME_SIZE 291
-#define VAR_NAME 292
-#define VAR_STUB_ZONE 293
-#define VAR_STUB_HOST 294
-#define VAR_STUB_ADDR 295
-#define VAR_TARGET_FETCH_POLICY 296
-#define VAR_HARDEN_SHORT_BUFSIZE 297
-#define VAR_HARDEN_LARGE_QUERIES 298
-#define VAR_FORWARD_ZONE 299
-#define VAR_FORWARD_HOST 300
-#define VAR_FORWARD_ADDR 301
-#define VAR_DO_NOT_QUERY_ADDRESS 302
-#define VAR_HIDE_IDENTITY 303
-#define VAR_HIDE_VERSION 304
-#define VAR_IDENTITY 305
-#define VAR_VERSION 306
-#define VAR_HARDEN_GLUE 307
-#define VAR_MODULE_CONF 308
-#define VAR_TRUST_ANCHOR_FILE 309
-#define VAR_TRUST_ANCHOR 310
-#define VAR_VAL_OVERRIDE_DATE 311
-#define VAR_BOGUS_TTL 312
-#define VAR_VAL_CLEAN_ADDITIONAL 313
-#define VAR_VAL_PERMISSIVE_MODE 314
-#define VAR_INCOMING_NUM_TCP 315
-#define VAR_MSG_BUFFER_SIZE 316
-#define VAR_KEY_CACHE_SIZE 317
-#define VAR_KEY_CACHE_SLABS 318
-#define VAR_TRUSTED_KEYS_FILE 319
-#define VAR_VAL_NSEC3_KEYSIZE_ITERATIONS 320
-#define VAR_USE_SYSLOG 321
-#define VAR_OUTGOING_INTERFACE 322
-#define VAR_ROOT_HINTS 323
-#define VAR_DO_NOT_QUERY_LOCALHOST 324
-#define VAR_CACHE_MAX_TTL 325
-#define VAR_HARDEN_DNSSEC_STRIPPED 326
-#define VAR_ACCESS_CONTROL 327
-#define VAR_LOCAL_ZONE 328
-#define VAR_LOCAL_DATA 329
-#define VAR_INTERFACE_AUTOMATIC 330
-#define VAR_STATISTICS_INTERVAL 331
-#define VAR_DO_DAEMONIZE 332
-#define VAR_USE_CAPS_FOR_ID 333
-#define VAR_STATISTICS_CUMULATIVE 334
-#define VAR_OUTGOING_PORT_PERMIT 335
-#define VAR_OUTGOING_PORT_AVOID 336
-#define VAR_DLV_ANCHOR_FILE 337
-#define VAR_DLV_ANCHOR 338
-#define VAR_NEG_CACHE_SIZE 339
-#define VAR_HARDEN_REFERRAL_PATH 340
-#define VAR_PRIVATE_ADDRESS 341
-#define VAR_PRIVATE_DOMAIN 342
-#define VAR_REMOTE_CONTROL 343
-#define VAR_CONTROL_ENABLE 344
-#define VAR_CONTROL_INTERFACE 345
-#define VAR_CONTROL_PORT 346
-#define VAR_SERVER_KEY_FILE 347
-#define VAR_SERVER_CERT_FILE 348
-#define VAR_CONTROL_KEY_FILE 349
-#define VAR_CONTROL_CERT_FILE 350
-#define VAR_CONTROL_USE_CERT 351
-#define VAR_EXTENDED_STATISTICS 352
-#define VAR_LOCAL_DATA_PTR 353
-#define VAR_JOSTLE_TIMEOUT 354
-#define VAR_STUB_PRIME 355
-#define VAR_UNWANTED_REPLY_THRESHOLD 356
-#define VAR_LOG_TIME_ASCII 357
-#define VAR_DOMAIN_INSECURE 358
-#define VAR_PYTHON 359
-#define VAR_PYTHON_SCRIPT 360
-#define VAR_VAL_SIG_SKEW_MIN 361
-#define VAR_VAL_SIG_SKEW_MAX 362
-#define VAR_CACHE_MIN_TTL 363
-#define VAR_VAL_LOG_LEVEL 364
-#define VAR_AUTO_TRUST_ANCHOR_FILE 365
-#define VAR_KEEP_MISSING 366
-#define VAR_ADD_HOLDDOWN 367
-#define VAR_DEL_HOLDDOWN 368
-#define VAR_SO_RCVBUF 369
-#define VAR_EDNS_BUFFER_SIZE 370
-#define VAR_PREFETCH 371
-#define VAR_PREFETCH_KEY 372
-#define VAR_SO_SNDBUF 373
-#define VAR_SO_REUSEPORT 374
-#define VAR_HARDEN_BELOW_NXDOMAIN 375
-#define VAR_IGNORE_CD_FLAG 376
-#define VAR_LOG_QUERIES 377
-#define VAR_TCP_UPSTREAM 378
-#define VAR_SSL_UPSTREAM 379
-#define VAR_SSL_SERVICE_KEY 380
-#define VAR_SSL_SERVICE_PEM 381
-#define VAR_SSL_PORT 382
-#define VAR_FORWARD_FIRST 383
-#define VAR_STUB_FIRST 384
-#define VAR_MINIMAL_RESPONSES 385
-#define VAR_RRSET_ROUNDROBIN 386
-#define VAR_MAX_UDP_SIZE 387
-#define VAR_DELAY_CLOSE 388
-#define VAR_UNBLOCK_LAN_ZONES 389
-#define VAR_INFRA_CACHE_MIN_RTT 390
-#define VAR_DNS64_PREFIX 391
-#define VAR_DNS64_SYNTHALL 392
-#define VAR_DNSTAP 393
-#define VAR_DNSTAP_ENABLE 394
-#define VAR_DNSTAP_SOCKET_PATH 395
-#define VAR_DNSTAP_SEND_IDENTITY 396
-#define VAR_DNSTAP_SEND_VERSION 397
-#define VAR_DNSTAP_IDENTITY 398
-#define VAR_DNSTAP_VERSION 399
-#define VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES 400
-#define VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES 401
-#define VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES 402
-#define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 403
-#define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 404
-#define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 405
-#define VAR_HARDEN_ALGO_DOWNGRADE 406
-#define VAR_IP_TRANSPARENT 407
-#define VAR_RATELIMIT 408
-#define VAR_RATELIMIT_SLABS 409
-#define VAR_RATELIMIT_SIZE 410
-#define VAR_RATELIMIT_FOR_DOMAIN 411
-#define VAR_RATELIMIT_BELOW_DOMAIN 412
-#define VAR_RATELIMIT_FACTOR 413
-#define VAR_CAPS_WHITELIST 414
-#define VAR_CACHE_MAX_NEGATIVE_TTL 415
-
-
-
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-{
-/* Line 387 of yacc.c  */
-#line 64 "util/configparser.y"
 
-	char*	str;
 
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Line 387 of yacc.c  */
-#line 463 "util/configparser.c"
-} YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-extern YYSTYPE yylval;
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
-int yyparse ();
+typedef signed char yytype_int8;
 #endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-int yyparse ();
+typedef short yytype_int16;
 #endif
-#endif /* ! YYPARSE_PARAM */
-
-#endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
 
-/* Copy the second part of user declarations.  */
-
-/* Line 390 of yacc.c  */
-#line 491 "util/configparser.c"
-
-#ifdef short
-# undef short
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
 typedef unsigned char yytype_uint8;
-#endif
-
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-typedef signed char yytype_int8;
 #else
-typedef short int yytype_int8;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef unsigned short int yytype_uint16;
+typedef int yytype_uint16;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
-#else
-typedef short int yytype_int16;
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -525,16 +610,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -548,32 +645,71 @@ typedef short int yytype_int16;
 # endif
 #endif
 
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(N) (N)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -590,8 +726,7 @@ YYID (yyi)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
       /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
 #     ifndef EXIT_SUCCESS
@@ -603,8 +738,8 @@ YYID (yyi)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -620,7 +755,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -628,40 +763,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -671,16 +803,16 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
@@ -690,16 +822,16 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
-      while (YYID (0))
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -707,25 +839,30 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   301
+#define YYLAST   362
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  161
+#define YYNTOKENS  192
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  166
+#define YYNNTS  197
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  317
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  467
+#define YYNRULES  379
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  560
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   415
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   446
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -769,184 +906,78 @@ static const yytype_uint8 yytranslate[] =
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
      145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     4,     7,    10,    13,    16,    19,    22,
-      25,    27,    30,    31,    33,    35,    37,    39,    41,    43,
-      45,    47,    49,    51,    53,    55,    57,    59,    61,    63,
-      65,    67,    69,    71,    73,    75,    77,    79,    81,    83,
-      85,    87,    89,    91,    93,    95,    97,    99,   101,   103,
-     105,   107,   109,   111,   113,   115,   117,   119,   121,   123,
-     125,   127,   129,   131,   133,   135,   137,   139,   141,   143,
-     145,   147,   149,   151,   153,   155,   157,   159,   161,   163,
-     165,   167,   169,   171,   173,   175,   177,   179,   181,   183,
-     185,   187,   189,   191,   193,   195,   197,   199,   201,   203,
-     205,   207,   209,   211,   213,   215,   217,   219,   221,   223,
-     225,   227,   229,   231,   233,   235,   237,   239,   241,   243,
-     245,   247,   249,   251,   253,   255,   257,   259,   261,   263,
-     266,   267,   269,   271,   273,   275,   277,   279,   282,   283,
-     285,   287,   289,   291,   294,   297,   300,   303,   306,   309,
-     312,   315,   318,   321,   324,   327,   330,   333,   336,   339,
-     342,   345,   348,   351,   354,   357,   360,   363,   366,   369,
-     372,   375,   378,   381,   384,   387,   390,   393,   396,   399,
-     402,   405,   408,   411,   414,   417,   420,   423,   426,   429,
-     432,   435,   438,   441,   444,   447,   450,   453,   456,   459,
-     462,   465,   468,   471,   474,   477,   480,   483,   486,   489,
-     492,   495,   498,   501,   504,   507,   510,   513,   516,   519,
-     522,   525,   528,   531,   534,   538,   541,   544,   547,   550,
-     553,   556,   559,   562,   565,   568,   571,   574,   577,   580,
-     583,   586,   589,   592,   595,   599,   602,   605,   608,   611,
-     614,   617,   620,   623,   626,   629,   633,   637,   640,   643,
-     646,   649,   652,   655,   658,   661,   664,   667,   669,   672,
-     673,   675,   677,   679,   681,   683,   685,   687,   689,   692,
-     695,   698,   701,   704,   707,   710,   713,   715,   718,   719,
-     721,   723,   725,   727,   729,   731,   733,   735,   737,   739,
-     741,   743,   746,   749,   752,   755,   758,   761,   764,   767,
-     770,   773,   776,   779,   781,   784,   785,   787
+       0,   142,   142,   142,   143,   143,   144,   144,   145,   145,
+     149,   154,   155,   156,   156,   156,   157,   157,   158,   158,
+     158,   159,   159,   159,   160,   160,   160,   161,   161,   162,
+     162,   163,   163,   164,   164,   165,   165,   166,   166,   167,
+     167,   168,   168,   169,   169,   169,   170,   170,   170,   171,
+     171,   171,   172,   172,   173,   173,   174,   174,   175,   175,
+     176,   176,   176,   177,   177,   178,   178,   179,   179,   179,
+     180,   180,   181,   181,   182,   182,   183,   183,   183,   184,
+     184,   185,   185,   186,   186,   187,   187,   188,   188,   189,
+     189,   189,   190,   190,   191,   191,   191,   192,   192,   192,
+     193,   193,   193,   194,   194,   194,   195,   195,   195,   196,
+     196,   196,   197,   197,   197,   198,   198,   199,   199,   200,
+     200,   200,   201,   201,   202,   202,   203,   203,   204,   204,
+     205,   205,   206,   206,   206,   207,   207,   208,   208,   209,
+     209,   210,   210,   211,   211,   212,   212,   213,   213,   214,
+     214,   216,   228,   229,   230,   230,   230,   230,   230,   232,
+     244,   245,   246,   246,   246,   246,   248,   257,   266,   277,
+     286,   295,   304,   317,   332,   341,   350,   359,   368,   377,
+     386,   395,   404,   413,   422,   431,   440,   449,   458,   467,
+     474,   481,   490,   499,   513,   522,   531,   538,   545,   552,
+     560,   567,   574,   581,   588,   596,   604,   612,   619,   626,
+     635,   644,   651,   658,   666,   674,   684,   694,   704,   713,
+     724,   734,   747,   758,   766,   779,   789,   799,   811,   822,
+     833,   844,   855,   865,   875,   885,   894,   903,   912,   922,
+     930,   943,   952,   960,   969,   977,   990,   999,  1006,  1016,
+    1026,  1036,  1046,  1056,  1066,  1076,  1086,  1093,  1100,  1107,
+    1116,  1125,  1134,  1143,  1152,  1159,  1168,  1177,  1184,  1194,
+    1211,  1218,  1236,  1249,  1262,  1271,  1280,  1289,  1298,  1308,
+    1318,  1327,  1336,  1343,  1352,  1361,  1370,  1378,  1391,  1399,
+    1409,  1433,  1440,  1455,  1465,  1475,  1482,  1489,  1498,  1507,
+    1515,  1528,  1541,  1554,  1563,  1573,  1580,  1587,  1596,  1606,
+    1616,  1623,  1630,  1639,  1644,  1645,  1646,  1646,  1646,  1647,
+    1647,  1647,  1648,  1648,  1650,  1660,  1669,  1676,  1686,  1693,
+    1700,  1707,  1714,  1719,  1720,  1721,  1721,  1722,  1722,  1722,
+    1723,  1723,  1724,  1724,  1725,  1726,  1726,  1727,  1727,  1728,
+    1729,  1730,  1731,  1732,  1733,  1735,  1743,  1750,  1757,  1764,
+    1773,  1781,  1790,  1804,  1813,  1822,  1830,  1838,  1845,  1852,
+    1861,  1870,  1879,  1888,  1897,  1906,  1911,  1912,  1913,  1915
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     162,     0,    -1,    -1,   162,   163,    -1,   164,   165,    -1,
-     167,   168,    -1,   170,   171,    -1,   323,   324,    -1,   297,
-     298,    -1,   308,   309,    -1,    11,    -1,   165,   166,    -1,
-      -1,   173,    -1,   174,    -1,   178,    -1,   181,    -1,   187,
-      -1,   188,    -1,   189,    -1,   190,    -1,   179,    -1,   200,
-      -1,   201,    -1,   202,    -1,   203,    -1,   204,    -1,   223,
-      -1,   224,    -1,   225,    -1,   229,    -1,   230,    -1,   184,
-      -1,   231,    -1,   232,    -1,   235,    -1,   233,    -1,   234,
-      -1,   237,    -1,   238,    -1,   239,    -1,   252,    -1,   213,
-      -1,   214,    -1,   215,    -1,   216,    -1,   240,    -1,   255,
-      -1,   209,    -1,   211,    -1,   256,    -1,   262,    -1,   263,
-      -1,   264,    -1,   185,    -1,   222,    -1,   271,    -1,   272,
-      -1,   210,    -1,   267,    -1,   197,    -1,   180,    -1,   205,
-      -1,   253,    -1,   259,    -1,   241,    -1,   254,    -1,   274,
-      -1,   275,    -1,   186,    -1,   175,    -1,   196,    -1,   245,
-      -1,   176,    -1,   182,    -1,   183,    -1,   206,    -1,   207,
-      -1,   273,    -1,   243,    -1,   247,    -1,   248,    -1,   177,
-      -1,   276,    -1,   226,    -1,   251,    -1,   198,    -1,   212,
-      -1,   257,    -1,   258,    -1,   261,    -1,   266,    -1,   208,
-      -1,   268,    -1,   269,    -1,   270,    -1,   217,    -1,   221,
-      -1,   249,    -1,   250,    -1,   218,    -1,   242,    -1,   265,
-      -1,   199,    -1,   191,    -1,   192,    -1,   193,    -1,   194,
-      -1,   195,    -1,   277,    -1,   278,    -1,   279,    -1,   219,
-      -1,   227,    -1,   228,    -1,   280,    -1,   281,    -1,   236,
-      -1,   244,    -1,   220,    -1,   282,    -1,   284,    -1,   283,
-      -1,   285,    -1,   286,    -1,   287,    -1,   246,    -1,   260,
-      -1,    38,    -1,   168,   169,    -1,    -1,   288,    -1,   289,
-      -1,   290,    -1,   292,    -1,   291,    -1,    44,    -1,   171,
-     172,    -1,    -1,   293,    -1,   294,    -1,   295,    -1,   296,
-      -1,    13,    10,    -1,    12,    10,    -1,    76,    10,    -1,
-      79,    10,    -1,    97,    10,    -1,    14,    10,    -1,    16,
-      10,    -1,    67,    10,    -1,    15,    10,    -1,    80,    10,
-      -1,    81,    10,    -1,    31,    10,    -1,    60,    10,    -1,
-      75,    10,    -1,    17,    10,    -1,    18,    10,    -1,    19,
-      10,    -1,    20,    10,    -1,   123,    10,    -1,   124,    10,
-      -1,   125,    10,    -1,   126,    10,    -1,   127,    10,    -1,
-      77,    10,    -1,    66,    10,    -1,   102,    10,    -1,   122,
-      10,    -1,    21,    10,    -1,    22,    10,    -1,    23,    10,
-      -1,    24,    10,    -1,    25,    10,    -1,    68,    10,    -1,
-      82,    10,    -1,    83,    10,    -1,   110,    10,    -1,    54,
-      10,    -1,    64,    10,    -1,    55,    10,    -1,   103,    10,
-      -1,    48,    10,    -1,    49,    10,    -1,    50,    10,    -1,
-      51,    10,    -1,   114,    10,    -1,   118,    10,    -1,   119,
-      10,    -1,   152,    10,    -1,   115,    10,    -1,    61,    10,
-      -1,    26,    10,    -1,    27,    10,    -1,    28,    10,    -1,
-      99,    10,    -1,   133,    10,    -1,   134,    10,    -1,    29,
-      10,    -1,    30,    10,    -1,    32,    10,    -1,    33,    10,
-      -1,    35,    10,    -1,    36,    10,    -1,    34,    10,    -1,
-     135,    10,    -1,    41,    10,    -1,    42,    10,    -1,    43,
-      10,    -1,    52,    10,    -1,    71,    10,    -1,   120,    10,
-      -1,    85,    10,    -1,   151,    10,    -1,    78,    10,    -1,
-     159,    10,    -1,    86,    10,    -1,    87,    10,    -1,   116,
-      10,    -1,   117,    10,    -1,   101,    10,    -1,    47,    10,
-      -1,    69,    10,    -1,    72,    10,    10,    -1,    53,    10,
-      -1,    56,    10,    -1,   106,    10,    -1,   107,    10,    -1,
-      70,    10,    -1,   160,    10,    -1,   108,    10,    -1,    57,
-      10,    -1,    58,    10,    -1,    59,    10,    -1,   121,    10,
-      -1,   109,    10,    -1,    65,    10,    -1,   112,    10,    -1,
-     113,    10,    -1,   111,    10,    -1,    62,    10,    -1,    63,
-      10,    -1,    84,    10,    -1,    73,    10,    10,    -1,    74,
-      10,    -1,    98,    10,    -1,   130,    10,    -1,   131,    10,
-      -1,   132,    10,    -1,   136,    10,    -1,   137,    10,    -1,
-     153,    10,    -1,   155,    10,    -1,   154,    10,    -1,   156,
-      10,    10,    -1,   157,    10,    10,    -1,   158,    10,    -1,
-      37,    10,    -1,    39,    10,    -1,    40,    10,    -1,   129,
-      10,    -1,   100,    10,    -1,    37,    10,    -1,    45,    10,
-      -1,    46,    10,    -1,   128,    10,    -1,    88,    -1,   298,
-     299,    -1,    -1,   300,    -1,   302,    -1,   301,    -1,   304,
-      -1,   305,    -1,   306,    -1,   307,    -1,   303,    -1,    89,
-      10,    -1,    91,    10,    -1,    90,    10,    -1,    96,    10,
-      -1,    92,    10,    -1,    93,    10,    -1,    94,    10,    -1,
-      95,    10,    -1,   138,    -1,   309,   310,    -1,    -1,   311,
-      -1,   312,    -1,   313,    -1,   314,    -1,   315,    -1,   316,
-      -1,   317,    -1,   318,    -1,   319,    -1,   320,    -1,   321,
-      -1,   322,    -1,   139,    10,    -1,   140,    10,    -1,   141,
-      10,    -1,   142,    10,    -1,   143,    10,    -1,   144,    10,
-      -1,   145,    10,    -1,   146,    10,    -1,   147,    10,    -1,
-     148,    10,    -1,   149,    10,    -1,   150,    10,    -1,   104,
-      -1,   324,   325,    -1,    -1,   326,    -1,   105,    10,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   127,   127,   127,   128,   128,   129,   129,   130,   130,
-     134,   139,   140,   141,   141,   141,   142,   142,   143,   143,
-     143,   144,   144,   144,   145,   145,   145,   146,   146,   147,
-     147,   148,   148,   149,   149,   150,   150,   151,   151,   152,
-     152,   153,   153,   154,   154,   154,   155,   155,   155,   156,
-     156,   156,   157,   157,   158,   158,   159,   159,   160,   160,
-     161,   161,   161,   162,   162,   163,   163,   164,   164,   164,
-     165,   165,   166,   166,   167,   167,   168,   168,   168,   169,
-     169,   170,   170,   171,   171,   172,   172,   173,   173,   174,
-     174,   174,   175,   175,   176,   176,   176,   177,   177,   177,
-     178,   178,   178,   179,   179,   179,   180,   180,   180,   181,
-     181,   181,   182,   182,   182,   183,   183,   184,   184,   185,
-     185,   185,   186,   186,   187,   187,   188,   188,   190,   202,
-     203,   204,   204,   204,   204,   204,   206,   218,   219,   220,
-     220,   220,   220,   222,   231,   240,   251,   260,   269,   278,
-     291,   306,   315,   324,   333,   342,   351,   360,   369,   378,
-     387,   396,   405,   414,   421,   428,   437,   446,   460,   469,
-     478,   485,   492,   499,   507,   514,   521,   528,   535,   543,
-     551,   559,   566,   573,   582,   591,   598,   605,   613,   621,
-     631,   641,   654,   665,   673,   686,   695,   704,   713,   723,
-     731,   744,   753,   761,   770,   778,   791,   800,   807,   817,
-     827,   837,   847,   857,   867,   877,   887,   894,   901,   908,
-     917,   926,   935,   942,   952,   969,   976,   994,  1007,  1020,
-    1029,  1038,  1047,  1056,  1066,  1076,  1085,  1094,  1101,  1110,
-    1119,  1128,  1136,  1149,  1157,  1181,  1188,  1203,  1213,  1223,
-    1230,  1237,  1246,  1255,  1263,  1276,  1289,  1302,  1311,  1321,
-    1328,  1335,  1344,  1354,  1364,  1371,  1378,  1387,  1392,  1393,
-    1394,  1394,  1394,  1395,  1395,  1395,  1396,  1396,  1398,  1408,
-    1417,  1424,  1434,  1441,  1448,  1455,  1462,  1467,  1468,  1469,
-    1469,  1470,  1470,  1471,  1471,  1472,  1473,  1474,  1475,  1476,
-    1477,  1479,  1487,  1494,  1502,  1510,  1517,  1524,  1533,  1542,
-    1551,  1560,  1569,  1578,  1583,  1584,  1585,  1587
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SPACE", "LETTER", "NEWLINE", "COMMENT",
-  "COLON", "ANY", "ZONESTR", "STRING_ARG", "VAR_SERVER", "VAR_VERBOSITY",
-  "VAR_NUM_THREADS", "VAR_PORT", "VAR_OUTGOING_RANGE", "VAR_INTERFACE",
-  "VAR_DO_IP4", "VAR_DO_IP6", "VAR_DO_UDP", "VAR_DO_TCP", "VAR_CHROOT",
-  "VAR_USERNAME", "VAR_DIRECTORY", "VAR_LOGFILE", "VAR_PIDFILE",
-  "VAR_MSG_CACHE_SIZE", "VAR_MSG_CACHE_SLABS",
-  "VAR_NUM_QUERIES_PER_THREAD", "VAR_RRSET_CACHE_SIZE",
-  "VAR_RRSET_CACHE_SLABS", "VAR_OUTGOING_NUM_TCP", "VAR_INFRA_HOST_TTL",
-  "VAR_INFRA_LAME_TTL", "VAR_INFRA_CACHE_SLABS",
+  "\"end of file\"", "error", "\"invalid token\"", "SPACE", "LETTER",
+  "NEWLINE", "COMMENT", "COLON", "ANY", "ZONESTR", "STRING_ARG",
+  "VAR_SERVER", "VAR_VERBOSITY", "VAR_NUM_THREADS", "VAR_PORT",
+  "VAR_OUTGOING_RANGE", "VAR_INTERFACE", "VAR_DO_IP4", "VAR_DO_IP6",
+  "VAR_DO_UDP", "VAR_DO_TCP", "VAR_CHROOT", "VAR_USERNAME",
+  "VAR_DIRECTORY", "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
+  "VAR_MSG_CACHE_SLABS", "VAR_NUM_QUERIES_PER_THREAD",
+  "VAR_RRSET_CACHE_SIZE", "VAR_RRSET_CACHE_SLABS", "VAR_OUTGOING_NUM_TCP",
+  "VAR_INFRA_HOST_TTL", "VAR_INFRA_LAME_TTL", "VAR_INFRA_CACHE_SLABS",
   "VAR_INFRA_CACHE_NUMHOSTS", "VAR_INFRA_CACHE_LAME_SIZE", "VAR_NAME",
   "VAR_STUB_ZONE", "VAR_STUB_HOST", "VAR_STUB_ADDR",
   "VAR_TARGET_FETCH_POLICY", "VAR_HARDEN_SHORT_BUFSIZE",
@@ -990,11 +1021,25 @@ static const char *const yytname[] =
   "VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES",
   "VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES",
   "VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES",
-  "VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES",
-  "VAR_HARDEN_ALGO_DOWNGRADE", "VAR_IP_TRANSPARENT", "VAR_RATELIMIT",
-  "VAR_RATELIMIT_SLABS", "VAR_RATELIMIT_SIZE", "VAR_RATELIMIT_FOR_DOMAIN",
+  "VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES", "VAR_DNSTAP_IP",
+  "VAR_DNSTAP_FILE", "VAR_DNSTAP_FILE_ROTATE_SIZE",
+  "VAR_DNSTAP_FLUSH_SIZE", "VAR_DNSTAP_FLUSH_TIME",
+  "VAR_DNSTAP_DROP_POLICY", "VAR_DNSTAP_HIGH_WATERMARK",
+  "VAR_DNSTAP_SAMPLE_RATE", "VAR_HARDEN_ALGO_DOWNGRADE",
+  "VAR_IP_TRANSPARENT", "VAR_RATELIMIT", "VAR_RATELIMIT_SLABS",
+  "VAR_RATELIMIT_SIZE", "VAR_RATELIMIT_FOR_DOMAIN",
   "VAR_RATELIMIT_BELOW_DOMAIN", "VAR_RATELIMIT_FACTOR",
-  "VAR_CAPS_WHITELIST", "VAR_CACHE_MAX_NEGATIVE_TTL", "$accept",
+  "VAR_CAPS_WHITELIST", "VAR_CACHE_MAX_NEGATIVE_TTL", "VAR_UDP_BATCH_SIZE",
+  "VAR_LOCKFREE_CACHE_LOOKUP", "VAR_MSG_CACHE_WIRE",
+  "VAR_SO_REUSEPORT_BPF", "VAR_SO_INCOMING_CPU", "VAR_CPU_AFFINITY",
+  "VAR_SERVE_EXPIRED", "VAR_SERVE_EXPIRED_TTL",
+  "VAR_SERVE_EXPIRED_REPLY_TTL", "VAR_AGGRESSIVE_NSEC",
+  "VAR_TCP_REUSE_TIMEOUT", "VAR_MAX_REUSE_TCP_QUERIES",
+  "VAR_INCOMING_TCP_PIPELINE", "VAR_CACHE_SNAPSHOT_FILE",
+  "VAR_CACHE_SNAPSHOT_INTERVAL", "VAR_CACHE_OPEN_ADDRESSING",
+  "VAR_CACHE_ADMISSION", "VAR_HASH_FUNCTION", "VAR_COALESCE_QUERIES",
+  "VAR_OUTGOING_PORT_POOL", "VAR_OUTGOING_PORT_LIFETIME",
+  "VAR_HEDGE_QUERY_BUDGET", "VAR_INFRA_RTT_PERCENTILE", "$accept",
   "toplevelvars", "toplevelvar", "serverstart", "contents_server",
   "content_server", "stubstart", "contents_stub", "content_stub",
   "forwardstart", "contents_forward", "content_forward",
@@ -1003,8 +1048,10 @@ static const char *const yytname[] =
   "server_port", "server_interface", "server_outgoing_interface",
   "server_outgoing_range", "server_outgoing_port_permit",
   "server_outgoing_port_avoid", "server_outgoing_num_tcp",
-  "server_incoming_num_tcp", "server_interface_automatic", "server_do_ip4",
-  "server_do_ip6", "server_do_udp", "server_do_tcp", "server_tcp_upstream",
+  "server_incoming_num_tcp", "server_incoming_tcp_pipeline",
+  "server_tcp_reuse_timeout", "server_max_reuse_tcp_queries",
+  "server_interface_automatic", "server_do_ip4", "server_do_ip6",
+  "server_do_udp", "server_do_tcp", "server_tcp_upstream",
   "server_ssl_upstream", "server_ssl_service_key",
   "server_ssl_service_pem", "server_ssl_port", "server_do_daemonize",
   "server_use_syslog", "server_log_time_ascii", "server_log_queries",
@@ -1015,21 +1062,30 @@ static const char *const yytname[] =
   "server_trust_anchor", "server_domain_insecure", "server_hide_identity",
   "server_hide_version", "server_identity", "server_version",
   "server_so_rcvbuf", "server_so_sndbuf", "server_so_reuseport",
-  "server_ip_transparent", "server_edns_buffer_size",
-  "server_msg_buffer_size", "server_msg_cache_size",
-  "server_msg_cache_slabs", "server_num_queries_per_thread",
-  "server_jostle_timeout", "server_delay_close",
-  "server_unblock_lan_zones", "server_rrset_cache_size",
-  "server_rrset_cache_slabs", "server_infra_host_ttl",
-  "server_infra_lame_ttl", "server_infra_cache_numhosts",
-  "server_infra_cache_lame_size", "server_infra_cache_slabs",
-  "server_infra_cache_min_rtt", "server_target_fetch_policy",
-  "server_harden_short_bufsize", "server_harden_large_queries",
-  "server_harden_glue", "server_harden_dnssec_stripped",
-  "server_harden_below_nxdomain", "server_harden_referral_path",
-  "server_harden_algo_downgrade", "server_use_caps_for_id",
-  "server_caps_whitelist", "server_private_address",
-  "server_private_domain", "server_prefetch", "server_prefetch_key",
+  "server_so_reuseport_bpf", "server_so_incoming_cpu",
+  "server_cpu_affinity", "server_udp_batch_size", "server_ip_transparent",
+  "server_edns_buffer_size", "server_msg_buffer_size",
+  "server_msg_cache_size", "server_msg_cache_slabs",
+  "server_cache_open_addressing", "server_cache_admission",
+  "server_hash_function", "server_outgoing_port_pool",
+  "server_outgoing_port_lifetime", "server_infra_rtt_percentile",
+  "server_hedge_query_budget", "server_coalesce_queries",
+  "server_lockfree_cache_lookup", "server_msg_cache_wire",
+  "server_num_queries_per_thread", "server_jostle_timeout",
+  "server_delay_close", "server_unblock_lan_zones",
+  "server_rrset_cache_size", "server_rrset_cache_slabs",
+  "server_infra_host_ttl", "server_infra_lame_ttl",
+  "server_infra_cache_numhosts", "server_infra_cache_lame_size",
+  "server_infra_cache_slabs", "server_infra_cache_min_rtt",
+  "server_target_fetch_policy", "server_harden_short_bufsize",
+  "server_harden_large_queries", "server_harden_glue",
+  "server_harden_dnssec_stripped", "server_harden_below_nxdomain",
+  "server_harden_referral_path", "server_harden_algo_downgrade",
+  "server_use_caps_for_id", "server_caps_whitelist",
+  "server_private_address", "server_private_domain", "server_prefetch",
+  "server_prefetch_key", "server_serve_expired",
+  "server_serve_expired_ttl", "server_serve_expired_reply_ttl",
+  "server_cache_snapshot_file", "server_cache_snapshot_interval",
   "server_unwanted_reply_threshold", "server_do_not_query_address",
   "server_do_not_query_localhost", "server_access_control",
   "server_module_conf", "server_val_override_date",
@@ -1040,8 +1096,9 @@ static const char *const yytname[] =
   "server_ignore_cd_flag", "server_val_log_level",
   "server_val_nsec3_keysize_iterations", "server_add_holddown",
   "server_del_holddown", "server_keep_missing", "server_key_cache_size",
-  "server_key_cache_slabs", "server_neg_cache_size", "server_local_zone",
-  "server_local_data", "server_local_data_ptr", "server_minimal_responses",
+  "server_key_cache_slabs", "server_neg_cache_size",
+  "server_aggressive_nsec", "server_local_zone", "server_local_data",
+  "server_local_data_ptr", "server_minimal_responses",
   "server_rrset_roundrobin", "server_max_udp_size", "server_dns64_prefix",
   "server_dns64_synthall", "server_ratelimit", "server_ratelimit_size",
   "server_ratelimit_slabs", "server_ratelimit_for_domain",
@@ -1052,212 +1109,58 @@ static const char *const yytname[] =
   "rc_control_interface", "rc_control_use_cert", "rc_server_key_file",
   "rc_server_cert_file", "rc_control_key_file", "rc_control_cert_file",
   "dtstart", "contents_dt", "content_dt", "dt_dnstap_enable",
-  "dt_dnstap_socket_path", "dt_dnstap_send_identity",
-  "dt_dnstap_send_version", "dt_dnstap_identity", "dt_dnstap_version",
+  "dt_dnstap_socket_path", "dt_dnstap_ip", "dt_dnstap_file",
+  "dt_dnstap_file_rotate_size", "dt_dnstap_flush_size",
+  "dt_dnstap_flush_time", "dt_dnstap_drop_policy",
+  "dt_dnstap_high_watermark", "dt_dnstap_sample_rate",
+  "dt_dnstap_send_identity", "dt_dnstap_send_version",
+  "dt_dnstap_identity", "dt_dnstap_version",
   "dt_dnstap_log_resolver_query_messages",
   "dt_dnstap_log_resolver_response_messages",
   "dt_dnstap_log_client_query_messages",
   "dt_dnstap_log_client_response_messages",
   "dt_dnstap_log_forwarder_query_messages",
   "dt_dnstap_log_forwarder_response_messages", "pythonstart",
-  "contents_py", "content_py", "py_script", YY_NULL
+  "contents_py", "content_py", "py_script", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
-{
-       0,   161,   162,   162,   163,   163,   163,   163,   163,   163,
-     164,   165,   165,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-     166,   166,   166,   166,   166,   166,   166,   166,   167,   168,
-     168,   169,   169,   169,   169,   169,   170,   171,   171,   172,
-     172,   172,   172,   173,   174,   175,   176,   177,   178,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
-     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
-     220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
-     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
-     260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
-     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
-     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
-     290,   291,   292,   293,   294,   295,   296,   297,   298,   298,
-     299,   299,   299,   299,   299,   299,   299,   299,   300,   301,
-     302,   303,   304,   305,   306,   307,   308,   309,   309,   310,
-     310,   310,   310,   310,   310,   310,   310,   310,   310,   310,
-     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
-     320,   321,   322,   323,   324,   324,   325,   326
-};
+#define YYPACT_NINF (-81)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
-       1,     2,     0,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
-       0,     1,     1,     1,     1,     1,     1,     2,     0,     1,
-       1,     1,     1,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     3,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     3,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     3,     3,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     1,     2,     0,
-       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     0,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     1,     2,     0,     1,     2
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint16 yydefact[] =
-{
-       2,     0,     1,    10,   128,   136,   267,   313,   286,     3,
-      12,   130,   138,   269,   288,   315,     4,     5,     6,     8,
-       9,     7,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    11,    13,    14,
-      70,    73,    82,    15,    21,    61,    16,    74,    75,    32,
-      54,    69,    17,    18,    19,    20,   104,   105,   106,   107,
-     108,    71,    60,    86,   103,    22,    23,    24,    25,    26,
-      62,    76,    77,    92,    48,    58,    49,    87,    42,    43,
-      44,    45,    96,   100,   112,   119,    97,    55,    27,    28,
-      29,    84,   113,   114,    30,    31,    33,    34,    36,    37,
-      35,   117,    38,    39,    40,    46,    65,   101,    79,   118,
-      72,   126,    80,    81,    98,    99,    85,    41,    63,    66,
-      47,    50,    88,    89,    64,   127,    90,    51,    52,    53,
-     102,    91,    59,    93,    94,    95,    56,    57,    78,    67,
-      68,    83,   109,   110,   111,   115,   116,   120,   122,   121,
-     123,   124,   125,     0,     0,     0,     0,     0,   129,   131,
-     132,   133,   135,   134,     0,     0,     0,     0,   137,   139,
-     140,   141,   142,     0,     0,     0,     0,     0,     0,     0,
-       0,   268,   270,   272,   271,   277,   273,   274,   275,   276,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   287,   289,   290,   291,   292,   293,   294,   295,
-     296,   297,   298,   299,   300,     0,   314,   316,   144,   143,
-     148,   151,   149,   157,   158,   159,   160,   170,   171,   172,
-     173,   174,   193,   194,   195,   199,   200,   154,   201,   202,
-     205,   203,   204,   207,   208,   209,   222,   183,   184,   185,
-     186,   210,   225,   179,   181,   226,   232,   233,   234,   155,
-     192,   241,   242,   180,   237,   167,   150,   175,   223,   229,
-     211,     0,     0,   245,   156,   145,   166,   215,   146,   152,
-     153,   176,   177,   243,   213,   217,   218,   147,   246,   196,
-     221,   168,   182,   227,   228,   231,   236,   178,   240,   238,
-     239,   187,   191,   219,   220,   188,   189,   212,   235,   169,
-     161,   162,   163,   164,   165,   247,   248,   249,   197,   198,
-     206,   250,   251,   214,   190,   252,   254,   253,     0,     0,
-     257,   216,   230,   258,   259,   260,   262,   261,   263,   264,
-     265,   266,   278,   280,   279,   282,   283,   284,   285,   281,
-     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
-     311,   312,   317,   224,   244,   255,   256
-};
+#define YYTABLE_NINF (-1)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,     1,     9,    10,    16,   137,    11,    17,   258,    12,
-      18,   268,   138,   139,   140,   141,   142,   143,   144,   145,
-     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
-     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
-     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
-     176,   177,   178,   179,   180,   181,   182,   183,   184,   185,
-     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
-     196,   197,   198,   199,   200,   201,   202,   203,   204,   205,
-     206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
-     216,   217,   218,   219,   220,   221,   222,   223,   224,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   259,   260,   261,
-     262,   263,   269,   270,   271,   272,    13,    19,   281,   282,
-     283,   284,   285,   286,   287,   288,   289,    14,    20,   302,
-     303,   304,   305,   306,   307,   308,   309,   310,   311,   312,
-     313,   314,    15,    21,   316,   317
-};
+#define yytable_value_is_error(Yyn) \
+  0
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -81
 static const yytype_int16 yypact[] =
 {
-     -81,   116,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
-     -81,   -81,   -81,   -81,   -81,   -81,   -12,    89,    47,   -13,
-      22,   -80,    16,    17,    18,    23,    24,    78,   107,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,   139,   140,
-     141,   142,   143,   145,   146,   147,   148,   149,   163,   164,
-     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
-     176,   177,   178,   180,   181,   182,   183,   184,   185,   186,
-     187,   188,   189,   190,   191,   192,   193,   195,   196,   197,
-     198,   199,   200,   201,   202,   203,   204,   205,   206,   207,
-     209,   211,   212,   213,   214,   215,   216,   217,   218,   219,
-     220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
-     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   -81,   -81,   -81,
+     -81,   180,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -12,    90,    89,   -13,
+      53,   -80,    16,    17,    18,    22,    23,    24,    74,    78,
+      82,    83,   106,   107,   118,   121,   122,   123,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   202,   203,
+     204,   205,   206,   210,   211,   212,   213,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
+     259,   260,   261,   262,   263,   264,   265,   266,   267,   268,
+     269,   270,   271,   272,   273,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+     290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
+     300,   301,   302,   303,   304,   305,   306,   307,   309,   310,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
@@ -1269,28 +1172,98 @@ static const yytype_int16 yypact[] =
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
-     -81,   -81,   -81,   258,   259,   260,   261,   262,   -81,   -81,
-     -81,   -81,   -81,   -81,   263,   264,   265,   266,   -81,   -81,
-     -81,   -81,   -81,   267,   268,   269,   270,   271,   272,   273,
-     274,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
-     -81,   -81,   -81,   -81,   -81,   287,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   311,
+     312,   313,   314,   315,   -81,   -81,   -81,   -81,   -81,   -81,
+     316,   317,   318,   319,   -81,   -81,   -81,   -81,   -81,   320,
+     321,   322,   323,   324,   325,   326,   327,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   348,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
-     -81,   288,   289,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   349,   350,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
-     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   290,   291,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
-     -81,   -81,   -81,   -81,   -81,   -81,   -81
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     351,   352,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       2,     0,     1,    10,   151,   159,   313,   375,   332,     3,
+      12,   153,   161,   315,   334,   377,     4,     5,     6,     8,
+       9,     7,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      11,    13,    14,    70,    73,    82,    15,    21,    61,    16,
+      74,    75,    32,    54,   140,   138,   139,    69,    17,    18,
+      19,    20,   104,   105,   106,   107,   108,    71,    60,    86,
+     103,    22,    23,    24,    25,    26,    62,    76,    77,    92,
+      48,    58,    49,    87,    42,    43,    44,    45,    96,   100,
+     112,   131,   132,   133,   128,   119,    97,    55,    27,    28,
+     143,   144,   145,   147,   148,   150,   149,   146,   129,   130,
+      29,    84,   113,   114,    30,    31,    33,    34,    36,    37,
+      35,   117,    38,    39,    40,    46,    65,   101,    79,   118,
+      72,   126,    80,    81,    98,    99,   134,   135,   136,   141,
+     142,    85,    41,    63,    66,    47,    50,    88,    89,    64,
+     127,    90,    51,    52,    53,   102,    91,    59,    93,    94,
+      95,    56,    57,    78,   137,    67,    68,    83,   109,   110,
+     111,   115,   116,   120,   122,   121,   123,   124,   125,     0,
+       0,     0,     0,     0,   152,   154,   155,   156,   158,   157,
+       0,     0,     0,     0,   160,   162,   163,   164,   165,     0,
+       0,     0,     0,     0,     0,     0,     0,   314,   316,   318,
+     317,   323,   319,   320,   321,   322,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   333,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
+     348,   349,   350,   351,   352,   353,   354,     0,   376,   378,
+     167,   166,   171,   174,   172,   183,   184,   185,   186,   196,
+     197,   198,   199,   200,   223,   224,   235,   239,   240,   177,
+     241,   242,   245,   243,   244,   247,   248,   249,   267,   209,
+     210,   211,   212,   250,   270,   205,   207,   271,   277,   278,
+     279,   178,   222,   286,   287,   206,   282,   193,   173,   201,
+     268,   274,   251,     0,     0,   291,   182,   168,   192,   255,
+     169,   175,   176,   202,   203,   288,   253,   257,   258,   170,
+     292,   236,   266,   194,   208,   272,   273,   276,   281,   204,
+     285,   283,   284,   213,   221,   259,   260,   214,   215,   252,
+     280,   195,   187,   188,   189,   190,   191,   293,   294,   295,
+     237,   238,   246,   296,   297,   254,   220,   298,   300,   299,
+       0,     0,   303,   256,   275,   219,   233,   234,   216,   217,
+     218,   261,   262,   263,   289,   180,   181,   179,   264,   265,
+     225,   226,   227,   232,   228,   229,   231,   230,   304,   305,
+     306,   308,   307,   309,   310,   311,   312,   324,   326,   325,
+     328,   329,   330,   331,   327,   355,   356,   365,   366,   367,
+     368,   369,   370,   371,   372,   373,   374,   357,   358,   359,
+     360,   361,   362,   363,   364,   379,   269,   290,   301,   302
 };
 
 /* YYPGOTO[NTERM-NUM].  */
@@ -1312,96 +1285,129 @@ static const yytype_int8 yypgoto[] =
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
      -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
-     -81,   -81,   -81,   -81,   -81,   -81
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,   -81,
+     -81,   -81,   -81,   -81,   -81,   -81,   -81
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,     9,    10,    16,   160,    11,    17,   304,    12,
+      18,   314,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,   174,   175,   176,   177,   178,
+     179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,   223,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,   267,   268,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,   290,   291,   292,   293,   294,   295,   296,   297,   298,
+     305,   306,   307,   308,   309,   315,   316,   317,   318,    13,
+      19,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+      14,    20,   356,   357,   358,   359,   360,   361,   362,   363,
+     364,   365,   366,   367,   368,   369,   370,   371,   372,   373,
+     374,   375,   376,    15,    21,   378,   379
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -1
-static const yytype_uint16 yytable[] =
+static const yytype_int16 yytable[] =
 {
       22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
       32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,   315,   318,   319,   320,    47,
-      48,    49,     0,   321,   322,    50,    51,    52,    53,    54,
+      42,    43,    44,    45,    46,   377,   380,   381,   382,    47,
+      48,    49,   383,   384,   385,    50,    51,    52,    53,    54,
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
       65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
       75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,   273,   274,   275,   276,
-     277,   278,   279,   280,   264,    91,    92,    93,   323,    94,
-      95,    96,   265,   266,    97,    98,    99,   100,   101,   102,
+      85,    86,    87,    88,    89,    90,   319,   320,   321,   322,
+     323,   324,   325,   326,   386,    91,    92,    93,   387,    94,
+      95,    96,   388,   389,    97,    98,    99,   100,   101,   102,
      103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,     2,   324,   119,   120,
-     121,   122,   123,   124,   125,   126,   253,     3,   254,   255,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   127,
-     128,   129,   130,   131,   132,   133,   134,   135,   136,   334,
-     335,   336,   337,   338,     4,   339,   340,   341,   342,   343,
-       5,   290,   291,   292,   293,   294,   295,   296,   297,   298,
-     299,   300,   301,   344,   345,   267,   346,   347,   348,   349,
-     350,   351,   352,   353,   354,   355,   356,   357,   358,   256,
-     359,   360,   361,   362,   363,   364,   365,   366,   367,   368,
-     369,   370,   371,   372,     6,   373,   374,   375,   376,   377,
-     378,   379,   380,   381,   382,   383,   384,   385,   257,   386,
-       7,   387,   388,   389,   390,   391,   392,   393,   394,   395,
-     396,   397,   398,   399,   400,   401,   402,   403,   404,   405,
-     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
-     416,   417,   418,   419,     8,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466
+     113,   114,   115,   116,   117,   118,   390,   391,   119,   120,
+     121,   122,   123,   124,   125,   126,   310,   299,   392,   300,
+     301,   393,   394,   395,   311,   312,   396,   397,   398,   399,
+     400,   401,   402,   403,   404,   405,   406,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
+       2,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     302,     3,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   416,   417,   418,   419,   420,   313,     4,   303,
+     421,   422,   423,   424,     5,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,   435,   436,   437,   438,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,   458,   459,
+     460,   461,   462,   463,   464,   465,   466,   467,     6,   468,
+     469,   470,   471,   472,   473,   474,   475,   476,   477,   478,
+     479,   480,   481,   482,     7,   483,   484,   485,   486,   487,
+     488,   489,   490,   491,   492,   493,   494,   495,   496,   497,
+     498,   499,   500,   501,   502,   503,   504,   505,   506,   507,
+     508,   509,   510,   511,   512,   513,   514,   515,     8,   516,
+     517,   518,   519,   520,   521,   522,   523,   524,   525,   526,
+     527,   528,   529,   530,   531,   532,   533,   534,   535,   536,
+     537,   538,   539,   540,   541,   542,   543,   544,   545,   546,
+     547,   548,   549,   550,   551,   552,   553,   554,   555,   556,
+     557,   558,   559
 };
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-81)))
-
-#define yytable_value_is_error(Yytable_value) \
-  YYID (0)
-
-static const yytype_int16 yycheck[] =
+static const yytype_uint8 yycheck[] =
 {
       12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
       22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
       32,    33,    34,    35,    36,   105,    10,    10,    10,    41,
-      42,    43,    -1,    10,    10,    47,    48,    49,    50,    51,
+      42,    43,    10,    10,    10,    47,    48,    49,    50,    51,
       52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
       62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
       72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
       82,    83,    84,    85,    86,    87,    89,    90,    91,    92,
-      93,    94,    95,    96,    37,    97,    98,    99,    10,   101,
-     102,   103,    45,    46,   106,   107,   108,   109,   110,   111,
+      93,    94,    95,    96,    10,    97,    98,    99,    10,   101,
+     102,   103,    10,    10,   106,   107,   108,   109,   110,   111,
      112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
-     122,   123,   124,   125,   126,   127,     0,    10,   130,   131,
-     132,   133,   134,   135,   136,   137,    37,    11,    39,    40,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,   151,
-     152,   153,   154,   155,   156,   157,   158,   159,   160,    10,
-      10,    10,    10,    10,    38,    10,    10,    10,    10,    10,
-      44,   139,   140,   141,   142,   143,   144,   145,   146,   147,
-     148,   149,   150,    10,    10,   128,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,   100,
+     122,   123,   124,   125,   126,   127,    10,    10,   130,   131,
+     132,   133,   134,   135,   136,   137,    37,    37,    10,    39,
+      40,    10,    10,    10,    45,    46,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+       0,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+     100,    11,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,    10,    10,    10,    10,    10,   128,    38,   129,
+      10,    10,    10,    10,    44,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    88,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,   129,    10,
-     104,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    88,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,   138,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,   104,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,   138,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   162,     0,    11,    38,    44,    88,   104,   138,   163,
-     164,   167,   170,   297,   308,   323,   165,   168,   171,   298,
-     309,   324,    12,    13,    14,    15,    16,    17,    18,    19,
+       0,   193,     0,    11,    38,    44,    88,   104,   138,   194,
+     195,   198,   201,   351,   362,   385,   196,   199,   202,   352,
+     363,   386,    12,    13,    14,    15,    16,    17,    18,    19,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
       30,    31,    32,    33,    34,    35,    36,    41,    42,    43,
       47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
@@ -1411,26 +1417,32 @@ static const yytype_uint16 yystos[] =
       87,    97,    98,    99,   101,   102,   103,   106,   107,   108,
      109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
      119,   120,   121,   122,   123,   124,   125,   126,   127,   130,
-     131,   132,   133,   134,   135,   136,   137,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   166,   173,   174,
-     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
-     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
-     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
-     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
-     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
-     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,    37,    39,    40,   100,   129,   169,   288,
-     289,   290,   291,   292,    37,    45,    46,   128,   172,   293,
-     294,   295,   296,    89,    90,    91,    92,    93,    94,    95,
-      96,   299,   300,   301,   302,   303,   304,   305,   306,   307,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   310,   311,   312,   313,   314,   315,   316,   317,
-     318,   319,   320,   321,   322,   105,   325,   326,    10,    10,
+     131,   132,   133,   134,   135,   136,   137,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     197,   204,   205,   206,   207,   208,   209,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
+     263,   264,   265,   266,   267,   268,   269,   270,   271,   272,
+     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   286,   287,   288,   289,   290,   291,   292,
+     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
+     303,   304,   305,   306,   307,   308,   309,   310,   311,   312,
+     313,   314,   315,   316,   317,   318,   319,   320,   321,   322,
+     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,   339,   340,   341,    37,
+      39,    40,   100,   129,   200,   342,   343,   344,   345,   346,
+      37,    45,    46,   128,   203,   347,   348,   349,   350,    89,
+      90,    91,    92,    93,    94,    95,    96,   353,   354,   355,
+     356,   357,   358,   359,   360,   361,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,   158,   364,   365,   366,   367,
+     368,   369,   370,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,   380,   381,   382,   383,   384,   105,   387,   388,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
@@ -1445,70 +1457,133 @@ static const yytype_uint16 yystos[] =
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   192,   193,   193,   194,   194,   194,   194,   194,   194,
+     195,   196,   196,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   198,   199,   199,   200,   200,   200,   200,   200,   201,
+     202,   202,   203,   203,   203,   203,   204,   205,   206,   207,
+     208,   209,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+     288,   289,   290,   291,   292,   293,   294,   295,   296,   297,
+     298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
+     308,   309,   310,   311,   312,   313,   314,   315,   316,   317,
+     318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
+     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
+     348,   349,   350,   351,   352,   352,   353,   353,   353,   353,
+     353,   353,   353,   353,   354,   355,   356,   357,   358,   359,
+     360,   361,   362,   363,   363,   364,   364,   364,   364,   364,
+     364,   364,   364,   364,   364,   364,   364,   364,   364,   364,
+     364,   364,   364,   364,   364,   365,   366,   367,   368,   369,
+     370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
+     380,   381,   382,   383,   384,   385,   386,   386,   387,   388
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
+       1,     2,     0,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     2,     0,     1,     1,     1,     1,     1,     1,
+       2,     0,     1,     1,     1,     1,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     3,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       3,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     3,     3,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     1,     2,     0,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     2,     2,     2,     2,     2,
+       2,     2,     1,     2,     0,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     1,     2,     0,     1,     2
+};
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-/* Error token number */
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -1518,82 +1593,58 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-        break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
-static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1601,16 +1652,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
-static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1621,63 +1664,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -1693,363 +1729,77 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
 
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
 
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULL, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULL;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULL, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
-static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-        break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
-
-#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END
-#endif
-#ifndef YY_INITIAL_VALUE
-# define YY_INITIAL_VALUE(Value) /* Nothing. */
-#endif
-
 /* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval YY_INITIAL_VALUE(yyval_default);
-
+YYSTYPE yylval;
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2057,102 +1807,107 @@ yyparse ()
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2163,18 +1918,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2202,15 +1968,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2225,14 +1989,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -2245,18 +2009,17 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 10:
-/* Line 1792 of yacc.c  */
-#line 135 "util/configparser.y"
-    { 
+  case 10: /* serverstart: VAR_SERVER  */
+#line 150 "util/configparser.y"
+        { 
 		OUTYY(("\nP(server:)\n")); 
 	}
+#line 2018 "util/configparser.c"
     break;
 
-  case 128:
-/* Line 1792 of yacc.c  */
-#line 191 "util/configparser.y"
-    {
+  case 151: /* stubstart: VAR_STUB_ZONE  */
+#line 217 "util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(stub_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2266,12 +2029,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
+#line 2033 "util/configparser.c"
     break;
 
-  case 136:
-/* Line 1792 of yacc.c  */
-#line 207 "util/configparser.y"
-    {
+  case 159: /* forwardstart: VAR_FORWARD_ZONE  */
+#line 233 "util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(forward_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2281,87 +2044,87 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
+#line 2048 "util/configparser.c"
     break;
 
-  case 143:
-/* Line 1792 of yacc.c  */
-#line 223 "util/configparser.y"
-    { 
-		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[(2) - (2)].str))); 
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 166: /* server_num_threads: VAR_NUM_THREADS STRING_ARG  */
+#line 249 "util/configparser.y"
+        { 
+		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[0].str))); 
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->num_threads = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->num_threads = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2060 "util/configparser.c"
     break;
 
-  case 144:
-/* Line 1792 of yacc.c  */
-#line 232 "util/configparser.y"
-    { 
-		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[(2) - (2)].str))); 
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 167: /* server_verbosity: VAR_VERBOSITY STRING_ARG  */
+#line 258 "util/configparser.y"
+        { 
+		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[0].str))); 
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->verbosity = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->verbosity = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2072 "util/configparser.c"
     break;
 
-  case 145:
-/* Line 1792 of yacc.c  */
-#line 241 "util/configparser.y"
-    { 
-		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[(2) - (2)].str))); 
-		if(strcmp((yyvsp[(2) - (2)].str), "") == 0 || strcmp((yyvsp[(2) - (2)].str), "0") == 0)
+  case 168: /* server_statistics_interval: VAR_STATISTICS_INTERVAL STRING_ARG  */
+#line 267 "util/configparser.y"
+        { 
+		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[0].str))); 
+		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->stat_interval = 0;
-		else if(atoi((yyvsp[(2) - (2)].str)) == 0)
+		else if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->stat_interval = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->stat_interval = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2086 "util/configparser.c"
     break;
 
-  case 146:
-/* Line 1792 of yacc.c  */
-#line 252 "util/configparser.y"
-    {
-		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 169: /* server_statistics_cumulative: VAR_STATISTICS_CUMULATIVE STRING_ARG  */
+#line 278 "util/configparser.y"
+        {
+		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2098 "util/configparser.c"
     break;
 
-  case 147:
-/* Line 1792 of yacc.c  */
-#line 261 "util/configparser.y"
-    {
-		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 170: /* server_extended_statistics: VAR_EXTENDED_STATISTICS STRING_ARG  */
+#line 287 "util/configparser.y"
+        {
+		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2110 "util/configparser.c"
     break;
 
-  case 148:
-/* Line 1792 of yacc.c  */
-#line 270 "util/configparser.y"
-    {
-		OUTYY(("P(server_port:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 171: /* server_port: VAR_PORT STRING_ARG  */
+#line 296 "util/configparser.y"
+        {
+		OUTYY(("P(server_port:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
-		else cfg_parser->cfg->port = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->port = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2122 "util/configparser.c"
     break;
 
-  case 149:
-/* Line 1792 of yacc.c  */
-#line 279 "util/configparser.y"
-    {
-		OUTYY(("P(server_interface:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 172: /* server_interface: VAR_INTERFACE STRING_ARG  */
+#line 305 "util/configparser.y"
+        {
+		OUTYY(("P(server_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_ifs == 0)
 			cfg_parser->cfg->ifs = calloc(1, sizeof(char*));
 		else 	cfg_parser->cfg->ifs = realloc(cfg_parser->cfg->ifs,
@@ -2369,15 +2132,15 @@ yyreduce:
 		if(!cfg_parser->cfg->ifs)
 			yyerror("out of memory");
 		else
-			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[(2) - (2)].str);
+			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[0].str);
 	}
+#line 2138 "util/configparser.c"
     break;
 
-  case 150:
-/* Line 1792 of yacc.c  */
-#line 292 "util/configparser.y"
-    {
-		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 173: /* server_outgoing_interface: VAR_OUTGOING_INTERFACE STRING_ARG  */
+#line 318 "util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_out_ifs == 0)
 			cfg_parser->cfg->out_ifs = calloc(1, sizeof(char*));
 		else 	cfg_parser->cfg->out_ifs = realloc(
@@ -2387,1185 +2150,1480 @@ yyreduce:
 			yyerror("out of memory");
 		else
 			cfg_parser->cfg->out_ifs[
-				cfg_parser->cfg->num_out_ifs++] = (yyvsp[(2) - (2)].str);
+				cfg_parser->cfg->num_out_ifs++] = (yyvsp[0].str);
 	}
+#line 2156 "util/configparser.c"
     break;
 
-  case 151:
-/* Line 1792 of yacc.c  */
-#line 307 "util/configparser.y"
-    {
-		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 174: /* server_outgoing_range: VAR_OUTGOING_RANGE STRING_ARG  */
+#line 333 "util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2168 "util/configparser.c"
     break;
 
-  case 152:
-/* Line 1792 of yacc.c  */
-#line 316 "util/configparser.y"
-    {
-		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_mark_ports((yyvsp[(2) - (2)].str), 1, 
+  case 175: /* server_outgoing_port_permit: VAR_OUTGOING_PORT_PERMIT STRING_ARG  */
+#line 342 "util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[0].str)));
+		if(!cfg_mark_ports((yyvsp[0].str), 1, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2180 "util/configparser.c"
     break;
 
-  case 153:
-/* Line 1792 of yacc.c  */
-#line 325 "util/configparser.y"
-    {
-		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_mark_ports((yyvsp[(2) - (2)].str), 0, 
+  case 176: /* server_outgoing_port_avoid: VAR_OUTGOING_PORT_AVOID STRING_ARG  */
+#line 351 "util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[0].str)));
+		if(!cfg_mark_ports((yyvsp[0].str), 0, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2192 "util/configparser.c"
     break;
 
-  case 154:
-/* Line 1792 of yacc.c  */
-#line 334 "util/configparser.y"
-    {
-		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 177: /* server_outgoing_num_tcp: VAR_OUTGOING_NUM_TCP STRING_ARG  */
+#line 360 "util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2204 "util/configparser.c"
     break;
 
-  case 155:
-/* Line 1792 of yacc.c  */
-#line 343 "util/configparser.y"
-    {
-		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 178: /* server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG  */
+#line 369 "util/configparser.y"
+        {
+		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2216 "util/configparser.c"
     break;
 
-  case 156:
-/* Line 1792 of yacc.c  */
-#line 352 "util/configparser.y"
-    {
-		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 179: /* server_incoming_tcp_pipeline: VAR_INCOMING_TCP_PIPELINE STRING_ARG  */
+#line 378 "util/configparser.y"
+        {
+		OUTYY(("P(server_incoming_tcp_pipeline:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->incoming_tcp_pipeline = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2228 "util/configparser.c"
+    break;
+
+  case 180: /* server_tcp_reuse_timeout: VAR_TCP_REUSE_TIMEOUT STRING_ARG  */
+#line 387 "util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_reuse_timeout:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_reuse_timeout = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2240 "util/configparser.c"
+    break;
+
+  case 181: /* server_max_reuse_tcp_queries: VAR_MAX_REUSE_TCP_QUERIES STRING_ARG  */
+#line 396 "util/configparser.y"
+        {
+		OUTYY(("P(server_max_reuse_tcp_queries:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->max_reuse_tcp_queries = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2252 "util/configparser.c"
+    break;
+
+  case 182: /* server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG  */
+#line 405 "util/configparser.y"
+        {
+		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2264 "util/configparser.c"
     break;
 
-  case 157:
-/* Line 1792 of yacc.c  */
-#line 361 "util/configparser.y"
-    {
-		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 183: /* server_do_ip4: VAR_DO_IP4 STRING_ARG  */
+#line 414 "util/configparser.y"
+        {
+		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2276 "util/configparser.c"
     break;
 
-  case 158:
-/* Line 1792 of yacc.c  */
-#line 370 "util/configparser.y"
-    {
-		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 184: /* server_do_ip6: VAR_DO_IP6 STRING_ARG  */
+#line 423 "util/configparser.y"
+        {
+		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2288 "util/configparser.c"
     break;
 
-  case 159:
-/* Line 1792 of yacc.c  */
-#line 379 "util/configparser.y"
-    {
-		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 185: /* server_do_udp: VAR_DO_UDP STRING_ARG  */
+#line 432 "util/configparser.y"
+        {
+		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2300 "util/configparser.c"
     break;
 
-  case 160:
-/* Line 1792 of yacc.c  */
-#line 388 "util/configparser.y"
-    {
-		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 186: /* server_do_tcp: VAR_DO_TCP STRING_ARG  */
+#line 441 "util/configparser.y"
+        {
+		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2312 "util/configparser.c"
     break;
 
-  case 161:
-/* Line 1792 of yacc.c  */
-#line 397 "util/configparser.y"
-    {
-		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 187: /* server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG  */
+#line 450 "util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2324 "util/configparser.c"
     break;
 
-  case 162:
-/* Line 1792 of yacc.c  */
-#line 406 "util/configparser.y"
-    {
-		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 188: /* server_ssl_upstream: VAR_SSL_UPSTREAM STRING_ARG  */
+#line 459 "util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2336 "util/configparser.c"
     break;
 
-  case 163:
-/* Line 1792 of yacc.c  */
-#line 415 "util/configparser.y"
-    {
-		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 189: /* server_ssl_service_key: VAR_SSL_SERVICE_KEY STRING_ARG  */
+#line 468 "util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_key);
-		cfg_parser->cfg->ssl_service_key = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->ssl_service_key = (yyvsp[0].str);
 	}
+#line 2346 "util/configparser.c"
     break;
 
-  case 164:
-/* Line 1792 of yacc.c  */
-#line 422 "util/configparser.y"
-    {
-		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 190: /* server_ssl_service_pem: VAR_SSL_SERVICE_PEM STRING_ARG  */
+#line 475 "util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_pem);
-		cfg_parser->cfg->ssl_service_pem = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->ssl_service_pem = (yyvsp[0].str);
 	}
+#line 2356 "util/configparser.c"
     break;
 
-  case 165:
-/* Line 1792 of yacc.c  */
-#line 429 "util/configparser.y"
-    {
-		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 191: /* server_ssl_port: VAR_SSL_PORT STRING_ARG  */
+#line 482 "util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
-		else cfg_parser->cfg->ssl_port = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->ssl_port = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2368 "util/configparser.c"
     break;
 
-  case 166:
-/* Line 1792 of yacc.c  */
-#line 438 "util/configparser.y"
-    {
-		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 192: /* server_do_daemonize: VAR_DO_DAEMONIZE STRING_ARG  */
+#line 491 "util/configparser.y"
+        {
+		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2380 "util/configparser.c"
     break;
 
-  case 167:
-/* Line 1792 of yacc.c  */
-#line 447 "util/configparser.y"
-    {
-		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 193: /* server_use_syslog: VAR_USE_SYSLOG STRING_ARG  */
+#line 500 "util/configparser.y"
+        {
+		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->use_syslog = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+		else cfg_parser->cfg->use_syslog = (strcmp((yyvsp[0].str), "yes")==0);
 #if !defined(HAVE_SYSLOG_H) && !defined(UB_ON_WINDOWS)
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") == 0)
+		if(strcmp((yyvsp[0].str), "yes") == 0)
 			yyerror("no syslog services are available. "
 				"(reconfigure and compile to add)");
 #endif
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2397 "util/configparser.c"
     break;
 
-  case 168:
-/* Line 1792 of yacc.c  */
-#line 461 "util/configparser.y"
-    {
-		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 194: /* server_log_time_ascii: VAR_LOG_TIME_ASCII STRING_ARG  */
+#line 514 "util/configparser.y"
+        {
+		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2409 "util/configparser.c"
     break;
 
-  case 169:
-/* Line 1792 of yacc.c  */
-#line 470 "util/configparser.y"
-    {
-		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 195: /* server_log_queries: VAR_LOG_QUERIES STRING_ARG  */
+#line 523 "util/configparser.y"
+        {
+		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2421 "util/configparser.c"
     break;
 
-  case 170:
-/* Line 1792 of yacc.c  */
-#line 479 "util/configparser.y"
-    {
-		OUTYY(("P(server_chroot:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 196: /* server_chroot: VAR_CHROOT STRING_ARG  */
+#line 532 "util/configparser.y"
+        {
+		OUTYY(("P(server_chroot:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->chrootdir);
-		cfg_parser->cfg->chrootdir = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->chrootdir = (yyvsp[0].str);
 	}
+#line 2431 "util/configparser.c"
     break;
 
-  case 171:
-/* Line 1792 of yacc.c  */
-#line 486 "util/configparser.y"
-    {
-		OUTYY(("P(server_username:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 197: /* server_username: VAR_USERNAME STRING_ARG  */
+#line 539 "util/configparser.y"
+        {
+		OUTYY(("P(server_username:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->username);
-		cfg_parser->cfg->username = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->username = (yyvsp[0].str);
 	}
+#line 2441 "util/configparser.c"
     break;
 
-  case 172:
-/* Line 1792 of yacc.c  */
-#line 493 "util/configparser.y"
-    {
-		OUTYY(("P(server_directory:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 198: /* server_directory: VAR_DIRECTORY STRING_ARG  */
+#line 546 "util/configparser.y"
+        {
+		OUTYY(("P(server_directory:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->directory);
-		cfg_parser->cfg->directory = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->directory = (yyvsp[0].str);
 	}
+#line 2451 "util/configparser.c"
     break;
 
-  case 173:
-/* Line 1792 of yacc.c  */
-#line 500 "util/configparser.y"
-    {
-		OUTYY(("P(server_logfile:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 199: /* server_logfile: VAR_LOGFILE STRING_ARG  */
+#line 553 "util/configparser.y"
+        {
+		OUTYY(("P(server_logfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->logfile);
-		cfg_parser->cfg->logfile = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->logfile = (yyvsp[0].str);
 		cfg_parser->cfg->use_syslog = 0;
 	}
+#line 2462 "util/configparser.c"
     break;
 
-  case 174:
-/* Line 1792 of yacc.c  */
-#line 508 "util/configparser.y"
-    {
-		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 200: /* server_pidfile: VAR_PIDFILE STRING_ARG  */
+#line 561 "util/configparser.y"
+        {
+		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->pidfile);
-		cfg_parser->cfg->pidfile = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->pidfile = (yyvsp[0].str);
 	}
+#line 2472 "util/configparser.c"
     break;
 
-  case 175:
-/* Line 1792 of yacc.c  */
-#line 515 "util/configparser.y"
-    {
-		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[(2) - (2)].str)))
+  case 201: /* server_root_hints: VAR_ROOT_HINTS STRING_ARG  */
+#line 568 "util/configparser.y"
+        {
+		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2482 "util/configparser.c"
     break;
 
-  case 176:
-/* Line 1792 of yacc.c  */
-#line 522 "util/configparser.y"
-    {
-		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 202: /* server_dlv_anchor_file: VAR_DLV_ANCHOR_FILE STRING_ARG  */
+#line 575 "util/configparser.y"
+        {
+		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dlv_anchor_file);
-		cfg_parser->cfg->dlv_anchor_file = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->dlv_anchor_file = (yyvsp[0].str);
 	}
+#line 2492 "util/configparser.c"
     break;
 
-  case 177:
-/* Line 1792 of yacc.c  */
-#line 529 "util/configparser.y"
-    {
-		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->dlv_anchor_list, (yyvsp[(2) - (2)].str)))
+  case 203: /* server_dlv_anchor: VAR_DLV_ANCHOR STRING_ARG  */
+#line 582 "util/configparser.y"
+        {
+		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->dlv_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2502 "util/configparser.c"
     break;
 
-  case 178:
-/* Line 1792 of yacc.c  */
-#line 536 "util/configparser.y"
-    {
-		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 204: /* server_auto_trust_anchor_file: VAR_AUTO_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 589 "util/configparser.y"
+        {
+		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
-			auto_trust_anchor_file_list, (yyvsp[(2) - (2)].str)))
+			auto_trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2513 "util/configparser.c"
     break;
 
-  case 179:
-/* Line 1792 of yacc.c  */
-#line 544 "util/configparser.y"
-    {
-		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 205: /* server_trust_anchor_file: VAR_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 597 "util/configparser.y"
+        {
+		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
-			trust_anchor_file_list, (yyvsp[(2) - (2)].str)))
+			trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2524 "util/configparser.c"
     break;
 
-  case 180:
-/* Line 1792 of yacc.c  */
-#line 552 "util/configparser.y"
-    {
-		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 206: /* server_trusted_keys_file: VAR_TRUSTED_KEYS_FILE STRING_ARG  */
+#line 605 "util/configparser.y"
+        {
+		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
-			trusted_keys_file_list, (yyvsp[(2) - (2)].str)))
+			trusted_keys_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2535 "util/configparser.c"
     break;
 
-  case 181:
-/* Line 1792 of yacc.c  */
-#line 560 "util/configparser.y"
-    {
-		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[(2) - (2)].str)))
+  case 207: /* server_trust_anchor: VAR_TRUST_ANCHOR STRING_ARG  */
+#line 613 "util/configparser.y"
+        {
+		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2545 "util/configparser.c"
     break;
 
-  case 182:
-/* Line 1792 of yacc.c  */
-#line 567 "util/configparser.y"
-    {
-		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[(2) - (2)].str)))
+  case 208: /* server_domain_insecure: VAR_DOMAIN_INSECURE STRING_ARG  */
+#line 620 "util/configparser.y"
+        {
+		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2555 "util/configparser.c"
     break;
 
-  case 183:
-/* Line 1792 of yacc.c  */
-#line 574 "util/configparser.y"
-    {
-		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 209: /* server_hide_identity: VAR_HIDE_IDENTITY STRING_ARG  */
+#line 627 "util/configparser.y"
+        {
+		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2567 "util/configparser.c"
     break;
 
-  case 184:
-/* Line 1792 of yacc.c  */
-#line 583 "util/configparser.y"
-    {
-		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 210: /* server_hide_version: VAR_HIDE_VERSION STRING_ARG  */
+#line 636 "util/configparser.y"
+        {
+		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2579 "util/configparser.c"
     break;
 
-  case 185:
-/* Line 1792 of yacc.c  */
-#line 592 "util/configparser.y"
-    {
-		OUTYY(("P(server_identity:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 211: /* server_identity: VAR_IDENTITY STRING_ARG  */
+#line 645 "util/configparser.y"
+        {
+		OUTYY(("P(server_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->identity);
-		cfg_parser->cfg->identity = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->identity = (yyvsp[0].str);
 	}
+#line 2589 "util/configparser.c"
     break;
 
-  case 186:
-/* Line 1792 of yacc.c  */
-#line 599 "util/configparser.y"
-    {
-		OUTYY(("P(server_version:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 212: /* server_version: VAR_VERSION STRING_ARG  */
+#line 652 "util/configparser.y"
+        {
+		OUTYY(("P(server_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->version);
-		cfg_parser->cfg->version = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->version = (yyvsp[0].str);
 	}
+#line 2599 "util/configparser.c"
     break;
 
-  case 187:
-/* Line 1792 of yacc.c  */
-#line 606 "util/configparser.y"
-    {
-		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->so_rcvbuf))
+  case 213: /* server_so_rcvbuf: VAR_SO_RCVBUF STRING_ARG  */
+#line 659 "util/configparser.y"
+        {
+		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_rcvbuf))
 			yyerror("buffer size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2610 "util/configparser.c"
     break;
 
-  case 188:
-/* Line 1792 of yacc.c  */
-#line 614 "util/configparser.y"
-    {
-		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->so_sndbuf))
+  case 214: /* server_so_sndbuf: VAR_SO_SNDBUF STRING_ARG  */
+#line 667 "util/configparser.y"
+        {
+		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_sndbuf))
 			yyerror("buffer size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2621 "util/configparser.c"
     break;
 
-  case 189:
-/* Line 1792 of yacc.c  */
-#line 622 "util/configparser.y"
+  case 215: /* server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG  */
+#line 675 "util/configparser.y"
     {
-        OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[(2) - (2)].str)));
-        if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+        OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[0].str)));
+        if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
             yyerror("expected yes or no.");
         else cfg_parser->cfg->so_reuseport =
-            (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-        free((yyvsp[(2) - (2)].str));
+            (strcmp((yyvsp[0].str), "yes")==0);
+        free((yyvsp[0].str));
     }
+#line 2634 "util/configparser.c"
+    break;
+
+  case 216: /* server_so_reuseport_bpf: VAR_SO_REUSEPORT_BPF STRING_ARG  */
+#line 685 "util/configparser.y"
+        {
+		OUTYY(("P(server_so_reuseport_bpf:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->so_reuseport_bpf =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2647 "util/configparser.c"
+    break;
+
+  case 217: /* server_so_incoming_cpu: VAR_SO_INCOMING_CPU STRING_ARG  */
+#line 695 "util/configparser.y"
+        {
+		OUTYY(("P(server_so_incoming_cpu:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->so_incoming_cpu =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2660 "util/configparser.c"
+    break;
+
+  case 218: /* server_cpu_affinity: VAR_CPU_AFFINITY STRING_ARG  */
+#line 705 "util/configparser.y"
+        {
+		OUTYY(("P(server_cpu_affinity:%s)\n", (yyvsp[0].str)));
+		if(cfg_count_numbers((yyvsp[0].str)) == 0)
+			yyerror("list of CPU numbers expected");
+		free(cfg_parser->cfg->cpu_affinity);
+		cfg_parser->cfg->cpu_affinity = (yyvsp[0].str);
+	}
+#line 2672 "util/configparser.c"
+    break;
+
+  case 219: /* server_udp_batch_size: VAR_UDP_BATCH_SIZE STRING_ARG  */
+#line 714 "util/configparser.y"
+        {
+		OUTYY(("P(server_udp_batch_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0 || atoi((yyvsp[0].str)) > 1024)
+			yyerror("udp-batch-size must be between 0 and 1024");
+		else cfg_parser->cfg->udp_batch_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2686 "util/configparser.c"
     break;
 
-  case 190:
-/* Line 1792 of yacc.c  */
-#line 632 "util/configparser.y"
+  case 220: /* server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG  */
+#line 725 "util/configparser.y"
     {
-        OUTYY(("P(server_ip_transparent:%s)\n", (yyvsp[(2) - (2)].str)));
-        if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+        OUTYY(("P(server_ip_transparent:%s)\n", (yyvsp[0].str)));
+        if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
             yyerror("expected yes or no.");
         else cfg_parser->cfg->ip_transparent =
-            (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-        free((yyvsp[(2) - (2)].str));
+            (strcmp((yyvsp[0].str), "yes")==0);
+        free((yyvsp[0].str));
     }
+#line 2699 "util/configparser.c"
     break;
 
-  case 191:
-/* Line 1792 of yacc.c  */
-#line 642 "util/configparser.y"
-    {
-		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 221: /* server_edns_buffer_size: VAR_EDNS_BUFFER_SIZE STRING_ARG  */
+#line 735 "util/configparser.y"
+        {
+		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else if (atoi((yyvsp[(2) - (2)].str)) < 12)
+		else if (atoi((yyvsp[0].str)) < 12)
 			yyerror("edns buffer size too small");
-		else if (atoi((yyvsp[(2) - (2)].str)) > 65535)
+		else if (atoi((yyvsp[0].str)) > 65535)
 			cfg_parser->cfg->edns_buffer_size = 65535;
-		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2715 "util/configparser.c"
     break;
 
-  case 192:
-/* Line 1792 of yacc.c  */
-#line 655 "util/configparser.y"
-    {
-		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 222: /* server_msg_buffer_size: VAR_MSG_BUFFER_SIZE STRING_ARG  */
+#line 748 "util/configparser.y"
+        {
+		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else if (atoi((yyvsp[(2) - (2)].str)) < 4096)
+		else if (atoi((yyvsp[0].str)) < 4096)
 			yyerror("message buffer size too small (use 4096)");
-		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2729 "util/configparser.c"
     break;
 
-  case 193:
-/* Line 1792 of yacc.c  */
-#line 666 "util/configparser.y"
-    {
-		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->msg_cache_size))
+  case 223: /* server_msg_cache_size: VAR_MSG_CACHE_SIZE STRING_ARG  */
+#line 759 "util/configparser.y"
+        {
+		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->msg_cache_size))
 			yyerror("memory size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2740 "util/configparser.c"
     break;
 
-  case 194:
-/* Line 1792 of yacc.c  */
-#line 674 "util/configparser.y"
-    {
-		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 224: /* server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG  */
+#line 767 "util/configparser.y"
+        {
+		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else {
-			cfg_parser->cfg->msg_cache_slabs = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->msg_cache_slabs = atoi((yyvsp[0].str));
 			if(!is_pow2(cfg_parser->cfg->msg_cache_slabs))
 				yyerror("must be a power of 2");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2756 "util/configparser.c"
     break;
 
-  case 195:
-/* Line 1792 of yacc.c  */
-#line 687 "util/configparser.y"
-    {
-		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 225: /* server_cache_open_addressing: VAR_CACHE_OPEN_ADDRESSING STRING_ARG  */
+#line 780 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_open_addressing:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_open_addressing =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2769 "util/configparser.c"
+    break;
+
+  case 226: /* server_cache_admission: VAR_CACHE_ADMISSION STRING_ARG  */
+#line 790 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_admission:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_admission =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2782 "util/configparser.c"
+    break;
+
+  case 227: /* server_hash_function: VAR_HASH_FUNCTION STRING_ARG  */
+#line 800 "util/configparser.y"
+        {
+		OUTYY(("P(server_hash_function:%s)\n", (yyvsp[0].str)));
+		if(hash_func_lookup((yyvsp[0].str)) < 0) {
+			yyerror("expected wyhash or lookup3.");
+			free((yyvsp[0].str));
+		} else {
+			free(cfg_parser->cfg->hash_function);
+			cfg_parser->cfg->hash_function = (yyvsp[0].str);
+		}
+	}
+#line 2797 "util/configparser.c"
+    break;
+
+  case 228: /* server_outgoing_port_pool: VAR_OUTGOING_PORT_POOL STRING_ARG  */
+#line 812 "util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_port_pool:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else if(atoi((yyvsp[0].str)) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->outgoing_port_pool = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2811 "util/configparser.c"
     break;
 
-  case 196:
-/* Line 1792 of yacc.c  */
-#line 696 "util/configparser.y"
-    {
-		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 229: /* server_outgoing_port_lifetime: VAR_OUTGOING_PORT_LIFETIME STRING_ARG  */
+#line 823 "util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_port_lifetime:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->jostle_time = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else if(atoi((yyvsp[0].str)) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->outgoing_port_lifetime = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2825 "util/configparser.c"
     break;
 
-  case 197:
-/* Line 1792 of yacc.c  */
-#line 705 "util/configparser.y"
-    {
-		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 230: /* server_infra_rtt_percentile: VAR_INFRA_RTT_PERCENTILE STRING_ARG  */
+#line 834 "util/configparser.y"
+        {
+		OUTYY(("P(server_infra_rtt_percentile:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->delay_close = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else if(atoi((yyvsp[0].str)) < 0 || atoi((yyvsp[0].str)) > 100)
+			yyerror("percentile must be 0 to 100");
+		else cfg_parser->cfg->infra_rtt_percentile = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2839 "util/configparser.c"
     break;
 
-  case 198:
-/* Line 1792 of yacc.c  */
-#line 714 "util/configparser.y"
-    {
-		OUTYY(("P(server_unblock_lan_zones:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 231: /* server_hedge_query_budget: VAR_HEDGE_QUERY_BUDGET STRING_ARG  */
+#line 845 "util/configparser.y"
+        {
+		OUTYY(("P(server_hedge_query_budget:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0 || atoi((yyvsp[0].str)) > 100)
+			yyerror("hedge query budget must be 0 to 100");
+		else cfg_parser->cfg->hedge_query_budget = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2853 "util/configparser.c"
+    break;
+
+  case 232: /* server_coalesce_queries: VAR_COALESCE_QUERIES STRING_ARG  */
+#line 856 "util/configparser.y"
+        {
+		OUTYY(("P(server_coalesce_queries:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->coalesce_queries =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2866 "util/configparser.c"
+    break;
+
+  case 233: /* server_lockfree_cache_lookup: VAR_LOCKFREE_CACHE_LOOKUP STRING_ARG  */
+#line 866 "util/configparser.y"
+        {
+		OUTYY(("P(server_lockfree_cache_lookup:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->lockfree_cache_lookup =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2879 "util/configparser.c"
+    break;
+
+  case 234: /* server_msg_cache_wire: VAR_MSG_CACHE_WIRE STRING_ARG  */
+#line 876 "util/configparser.y"
+        {
+		OUTYY(("P(server_msg_cache_wire:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->msg_cache_wire =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2892 "util/configparser.c"
+    break;
+
+  case 235: /* server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG  */
+#line 886 "util/configparser.y"
+        {
+		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2904 "util/configparser.c"
+    break;
+
+  case 236: /* server_jostle_timeout: VAR_JOSTLE_TIMEOUT STRING_ARG  */
+#line 895 "util/configparser.y"
+        {
+		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->jostle_time = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2916 "util/configparser.c"
+    break;
+
+  case 237: /* server_delay_close: VAR_DELAY_CLOSE STRING_ARG  */
+#line 904 "util/configparser.y"
+        {
+		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->delay_close = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2928 "util/configparser.c"
+    break;
+
+  case 238: /* server_unblock_lan_zones: VAR_UNBLOCK_LAN_ZONES STRING_ARG  */
+#line 913 "util/configparser.y"
+        {
+		OUTYY(("P(server_unblock_lan_zones:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->unblock_lan_zones = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2941 "util/configparser.c"
     break;
 
-  case 199:
-/* Line 1792 of yacc.c  */
-#line 724 "util/configparser.y"
-    {
-		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->rrset_cache_size))
+  case 239: /* server_rrset_cache_size: VAR_RRSET_CACHE_SIZE STRING_ARG  */
+#line 923 "util/configparser.y"
+        {
+		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->rrset_cache_size))
 			yyerror("memory size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2952 "util/configparser.c"
     break;
 
-  case 200:
-/* Line 1792 of yacc.c  */
-#line 732 "util/configparser.y"
-    {
-		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 240: /* server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG  */
+#line 931 "util/configparser.y"
+        {
+		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else {
-			cfg_parser->cfg->rrset_cache_slabs = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->rrset_cache_slabs = atoi((yyvsp[0].str));
 			if(!is_pow2(cfg_parser->cfg->rrset_cache_slabs))
 				yyerror("must be a power of 2");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2968 "util/configparser.c"
     break;
 
-  case 201:
-/* Line 1792 of yacc.c  */
-#line 745 "util/configparser.y"
-    {
-		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 241: /* server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG  */
+#line 944 "util/configparser.y"
+        {
+		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->host_ttl = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->host_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2980 "util/configparser.c"
     break;
 
-  case 202:
-/* Line 1792 of yacc.c  */
-#line 754 "util/configparser.y"
-    {
-		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 242: /* server_infra_lame_ttl: VAR_INFRA_LAME_TTL STRING_ARG  */
+#line 953 "util/configparser.y"
+        {
+		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-lame-ttl: %s (option "
-			"removed, use infra-host-ttl)", (yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+			"removed, use infra-host-ttl)", (yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2991 "util/configparser.c"
     break;
 
-  case 203:
-/* Line 1792 of yacc.c  */
-#line 762 "util/configparser.y"
-    {
-		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 243: /* server_infra_cache_numhosts: VAR_INFRA_CACHE_NUMHOSTS STRING_ARG  */
+#line 961 "util/configparser.y"
+        {
+		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3003 "util/configparser.c"
     break;
 
-  case 204:
-/* Line 1792 of yacc.c  */
-#line 771 "util/configparser.y"
-    {
-		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 244: /* server_infra_cache_lame_size: VAR_INFRA_CACHE_LAME_SIZE STRING_ARG  */
+#line 970 "util/configparser.y"
+        {
+		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-cache-lame-size: %s "
-			"(option removed, use infra-cache-numhosts)", (yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+			"(option removed, use infra-cache-numhosts)", (yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3014 "util/configparser.c"
     break;
 
-  case 205:
-/* Line 1792 of yacc.c  */
-#line 779 "util/configparser.y"
-    {
-		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 245: /* server_infra_cache_slabs: VAR_INFRA_CACHE_SLABS STRING_ARG  */
+#line 978 "util/configparser.y"
+        {
+		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else {
-			cfg_parser->cfg->infra_cache_slabs = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->infra_cache_slabs = atoi((yyvsp[0].str));
 			if(!is_pow2(cfg_parser->cfg->infra_cache_slabs))
 				yyerror("must be a power of 2");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3030 "util/configparser.c"
     break;
 
-  case 206:
-/* Line 1792 of yacc.c  */
-#line 792 "util/configparser.y"
-    {
-		OUTYY(("P(server_infra_cache_min_rtt:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 246: /* server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG  */
+#line 991 "util/configparser.y"
+        {
+		OUTYY(("P(server_infra_cache_min_rtt:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->infra_cache_min_rtt = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->infra_cache_min_rtt = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3042 "util/configparser.c"
     break;
 
-  case 207:
-/* Line 1792 of yacc.c  */
-#line 801 "util/configparser.y"
-    {
-		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 247: /* server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG  */
+#line 1000 "util/configparser.y"
+        {
+		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->target_fetch_policy);
-		cfg_parser->cfg->target_fetch_policy = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->target_fetch_policy = (yyvsp[0].str);
 	}
+#line 3052 "util/configparser.c"
     break;
 
-  case 208:
-/* Line 1792 of yacc.c  */
-#line 808 "util/configparser.y"
-    {
-		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 248: /* server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG  */
+#line 1007 "util/configparser.y"
+        {
+		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->harden_short_bufsize = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3065 "util/configparser.c"
     break;
 
-  case 209:
-/* Line 1792 of yacc.c  */
-#line 818 "util/configparser.y"
-    {
-		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 249: /* server_harden_large_queries: VAR_HARDEN_LARGE_QUERIES STRING_ARG  */
+#line 1017 "util/configparser.y"
+        {
+		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->harden_large_queries = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3078 "util/configparser.c"
     break;
 
-  case 210:
-/* Line 1792 of yacc.c  */
-#line 828 "util/configparser.y"
-    {
-		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 250: /* server_harden_glue: VAR_HARDEN_GLUE STRING_ARG  */
+#line 1027 "util/configparser.y"
+        {
+		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->harden_glue = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3091 "util/configparser.c"
     break;
 
-  case 211:
-/* Line 1792 of yacc.c  */
-#line 838 "util/configparser.y"
-    {
-		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 251: /* server_harden_dnssec_stripped: VAR_HARDEN_DNSSEC_STRIPPED STRING_ARG  */
+#line 1037 "util/configparser.y"
+        {
+		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->harden_dnssec_stripped = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3104 "util/configparser.c"
+    break;
+
+  case 252: /* server_harden_below_nxdomain: VAR_HARDEN_BELOW_NXDOMAIN STRING_ARG  */
+#line 1047 "util/configparser.y"
+        {
+		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->harden_below_nxdomain = 
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3117 "util/configparser.c"
+    break;
+
+  case 253: /* server_harden_referral_path: VAR_HARDEN_REFERRAL_PATH STRING_ARG  */
+#line 1057 "util/configparser.y"
+        {
+		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->harden_referral_path = 
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3130 "util/configparser.c"
+    break;
+
+  case 254: /* server_harden_algo_downgrade: VAR_HARDEN_ALGO_DOWNGRADE STRING_ARG  */
+#line 1067 "util/configparser.y"
+        {
+		OUTYY(("P(server_harden_algo_downgrade:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->harden_algo_downgrade = 
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3143 "util/configparser.c"
+    break;
+
+  case 255: /* server_use_caps_for_id: VAR_USE_CAPS_FOR_ID STRING_ARG  */
+#line 1077 "util/configparser.y"
+        {
+		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->use_caps_bits_for_id = 
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3156 "util/configparser.c"
+    break;
+
+  case 256: /* server_caps_whitelist: VAR_CAPS_WHITELIST STRING_ARG  */
+#line 1087 "util/configparser.y"
+        {
+		OUTYY(("P(server_caps_whitelist:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->caps_whitelist, (yyvsp[0].str)))
+			yyerror("out of memory");
 	}
+#line 3166 "util/configparser.c"
     break;
 
-  case 212:
-/* Line 1792 of yacc.c  */
-#line 848 "util/configparser.y"
-    {
-		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
-			yyerror("expected yes or no.");
-		else cfg_parser->cfg->harden_below_nxdomain = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+  case 257: /* server_private_address: VAR_PRIVATE_ADDRESS STRING_ARG  */
+#line 1094 "util/configparser.y"
+        {
+		OUTYY(("P(server_private_address:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[0].str)))
+			yyerror("out of memory");
 	}
+#line 3176 "util/configparser.c"
     break;
 
-  case 213:
-/* Line 1792 of yacc.c  */
-#line 858 "util/configparser.y"
-    {
-		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
-			yyerror("expected yes or no.");
-		else cfg_parser->cfg->harden_referral_path = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+  case 258: /* server_private_domain: VAR_PRIVATE_DOMAIN STRING_ARG  */
+#line 1101 "util/configparser.y"
+        {
+		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[0].str)))
+			yyerror("out of memory");
 	}
+#line 3186 "util/configparser.c"
     break;
 
-  case 214:
-/* Line 1792 of yacc.c  */
-#line 868 "util/configparser.y"
-    {
-		OUTYY(("P(server_harden_algo_downgrade:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 259: /* server_prefetch: VAR_PREFETCH STRING_ARG  */
+#line 1108 "util/configparser.y"
+        {
+		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->harden_algo_downgrade = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3198 "util/configparser.c"
     break;
 
-  case 215:
-/* Line 1792 of yacc.c  */
-#line 878 "util/configparser.y"
-    {
-		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 260: /* server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG  */
+#line 1117 "util/configparser.y"
+        {
+		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->use_caps_bits_for_id = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3210 "util/configparser.c"
     break;
 
-  case 216:
-/* Line 1792 of yacc.c  */
-#line 888 "util/configparser.y"
-    {
-		OUTYY(("P(server_caps_whitelist:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->caps_whitelist, (yyvsp[(2) - (2)].str)))
-			yyerror("out of memory");
+  case 261: /* server_serve_expired: VAR_SERVE_EXPIRED STRING_ARG  */
+#line 1126 "util/configparser.y"
+        {
+		OUTYY(("P(server_serve_expired:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->serve_expired = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3222 "util/configparser.c"
     break;
 
-  case 217:
-/* Line 1792 of yacc.c  */
-#line 895 "util/configparser.y"
-    {
-		OUTYY(("P(server_private_address:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[(2) - (2)].str)))
-			yyerror("out of memory");
+  case 262: /* server_serve_expired_ttl: VAR_SERVE_EXPIRED_TTL STRING_ARG  */
+#line 1135 "util/configparser.y"
+        {
+		OUTYY(("P(server_serve_expired_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->serve_expired_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3234 "util/configparser.c"
     break;
 
-  case 218:
-/* Line 1792 of yacc.c  */
-#line 902 "util/configparser.y"
-    {
-		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[(2) - (2)].str)))
-			yyerror("out of memory");
+  case 263: /* server_serve_expired_reply_ttl: VAR_SERVE_EXPIRED_REPLY_TTL STRING_ARG  */
+#line 1144 "util/configparser.y"
+        {
+		OUTYY(("P(server_serve_expired_reply_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->serve_expired_reply_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3246 "util/configparser.c"
     break;
 
-  case 219:
-/* Line 1792 of yacc.c  */
-#line 909 "util/configparser.y"
-    {
-		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
-			yyerror("expected yes or no.");
-		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+  case 264: /* server_cache_snapshot_file: VAR_CACHE_SNAPSHOT_FILE STRING_ARG  */
+#line 1153 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_snapshot_file:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->cache_snapshot_file);
+		cfg_parser->cfg->cache_snapshot_file = (yyvsp[0].str);
 	}
+#line 3256 "util/configparser.c"
     break;
 
-  case 220:
-/* Line 1792 of yacc.c  */
-#line 918 "util/configparser.y"
-    {
-		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
-			yyerror("expected yes or no.");
-		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+  case 265: /* server_cache_snapshot_interval: VAR_CACHE_SNAPSHOT_INTERVAL STRING_ARG  */
+#line 1160 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_snapshot_interval:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->cache_snapshot_interval = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3268 "util/configparser.c"
     break;
 
-  case 221:
-/* Line 1792 of yacc.c  */
-#line 927 "util/configparser.y"
-    {
-		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 266: /* server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG  */
+#line 1169 "util/configparser.y"
+        {
+		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3280 "util/configparser.c"
     break;
 
-  case 222:
-/* Line 1792 of yacc.c  */
-#line 936 "util/configparser.y"
-    {
-		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[(2) - (2)].str)))
+  case 267: /* server_do_not_query_address: VAR_DO_NOT_QUERY_ADDRESS STRING_ARG  */
+#line 1178 "util/configparser.y"
+        {
+		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3290 "util/configparser.c"
     break;
 
-  case 223:
-/* Line 1792 of yacc.c  */
-#line 943 "util/configparser.y"
-    {
-		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 268: /* server_do_not_query_localhost: VAR_DO_NOT_QUERY_LOCALHOST STRING_ARG  */
+#line 1185 "util/configparser.y"
+        {
+		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->donotquery_localhost = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3303 "util/configparser.c"
     break;
 
-  case 224:
-/* Line 1792 of yacc.c  */
-#line 953 "util/configparser.y"
-    {
-		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)));
-		if(strcmp((yyvsp[(3) - (3)].str), "deny")!=0 && strcmp((yyvsp[(3) - (3)].str), "refuse")!=0 &&
-			strcmp((yyvsp[(3) - (3)].str), "deny_non_local")!=0 &&
-			strcmp((yyvsp[(3) - (3)].str), "refuse_non_local")!=0 &&
-			strcmp((yyvsp[(3) - (3)].str), "allow")!=0 && 
-			strcmp((yyvsp[(3) - (3)].str), "allow_snoop")!=0) {
+  case 269: /* server_access_control: VAR_ACCESS_CONTROL STRING_ARG STRING_ARG  */
+#line 1195 "util/configparser.y"
+        {
+		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "deny")!=0 && strcmp((yyvsp[0].str), "refuse")!=0 &&
+			strcmp((yyvsp[0].str), "deny_non_local")!=0 &&
+			strcmp((yyvsp[0].str), "refuse_non_local")!=0 &&
+			strcmp((yyvsp[0].str), "allow")!=0 && 
+			strcmp((yyvsp[0].str), "allow_snoop")!=0) {
 			yyerror("expected deny, refuse, deny_non_local, "
 				"refuse_non_local, allow or allow_snoop "
 				"in access control action");
 		} else {
-			if(!cfg_str2list_insert(&cfg_parser->cfg->acls, (yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)))
+			if(!cfg_str2list_insert(&cfg_parser->cfg->acls, (yyvsp[-1].str), (yyvsp[0].str)))
 				fatal_exit("out of memory adding acl");
 		}
 	}
+#line 3323 "util/configparser.c"
     break;
 
-  case 225:
-/* Line 1792 of yacc.c  */
-#line 970 "util/configparser.y"
-    {
-		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 270: /* server_module_conf: VAR_MODULE_CONF STRING_ARG  */
+#line 1212 "util/configparser.y"
+        {
+		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->module_conf);
-		cfg_parser->cfg->module_conf = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->module_conf = (yyvsp[0].str);
 	}
+#line 3333 "util/configparser.c"
     break;
 
-  case 226:
-/* Line 1792 of yacc.c  */
-#line 977 "util/configparser.y"
-    {
-		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strlen((yyvsp[(2) - (2)].str)) == 0 || strcmp((yyvsp[(2) - (2)].str), "0") == 0) {
+  case 271: /* server_val_override_date: VAR_VAL_OVERRIDE_DATE STRING_ARG  */
+#line 1219 "util/configparser.y"
+        {
+		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[0].str)));
+		if(strlen((yyvsp[0].str)) == 0 || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_date_override = 0;
-		} else if(strlen((yyvsp[(2) - (2)].str)) == 14) {
+		} else if(strlen((yyvsp[0].str)) == 14) {
 			cfg_parser->cfg->val_date_override = 
-				cfg_convert_timeval((yyvsp[(2) - (2)].str));
+				cfg_convert_timeval((yyvsp[0].str));
 			if(!cfg_parser->cfg->val_date_override)
 				yyerror("bad date/time specification");
 		} else {
-			if(atoi((yyvsp[(2) - (2)].str)) == 0)
+			if(atoi((yyvsp[0].str)) == 0)
 				yyerror("number expected");
-			cfg_parser->cfg->val_date_override = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->val_date_override = atoi((yyvsp[0].str));
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3354 "util/configparser.c"
     break;
 
-  case 227:
-/* Line 1792 of yacc.c  */
-#line 995 "util/configparser.y"
-    {
-		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strlen((yyvsp[(2) - (2)].str)) == 0 || strcmp((yyvsp[(2) - (2)].str), "0") == 0) {
+  case 272: /* server_val_sig_skew_min: VAR_VAL_SIG_SKEW_MIN STRING_ARG  */
+#line 1237 "util/configparser.y"
+        {
+		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[0].str)));
+		if(strlen((yyvsp[0].str)) == 0 || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_min = 0;
 		} else {
-			cfg_parser->cfg->val_sig_skew_min = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->val_sig_skew_min = atoi((yyvsp[0].str));
 			if(!cfg_parser->cfg->val_sig_skew_min)
 				yyerror("number expected");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3370 "util/configparser.c"
     break;
 
-  case 228:
-/* Line 1792 of yacc.c  */
-#line 1008 "util/configparser.y"
-    {
-		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strlen((yyvsp[(2) - (2)].str)) == 0 || strcmp((yyvsp[(2) - (2)].str), "0") == 0) {
+  case 273: /* server_val_sig_skew_max: VAR_VAL_SIG_SKEW_MAX STRING_ARG  */
+#line 1250 "util/configparser.y"
+        {
+		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[0].str)));
+		if(strlen((yyvsp[0].str)) == 0 || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_max = 0;
 		} else {
-			cfg_parser->cfg->val_sig_skew_max = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->val_sig_skew_max = atoi((yyvsp[0].str));
 			if(!cfg_parser->cfg->val_sig_skew_max)
 				yyerror("number expected");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3386 "util/configparser.c"
     break;
 
-  case 229:
-/* Line 1792 of yacc.c  */
-#line 1021 "util/configparser.y"
-    {
-		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 274: /* server_cache_max_ttl: VAR_CACHE_MAX_TTL STRING_ARG  */
+#line 1263 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->max_ttl = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->max_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3398 "util/configparser.c"
     break;
 
-  case 230:
-/* Line 1792 of yacc.c  */
-#line 1030 "util/configparser.y"
-    {
-		OUTYY(("P(server_cache_max_negative_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 275: /* server_cache_max_negative_ttl: VAR_CACHE_MAX_NEGATIVE_TTL STRING_ARG  */
+#line 1272 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_max_negative_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->max_negative_ttl = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->max_negative_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3410 "util/configparser.c"
     break;
 
-  case 231:
-/* Line 1792 of yacc.c  */
-#line 1039 "util/configparser.y"
-    {
-		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 276: /* server_cache_min_ttl: VAR_CACHE_MIN_TTL STRING_ARG  */
+#line 1281 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->min_ttl = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->min_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3422 "util/configparser.c"
     break;
 
-  case 232:
-/* Line 1792 of yacc.c  */
-#line 1048 "util/configparser.y"
-    {
-		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 277: /* server_bogus_ttl: VAR_BOGUS_TTL STRING_ARG  */
+#line 1290 "util/configparser.y"
+        {
+		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3434 "util/configparser.c"
     break;
 
-  case 233:
-/* Line 1792 of yacc.c  */
-#line 1057 "util/configparser.y"
-    {
-		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 278: /* server_val_clean_additional: VAR_VAL_CLEAN_ADDITIONAL STRING_ARG  */
+#line 1299 "util/configparser.y"
+        {
+		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->val_clean_additional = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3447 "util/configparser.c"
     break;
 
-  case 234:
-/* Line 1792 of yacc.c  */
-#line 1067 "util/configparser.y"
-    {
-		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 279: /* server_val_permissive_mode: VAR_VAL_PERMISSIVE_MODE STRING_ARG  */
+#line 1309 "util/configparser.y"
+        {
+		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->val_permissive_mode = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3460 "util/configparser.c"
     break;
 
-  case 235:
-/* Line 1792 of yacc.c  */
-#line 1077 "util/configparser.y"
-    {
-		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 280: /* server_ignore_cd_flag: VAR_IGNORE_CD_FLAG STRING_ARG  */
+#line 1319 "util/configparser.y"
+        {
+		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3472 "util/configparser.c"
     break;
 
-  case 236:
-/* Line 1792 of yacc.c  */
-#line 1086 "util/configparser.y"
-    {
-		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 281: /* server_val_log_level: VAR_VAL_LOG_LEVEL STRING_ARG  */
+#line 1328 "util/configparser.y"
+        {
+		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->val_log_level = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->val_log_level = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3484 "util/configparser.c"
     break;
 
-  case 237:
-/* Line 1792 of yacc.c  */
-#line 1095 "util/configparser.y"
-    {
-		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 282: /* server_val_nsec3_keysize_iterations: VAR_VAL_NSEC3_KEYSIZE_ITERATIONS STRING_ARG  */
+#line 1337 "util/configparser.y"
+        {
+		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->val_nsec3_key_iterations);
-		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[0].str);
 	}
+#line 3494 "util/configparser.c"
     break;
 
-  case 238:
-/* Line 1792 of yacc.c  */
-#line 1102 "util/configparser.y"
-    {
-		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 283: /* server_add_holddown: VAR_ADD_HOLDDOWN STRING_ARG  */
+#line 1344 "util/configparser.y"
+        {
+		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->add_holddown = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->add_holddown = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3506 "util/configparser.c"
     break;
 
-  case 239:
-/* Line 1792 of yacc.c  */
-#line 1111 "util/configparser.y"
-    {
-		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 284: /* server_del_holddown: VAR_DEL_HOLDDOWN STRING_ARG  */
+#line 1353 "util/configparser.y"
+        {
+		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->del_holddown = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->del_holddown = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3518 "util/configparser.c"
     break;
 
-  case 240:
-/* Line 1792 of yacc.c  */
-#line 1120 "util/configparser.y"
-    {
-		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 285: /* server_keep_missing: VAR_KEEP_MISSING STRING_ARG  */
+#line 1362 "util/configparser.y"
+        {
+		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->keep_missing = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->keep_missing = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3530 "util/configparser.c"
     break;
 
-  case 241:
-/* Line 1792 of yacc.c  */
-#line 1129 "util/configparser.y"
-    {
-		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->key_cache_size))
+  case 286: /* server_key_cache_size: VAR_KEY_CACHE_SIZE STRING_ARG  */
+#line 1371 "util/configparser.y"
+        {
+		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->key_cache_size))
 			yyerror("memory size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3541 "util/configparser.c"
     break;
 
-  case 242:
-/* Line 1792 of yacc.c  */
-#line 1137 "util/configparser.y"
-    {
-		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 287: /* server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG  */
+#line 1379 "util/configparser.y"
+        {
+		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else {
-			cfg_parser->cfg->key_cache_slabs = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->key_cache_slabs = atoi((yyvsp[0].str));
 			if(!is_pow2(cfg_parser->cfg->key_cache_slabs))
 				yyerror("must be a power of 2");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3557 "util/configparser.c"
     break;
 
-  case 243:
-/* Line 1792 of yacc.c  */
-#line 1150 "util/configparser.y"
-    {
-		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->neg_cache_size))
+  case 288: /* server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG  */
+#line 1392 "util/configparser.y"
+        {
+		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->neg_cache_size))
 			yyerror("memory size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3568 "util/configparser.c"
     break;
 
-  case 244:
-/* Line 1792 of yacc.c  */
-#line 1158 "util/configparser.y"
-    {
-		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)));
-		if(strcmp((yyvsp[(3) - (3)].str), "static")!=0 && strcmp((yyvsp[(3) - (3)].str), "deny")!=0 &&
-		   strcmp((yyvsp[(3) - (3)].str), "refuse")!=0 && strcmp((yyvsp[(3) - (3)].str), "redirect")!=0 &&
-		   strcmp((yyvsp[(3) - (3)].str), "transparent")!=0 && strcmp((yyvsp[(3) - (3)].str), "nodefault")!=0
-		   && strcmp((yyvsp[(3) - (3)].str), "typetransparent")!=0 &&
-		   strcmp((yyvsp[(3) - (3)].str), "inform")!=0 && strcmp((yyvsp[(3) - (3)].str), "inform_deny")!=0)
+  case 289: /* server_aggressive_nsec: VAR_AGGRESSIVE_NSEC STRING_ARG  */
+#line 1400 "util/configparser.y"
+        {
+		OUTYY(("P(server_aggressive_nsec:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->aggressive_nsec =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3581 "util/configparser.c"
+    break;
+
+  case 290: /* server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 1410 "util/configparser.y"
+        {
+		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
+		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
+		   strcmp((yyvsp[0].str), "transparent")!=0 && strcmp((yyvsp[0].str), "nodefault")!=0
+		   && strcmp((yyvsp[0].str), "typetransparent")!=0 &&
+		   strcmp((yyvsp[0].str), "inform")!=0 && strcmp((yyvsp[0].str), "inform_deny")!=0)
 			yyerror("local-zone type: expected static, deny, "
 				"refuse, redirect, transparent, "
 				"typetransparent, inform, inform_deny "
 				"or nodefault");
-		else if(strcmp((yyvsp[(3) - (3)].str), "nodefault")==0) {
+		else if(strcmp((yyvsp[0].str), "nodefault")==0) {
 			if(!cfg_strlist_insert(&cfg_parser->cfg->
-				local_zones_nodefault, (yyvsp[(2) - (3)].str)))
+				local_zones_nodefault, (yyvsp[-1].str)))
 				fatal_exit("out of memory adding local-zone");
-			free((yyvsp[(3) - (3)].str));
+			free((yyvsp[0].str));
 		} else {
 			if(!cfg_str2list_insert(&cfg_parser->cfg->local_zones, 
-				(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)))
+				(yyvsp[-1].str), (yyvsp[0].str)))
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
+#line 3608 "util/configparser.c"
     break;
 
-  case 245:
-/* Line 1792 of yacc.c  */
-#line 1182 "util/configparser.y"
-    {
-		OUTYY(("P(server_local_data:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[(2) - (2)].str)))
+  case 291: /* server_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 1434 "util/configparser.y"
+        {
+		OUTYY(("P(server_local_data:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[0].str)))
 			fatal_exit("out of memory adding local-data");
 	}
+#line 3618 "util/configparser.c"
     break;
 
-  case 246:
-/* Line 1792 of yacc.c  */
-#line 1189 "util/configparser.y"
-    {
+  case 292: /* server_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 1441 "util/configparser.y"
+        {
 		char* ptr;
-		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[(2) - (2)].str)));
-		ptr = cfg_ptr_reverse((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[0].str)));
+		ptr = cfg_ptr_reverse((yyvsp[0].str));
+		free((yyvsp[0].str));
 		if(ptr) {
 			if(!cfg_strlist_insert(&cfg_parser->cfg->
 				local_data, ptr))
@@ -3574,512 +3632,609 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
+#line 3636 "util/configparser.c"
     break;
 
-  case 247:
-/* Line 1792 of yacc.c  */
-#line 1204 "util/configparser.y"
-    {
-		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 293: /* server_minimal_responses: VAR_MINIMAL_RESPONSES STRING_ARG  */
+#line 1456 "util/configparser.y"
+        {
+		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->minimal_responses =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3649 "util/configparser.c"
     break;
 
-  case 248:
-/* Line 1792 of yacc.c  */
-#line 1214 "util/configparser.y"
-    {
-		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 294: /* server_rrset_roundrobin: VAR_RRSET_ROUNDROBIN STRING_ARG  */
+#line 1466 "util/configparser.y"
+        {
+		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->rrset_roundrobin =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3662 "util/configparser.c"
     break;
 
-  case 249:
-/* Line 1792 of yacc.c  */
-#line 1224 "util/configparser.y"
-    {
-		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		cfg_parser->cfg->max_udp_size = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+  case 295: /* server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG  */
+#line 1476 "util/configparser.y"
+        {
+		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[0].str)));
+		cfg_parser->cfg->max_udp_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3672 "util/configparser.c"
     break;
 
-  case 250:
-/* Line 1792 of yacc.c  */
-#line 1231 "util/configparser.y"
-    {
-		OUTYY(("P(dns64_prefix:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 296: /* server_dns64_prefix: VAR_DNS64_PREFIX STRING_ARG  */
+#line 1483 "util/configparser.y"
+        {
+		OUTYY(("P(dns64_prefix:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dns64_prefix);
-		cfg_parser->cfg->dns64_prefix = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->dns64_prefix = (yyvsp[0].str);
 	}
+#line 3682 "util/configparser.c"
     break;
 
-  case 251:
-/* Line 1792 of yacc.c  */
-#line 1238 "util/configparser.y"
-    {
-		OUTYY(("P(server_dns64_synthall:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 297: /* server_dns64_synthall: VAR_DNS64_SYNTHALL STRING_ARG  */
+#line 1490 "util/configparser.y"
+        {
+		OUTYY(("P(server_dns64_synthall:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->dns64_synthall = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->dns64_synthall = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3694 "util/configparser.c"
     break;
 
-  case 252:
-/* Line 1792 of yacc.c  */
-#line 1247 "util/configparser.y"
-    { 
-		OUTYY(("P(server_ratelimit:%s)\n", (yyvsp[(2) - (2)].str))); 
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 298: /* server_ratelimit: VAR_RATELIMIT STRING_ARG  */
+#line 1499 "util/configparser.y"
+        { 
+		OUTYY(("P(server_ratelimit:%s)\n", (yyvsp[0].str))); 
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->ratelimit = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->ratelimit = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3706 "util/configparser.c"
     break;
 
-  case 253:
-/* Line 1792 of yacc.c  */
-#line 1256 "util/configparser.y"
-    {
-		OUTYY(("P(server_ratelimit_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->ratelimit_size))
+  case 299: /* server_ratelimit_size: VAR_RATELIMIT_SIZE STRING_ARG  */
+#line 1508 "util/configparser.y"
+        {
+		OUTYY(("P(server_ratelimit_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ratelimit_size))
 			yyerror("memory size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3717 "util/configparser.c"
     break;
 
-  case 254:
-/* Line 1792 of yacc.c  */
-#line 1264 "util/configparser.y"
-    {
-		OUTYY(("P(server_ratelimit_slabs:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 300: /* server_ratelimit_slabs: VAR_RATELIMIT_SLABS STRING_ARG  */
+#line 1516 "util/configparser.y"
+        {
+		OUTYY(("P(server_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else {
-			cfg_parser->cfg->ratelimit_slabs = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->ratelimit_slabs = atoi((yyvsp[0].str));
 			if(!is_pow2(cfg_parser->cfg->ratelimit_slabs))
 				yyerror("must be a power of 2");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3733 "util/configparser.c"
     break;
 
-  case 255:
-/* Line 1792 of yacc.c  */
-#line 1277 "util/configparser.y"
-    {
-		OUTYY(("P(server_ratelimit_for_domain:%s %s)\n", (yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)));
-		if(atoi((yyvsp[(3) - (3)].str)) == 0 && strcmp((yyvsp[(3) - (3)].str), "0") != 0) {
+  case 301: /* server_ratelimit_for_domain: VAR_RATELIMIT_FOR_DOMAIN STRING_ARG STRING_ARG  */
+#line 1529 "util/configparser.y"
+        {
+		OUTYY(("P(server_ratelimit_for_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
 		} else {
 			if(!cfg_str2list_insert(&cfg_parser->cfg->
-				ratelimit_for_domain, (yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)))
+				ratelimit_for_domain, (yyvsp[-1].str), (yyvsp[0].str)))
 				fatal_exit("out of memory adding "
 					"ratelimit-for-domain");
 		}
 	}
+#line 3749 "util/configparser.c"
     break;
 
-  case 256:
-/* Line 1792 of yacc.c  */
-#line 1290 "util/configparser.y"
-    {
-		OUTYY(("P(server_ratelimit_below_domain:%s %s)\n", (yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)));
-		if(atoi((yyvsp[(3) - (3)].str)) == 0 && strcmp((yyvsp[(3) - (3)].str), "0") != 0) {
+  case 302: /* server_ratelimit_below_domain: VAR_RATELIMIT_BELOW_DOMAIN STRING_ARG STRING_ARG  */
+#line 1542 "util/configparser.y"
+        {
+		OUTYY(("P(server_ratelimit_below_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
 		} else {
 			if(!cfg_str2list_insert(&cfg_parser->cfg->
-				ratelimit_below_domain, (yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)))
+				ratelimit_below_domain, (yyvsp[-1].str), (yyvsp[0].str)))
 				fatal_exit("out of memory adding "
 					"ratelimit-below-domain");
 		}
 	}
+#line 3765 "util/configparser.c"
     break;
 
-  case 257:
-/* Line 1792 of yacc.c  */
-#line 1303 "util/configparser.y"
-    { 
-		OUTYY(("P(server_ratelimit_factor:%s)\n", (yyvsp[(2) - (2)].str))); 
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 303: /* server_ratelimit_factor: VAR_RATELIMIT_FACTOR STRING_ARG  */
+#line 1555 "util/configparser.y"
+        { 
+		OUTYY(("P(server_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->ratelimit_factor = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->ratelimit_factor = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3777 "util/configparser.c"
     break;
 
-  case 258:
-/* Line 1792 of yacc.c  */
-#line 1312 "util/configparser.y"
-    {
-		OUTYY(("P(name:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 304: /* stub_name: VAR_NAME STRING_ARG  */
+#line 1564 "util/configparser.y"
+        {
+		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->stubs->name)
 			yyerror("stub name override, there must be one name "
 				"for one stub-zone");
 		free(cfg_parser->cfg->stubs->name);
-		cfg_parser->cfg->stubs->name = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->stubs->name = (yyvsp[0].str);
 	}
+#line 3790 "util/configparser.c"
     break;
 
-  case 259:
-/* Line 1792 of yacc.c  */
-#line 1322 "util/configparser.y"
-    {
-		OUTYY(("P(stub-host:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[(2) - (2)].str)))
+  case 305: /* stub_host: VAR_STUB_HOST STRING_ARG  */
+#line 1574 "util/configparser.y"
+        {
+		OUTYY(("P(stub-host:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3800 "util/configparser.c"
     break;
 
-  case 260:
-/* Line 1792 of yacc.c  */
-#line 1329 "util/configparser.y"
-    {
-		OUTYY(("P(stub-addr:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[(2) - (2)].str)))
+  case 306: /* stub_addr: VAR_STUB_ADDR STRING_ARG  */
+#line 1581 "util/configparser.y"
+        {
+		OUTYY(("P(stub-addr:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3810 "util/configparser.c"
     break;
 
-  case 261:
-/* Line 1792 of yacc.c  */
-#line 1336 "util/configparser.y"
-    {
-		OUTYY(("P(stub-first:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 307: /* stub_first: VAR_STUB_FIRST STRING_ARG  */
+#line 1588 "util/configparser.y"
+        {
+		OUTYY(("P(stub-first:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3822 "util/configparser.c"
     break;
 
-  case 262:
-/* Line 1792 of yacc.c  */
-#line 1345 "util/configparser.y"
-    {
-		OUTYY(("P(stub-prime:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 308: /* stub_prime: VAR_STUB_PRIME STRING_ARG  */
+#line 1597 "util/configparser.y"
+        {
+		OUTYY(("P(stub-prime:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stubs->isprime = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3835 "util/configparser.c"
     break;
 
-  case 263:
-/* Line 1792 of yacc.c  */
-#line 1355 "util/configparser.y"
-    {
-		OUTYY(("P(name:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 309: /* forward_name: VAR_NAME STRING_ARG  */
+#line 1607 "util/configparser.y"
+        {
+		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->forwards->name)
 			yyerror("forward name override, there must be one "
 				"name for one forward-zone");
 		free(cfg_parser->cfg->forwards->name);
-		cfg_parser->cfg->forwards->name = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->forwards->name = (yyvsp[0].str);
 	}
+#line 3848 "util/configparser.c"
     break;
 
-  case 264:
-/* Line 1792 of yacc.c  */
-#line 1365 "util/configparser.y"
-    {
-		OUTYY(("P(forward-host:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[(2) - (2)].str)))
+  case 310: /* forward_host: VAR_FORWARD_HOST STRING_ARG  */
+#line 1617 "util/configparser.y"
+        {
+		OUTYY(("P(forward-host:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3858 "util/configparser.c"
     break;
 
-  case 265:
-/* Line 1792 of yacc.c  */
-#line 1372 "util/configparser.y"
-    {
-		OUTYY(("P(forward-addr:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[(2) - (2)].str)))
+  case 311: /* forward_addr: VAR_FORWARD_ADDR STRING_ARG  */
+#line 1624 "util/configparser.y"
+        {
+		OUTYY(("P(forward-addr:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3868 "util/configparser.c"
     break;
 
-  case 266:
-/* Line 1792 of yacc.c  */
-#line 1379 "util/configparser.y"
-    {
-		OUTYY(("P(forward-first:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 312: /* forward_first: VAR_FORWARD_FIRST STRING_ARG  */
+#line 1631 "util/configparser.y"
+        {
+		OUTYY(("P(forward-first:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3880 "util/configparser.c"
     break;
 
-  case 267:
-/* Line 1792 of yacc.c  */
-#line 1388 "util/configparser.y"
-    { 
+  case 313: /* rcstart: VAR_REMOTE_CONTROL  */
+#line 1640 "util/configparser.y"
+        { 
 		OUTYY(("\nP(remote-control:)\n")); 
 	}
+#line 3888 "util/configparser.c"
     break;
 
-  case 278:
-/* Line 1792 of yacc.c  */
-#line 1399 "util/configparser.y"
-    {
-		OUTYY(("P(control_enable:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 324: /* rc_control_enable: VAR_CONTROL_ENABLE STRING_ARG  */
+#line 1651 "util/configparser.y"
+        {
+		OUTYY(("P(control_enable:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->remote_control_enable = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3901 "util/configparser.c"
     break;
 
-  case 279:
-/* Line 1792 of yacc.c  */
-#line 1409 "util/configparser.y"
-    {
-		OUTYY(("P(control_port:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 325: /* rc_control_port: VAR_CONTROL_PORT STRING_ARG  */
+#line 1661 "util/configparser.y"
+        {
+		OUTYY(("P(control_port:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("control port number expected");
-		else cfg_parser->cfg->control_port = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->control_port = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3913 "util/configparser.c"
     break;
 
-  case 280:
-/* Line 1792 of yacc.c  */
-#line 1418 "util/configparser.y"
-    {
-		OUTYY(("P(control_interface:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->control_ifs, (yyvsp[(2) - (2)].str)))
+  case 326: /* rc_control_interface: VAR_CONTROL_INTERFACE STRING_ARG  */
+#line 1670 "util/configparser.y"
+        {
+		OUTYY(("P(control_interface:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->control_ifs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3923 "util/configparser.c"
     break;
 
-  case 281:
-/* Line 1792 of yacc.c  */
-#line 1425 "util/configparser.y"
-    {
-		OUTYY(("P(control_use_cert:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 327: /* rc_control_use_cert: VAR_CONTROL_USE_CERT STRING_ARG  */
+#line 1677 "util/configparser.y"
+        {
+		OUTYY(("P(control_use_cert:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->remote_control_use_cert =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3936 "util/configparser.c"
     break;
 
-  case 282:
-/* Line 1792 of yacc.c  */
-#line 1435 "util/configparser.y"
-    {
-		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 328: /* rc_server_key_file: VAR_SERVER_KEY_FILE STRING_ARG  */
+#line 1687 "util/configparser.y"
+        {
+		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_key_file);
-		cfg_parser->cfg->server_key_file = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->server_key_file = (yyvsp[0].str);
 	}
+#line 3946 "util/configparser.c"
     break;
 
-  case 283:
-/* Line 1792 of yacc.c  */
-#line 1442 "util/configparser.y"
-    {
-		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 329: /* rc_server_cert_file: VAR_SERVER_CERT_FILE STRING_ARG  */
+#line 1694 "util/configparser.y"
+        {
+		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_cert_file);
-		cfg_parser->cfg->server_cert_file = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->server_cert_file = (yyvsp[0].str);
 	}
+#line 3956 "util/configparser.c"
     break;
 
-  case 284:
-/* Line 1792 of yacc.c  */
-#line 1449 "util/configparser.y"
-    {
-		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 330: /* rc_control_key_file: VAR_CONTROL_KEY_FILE STRING_ARG  */
+#line 1701 "util/configparser.y"
+        {
+		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_key_file);
-		cfg_parser->cfg->control_key_file = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->control_key_file = (yyvsp[0].str);
 	}
+#line 3966 "util/configparser.c"
     break;
 
-  case 285:
-/* Line 1792 of yacc.c  */
-#line 1456 "util/configparser.y"
-    {
-		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 331: /* rc_control_cert_file: VAR_CONTROL_CERT_FILE STRING_ARG  */
+#line 1708 "util/configparser.y"
+        {
+		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_cert_file);
-		cfg_parser->cfg->control_cert_file = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->control_cert_file = (yyvsp[0].str);
 	}
+#line 3976 "util/configparser.c"
     break;
 
-  case 286:
-/* Line 1792 of yacc.c  */
-#line 1463 "util/configparser.y"
-    {
+  case 332: /* dtstart: VAR_DNSTAP  */
+#line 1715 "util/configparser.y"
+        {
 		OUTYY(("\nP(dnstap:)\n"));
 	}
+#line 3984 "util/configparser.c"
     break;
 
-  case 301:
-/* Line 1792 of yacc.c  */
-#line 1480 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_enable:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 355: /* dt_dnstap_enable: VAR_DNSTAP_ENABLE STRING_ARG  */
+#line 1736 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_enable:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->dnstap = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+		else cfg_parser->cfg->dnstap = (strcmp((yyvsp[0].str), "yes")==0);
 	}
+#line 3995 "util/configparser.c"
     break;
 
-  case 302:
-/* Line 1792 of yacc.c  */
-#line 1488 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_socket_path:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 356: /* dt_dnstap_socket_path: VAR_DNSTAP_SOCKET_PATH STRING_ARG  */
+#line 1744 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_socket_path:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_socket_path);
-		cfg_parser->cfg->dnstap_socket_path = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->dnstap_socket_path = (yyvsp[0].str);
 	}
+#line 4005 "util/configparser.c"
     break;
 
-  case 303:
-/* Line 1792 of yacc.c  */
-#line 1495 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_send_identity:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 357: /* dt_dnstap_ip: VAR_DNSTAP_IP STRING_ARG  */
+#line 1751 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_ip:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->dnstap_ip);
+		cfg_parser->cfg->dnstap_ip = (yyvsp[0].str);
+	}
+#line 4015 "util/configparser.c"
+    break;
+
+  case 358: /* dt_dnstap_file: VAR_DNSTAP_FILE STRING_ARG  */
+#line 1758 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_file:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->dnstap_file);
+		cfg_parser->cfg->dnstap_file = (yyvsp[0].str);
+	}
+#line 4025 "util/configparser.c"
+    break;
+
+  case 359: /* dt_dnstap_file_rotate_size: VAR_DNSTAP_FILE_ROTATE_SIZE STRING_ARG  */
+#line 1765 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_file_rotate_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str),
+			&cfg_parser->cfg->dnstap_file_rotate_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 4037 "util/configparser.c"
+    break;
+
+  case 360: /* dt_dnstap_flush_size: VAR_DNSTAP_FLUSH_SIZE STRING_ARG  */
+#line 1774 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_flush_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnstap_flush_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 4048 "util/configparser.c"
+    break;
+
+  case 361: /* dt_dnstap_flush_time: VAR_DNSTAP_FLUSH_TIME STRING_ARG  */
+#line 1782 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_flush_time:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->dnstap_flush_time = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4060 "util/configparser.c"
+    break;
+
+  case 362: /* dt_dnstap_drop_policy: VAR_DNSTAP_DROP_POLICY STRING_ARG  */
+#line 1791 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_drop_policy:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "drop-newest") != 0 &&
+			strcmp((yyvsp[0].str), "drop-oldest") != 0 &&
+			strcmp((yyvsp[0].str), "sample") != 0) {
+			yyerror("expected drop-newest, drop-oldest or sample");
+			free((yyvsp[0].str));
+		} else {
+			free(cfg_parser->cfg->dnstap_drop_policy);
+			cfg_parser->cfg->dnstap_drop_policy = (yyvsp[0].str);
+		}
+	}
+#line 4077 "util/configparser.c"
+    break;
+
+  case 363: /* dt_dnstap_high_watermark: VAR_DNSTAP_HIGH_WATERMARK STRING_ARG  */
+#line 1805 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_high_watermark:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) < 1 || atoi((yyvsp[0].str)) > 100)
+			yyerror("percentage from 1 to 100 expected");
+		else cfg_parser->cfg->dnstap_high_watermark = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4089 "util/configparser.c"
+    break;
+
+  case 364: /* dt_dnstap_sample_rate: VAR_DNSTAP_SAMPLE_RATE STRING_ARG  */
+#line 1814 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_sample_rate:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) < 1)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->dnstap_sample_rate = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4101 "util/configparser.c"
+    break;
+
+  case 365: /* dt_dnstap_send_identity: VAR_DNSTAP_SEND_IDENTITY STRING_ARG  */
+#line 1823 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_send_identity:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->dnstap_send_identity = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+		else cfg_parser->cfg->dnstap_send_identity = (strcmp((yyvsp[0].str), "yes")==0);
 	}
+#line 4112 "util/configparser.c"
     break;
 
-  case 304:
-/* Line 1792 of yacc.c  */
-#line 1503 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_send_version:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 366: /* dt_dnstap_send_version: VAR_DNSTAP_SEND_VERSION STRING_ARG  */
+#line 1831 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_send_version:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->dnstap_send_version = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+		else cfg_parser->cfg->dnstap_send_version = (strcmp((yyvsp[0].str), "yes")==0);
 	}
+#line 4123 "util/configparser.c"
     break;
 
-  case 305:
-/* Line 1792 of yacc.c  */
-#line 1511 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_identity:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 367: /* dt_dnstap_identity: VAR_DNSTAP_IDENTITY STRING_ARG  */
+#line 1839 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_identity);
-		cfg_parser->cfg->dnstap_identity = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->dnstap_identity = (yyvsp[0].str);
 	}
+#line 4133 "util/configparser.c"
     break;
 
-  case 306:
-/* Line 1792 of yacc.c  */
-#line 1518 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_version:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 368: /* dt_dnstap_version: VAR_DNSTAP_VERSION STRING_ARG  */
+#line 1846 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_version);
-		cfg_parser->cfg->dnstap_version = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->dnstap_version = (yyvsp[0].str);
 	}
+#line 4143 "util/configparser.c"
     break;
 
-  case 307:
-/* Line 1792 of yacc.c  */
-#line 1525 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_log_resolver_query_messages:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 369: /* dt_dnstap_log_resolver_query_messages: VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES STRING_ARG  */
+#line 1853 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_log_resolver_query_messages:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_resolver_query_messages =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+			(strcmp((yyvsp[0].str), "yes")==0);
 	}
+#line 4155 "util/configparser.c"
     break;
 
-  case 308:
-/* Line 1792 of yacc.c  */
-#line 1534 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_log_resolver_response_messages:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 370: /* dt_dnstap_log_resolver_response_messages: VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES STRING_ARG  */
+#line 1862 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_log_resolver_response_messages:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_resolver_response_messages =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+			(strcmp((yyvsp[0].str), "yes")==0);
 	}
+#line 4167 "util/configparser.c"
     break;
 
-  case 309:
-/* Line 1792 of yacc.c  */
-#line 1543 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_log_client_query_messages:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 371: /* dt_dnstap_log_client_query_messages: VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES STRING_ARG  */
+#line 1871 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_log_client_query_messages:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_client_query_messages =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+			(strcmp((yyvsp[0].str), "yes")==0);
 	}
+#line 4179 "util/configparser.c"
     break;
 
-  case 310:
-/* Line 1792 of yacc.c  */
-#line 1552 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_log_client_response_messages:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 372: /* dt_dnstap_log_client_response_messages: VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES STRING_ARG  */
+#line 1880 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_log_client_response_messages:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_client_response_messages =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+			(strcmp((yyvsp[0].str), "yes")==0);
 	}
+#line 4191 "util/configparser.c"
     break;
 
-  case 311:
-/* Line 1792 of yacc.c  */
-#line 1561 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_log_forwarder_query_messages:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 373: /* dt_dnstap_log_forwarder_query_messages: VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES STRING_ARG  */
+#line 1889 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_log_forwarder_query_messages:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_forwarder_query_messages =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+			(strcmp((yyvsp[0].str), "yes")==0);
 	}
+#line 4203 "util/configparser.c"
     break;
 
-  case 312:
-/* Line 1792 of yacc.c  */
-#line 1570 "util/configparser.y"
-    {
-		OUTYY(("P(dt_dnstap_log_forwarder_response_messages:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 374: /* dt_dnstap_log_forwarder_response_messages: VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES STRING_ARG  */
+#line 1898 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_log_forwarder_response_messages:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_forwarder_response_messages =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+			(strcmp((yyvsp[0].str), "yes")==0);
 	}
+#line 4215 "util/configparser.c"
     break;
 
-  case 313:
-/* Line 1792 of yacc.c  */
-#line 1579 "util/configparser.y"
-    { 
+  case 375: /* pythonstart: VAR_PYTHON  */
+#line 1907 "util/configparser.y"
+        { 
 		OUTYY(("\nP(python:)\n")); 
 	}
+#line 4223 "util/configparser.c"
     break;
 
-  case 317:
-/* Line 1792 of yacc.c  */
-#line 1588 "util/configparser.y"
-    {
-		OUTYY(("P(python-script:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 379: /* py_script: VAR_PYTHON_SCRIPT STRING_ARG  */
+#line 1916 "util/configparser.y"
+        {
+		OUTYY(("P(python-script:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->python_script);
-		cfg_parser->cfg->python_script = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->python_script = (yyvsp[0].str);
 	}
+#line 4233 "util/configparser.c"
     break;
 
 
-/* Line 1792 of yacc.c  */
-#line 4083 "util/configparser.c"
+#line 4237 "util/configparser.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -4093,96 +4248,58 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -4194,14 +4311,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -4214,29 +4330,30 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -4248,7 +4365,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -4259,26 +4376,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -4287,31 +4408,25 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
 
+  return yyresult;
+}
 
-/* Line 2055 of yacc.c  */
-#line 1593 "util/configparser.y"
+#line 1921 "util/configparser.y"
 
 
 /* parse helper routines could be here */
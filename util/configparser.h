@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.7.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2012 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
 # define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-/* Enabling traces.  */
+/* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
 #endif
@@ -40,173 +45,212 @@
 extern int yydebug;
 #endif
 
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     SPACE = 258,
-     LETTER = 259,
-     NEWLINE = 260,
-     COMMENT = 261,
-     COLON = 262,
-     ANY = 263,
-     ZONESTR = 264,
-     STRING_ARG = 265,
-     VAR_SERVER = 266,
-     VAR_VERBOSITY = 267,
-     VAR_NUM_THREADS = 268,
-     VAR_PORT = 269,
-     VAR_OUTGOING_RANGE = 270,
-     VAR_INTERFACE = 271,
-     VAR_DO_IP4 = 272,
-     VAR_DO_IP6 = 273,
-     VAR_DO_UDP = 274,
-     VAR_DO_TCP = 275,
-     VAR_CHROOT = 276,
-     VAR_USERNAME = 277,
-     VAR_DIRECTORY = 278,
-     VAR_LOGFILE = 279,
-     VAR_PIDFILE = 280,
-     VAR_MSG_CACHE_SIZE = 281,
-     VAR_MSG_CACHE_SLABS = 282,
-     VAR_NUM_QUERIES_PER_THREAD = 283,
-     VAR_RRSET_CACHE_SIZE = 284,
-     VAR_RRSET_CACHE_SLABS = 285,
-     VAR_OUTGOING_NUM_TCP = 286,
-     VAR_INFRA_HOST_TTL = 287,
-     VAR_INFRA_LAME_TTL = 288,
-     VAR_INFRA_CACHE_SLABS = 289,
-     VAR_INFRA_CACHE_NUMHOSTS = 290,
-     VAR_INFRA_CACHE_LAME_SIZE = 291,
-     VAR_NAME = 292,
-     VAR_STUB_ZONE = 293,
-     VAR_STUB_HOST = 294,
-     VAR_STUB_ADDR = 295,
-     VAR_TARGET_FETCH_POLICY = 296,
-     VAR_HARDEN_SHORT_BUFSIZE = 297,
-     VAR_HARDEN_LARGE_QUERIES = 298,
-     VAR_FORWARD_ZONE = 299,
-     VAR_FORWARD_HOST = 300,
-     VAR_FORWARD_ADDR = 301,
-     VAR_DO_NOT_QUERY_ADDRESS = 302,
-     VAR_HIDE_IDENTITY = 303,
-     VAR_HIDE_VERSION = 304,
-     VAR_IDENTITY = 305,
-     VAR_VERSION = 306,
-     VAR_HARDEN_GLUE = 307,
-     VAR_MODULE_CONF = 308,
-     VAR_TRUST_ANCHOR_FILE = 309,
-     VAR_TRUST_ANCHOR = 310,
-     VAR_VAL_OVERRIDE_DATE = 311,
-     VAR_BOGUS_TTL = 312,
-     VAR_VAL_CLEAN_ADDITIONAL = 313,
-     VAR_VAL_PERMISSIVE_MODE = 314,
-     VAR_INCOMING_NUM_TCP = 315,
-     VAR_MSG_BUFFER_SIZE = 316,
-     VAR_KEY_CACHE_SIZE = 317,
-     VAR_KEY_CACHE_SLABS = 318,
-     VAR_TRUSTED_KEYS_FILE = 319,
-     VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 320,
-     VAR_USE_SYSLOG = 321,
-     VAR_OUTGOING_INTERFACE = 322,
-     VAR_ROOT_HINTS = 323,
-     VAR_DO_NOT_QUERY_LOCALHOST = 324,
-     VAR_CACHE_MAX_TTL = 325,
-     VAR_HARDEN_DNSSEC_STRIPPED = 326,
-     VAR_ACCESS_CONTROL = 327,
-     VAR_LOCAL_ZONE = 328,
-     VAR_LOCAL_DATA = 329,
-     VAR_INTERFACE_AUTOMATIC = 330,
-     VAR_STATISTICS_INTERVAL = 331,
-     VAR_DO_DAEMONIZE = 332,
-     VAR_USE_CAPS_FOR_ID = 333,
-     VAR_STATISTICS_CUMULATIVE = 334,
-     VAR_OUTGOING_PORT_PERMIT = 335,
-     VAR_OUTGOING_PORT_AVOID = 336,
-     VAR_DLV_ANCHOR_FILE = 337,
-     VAR_DLV_ANCHOR = 338,
-     VAR_NEG_CACHE_SIZE = 339,
-     VAR_HARDEN_REFERRAL_PATH = 340,
-     VAR_PRIVATE_ADDRESS = 341,
-     VAR_PRIVATE_DOMAIN = 342,
-     VAR_REMOTE_CONTROL = 343,
-     VAR_CONTROL_ENABLE = 344,
-     VAR_CONTROL_INTERFACE = 345,
-     VAR_CONTROL_PORT = 346,
-     VAR_SERVER_KEY_FILE = 347,
-     VAR_SERVER_CERT_FILE = 348,
-     VAR_CONTROL_KEY_FILE = 349,
-     VAR_CONTROL_CERT_FILE = 350,
-     VAR_CONTROL_USE_CERT = 351,
-     VAR_EXTENDED_STATISTICS = 352,
-     VAR_LOCAL_DATA_PTR = 353,
-     VAR_JOSTLE_TIMEOUT = 354,
-     VAR_STUB_PRIME = 355,
-     VAR_UNWANTED_REPLY_THRESHOLD = 356,
-     VAR_LOG_TIME_ASCII = 357,
-     VAR_DOMAIN_INSECURE = 358,
-     VAR_PYTHON = 359,
-     VAR_PYTHON_SCRIPT = 360,
-     VAR_VAL_SIG_SKEW_MIN = 361,
-     VAR_VAL_SIG_SKEW_MAX = 362,
-     VAR_CACHE_MIN_TTL = 363,
-     VAR_VAL_LOG_LEVEL = 364,
-     VAR_AUTO_TRUST_ANCHOR_FILE = 365,
-     VAR_KEEP_MISSING = 366,
-     VAR_ADD_HOLDDOWN = 367,
-     VAR_DEL_HOLDDOWN = 368,
-     VAR_SO_RCVBUF = 369,
-     VAR_EDNS_BUFFER_SIZE = 370,
-     VAR_PREFETCH = 371,
-     VAR_PREFETCH_KEY = 372,
-     VAR_SO_SNDBUF = 373,
-     VAR_SO_REUSEPORT = 374,
-     VAR_HARDEN_BELOW_NXDOMAIN = 375,
-     VAR_IGNORE_CD_FLAG = 376,
-     VAR_LOG_QUERIES = 377,
-     VAR_TCP_UPSTREAM = 378,
-     VAR_SSL_UPSTREAM = 379,
-     VAR_SSL_SERVICE_KEY = 380,
-     VAR_SSL_SERVICE_PEM = 381,
-     VAR_SSL_PORT = 382,
-     VAR_FORWARD_FIRST = 383,
-     VAR_STUB_FIRST = 384,
-     VAR_MINIMAL_RESPONSES = 385,
-     VAR_RRSET_ROUNDROBIN = 386,
-     VAR_MAX_UDP_SIZE = 387,
-     VAR_DELAY_CLOSE = 388,
-     VAR_UNBLOCK_LAN_ZONES = 389,
-     VAR_INFRA_CACHE_MIN_RTT = 390,
-     VAR_DNS64_PREFIX = 391,
-     VAR_DNS64_SYNTHALL = 392,
-     VAR_DNSTAP = 393,
-     VAR_DNSTAP_ENABLE = 394,
-     VAR_DNSTAP_SOCKET_PATH = 395,
-     VAR_DNSTAP_SEND_IDENTITY = 396,
-     VAR_DNSTAP_SEND_VERSION = 397,
-     VAR_DNSTAP_IDENTITY = 398,
-     VAR_DNSTAP_VERSION = 399,
-     VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 400,
-     VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 401,
-     VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 402,
-     VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 403,
-     VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 404,
-     VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 405,
-     VAR_HARDEN_ALGO_DOWNGRADE = 406,
-     VAR_IP_TRANSPARENT = 407,
-     VAR_RATELIMIT = 408,
-     VAR_RATELIMIT_SLABS = 409,
-     VAR_RATELIMIT_SIZE = 410,
-     VAR_RATELIMIT_FOR_DOMAIN = 411,
-     VAR_RATELIMIT_BELOW_DOMAIN = 412,
-     VAR_RATELIMIT_FACTOR = 413,
-     VAR_CAPS_WHITELIST = 414,
-     VAR_CACHE_MAX_NEGATIVE_TTL = 415
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    SPACE = 258,                   /* SPACE  */
+    LETTER = 259,                  /* LETTER  */
+    NEWLINE = 260,                 /* NEWLINE  */
+    COMMENT = 261,                 /* COMMENT  */
+    COLON = 262,                   /* COLON  */
+    ANY = 263,                     /* ANY  */
+    ZONESTR = 264,                 /* ZONESTR  */
+    STRING_ARG = 265,              /* STRING_ARG  */
+    VAR_SERVER = 266,              /* VAR_SERVER  */
+    VAR_VERBOSITY = 267,           /* VAR_VERBOSITY  */
+    VAR_NUM_THREADS = 268,         /* VAR_NUM_THREADS  */
+    VAR_PORT = 269,                /* VAR_PORT  */
+    VAR_OUTGOING_RANGE = 270,      /* VAR_OUTGOING_RANGE  */
+    VAR_INTERFACE = 271,           /* VAR_INTERFACE  */
+    VAR_DO_IP4 = 272,              /* VAR_DO_IP4  */
+    VAR_DO_IP6 = 273,              /* VAR_DO_IP6  */
+    VAR_DO_UDP = 274,              /* VAR_DO_UDP  */
+    VAR_DO_TCP = 275,              /* VAR_DO_TCP  */
+    VAR_CHROOT = 276,              /* VAR_CHROOT  */
+    VAR_USERNAME = 277,            /* VAR_USERNAME  */
+    VAR_DIRECTORY = 278,           /* VAR_DIRECTORY  */
+    VAR_LOGFILE = 279,             /* VAR_LOGFILE  */
+    VAR_PIDFILE = 280,             /* VAR_PIDFILE  */
+    VAR_MSG_CACHE_SIZE = 281,      /* VAR_MSG_CACHE_SIZE  */
+    VAR_MSG_CACHE_SLABS = 282,     /* VAR_MSG_CACHE_SLABS  */
+    VAR_NUM_QUERIES_PER_THREAD = 283, /* VAR_NUM_QUERIES_PER_THREAD  */
+    VAR_RRSET_CACHE_SIZE = 284,    /* VAR_RRSET_CACHE_SIZE  */
+    VAR_RRSET_CACHE_SLABS = 285,   /* VAR_RRSET_CACHE_SLABS  */
+    VAR_OUTGOING_NUM_TCP = 286,    /* VAR_OUTGOING_NUM_TCP  */
+    VAR_INFRA_HOST_TTL = 287,      /* VAR_INFRA_HOST_TTL  */
+    VAR_INFRA_LAME_TTL = 288,      /* VAR_INFRA_LAME_TTL  */
+    VAR_INFRA_CACHE_SLABS = 289,   /* VAR_INFRA_CACHE_SLABS  */
+    VAR_INFRA_CACHE_NUMHOSTS = 290, /* VAR_INFRA_CACHE_NUMHOSTS  */
+    VAR_INFRA_CACHE_LAME_SIZE = 291, /* VAR_INFRA_CACHE_LAME_SIZE  */
+    VAR_NAME = 292,                /* VAR_NAME  */
+    VAR_STUB_ZONE = 293,           /* VAR_STUB_ZONE  */
+    VAR_STUB_HOST = 294,           /* VAR_STUB_HOST  */
+    VAR_STUB_ADDR = 295,           /* VAR_STUB_ADDR  */
+    VAR_TARGET_FETCH_POLICY = 296, /* VAR_TARGET_FETCH_POLICY  */
+    VAR_HARDEN_SHORT_BUFSIZE = 297, /* VAR_HARDEN_SHORT_BUFSIZE  */
+    VAR_HARDEN_LARGE_QUERIES = 298, /* VAR_HARDEN_LARGE_QUERIES  */
+    VAR_FORWARD_ZONE = 299,        /* VAR_FORWARD_ZONE  */
+    VAR_FORWARD_HOST = 300,        /* VAR_FORWARD_HOST  */
+    VAR_FORWARD_ADDR = 301,        /* VAR_FORWARD_ADDR  */
+    VAR_DO_NOT_QUERY_ADDRESS = 302, /* VAR_DO_NOT_QUERY_ADDRESS  */
+    VAR_HIDE_IDENTITY = 303,       /* VAR_HIDE_IDENTITY  */
+    VAR_HIDE_VERSION = 304,        /* VAR_HIDE_VERSION  */
+    VAR_IDENTITY = 305,            /* VAR_IDENTITY  */
+    VAR_VERSION = 306,             /* VAR_VERSION  */
+    VAR_HARDEN_GLUE = 307,         /* VAR_HARDEN_GLUE  */
+    VAR_MODULE_CONF = 308,         /* VAR_MODULE_CONF  */
+    VAR_TRUST_ANCHOR_FILE = 309,   /* VAR_TRUST_ANCHOR_FILE  */
+    VAR_TRUST_ANCHOR = 310,        /* VAR_TRUST_ANCHOR  */
+    VAR_VAL_OVERRIDE_DATE = 311,   /* VAR_VAL_OVERRIDE_DATE  */
+    VAR_BOGUS_TTL = 312,           /* VAR_BOGUS_TTL  */
+    VAR_VAL_CLEAN_ADDITIONAL = 313, /* VAR_VAL_CLEAN_ADDITIONAL  */
+    VAR_VAL_PERMISSIVE_MODE = 314, /* VAR_VAL_PERMISSIVE_MODE  */
+    VAR_INCOMING_NUM_TCP = 315,    /* VAR_INCOMING_NUM_TCP  */
+    VAR_MSG_BUFFER_SIZE = 316,     /* VAR_MSG_BUFFER_SIZE  */
+    VAR_KEY_CACHE_SIZE = 317,      /* VAR_KEY_CACHE_SIZE  */
+    VAR_KEY_CACHE_SLABS = 318,     /* VAR_KEY_CACHE_SLABS  */
+    VAR_TRUSTED_KEYS_FILE = 319,   /* VAR_TRUSTED_KEYS_FILE  */
+    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 320, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+    VAR_USE_SYSLOG = 321,          /* VAR_USE_SYSLOG  */
+    VAR_OUTGOING_INTERFACE = 322,  /* VAR_OUTGOING_INTERFACE  */
+    VAR_ROOT_HINTS = 323,          /* VAR_ROOT_HINTS  */
+    VAR_DO_NOT_QUERY_LOCALHOST = 324, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+    VAR_CACHE_MAX_TTL = 325,       /* VAR_CACHE_MAX_TTL  */
+    VAR_HARDEN_DNSSEC_STRIPPED = 326, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+    VAR_ACCESS_CONTROL = 327,      /* VAR_ACCESS_CONTROL  */
+    VAR_LOCAL_ZONE = 328,          /* VAR_LOCAL_ZONE  */
+    VAR_LOCAL_DATA = 329,          /* VAR_LOCAL_DATA  */
+    VAR_INTERFACE_AUTOMATIC = 330, /* VAR_INTERFACE_AUTOMATIC  */
+    VAR_STATISTICS_INTERVAL = 331, /* VAR_STATISTICS_INTERVAL  */
+    VAR_DO_DAEMONIZE = 332,        /* VAR_DO_DAEMONIZE  */
+    VAR_USE_CAPS_FOR_ID = 333,     /* VAR_USE_CAPS_FOR_ID  */
+    VAR_STATISTICS_CUMULATIVE = 334, /* VAR_STATISTICS_CUMULATIVE  */
+    VAR_OUTGOING_PORT_PERMIT = 335, /* VAR_OUTGOING_PORT_PERMIT  */
+    VAR_OUTGOING_PORT_AVOID = 336, /* VAR_OUTGOING_PORT_AVOID  */
+    VAR_DLV_ANCHOR_FILE = 337,     /* VAR_DLV_ANCHOR_FILE  */
+    VAR_DLV_ANCHOR = 338,          /* VAR_DLV_ANCHOR  */
+    VAR_NEG_CACHE_SIZE = 339,      /* VAR_NEG_CACHE_SIZE  */
+    VAR_HARDEN_REFERRAL_PATH = 340, /* VAR_HARDEN_REFERRAL_PATH  */
+    VAR_PRIVATE_ADDRESS = 341,     /* VAR_PRIVATE_ADDRESS  */
+    VAR_PRIVATE_DOMAIN = 342,      /* VAR_PRIVATE_DOMAIN  */
+    VAR_REMOTE_CONTROL = 343,      /* VAR_REMOTE_CONTROL  */
+    VAR_CONTROL_ENABLE = 344,      /* VAR_CONTROL_ENABLE  */
+    VAR_CONTROL_INTERFACE = 345,   /* VAR_CONTROL_INTERFACE  */
+    VAR_CONTROL_PORT = 346,        /* VAR_CONTROL_PORT  */
+    VAR_SERVER_KEY_FILE = 347,     /* VAR_SERVER_KEY_FILE  */
+    VAR_SERVER_CERT_FILE = 348,    /* VAR_SERVER_CERT_FILE  */
+    VAR_CONTROL_KEY_FILE = 349,    /* VAR_CONTROL_KEY_FILE  */
+    VAR_CONTROL_CERT_FILE = 350,   /* VAR_CONTROL_CERT_FILE  */
+    VAR_CONTROL_USE_CERT = 351,    /* VAR_CONTROL_USE_CERT  */
+    VAR_EXTENDED_STATISTICS = 352, /* VAR_EXTENDED_STATISTICS  */
+    VAR_LOCAL_DATA_PTR = 353,      /* VAR_LOCAL_DATA_PTR  */
+    VAR_JOSTLE_TIMEOUT = 354,      /* VAR_JOSTLE_TIMEOUT  */
+    VAR_STUB_PRIME = 355,          /* VAR_STUB_PRIME  */
+    VAR_UNWANTED_REPLY_THRESHOLD = 356, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+    VAR_LOG_TIME_ASCII = 357,      /* VAR_LOG_TIME_ASCII  */
+    VAR_DOMAIN_INSECURE = 358,     /* VAR_DOMAIN_INSECURE  */
+    VAR_PYTHON = 359,              /* VAR_PYTHON  */
+    VAR_PYTHON_SCRIPT = 360,       /* VAR_PYTHON_SCRIPT  */
+    VAR_VAL_SIG_SKEW_MIN = 361,    /* VAR_VAL_SIG_SKEW_MIN  */
+    VAR_VAL_SIG_SKEW_MAX = 362,    /* VAR_VAL_SIG_SKEW_MAX  */
+    VAR_CACHE_MIN_TTL = 363,       /* VAR_CACHE_MIN_TTL  */
+    VAR_VAL_LOG_LEVEL = 364,       /* VAR_VAL_LOG_LEVEL  */
+    VAR_AUTO_TRUST_ANCHOR_FILE = 365, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+    VAR_KEEP_MISSING = 366,        /* VAR_KEEP_MISSING  */
+    VAR_ADD_HOLDDOWN = 367,        /* VAR_ADD_HOLDDOWN  */
+    VAR_DEL_HOLDDOWN = 368,        /* VAR_DEL_HOLDDOWN  */
+    VAR_SO_RCVBUF = 369,           /* VAR_SO_RCVBUF  */
+    VAR_EDNS_BUFFER_SIZE = 370,    /* VAR_EDNS_BUFFER_SIZE  */
+    VAR_PREFETCH = 371,            /* VAR_PREFETCH  */
+    VAR_PREFETCH_KEY = 372,        /* VAR_PREFETCH_KEY  */
+    VAR_SO_SNDBUF = 373,           /* VAR_SO_SNDBUF  */
+    VAR_SO_REUSEPORT = 374,        /* VAR_SO_REUSEPORT  */
+    VAR_HARDEN_BELOW_NXDOMAIN = 375, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+    VAR_IGNORE_CD_FLAG = 376,      /* VAR_IGNORE_CD_FLAG  */
+    VAR_LOG_QUERIES = 377,         /* VAR_LOG_QUERIES  */
+    VAR_TCP_UPSTREAM = 378,        /* VAR_TCP_UPSTREAM  */
+    VAR_SSL_UPSTREAM = 379,        /* VAR_SSL_UPSTREAM  */
+    VAR_SSL_SERVICE_KEY = 380,     /* VAR_SSL_SERVICE_KEY  */
+    VAR_SSL_SERVICE_PEM = 381,     /* VAR_SSL_SERVICE_PEM  */
+    VAR_SSL_PORT = 382,            /* VAR_SSL_PORT  */
+    VAR_FORWARD_FIRST = 383,       /* VAR_FORWARD_FIRST  */
+    VAR_STUB_FIRST = 384,          /* VAR_STUB_FIRST  */
+    VAR_MINIMAL_RESPONSES = 385,   /* VAR_MINIMAL_RESPONSES  */
+    VAR_RRSET_ROUNDROBIN = 386,    /* VAR_RRSET_ROUNDROBIN  */
+    VAR_MAX_UDP_SIZE = 387,        /* VAR_MAX_UDP_SIZE  */
+    VAR_DELAY_CLOSE = 388,         /* VAR_DELAY_CLOSE  */
+    VAR_UNBLOCK_LAN_ZONES = 389,   /* VAR_UNBLOCK_LAN_ZONES  */
+    VAR_INFRA_CACHE_MIN_RTT = 390, /* VAR_INFRA_CACHE_MIN_RTT  */
+    VAR_DNS64_PREFIX = 391,        /* VAR_DNS64_PREFIX  */
+    VAR_DNS64_SYNTHALL = 392,      /* VAR_DNS64_SYNTHALL  */
+    VAR_DNSTAP = 393,              /* VAR_DNSTAP  */
+    VAR_DNSTAP_ENABLE = 394,       /* VAR_DNSTAP_ENABLE  */
+    VAR_DNSTAP_SOCKET_PATH = 395,  /* VAR_DNSTAP_SOCKET_PATH  */
+    VAR_DNSTAP_SEND_IDENTITY = 396, /* VAR_DNSTAP_SEND_IDENTITY  */
+    VAR_DNSTAP_SEND_VERSION = 397, /* VAR_DNSTAP_SEND_VERSION  */
+    VAR_DNSTAP_IDENTITY = 398,     /* VAR_DNSTAP_IDENTITY  */
+    VAR_DNSTAP_VERSION = 399,      /* VAR_DNSTAP_VERSION  */
+    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 400, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 401, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 402, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 403, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 404, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 405, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_IP = 406,           /* VAR_DNSTAP_IP  */
+    VAR_DNSTAP_FILE = 407,         /* VAR_DNSTAP_FILE  */
+    VAR_DNSTAP_FILE_ROTATE_SIZE = 408, /* VAR_DNSTAP_FILE_ROTATE_SIZE  */
+    VAR_DNSTAP_FLUSH_SIZE = 409,   /* VAR_DNSTAP_FLUSH_SIZE  */
+    VAR_DNSTAP_FLUSH_TIME = 410,   /* VAR_DNSTAP_FLUSH_TIME  */
+    VAR_DNSTAP_DROP_POLICY = 411,  /* VAR_DNSTAP_DROP_POLICY  */
+    VAR_DNSTAP_HIGH_WATERMARK = 412, /* VAR_DNSTAP_HIGH_WATERMARK  */
+    VAR_DNSTAP_SAMPLE_RATE = 413,  /* VAR_DNSTAP_SAMPLE_RATE  */
+    VAR_HARDEN_ALGO_DOWNGRADE = 414, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+    VAR_IP_TRANSPARENT = 415,      /* VAR_IP_TRANSPARENT  */
+    VAR_RATELIMIT = 416,           /* VAR_RATELIMIT  */
+    VAR_RATELIMIT_SLABS = 417,     /* VAR_RATELIMIT_SLABS  */
+    VAR_RATELIMIT_SIZE = 418,      /* VAR_RATELIMIT_SIZE  */
+    VAR_RATELIMIT_FOR_DOMAIN = 419, /* VAR_RATELIMIT_FOR_DOMAIN  */
+    VAR_RATELIMIT_BELOW_DOMAIN = 420, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+    VAR_RATELIMIT_FACTOR = 421,    /* VAR_RATELIMIT_FACTOR  */
+    VAR_CAPS_WHITELIST = 422,      /* VAR_CAPS_WHITELIST  */
+    VAR_CACHE_MAX_NEGATIVE_TTL = 423, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+    VAR_UDP_BATCH_SIZE = 424,      /* VAR_UDP_BATCH_SIZE  */
+    VAR_LOCKFREE_CACHE_LOOKUP = 425, /* VAR_LOCKFREE_CACHE_LOOKUP  */
+    VAR_MSG_CACHE_WIRE = 426,      /* VAR_MSG_CACHE_WIRE  */
+    VAR_SO_REUSEPORT_BPF = 427,    /* VAR_SO_REUSEPORT_BPF  */
+    VAR_SO_INCOMING_CPU = 428,     /* VAR_SO_INCOMING_CPU  */
+    VAR_CPU_AFFINITY = 429,        /* VAR_CPU_AFFINITY  */
+    VAR_SERVE_EXPIRED = 430,       /* VAR_SERVE_EXPIRED  */
+    VAR_SERVE_EXPIRED_TTL = 431,   /* VAR_SERVE_EXPIRED_TTL  */
+    VAR_SERVE_EXPIRED_REPLY_TTL = 432, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
+    VAR_AGGRESSIVE_NSEC = 433,     /* VAR_AGGRESSIVE_NSEC  */
+    VAR_TCP_REUSE_TIMEOUT = 434,   /* VAR_TCP_REUSE_TIMEOUT  */
+    VAR_MAX_REUSE_TCP_QUERIES = 435, /* VAR_MAX_REUSE_TCP_QUERIES  */
+    VAR_INCOMING_TCP_PIPELINE = 436, /* VAR_INCOMING_TCP_PIPELINE  */
+    VAR_CACHE_SNAPSHOT_FILE = 437, /* VAR_CACHE_SNAPSHOT_FILE  */
+    VAR_CACHE_SNAPSHOT_INTERVAL = 438, /* VAR_CACHE_SNAPSHOT_INTERVAL  */
+    VAR_CACHE_OPEN_ADDRESSING = 439, /* VAR_CACHE_OPEN_ADDRESSING  */
+    VAR_CACHE_ADMISSION = 440,     /* VAR_CACHE_ADMISSION  */
+    VAR_HASH_FUNCTION = 441,       /* VAR_HASH_FUNCTION  */
+    VAR_COALESCE_QUERIES = 442,    /* VAR_COALESCE_QUERIES  */
+    VAR_OUTGOING_PORT_POOL = 443,  /* VAR_OUTGOING_PORT_POOL  */
+    VAR_OUTGOING_PORT_LIFETIME = 444, /* VAR_OUTGOING_PORT_LIFETIME  */
+    VAR_HEDGE_QUERY_BUDGET = 445,  /* VAR_HEDGE_QUERY_BUDGET  */
+    VAR_INFRA_RTT_PERCENTILE = 446 /* VAR_INFRA_RTT_PERCENTILE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define SPACE 258
 #define LETTER 259
 #define NEWLINE 260
@@ -355,50 +399,69 @@ extern int yydebug;
 #define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 403
 #define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 404
 #define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 405
-#define VAR_HARDEN_ALGO_DOWNGRADE 406
-#define VAR_IP_TRANSPARENT 407
-#define VAR_RATELIMIT 408
-#define VAR_RATELIMIT_SLABS 409
-#define VAR_RATELIMIT_SIZE 410
-#define VAR_RATELIMIT_FOR_DOMAIN 411
-#define VAR_RATELIMIT_BELOW_DOMAIN 412
-#define VAR_RATELIMIT_FACTOR 413
-#define VAR_CAPS_WHITELIST 414
-#define VAR_CACHE_MAX_NEGATIVE_TTL 415
-
-
+#define VAR_DNSTAP_IP 406
+#define VAR_DNSTAP_FILE 407
+#define VAR_DNSTAP_FILE_ROTATE_SIZE 408
+#define VAR_DNSTAP_FLUSH_SIZE 409
+#define VAR_DNSTAP_FLUSH_TIME 410
+#define VAR_DNSTAP_DROP_POLICY 411
+#define VAR_DNSTAP_HIGH_WATERMARK 412
+#define VAR_DNSTAP_SAMPLE_RATE 413
+#define VAR_HARDEN_ALGO_DOWNGRADE 414
+#define VAR_IP_TRANSPARENT 415
+#define VAR_RATELIMIT 416
+#define VAR_RATELIMIT_SLABS 417
+#define VAR_RATELIMIT_SIZE 418
+#define VAR_RATELIMIT_FOR_DOMAIN 419
+#define VAR_RATELIMIT_BELOW_DOMAIN 420
+#define VAR_RATELIMIT_FACTOR 421
+#define VAR_CAPS_WHITELIST 422
+#define VAR_CACHE_MAX_NEGATIVE_TTL 423
+#define VAR_UDP_BATCH_SIZE 424
+#define VAR_LOCKFREE_CACHE_LOOKUP 425
+#define VAR_MSG_CACHE_WIRE 426
+#define VAR_SO_REUSEPORT_BPF 427
+#define VAR_SO_INCOMING_CPU 428
+#define VAR_CPU_AFFINITY 429
+#define VAR_SERVE_EXPIRED 430
+#define VAR_SERVE_EXPIRED_TTL 431
+#define VAR_SERVE_EXPIRED_REPLY_TTL 432
+#define VAR_AGGRESSIVE_NSEC 433
+#define VAR_TCP_REUSE_TIMEOUT 434
+#define VAR_MAX_REUSE_TCP_QUERIES 435
+#define VAR_INCOMING_TCP_PIPELINE 436
+#define VAR_CACHE_SNAPSHOT_FILE 437
+#define VAR_CACHE_SNAPSHOT_INTERVAL 438
+#define VAR_CACHE_OPEN_ADDRESSING 439
+#define VAR_CACHE_ADMISSION 440
+#define VAR_HASH_FUNCTION 441
+#define VAR_COALESCE_QUERIES 442
+#define VAR_OUTGOING_PORT_POOL 443
+#define VAR_OUTGOING_PORT_LIFETIME 444
+#define VAR_HEDGE_QUERY_BUDGET 445
+#define VAR_INFRA_RTT_PERCENTILE 446
 
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
-/* Line 2058 of yacc.c  */
-#line 64 "util/configparser.y"
+#line 65 "util/configparser.y"
 
 	char*	str;
 
+#line 453 "util/configparser.h"
 
-/* Line 2058 of yacc.c  */
-#line 382 "util/configparser.h"
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
+
 int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
+
 
 #endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
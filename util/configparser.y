@@ -47,6 +47,7 @@
 #include "util/configyyrename.h"
 #include "util/config_file.h"
 #include "util/net_help.h"
+#include "util/storage/lookup3.h"
 
 int ub_c_lex(void);
 void ub_c_error(const char *message);
@@ -118,10 +119,24 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES
 %token VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES
 %token VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES
+%token VAR_DNSTAP_IP VAR_DNSTAP_FILE VAR_DNSTAP_FILE_ROTATE_SIZE
+%token VAR_DNSTAP_FLUSH_SIZE VAR_DNSTAP_FLUSH_TIME
+%token VAR_DNSTAP_DROP_POLICY VAR_DNSTAP_HIGH_WATERMARK
+%token VAR_DNSTAP_SAMPLE_RATE
 %token VAR_HARDEN_ALGO_DOWNGRADE VAR_IP_TRANSPARENT
 %token VAR_RATELIMIT VAR_RATELIMIT_SLABS VAR_RATELIMIT_SIZE
 %token VAR_RATELIMIT_FOR_DOMAIN VAR_RATELIMIT_BELOW_DOMAIN VAR_RATELIMIT_FACTOR
 %token VAR_CAPS_WHITELIST VAR_CACHE_MAX_NEGATIVE_TTL
+%token VAR_UDP_BATCH_SIZE VAR_LOCKFREE_CACHE_LOOKUP VAR_MSG_CACHE_WIRE
+%token VAR_SO_REUSEPORT_BPF VAR_SO_INCOMING_CPU VAR_CPU_AFFINITY
+%token VAR_SERVE_EXPIRED VAR_SERVE_EXPIRED_TTL VAR_SERVE_EXPIRED_REPLY_TTL
+%token VAR_AGGRESSIVE_NSEC
+%token VAR_TCP_REUSE_TIMEOUT VAR_MAX_REUSE_TCP_QUERIES
+%token VAR_INCOMING_TCP_PIPELINE
+%token VAR_CACHE_SNAPSHOT_FILE VAR_CACHE_SNAPSHOT_INTERVAL
+%token VAR_CACHE_OPEN_ADDRESSING VAR_CACHE_ADMISSION VAR_HASH_FUNCTION
+%token VAR_COALESCE_QUERIES VAR_OUTGOING_PORT_POOL VAR_OUTGOING_PORT_LIFETIME
+%token VAR_HEDGE_QUERY_BUDGET VAR_INFRA_RTT_PERCENTILE
 
 %%
 toplevelvars: /* empty */ | toplevelvars toplevelvar ;
@@ -185,7 +200,18 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_ip_transparent | server_ratelimit | server_ratelimit_slabs |
 	server_ratelimit_size | server_ratelimit_for_domain |
 	server_ratelimit_below_domain | server_ratelimit_factor |
-	server_caps_whitelist | server_cache_max_negative_ttl
+	server_caps_whitelist | server_cache_max_negative_ttl |
+	server_udp_batch_size | server_lockfree_cache_lookup |
+	server_msg_cache_wire | server_so_reuseport_bpf |
+	server_so_incoming_cpu | server_cpu_affinity | server_serve_expired |
+	server_serve_expired_ttl | server_serve_expired_reply_ttl |
+	server_aggressive_nsec | server_tcp_reuse_timeout |
+	server_max_reuse_tcp_queries | server_incoming_tcp_pipeline |
+	server_cache_snapshot_file | server_cache_snapshot_interval |
+	server_cache_open_addressing | server_cache_admission |
+	server_hash_function | server_coalesce_queries |
+	server_outgoing_port_pool | server_outgoing_port_lifetime |
+	server_hedge_query_budget | server_infra_rtt_percentile
 	;
 stubstart: VAR_STUB_ZONE
 	{
@@ -348,6 +374,33 @@ server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG
 		free($2);
 	}
 	;
+server_incoming_tcp_pipeline: VAR_INCOMING_TCP_PIPELINE STRING_ARG
+	{
+		OUTYY(("P(server_incoming_tcp_pipeline:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->incoming_tcp_pipeline = atoi($2);
+		free($2);
+	}
+	;
+server_tcp_reuse_timeout: VAR_TCP_REUSE_TIMEOUT STRING_ARG
+	{
+		OUTYY(("P(server_tcp_reuse_timeout:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_reuse_timeout = atoi($2);
+		free($2);
+	}
+	;
+server_max_reuse_tcp_queries: VAR_MAX_REUSE_TCP_QUERIES STRING_ARG
+	{
+		OUTYY(("P(server_max_reuse_tcp_queries:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->max_reuse_tcp_queries = atoi($2);
+		free($2);
+	}
+	;
 server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG
 	{
 		OUTYY(("P(server_interface_automatic:%s)\n", $2));
@@ -628,6 +681,46 @@ server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG
         free($2);
     }
     ;
+server_so_reuseport_bpf: VAR_SO_REUSEPORT_BPF STRING_ARG
+	{
+		OUTYY(("P(server_so_reuseport_bpf:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->so_reuseport_bpf =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_so_incoming_cpu: VAR_SO_INCOMING_CPU STRING_ARG
+	{
+		OUTYY(("P(server_so_incoming_cpu:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->so_incoming_cpu =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_cpu_affinity: VAR_CPU_AFFINITY STRING_ARG
+	{
+		OUTYY(("P(server_cpu_affinity:%s)\n", $2));
+		if(cfg_count_numbers($2) == 0)
+			yyerror("list of CPU numbers expected");
+		free(cfg_parser->cfg->cpu_affinity);
+		cfg_parser->cfg->cpu_affinity = $2;
+	}
+	;
+server_udp_batch_size: VAR_UDP_BATCH_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_udp_batch_size:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0 || atoi($2) > 1024)
+			yyerror("udp-batch-size must be between 0 and 1024");
+		else cfg_parser->cfg->udp_batch_size = atoi($2);
+		free($2);
+	}
+	;
 server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG
     {
         OUTYY(("P(server_ip_transparent:%s)\n", $2));
@@ -683,6 +776,112 @@ server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_cache_open_addressing: VAR_CACHE_OPEN_ADDRESSING STRING_ARG
+	{
+		OUTYY(("P(server_cache_open_addressing:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_open_addressing =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_cache_admission: VAR_CACHE_ADMISSION STRING_ARG
+	{
+		OUTYY(("P(server_cache_admission:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_admission =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_hash_function: VAR_HASH_FUNCTION STRING_ARG
+	{
+		OUTYY(("P(server_hash_function:%s)\n", $2));
+		if(hash_func_lookup($2) < 0) {
+			yyerror("expected wyhash or lookup3.");
+			free($2);
+		} else {
+			free(cfg_parser->cfg->hash_function);
+			cfg_parser->cfg->hash_function = $2;
+		}
+	}
+	;
+server_outgoing_port_pool: VAR_OUTGOING_PORT_POOL STRING_ARG
+	{
+		OUTYY(("P(server_outgoing_port_pool:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->outgoing_port_pool = atoi($2);
+		free($2);
+	}
+	;
+server_outgoing_port_lifetime: VAR_OUTGOING_PORT_LIFETIME STRING_ARG
+	{
+		OUTYY(("P(server_outgoing_port_lifetime:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->outgoing_port_lifetime = atoi($2);
+		free($2);
+	}
+	;
+server_infra_rtt_percentile: VAR_INFRA_RTT_PERCENTILE STRING_ARG
+	{
+		OUTYY(("P(server_infra_rtt_percentile:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0 || atoi($2) > 100)
+			yyerror("percentile must be 0 to 100");
+		else cfg_parser->cfg->infra_rtt_percentile = atoi($2);
+		free($2);
+	}
+	;
+server_hedge_query_budget: VAR_HEDGE_QUERY_BUDGET STRING_ARG
+	{
+		OUTYY(("P(server_hedge_query_budget:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0 || atoi($2) > 100)
+			yyerror("hedge query budget must be 0 to 100");
+		else cfg_parser->cfg->hedge_query_budget = atoi($2);
+		free($2);
+	}
+	;
+server_coalesce_queries: VAR_COALESCE_QUERIES STRING_ARG
+	{
+		OUTYY(("P(server_coalesce_queries:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->coalesce_queries =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_lockfree_cache_lookup: VAR_LOCKFREE_CACHE_LOOKUP STRING_ARG
+	{
+		OUTYY(("P(server_lockfree_cache_lookup:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->lockfree_cache_lookup =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_msg_cache_wire: VAR_MSG_CACHE_WIRE STRING_ARG
+	{
+		OUTYY(("P(server_msg_cache_wire:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->msg_cache_wire =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG
 	{
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", $2));
@@ -923,6 +1122,49 @@ server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG
 		free($2);
 	}
 	;
+server_serve_expired: VAR_SERVE_EXPIRED STRING_ARG
+	{
+		OUTYY(("P(server_serve_expired:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->serve_expired = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_serve_expired_ttl: VAR_SERVE_EXPIRED_TTL STRING_ARG
+	{
+		OUTYY(("P(server_serve_expired_ttl:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->serve_expired_ttl = atoi($2);
+		free($2);
+	}
+	;
+server_serve_expired_reply_ttl: VAR_SERVE_EXPIRED_REPLY_TTL STRING_ARG
+	{
+		OUTYY(("P(server_serve_expired_reply_ttl:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->serve_expired_reply_ttl = atoi($2);
+		free($2);
+	}
+	;
+server_cache_snapshot_file: VAR_CACHE_SNAPSHOT_FILE STRING_ARG
+	{
+		OUTYY(("P(server_cache_snapshot_file:%s)\n", $2));
+		free(cfg_parser->cfg->cache_snapshot_file);
+		cfg_parser->cfg->cache_snapshot_file = $2;
+	}
+	;
+server_cache_snapshot_interval: VAR_CACHE_SNAPSHOT_INTERVAL STRING_ARG
+	{
+		OUTYY(("P(server_cache_snapshot_interval:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->cache_snapshot_interval = atoi($2);
+		free($2);
+	}
+	;
 server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG
 	{
 		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", $2));
@@ -1154,6 +1396,16 @@ server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG
 		free($2);
 	}
 	;
+server_aggressive_nsec: VAR_AGGRESSIVE_NSEC STRING_ARG
+	{
+		OUTYY(("P(server_aggressive_nsec:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->aggressive_nsec =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG
 	{
 		OUTYY(("P(server_local_zone:%s %s)\n", $2, $3));
@@ -1467,6 +1719,10 @@ dtstart: VAR_DNSTAP
 contents_dt: contents_dt content_dt
 	| ;
 content_dt: dt_dnstap_enable | dt_dnstap_socket_path |
+	dt_dnstap_ip | dt_dnstap_file | dt_dnstap_file_rotate_size |
+	dt_dnstap_flush_size | dt_dnstap_flush_time |
+	dt_dnstap_drop_policy | dt_dnstap_high_watermark |
+	dt_dnstap_sample_rate |
 	dt_dnstap_send_identity | dt_dnstap_send_version |
 	dt_dnstap_identity | dt_dnstap_version |
 	dt_dnstap_log_resolver_query_messages |
@@ -1491,6 +1747,78 @@ dt_dnstap_socket_path: VAR_DNSTAP_SOCKET_PATH STRING_ARG
 		cfg_parser->cfg->dnstap_socket_path = $2;
 	}
 	;
+dt_dnstap_ip: VAR_DNSTAP_IP STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_ip:%s)\n", $2));
+		free(cfg_parser->cfg->dnstap_ip);
+		cfg_parser->cfg->dnstap_ip = $2;
+	}
+	;
+dt_dnstap_file: VAR_DNSTAP_FILE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_file:%s)\n", $2));
+		free(cfg_parser->cfg->dnstap_file);
+		cfg_parser->cfg->dnstap_file = $2;
+	}
+	;
+dt_dnstap_file_rotate_size: VAR_DNSTAP_FILE_ROTATE_SIZE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_file_rotate_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2,
+			&cfg_parser->cfg->dnstap_file_rotate_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+dt_dnstap_flush_size: VAR_DNSTAP_FLUSH_SIZE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_flush_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->dnstap_flush_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+dt_dnstap_flush_time: VAR_DNSTAP_FLUSH_TIME STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_flush_time:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->dnstap_flush_time = atoi($2);
+		free($2);
+	}
+	;
+dt_dnstap_drop_policy: VAR_DNSTAP_DROP_POLICY STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_drop_policy:%s)\n", $2));
+		if(strcmp($2, "drop-newest") != 0 &&
+			strcmp($2, "drop-oldest") != 0 &&
+			strcmp($2, "sample") != 0) {
+			yyerror("expected drop-newest, drop-oldest or sample");
+			free($2);
+		} else {
+			free(cfg_parser->cfg->dnstap_drop_policy);
+			cfg_parser->cfg->dnstap_drop_policy = $2;
+		}
+	}
+	;
+dt_dnstap_high_watermark: VAR_DNSTAP_HIGH_WATERMARK STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_high_watermark:%s)\n", $2));
+		if(atoi($2) < 1 || atoi($2) > 100)
+			yyerror("percentage from 1 to 100 expected");
+		else cfg_parser->cfg->dnstap_high_watermark = atoi($2);
+		free($2);
+	}
+	;
+dt_dnstap_sample_rate: VAR_DNSTAP_SAMPLE_RATE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_sample_rate:%s)\n", $2));
+		if(atoi($2) < 1)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->dnstap_sample_rate = atoi($2);
+		free($2);
+	}
+	;
 dt_dnstap_send_identity: VAR_DNSTAP_SEND_IDENTITY STRING_ARG
 	{
 		OUTYY(("P(dt_dnstap_send_identity:%s)\n", $2));
@@ -46,6 +46,98 @@
 #include "util/log.h"
 #include "util/storage/lookup3.h"
 #include "sldns/sbuffer.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/** lowercase a byte, like tolower in the C locale, ASCII only */
+#define fold1(c) ((uint8_t)((unsigned)(c)-'A' < 26u ? (c)|0x20 : (c)))
+
+/** lowercase 8 bytes at once, the uppercase ASCII bytes get 0x20 added */
+static uint64_t
+fold8(uint64_t x)
+{
+	uint64_t h = x & (uint64_t)0x7f7f7f7f7f7f7f7fULL;
+	/* the top bit is set when the byte is >= 'A', and when > 'Z' */
+	uint64_t ge_a = h + (uint64_t)0x3f3f3f3f3f3f3f3fULL;
+	uint64_t gt_z = h + (uint64_t)0x2525252525252525ULL;
+	uint64_t up = (ge_a ^ gt_z) & ~x & (uint64_t)0x8080808080808080ULL;
+	return x | (up >> 2);
+}
+
+#ifdef __SSE2__
+/** lowercase 16 bytes at once; 'A'..'Z' are moved to the lowest signed
+ * values, so that one compare finds them */
+static __m128i
+fold16(__m128i x)
+{
+	__m128i t = _mm_add_epi8(x, _mm_set1_epi8((char)(0x80-'A')));
+	__m128i up = _mm_cmplt_epi8(t, _mm_set1_epi8((char)(-0x80+26)));
+	return _mm_or_si128(x, _mm_and_si128(up, _mm_set1_epi8(0x20)));
+}
+#endif /* __SSE2__ */
+
+/**
+ * Lowercase bytes, 16 or 8 at a time where possible.
+ * @param dst: destination, can be the same as src.
+ * @param src: bytes to lowercase.
+ * @param len: number of bytes.
+ */
+static void
+memlowercpy(uint8_t* dst, uint8_t* src, size_t len)
+{
+	size_t i = 0;
+	uint64_t x;
+#ifdef __SSE2__
+	for(; i+16 <= len; i+=16)
+		_mm_storeu_si128((__m128i*)(dst+i), fold16(_mm_loadu_si128(
+			(__m128i*)(src+i))));
+#endif
+	for(; i+8 <= len; i+=8) {
+		memcpy(&x, src+i, sizeof(x));
+		x = fold8(x);
+		memcpy(dst+i, &x, sizeof(x));
+	}
+	for(; i<len; i++)
+		dst[i] = fold1(src[i]);
+}
+
+/**
+ * Compare bytes in memory, lowercase while comparing.
+ * @param p1: label 1
+ * @param p2: label 2
+ * @param len: number of bytes to compare.
+ * @return: 0, -1, +1 comparison result.
+ */
+static int
+memlowercmp(uint8_t* p1, uint8_t* p2, size_t len)
+{
+	size_t i = 0;
+	uint64_t x1, x2;
+	/* skip the equal parts, a difference is found by the byte loop */
+#ifdef __SSE2__
+	for(; i+16 <= len; i+=16) {
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(
+			fold16(_mm_loadu_si128((__m128i*)(p1+i))),
+			fold16(_mm_loadu_si128((__m128i*)(p2+i))))) != 0xffff)
+			break;
+	}
+#endif
+	for(; i+8 <= len; i+=8) {
+		memcpy(&x1, p1+i, sizeof(x1));
+		memcpy(&x2, p2+i, sizeof(x2));
+		if(x1 != x2 && fold8(x1) != fold8(x2))
+			break;
+	}
+	for(; i<len; i++) {
+		if(p1[i] != p2[i] && fold1(p1[i]) != fold1(p2[i])) {
+			if(fold1(p1[i]) < fold1(p2[i]))
+				return -1;
+			return 1;
+		}
+	}
+	return 0;
+}
 
 /* determine length of a dname in buffer, no compression pointers allowed */
 size_t
@@ -93,38 +185,25 @@ dname_valid(uint8_t* dname, size_t maxlen)
 	return len;
 }
 
-/** compare uncompressed, noncanonical, registers are hints for speed */
+/** compare uncompressed, noncanonical */
 int 
-query_dname_compare(register uint8_t* d1, register uint8_t* d2)
+query_dname_compare(uint8_t* d1, uint8_t* d2)
 {
-	register uint8_t lab1, lab2;
+	size_t len = 0;
+	int c;
 	log_assert(d1 && d2);
-	lab1 = *d1++;
-	lab2 = *d2++;
-	while( lab1 != 0 || lab2 != 0 ) {
-		/* compare label length */
-		/* if one dname ends, it has labellength 0 */
-		if(lab1 != lab2) {
-			if(lab1 < lab2)
-				return -1;
-			return 1;
-		}
-		log_assert(lab1 == lab2 && lab1 != 0);
-		/* compare lowercased labels. */
-		while(lab1--) {
-			/* compare bytes first for speed */
-			if(*d1 != *d2 && 
-				tolower((unsigned char)*d1) != tolower((unsigned char)*d2)) {
-				if(tolower((unsigned char)*d1) < tolower((unsigned char)*d2))
-					return -1;
-				return 1;
-			}
-			d1++;
-			d2++;
-		}
-		/* next pair of labels. */
-		lab1 = *d1++;
-		lab2 = *d2++;
+	/* skip the labels that have the same length, and then compare
+	 * that part at once; the label lengths are not changed by
+	 * lowercasing. If one dname ends, it has labellength 0 */
+	while(d1[len] == d2[len] && d1[len] != 0)
+		len += (size_t)d1[len] + 1;
+	if((c=memlowercmp(d1, d2, len)) != 0)
+		return c;
+	/* compare label length */
+	if(d1[len] != d2[len]) {
+		if(d1[len] < d2[len])
+			return -1;
+		return 1;
 	}
 	return 0;
 }
@@ -132,17 +211,14 @@ query_dname_compare(register uint8_t* d1, register uint8_t* d2)
 void 
 query_dname_tolower(uint8_t* dname)
 {
-	/* the dname is stored uncompressed */
-	uint8_t labellen;
-	labellen = *dname;
-	while(labellen) {
-		dname++;
-		while(labellen--) {
-			*dname = (uint8_t)tolower((unsigned char)*dname);
-			dname++;
-		}
-		labellen = *dname;
+	/* the dname is stored uncompressed, the label lengths are below
+	 * 'A' and stay the same, so the dname is lowercased at once */
+	size_t len = 0;
+	while(dname[len]) {
+		log_assert(dname[len] <= LDNS_MAX_LABELLEN);
+		len += (size_t)dname[len] + 1;
 	}
+	memlowercpy(dname, dname, len);
 }
 
 void 
@@ -166,10 +242,8 @@ pkt_dname_tolower(sldns_buffer* pkt, uint8_t* dname)
 		}
 		if(dname+lablen >= sldns_buffer_end(pkt))
 			return;
-		while(lablen--) {
-			*dname = (uint8_t)tolower((unsigned char)*dname);
-			dname++;
-		}
+		memlowercpy(dname, dname, lablen);
+		dname += lablen;
 		if(dname >= sldns_buffer_end(pkt))
 			return;
 		lablen = *dname++;
@@ -231,6 +305,7 @@ int
 dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 {
 	uint8_t len1, len2;
+	int c;
 	log_assert(pkt && d1 && d2);
 	len1 = *d1++;
 	len2 = *d2++;
@@ -255,13 +330,10 @@ dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 		}
 		log_assert(len1 == len2 && len1 != 0);
 		/* compare labels */
-		while(len1--) {
-			if(tolower((unsigned char)*d1++) != tolower((unsigned char)*d2++)) {
-				if(tolower((unsigned char)d1[-1]) < tolower((unsigned char)d2[-1]))
-					return -1;
-				return 1;
-			}
-		}
+		if((c=memlowercmp(d1, d2, len1)) != 0)
+			return c;
+		d1 += len1;
+		d2 += len1;
 		len1 = *d1++;
 		len2 = *d2++;
 	}
@@ -271,21 +343,18 @@ dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 hashvalue_t 
 dname_query_hash(uint8_t* dname, hashvalue_t h)
 {
-	uint8_t labuf[LDNS_MAX_LABELLEN+1];
-	uint8_t lablen;
-	int i;
-
-	/* preserve case of query, make hash label by label */
-	lablen = *dname++;
-	while(lablen) {
-		log_assert(lablen <= LDNS_MAX_LABELLEN);
-		labuf[0] = lablen;
-		i=0;
-		while(lablen--)
-			labuf[++i] = (uint8_t)tolower((unsigned char)*dname++);
-		h = hashlittle(labuf, labuf[0] + 1, h);
-		lablen = *dname++;
+	uint8_t buf[LDNS_MAX_DOMAINLEN];
+	size_t len = 0, i;
+
+	/* preserve case of query, lowercase a copy of the dname at once,
+	 * and make hash label by label, with the label length */
+	while(dname[len] && len + dname[len] + 1 <= sizeof(buf)) {
+		log_assert(dname[len] <= LDNS_MAX_LABELLEN);
+		len += (size_t)dname[len] + 1;
 	}
+	memlowercpy(buf, dname, len);
+	for(i=0; i<len; i += (size_t)buf[i] + 1)
+		h = hash_bytes(buf+i, (size_t)buf[i] + 1, h);
 
 	return h;
 }
@@ -295,7 +364,6 @@ dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_t h)
 {
 	uint8_t labuf[LDNS_MAX_LABELLEN+1];
 	uint8_t lablen;
-	int i;
 
 	/* preserve case of query, make hash label by label */
 	lablen = *dname++;
@@ -307,11 +375,10 @@ dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_t h)
 			continue;
 		}
 		log_assert(lablen <= LDNS_MAX_LABELLEN);
-		labuf[0] = lablen;
-		i=0;
-		while(lablen--)
-			labuf[++i] = (uint8_t)tolower((unsigned char)*dname++);
-		h = hashlittle(labuf, labuf[0] + 1, h);
+		/* with the label length, it is not changed by lowercasing */
+		memlowercpy(labuf, dname-1, (size_t)lablen + 1);
+		h = hash_bytes(labuf, (size_t)lablen + 1, h);
+		dname += lablen;
 		lablen = *dname++;
 	}
 
@@ -412,28 +479,6 @@ dname_count_size_labels(uint8_t* dname, size_t* size)
 	return labs;
 }
 
-/**
- * Compare labels in memory, lowercase while comparing.
- * @param p1: label 1
- * @param p2: label 2
- * @param len: number of bytes to compare.
- * @return: 0, -1, +1 comparison result.
- */
-static int
-memlowercmp(uint8_t* p1, uint8_t* p2, uint8_t len)
-{
-	while(len--) {
-		if(*p1 != *p2 && tolower((unsigned char)*p1) != tolower((unsigned char)*p2)) {
-			if(tolower((unsigned char)*p1) < tolower((unsigned char)*p2))
-				return -1;
-			return 1;
-		}
-		p1++;
-		p2++;
-	}
-	return 0;
-}
-
 int 
 dname_lab_cmp(uint8_t* d1, int labs1, uint8_t* d2, int labs2, int* mlabs)
 {
@@ -441,6 +486,7 @@ dname_lab_cmp(uint8_t* d1, int labs1, uint8_t* d2, int labs2, int* mlabs)
 	int atlabel = labs1;
 	int lastmlabs;
 	int lastdiff = 0;
+	int c;
 	/* first skip so that we compare same label. */
 	if(labs1 > labs2) {
 		while(atlabel > labs2) {
@@ -475,31 +521,12 @@ dname_lab_cmp(uint8_t* d1, int labs1, uint8_t* d2, int labs2, int* mlabs)
 			d1 += len1;
 			d2 += len2;
 		} else {
-			/* memlowercmp is inlined here; or just like
-			 * if((c=memlowercmp(d1, d2, len1)) != 0) { 
-			 *	lastdiff = c;
-			 *	lastmlabs = atlabel; } apart from d1++,d2++ */
-			while(len1) {
-				if(*d1 != *d2 && tolower((unsigned char)*d1) 
-					!= tolower((unsigned char)*d2)) {
-					if(tolower((unsigned char)*d1) < 
-						tolower((unsigned char)*d2)) {
-						lastdiff = -1;
-						lastmlabs = atlabel;
-						d1 += len1;
-						d2 += len1;
-						break;
-					}
-					lastdiff = 1;
-					lastmlabs = atlabel;
-					d1 += len1;
-					d2 += len1;
-					break; /* out of memlowercmp */
-				}
-				d1++;
-				d2++;
-				len1--;
+			if((c=memlowercmp(d1, d2, len1)) != 0) {
+				lastdiff = c;
+				lastmlabs = atlabel;
 			}
+			d1 += len1;
+			d2 += len1;
 		}
 		atlabel--;
 	}
@@ -470,7 +470,8 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 			sldns_buffer_write(pkt, &key->rk.type, 2);
 			sldns_buffer_write(pkt, &key->rk.rrset_class, 2);
 			if(data->rr_ttl[j] < timenow)
-				sldns_buffer_write_u32(pkt, 0);
+				sldns_buffer_write_u32(pkt,
+					SERVE_EXPIRED?SERVE_EXPIRED_REPLY_TTL:0);
 			else 	sldns_buffer_write_u32(pkt, 
 					data->rr_ttl[j]-timenow);
 			if(c) {
@@ -507,7 +508,8 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 			sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_RRSIG);
 			sldns_buffer_write(pkt, &key->rk.rrset_class, 2);
 			if(data->rr_ttl[i] < timenow)
-				sldns_buffer_write_u32(pkt, 0);
+				sldns_buffer_write_u32(pkt,
+					SERVE_EXPIRED?SERVE_EXPIRED_REPLY_TTL:0);
 			else 	sldns_buffer_write_u32(pkt, 
 					data->rr_ttl[i]-timenow);
 			/* rrsig rdata cannot be compressed, perform 100+ byte
@@ -746,15 +748,12 @@ attach_edns_record(sldns_buffer* pkt, struct edns_data* edns)
 	sldns_buffer_flip(pkt);
 }
 
-int 
-reply_info_answer_encode(struct query_info* qinf, struct reply_info* rep, 
-	uint16_t id, uint16_t qflags, sldns_buffer* pkt, time_t timenow,
-	int cached, struct regional* region, uint16_t udpsize, 
-	struct edns_data* edns, int dnssec, int secure)
+/** the flags for the answer to a query, host order */
+static uint16_t
+answer_flags(struct reply_info* rep, uint16_t qflags, int cached, int dnssec,
+	int secure)
 {
 	uint16_t flags;
-	int attach_edns = 1;
-
 	if(!cached || rep->authoritative) {
 		/* original flags, copy RD and CD bits from query. */
 		flags = rep->flags | (qflags & (BIT_RD|BIT_CD)); 
@@ -765,6 +764,19 @@ reply_info_answer_encode(struct query_info* qinf, struct reply_info* rep,
 	if(secure && (dnssec || (qflags&BIT_AD)))
 		flags |= BIT_AD;
 	log_assert(flags & BIT_QR); /* QR bit must be on in our replies */
+	return flags;
+}
+
+int 
+reply_info_answer_encode(struct query_info* qinf, struct reply_info* rep, 
+	uint16_t id, uint16_t qflags, sldns_buffer* pkt, time_t timenow,
+	int cached, struct regional* region, uint16_t udpsize, 
+	struct edns_data* edns, int dnssec, int secure)
+{
+	uint16_t flags;
+	int attach_edns = 1;
+
+	flags = answer_flags(rep, qflags, cached, dnssec, secure);
 	if(udpsize < LDNS_HEADER_SIZE)
 		return 0;
 	if(udpsize < LDNS_HEADER_SIZE + calc_edns_field_size(edns)) {
@@ -785,6 +797,129 @@ reply_info_answer_encode(struct query_info* qinf, struct reply_info* rep,
 	return 1;
 }
 
+struct reply_wire*
+reply_wire_create(struct query_info* qinf, struct reply_info* rep,
+	sldns_buffer* buf, time_t timenow, struct regional* region, int dnssec)
+{
+	struct reply_wire* w;
+	size_t i, num, len, sz;
+	uint16_t* offs;
+
+	/* roundrobin makes the rr order differ per query id */
+	if(RRSET_ROUNDROBIN || rep->rrset_count > RR_COUNT_MAX)
+		return NULL;
+	/* encode for the largest size the buffer allows, without EDNS;
+	 * the id and flags are patched in when the image is used */
+	if(!reply_info_encode(qinf, rep, 0, rep->flags, buf, timenow, region,
+		65535, dnssec))
+		return NULL;
+	if(LDNS_TC_WIRE(sldns_buffer_begin(buf)))
+		return NULL;
+	len = sldns_buffer_limit(buf);
+	num = (size_t)LDNS_ANCOUNT(sldns_buffer_begin(buf)) +
+		(size_t)LDNS_NSCOUNT(sldns_buffer_begin(buf)) +
+		(size_t)LDNS_ARCOUNT(sldns_buffer_begin(buf));
+	sz = sizeof(*w) + sizeof(struct reply_wire_rrset)*rep->rrset_count
+		+ sizeof(uint16_t)*num + len;
+	w = (struct reply_wire*)malloc(sz);
+	if(!w)
+		return NULL;
+	w->timenow = timenow;
+	w->len = len;
+	w->num_ttl = num;
+	w->rrset_count = rep->rrset_count;
+	w->rrsets = (struct reply_wire_rrset*)&w[1];
+	w->ttl_offsets = (uint16_t*)&w->rrsets[rep->rrset_count];
+	w->pkt = (uint8_t*)&w->ttl_offsets[num];
+	for(i=0; i<rep->rrset_count; i++) {
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			rep->rrsets[i]->entry.data;
+		w->rrsets[i].version = d->version;
+		w->rrsets[i].ttl = d->ttl;
+	}
+	memmove(w->pkt, sldns_buffer_begin(buf), len);
+
+	/* find the TTL of every RR in the image */
+	sldns_buffer_set_position(buf, LDNS_HEADER_SIZE);
+	if(rep->qdcount) {
+		if(!pkt_dname_len(buf) || sldns_buffer_remaining(buf) < 4) {
+			free(w);
+			return NULL;
+		}
+		sldns_buffer_skip(buf, 4);
+	}
+	offs = w->ttl_offsets;
+	for(i=0; i<num; i++) {
+		if(!pkt_dname_len(buf) || sldns_buffer_remaining(buf) < 10) {
+			free(w);
+			return NULL;
+		}
+		sldns_buffer_skip(buf, 4);
+		*offs++ = (uint16_t)sldns_buffer_position(buf);
+		sldns_buffer_skip(buf, 4);
+		sz = (size_t)sldns_buffer_read_u16(buf);
+		if(sldns_buffer_remaining(buf) < sz) {
+			free(w);
+			return NULL;
+		}
+		sldns_buffer_skip(buf, (ssize_t)sz);
+	}
+	return w;
+}
+
+int
+reply_wire_valid(struct reply_wire* w, struct reply_info* rep,
+	time_t timenow)
+{
+	size_t i;
+	if(w->rrset_count != rep->rrset_count || timenow < w->timenow)
+		return 0;
+	for(i=0; i<rep->rrset_count; i++) {
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			rep->rrsets[i]->entry.data;
+		if(w->rrsets[i].version != d->version ||
+			w->rrsets[i].ttl != d->ttl)
+			return 0;
+	}
+	return 1;
+}
+
+int
+reply_wire_answer(struct reply_wire* w, struct query_info* qinf,
+	struct reply_info* rep, uint16_t id, uint16_t qflags,
+	sldns_buffer* pkt, time_t timenow, uint16_t udpsize,
+	struct edns_data* edns, int dnssec, int secure)
+{
+	size_t i;
+	uint8_t* p;
+	uint32_t ttl, elapsed;
+	if(udpsize > sldns_buffer_capacity(pkt))
+		udpsize = (uint16_t)sldns_buffer_capacity(pkt);
+	if(w->len + calc_edns_field_size(edns) > udpsize)
+		return 0;
+	if(!reply_wire_valid(w, rep, timenow))
+		return 0;
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write(pkt, w->pkt, w->len);
+	sldns_buffer_flip(pkt);
+	p = sldns_buffer_begin(pkt);
+	memmove(p, &id, sizeof(id));
+	sldns_write_uint16(p+2, answer_flags(rep, qflags, 1, dnssec, secure));
+	/* the query name with the case of this query */
+	if(rep->qdcount)
+		memmove(p+LDNS_HEADER_SIZE, qinf->qname, qinf->qname_len);
+	elapsed = (uint32_t)(timenow - w->timenow);
+	if(elapsed != 0) {
+		for(i=0; i<w->num_ttl; i++) {
+			ttl = sldns_read_uint32(p+w->ttl_offsets[i]);
+			sldns_write_uint32(p+w->ttl_offsets[i],
+				ttl>elapsed?ttl-elapsed:0);
+		}
+	}
+	attach_edns_record(pkt, edns);
+	return 1;
+}
+
 void 
 qinfo_query_encode(sldns_buffer* pkt, struct query_info* qinfo)
 {
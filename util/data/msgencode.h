@@ -42,6 +42,7 @@
 
 #ifndef UTIL_DATA_MSGENCODE_H
 #define UTIL_DATA_MSGENCODE_H
+#include "util/data/packed_rrset.h"
 struct sldns_buffer;
 struct query_info;
 struct reply_info;
@@ -92,6 +93,96 @@ int reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	uint16_t id, uint16_t flags, struct sldns_buffer* buffer, time_t timenow, 
 	struct regional* region, uint16_t udpsize, int dnssec);
 
+/**
+ * The rrset data a pre-encoded answer was made from.
+ */
+struct reply_wire_rrset {
+	/** the version of the packed_rrset_data of the rrset */
+	rrset_id_t version;
+	/** the absolute ttl of that data */
+	time_t ttl;
+};
+
+/**
+ * Pre-encoded answer for a reply_info in the message cache.  A cache hit
+ * can copy the image, patch in the ID, flags and query name, and lower the
+ * TTLs by the time passed since it was made, instead of encoding the reply
+ * again.  The image has no EDNS record, that is appended when it is used.
+ * The image is stale when the rrsets of the reply change: their ids are
+ * checked by rrset_array_lock, and the data version and ttl of every rrset
+ * are checked against the values the image was made from, since an update
+ * can replace the data of an rrset and keep its id, and the validator can
+ * change the ttl of the data in place.
+ * Allocated in one block, free() deletes it.
+ */
+struct reply_wire {
+	/** time the TTLs in the image were encoded at */
+	time_t timenow;
+	/** length of the image in octets */
+	size_t len;
+	/** number of TTL fields in the image */
+	size_t num_ttl;
+	/** number of rrsets of the reply the image was made from */
+	size_t rrset_count;
+	/** per rrset (in reply order) the data version and its ttl at encode
+	 * time */
+	struct reply_wire_rrset* rrsets;
+	/** offsets of the TTL fields of the RRs in the image */
+	uint16_t* ttl_offsets;
+	/** the wireformat image */
+	uint8_t* pkt;
+};
+
+/**
+ * Make a pre-encoded answer for a cached reply.
+ * The caller must hold the rrset locks (rrset_array_lock) of the reply.
+ * @param qinf: query info for the query section.
+ * @param rep: the cached reply.
+ * @param buf: scratch buffer to encode in.
+ * @param timenow: time now, to adjust ttl values.
+ * @param region: to store temporary data in.
+ * @param dnssec: if 0 DNSSEC records are omitted from the answer.
+ * @return malloced image or NULL if it could not be made, because of
+ *	malloc failure, rrset roundrobin or a truncated answer.
+ */
+struct reply_wire* reply_wire_create(struct query_info* qinf,
+	struct reply_info* rep, struct sldns_buffer* buf, time_t timenow,
+	struct regional* region, int dnssec);
+
+/**
+ * See if a pre-encoded answer still matches the rrsets of the reply.
+ * The caller must hold the rrset locks (rrset_array_lock) of the reply.
+ * @param w: the image.
+ * @param rep: the cached reply it was made from.
+ * @param timenow: time now.
+ * @return false if it is stale.
+ */
+int reply_wire_valid(struct reply_wire* w, struct reply_info* rep,
+	time_t timenow);
+
+/**
+ * Generate answer from a pre-encoded image, like reply_info_answer_encode
+ * does for a cached reply.
+ * The caller must hold the rrset locks (rrset_array_lock) of the reply.
+ * @param w: the image.
+ * @param qinf: query information, the query name case is copied.
+ * @param rep: the cached reply the image was made from.
+ * @param id: id word from the query.
+ * @param qflags: flags word from the query.
+ * @param pkt: buffer to put message into.
+ * @param timenow: time to subtract.
+ * @param udpsize: size of the answer, 512, from EDNS, or 64k for TCP.
+ * @param edns: EDNS data included in the answer, NULL for none.
+ * @param dnssec: the DO bit of the query, the image must be made with it.
+ * @param secure: if 1, the AD bit is set in the reply.
+ * @return false if the image is stale or does not fit, the answer must
+ *	then be encoded with reply_info_answer_encode.
+ */
+int reply_wire_answer(struct reply_wire* w, struct query_info* qinf,
+	struct reply_info* rep, uint16_t id, uint16_t qflags,
+	struct sldns_buffer* pkt, time_t timenow, uint16_t udpsize,
+	struct edns_data* edns, int dnssec, int secure);
+
 /**
  * Encode query packet. Assumes the buffer is large enough.
  * @param pkt: where to store the packet.
@@ -166,9 +166,9 @@ pkt_hash_rrset(sldns_buffer* pkt, uint8_t* dname, uint16_t type,
 	/* this routine handles compressed names */
 	hashvalue_t h = 0xab;
 	h = dname_pkt_hash(pkt, dname, h);
-	h = hashlittle(&type, sizeof(type), h);		/* host order */
-	h = hashlittle(&dclass, sizeof(dclass), h);	/* netw order */
-	h = hashlittle(&rrset_flags, sizeof(uint32_t), h);
+	h = hash_bytes(&type, sizeof(type), h);		/* host order */
+	h = hash_bytes(&dclass, sizeof(dclass), h);	/* netw order */
+	h = hash_bytes(&rrset_flags, sizeof(uint32_t), h);
 	return h;
 }
 
@@ -192,9 +192,9 @@ pkt_hash_rrset_rest(hashvalue_t dname_h, uint16_t type, uint16_t dclass,
 	/* works together with pkt_hash_rrset_first */
 	/* note this MUST be identical to rrset_key_hash in packed_rrset.c */
 	hashvalue_t h;
-	h = hashlittle(&type, sizeof(type), dname_h);	/* host order */
-	h = hashlittle(&dclass, sizeof(dclass), h);	/* netw order */
-	h = hashlittle(&rrset_flags, sizeof(uint32_t), h);
+	h = hash_bytes(&type, sizeof(type), dname_h);	/* host order */
+	h = hash_bytes(&dclass, sizeof(dclass), h);	/* netw order */
+	h = hash_bytes(&rrset_flags, sizeof(uint32_t), h);
 	return h;
 }
 
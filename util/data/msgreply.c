@@ -106,6 +106,8 @@ construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
 	rep->rrset_count = total;
 	rep->security = sec;
 	rep->authoritative = 0;
+	rep->wire[0] = NULL;
+	rep->wire[1] = NULL;
 	/* array starts after the refs */
 	if(region)
 		rep->rrsets = (struct ub_packed_rrset_key**)&(rep->ref[0]);
@@ -371,8 +373,7 @@ parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
 	if(region)
 		pk->rk.dname = (uint8_t*)regional_alloc(
 			region, pset->dname_len);
-	else	pk->rk.dname = 
-			(uint8_t*)malloc(pset->dname_len);
+	else	pk->rk.dname = packed_rrset_name_alloc(pset->dname_len);
 	if(!pk->rk.dname)
 		return 0;
 	/** copy & decompress dname */
@@ -580,8 +581,9 @@ msgreply_sizefunc(void* k, void* d)
 	struct msgreply_entry* q = (struct msgreply_entry*)k;
 	struct reply_info* r = (struct reply_info*)d;
 	size_t s = sizeof(struct msgreply_entry) + sizeof(struct reply_info)
-		+ q->key.qname_len + lock_get_mem(&q->entry.lock)
-		- sizeof(struct rrset_ref);
+		+ lock_get_mem(&q->entry.lock) - sizeof(struct rrset_ref);
+	if(!q->qname_shared)
+		s += q->key.qname_len;
 	s += r->rrset_count * sizeof(struct rrset_ref);
 	s += r->rrset_count * sizeof(struct ub_packed_rrset_key*);
 	return s;
@@ -592,7 +594,7 @@ query_entry_delete(void *k, void* ATTR_UNUSED(arg))
 {
 	struct msgreply_entry* q = (struct msgreply_entry*)k;
 	lock_rw_destroy(&q->entry.lock);
-	query_info_clear(&q->key);
+	packed_rrset_name_free(q->key.qname);
 	free(q);
 }
 
@@ -600,6 +602,8 @@ void
 reply_info_delete(void* d, void* ATTR_UNUSED(arg))
 {
 	struct reply_info* r = (struct reply_info*)d;
+	free(r->wire[0]);
+	free(r->wire[1]);
 	free(r);
 }
 
@@ -607,10 +611,10 @@ hashvalue_t
 query_info_hash(struct query_info *q, uint16_t flags)
 {
 	hashvalue_t h = 0xab;
-	h = hashlittle(&q->qtype, sizeof(q->qtype), h);
+	h = hash_bytes(&q->qtype, sizeof(q->qtype), h);
 	if(q->qtype == LDNS_RR_TYPE_AAAA && (flags&BIT_CD))
 		h++;
-	h = hashlittle(&q->qclass, sizeof(q->qclass), h);
+	h = hash_bytes(&q->qclass, sizeof(q->qclass), h);
 	h = dname_query_hash(q->qname, h);
 	return h;
 }
@@ -626,6 +630,7 @@ query_info_entrysetup(struct query_info* q, struct reply_info* r,
 	e->entry.hash = h;
 	e->entry.key = e;
 	e->entry.data = r;
+	e->qname_shared = 0;
 	lock_rw_init(&e->entry.lock);
 	lock_protect(&e->entry.lock, &e->key, sizeof(e->key));
 	lock_protect(&e->entry.lock, &e->entry.hash, sizeof(e->entry.hash) +
@@ -635,6 +640,33 @@ query_info_entrysetup(struct query_info* q, struct reply_info* r,
 	return e;
 }
 
+/**
+ * Get the owner name for a copy of an rrset for the cache.  If an
+ * earlier rrset of the message has the same owner name, it is shared.
+ * @param dest: the message with the copies.
+ * @param num: the rrset that is copied, the ones before it are done.
+ * @param fk: the rrset that is copied.
+ * @return the name, or NULL on malloc failure.
+ */
+static uint8_t*
+repinfo_copy_name(struct reply_info* dest, size_t num,
+	struct ub_packed_rrset_key* fk)
+{
+	size_t i;
+	uint8_t* nm;
+	for(i=0; i<num; i++) {
+		struct ub_packed_rrset_key* k = dest->rrsets[i];
+		if(k->rk.dname_len == fk->rk.dname_len &&
+			memcmp(k->rk.dname, fk->rk.dname, fk->rk.dname_len)
+			== 0) {
+			if((nm = packed_rrset_name_ref(k->rk.dname)) != NULL)
+				return nm;
+			break;
+		}
+	}
+	return packed_rrset_name_dup(fk->rk.dname, fk->rk.dname_len);
+}
+
 /** copy rrsets from replyinfo to dest replyinfo */
 static int
 repinfo_copy_rrsets(struct reply_info* dest, struct reply_info* from, 
@@ -653,9 +685,7 @@ repinfo_copy_rrsets(struct reply_info* dest, struct reply_info* from,
 			dk->id = fk->id;
 			dk->rk.dname = (uint8_t*)regional_alloc_init(region,
 				fk->rk.dname, fk->rk.dname_len);
-		} else	
-			dk->rk.dname = (uint8_t*)memdup(fk->rk.dname, 
-				fk->rk.dname_len);
+		} else	dk->rk.dname = repinfo_copy_name(dest, i, fk);
 		if(!dk->rk.dname)
 			return 0;
 		s = packed_rrset_sizeof(fd);
@@ -46,6 +46,7 @@
 struct sldns_buffer;
 struct comm_reply;
 struct alloc_cache;
+struct reply_wire;
 struct iovec;
 struct regional;
 struct edns_data;
@@ -154,6 +155,14 @@ struct reply_info {
 	/** number of RRsets: an_numrrsets + ns_numrrsets + ar_numrrsets */
 	size_t rrset_count;
 
+	/**
+	 * Pre-encoded wireformat answers for cache hits, for queries
+	 * without [0] and with [1] the DO bit, or NULL if not made yet.
+	 * Only used for replies in the message cache, and only changed with
+	 * the writelock on that cache entry held.  See msgencode.h.
+	 */
+	struct reply_wire* wire[2];
+
 	/** 
 	 * List of pointers (only) to the rrsets in the order in which 
 	 * they appear in the reply message.  
@@ -190,6 +199,9 @@ struct msgreply_entry {
 	struct query_info key;
 	/** the hash table entry, data is struct reply_info* */
 	struct lruhash_entry entry;
+	/** if the qname is shared with the owner name of an rrset in the
+	 * rrset cache, it is counted in the size of that rrset only */
+	int qname_shared;
 };
 
 /**
@@ -312,6 +324,8 @@ hashvalue_t query_info_hash(struct query_info *q, uint16_t flags);
 /**
  * Setup query info entry
  * @param q: query info to copy. Emptied as if clear is called.
+ *	The qname is allocated with packed_rrset_name_alloc, the entry
+ *	takes it over.
  * @param r: reply to init data.
  * @param h: hash value.
  * @return: newly allocated message reply cache item.
@@ -51,6 +51,58 @@
 #include "sldns/sbuffer.h"
 #include "sldns/wire2str.h"
 
+#if defined(__ATOMIC_RELAXED) && defined(__ATOMIC_ACQ_REL)
+/** the names can be shared, the reference count is changed atomically */
+#define PACKED_RRSET_NAME_SHARE 1
+#endif
+/** size of the reference count in front of the names */
+#define NAME_REF_SIZE sizeof(uint32_t)
+
+uint8_t*
+packed_rrset_name_alloc(size_t len)
+{
+	uint8_t* p = (uint8_t*)malloc(NAME_REF_SIZE + len);
+	if(!p)
+		return NULL;
+	*(uint32_t*)p = 1;
+	return p + NAME_REF_SIZE;
+}
+
+uint8_t*
+packed_rrset_name_dup(uint8_t* nm, size_t len)
+{
+	uint8_t* p = packed_rrset_name_alloc(len);
+	if(p)
+		memmove(p, nm, len);
+	return p;
+}
+
+uint8_t*
+packed_rrset_name_ref(uint8_t* nm)
+{
+#ifdef PACKED_RRSET_NAME_SHARE
+	(void)__atomic_add_fetch((uint32_t*)(nm - NAME_REF_SIZE), 1,
+		__ATOMIC_RELAXED);
+	return nm;
+#else
+	(void)nm;
+	return NULL;
+#endif
+}
+
+void
+packed_rrset_name_free(uint8_t* nm)
+{
+	if(!nm)
+		return;
+#ifdef PACKED_RRSET_NAME_SHARE
+	if(__atomic_sub_fetch((uint32_t*)(nm - NAME_REF_SIZE), 1,
+		__ATOMIC_ACQ_REL) != 0)
+		return;
+#endif
+	free(nm - NAME_REF_SIZE);
+}
+
 void
 ub_packed_rrset_parsedelete(struct ub_packed_rrset_key* pkey,
         struct alloc_cache* alloc)
@@ -60,8 +112,7 @@ ub_packed_rrset_parsedelete(struct ub_packed_rrset_key* pkey,
 	if(pkey->entry.data)
 		free(pkey->entry.data);
 	pkey->entry.data = NULL;
-	if(pkey->rk.dname)
-		free(pkey->rk.dname);
+	packed_rrset_name_free(pkey->rk.dname);
 	pkey->rk.dname = NULL;
 	pkey->id = 0;
 	alloc_special_release(alloc, pkey);
@@ -131,7 +182,7 @@ ub_rrset_key_delete(void* key, void* userdata)
 	struct ub_packed_rrset_key* k = (struct ub_packed_rrset_key*)key;
 	struct alloc_cache* a = (struct alloc_cache*)userdata;
 	k->id = 0;
-	free(k->rk.dname);
+	packed_rrset_name_free(k->rk.dname);
 	k->rk.dname = NULL;
 	alloc_special_release(a, k);
 }
@@ -169,9 +220,9 @@ rrset_key_hash(struct packed_rrset_key* key)
 	/* this routine does not have a compressed name */
 	hashvalue_t h = 0xab;
 	h = dname_query_hash(key->dname, h);
-	h = hashlittle(&t, sizeof(t), h);
-	h = hashlittle(&key->rrset_class, sizeof(uint16_t), h);
-	h = hashlittle(&key->flags, sizeof(uint32_t), h);
+	h = hash_bytes(&t, sizeof(t), h);
+	h = hash_bytes(&key->rrset_class, sizeof(uint16_t), h);
+	h = hash_bytes(&key->flags, sizeof(uint32_t), h);
 	return h;
 }
 
@@ -371,14 +422,14 @@ packed_rrset_copy_alloc(struct ub_packed_rrset_key* key,
 	fd = (struct packed_rrset_data*)key->entry.data;
 	dk->entry.hash = key->entry.hash;
 	dk->rk = key->rk;
-	dk->rk.dname = (uint8_t*)memdup(key->rk.dname, key->rk.dname_len);
+	dk->rk.dname = packed_rrset_name_dup(key->rk.dname, key->rk.dname_len);
 	if(!dk->rk.dname) {
 		alloc_special_release(alloc, dk);
 		return NULL;
 	}
 	dd = (struct packed_rrset_data*)memdup(fd, packed_rrset_sizeof(fd));
 	if(!dd) {
-		free(dk->rk.dname);
+		packed_rrset_name_free(dk->rk.dname);
 		alloc_special_release(alloc, dk);
 		return NULL;
 	}
@@ -72,6 +72,9 @@ struct packed_rrset_key {
 	 * The domain name. If not null (for id=0) it is allocated, and
 	 * contains the wireformat domain name.
 	 * This dname is not canonicalized.
+	 * For the keys that are not in a region, it is allocated with
+	 * packed_rrset_name_alloc, and it can be shared with other keys
+	 * and with the qname of the message in the msg cache.
 	 */
 	uint8_t* dname;
 	/** 
@@ -216,6 +219,12 @@ enum sec_status {
  *	since key.dname ends with type and class.
  *	and rr_data starts with the rdlength.
  *	the ttl value to send changes due to time.
+ *
+ * An rrset with a single RR keeps the same layout, with arrays of one.
+ * The arrays cost 24 bytes, of about 250 for a cached A record; most of
+ * it is the key and its hash entry.  Callers index rr_len, rr_data and
+ * rr_ttl directly, and the ttl loops adjust every rr_ttl[i] as well as
+ * ttl, so rr_ttl cannot alias ttl either.
  */
 struct packed_rrset_data {
 	/** TTL (in seconds like time()) of the rrset.
@@ -241,6 +250,10 @@ struct packed_rrset_data {
 	 * rr_data[count] to rr_data[count+rrsig_count] contain the rrsig data.
 	 */
 	uint8_t** rr_data;
+	/** version of the data, a new id is set when the data is put in
+	 * the rrset cache.  Pre-encoded answers check it, because new data
+	 * can be allocated at the address of data that was deleted. */
+	rrset_id_t version;
 };
 
 /**
@@ -265,6 +278,43 @@ struct packed_rrset_list {
 	struct packed_rrset rrset;
 };
 
+/**
+ * Allocate a domain name for an rrset key, or for the qname of a message,
+ * that is kept in the caches.  The name has a reference count in front
+ * of it, so that rrsets and messages with the same owner name can share
+ * one copy of the name.  Free it with packed_rrset_name_free.
+ * @param len: length of the name.
+ * @return the space for the name, to fill in, or NULL on malloc failure.
+ */
+uint8_t* packed_rrset_name_alloc(size_t len);
+
+/**
+ * Allocate a copy of a domain name, with packed_rrset_name_alloc.
+ * @param nm: the name to copy.
+ * @param len: length of the name.
+ * @return the new name, or NULL on malloc failure.
+ */
+uint8_t* packed_rrset_name_dup(uint8_t* nm, size_t len);
+
+/**
+ * Take another reference to a name from packed_rrset_name_alloc.  If the
+ * name is in use by an rrset in the cache, the caller must hold its lock
+ * and check the id, so that it is not deleted meanwhile.  The memory of
+ * a shared name is counted once, in the size of the rrset; a message
+ * that shares its qname sets qname_shared in its msgreply_entry.
+ * @param nm: the name.
+ * @return the name, or NULL if the names cannot be shared on this
+ *	platform (there are no atomic operations).
+ */
+uint8_t* packed_rrset_name_ref(uint8_t* nm);
+
+/**
+ * Release a name from packed_rrset_name_alloc.  It is freed when it is
+ * no longer in use.
+ * @param nm: the name, or NULL.
+ */
+void packed_rrset_name_free(uint8_t* nm);
+
 /**
  * Delete packed rrset key and data, not entered in hashtables yet.
  * Used during parsing.
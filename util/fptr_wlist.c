@@ -48,6 +48,7 @@
 #include "util/mini_event.h"
 #include "services/outside_network.h"
 #include "services/mesh.h"
+#include "services/inflight.h"
 #include "services/localzone.h"
 #include "services/cache/infra.h"
 #include "services/cache/rrset.h"
@@ -79,6 +80,36 @@
 #include "pythonmod/pythonmod.h"
 #endif
 
+/** max number of callbacks that a test program can add */
+#define FPTR_TEST_MAX 16
+/** the callbacks that a test program has added */
+static fptr_test_func_type fptr_test_list[FPTR_TEST_MAX];
+/** the number of callbacks in fptr_test_list */
+static int fptr_test_num = 0;
+
+void
+fptr_whitelist_test_add(fptr_test_func_type fptr)
+{
+	int i;
+	for(i=0; i<fptr_test_num; i++)
+		if(fptr_test_list[i] == fptr)
+			return;
+	if(fptr_test_num >= FPTR_TEST_MAX)
+		fatal_exit("fptr_whitelist_test_add: too many callbacks");
+	fptr_test_list[fptr_test_num++] = fptr;
+}
+
+/** check if a test program has added the callback */
+static int
+fptr_whitelist_test(fptr_test_func_type fptr)
+{
+	int i;
+	for(i=0; i<fptr_test_num; i++)
+		if(fptr_test_list[i] == fptr)
+			return 1;
+	return 0;
+}
+
 int 
 fptr_whitelist_comm_point(comm_point_callback_t *fptr)
 {
@@ -86,6 +117,7 @@ fptr_whitelist_comm_point(comm_point_callback_t *fptr)
 	else if(fptr == &outnet_udp_cb) return 1;
 	else if(fptr == &outnet_tcp_cb) return 1;
 	else if(fptr == &tube_handle_listen) return 1;
+	else if(fptr_whitelist_test((fptr_test_func_type)fptr)) return 1;
 	return 0;
 }
 
@@ -104,9 +136,15 @@ fptr_whitelist_comm_timer(void (*fptr)(void*))
 {
 	if(fptr == &pending_udp_timer_cb) return 1;
 	else if(fptr == &outnet_tcptimer) return 1;
+	else if(fptr == &outnet_tcp_idle_timeout) return 1;
+	else if(fptr == &serviced_hedge_timeout) return 1;
 	else if(fptr == &pending_udp_timer_delay_cb) return 1;
 	else if(fptr == &worker_stat_timer_cb) return 1;
 	else if(fptr == &worker_probe_timer_cb) return 1;
+	else if(fptr == &worker_snapshot_timer_cb) return 1;
+	else if(fptr == &worker_inflight_timer_cb) return 1;
+	else if(fptr == &comm_point_tcp_accept_retry) return 1;
+	else if(fptr_whitelist_test((fptr_test_func_type)fptr)) return 1;
 #ifdef UB_ON_WINDOWS
 	else if(fptr == &wsvc_cron_cb) return 1;
 #endif
@@ -140,6 +178,7 @@ fptr_whitelist_event(void (*fptr)(int, short, void *))
 	else if(fptr == &comm_point_tcp_accept_callback) return 1;
 	else if(fptr == &comm_point_tcp_handle_callback) return 1;
 	else if(fptr == &comm_timer_callback) return 1;
+	else if(fptr == &comm_wheel_callback) return 1;
 	else if(fptr == &comm_signal_callback) return 1;
 	else if(fptr == &comm_point_local_handle_callback) return 1;
 	else if(fptr == &comm_point_raw_handle_callback) return 1;
@@ -166,6 +205,7 @@ fptr_whitelist_pending_tcp(comm_point_callback_t *fptr)
 	if(fptr == &serviced_tcp_callback) return 1;
 	else if(fptr == &worker_handle_reply) return 1;
 	else if(fptr == &libworker_handle_reply) return 1;
+	else if(fptr_whitelist_test((fptr_test_func_type)fptr)) return 1;
 	return 0;
 }
 
@@ -182,12 +222,14 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 {
 	if(fptr == &mesh_state_compare) return 1;
 	else if(fptr == &mesh_state_ref_compare) return 1;
+	else if(fptr == &inflight_entry_compare) return 1;
 	else if(fptr == &addr_tree_compare) return 1;
 	else if(fptr == &local_zone_cmp) return 1;
 	else if(fptr == &local_data_cmp) return 1;
 	else if(fptr == &fwd_cmp) return 1;
 	else if(fptr == &pending_cmp) return 1;
 	else if(fptr == &serviced_cmp) return 1;
+	else if(fptr == &reuse_cmp) return 1;
 	else if(fptr == &name_tree_compare) return 1;
 	else if(fptr == &order_lock_cmp) return 1;
 	else if(fptr == &codeline_cmp) return 1;
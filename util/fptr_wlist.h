@@ -335,6 +335,18 @@ int fptr_whitelist_mesh_cb(mesh_cb_func_t fptr);
  */
 int fptr_whitelist_print_func(void (*fptr)(char*,void*));
 
+/** the type that function pointers of a test program are stored as */
+typedef void (*fptr_test_func_type)(void);
+
+/**
+ * Add a callback of a test program to the whitelists for comm_point,
+ * comm_timer and pending_tcp callbacks.  The callbacks of the unit test
+ * are not linked into the other programs, so they cannot be listed here;
+ * the unit test adds them before it uses them.  Not thread safe.
+ * @param fptr: function pointer to add, cast to fptr_test_func_type.
+ */
+void fptr_whitelist_test_add(fptr_test_func_type fptr);
+
 /** Due to module breakage by fptr wlist, these test app declarations
  * are presented here */
 /** 
@@ -371,6 +371,8 @@ enum module_ev {
 	module_event_noreply,
 	/** reply is there, but capitalisation check failed */
 	module_event_capsfail,
+	/** no reply yet, the query is slow and can be sent elsewhere too */
+	module_event_slow,
 	/** next module is done, and its reply is awaiting you */
 	module_event_moddone,
 	/** error */
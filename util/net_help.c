@@ -64,6 +64,15 @@ int MINIMAL_RESPONSES = 0;
 /** rrset order roundrobin: default is no */
 int RRSET_ROUNDROBIN = 0;
 
+/** serve expired answers from the cache: default is no */
+int SERVE_EXPIRED = 0;
+
+/** seconds after expiry that answers are served, 0 is no limit */
+time_t SERVE_EXPIRED_TTL = 86400;
+
+/** TTL for the expired records in an answer */
+time_t SERVE_EXPIRED_REPLY_TTL = 30;
+
 /* returns true is string addr is an ip6 specced address */
 int
 str_is_ip6(const char* str)
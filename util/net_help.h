@@ -99,6 +99,15 @@ extern int MINIMAL_RESPONSES;
 /** rrset order roundrobin */
 extern int RRSET_ROUNDROBIN;
 
+/** serve expired answers from the cache */
+extern int SERVE_EXPIRED;
+
+/** seconds after expiry that answers are served, 0 is no limit */
+extern time_t SERVE_EXPIRED_TTL;
+
+/** TTL for the expired records in an answer */
+extern time_t SERVE_EXPIRED_REPLY_TTL;
+
 /**
  * See if string is ip4 or ip6.
  * @param str: IP specification.
@@ -87,6 +87,35 @@
 #define NUM_UDP_PER_SELECT 1
 #endif
 
+/** size of the buffer for the ancillary data of a UDP datagram */
+#define UDP_ANCIL_SIZE 256
+
+/** initial size of the read buffer of a pipelined tcp handler */
+#define TCP_READ_BUFFER_SIZE 512
+
+/** msec after which accept is tried again, when it paused because all
+ * tcp handlers were in use; a stream can be idle by then */
+#define TCP_ACCEPT_RETRY_TIME 1000
+
+/** number of bits of the slot number in a level of the timer wheel */
+#define WHEEL_BITS 6
+/** number of slots in a level of the timer wheel */
+#define WHEEL_SLOTS (1<<WHEEL_BITS)
+/** mask for the slot number */
+#define WHEEL_MASK (WHEEL_SLOTS-1)
+/** number of levels of the timer wheel, 2**24 msec, about 4.6 hours.
+ * Longer timeouts are cascaded again from the top level */
+#define WHEEL_LEVELS 4
+
+/** an answer in the write queue of a pipelined tcp handler */
+struct comm_tcp_answer {
+	/** next answer in the queue */
+	struct comm_tcp_answer* next;
+	/** length of the data, it follows the struct, including the
+	 * two byte length prefix (or what is left of it) */
+	size_t len;
+};
+
 /* We define libevent structures here to hide the libevent stuff. */
 
 #ifdef USE_MINI_EVENT
@@ -131,18 +160,94 @@ struct internal_base {
 	struct event slow_accept;
 	/** true if slow_accept is enabled */
 	int slow_accept_enabled;
+	/** buffers for batched UDP, or NULL if not batched */
+	struct udp_batch* udp_batch;
+	/** the timer wheel, or NULL if there are no timers on it */
+	struct timer_wheel* wheel;
+};
+
+/** link in a list of the timer wheel, circular with the slot as head */
+struct wheel_link {
+	/** next in list */
+	struct wheel_link* next;
+	/** previous in list */
+	struct wheel_link* prev;
+};
+
+/**
+ * Hierarchical timer wheel, with msec slots in the first level, and
+ * slots of 64 times the length of the slots of the level below it in
+ * the next level. A timer is put in the level where its expiry fits,
+ * and is moved down a level, cascaded, when the time reaches its slot.
+ * Set and disable are O(1), and one event runs the wheel.
+ */
+struct timer_wheel {
+	/** the next msec to run, the timers before it have run */
+	uint64_t cur;
+	/** the slots, lists of the timers */
+	struct wheel_link slot[WHEEL_LEVELS][WHEEL_SLOTS];
+	/** number of timers in every level */
+	size_t num[WHEEL_LEVELS];
+	/** the event that runs the wheel */
+	struct event ev;
+	/** if the event is added */
+	int ev_added;
+	/** the msec time the event is added for */
+	uint64_t ev_when;
+};
+
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG)
+/**
+ * Buffers to read UDP datagrams with one recvmmsg call and to send the
+ * replies with one sendmmsg call. Shared by the UDP comm points of a
+ * comm_base, like the udp buffer, because only one of them reads at a time.
+ */
+struct udp_batch {
+	/** number of slots */
+	int num;
+	/** datagram and reply buffer per slot */
+	sldns_buffer** buf;
+	/** reply address and interface per slot */
+	struct comm_reply* rep;
+	/** message headers for recvmmsg, per slot */
+	struct mmsghdr* recv;
+	/** message headers for sendmmsg, for the replies */
+	struct mmsghdr* send;
+	/** io vector per slot for recvmmsg */
+	struct iovec* recv_iov;
+	/** io vector for the replies */
+	struct iovec* send_iov;
+	/** received ancillary data per slot, UDP_ANCIL_SIZE each */
+	char* recv_ancil;
+	/** ancillary data for the replies, UDP_ANCIL_SIZE each */
+	char* send_ancil;
+	/** the comm point that the queued replies are for */
+	struct comm_point* send_c;
+	/** number of queued replies */
+	int num_send;
 };
+#endif /* HAVE_RECVMMSG && HAVE_SENDMMSG */
 
 /**
  * Internal timer structure, to store timer event in.
  */
 struct internal_timer {
+	/** link in the slot of the timer wheel, must be first */
+	struct wheel_link link;
 	/** the comm base */
 	struct comm_base* base;
 	/** libevent event type, alloced here */
 	struct event ev;
 	/** is timer enabled */
 	uint8_t enabled;
+	/** if the timer is on the timer wheel, and not an event */
+	uint8_t on_wheel;
+	/** level of the wheel that the timer is in */
+	uint8_t level;
+	/** the comm timer, for the callback from the wheel */
+	struct comm_timer* tm;
+	/** msec time when the timer expires, on the wheel */
+	uint64_t expire;
 };
 
 /**
@@ -159,6 +264,8 @@ struct internal_signal {
 static struct comm_point* comm_point_create_tcp_handler(
 	struct comm_base *base, struct comm_point* parent, size_t bufsize,
         comm_point_callback_t* callback, void* callback_arg);
+/** make a tcp handler free for the next connection */
+static void reclaim_tcp_handler(struct comm_point* c);
 
 /* -------- End of local definitions -------- */
 
@@ -177,6 +284,75 @@ comm_base_now(struct comm_base* b)
 }
 #endif /* USE_MINI_EVENT */
 
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG)
+/** delete udp batch buffers */
+static void
+udp_batch_delete(struct udp_batch* ub)
+{
+	int i;
+	if(!ub)
+		return;
+	if(ub->buf) {
+		for(i=0; i<ub->num; i++)
+			sldns_buffer_free(ub->buf[i]);
+		free(ub->buf);
+	}
+	free(ub->rep);
+	free(ub->recv);
+	free(ub->send);
+	free(ub->recv_iov);
+	free(ub->send_iov);
+	free(ub->recv_ancil);
+	free(ub->send_ancil);
+	free(ub);
+}
+
+/** create udp batch buffers */
+static struct udp_batch*
+udp_batch_create(int num, size_t bufsize)
+{
+	int i;
+	struct udp_batch* ub = (struct udp_batch*)calloc(1, sizeof(*ub));
+	if(!ub)
+		return NULL;
+	ub->num = num;
+	ub->buf = (sldns_buffer**)calloc((size_t)num, sizeof(sldns_buffer*));
+	ub->rep = (struct comm_reply*)calloc((size_t)num,
+		sizeof(struct comm_reply));
+	ub->recv = (struct mmsghdr*)calloc((size_t)num, sizeof(struct mmsghdr));
+	ub->send = (struct mmsghdr*)calloc((size_t)num, sizeof(struct mmsghdr));
+	ub->recv_iov = (struct iovec*)calloc((size_t)num, sizeof(struct iovec));
+	ub->send_iov = (struct iovec*)calloc((size_t)num, sizeof(struct iovec));
+	ub->recv_ancil = (char*)calloc((size_t)num, UDP_ANCIL_SIZE);
+	ub->send_ancil = (char*)calloc((size_t)num, UDP_ANCIL_SIZE);
+	if(!ub->buf || !ub->rep || !ub->recv || !ub->send || !ub->recv_iov
+		|| !ub->send_iov || !ub->recv_ancil || !ub->send_ancil) {
+		udp_batch_delete(ub);
+		return NULL;
+	}
+	for(i=0; i<num; i++) {
+		ub->buf[i] = sldns_buffer_new(bufsize);
+		if(!ub->buf[i]) {
+			udp_batch_delete(ub);
+			return NULL;
+		}
+	}
+	return ub;
+}
+#endif /* HAVE_RECVMMSG && HAVE_SENDMMSG */
+
+/** delete the timer wheel of the base */
+static void
+wheel_delete(struct comm_base* b)
+{
+	if(!b->eb->wheel)
+		return;
+	if(b->eb->wheel->ev_added)
+		(void)evtimer_del(&b->eb->wheel->ev);
+	free(b->eb->wheel);
+	b->eb->wheel = NULL;
+}
+
 struct comm_base* 
 comm_base_create(int sigs)
 {
@@ -263,6 +439,7 @@ comm_base_delete(struct comm_base* b)
 			log_err("could not event_del slow_accept");
 		}
 	}
+	wheel_delete(b);
 #ifdef USE_MINI_EVENT
 	event_base_free(b->eb->base);
 #elif defined(HAVE_EVENT_BASE_FREE) && defined(HAVE_EVENT_BASE_ONCE)
@@ -271,6 +448,9 @@ comm_base_delete(struct comm_base* b)
  	   in libevent 1.3c (event_base_once appears) this is fixed. */
 	event_base_free(b->eb->base);
 #endif /* HAVE_EVENT_BASE_FREE and HAVE_EVENT_BASE_ONCE */
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG)
+	udp_batch_delete(b->eb->udp_batch);
+#endif
 	b->eb->base = NULL;
 	free(b->eb);
 	free(b);
@@ -286,11 +466,39 @@ comm_base_delete_no_base(struct comm_base* b)
 			log_err("could not event_del slow_accept");
 		}
 	}
+	wheel_delete(b);
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG)
+	udp_batch_delete(b->eb->udp_batch);
+#endif
 	b->eb->base = NULL;
 	free(b->eb);
 	free(b);
 }
 
+int
+comm_base_set_udp_batch(struct comm_base* b, int num, size_t bufsize)
+{
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG)
+	udp_batch_delete(b->eb->udp_batch);
+	b->eb->udp_batch = NULL;
+	if(num <= 1)
+		return 1;
+	b->eb->udp_batch = udp_batch_create(num, bufsize);
+	if(!b->eb->udp_batch) {
+		log_err("out of memory for udp batch of %d", num);
+		return 0;
+	}
+	return 1;
+#else
+	(void)b;
+	(void)bufsize;
+	if(num > 1)
+		verbose(VERB_OPS, "udp-batch-size: no recvmmsg and sendmmsg "
+			"on this system, datagrams are read one at a time");
+	return 1;
+#endif /* HAVE_RECVMMSG && HAVE_SENDMMSG */
+}
+
 void 
 comm_base_timept(struct comm_base* b, time_t** tt, struct timeval** tv)
 {
@@ -461,46 +669,23 @@ static void p_ancil(const char* str, struct comm_reply* r)
 }
 #endif /* AF_INET6 && IPV6_PKTINFO && HAVE_RECVMSG||HAVE_SENDMSG */
 
-/** send a UDP reply over specified interface*/
-static int
-comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
-	struct sockaddr* addr, socklen_t addrlen, struct comm_reply* r) 
-{
 #if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_SENDMSG)
-	ssize_t sent;
-	struct msghdr msg;
-	struct iovec iov[1];
-	char control[256];
+/**
+ * Put the source address of a UDP reply in the control data of the msg.
+ * @param msg: msg_control points to UDP_ANCIL_SIZE bytes.
+ * @param r: reply with the interface the query arrived on.
+ */
+static void
+udp_send_ancil(struct msghdr* msg, struct comm_reply* r)
+{
 #ifndef S_SPLINT_S
 	struct cmsghdr *cmsg;
-#endif /* S_SPLINT_S */
-
-	log_assert(c->fd != -1);
-#ifdef UNBOUND_DEBUG
-	if(sldns_buffer_remaining(packet) == 0)
-		log_err("error: send empty UDP packet");
-#endif
-	log_assert(addr && addrlen > 0);
-
-	msg.msg_name = addr;
-	msg.msg_namelen = addrlen;
-	iov[0].iov_base = sldns_buffer_begin(packet);
-	iov[0].iov_len = sldns_buffer_remaining(packet);
-	msg.msg_iov = iov;
-	msg.msg_iovlen = 1;
-	msg.msg_control = control;
-#ifndef S_SPLINT_S
-	msg.msg_controllen = sizeof(control);
-#endif /* S_SPLINT_S */
-	msg.msg_flags = 0;
-
-#ifndef S_SPLINT_S
-	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg = CMSG_FIRSTHDR(msg);
 	if(r->srctype == 4) {
 #ifdef IP_PKTINFO
 		void* cmsg_data;
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in_pktinfo));
-		log_assert(msg.msg_controllen <= sizeof(control));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in_pktinfo));
+		log_assert(msg->msg_controllen <= UDP_ANCIL_SIZE);
 		cmsg->cmsg_level = IPPROTO_IP;
 		cmsg->cmsg_type = IP_PKTINFO;
 		memmove(CMSG_DATA(cmsg), &r->pktinfo.v4info,
@@ -510,8 +695,8 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 		((struct in_pktinfo *) cmsg_data)->ipi_ifindex = 0;
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in_pktinfo));
 #elif defined(IP_SENDSRCADDR)
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in_addr));
-		log_assert(msg.msg_controllen <= sizeof(control));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in_addr));
+		log_assert(msg->msg_controllen <= UDP_ANCIL_SIZE);
 		cmsg->cmsg_level = IPPROTO_IP;
 		cmsg->cmsg_type = IP_SENDSRCADDR;
 		memmove(CMSG_DATA(cmsg), &r->pktinfo.v4addr,
@@ -519,12 +704,12 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in_addr));
 #else
 		verbose(VERB_ALGO, "no IP_PKTINFO or IP_SENDSRCADDR");
-		msg.msg_control = NULL;
+		msg->msg_control = NULL;
 #endif /* IP_PKTINFO or IP_SENDSRCADDR */
 	} else if(r->srctype == 6) {
 		void* cmsg_data;
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
-		log_assert(msg.msg_controllen <= sizeof(control));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
+		log_assert(msg->msg_controllen <= UDP_ANCIL_SIZE);
 		cmsg->cmsg_level = IPPROTO_IPV6;
 		cmsg->cmsg_type = IPV6_PKTINFO;
 		memmove(CMSG_DATA(cmsg), &r->pktinfo.v6info,
@@ -535,14 +720,51 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in6_pktinfo));
 	} else {
 		/* try to pass all 0 to use default route */
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
-		log_assert(msg.msg_controllen <= sizeof(control));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
+		log_assert(msg->msg_controllen <= UDP_ANCIL_SIZE);
 		cmsg->cmsg_level = IPPROTO_IPV6;
 		cmsg->cmsg_type = IPV6_PKTINFO;
 		memset(CMSG_DATA(cmsg), 0, sizeof(struct in6_pktinfo));
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in6_pktinfo));
 	}
+#else
+	(void)msg;
+	(void)r;
+#endif /* S_SPLINT_S */
+}
+#endif /* AF_INET6 && IPV6_PKTINFO && HAVE_SENDMSG */
+
+/** send a UDP reply over specified interface*/
+static int
+comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
+	struct sockaddr* addr, socklen_t addrlen, struct comm_reply* r) 
+{
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_SENDMSG)
+	ssize_t sent;
+	struct msghdr msg;
+	struct iovec iov[1];
+	char control[UDP_ANCIL_SIZE];
+
+	log_assert(c->fd != -1);
+#ifdef UNBOUND_DEBUG
+	if(sldns_buffer_remaining(packet) == 0)
+		log_err("error: send empty UDP packet");
+#endif
+	log_assert(addr && addrlen > 0);
+
+	msg.msg_name = addr;
+	msg.msg_namelen = addrlen;
+	iov[0].iov_base = sldns_buffer_begin(packet);
+	iov[0].iov_len = sldns_buffer_remaining(packet);
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+#ifndef S_SPLINT_S
+	msg.msg_controllen = sizeof(control);
 #endif /* S_SPLINT_S */
+	msg.msg_flags = 0;
+
+	udp_send_ancil(&msg, r);
 	if(verbosity >= VERB_ALGO)
 		p_ancil("send_udp over interface", r);
 	sent = sendmsg(c->fd, &msg, 0);
@@ -570,6 +792,194 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 #endif /* AF_INET6 && IPV6_PKTINFO && HAVE_SENDMSG */
 }
 
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_RECVMSG)
+/**
+ * Get the interface address a UDP datagram arrived on from the control
+ * data of the msg.
+ * @param msg: the received message.
+ * @param rep: srctype and pktinfo are set in it.
+ */
+static void
+udp_recv_ancil(struct msghdr* msg, struct comm_reply* rep)
+{
+#ifndef S_SPLINT_S
+	struct cmsghdr* cmsg;
+	rep->srctype = 0;
+	for(cmsg = CMSG_FIRSTHDR(msg); cmsg != NULL;
+		cmsg = CMSG_NXTHDR(msg, cmsg)) {
+		if( cmsg->cmsg_level == IPPROTO_IPV6 &&
+			cmsg->cmsg_type == IPV6_PKTINFO) {
+			rep->srctype = 6;
+			memmove(&rep->pktinfo.v6info, CMSG_DATA(cmsg),
+				sizeof(struct in6_pktinfo));
+			break;
+#ifdef IP_PKTINFO
+		} else if( cmsg->cmsg_level == IPPROTO_IP &&
+			cmsg->cmsg_type == IP_PKTINFO) {
+			rep->srctype = 4;
+			memmove(&rep->pktinfo.v4info, CMSG_DATA(cmsg),
+				sizeof(struct in_pktinfo));
+			break;
+#elif defined(IP_RECVDSTADDR)
+		} else if( cmsg->cmsg_level == IPPROTO_IP &&
+			cmsg->cmsg_type == IP_RECVDSTADDR) {
+			rep->srctype = 4;
+			memmove(&rep->pktinfo.v4addr, CMSG_DATA(cmsg),
+				sizeof(struct in_addr));
+			break;
+#endif /* IP_PKTINFO or IP_RECVDSTADDR */
+		}
+	}
+	if(verbosity >= VERB_ALGO)
+		p_ancil("receive_udp on interface", rep);
+#else
+	(void)msg;
+	rep->srctype = 0;
+#endif /* S_SPLINT_S */
+}
+#endif /* AF_INET6 && IPV6_PKTINFO && HAVE_RECVMSG */
+
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG)
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_RECVMSG) && defined(HAVE_SENDMSG)
+/** batched UDP can use the interface of the query for the reply */
+#define UDP_BATCH_ANCIL 1
+#endif
+
+/**
+ * Send the queued replies of a batch with sendmmsg. A reply that fails is
+ * logged like a failed sendto, and skipped.
+ * @param ub: batch with ub->num_send replies set up in ub->send, for
+ *	the comm point ub->send_c.
+ */
+static void
+udp_batch_send(struct udp_batch* ub)
+{
+	int done = 0, sent, num = ub->num_send;
+	int fd = ub->send_c?ub->send_c->fd:-1;
+	ub->num_send = 0;
+	ub->send_c = NULL;
+	if(fd == -1)
+		return;
+	while(done < num) {
+		sent = sendmmsg(fd, ub->send+done, (unsigned int)(num-done),
+			0);
+		if(sent == -1) {
+			struct msghdr* m = &ub->send[done].msg_hdr;
+			if(errno == EINTR)
+				continue;
+			if(udp_send_errno_needs_log((struct sockaddr*)m->msg_name,
+				m->msg_namelen)) {
+				verbose(VERB_OPS, "sendmmsg failed: %s",
+					strerror(errno));
+				log_addr(VERB_OPS, "remote address is",
+					(struct sockaddr_storage*)m->msg_name,
+					m->msg_namelen);
+			}
+			done++;
+			continue;
+		}
+		done += sent;
+	}
+}
+
+/**
+ * Read a batch of UDP datagrams with recvmmsg, pass them to the callback
+ * one at a time, and send the immediate replies with sendmmsg.
+ * The comm point buffer is swapped for the slot buffer during the callback.
+ * @param c: the UDP comm point.
+ * @param fd: the fd that is readable.
+ * @param ub: the batch buffers.
+ * @param ancil: if the interface of the query is used for the reply.
+ * @return number of datagrams read, or 0 if no more datagrams are
+ *	waiting or the comm point was closed.
+ */
+static int
+comm_point_udp_batch(struct comm_point* c, int fd, struct udp_batch* ub,
+	int ancil)
+{
+	sldns_buffer* orig = c->buffer;
+	int i, n;
+	ub->send_c = c;
+	ub->num_send = 0;
+	for(i=0; i<ub->num; i++) {
+		struct msghdr* m = &ub->recv[i].msg_hdr;
+		sldns_buffer_clear(ub->buf[i]);
+		ub->recv_iov[i].iov_base = sldns_buffer_begin(ub->buf[i]);
+		ub->recv_iov[i].iov_len = sldns_buffer_remaining(ub->buf[i]);
+		memset(m, 0, sizeof(*m));
+		m->msg_name = &ub->rep[i].addr;
+		m->msg_namelen = (socklen_t)sizeof(ub->rep[i].addr);
+		m->msg_iov = &ub->recv_iov[i];
+		m->msg_iovlen = 1;
+		if(ancil) {
+			m->msg_control = ub->recv_ancil + i*UDP_ANCIL_SIZE;
+#ifndef S_SPLINT_S
+			m->msg_controllen = UDP_ANCIL_SIZE;
+#endif /* S_SPLINT_S */
+		}
+	}
+	n = recvmmsg(fd, ub->recv, (unsigned int)ub->num, 0, NULL);
+	if(n == -1) {
+		if(errno != EAGAIN && errno != EINTR)
+			log_err("recvmmsg %d failed: %s", fd, strerror(errno));
+		ub->send_c = NULL;
+		return 0;
+	}
+	for(i=0; i<n; i++) {
+		struct comm_reply* rep = &ub->rep[i];
+		rep->c = c;
+		rep->addrlen = ub->recv[i].msg_hdr.msg_namelen;
+		sldns_buffer_skip(ub->buf[i], (ssize_t)ub->recv[i].msg_len);
+		sldns_buffer_flip(ub->buf[i]);
+		rep->srctype = 0;
+#ifdef UDP_BATCH_ANCIL
+		if(ancil)
+			udp_recv_ancil(&ub->recv[i].msg_hdr, rep);
+#endif
+		c->buffer = ub->buf[i];
+		fptr_ok(fptr_whitelist_comm_point(c->callback));
+		if((*c->callback)(c, c->cb_arg, NETEVENT_NOERROR, rep)) {
+			/* queue the immediate reply */
+			struct msghdr* m = &ub->send[ub->num_send].msg_hdr;
+			memset(m, 0, sizeof(*m));
+			m->msg_name = &rep->addr;
+			m->msg_namelen = rep->addrlen;
+			ub->send_iov[ub->num_send].iov_base =
+				sldns_buffer_begin(ub->buf[i]);
+			ub->send_iov[ub->num_send].iov_len =
+				sldns_buffer_remaining(ub->buf[i]);
+			m->msg_iov = &ub->send_iov[ub->num_send];
+			m->msg_iovlen = 1;
+#ifdef UDP_BATCH_ANCIL
+			if(ancil) {
+				m->msg_control = ub->send_ancil +
+					ub->num_send*UDP_ANCIL_SIZE;
+#ifndef S_SPLINT_S
+				m->msg_controllen = UDP_ANCIL_SIZE;
+#endif /* S_SPLINT_S */
+				udp_send_ancil(m, rep);
+				if(verbosity >= VERB_ALGO)
+					p_ancil("send_udp over interface", rep);
+			}
+#endif /* UDP_BATCH_ANCIL */
+			ub->num_send++;
+		}
+		c->buffer = orig;
+		if(c->fd != fd) {
+			/* commpoint closed or reused; the close has sent
+			 * the replies that were queued for the socket */
+			udp_batch_send(ub);
+			return 0;
+		}
+	}
+	udp_batch_send(ub);
+	/* a short read means the socket has been drained */
+	if(n < ub->num)
+		return 0;
+	return n;
+}
+#endif /* HAVE_RECVMMSG && HAVE_SENDMMSG */
+
 void 
 comm_point_udp_ancil_callback(int fd, short event, void* arg)
 {
@@ -578,11 +988,8 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 	struct msghdr msg;
 	struct iovec iov[1];
 	ssize_t rcv;
-	char ancil[256];
+	char ancil[UDP_ANCIL_SIZE];
 	int i;
-#ifndef S_SPLINT_S
-	struct cmsghdr* cmsg;
-#endif /* S_SPLINT_S */
 
 	rep.c = (struct comm_point*)arg;
 	log_assert(rep.c->type == comm_udp);
@@ -591,6 +998,17 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 		return;
 	log_assert(rep.c && rep.c->buffer && rep.c->fd == fd);
 	comm_base_now(rep.c->ev->base);
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG) && defined(UDP_BATCH_ANCIL)
+	if(rep.c->udp_batch && rep.c->ev->base->eb->udp_batch) {
+		struct udp_batch* ub = rep.c->ev->base->eb->udp_batch;
+		int n;
+		for(i=0; i<NUM_UDP_PER_SELECT; i+=n) {
+			if((n=comm_point_udp_batch(rep.c, fd, ub, 1)) == 0)
+				break;
+		}
+		return;
+	}
+#endif /* HAVE_RECVMMSG && HAVE_SENDMMSG && UDP_BATCH_ANCIL */
 	for(i=0; i<NUM_UDP_PER_SELECT; i++) {
 		sldns_buffer_clear(rep.c->buffer);
 		rep.addrlen = (socklen_t)sizeof(rep.addr);
@@ -617,36 +1035,7 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 		rep.addrlen = msg.msg_namelen;
 		sldns_buffer_skip(rep.c->buffer, rcv);
 		sldns_buffer_flip(rep.c->buffer);
-		rep.srctype = 0;
-#ifndef S_SPLINT_S
-		for(cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL;
-			cmsg = CMSG_NXTHDR(&msg, cmsg)) {
-			if( cmsg->cmsg_level == IPPROTO_IPV6 &&
-				cmsg->cmsg_type == IPV6_PKTINFO) {
-				rep.srctype = 6;
-				memmove(&rep.pktinfo.v6info, CMSG_DATA(cmsg),
-					sizeof(struct in6_pktinfo));
-				break;
-#ifdef IP_PKTINFO
-			} else if( cmsg->cmsg_level == IPPROTO_IP &&
-				cmsg->cmsg_type == IP_PKTINFO) {
-				rep.srctype = 4;
-				memmove(&rep.pktinfo.v4info, CMSG_DATA(cmsg),
-					sizeof(struct in_pktinfo));
-				break;
-#elif defined(IP_RECVDSTADDR)
-			} else if( cmsg->cmsg_level == IPPROTO_IP &&
-				cmsg->cmsg_type == IP_RECVDSTADDR) {
-				rep.srctype = 4;
-				memmove(&rep.pktinfo.v4addr, CMSG_DATA(cmsg),
-					sizeof(struct in_addr));
-				break;
-#endif /* IP_PKTINFO or IP_RECVDSTADDR */
-			}
-		}
-		if(verbosity >= VERB_ALGO)
-			p_ancil("receive_udp on interface", &rep);
-#endif /* S_SPLINT_S */
+		udp_recv_ancil(&msg, &rep);
 		fptr_ok(fptr_whitelist_comm_point(rep.c->callback));
 		if((*rep.c->callback)(rep.c, rep.c->cb_arg, NETEVENT_NOERROR, &rep)) {
 			/* send back immediate reply */
@@ -679,6 +1068,17 @@ comm_point_udp_callback(int fd, short event, void* arg)
 		return;
 	log_assert(rep.c && rep.c->buffer && rep.c->fd == fd);
 	comm_base_now(rep.c->ev->base);
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG)
+	if(rep.c->udp_batch && rep.c->ev->base->eb->udp_batch) {
+		struct udp_batch* ub = rep.c->ev->base->eb->udp_batch;
+		int n;
+		for(i=0; i<NUM_UDP_PER_SELECT; i+=n) {
+			if((n=comm_point_udp_batch(rep.c, fd, ub, 0)) == 0)
+				break;
+		}
+		return;
+	}
+#endif /* HAVE_RECVMMSG && HAVE_SENDMMSG */
 	for(i=0; i<NUM_UDP_PER_SELECT; i++) {
 		sldns_buffer_clear(rep.c->buffer);
 		rep.addrlen = (socklen_t)sizeof(rep.addr);
@@ -723,8 +1123,12 @@ setup_tcp_handler(struct comm_point* c, int fd)
 	log_assert(c->type == comm_tcp);
 	log_assert(c->fd == -1);
 	sldns_buffer_clear(c->buffer);
+	if(c->tcp_read_buffer)
+		sldns_buffer_clear(c->tcp_read_buffer);
 	c->tcp_is_reading = 1;
 	c->tcp_byte_count = 0;
+	c->tcp_read_closed = 0;
+	c->tcp_last_active = c->ev->base->eb->secs;
 	comm_point_start_listening(c, fd, TCP_QUERY_TIMEOUT);
 }
 
@@ -850,6 +1254,103 @@ comm_point_tcp_win_bio_cb(struct comm_point* c, void* thessl)
 }
 #endif
 
+/** see if a tcp handler holds a stream that can be closed to make room:
+ * no query is being read or resolved, no answer is being written, and
+ * it had no events in this second, so that new streams get a chance */
+static int
+tcp_handler_is_idle(struct comm_point* h)
+{
+	if(h->fd == -1 || h->tcp_last_active >= h->ev->base->eb->secs)
+		return 0;
+	if(h->ssl && h->ssl_shake_state != comm_ssl_shake_none)
+		return 0;
+	if(h->tcp_pipeline_max)
+		return h->tcp_pipeline_count == 0 && !h->tcp_answer_first &&
+			h->tcp_byte_count == 0;
+	return h->tcp_is_reading && h->tcp_byte_count == 0;
+}
+
+/** find the tcp handler that is idle the longest, or NULL */
+static struct comm_point*
+tcp_accept_find_idle(struct comm_point* c)
+{
+	struct comm_point* best = NULL;
+	int i;
+	for(i=0; i<c->max_tcp_count; i++) {
+		struct comm_point* h = c->tcp_handlers[i];
+		if(!h)
+			break;
+		if(tcp_handler_is_idle(h) && (!best ||
+			h->tcp_last_active < best->tcp_last_active))
+			best = h;
+	}
+	return best;
+}
+
+/**
+ * Put a tcp handler on the free list of a tcp accept for a new connection.
+ * A new handler is created if there are less than the maximum, otherwise
+ * the stream that is idle the longest is closed.
+ * @param c: the tcp accept comm point.
+ * @return false if all handlers are busy (or on alloc failure).
+ */
+static int
+tcp_accept_make_free(struct comm_point* c)
+{
+	struct comm_point* h;
+	int i;
+	for(i=0; i<c->max_tcp_count; i++) {
+		if(c->tcp_handlers[i])
+			continue;
+		c->tcp_handlers[i] = comm_point_create_tcp_handler(c->ev->base,
+			c, sldns_buffer_capacity(c->buffer), c->callback,
+			c->cb_arg);
+		if(!c->tcp_handlers[i]) {
+			log_err("could not create tcp handler: out of memory");
+			return 0;
+		}
+		return 1;
+	}
+	if(!(h = tcp_accept_find_idle(c)))
+		return 0;
+	verbose(VERB_ALGO, "tcp connections full, close idle stream");
+	c->tcp_num_shed++;
+	reclaim_tcp_handler(h);
+	return 1;
+}
+
+/** pause accept on a tcp accept comm point, all its handlers are in use,
+ * and try again after a while, when one of the streams may be idle */
+static void
+tcp_accept_pause(struct comm_point* c)
+{
+	struct timeval tv;
+	comm_point_stop_listening(c);
+	if(!c->tcp_accept_retry && !(c->tcp_accept_retry = comm_timer_create(
+		c->ev->base, comm_point_tcp_accept_retry, c))) {
+		/* accept starts again when a stream closes */
+		log_err("could not create tcp accept timer: out of memory");
+		return;
+	}
+#ifndef S_SPLINT_S
+	tv.tv_sec = TCP_ACCEPT_RETRY_TIME/1000;
+	tv.tv_usec = (TCP_ACCEPT_RETRY_TIME%1000)*1000;
+#endif
+	comm_timer_set(c->tcp_accept_retry, &tv);
+}
+
+void
+comm_point_tcp_accept_retry(void* arg)
+{
+	struct comm_point* c = (struct comm_point*)arg;
+	log_assert(c->type == comm_tcp_accept);
+	/* out of file descriptors, the slow accept starts it later */
+	if(c->ev->base->eb->slow_accept_enabled)
+		return;
+	verbose(VERB_ALGO, "tcp connections full, try accept again");
+	comm_point_start_listening(c, -1, -1);
+}
+
 void 
 comm_point_tcp_accept_callback(int fd, short event, void* arg)
 {
@@ -862,8 +1363,12 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 	}
 	comm_base_now(c->ev->base);
 	/* find free tcp handler. */
-	if(!c->tcp_free) {
-		log_warn("accepted too many tcp, connections full");
+	if(!c->tcp_free && !tcp_accept_make_free(c)) {
+		verbose(VERB_OPS, "accepted too many tcp, connections full");
+		c->tcp_num_full++;
+		/* stop accepting until a handler is reclaimed, or a
+		 * stream is idle and can be closed */
+		tcp_accept_pause(c);
 		return;
 	}
 	/* accept incoming connection. */
@@ -888,19 +1393,16 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 
 	/* grab the tcp handler buffers */
 	c->cur_tcp_count++;
+	if(c->cur_tcp_count > c->tcp_max_used)
+		c->tcp_max_used = c->cur_tcp_count;
 	c->tcp_free = c_hdl->tcp_free;
-	if(!c->tcp_free) {
-		/* stop accepting incoming queries for now. */
-		comm_point_stop_listening(c);
-	}
 	setup_tcp_handler(c_hdl, new_fd);
 }
 
-/** Make tcp handler free for next assignment */
+/** close the stream, and the ssl, of a tcp handler */
 static void
-reclaim_tcp_handler(struct comm_point* c)
+tcp_handler_close(struct comm_point* c)
 {
-	log_assert(c->type == comm_tcp);
 	if(c->ssl) {
 #ifdef HAVE_SSL
 		SSL_shutdown(c->ssl);
@@ -909,27 +1411,288 @@ reclaim_tcp_handler(struct comm_point* c)
 #endif
 	}
 	comm_point_close(c);
+}
+
+/** Make tcp handler free for next assignment */
+static void
+reclaim_tcp_handler(struct comm_point* c)
+{
+	log_assert(c->type == comm_tcp);
+	tcp_handler_close(c);
+	if(c->tcp_read_buffer && sldns_buffer_capacity(c->tcp_read_buffer) >
+		TCP_READ_BUFFER_SIZE) {
+		/* a large query has grown it, give the memory back */
+		sldns_buffer_clear(c->tcp_read_buffer);
+		(void)sldns_buffer_set_capacity(c->tcp_read_buffer,
+			TCP_READ_BUFFER_SIZE);
+	}
 	if(c->tcp_parent) {
 		c->tcp_parent->cur_tcp_count--;
 		c->tcp_free = c->tcp_parent->tcp_free;
 		c->tcp_parent->tcp_free = c;
 		if(!c->tcp_free) {
 			/* re-enable listening on accept socket */
+			if(c->tcp_parent->tcp_accept_retry)
+				comm_timer_disable(
+					c->tcp_parent->tcp_accept_retry);
 			comm_point_start_listening(c->tcp_parent, -1, -1);
 		}
 	}
 }
 
-/** do the callback when writing is done */
+/** free the answers queued on a pipelined tcp handler */
 static void
-tcp_callback_writer(struct comm_point* c)
+tcp_answer_clear(struct comm_point* c)
 {
-	log_assert(c->type == comm_tcp);
-	sldns_buffer_clear(c->buffer);
-	if(c->tcp_do_toggle_rw)
-		c->tcp_is_reading = 1;
-	c->tcp_byte_count = 0;
-	/* switch from listening(write) to listening(read) */
+	struct comm_tcp_answer* a = c->tcp_answer_first, *n;
+	while(a) {
+		n = a->next;
+		free(a);
+		a = n;
+	}
+	c->tcp_answer_first = NULL;
+	c->tcp_answer_last = NULL;
+	c->tcp_answer_num = 0;
+	c->tcp_write_pkt = NULL;
+	c->tcp_write_pkt_len = 0;
+	c->tcp_write_byte_count = 0;
+}
+
+/** close a pipelined tcp stream. Queued answers are discarded, and the
+ * handler is reclaimed when the queries still in the mesh are done. */
+static void
+tcp_pipe_close(struct comm_point* c)
+{
+	tcp_answer_clear(c);
+	if(c->tcp_pipeline_count > 0) {
+		tcp_handler_close(c);
+		return;
+	}
+	reclaim_tcp_handler(c);
+}
+
+/** close a pipelined tcp stream on error and do the callback */
+static void
+tcp_pipe_fail(struct comm_point* c, int err)
+{
+	tcp_pipe_close(c);
+	if(!c->tcp_do_close) {
+		fptr_ok(fptr_whitelist_comm_point(c->callback));
+		(void)(*c->callback)(c, c->cb_arg, err, NULL);
+	}
+}
+
+/** see if a pipelined tcp stream can read another query */
+static int
+tcp_pipe_can_read(struct comm_point* c)
+{
+	return !c->tcp_read_closed && c->tcp_pipeline_count +
+		c->tcp_answer_num < c->tcp_pipeline_max;
+}
+
+/** set the events a pipelined tcp stream listens for, or close it if
+ * it is done. The comm point can be reclaimed when this returns. */
+static void
+tcp_pipe_listen(struct comm_point* c)
+{
+	int rd = tcp_pipe_can_read(c);
+	int wr = (c->tcp_answer_first != NULL);
+	if(c->tcp_read_closed && c->tcp_pipeline_count == 0 && !wr) {
+		tcp_pipe_close(c);
+		return;
+	}
+#ifdef HAVE_SSL
+	if(c->ssl) {
+		if(c->ssl_shake_state != comm_ssl_shake_none)
+			return; /* the handshake sets the events */
+		/* queries buffered in the ssl library give no read event,
+		 * the stream is writable, so that event reads them */
+		if(rd && SSL_pending((SSL*)c->ssl) > 0)
+			wr = 1;
+	}
+#endif
+	comm_point_listen_for_rw(c, rd, wr);
+}
+
+/**
+ * See if a tcp packet of the length fits in the buffer. The read buffer
+ * of a pipelined handler starts small, and is grown up to the size of
+ * the buffer where the answers are encoded.
+ * @param c: the comm point, its buffer is the one that is read into.
+ * @param len: length of the packet.
+ * @return false if it does not fit.
+ */
+static int
+tcp_buffer_fits(struct comm_point* c, size_t len)
+{
+	if(len <= sldns_buffer_capacity(c->buffer))
+		return 1;
+	if(!c->tcp_read_buffer || c->buffer != c->tcp_read_buffer ||
+		len > sldns_buffer_capacity(c->tcp_parent->buffer))
+		return 0;
+	return sldns_buffer_set_capacity(c->buffer, len);
+}
+
+#ifdef HAVE_WRITEV
+/**
+ * Write the answer in the buffer of a pipelined tcp stream right away,
+ * without copying it, when nothing else is queued.
+ * @param c: the comm point.
+ * @param done: returns the number of bytes written.
+ * @return 0 on error.
+ */
+static int
+tcp_pipe_write_now(struct comm_point* c, size_t* done)
+{
+	uint16_t len = htons(sldns_buffer_limit(c->buffer));
+	struct iovec iov[2];
+	ssize_t r;
+	iov[0].iov_base = (uint8_t*)&len;
+	iov[0].iov_len = sizeof(uint16_t);
+	iov[1].iov_base = sldns_buffer_begin(c->buffer);
+	iov[1].iov_len = sldns_buffer_limit(c->buffer);
+	*done = 0;
+	r = writev(c->fd, iov, 2);
+	if(r == -1) {
+#ifndef USE_WINSOCK
+#  ifdef EPIPE
+		if(errno == EPIPE && verbosity < 2)
+			return 0; /* silence 'broken pipe' */
+#  endif
+		if(errno == EINTR || errno == EAGAIN)
+			return 1;
+		log_err_addr("tcp writev", strerror(errno),
+			&c->repinfo.addr, c->repinfo.addrlen);
+#else
+		if(WSAGetLastError() == WSAEINPROGRESS)
+			return 1;
+		if(WSAGetLastError() == WSAEWOULDBLOCK) {
+			winsock_tcp_wouldblock(&c->ev->ev, EV_WRITE);
+			return 1;
+		}
+		log_err_addr("tcp writev", wsa_strerror(WSAGetLastError()),
+			&c->repinfo.addr, c->repinfo.addrlen);
+#endif
+		return 0;
+	}
+	*done = (size_t)r;
+	return 1;
+}
+#endif /* HAVE_WRITEV */
+
+/** the answer for a query of a pipelined tcp stream is in the buffer,
+ * write it, or add what is not written yet to the queue */
+static void
+tcp_pipe_answer(struct comm_point* c)
+{
+	size_t len = sldns_buffer_limit(c->buffer);
+	size_t done = 0;
+	struct comm_tcp_answer* a;
+	uint8_t* d;
+	log_assert(c->tcp_pipeline_count > 0);
+	c->tcp_pipeline_count--;
+	if(c->fd == -1) {
+		/* the stream closed while the query was resolved */
+		if(c->tcp_pipeline_count == 0)
+			reclaim_tcp_handler(c);
+		return;
+	}
+#ifdef HAVE_WRITEV
+	if(!c->tcp_answer_first && !c->ssl) {
+		if(!tcp_pipe_write_now(c, &done)) {
+			tcp_pipe_fail(c, NETEVENT_CLOSED);
+			return;
+		}
+		if(done == len + sizeof(uint16_t)) {
+			tcp_pipe_listen(c);
+			return;
+		}
+	}
+#endif /* HAVE_WRITEV */
+	a = (struct comm_tcp_answer*)malloc(sizeof(*a) + len +
+		sizeof(uint16_t) - done);
+	if(!a) {
+		log_err("tcp answer: out of memory");
+		if(done != 0)
+			tcp_pipe_fail(c, NETEVENT_CLOSED);
+		else	tcp_pipe_listen(c);
+		return;
+	}
+	a->next = NULL;
+	a->len = len + sizeof(uint16_t) - done;
+	d = (uint8_t*)a + sizeof(*a);
+	if(done < sizeof(uint16_t)) {
+		uint8_t prefix[2];
+		sldns_write_uint16(prefix, (uint16_t)len);
+		memmove(d, prefix + done, sizeof(uint16_t) - done);
+		memmove(d + sizeof(uint16_t) - done,
+			sldns_buffer_begin(c->buffer), len);
+	} else {
+		memmove(d, sldns_buffer_at(c->buffer, done - sizeof(uint16_t)),
+			a->len);
+	}
+	if(c->tcp_answer_last)
+		c->tcp_answer_last->next = a;
+	else {
+		c->tcp_answer_first = a;
+		c->tcp_write_pkt = d;
+		c->tcp_write_pkt_len = a->len;
+		c->tcp_write_byte_count = 0;
+	}
+	c->tcp_answer_last = a;
+	c->tcp_answer_num++;
+	tcp_pipe_listen(c);
+}
+
+/** the head of the answer queue of a pipelined tcp stream is written */
+static void
+tcp_pipe_written(struct comm_point* c)
+{
+	struct comm_tcp_answer* a = c->tcp_answer_first;
+	log_assert(a);
+	c->tcp_answer_first = a->next;
+	if(!c->tcp_answer_first)
+		c->tcp_answer_last = NULL;
+	c->tcp_answer_num--;
+	free(a);
+	c->tcp_write_byte_count = 0;
+	if(c->tcp_answer_first) {
+		c->tcp_write_pkt = (uint8_t*)c->tcp_answer_first +
+			sizeof(*c->tcp_answer_first);
+		c->tcp_write_pkt_len = c->tcp_answer_first->len;
+	} else {
+		c->tcp_write_pkt = NULL;
+		c->tcp_write_pkt_len = 0;
+	}
+	tcp_pipe_listen(c);
+}
+
+/** a query of a pipelined tcp stream is dropped. Like for a sequential
+ * stream the connection is closed, after the other answers are written */
+static void
+tcp_pipe_drop(struct comm_point* c)
+{
+	log_assert(c->tcp_pipeline_count > 0);
+	c->tcp_pipeline_count--;
+	if(c->fd == -1) {
+		if(c->tcp_pipeline_count == 0)
+			reclaim_tcp_handler(c);
+		return;
+	}
+	c->tcp_read_closed = 1;
+	tcp_pipe_listen(c);
+}
+
+/** do the callback when writing is done */
+static void
+tcp_callback_writer(struct comm_point* c)
+{
+	log_assert(c->type == comm_tcp);
+	sldns_buffer_clear(c->buffer);
+	if(c->tcp_do_toggle_rw)
+		c->tcp_is_reading = 1;
+	c->tcp_byte_count = 0;
+	/* switch from listening(write) to listening(read) */
 	comm_point_stop_listening(c);
 	comm_point_start_listening(c, -1, -1);
 }
@@ -940,6 +1703,42 @@ tcp_callback_reader(struct comm_point* c)
 {
 	log_assert(c->type == comm_tcp || c->type == comm_local);
 	sldns_buffer_flip(c->buffer);
+	if(c->tcp_write_and_read) {
+		/* keep listening, for more replies and for writes */
+		int fd = c->fd;
+		c->tcp_byte_count = 0;
+		fptr_ok(fptr_whitelist_comm_point(c->callback));
+		(void)(*c->callback)(c, c->cb_arg, NETEVENT_NOERROR,
+			&c->repinfo);
+		/* the callback may have closed, or reopened, the stream */
+		if(c->fd == fd && c->tcp_byte_count == 0)
+			sldns_buffer_clear(c->buffer);
+		return;
+	}
+	if(c->tcp_pipeline_max) {
+		/* keep reading queries while this one is resolved. It is
+		 * processed in the shared buffer, where answers go */
+		int fd = c->fd;
+		c->tcp_byte_count = 0;
+		c->tcp_pipeline_count++;
+		c->buffer = c->tcp_parent->buffer;
+		sldns_buffer_clear(c->buffer);
+		sldns_buffer_write(c->buffer, sldns_buffer_begin(
+			c->tcp_read_buffer), sldns_buffer_limit(
+			c->tcp_read_buffer));
+		sldns_buffer_flip(c->buffer);
+		fptr_ok(fptr_whitelist_comm_point(c->callback));
+		if( (*c->callback)(c, c->cb_arg, NETEVENT_NOERROR,
+			&c->repinfo) )
+			tcp_pipe_answer(c);
+		c->buffer = c->tcp_read_buffer;
+		/* the answer or a drop may have closed the stream */
+		if(c->fd != fd)
+			return;
+		sldns_buffer_clear(c->buffer);
+		tcp_pipe_listen(c);
+		return;
+	}
 	if(c->tcp_do_toggle_rw)
 		c->tcp_is_reading = 0;
 	c->tcp_byte_count = 0;
@@ -1248,8 +2047,8 @@ comm_point_tcp_handle_read(int fd, struct comm_point* c, int short_ok)
 		c->tcp_byte_count += r;
 		if(c->tcp_byte_count != sizeof(uint16_t))
 			return 1;
-		if(sldns_buffer_read_u16_at(c->buffer, 0) >
-			sldns_buffer_capacity(c->buffer)) {
+		if(!tcp_buffer_fits(c, sldns_buffer_read_u16_at(c->buffer,
+			0))) {
 			verbose(VERB_QUERY, "tcp: dropped larger than buffer");
 			return 0;
 		}
@@ -1297,6 +2096,56 @@ comm_point_tcp_handle_read(int fd, struct comm_point* c, int short_ok)
 	return 1;
 }
 
+/**
+ * Check for pending error from nonblocking connect.
+ * @param fd: file descriptor of socket.
+ * @param c: comm point, for logging.
+ * @return: 0 on error, 1 if connected, 2 if still in progress, try later.
+ */
+static int
+comm_point_tcp_check_connect(int fd, struct comm_point* c)
+{
+	/* check for pending error from nonblocking connect */
+	/* from Stevens, unix network programming, vol1, 3rd ed, p450*/
+	int error = 0;
+	socklen_t len = (socklen_t)sizeof(error);
+	if(getsockopt(fd, SOL_SOCKET, SO_ERROR, (void*)&error, 
+		&len) < 0){
+#ifndef USE_WINSOCK
+		error = errno; /* on solaris errno is error */
+#else /* USE_WINSOCK */
+		error = WSAGetLastError();
+#endif
+	}
+#ifndef USE_WINSOCK
+#if defined(EINPROGRESS) && defined(EWOULDBLOCK)
+	if(error == EINPROGRESS || error == EWOULDBLOCK)
+		return 2; /* try again later */
+	else
+#endif
+	if(error != 0 && verbosity < 2)
+		return 0; /* silence lots of chatter in the logs */
+	else if(error != 0) {
+		log_err_addr("tcp connect", strerror(error),
+			&c->repinfo.addr, c->repinfo.addrlen);
+#else /* USE_WINSOCK */
+	/* examine error */
+	if(error == WSAEINPROGRESS)
+		return 2;
+	else if(error == WSAEWOULDBLOCK) {
+		winsock_tcp_wouldblock(&c->ev->ev, EV_WRITE);
+		return 2;
+	} else if(error != 0 && verbosity < 2)
+		return 0;
+	else if(error != 0) {
+		log_err_addr("tcp connect", wsa_strerror(error),
+			&c->repinfo.addr, c->repinfo.addrlen);
+#endif /* USE_WINSOCK */
+		return 0;
+	}
+	return 1;
+}
+
 /** 
  * Handle tcp writing callback. 
  * @param fd: file descriptor of socket.
@@ -1312,44 +2161,9 @@ comm_point_tcp_handle_write(int fd, struct comm_point* c)
 		return 0;
 	log_assert(fd != -1);
 	if(c->tcp_byte_count == 0 && c->tcp_check_nb_connect) {
-		/* check for pending error from nonblocking connect */
-		/* from Stevens, unix network programming, vol1, 3rd ed, p450*/
-		int error = 0;
-		socklen_t len = (socklen_t)sizeof(error);
-		if(getsockopt(fd, SOL_SOCKET, SO_ERROR, (void*)&error, 
-			&len) < 0){
-#ifndef USE_WINSOCK
-			error = errno; /* on solaris errno is error */
-#else /* USE_WINSOCK */
-			error = WSAGetLastError();
-#endif
-		}
-#ifndef USE_WINSOCK
-#if defined(EINPROGRESS) && defined(EWOULDBLOCK)
-		if(error == EINPROGRESS || error == EWOULDBLOCK)
-			return 1; /* try again later */
-		else
-#endif
-		if(error != 0 && verbosity < 2)
-			return 0; /* silence lots of chatter in the logs */
-                else if(error != 0) {
-			log_err_addr("tcp connect", strerror(error),
-				&c->repinfo.addr, c->repinfo.addrlen);
-#else /* USE_WINSOCK */
-		/* examine error */
-		if(error == WSAEINPROGRESS)
-			return 1;
-		else if(error == WSAEWOULDBLOCK) {
-			winsock_tcp_wouldblock(&c->ev->ev, EV_WRITE);
-			return 1;
-		} else if(error != 0 && verbosity < 2)
-			return 0;
-		else if(error != 0) {
-			log_err_addr("tcp connect", wsa_strerror(error),
-				&c->repinfo.addr, c->repinfo.addrlen);
-#endif /* USE_WINSOCK */
-			return 0;
-		}
+		int cr = comm_point_tcp_check_connect(fd, c);
+		if(cr != 1)
+			return (cr == 2);
 	}
 	if(c->ssl)
 		return ssl_handle_it(c);
@@ -1439,12 +2253,345 @@ comm_point_tcp_handle_write(int fd, struct comm_point* c)
 	return 1;
 }
 
+/** the write-and-read mode packet has been written, do the callback */
+static void
+tcp_wr_written(struct comm_point* c)
+{
+	if(c->tcp_pipeline_max) {
+		tcp_pipe_written(c);
+		return;
+	}
+	c->tcp_write_pkt = NULL;
+	c->tcp_write_pkt_len = 0;
+	c->tcp_write_byte_count = 0;
+	comm_point_listen_for_rw(c, 1, 0);
+	fptr_ok(fptr_whitelist_comm_point(c->callback));
+	(void)(*c->callback)(c, c->cb_arg, NETEVENT_PKT_WRITTEN, NULL);
+}
+
+#ifdef HAVE_SSL
+/** handle ssl read or write failure in write-and-read mode,
+ * @param c: comm point.
+ * @param r: return value of SSL_read or SSL_write.
+ * @param str: the function that failed, for logging.
+ * @return 0 on error, 1 if it has to be retried later. */
+static int
+ssl_wr_error(struct comm_point* c, int r, const char* str)
+{
+	int want = SSL_get_error(c->ssl, r);
+	if(want == SSL_ERROR_ZERO_RETURN) {
+		return 0; /* shutdown, closed */
+	} else if(want == SSL_ERROR_WANT_READ) {
+		return 1; /* we are always listening for read */
+	} else if(want == SSL_ERROR_WANT_WRITE) {
+		comm_point_listen_for_rw(c, 1, 1);
+		return 1;
+	} else if(want == SSL_ERROR_SYSCALL) {
+		if(errno != 0)
+			log_err("%s syscall: %s", str, strerror(errno));
+		return 0;
+	}
+	log_crypto_err(str);
+	return 0;
+}
+
+/** read replies from ssl in write-and-read mode, 0 on error */
+static int
+ssl_wr_handle_read(struct comm_point* c)
+{
+	SSL* ssl = (SSL*)c->ssl;
+	int fd = c->fd;
+	int r;
+	/* replies can be buffered inside the ssl library, read them all
+	 * because there will be no read event for them */
+	do {
+		if(c->tcp_byte_count < sizeof(uint16_t)) {
+			ERR_clear_error();
+			r = SSL_read(ssl, (void*)sldns_buffer_at(c->buffer,
+				c->tcp_byte_count), (int)(sizeof(uint16_t) -
+				c->tcp_byte_count));
+			if(r <= 0)
+				return ssl_wr_error(c, r, "SSL_read");
+			c->tcp_byte_count += r;
+			if(c->tcp_byte_count != sizeof(uint16_t))
+				continue;
+			if(!tcp_buffer_fits(c, sldns_buffer_read_u16_at(
+				c->buffer, 0))) {
+				verbose(VERB_QUERY, "ssl: dropped larger than "
+					"buffer");
+				return 0;
+			}
+			sldns_buffer_set_limit(c->buffer,
+				sldns_buffer_read_u16_at(c->buffer, 0));
+			if(sldns_buffer_limit(c->buffer) < LDNS_HEADER_SIZE) {
+				verbose(VERB_QUERY, "ssl: dropped bogus too "
+					"short.");
+				return 0;
+			}
+		}
+		ERR_clear_error();
+		r = SSL_read(ssl, (void*)sldns_buffer_current(c->buffer),
+			(int)sldns_buffer_remaining(c->buffer));
+		if(r <= 0)
+			return ssl_wr_error(c, r, "SSL_read");
+		sldns_buffer_skip(c->buffer, (ssize_t)r);
+		if(sldns_buffer_remaining(c->buffer) <= 0) {
+			tcp_callback_reader(c);
+			/* stop if the callback closed or replaced the
+			 * stream, a new stream is still in its handshake,
+			 * or a pipelined stream has enough queries */
+			if(c->fd != fd || c->ssl != ssl ||
+				c->ssl_shake_state != comm_ssl_shake_none ||
+				(c->tcp_pipeline_max && !tcp_pipe_can_read(c)))
+				return 1;
+		}
+	} while(SSL_pending(ssl) > 0);
+	return 1;
+}
+
+/** write packet with ssl in write-and-read mode, 0 on error */
+static int
+ssl_wr_handle_write(struct comm_point* c)
+{
+	int r;
+	if(!c->tcp_write_pkt) {
+		/* the read wanted to write, continue reading */
+		if(c->tcp_pipeline_max) {
+			if(!tcp_pipe_can_read(c)) {
+				tcp_pipe_listen(c);
+				return 1;
+			}
+		} else	comm_point_listen_for_rw(c, 1, 0);
+		return ssl_wr_handle_read(c);
+	}
+	/* ignore return, if fails we may simply block */
+	(void)SSL_set_mode(c->ssl, SSL_MODE_ENABLE_PARTIAL_WRITE);
+	ERR_clear_error();
+	r = SSL_write(c->ssl, (void*)(c->tcp_write_pkt +
+		c->tcp_write_byte_count), (int)(c->tcp_write_pkt_len -
+		c->tcp_write_byte_count));
+	if(r <= 0)
+		return ssl_wr_error(c, r, "SSL_write");
+	c->tcp_write_byte_count += r;
+	if(c->tcp_write_byte_count == c->tcp_write_pkt_len)
+		tcp_wr_written(c);
+	return 1;
+}
+#endif /* HAVE_SSL */
+
+/** handle ssl events in write-and-read mode, 0 on error */
+static int
+ssl_wr_handle_it(struct comm_point* c, short event)
+{
+#ifdef HAVE_SSL
+	if(c->ssl_shake_state != comm_ssl_shake_none) {
+		if(!ssl_handshake(c))
+			return 0;
+		if(c->ssl_shake_state != comm_ssl_shake_none)
+			return 1;
+		/* handshake done, write the queries waiting for it */
+		if(c->tcp_pipeline_max)
+			tcp_pipe_listen(c);
+		else	comm_point_listen_for_rw(c, 1,
+				c->tcp_write_pkt != NULL);
+		return 1;
+	}
+	if(event&EV_WRITE)
+		return ssl_wr_handle_write(c);
+	if(c->tcp_pipeline_max && !tcp_pipe_can_read(c)) {
+		tcp_pipe_listen(c);
+		return 1;
+	}
+	return ssl_wr_handle_read(c);
+#else
+	(void)c;
+	(void)event;
+	return 0;
+#endif /* HAVE_SSL */
+}
+
+/**
+ * Handle tcp writing in write-and-read mode.
+ * @param fd: file descriptor of socket.
+ * @param c: comm point to write tcp_write_pkt with.
+ * @return: 0 on error
+ */
+static int
+comm_point_tcp_wr_handle_write(int fd, struct comm_point* c)
+{
+	ssize_t r;
+	if(c->tcp_check_nb_connect) {
+		int cr = comm_point_tcp_check_connect(fd, c);
+		if(cr != 1)
+			return (cr == 2);
+		c->tcp_check_nb_connect = 0;
+	}
+	if(!c->tcp_write_pkt) {
+		/* nothing to write, stop listening for write */
+		comm_point_listen_for_rw(c, 1, 0);
+		return 1;
+	}
+	r = send(fd, (void*)(c->tcp_write_pkt + c->tcp_write_byte_count),
+		c->tcp_write_pkt_len - c->tcp_write_byte_count, 0);
+	if(r == -1) {
+#ifndef USE_WINSOCK
+#  ifdef EPIPE
+		if(errno == EPIPE && verbosity < 2)
+			return 0; /* silence 'broken pipe' */
+#  endif
+		if(errno == EINTR || errno == EAGAIN)
+			return 1;
+		log_err_addr("tcp send w", strerror(errno),
+			&c->repinfo.addr, c->repinfo.addrlen);
+#else
+		if(WSAGetLastError() == WSAENOTCONN)
+			return 1;
+		if(WSAGetLastError() == WSAEINPROGRESS)
+			return 1;
+		if(WSAGetLastError() == WSAEWOULDBLOCK) {
+			winsock_tcp_wouldblock(&c->ev->ev, EV_WRITE);
+			return 1; 
+		}
+		log_err_addr("tcp send w", wsa_strerror(WSAGetLastError()),
+			&c->repinfo.addr, c->repinfo.addrlen);
+#endif
+		return 0;
+	}
+	c->tcp_write_byte_count += r;
+	if(c->tcp_write_byte_count == c->tcp_write_pkt_len)
+		tcp_wr_written(c);
+	return 1;
+}
+
+/** handle events for a tcp comm point in write-and-read mode. Writes are
+ * handled first, so that a failed nonblocking connect is noticed there.
+ * One event is handled per call, because the callbacks can close or
+ * reuse the comm point for another stream. */
+static void
+comm_point_tcp_wr_handle_callback(int fd, short event, struct comm_point* c)
+{
+	int err = NETEVENT_CLOSED;
+	int ok;
+	if(event&EV_TIMEOUT) {
+		verbose(VERB_QUERY, "tcp took too long, dropped");
+		err = NETEVENT_TIMEOUT;
+		ok = 0;
+	} else if(c->ssl) {
+		if((event&EV_WRITE) && c->tcp_check_nb_connect) {
+			int cr = comm_point_tcp_check_connect(fd, c);
+			if(cr == 2)
+				return;
+			c->tcp_check_nb_connect = 0;
+			ok = (cr == 1) && ssl_wr_handle_it(c, event);
+		} else	ok = ssl_wr_handle_it(c, event);
+	} else if(event&EV_WRITE) {
+		ok = comm_point_tcp_wr_handle_write(fd, c);
+	} else if(event&EV_READ) {
+		ok = comm_point_tcp_handle_read(fd, c, 0);
+	} else {
+		log_err("Ignored event %d for tcphdl.", event);
+		return;
+	}
+	if(!ok) {
+		/* the owner closes the stream, it can keep state from it */
+		comm_point_stop_listening(c);
+		fptr_ok(fptr_whitelist_comm_point(c->callback));
+		(void)(*c->callback)(c, c->cb_arg, err, NULL);
+	}
+}
+
+/** handle an event for a pipelined tcp handler, with the read buffer */
+static void
+comm_point_tcp_pipe_handle_event(int fd, short event, struct comm_point* c)
+{
+	int ok;
+	if(event&EV_TIMEOUT) {
+		if(c->tcp_pipeline_count > 0 && !c->tcp_answer_first) {
+			/* the client waits for queries being resolved */
+			tcp_pipe_listen(c);
+			return;
+		}
+		verbose(VERB_QUERY, "tcp took too long, dropped");
+		tcp_pipe_fail(c, NETEVENT_TIMEOUT);
+		return;
+	}
+	if(c->ssl) {
+		ok = ssl_wr_handle_it(c, event);
+	} else if(event&EV_WRITE) {
+		ok = comm_point_tcp_wr_handle_write(fd, c);
+	} else if(event&EV_READ) {
+		if(!tcp_pipe_can_read(c)) {
+			tcp_pipe_listen(c);
+			return;
+		}
+		ok = comm_point_tcp_handle_read(fd, c, 0);
+	} else {
+		log_err("Ignored event %d for tcphdl.", event);
+		return;
+	}
+	if(!ok) {
+		if(!(event&EV_WRITE) && (c->tcp_pipeline_count > 0 ||
+			c->tcp_answer_first)) {
+			/* no more queries, write the outstanding answers */
+			c->tcp_read_closed = 1;
+			tcp_pipe_listen(c);
+			return;
+		}
+		tcp_pipe_fail(c, NETEVENT_CLOSED);
+	}
+}
+
+/** handle events for a pipelined tcp handler. It reads queries and
+ * writes the queued answers, like the write-and-read mode. */
+static void
+comm_point_tcp_pipe_handle_callback(int fd, short event, struct comm_point* c)
+{
+	/* queries are read into the read buffer of the stream, that
+	 * keeps a partial query while answers are encoded in the buffer */
+	c->buffer = c->tcp_read_buffer;
+	comm_point_tcp_pipe_handle_event(fd, event, c);
+	c->buffer = c->tcp_parent->buffer;
+}
+
+void
+comm_point_tcp_set_pipeline(struct comm_point* c, int max)
+{
+	log_assert(c->type == comm_tcp_accept);
+	if(max < 2)
+		return;
+	c->tcp_pipeline_max = max;
+}
+
+void
+comm_point_tcp_write_pkt(struct comm_point* c, uint8_t* pkt, size_t len)
+{
+	log_assert(c->tcp_write_and_read && !c->tcp_write_pkt);
+	c->tcp_write_pkt = pkt;
+	c->tcp_write_pkt_len = len;
+	c->tcp_write_byte_count = 0;
+	/* if the ssl handshake waits for the server, the packet is
+	 * written when the handshake is done */
+	if(c->ssl && c->ssl_shake_state == comm_ssl_shake_read)
+		return;
+	comm_point_listen_for_rw(c, 1, 1);
+}
+
 void 
 comm_point_tcp_handle_callback(int fd, short event, void* arg)
 {
 	struct comm_point* c = (struct comm_point*)arg;
 	log_assert(c->type == comm_tcp);
 	comm_base_now(c->ev->base);
+	c->tcp_last_active = c->ev->base->eb->secs;
+
+	if(c->tcp_write_and_read) {
+		comm_point_tcp_wr_handle_callback(fd, event, c);
+		return;
+	}
+	if(c->tcp_pipeline_max) {
+		comm_point_tcp_pipe_handle_callback(fd, event, c);
+		return;
+	}
 
 	if(event&EV_READ) {
 		if(!comm_point_tcp_handle_read(fd, c, 0)) {
@@ -1633,15 +2780,30 @@ comm_point_create_tcp_handler(struct comm_base *base,
 	}
 	c->ev->base = base;
 	c->fd = -1;
-	c->buffer = sldns_buffer_new(bufsize);
-	if(!c->buffer) {
-		free(c->ev);
-		free(c);
-		return NULL;
+	if(parent->tcp_pipeline_max) {
+		/* answers are encoded in the buffer of the parent */
+		c->tcp_pipeline_max = parent->tcp_pipeline_max;
+		c->buffer = parent->buffer;
+		c->tcp_read_buffer = sldns_buffer_new(bufsize <
+			TCP_READ_BUFFER_SIZE?bufsize:TCP_READ_BUFFER_SIZE);
+		if(!c->tcp_read_buffer) {
+			free(c->ev);
+			free(c);
+			return NULL;
+		}
+	} else {
+		c->buffer = sldns_buffer_new(bufsize);
+		if(!c->buffer) {
+			free(c->ev);
+			free(c);
+			return NULL;
+		}
 	}
 	c->timeout = (struct timeval*)malloc(sizeof(struct timeval));
 	if(!c->timeout) {
-		sldns_buffer_free(c->buffer);
+		if(c->tcp_pipeline_max)
+			sldns_buffer_free(c->tcp_read_buffer);
+		else	sldns_buffer_free(c->buffer);
 		free(c->ev);
 		free(c);
 		return NULL;
@@ -1685,7 +2847,6 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num, size_t bufsize,
 	struct comm_point* c = (struct comm_point*)calloc(1,
 		sizeof(struct comm_point));
 	short evbits;
-	int i;
 	/* first allocate the TCP accept listener */
 	if(!c)
 		return NULL;
@@ -1697,7 +2858,13 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num, size_t bufsize,
 	}
 	c->ev->base = base;
 	c->fd = fd;
-	c->buffer = NULL;
+	/* sizes the handler buffers, and pipelined handlers share it */
+	c->buffer = sldns_buffer_new(bufsize);
+	if(!c->buffer) {
+		free(c->ev);
+		free(c);
+		return NULL;
+	}
 	c->timeout = NULL;
 	c->tcp_is_reading = 0;
 	c->tcp_byte_count = 0;
@@ -1707,6 +2874,7 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num, size_t bufsize,
 	c->tcp_handlers = (struct comm_point**)calloc((size_t)num,
 		sizeof(struct comm_point*));
 	if(!c->tcp_handlers) {
+		sldns_buffer_free(c->buffer);
 		free(c->ev);
 		free(c);
 		return NULL;
@@ -1717,8 +2885,8 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num, size_t bufsize,
 	c->do_not_close = 0;
 	c->tcp_do_toggle_rw = 0;
 	c->tcp_check_nb_connect = 0;
-	c->callback = NULL;
-	c->cb_arg = NULL;
+	c->callback = callback;
+	c->cb_arg = callback_arg;
 	evbits = EV_READ | EV_PERSIST;
 	/* libevent stuff */
 	event_set(&c->ev->ev, c->fd, evbits, comm_point_tcp_accept_callback, c);
@@ -1729,17 +2897,7 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num, size_t bufsize,
 		comm_point_delete(c);
 		return NULL;
 	}
-
-	/* now prealloc the tcp handlers */
-	for(i=0; i<num; i++) {
-		c->tcp_handlers[i] = comm_point_create_tcp_handler(base,
-			c, bufsize, callback, callback_arg);
-		if(!c->tcp_handlers[i]) {
-			comm_point_delete(c);
-			return NULL;
-		}
-	}
-	
+	/* the tcp handlers are created when connections need them */
 	return c;
 }
 
@@ -1904,6 +3062,13 @@ comm_point_close(struct comm_point* c)
 {
 	if(!c)
 		return;
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG)
+	/* a callback of the batch closes it, send the replies that are
+	 * queued for it while the socket is there */
+	if(c->udp_batch && c->ev->base->eb->udp_batch &&
+		c->ev->base->eb->udp_batch->send_c == c)
+		udp_batch_send(c->ev->base->eb->udp_batch);
+#endif /* HAVE_RECVMMSG && HAVE_SENDMMSG */
 	if(c->fd != -1)
 		if(event_del(&c->ev->ev) != 0) {
 			log_err("could not event_del on close");
@@ -1938,8 +3103,16 @@ comm_point_delete(struct comm_point* c)
 			comm_point_delete(c->tcp_handlers[i]);
 		free(c->tcp_handlers);
 	}
+	if(c->tcp_accept_retry)
+		comm_timer_delete(c->tcp_accept_retry);
 	free(c->timeout);
-	if(c->type == comm_tcp || c->type == comm_local)
+	if(c->type == comm_tcp) {
+		tcp_answer_clear(c);
+		sldns_buffer_free(c->tcp_read_buffer);
+	}
+	/* pipelined tcp handlers use the buffer of the tcp accept */
+	if((c->type == comm_tcp && !c->tcp_read_buffer) ||
+		c->type == comm_local || c->type == comm_tcp_accept)
 		sldns_buffer_free(c->buffer);
 	free(c->ev);
 	free(c);
@@ -1970,7 +3143,10 @@ comm_point_send_reply(struct comm_reply *repinfo)
 			dt_msg_send_client_response(repinfo->c->tcp_parent->dtenv,
 			&repinfo->addr, repinfo->c->type, repinfo->c->buffer);
 #endif
-		comm_point_start_listening(repinfo->c, -1, TCP_QUERY_TIMEOUT);
+		if(repinfo->c->tcp_pipeline_max)
+			tcp_pipe_answer(repinfo->c);
+		else	comm_point_start_listening(repinfo->c, -1,
+				TCP_QUERY_TIMEOUT);
 	}
 }
 
@@ -1983,6 +3159,10 @@ comm_point_drop_reply(struct comm_reply* repinfo)
 	log_assert(repinfo->c->type != comm_tcp_accept);
 	if(repinfo->c->type == comm_udp)
 		return;
+	if(repinfo->c->tcp_pipeline_max) {
+		tcp_pipe_drop(repinfo->c);
+		return;
+	}
 	reclaim_tcp_handler(repinfo->c);
 }
 
@@ -2000,7 +3180,8 @@ comm_point_start_listening(struct comm_point* c, int newfd, int sec)
 {
 	verbose(VERB_ALGO, "comm point start listening %d", 
 		c->fd==-1?newfd:c->fd);
-	if(c->type == comm_tcp_accept && !c->tcp_free) {
+	if(c->type == comm_tcp_accept && c->cur_tcp_count >=
+		c->max_tcp_count && !tcp_accept_find_idle(c)) {
 		/* no use to start listening no free slots. */
 		return;
 	}
@@ -2063,8 +3244,16 @@ size_t comm_point_get_mem(struct comm_point* c)
 	s = sizeof(*c) + sizeof(*c->ev);
 	if(c->timeout) 
 		s += sizeof(*c->timeout);
-	if(c->type == comm_tcp || c->type == comm_local)
+	if((c->type == comm_tcp && !c->tcp_read_buffer) ||
+		c->type == comm_local || c->type == comm_tcp_accept)
 		s += sizeof(*c->buffer) + sldns_buffer_capacity(c->buffer);
+	if(c->type == comm_tcp && c->tcp_read_buffer) {
+		struct comm_tcp_answer* a;
+		s += sizeof(*c->tcp_read_buffer) +
+			sldns_buffer_capacity(c->tcp_read_buffer);
+		for(a = c->tcp_answer_first; a; a = a->next)
+			s += sizeof(*a) + a->len;
+	}
 	if(c->type == comm_tcp_accept) {
 		int i;
 		for(i=0; i<c->max_tcp_count; i++)
@@ -2101,11 +3290,260 @@ comm_timer_create(struct comm_base* base, void (*cb)(void*), void* cb_arg)
 	return tm;
 }
 
+/** current time of the base in msec */
+static uint64_t
+wheel_now(struct comm_base* b)
+{
+	return (uint64_t)b->eb->now.tv_sec*(uint64_t)1000 +
+		(uint64_t)b->eb->now.tv_usec/(uint64_t)1000;
+}
+
+/** number of timers on the wheel */
+static size_t
+wheel_count(struct timer_wheel* w)
+{
+	size_t n = 0;
+	int i;
+	for(i=0; i<WHEEL_LEVELS; i++)
+		n += w->num[i];
+	return n;
+}
+
+/** take the timer off the wheel */
+static void
+wheel_unlink(struct timer_wheel* w, struct internal_timer* t)
+{
+	t->link.prev->next = t->link.next;
+	t->link.next->prev = t->link.prev;
+	t->link.next = t->link.prev = &t->link;
+	w->num[t->level]--;
+}
+
+/** put the timer in the slot for its expiry */
+static void
+wheel_place(struct timer_wheel* w, struct internal_timer* t)
+{
+	uint64_t e, d;
+	struct wheel_link* s;
+	int lvl;
+	if(t->expire < w->cur)
+		t->expire = w->cur;
+	e = t->expire;
+	d = e - w->cur;
+	for(lvl=0; lvl<WHEEL_LEVELS-1; lvl++)
+		if(d < ((uint64_t)1<<(WHEEL_BITS*(lvl+1))))
+			break;
+	if(d >= ((uint64_t)1<<(WHEEL_BITS*WHEEL_LEVELS))) {
+		/* it is cascaded again, when the top level turns */
+		e = w->cur + ((uint64_t)1<<(WHEEL_BITS*WHEEL_LEVELS)) - 1;
+	}
+	s = &w->slot[lvl][(e>>(WHEEL_BITS*lvl))&WHEEL_MASK];
+	t->link.next = s;
+	t->link.prev = s->prev;
+	s->prev->next = &t->link;
+	s->prev = &t->link;
+	t->level = (uint8_t)lvl;
+	w->num[lvl]++;
+}
+
+/** move the timers of a slot to the lower levels */
+static void
+wheel_cascade(struct timer_wheel* w, int lvl, int idx)
+{
+	struct wheel_link* s = &w->slot[lvl][idx];
+	struct wheel_link list;
+	if(s->next == s)
+		return;
+	/* take the list out of the slot, they can end up in it again */
+	list.next = s->next;
+	list.prev = s->prev;
+	list.next->prev = &list;
+	list.prev->next = &list;
+	s->next = s->prev = s;
+	while(list.next != &list) {
+		struct internal_timer* t = (struct internal_timer*)list.next;
+		wheel_unlink(w, t);
+		wheel_place(w, t);
+	}
+}
+
+/** msec time when the wheel has to run next, or 0 if it is empty */
+static uint64_t
+wheel_next(struct timer_wheel* w)
+{
+	uint64_t best = 0, b0;
+	int lvl, k, shift;
+	for(lvl=0; lvl<WHEEL_LEVELS; lvl++) {
+		if(w->num[lvl] == 0)
+			continue;
+		/* the first slot that runs or cascades, from cur */
+		shift = WHEEL_BITS*lvl;
+		b0 = (w->cur + (((uint64_t)1<<shift)-1)) >> shift;
+		for(k=0; k<WHEEL_SLOTS; k++) {
+			struct wheel_link* s = &w->slot[lvl][(b0+k)&WHEEL_MASK];
+			if(s->next != s) {
+				if(best == 0 || ((b0+k)<<shift) < best)
+					best = (b0+k)<<shift;
+				break;
+			}
+		}
+	}
+	return best;
+}
+
+/** add the event of the wheel for the msec time, if not added for it */
+static void
+wheel_event_set(struct comm_base* b, uint64_t when)
+{
+	struct timer_wheel* w = b->eb->wheel;
+	uint64_t now = wheel_now(b);
+	struct timeval tv;
+	if(w->ev_added) {
+		if(w->ev_when == when)
+			return;
+		(void)evtimer_del(&w->ev);
+		w->ev_added = 0;
+	}
+	if(when < now)
+		when = now;
+#ifndef S_SPLINT_S
+	tv.tv_sec = (time_t)((when - now)/1000);
+	tv.tv_usec = (int)((when - now)%1000)*1000;
+#endif
+	event_set(&w->ev, -1, EV_TIMEOUT, comm_wheel_callback, b);
+	if(event_base_set(b->eb->base, &w->ev) != 0) {
+		log_err("timer wheel: event_base_set failed.");
+		return;
+	}
+	if(evtimer_add(&w->ev, &tv) != 0) {
+		log_err("timer wheel: evtimer_add failed.");
+		return;
+	}
+	w->ev_added = 1;
+	w->ev_when = when;
+}
+
+/** run the expired timers of the wheel */
+static void
+wheel_run(struct comm_base* b)
+{
+	struct timer_wheel* w = b->eb->wheel;
+	uint64_t now = wheel_now(b);
+	while(w->cur <= now) {
+		struct wheel_link* s;
+		int lvl, idx;
+		if(wheel_count(w) == 0) {
+			w->cur = now+1;
+			break;
+		}
+		/* at the start of a slot of the next level, its timers
+		 * move down, and the same for the levels above it */
+		for(lvl=1; lvl<WHEEL_LEVELS; lvl++) {
+			if((w->cur & (((uint64_t)1<<(WHEEL_BITS*lvl))-1)) != 0)
+				break;
+			idx = (int)((w->cur>>(WHEEL_BITS*lvl))&WHEEL_MASK);
+			wheel_cascade(w, lvl, idx);
+		}
+		/* the callbacks can set timers for this msec */
+		s = &w->slot[0][w->cur&WHEEL_MASK];
+		while(s->next != s) {
+			struct internal_timer* t = (struct internal_timer*)s->next;
+			wheel_unlink(w, t);
+			t->enabled = 0;
+			fptr_ok(fptr_whitelist_comm_timer(t->tm->callback));
+			(*t->tm->callback)(t->tm->cb_arg);
+		}
+		if(w->num[0] == 0) {
+			/* skip to the next cascade */
+			uint64_t next = (w->cur | WHEEL_MASK) + 1;
+			w->cur = (next > now+1)? now+1 : next;
+		} else	w->cur++;
+	}
+}
+
+void
+comm_wheel_run(struct comm_base* b)
+{
+	uint64_t next;
+	if(!b->eb->wheel)
+		return;
+	wheel_run(b);
+	if((next = wheel_next(b->eb->wheel)) != 0)
+		wheel_event_set(b, next);
+}
+
+uint64_t
+comm_wheel_cur(struct comm_base* b)
+{
+	if(!b->eb->wheel)
+		return 0;
+	return b->eb->wheel->cur;
+}
+
+void 
+comm_wheel_callback(int ATTR_UNUSED(fd), short event, void* arg)
+{
+	struct comm_base* b = (struct comm_base*)arg;
+	if(!(event&EV_TIMEOUT))
+		return;
+	comm_base_now(b);
+	b->eb->wheel->ev_added = 0;
+	comm_wheel_run(b);
+}
+
+struct comm_timer* 
+comm_timer_create_wheel(struct comm_base* base, void (*cb)(void*),
+	void* cb_arg)
+{
+	struct comm_timer *tm;
+	if(!base->eb->wheel) {
+		int i, j;
+		base->eb->wheel = (struct timer_wheel*)calloc(1,
+			sizeof(struct timer_wheel));
+		if(!base->eb->wheel) {
+			log_err("malloc failed");
+			return NULL;
+		}
+		for(i=0; i<WHEEL_LEVELS; i++)
+			for(j=0; j<WHEEL_SLOTS; j++)
+				base->eb->wheel->slot[i][j].next =
+				base->eb->wheel->slot[i][j].prev =
+				&base->eb->wheel->slot[i][j];
+		base->eb->wheel->cur = wheel_now(base);
+	}
+	tm = (struct comm_timer*)calloc(1, sizeof(struct comm_timer));
+	if(!tm)
+		return NULL;
+	tm->ev_timer = (struct internal_timer*)calloc(1,
+		sizeof(struct internal_timer));
+	if(!tm->ev_timer) {
+		log_err("malloc failed");
+		free(tm);
+		return NULL;
+	}
+	tm->ev_timer->base = base;
+	tm->ev_timer->on_wheel = 1;
+	tm->ev_timer->tm = tm;
+	tm->ev_timer->link.next = tm->ev_timer->link.prev =
+		&tm->ev_timer->link;
+	tm->callback = cb;
+	tm->cb_arg = cb_arg;
+	return tm;
+}
+
 void 
 comm_timer_disable(struct comm_timer* timer)
 {
 	if(!timer)
 		return;
+	if(timer->ev_timer->on_wheel) {
+		/* the event of the wheel stays, it finds no timer */
+		if(timer->ev_timer->enabled)
+			wheel_unlink(timer->ev_timer->base->eb->wheel,
+				timer->ev_timer);
+		timer->ev_timer->enabled = 0;
+		return;
+	}
 	evtimer_del(&timer->ev_timer->ev);
 	timer->ev_timer->enabled = 0;
 }
@@ -2114,6 +3552,22 @@ void
 comm_timer_set(struct comm_timer* timer, struct timeval* tv)
 {
 	log_assert(tv);
+	if(timer->ev_timer->on_wheel) {
+		struct comm_base* b = timer->ev_timer->base;
+		struct timer_wheel* w = b->eb->wheel;
+		uint64_t now = wheel_now(b);
+		if(timer->ev_timer->enabled)
+			wheel_unlink(w, timer->ev_timer);
+		if(wheel_count(w) == 0)
+			w->cur = now;
+		timer->ev_timer->expire = now + (uint64_t)tv->tv_sec*1000 +
+			((uint64_t)tv->tv_usec+999)/1000;
+		wheel_place(w, timer->ev_timer);
+		timer->ev_timer->enabled = 1;
+		if(!w->ev_added || timer->ev_timer->expire < w->ev_when)
+			wheel_event_set(b, timer->ev_timer->expire);
+		return;
+	}
 	if(timer->ev_timer->enabled)
 		comm_timer_disable(timer);
 	event_set(&timer->ev_timer->ev, -1, EV_TIMEOUT,
@@ -52,6 +52,8 @@
  *    o comm_base - for thread safety of the comm points, one per thread.
  *    o comm_point - udp and tcp networking, with callbacks.
  *    o comm_timer - a timeout with callback.
+ *	The timers for the many query timeouts are kept on a timer wheel
+ *	per comm_base, that is run by one event.
  *    o comm_signal - callbacks when signal is caught.
  *    o comm_reply - holds reply info during networking callback.
  *
@@ -63,6 +65,7 @@
 struct sldns_buffer;
 struct comm_point;
 struct comm_reply;
+struct comm_tcp_answer;
 struct event_base;
 
 /* internal event notification data storage structure. */
@@ -82,6 +85,10 @@ typedef int comm_point_callback_t(struct comm_point*, void*, int,
 #define NETEVENT_TIMEOUT -2 
 /** to pass fallback from capsforID to callback function; 0x20 failed */
 #define NETEVENT_CAPSFAIL -3
+/** to pass that the write packet is written, in tcp write-and-read mode */
+#define NETEVENT_PKT_WRITTEN -4
+/** to pass that the query is slow and may be hedged, it continues */
+#define NETEVENT_SLOW -5
 
 /** timeout to slow accept calls when not possible, in msec. */
 #define NETEVENT_SLOW_ACCEPT_TIME 2000
@@ -161,17 +168,31 @@ struct comm_point {
 	/** sockaddr from peer, for TCP handlers */
 	struct comm_reply repinfo;
 
+	/** time of the last event on a tcp handler, to find the stream
+	 * that is idle the longest */
+	time_t tcp_last_active;
+
 	/* -------- TCP Accept -------- */
-	/** the number of TCP handlers for this tcp-accept socket */
+	/** the max number of TCP handlers for this tcp-accept socket */
 	int max_tcp_count;
 	/** current number of tcp handler in-use for this accept socket */
 	int cur_tcp_count;
 	/** malloced array of tcp handlers for a tcp-accept, 
-	    of size max_tcp_count. */
+	    of size max_tcp_count. The handlers are created when the
+	    connections need them, the unused entries are NULL. */
 	struct comm_point** tcp_handlers;
 	/** linked list of free tcp_handlers to use for new queries.
 	    For tcp_accept the first entry, for tcp_handlers the next one. */
 	struct comm_point* tcp_free;
+	/** the highest cur_tcp_count, since the statistics were cleared */
+	int tcp_max_used;
+	/** number of idle streams closed to accept a new connection */
+	size_t tcp_num_shed;
+	/** number of times accept paused, all handlers were in use */
+	size_t tcp_num_full;
+	/** timer that starts accept again after it paused, when a
+	 * stream can be idle, or NULL if it did not pause yet */
+	struct comm_timer* tcp_accept_retry;
 
 	/* -------- SSL TCP DNS ------- */
 	/** the SSL object with rw bio (owned) or for commaccept ctx ref */
@@ -225,15 +246,62 @@ struct comm_point {
 	    So that when that is done the callback is called. */
 	int tcp_do_toggle_rw;
 
-	/** if set, checks for pending error from nonblocking connect() call.*/
+	/** if set, checks for pending error from nonblocking connect() call.
+	 * In write-and-read mode it is cleared once the connect completed. */
 	int tcp_check_nb_connect;
 
+	/** if set, the tcp stream is full duplex: replies are read into
+	 * the buffer while queries are written from tcp_write_pkt, in
+	 * any order. The callback gets NETEVENT_NOERROR for every packet
+	 * read and NETEVENT_PKT_WRITTEN when tcp_write_pkt is written.
+	 * On errors the callback is made, but it has to close the comm
+	 * point (and ssl) itself. Used for pipelined outgoing queries. */
+	int tcp_write_and_read;
+	/** packet to write in write-and-read mode, including the two byte
+	 * length prefix. NULL if there is nothing to write. Not owned. */
+	uint8_t* tcp_write_pkt;
+	/** length of tcp_write_pkt */
+	size_t tcp_write_pkt_len;
+	/** bytes of tcp_write_pkt written so far */
+	size_t tcp_write_byte_count;
+
+	/** if nonzero, the tcp handler is pipelined: it keeps reading
+	 * queries while earlier ones are resolved, up to this many in
+	 * flight (being resolved or queued for writing), and answers are
+	 * written in the order they complete. It uses tcp_write_pkt to
+	 * write the head of the answer queue. */
+	int tcp_pipeline_max;
+	/** number of queries read in pipelined mode, that have not been
+	 * answered or dropped yet. The handler is not returned to the
+	 * free list while it is nonzero, also not if the stream closed */
+	int tcp_pipeline_count;
+	/** if set, the pipelined stream is not read anymore, it is closed
+	 * when the outstanding answers have been written */
+	int tcp_read_closed;
+	/** answers waiting to be written, in pipelined mode */
+	struct comm_tcp_answer* tcp_answer_first;
+	/** last answer in the queue, new answers are added there */
+	struct comm_tcp_answer* tcp_answer_last;
+	/** number of answers in the queue */
+	int tcp_answer_num;
+	/** read buffer in pipelined mode. It starts small and grows for
+	 * larger queries. The buffer is then shared with the other
+	 * handlers, with the buffer of the tcp accept, because answers
+	 * are encoded and written, or copied to the queue, right away */
+	struct sldns_buffer* tcp_read_buffer;
+
 	/** number of queries outstanding on this socket, used by
 	 * outside network for udp ports */
 	int inuse;
 
+	/** if set, the UDP datagrams are read with recvmmsg and the
+	 * replies sent with sendmmsg, when the comm_base has udp batch
+	 * buffers. Set for the listening UDP sockets. */
+	int udp_batch;
+
 	/** callback when done.
-	    tcp_accept does not get called back, is NULL then.
+	    tcp_accept does not get called back, it holds the callback
+	    for the tcp handlers that it creates.
 	    If a timeout happens, callback with timeout=1 is called.
 	    If an error happens, callback is called with error set 
 	    nonzero. If not NETEVENT_NOERROR, it is an errno value.
@@ -354,6 +422,17 @@ void comm_base_exit(struct comm_base* b);
 void comm_base_set_slow_accept_handlers(struct comm_base* b,
 	void (*stop_accept)(void*), void (*start_accept)(void*), void* arg);
 
+/**
+ * Set the number of UDP datagrams that are read and answered in one batch
+ * by the comm points with udp_batch set. Uses recvmmsg and sendmmsg, if
+ * not available the datagrams are read one at a time.
+ * @param b: comm base
+ * @param num: datagrams per batch, 0 or 1 to not batch.
+ * @param bufsize: size of the buffer for a datagram and its reply.
+ * @return false on alloc failure.
+ */
+int comm_base_set_udp_batch(struct comm_base* b, int num, size_t bufsize);
+
 /**
  * Access internal data structure (for util/tube.c on windows)
  * @param b: comm base
@@ -395,11 +474,13 @@ struct comm_point* comm_point_create_udp_ancil(struct comm_base* base,
 /**
  * Create a TCP listener comm point. Calls malloc.
  * Setups the structure with the parameters you provide.
- * Also Creates TCP Handlers, pre allocated for you.
+ * The TCP Handlers are created when connections need them, up to num.
+ * When they are all in use, the stream that is idle the longest is
+ * closed for a new connection.
  * Uses the parameters you provide.
  * @param base: in which base to alloc the commpoint.
  * @param fd: file descriptor of open TCP socket set to listen nonblocking.
- * @param num: becomes max_tcp_count, the routine allocates that
+ * @param num: becomes max_tcp_count, the routine allocates up to that
  *	many tcp handler commpoints.
  * @param bufsize: size of buffer to create for handlers.
  * @param callback: callback function pointer for TCP handlers.
@@ -407,7 +488,7 @@ struct comm_point* comm_point_create_udp_ancil(struct comm_base* base,
  * @return: returns the TCP listener commpoint. You can find the
  *  	TCP handlers in the array inside the listener commpoint.
  *	returns NULL on error.
- * Inits timeout to NULL. All handlers are on the free list.
+ * Inits timeout to NULL.
  */
 struct comm_point* comm_point_create_tcp(struct comm_base* base,
 	int fd, int num, size_t bufsize, 
@@ -508,6 +589,30 @@ void comm_point_start_listening(struct comm_point* c, int newfd, int sec);
  */
 void comm_point_listen_for_rw(struct comm_point* c, int rd, int wr);
 
+/**
+ * Set the tcp handlers of a tcp accept comm point to pipelined mode.
+ * Queries are read while earlier ones are still being resolved, and
+ * the answers are written in the order they are sent. Call it before
+ * connections are accepted.
+ * @param c: the tcp accept commpoint.
+ * @param max: maximum number of queries in flight per connection.
+ *	Values below 2 leave the handlers sequential.
+ */
+void comm_point_tcp_set_pipeline(struct comm_point* c, int max);
+
+/**
+ * Write a packet on a tcp comm point in write-and-read mode.
+ * Replies keep being read meanwhile. The callback is called with
+ * NETEVENT_PKT_WRITTEN when the packet has been written.
+ * @param c: commpoint, with an open connection and no packet that is
+ *	still being written.
+ * @param pkt: the packet, with the two byte tcp length prefix. It is
+ *	not copied and must remain allocated until it is written.
+ * @param len: length of pkt, including the prefix.
+ */
+void comm_point_tcp_write_pkt(struct comm_point* c, uint8_t* pkt,
+	size_t len);
+
 /**
  * Get size of memory used by comm point.
  * For TCP handlers this includes subhandlers.
@@ -527,6 +632,19 @@ size_t comm_point_get_mem(struct comm_point* c);
 struct comm_timer* comm_timer_create(struct comm_base* base, 
 	void (*cb)(void*), void* cb_arg);
 
+/**
+ * create timer on the timer wheel of the base. Not active upon creation.
+ * It is set and disabled in O(1) without an event operation, and has
+ * msec resolution. For the many timeouts of the queries in progress.
+ * Used with the other comm_timer functions, like a comm_timer.
+ * @param base: event handling base.
+ * @param cb: callback function: void myfunc(void* myarg);
+ * @param cb_arg: user callback argument.
+ * @return: the new timer or NULL on error.
+ */
+struct comm_timer* comm_timer_create_wheel(struct comm_base* base, 
+	void (*cb)(void*), void* cb_arg);
+
 /**
  * disable timer. Stops callbacks from happening.
  * @param timer: to disable.
@@ -649,6 +767,34 @@ void comm_point_tcp_handle_callback(int fd, short event, void* arg);
  */
 void comm_timer_callback(int fd, short event, void* arg);
 
+/**
+ * This routine is published for checks and tests, and is only used internally.
+ * handle libevent callback for the timer wheel, runs the expired timers.
+ * @param fd: file descriptor (always -1).
+ * @param event: event bits from libevent: 
+ *	EV_READ, EV_WRITE, EV_SIGNAL, EV_TIMEOUT.
+ * @param arg: the comm_base structure.
+ */
+void comm_wheel_callback(int fd, short event, void* arg);
+
+/**
+ * This routine is published for checks and tests, and is only used internally.
+ * Run the expired timers of the timer wheel, at the time of the base.
+ * The time of the base is not updated; tests set it with the pointers
+ * from comm_base_timept.
+ * @param b: the comm base.
+ */
+void comm_wheel_run(struct comm_base* b);
+
+/**
+ * This routine is published for checks and tests, and is only used internally.
+ * The msec of the timer wheel that runs next; the timers before it have
+ * run.  If the wheel runs late, it is earlier than the time of the base.
+ * @param b: the comm base.
+ * @return the msec, or 0 if the base has no timer wheel.
+ */
+uint64_t comm_wheel_cur(struct comm_base* b);
+
 /**
  * This routine is published for checks and tests, and is only used internally.
  * handle libevent callback for signal comm.
@@ -679,6 +825,14 @@ void comm_point_local_handle_callback(int fd, short event, void* arg);
  */
 void comm_point_raw_handle_callback(int fd, short event, void* arg);
 
+/**
+ * This routine is published for checks and tests, and is only used internally.
+ * timer callback that tries accept again on a tcp accept comm point, that
+ * paused because all its tcp handlers were in use.
+ * @param arg: the comm_point structure.
+ */
+void comm_point_tcp_accept_retry(void* arg);
+
 /**
  * This routine is published for checks and tests, and is only used internally.
  * libevent callback for timeout on slow accept.
@@ -119,3 +119,99 @@ int rtt_notimeout(const struct rtt_info* rtt)
 {
 	return calc_rto(rtt);
 }
+
+void
+rtt_sketch_init(struct rtt_sketch* sk)
+{
+	memset(sk, 0, sizeof(*sk));
+}
+
+/** the bucket for an rtt value */
+static int
+sketch_bucket(int ms)
+{
+	int k = 1, b;
+	if(ms < 2)
+		return (ms < 1)?0:1;
+	while(k < 30 && (ms>>(k+1)) != 0)
+		k++;
+	/* the bit after the top bit selects the half of the doubling */
+	b = 2*k + ((ms>>(k-1))&1);
+	if(b >= RTT_SKETCH_BUCKETS)
+		b = RTT_SKETCH_BUCKETS-1;
+	return b;
+}
+
+/** the lowest rtt value in a bucket */
+static int
+sketch_bucket_low(int b)
+{
+	if(b < 2)
+		return b;
+	if(b&1)
+		return (1<<(b/2)) + (1<<(b/2-1));
+	return 1<<(b/2);
+}
+
+void
+rtt_sketch_add(struct rtt_sketch* sk, int ms)
+{
+	int b = sketch_bucket(ms);
+	if(sk->count[b] >= RTT_SKETCH_COUNT_MAX) {
+		int i;
+		for(i=0; i<RTT_SKETCH_BUCKETS; i++)
+			sk->count[i] /= 2;
+	}
+	sk->count[b]++;
+	if(sk->replies + sk->lost >= RTT_SKETCH_TOTAL_MAX) {
+		sk->replies /= 2;
+		sk->lost /= 2;
+	}
+	sk->replies++;
+}
+
+void
+rtt_sketch_lost(struct rtt_sketch* sk)
+{
+	if(sk->replies + sk->lost >= RTT_SKETCH_TOTAL_MAX) {
+		sk->replies /= 2;
+		sk->lost /= 2;
+	}
+	sk->lost++;
+}
+
+int
+rtt_sketch_percentile(const struct rtt_sketch* sk, int pct)
+{
+	int i, total = 0, seen = 0, want;
+	for(i=0; i<RTT_SKETCH_BUCKETS; i++)
+		total += sk->count[i];
+	if(total < RTT_SKETCH_MIN_SAMPLES)
+		return -1;
+	/* the rank of the sample that is wanted, rounded up */
+	want = (total*pct + 99)/100;
+	if(want < 1)
+		want = 1;
+	for(i=0; i<RTT_SKETCH_BUCKETS; i++) {
+		int low, high;
+		if(sk->count[i] == 0 || seen + sk->count[i] < want) {
+			seen += sk->count[i];
+			continue;
+		}
+		/* interpolate between the bounds of the bucket */
+		low = sketch_bucket_low(i);
+		high = (i+1 < RTT_SKETCH_BUCKETS)?sketch_bucket_low(i+1):
+			low*4/3;
+		return low + (high-low)*(want-seen)/sk->count[i];
+	}
+	return sketch_bucket_low(RTT_SKETCH_BUCKETS-1);
+}
+
+int
+rtt_sketch_loss(const struct rtt_sketch* sk)
+{
+	int total = (int)sk->replies + (int)sk->lost;
+	if(total == 0)
+		return 0;
+	return (int)sk->lost*100/total;
+}
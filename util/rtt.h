@@ -55,6 +55,31 @@ struct rtt_info {
 	int rto;
 };
 
+/** number of buckets in the rtt sketch, two for every doubling of the
+ * rtt, up to 131 seconds */
+#define RTT_SKETCH_BUCKETS 34
+/** the bucket counts are halved when one of them reaches this */
+#define RTT_SKETCH_COUNT_MAX 255
+/** the reply and lost counts are halved when their sum reaches this */
+#define RTT_SKETCH_TOTAL_MAX 1024
+/** number of samples needed before the sketch gives a percentile */
+#define RTT_SKETCH_MIN_SAMPLES 8
+
+/**
+ * Sketch of the rtt distribution, and the loss of a server.
+ * The counts decay, so that it follows the recent behaviour.
+ */
+struct rtt_sketch {
+	/** number of rtt samples per bucket. Bucket 0 has 0 msec and 1
+	 * has 1 msec, bucket i from 2 upwards starts at 2^(i/2) msec, and
+	 * the odd buckets at one and a half times that. */
+	uint8_t count[RTT_SKETCH_BUCKETS];
+	/** number of replies */
+	uint16_t replies;
+	/** number of timeouts */
+	uint16_t lost;
+};
+
 /** min retransmit timeout value, in milliseconds */
 extern int RTT_MIN_TIMEOUT;
 /** max retransmit timeout value, in milliseconds */
@@ -104,4 +129,39 @@ void rtt_update(struct rtt_info* rtt, int ms);
  */
 void rtt_lost(struct rtt_info* rtt, int orig);
 
+/**
+ * Initialize the rtt sketch, it is empty.
+ * @param sk: the sketch.
+ */
+void rtt_sketch_init(struct rtt_sketch* sk);
+
+/**
+ * Add a reply with its roundtrip time to the sketch.
+ * @param sk: the sketch.
+ * @param ms: roundtrip time in milliseconds.
+ */
+void rtt_sketch_add(struct rtt_sketch* sk, int ms);
+
+/**
+ * Add a timeout to the loss counters of the sketch.
+ * @param sk: the sketch.
+ */
+void rtt_sketch_lost(struct rtt_sketch* sk);
+
+/**
+ * Get a percentile of the rtt from the sketch.
+ * @param sk: the sketch.
+ * @param pct: the percentile, 1 .. 100.
+ * @return the rtt in msec, interpolated in the bucket, or -1 if there
+ *	are not enough samples.
+ */
+int rtt_sketch_percentile(const struct rtt_sketch* sk, int pct);
+
+/**
+ * Get the timeout probability from the loss counters of the sketch.
+ * @param sk: the sketch.
+ * @return percentage of the queries that timed out, 0 .. 100.
+ */
+int rtt_sketch_loss(const struct rtt_sketch* sk);
+
 #endif /* UTIL_RTT_H */
@@ -1,4 +1,6 @@
 /*
+  October 2026 added wyhash, and hash_bytes() that uses the selected hash
+     function, wyhash or hashlittle, for the hash table keys.
   February 2013(Wouter) patch defines for BSD endianness, from Brad Smith.
   January 2012(Wouter) added randomised initial value, fallout from 28c3.
   March 2007(Wouter) adapted from lookup3.c original, add config.h include.
@@ -49,6 +51,7 @@ on 1 byte), but shoehorning those bytes into integers efficiently is messy.
 #include <stdio.h>      /* defines printf for tests */
 #include <time.h>       /* defines time_t for timings in the test */
 /*#include <stdint.h>     defines uint32_t etc  (from config.h) */
+#include <string.h>     /* memcpy for the wyhash reads */
 #include <sys/param.h>  /* attempt to define endianness */
 #ifdef HAVE_SYS_TYPES_H
 # include <sys/types.h> /* attempt to define endianness (solaris) */
@@ -817,6 +820,146 @@ uint32_t hashbig( const void *key, size_t length, uint32_t initval)
 
 #endif /* 0 == currently not used */
 
+/*
+-------------------------------------------------------------------------------
+wyhash, by Wang Yi, The Unlicense (public domain), version final4.
+It mixes with the 128 bit product of 64 bit values, and reads 16 bytes at
+a time, short keys take a few multiplies.  The reads are in host byte
+order, the hash values are only used within the process.
+-------------------------------------------------------------------------------
+*/
+
+/* the hash function for hash_bytes */
+static enum hash_func hash_func = hash_func_wyhash;
+
+/* random seed for wyhash, mixed with the secret by hash_set_seed */
+static uint64_t wyseed = (uint64_t)0xdeadbeefdeadbeefULL;
+
+/* the wyhash secret, the default parameters */
+static const uint64_t wyp[4] = { (uint64_t)0xa0761d6478bd642fULL,
+  (uint64_t)0xe7037ed1a0b428dbULL, (uint64_t)0x8ebc6af09c88c6e3ULL,
+  (uint64_t)0x589965cc75374cc3ULL };
+
+/* 128 bit product of A and B, the low half in A and the high half in B */
+static void wymum(uint64_t *A, uint64_t *B)
+{
+#ifdef __SIZEOF_INT128__
+  __uint128_t r = *A;
+  r *= *B;
+  *A = (uint64_t)r;
+  *B = (uint64_t)(r>>64);
+#else
+  uint64_t ha = *A>>32, hb = *B>>32, la = (uint32_t)*A, lb = (uint32_t)*B;
+  uint64_t rh = ha*hb, rm0 = ha*lb, rm1 = hb*la, rl = la*lb;
+  uint64_t t = rl+(rm0<<32), c = t<rl, lo, hi;
+  lo = t+(rm1<<32);
+  c += lo<t;
+  hi = rh+(rm0>>32)+(rm1>>32)+c;
+  *A = lo;
+  *B = hi;
+#endif
+}
+
+static uint64_t wymix(uint64_t A, uint64_t B)
+{
+  wymum(&A, &B);
+  return A^B;
+}
+
+static uint64_t wyr8(const uint8_t *p)
+{
+  uint64_t v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+static uint64_t wyr4(const uint8_t *p)
+{
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+/* 1 to 3 bytes */
+static uint64_t wyr3(const uint8_t *p, size_t k)
+{
+  return (((uint64_t)p[0])<<16)|(((uint64_t)p[k>>1])<<8)|p[k-1];
+}
+
+/* the seed is mixed with the secret already, that is done once for the
+   random seed, and not for the chained previous hash value */
+static uint64_t wyhash(const void *key, size_t len, uint64_t seed)
+{
+  const uint8_t *p = (const uint8_t*)key;
+  uint64_t a, b;
+  if(len <= 16) {
+    if(len >= 4) {
+      a = (wyr4(p)<<32)|wyr4(p+((len>>3)<<2));
+      b = (wyr4(p+len-4)<<32)|wyr4(p+len-4-((len>>3)<<2));
+    } else if(len > 0) {
+      a = wyr3(p, len);
+      b = 0;
+    } else a = b = 0;
+  } else {
+    size_t i = len;
+    if(i > 48) {
+      uint64_t see1 = seed, see2 = seed;
+      do {
+        seed = wymix(wyr8(p)^wyp[1], wyr8(p+8)^seed);
+        see1 = wymix(wyr8(p+16)^wyp[2], wyr8(p+24)^see1);
+        see2 = wymix(wyr8(p+32)^wyp[3], wyr8(p+40)^see2);
+        p += 48;
+        i -= 48;
+      } while(i > 48);
+      seed ^= see1^see2;
+    }
+    while(i > 16) {
+      seed = wymix(wyr8(p)^wyp[1], wyr8(p+8)^seed);
+      i -= 16;
+      p += 16;
+    }
+    a = wyr8(p+i-16);
+    b = wyr8(p+i-8);
+  }
+  a ^= wyp[1];
+  b ^= seed;
+  wymum(&a, &b);
+  return wymix(a^wyp[0]^len, b^wyp[1]);
+}
+
+uint32_t hash_bytes(const void *key, size_t length, uint32_t initval)
+{
+  uint64_t h;
+  if(hash_func == hash_func_lookup3)
+    return hashlittle(key, length, initval);
+  h = wyhash(key, length, wyseed^initval);
+  return (uint32_t)(h^(h>>32));
+}
+
+void hash_set_seed(uint64_t v)
+{
+  wyseed = v^wymix(v^wyp[0], wyp[1]);
+}
+
+void hash_set_func(enum hash_func f)
+{
+  hash_func = f;
+}
+
+enum hash_func hash_get_func(void)
+{
+  return hash_func;
+}
+
+int hash_func_lookup(const char *name)
+{
+  if(strcmp(name, "wyhash") == 0)
+    return (int)hash_func_wyhash;
+  if(strcmp(name, "lookup3") == 0)
+    return (int)hash_func_lookup3;
+  return -1;
+}
+
 #ifdef SELF_TEST
 
 /* used for timings */
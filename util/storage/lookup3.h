@@ -68,4 +68,52 @@ uint32_t hashlittle(const void *k, size_t length, uint32_t initval);
  */
 void hash_set_raninit(uint32_t v);
 
+/**
+ * The hash functions for the hash table keys.
+ */
+enum hash_func {
+	/** lookup3 hashlittle */
+	hash_func_lookup3 = 0,
+	/** wyhash, 64 bit multiply and xor, the default */
+	hash_func_wyhash
+};
+
+/**
+ * Hash key data with the selected hash function, for the keys of the
+ * hash tables.  The hash function and its seed are set at the start,
+ * the hash values can be chained like hashlittle.
+ * @param k: the key, array of uint8_t
+ * @param length: the length of the key, in uint8_ts
+ * @param initval: the previous hash, or an arbitrary value
+ * @return: hash value.
+ */
+uint32_t hash_bytes(const void *k, size_t length, uint32_t initval);
+
+/**
+ * Set the random seed of wyhash, set this before threads start, and
+ * before hashing stuff, like hash_set_raninit.
+ * @param v: value
+ */
+void hash_set_seed(uint64_t v);
+
+/**
+ * Set the hash function for hash_bytes, before threads start and before
+ * hashing stuff.
+ * @param f: the hash function.
+ */
+void hash_set_func(enum hash_func f);
+
+/**
+ * Get the hash function that hash_bytes uses.
+ * @return the hash function.
+ */
+enum hash_func hash_get_func(void);
+
+/**
+ * Look up the hash function by name.
+ * @param name: "wyhash" or "lookup3".
+ * @return the enum hash_func value, or -1 if the name is not known.
+ */
+int hash_func_lookup(const char *name);
+
 #endif /* UTIL_STORAGE_LOOKUP3_H */
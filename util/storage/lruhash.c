@@ -43,6 +43,349 @@
 #include "config.h"
 #include "util/storage/lruhash.h"
 #include "util/fptr_wlist.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifdef LRUHASH_READ_MOSTLY
+/** load a pointer that is changed by the writers, for lock free readers */
+#define lruhash_load(p) __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+/** store a pointer so that lock free readers see it complete */
+#define lruhash_publish(p, v) __atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+/** get the reference bit of an entry */
+#define lruhash_ref_get(e) __atomic_load_n(&(e)->ref, __ATOMIC_RELAXED)
+/** set the reference bit of an entry */
+#define lruhash_ref_set(e, v) __atomic_store_n(&(e)->ref, (v), \
+	__ATOMIC_RELAXED)
+/** load a value that is changed by the writers, that the lock free
+ * readers check afterwards */
+#define lruhash_peek(p) __atomic_load_n(&(p), __ATOMIC_RELAXED)
+/** store a value that lock free readers also change, a store of a
+ * reader can be lost */
+#define lruhash_store(p, v) __atomic_store_n(&(p), (v), __ATOMIC_RELAXED)
+/** add to a counter that lock free readers also add to */
+#define lruhash_add(p, v) ((void)__atomic_fetch_add(&(p), (v), \
+	__ATOMIC_RELAXED))
+#else
+#define lruhash_load(p) (p)
+#define lruhash_publish(p, v) ((p) = (v))
+#define lruhash_ref_get(e) ((e)->ref)
+#define lruhash_ref_set(e, v) ((e)->ref = (v))
+#define lruhash_peek(p) (p)
+#define lruhash_store(p, v) ((p) = (v))
+#define lruhash_add(p, v) ((p) += (v))
+#endif /* LRUHASH_READ_MOSTLY */
+
+/** tag of an empty slot */
+#define TAG_EMPTY 0
+/** tag of a slot with an entry with hash value h, the value that marks
+ * empty slots is moved up; the entry itself is compared after a tag
+ * matches */
+#define tag_of(h) ((h) != TAG_EMPTY ? (h) : TAG_EMPTY + 1)
+/** the lock that covers the entries with hash value h */
+#define stripe_of(table, h) (&(table)->stripes[(h)&(LRUHASH_LOCK_STRIPES-1)])
+
+#ifdef __GNUC__
+#define lowest_bit(m) ((size_t)__builtin_ctz(m))
+#else
+/** index of the lowest bit that is set in the (nonzero) bitmask */
+static size_t
+lowest_bit(unsigned int m)
+{
+	size_t i = 0;
+	while(!(m&1)) {
+		m >>= 1;
+		i++;
+	}
+	return i;
+}
+#endif
+
+#if defined(__SSE2__) && LRUHASH_GROUP == 4
+/** bitmask of the slots in the group that have tag t */
+static unsigned int
+group_match(const hashvalue_t* tags, hashvalue_t t)
+{
+	__m128i m = _mm_cmpeq_epi32(_mm_load_si128((const __m128i*)tags),
+		_mm_set1_epi32((int)t));
+	return (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(m));
+}
+#else
+/** bitmask of the slots in the group that have tag t */
+static unsigned int
+group_match(const hashvalue_t* tags, hashvalue_t t)
+{
+	unsigned int m = 0;
+	size_t i;
+	for(i=0; i<LRUHASH_GROUP; i++)
+		m |= ((unsigned int)(tags[i] == t)) << i;
+	return m;
+}
+#endif /* __SSE2__ */
+
+/** the group where the probe sequence for a hash value starts */
+static size_t
+probe_start(struct lruhash_index* idx, hashvalue_t hash)
+{
+	return ((size_t)hash) & idx->mask;
+}
+
+/** next group in the probe sequence, the steps increase by one group, so
+ * that all groups are visited. @return false if all have been visited. */
+static int
+probe_next(struct lruhash_index* idx, size_t* g, size_t* step)
+{
+	(*step)++;
+	if(*step > idx->mask)
+		return 0;
+	*g = (*g + *step) & idx->mask;
+	return 1;
+}
+
+/** create an index with the number of slots, that are empty */
+static struct lruhash_index*
+index_create(size_t slots)
+{
+	size_t num = slots/LRUHASH_GROUP;
+	struct lruhash_index* idx;
+	/* the groups start at a cache line */
+	size_t hdr = sizeof(*idx) + 63;
+	if(num > (((size_t)-1) - hdr) / sizeof(struct lruhash_group))
+		return NULL;
+	/* zeroed, all slots are empty, and the lock free readers may read
+	 * the entry of a slot that is not yet complete */
+	idx = (struct lruhash_index*)calloc(1, hdr +
+		num*sizeof(struct lruhash_group));
+	if(!idx)
+		return NULL;
+	idx->mask = num-1;
+	idx->groups = (struct lruhash_group*)(((uintptr_t)(idx+1) + 63) &
+		~((uintptr_t)63));
+	return idx;
+}
+
+/** size of the index in bytes */
+static size_t
+index_get_mem(struct lruhash_index* idx)
+{
+	return sizeof(*idx) + 63 + (idx->mask+1)*sizeof(struct lruhash_group);
+}
+
+/** find the entry with the key in the index, for lock free readers the
+ * entry is checked after it is loaded. @return entry or NULL. */
+static struct lruhash_entry*
+index_find(struct lruhash* table, struct lruhash_index* idx,
+	hashvalue_t hash, void* key)
+{
+	size_t g = probe_start(idx, hash), step = 0;
+	hashvalue_t t = tag_of(hash);
+	do {
+		struct lruhash_group* grp = &idx->groups[g];
+		unsigned int m = group_match(grp->tags, t);
+		for(; m; m &= m-1) {
+			struct lruhash_entry* e = lruhash_load(
+				grp->entries[lowest_bit(m)]);
+			if(e && e->hash == hash &&
+				table->compfunc(e->key, key) == 0)
+				return e;
+		}
+		if(lruhash_peek(grp->overflow) == 0)
+			return NULL;
+	} while(probe_next(idx, &g, &step));
+	return NULL;
+}
+
+/** take the entry off the overflow counts of the first num groups of the
+ * probe sequence for the hash value */
+static void
+index_overflow_dec(struct lruhash_index* idx, hashvalue_t hash, size_t num)
+{
+	size_t g = probe_start(idx, hash), step = 0;
+	for(; num; num--) {
+		lruhash_publish(idx->groups[g].overflow,
+			idx->groups[g].overflow-1);
+		(void)probe_next(idx, &g, &step);
+	}
+}
+
+/** put the entry in the first empty slot of its probe sequence, the full
+ * groups it passes count it as overflow.
+ * @return false if there is no empty slot. */
+static int
+index_place(struct lruhash_index* idx, hashvalue_t hash,
+	struct lruhash_entry* entry)
+{
+	size_t g = probe_start(idx, hash), step = 0;
+	do {
+		struct lruhash_group* grp = &idx->groups[g];
+		unsigned int m = group_match(grp->tags, TAG_EMPTY);
+		if(m) {
+			size_t i = lowest_bit(m);
+			/* the entry before the tag, a lookup that matches
+			 * the tag finds the entry */
+			lruhash_publish(grp->entries[i], entry);
+			lruhash_publish(grp->tags[i], tag_of(hash));
+			return 1;
+		}
+		lruhash_publish(grp->overflow, grp->overflow+1);
+	} while(probe_next(idx, &g, &step));
+	index_overflow_dec(idx, hash, step);
+	return 0;
+}
+
+/** remove the entry from the index, if it is there */
+static void
+index_remove(struct lruhash_index* idx, struct lruhash_entry* entry)
+{
+	size_t g = probe_start(idx, entry->hash), step = 0;
+	hashvalue_t t = tag_of(entry->hash);
+	do {
+		struct lruhash_group* grp = &idx->groups[g];
+		unsigned int m = group_match(grp->tags, t);
+		for(; m; m &= m-1) {
+			size_t i = lowest_bit(m);
+			if(grp->entries[i] != entry)
+				continue;
+			lruhash_publish(grp->tags[i], TAG_EMPTY);
+			index_overflow_dec(idx, entry->hash, step);
+			return;
+		}
+		if(grp->overflow == 0)
+			return;
+	} while(probe_next(idx, &g, &step));
+}
+
+/** create the locks for open addressing mode */
+static lock_quick_t*
+stripes_create(void)
+{
+	size_t i;
+	lock_quick_t* stripes = (lock_quick_t*)calloc(LRUHASH_LOCK_STRIPES,
+		sizeof(lock_quick_t));
+	if(!stripes)
+		return NULL;
+	for(i=0; i<LRUHASH_LOCK_STRIPES; i++) {
+		lock_quick_init(&stripes[i]);
+	}
+	return stripes;
+}
+
+/** delete the locks for open addressing mode */
+static void
+stripes_delete(lock_quick_t* stripes)
+{
+	size_t i;
+	if(!stripes)
+		return;
+	for(i=0; i<LRUHASH_LOCK_STRIPES; i++) {
+		lock_quick_destroy(&stripes[i]);
+	}
+	free((void*)stripes);
+}
+
+/** largest number of blocks of the frequency sketch */
+#define SKETCH_MAX_BLOCKS (1<<18)
+/** odd multipliers, for the block and for the counters in the block of
+ * a hash value in the frequency sketch */
+static const uint32_t sketch_mult[LRUHASH_SKETCH_DEPTH+1] = {
+	0x9e3779b1U, 0x85ebca77U, 0xc2b2ae3dU, 0x27d4eb2fU, 0x165667b1U };
+/** the counter of hash value h in part i of its block of the sketch,
+ * the number of the 4 bit counter in the block */
+#define sketch_slot(h, i) ((i)*32 + \
+	(((uint32_t)(h)*sketch_mult[(i)+1]) >> 27))
+/** the value of 4 bit counter n in block b of the sketch */
+#define sketch_get(b, n) ((lruhash_peek((b)[(n)>>1]) >> (((n)&1)*4)) & 15)
+
+/** the block of the sketch for the hash value, the mixed hash value is
+ * scaled to the number of blocks */
+static uint8_t*
+sketch_block(struct lruhash_admit* a, hashvalue_t h)
+{
+	uint64_t x = (uint32_t)((uint32_t)h*sketch_mult[0]);
+	return &a->sketch[(size_t)((x * (uint64_t)a->blocks) >> 32) * 64];
+}
+
+/** estimated number of recent lookups of the hash value, the lowest of
+ * its counters */
+static int
+sketch_estimate(struct lruhash_admit* a, hashvalue_t h)
+{
+	uint8_t* b = sketch_block(a, h);
+	int i, c, min = 15;
+	for(i=0; i<LRUHASH_SKETCH_DEPTH; i++) {
+		c = (int)sketch_get(b, sketch_slot(h, i));
+		if(c < min)
+			min = c;
+	}
+	return min;
+}
+
+/** halve the counters of the sketch, after ten accesses per hash value
+ * that fits in it, so that old popularity fades. Caller holds the
+ * hashtable lock. */
+static void
+sketch_age(struct lruhash_admit* a)
+{
+	size_t i;
+	if(lruhash_peek(a->additions) < a->blocks*8*10)
+		return;
+	for(i=0; i<a->blocks*64; i++)
+		lruhash_store(a->sketch[i], (uint8_t)(
+			(lruhash_peek(a->sketch[i])>>1) & 0x77));
+	lruhash_store(a->additions, lruhash_peek(a->additions)/2);
+}
+
+/** count a lookup of the hash value for the admission policy.
+ * @param a: the admission policy.
+ * @param hash: hash value that is looked up.
+ * @param found: if the entry was found.
+ * @param shared: if true, the lookup is done without the hashtable lock.
+ */
+static void
+admit_access(struct lruhash_admit* a, hashvalue_t hash, int found,
+	int shared)
+{
+	uint8_t* b = sketch_block(a, hash);
+	int i;
+	for(i=0; i<LRUHASH_SKETCH_DEPTH; i++) {
+		int n = sketch_slot(hash, i);
+		if(sketch_get(b, n) < 15)
+			lruhash_store(b[n>>1], (uint8_t)(lruhash_peek(b[n>>1]) +
+				(1 << ((n&1)*4))));
+	}
+	lruhash_store(a->additions, lruhash_peek(a->additions)+1);
+	if(shared) {
+		lruhash_add(a->stats.lookups, 1);
+		if(found)
+			lruhash_add(a->stats.hits, 1);
+	} else {
+		a->stats.lookups++;
+		if(found)
+			a->stats.hits++;
+	}
+}
+
+/** create the admission policy, for a table with the maximum space.
+ * A block of the sketch holds the counters for about 8 entries, and the
+ * entries of the caches are a couple of hundred bytes, so there is a
+ * block for every 2k of space. @return NULL on malloc failure. */
+static struct lruhash_admit*
+admit_create(size_t space_max)
+{
+	struct lruhash_admit* a;
+	size_t blocks = space_max / 2048;
+	if(blocks < 1)
+		blocks = 1;
+	if(blocks > SKETCH_MAX_BLOCKS)
+		blocks = SKETCH_MAX_BLOCKS;
+	/* the sketch starts at a cache line */
+	a = (struct lruhash_admit*)calloc(1, sizeof(*a) + 63 + blocks*64);
+	if(!a)
+		return NULL;
+	a->sketch = (uint8_t*)(((uintptr_t)(a+1) + 63) & ~((uintptr_t)63));
+	a->blocks = blocks;
+	return a;
+}
 
 void
 bin_init(struct lruhash_bin* array, size_t size)
@@ -80,6 +423,7 @@ lruhash_create(size_t start_size, size_t maxmem, lruhash_sizefunc_t sizefunc,
 	table->num = 0;
 	table->space_used = 0;
 	table->space_max = maxmem;
+	table->num_full = 0;
 	table->array = calloc(table->size, sizeof(struct lruhash_bin));
 	if(!table->array) {
 		lock_quick_destroy(&table->lock);
@@ -138,7 +482,7 @@ bin_split(struct lruhash* table, struct lruhash_bin* newa,
 			np = p->overflow_next;
 			/* link into correct new bin */
 			newbin = &newa[p->hash & newmask];
-			p->overflow_next = newbin->overflow_list;
+			lruhash_publish(p->overflow_next, newbin->overflow_list);
 			newbin->overflow_list = p;
 			p=np;
 		}
@@ -148,6 +492,54 @@ bin_split(struct lruhash* table, struct lruhash_bin* newa,
 	}
 }
 
+/** delete retired entries and bin arrays, whose readers are gone */
+static void
+lruhash_free_retired(struct lruhash* table, struct lruhash_entry* list,
+	struct lruhash_retired_array* arrays, void* cb_arg)
+{
+	while(list) {
+		struct lruhash_entry* n = list->lru_next;
+		void* d = list->data;
+		(*table->delkeyfunc)(list->key, cb_arg);
+		(*table->deldatafunc)(d, cb_arg);
+		list = n;
+	}
+	while(arrays) {
+		struct lruhash_retired_array* n = arrays->next;
+		free(arrays->array);
+		free(arrays);
+		arrays = n;
+	}
+}
+
+/** put an entry, that has been removed from bin and lru, on the retired
+ * list of a read-mostly table. Caller holds the hashtable lock. */
+static void
+lruhash_retire(struct lruhash* table, struct lruhash_entry* entry)
+{
+	entry->lru_prev = NULL;
+	entry->lru_next = table->retired;
+	table->retired = entry;
+}
+
+/** delete the entries in the index, and the index */
+static void
+index_delete(struct lruhash* table, struct lruhash_index* idx)
+{
+	size_t s;
+	for(s=0; s<table->size; s++) {
+		struct lruhash_group* grp = &idx->groups[s/LRUHASH_GROUP];
+		struct lruhash_entry* p = grp->entries[s%LRUHASH_GROUP];
+		void* d;
+		if(grp->tags[s%LRUHASH_GROUP] == TAG_EMPTY)
+			continue;
+		d = p->data;
+		(*table->delkeyfunc)(p->key, table->cb_arg);
+		(*table->deldatafunc)(d, table->cb_arg);
+	}
+	free(idx);
+}
+
 void 
 lruhash_delete(struct lruhash* table)
 {
@@ -156,9 +548,20 @@ lruhash_delete(struct lruhash* table)
 		return;
 	/* delete lock on hashtable to force check its OK */
 	lock_quick_destroy(&table->lock);
-	for(i=0; i<table->size; i++)
-		bin_delete(table, &table->array[i]);
-	free(table->array);
+	if(table->index) {
+		index_delete(table, table->index);
+		stripes_delete(table->stripes);
+	} else {
+		for(i=0; i<table->size; i++)
+			bin_delete(table, &table->array[i]);
+		free(table->array);
+	}
+	lruhash_free_retired(table, table->retired, table->retired_array,
+		table->cb_arg);
+	lruhash_free_retired(table, table->retired_old,
+		table->retired_array_old, table->cb_arg);
+	free(table->readers);
+	free(table->admit);
 	free(table);
 }
 
@@ -169,7 +572,7 @@ bin_overflow_remove(struct lruhash_bin* bin, struct lruhash_entry* entry)
 	struct lruhash_entry** prevp = &bin->overflow_list;
 	while(p) {
 		if(p == entry) {
-			*prevp = p->overflow_next;
+			lruhash_publish(*prevp, p->overflow_next);
 			return;
 		}
 		prevp = &p->overflow_next;
@@ -177,11 +580,100 @@ bin_overflow_remove(struct lruhash_bin* bin, struct lruhash_entry* entry)
 	}
 }
 
+/** put the entry at the front of the main part of the LRU list, after
+ * the window of the admission policy */
+static void
+lru_main_front(struct lruhash* table, struct lruhash_entry* entry)
+{
+	struct lruhash_entry* w = table->admit?table->admit->win_end:NULL;
+	if(!w) {
+		lru_front(table, entry);
+		return;
+	}
+	entry->lru_prev = w;
+	entry->lru_next = w->lru_next;
+	if(w->lru_next)
+		w->lru_next->lru_prev = entry;
+	else	table->lru_end = entry;
+	w->lru_next = entry;
+}
+
+/** put the entry at the front of its part of the LRU list */
+static void
+lru_refront(struct lruhash* table, struct lruhash_entry* entry)
+{
+	if(entry->window) {
+		lru_front(table, entry);
+		if(!table->admit->win_end)
+			table->admit->win_end = entry;
+	} else	lru_main_front(table, entry);
+}
+
+/** delete the entry from the hash table, it has been taken off the LRU
+ * list. It is put on the list, or retired in read-mostly mode. Caller
+ * holds the hashtable lock. */
+static void
+reclaim_entry(struct lruhash* table, struct lruhash_entry* d,
+	struct lruhash_entry** list)
+{
+	lock_quick_t* binlock;
+	size_t sz;
+	table->num --;
+	if(table->index) {
+		binlock = stripe_of(table, d->hash);
+		lock_quick_lock(binlock);
+		index_remove(table->index, d);
+	} else {
+		struct lruhash_bin* bin = &table->array[d->hash &
+			table->size_mask];
+		binlock = &bin->lock;
+		lock_quick_lock(binlock);
+		bin_overflow_remove(bin, d);
+	}
+	if(!table->readers) {
+		d->overflow_next = *list;
+		*list = d;
+	}
+	lock_rw_wrlock(&d->lock);
+	sz = table->sizefunc(d->key, d->data);
+	table->space_used -= sz;
+	if(d->window)
+		table->admit->win_used -= sz;
+	if(table->markdelfunc)
+		(*table->markdelfunc)(d->key);
+	d->removed = 1;
+	lock_rw_unlock(&d->lock);
+	lock_quick_unlock(binlock);
+	if(table->readers) {
+		/* lookups can still be walking past it */
+		lruhash_retire(table, d);
+	}
+}
+
+/** delete the least recently used entry, there must be another entry.
+ * Caller holds the hashtable lock. */
+static void
+reclaim_lru_end(struct lruhash* table, struct lruhash_entry** list)
+{
+	struct lruhash_entry* d = table->lru_end;
+	log_assert(d && d->lru_prev);
+	table->lru_end = d->lru_prev;
+	d->lru_prev->lru_next = NULL;
+	if(table->admit && table->admit->win_end == d) {
+		/* the whole list was the window */
+		table->admit->win_end = d->lru_prev;
+	}
+	/* schedule entry for deletion */
+	reclaim_entry(table, d, list);
+}
+
 void 
 reclaim_space(struct lruhash* table, struct lruhash_entry** list)
 {
 	struct lruhash_entry* d;
-	struct lruhash_bin* bin;
+	/* in read-mostly mode, the number of second chances for referenced
+	 * entries, after that entries are deleted in LRU order */
+	size_t chances = table->num;
 	log_assert(table);
 	/* does not delete MRU entry, so table will not be empty. */
 	while(table->num > 1 && table->space_used > table->space_max) {
@@ -192,24 +684,48 @@ reclaim_space(struct lruhash* table, struct lruhash_entry** list)
 		   which is unlikely, since it is LRU, if someone got a rdlock
 		   it would be moved to front, but to be sure. */
 		d = table->lru_end;
+		if(table->readers && chances > 0 && lruhash_ref_get(d)) {
+			/* CLOCK: referenced since it was last looked at,
+			 * give it a second chance at the front. */
+			lruhash_ref_set(d, 0);
+			lru_remove(table, d);
+			lru_refront(table, d);
+			chances--;
+			continue;
+		}
 		/* specialised, delete from end of double linked list,
 		   and we know num>1, so there is a previous lru entry. */
-		log_assert(d && d->lru_prev);
-		table->lru_end = d->lru_prev;
-		d->lru_prev->lru_next = NULL;
-		/* schedule entry for deletion */
-		bin = &table->array[d->hash & table->size_mask];
-		table->num --;
-		lock_quick_lock(&bin->lock);
-		bin_overflow_remove(bin, d);
-		d->overflow_next = *list;
-		*list = d;
-		lock_rw_wrlock(&d->lock);
-		table->space_used -= table->sizefunc(d->key, d->data);
-		if(table->markdelfunc)
-			(*table->markdelfunc)(d->key);
-		lock_rw_unlock(&d->lock);
-		lock_quick_unlock(&bin->lock);
+		reclaim_lru_end(table, list);
+	}
+}
+
+/** move entries from the end of the window to the main part of the LRU
+ * list, while the window is too big.  If the table is full, the entry
+ * is only admitted if it is looked up more often than the last entry of
+ * the main part, that is then deleted by reclaim_space; otherwise the
+ * new entry is deleted.  Caller holds the hashtable lock. */
+static void
+admit_window(struct lruhash* table, struct lruhash_entry** list)
+{
+	struct lruhash_admit* a = table->admit;
+	size_t win_max = table->space_max / LRUHASH_ADMIT_WINDOW;
+	while(a->win_used > win_max && a->win_end &&
+		a->win_end != table->lru_start) {
+		/* the last entry of the window is already at the front of
+		 * the main part, make the window smaller */
+		struct lruhash_entry* c = a->win_end, *v = table->lru_end;
+		a->win_end = c->lru_prev;
+		c->window = 0;
+		a->win_used -= table->sizefunc(c->key, c->data);
+		if(table->space_used <= table->space_max || v == c ||
+			sketch_estimate(a, c->hash) >
+			sketch_estimate(a, v->hash)) {
+			a->stats.admitted++;
+			continue;
+		}
+		a->stats.rejected++;
+		lru_remove(table, c);
+		reclaim_entry(table, c, list);
 	}
 }
 
@@ -230,6 +746,7 @@ void
 table_grow(struct lruhash* table)
 {
 	struct lruhash_bin* newa;
+	struct lruhash_retired_array* old = NULL;
 	int newmask;
 	size_t i;
 	if(table->size_mask == (int)(((size_t)-1)>>1)) {
@@ -243,6 +760,15 @@ table_grow(struct lruhash* table)
 		/* continue with smaller array. Though its slower. */
 		return;
 	}
+	if(table->readers) {
+		/* lookups can still use the old array, it is retired */
+		old = (struct lruhash_retired_array*)malloc(sizeof(*old));
+		if(!old) {
+			log_err("hash grow: malloc failed");
+			free(newa);
+			return;
+		}
+	}
 	bin_init(newa, table->size*2);
 	newmask = (table->size_mask << 1) | 1;
 	bin_split(table, newa, newmask);
@@ -251,16 +777,80 @@ table_grow(struct lruhash* table)
 	for(i=0; i<table->size; i++) {
 		lock_quick_destroy(&table->array[i].lock);
 	}
-	free(table->array);
+	if(old) {
+		old->array = table->array;
+		old->next = table->retired_array;
+		table->retired_array = old;
+	} else	free(table->array);
 	
 	table->size *= 2;
-	table->size_mask = newmask;
-	table->array = newa;
+	/* the array is published before the larger mask, a lookup that
+	 * sees the new mask also sees the new array */
+	lruhash_publish(table->array, newa);
+	lruhash_publish(table->size_mask, newmask);
 	lock_protect(&table->lock, table->array, 
 		table->size*sizeof(struct lruhash_bin));
 	return;
 }
 
+/** rebuild the index with the number of slots. Caller must hold the hash table lock. On malloc failure nothing
+ * happened. */
+static void
+index_rebuild(struct lruhash* table, size_t slots)
+{
+	struct lruhash_index* old = table->index, *idx;
+	struct lruhash_retired_array* retired = NULL;
+	size_t g, i;
+	idx = index_create(slots);
+	if(!idx) {
+		log_err("hash grow: malloc failed");
+		return;
+	}
+	if(table->readers) {
+		/* lookups can still use the old index, it is retired */
+		retired = (struct lruhash_retired_array*)malloc(
+			sizeof(*retired));
+		if(!retired) {
+			log_err("hash grow: malloc failed");
+			free(idx);
+			return;
+		}
+	}
+	for(g=0; g<=old->mask; g++) {
+		struct lruhash_group* grp = &old->groups[g];
+		for(i=0; i<LRUHASH_GROUP; i++) {
+			hashvalue_t h = grp->tags[i];
+			if(h == TAG_EMPTY)
+				continue;
+			/* the tag is the hash value, unless it was moved up,
+			 * this does not have to look at the entry */
+			if(h == tag_of(TAG_EMPTY))
+				h = grp->entries[i]->hash;
+			(void)index_place(idx, h, grp->entries[i]);
+		}
+	}
+	if(retired) {
+		retired->array = old;
+		retired->next = table->retired_array;
+		table->retired_array = retired;
+	} else	free(old);
+	table->size = slots;
+	table->size_mask = (int)(slots-1);
+	lruhash_publish(table->index, idx);
+}
+
+/** make room in the index, it is doubled in size. Caller must hold the
+ * hash table lock. */
+static void
+index_grow(struct lruhash* table)
+{
+	if((size_t)table->size_mask >= (((size_t)-1)>>2)) {
+		log_err("hash array malloc: size_t too small");
+		return;
+	}
+	index_rebuild(table, table->size*2);
+}
+
 void 
 lru_front(struct lruhash* table, struct lruhash_entry* entry)
 {
@@ -275,6 +865,8 @@ lru_front(struct lruhash* table, struct lruhash_entry* entry)
 void 
 lru_remove(struct lruhash* table, struct lruhash_entry* entry)
 {
+	if(table->admit && table->admit->win_end == entry)
+		table->admit->win_end = entry->lru_prev;
 	if(entry->lru_prev)
 		entry->lru_prev->lru_next = entry->lru_next;
 	else	table->lru_start = entry->lru_next;
@@ -287,20 +879,30 @@ void
 lru_touch(struct lruhash* table, struct lruhash_entry* entry)
 {
 	log_assert(table && entry);
-	if(entry == table->lru_start)
+	if(table->readers) {
+		/* read-mostly: only set the reference bit, do not write
+		 * the cache line if it is already set */
+		if(!lruhash_ref_get(entry))
+			lruhash_ref_set(entry, 1);
+		return;
+	}
+	if(entry == table->lru_start || (!entry->window && table->admit &&
+		entry->lru_prev == table->admit->win_end))
 		return; /* nothing to do */
 	/* remove from current lru position */
 	lru_remove(table, entry);
-	/* add at front */
-	lru_front(table, entry);
+	/* add at front, of the window or the main part */
+	lru_refront(table, entry);
 }
 
 void 
 lruhash_insert(struct lruhash* table, hashvalue_t hash,
         struct lruhash_entry* entry, void* data, void* cb_arg)
 {
-	struct lruhash_bin* bin;
-	struct lruhash_entry* found, *reclaimlist=NULL;
+	struct lruhash_bin* bin = NULL;
+	lock_quick_t* binlock;
+	struct lruhash_entry* found, *reclaimlist=NULL, *retiredlist=NULL;
+	struct lruhash_retired_array* retiredarrays=NULL;
 	size_t need_size;
 	fptr_ok(fptr_whitelist_hash_sizefunc(table->sizefunc));
 	fptr_ok(fptr_whitelist_hash_delkeyfunc(table->delkeyfunc));
@@ -312,19 +914,53 @@ lruhash_insert(struct lruhash* table, hashvalue_t hash,
 
 	/* find bin */
 	lock_quick_lock(&table->lock);
-	bin = &table->array[hash & table->size_mask];
-	lock_quick_lock(&bin->lock);
+	if(table->index) {
+		/* grow before the insert, so there is a free slot */
+		if((table->num + 1)*8 > table->size*7)
+			index_grow(table);
+		if(table->num >= table->size) {
+			/* full, and it could not grow; make room by deleting
+			 * the least recently used entry */
+			verbose(VERB_ALGO, "hash insert: index full at %u "
+				"entries, delete the lru entry",
+				(unsigned)table->num);
+			table->num_full++;
+			reclaim_lru_end(table, &reclaimlist);
+		}
+		binlock = stripe_of(table, hash);
+		lock_quick_lock(binlock);
+		found = index_find(table, table->index, hash, entry->key);
+	} else {
+		bin = &table->array[hash & table->size_mask];
+		binlock = &bin->lock;
+		lock_quick_lock(binlock);
+		found = bin_find_entry(table, bin, hash, entry->key);
+	}
 
 	/* see if entry exists already */
-	if(!(found=bin_find_entry(table, bin, hash, entry->key))) {
+	if(!found) {
 		/* if not: add to bin */
-		entry->overflow_next = bin->overflow_list;
-		bin->overflow_list = entry;
+		entry->ref = 0;
+		entry->removed = 0;
+		entry->window = (table->admit != NULL);
+		if(bin) {
+			entry->overflow_next = bin->overflow_list;
+			lruhash_publish(bin->overflow_list, entry);
+		} else	(void)index_place(table->index, hash, entry);
 		lru_front(table, entry);
+		if(table->admit) {
+			/* new entries start at the front of the window */
+			if(!table->admit->win_end)
+				table->admit->win_end = entry;
+			table->admit->win_used += need_size;
+		}
 		table->num++;
 		table->space_used += need_size;
 	} else {
 		/* if so: update data - needs a writelock */
+		if(found->window)
+			table->admit->win_used += need_size -
+				(*table->sizefunc)(found->key, found->data);
 		table->space_used += need_size -
 			(*table->sizefunc)(found->key, found->data);
 		(*table->delkeyfunc)(entry->key, cb_arg);
@@ -334,11 +970,17 @@ lruhash_insert(struct lruhash* table, hashvalue_t hash,
 		found->data = data;
 		lock_rw_unlock(&found->lock);
 	}
-	lock_quick_unlock(&bin->lock);
+	lock_quick_unlock(binlock);
+	if(table->admit) {
+		admit_window(table, &reclaimlist);
+		sketch_age(table->admit);
+	}
 	if(table->space_used > table->space_max)
 		reclaim_space(table, &reclaimlist);
-	if(table->num >= table->size)
+	if(!table->index && table->num >= table->size)
 		table_grow(table);
+	if(table->readers)
+		lruhash_epoch_advance(table, &retiredlist, &retiredarrays);
 	lock_quick_unlock(&table->lock);
 
 	/* finish reclaim if any (outside of critical region) */
@@ -349,27 +991,101 @@ lruhash_insert(struct lruhash* table, hashvalue_t hash,
 		(*table->deldatafunc)(d, cb_arg);
 		reclaimlist = n;
 	}
+	lruhash_free_retired(table, retiredlist, retiredarrays, cb_arg);
+}
+
+#ifdef LRUHASH_READ_MOSTLY
+/** lookup in read-mostly mode, without table and bin locks */
+static struct lruhash_entry*
+lruhash_lookup_read_mostly(struct lruhash* table, hashvalue_t hash,
+	void* key, int wr)
+{
+	struct lruhash_readers* r = &table->readers[hash &
+		(LRUHASH_READER_STRIPES-1)];
+	struct lruhash_bin* array;
+	struct lruhash_index* idx;
+	struct lruhash_entry* entry;
+	unsigned int epoch;
+	int mask;
+
+	/* count as reader of the current epoch; if the epoch changes
+	 * meanwhile the writer may not have seen us, try again */
+	for(;;) {
+		epoch = __atomic_load_n(&table->epoch, __ATOMIC_SEQ_CST);
+		(void)__atomic_fetch_add(&r->count[epoch&1], 1,
+			__ATOMIC_SEQ_CST);
+		if(__atomic_load_n(&table->epoch, __ATOMIC_SEQ_CST) == epoch)
+			break;
+		(void)__atomic_fetch_sub(&r->count[epoch&1], 1,
+			__ATOMIC_SEQ_CST);
+	}
+
+	if((idx = lruhash_load(table->index)) != NULL) {
+		entry = index_find(table, idx, hash, key);
+	} else {
+		/* the mask is loaded before the array, see table_grow */
+		mask = lruhash_load(table->size_mask);
+		array = lruhash_load(table->array);
+		entry = lruhash_load(array[hash & mask].overflow_list);
+		while(entry) {
+			if(entry->hash == hash &&
+				table->compfunc(entry->key, key) == 0)
+				break;
+			entry = lruhash_load(entry->overflow_next);
+		}
+	}
+	if(entry) {
+		if(wr)	{ lock_rw_wrlock(&entry->lock); }
+		else	{ lock_rw_rdlock(&entry->lock); }
+		if(entry->removed) {
+			/* deleted while we waited for the lock */
+			lock_rw_unlock(&entry->lock);
+			entry = NULL;
+		} else if(!lruhash_ref_get(entry))
+			lruhash_ref_set(entry, 1);
+	}
+	if(table->admit)
+		admit_access(table->admit, hash, entry != NULL, 1);
+
+	(void)__atomic_fetch_sub(&r->count[epoch&1], 1, __ATOMIC_RELEASE);
+	return entry;
 }
+#endif /* LRUHASH_READ_MOSTLY */
 
 struct lruhash_entry* 
 lruhash_lookup(struct lruhash* table, hashvalue_t hash, void* key, int wr)
 {
 	struct lruhash_entry* entry;
-	struct lruhash_bin* bin;
+	lock_quick_t* binlock;
 	fptr_ok(fptr_whitelist_hash_compfunc(table->compfunc));
+#ifdef LRUHASH_READ_MOSTLY
+	if(table->readers)
+		return lruhash_lookup_read_mostly(table, hash, key, wr);
+#endif
 
 	lock_quick_lock(&table->lock);
-	bin = &table->array[hash & table->size_mask];
-	lock_quick_lock(&bin->lock);
-	if((entry=bin_find_entry(table, bin, hash, key)))
+	if(table->index) {
+		binlock = stripe_of(table, hash);
+		lock_quick_lock(binlock);
+		entry = index_find(table, table->index, hash, key);
+	} else {
+		struct lruhash_bin* bin = &table->array[hash &
+			table->size_mask];
+		binlock = &bin->lock;
+		lock_quick_lock(binlock);
+		entry = bin_find_entry(table, bin, hash, key);
+	}
+	if(entry)
 		lru_touch(table, entry);
+	if(table->admit)
+		admit_access(table->admit, hash, entry != NULL, 0);
 	lock_quick_unlock(&table->lock);
 
 	if(entry) {
 		if(wr)	{ lock_rw_wrlock(&entry->lock); }
 		else	{ lock_rw_rdlock(&entry->lock); }
 	}
-	lock_quick_unlock(&bin->lock);
+	lock_quick_unlock(binlock);
 	return entry;
 }
 
@@ -377,8 +1093,9 @@ void
 lruhash_remove(struct lruhash* table, hashvalue_t hash, void* key)
 {
 	struct lruhash_entry* entry;
-	struct lruhash_bin* bin;
+	lock_quick_t* binlock;
 	void *d;
+	size_t sz;
 	fptr_ok(fptr_whitelist_hash_sizefunc(table->sizefunc));
 	fptr_ok(fptr_whitelist_hash_delkeyfunc(table->delkeyfunc));
 	fptr_ok(fptr_whitelist_hash_deldatafunc(table->deldatafunc));
@@ -386,24 +1103,53 @@ lruhash_remove(struct lruhash* table, hashvalue_t hash, void* key)
 	fptr_ok(fptr_whitelist_hash_markdelfunc(table->markdelfunc));
 
 	lock_quick_lock(&table->lock);
-	bin = &table->array[hash & table->size_mask];
-	lock_quick_lock(&bin->lock);
-	if((entry=bin_find_entry(table, bin, hash, key))) {
-		bin_overflow_remove(bin, entry);
+	if(table->index) {
+		binlock = stripe_of(table, hash);
+		lock_quick_lock(binlock);
+		if((entry=index_find(table, table->index, hash, key)))
+			index_remove(table->index, entry);
+	} else {
+		struct lruhash_bin* bin = &table->array[hash &
+			table->size_mask];
+		binlock = &bin->lock;
+		lock_quick_lock(binlock);
+		if((entry=bin_find_entry(table, bin, hash, key)))
+			bin_overflow_remove(bin, entry);
+	}
+	if(entry) {
 		lru_remove(table, entry);
 	} else {
 		lock_quick_unlock(&table->lock);
-		lock_quick_unlock(&bin->lock);
+		lock_quick_unlock(binlock);
 		return;
 	}
 	table->num--;
-	table->space_used -= (*table->sizefunc)(entry->key, entry->data);
+	sz = (*table->sizefunc)(entry->key, entry->data);
+	table->space_used -= sz;
+	if(entry->window)
+		table->admit->win_used -= sz;
+	if(table->readers) {
+		struct lruhash_entry* list = NULL;
+		struct lruhash_retired_array* arrays = NULL;
+		lock_rw_wrlock(&entry->lock);
+		if(table->markdelfunc)
+			(*table->markdelfunc)(entry->key);
+		entry->removed = 1;
+		lock_rw_unlock(&entry->lock);
+		lock_quick_unlock(binlock);
+		/* delete it when the lookups that can see it are done */
+		lruhash_retire(table, entry);
+		lruhash_epoch_advance(table, &list, &arrays);
+		lock_quick_unlock(&table->lock);
+		lruhash_free_retired(table, list, arrays, table->cb_arg);
+		return;
+	}
 	lock_quick_unlock(&table->lock);
 	lock_rw_wrlock(&entry->lock);
 	if(table->markdelfunc)
 		(*table->markdelfunc)(entry->key);
 	lock_rw_unlock(&entry->lock);
-	lock_quick_unlock(&bin->lock);
+	lock_quick_unlock(binlock);
 	/* finish removal */
 	d = entry->data;
 	(*table->delkeyfunc)(entry->key, table->cb_arg);
@@ -424,18 +1170,63 @@ bin_clear(struct lruhash* table, struct lruhash_bin* bin)
 		d = p->data;
 		if(table->markdelfunc)
 			(*table->markdelfunc)(p->key);
+		p->removed = 1;
 		lock_rw_unlock(&p->lock);
-		(*table->delkeyfunc)(p->key, table->cb_arg);
-		(*table->deldatafunc)(d, table->cb_arg);
+		if(table->readers) {
+			/* deleted when the lookups are done with it */
+			lruhash_retire(table, p);
+		} else {
+			(*table->delkeyfunc)(p->key, table->cb_arg);
+			(*table->deldatafunc)(d, table->cb_arg);
+		}
 		p = np;
 	}
-	bin->overflow_list = NULL;
+	lruhash_publish(bin->overflow_list, NULL);
 	lock_quick_unlock(&bin->lock);
 }
 
+/** clear the index, respecting locks, does not do space, LRU */
+static void
+index_clear(struct lruhash* table)
+{
+	struct lruhash_index* idx = table->index;
+	size_t s, g;
+	for(s=0; s<table->size; s++) {
+		struct lruhash_group* grp = &idx->groups[s/LRUHASH_GROUP];
+		size_t i = s%LRUHASH_GROUP;
+		struct lruhash_entry* p = grp->entries[i];
+		lock_quick_t* binlock;
+		void* d;
+		if(grp->tags[i] == TAG_EMPTY)
+			continue;
+		binlock = stripe_of(table, p->hash);
+		lock_quick_lock(binlock);
+		lock_rw_wrlock(&p->lock);
+		d = p->data;
+		if(table->markdelfunc)
+			(*table->markdelfunc)(p->key);
+		p->removed = 1;
+		lock_rw_unlock(&p->lock);
+		lruhash_publish(grp->tags[i], TAG_EMPTY);
+		lock_quick_unlock(binlock);
+		if(table->readers) {
+			/* deleted when the lookups are done with it */
+			lruhash_retire(table, p);
+		} else {
+			(*table->delkeyfunc)(p->key, table->cb_arg);
+			(*table->deldatafunc)(d, table->cb_arg);
+		}
+	}
+	/* all slots are empty, no probe sequence passes a group */
+	for(g=0; g<=idx->mask; g++)
+		lruhash_publish(idx->groups[g].overflow, 0);
+}
+
 void
 lruhash_clear(struct lruhash* table)
 {
+	struct lruhash_entry* list = NULL;
+	struct lruhash_retired_array* arrays = NULL;
 	size_t i;
 	if(!table)
 		return;
@@ -444,14 +1235,50 @@ lruhash_clear(struct lruhash* table)
 	fptr_ok(fptr_whitelist_hash_markdelfunc(table->markdelfunc));
 
 	lock_quick_lock(&table->lock);
-	for(i=0; i<table->size; i++) {
+	if(table->index)
+		index_clear(table);
+	else for(i=0; i<table->size; i++) {
 		bin_clear(table, &table->array[i]);
 	}
 	table->lru_start = NULL;
 	table->lru_end = NULL;
+	if(table->admit) {
+		table->admit->win_end = NULL;
+		table->admit->win_used = 0;
+	}
 	table->num = 0;
 	table->space_used = 0;
+	if(table->readers)
+		lruhash_epoch_advance(table, &list, &arrays);
 	lock_quick_unlock(&table->lock);
+	lruhash_free_retired(table, list, arrays, table->cb_arg);
+}
+
+struct lruhash_entry*
+lruhash_take_all(struct lruhash* table)
+{
+	struct lruhash_entry* list;
+	size_t i;
+	lock_quick_lock(&table->lock);
+	list = table->lru_end;
+	if(table->index) {
+		memset(table->index->groups, 0, (table->index->mask+1)*
+			sizeof(struct lruhash_group));
+	} else for(i=0; i<table->size; i++) {
+		lock_quick_lock(&table->array[i].lock);
+		lruhash_publish(table->array[i].overflow_list, NULL);
+		lock_quick_unlock(&table->array[i].lock);
+	}
+	table->lru_start = NULL;
+	table->lru_end = NULL;
+	if(table->admit) {
+		table->admit->win_end = NULL;
+		table->admit->win_used = 0;
+	}
+	table->num = 0;
+	table->space_used = 0;
+	lock_quick_unlock(&table->lock);
+	return list;
 }
 
 void 
@@ -464,7 +1291,25 @@ lruhash_status(struct lruhash* table, const char* id, int extended)
 	log_info("  itemsize %u, array %u, mask %d",
 		(unsigned)(table->num? table->space_used/table->num : 0),
 		(unsigned)table->size, table->size_mask);
-	if(extended) {
+	if(table->index && extended) {
+		/* the number of groups probed to find the entries */
+		struct lruhash_index* idx = table->index;
+		size_t i, max = 0, total = 0;
+		for(i=0; i<table->size; i++) {
+			struct lruhash_group* grp = &idx->groups[i/LRUHASH_GROUP];
+			size_t g, step = 0, here = 1;
+			if(grp->tags[i%LRUHASH_GROUP] == TAG_EMPTY)
+				continue;
+			g = probe_start(idx, grp->entries[i%LRUHASH_GROUP]->hash);
+			while(g != i/LRUHASH_GROUP && probe_next(idx, &g, &step))
+				here++;
+			total += here;
+			if(here > max) max = here;
+		}
+		log_info("  open addressing, groups probed avg %.2lf, max %u",
+			(table->num? (double)total/(double)table->num : 0.),
+			(unsigned)max);
+	} else if(extended) {
 		size_t i;
 		int min=(int)table->size*2, max=-2;
 		for(i=0; i<table->size; i++) {
@@ -494,18 +1339,26 @@ lruhash_get_mem(struct lruhash* table)
 	size_t s;
 	lock_quick_lock(&table->lock);
 	s = sizeof(struct lruhash) + table->space_used;
+	if(table->index) {
+		s += index_get_mem(table->index) + LRUHASH_LOCK_STRIPES*
+			(sizeof(lock_quick_t) + lock_get_mem(&table->stripes[0]));
+	}
 #ifdef USE_THREAD_DEBUG
-	if(table->size != 0) {
+	else if(table->size != 0) {
 		size_t i;
 		for(i=0; i<table->size; i++)
 			s += sizeof(struct lruhash_bin) + 
 				lock_get_mem(&table->array[i].lock);
 	}
 #else /* no THREAD_DEBUG */
-	if(table->size != 0)
+	else if(table->size != 0)
 		s += (table->size)*(sizeof(struct lruhash_bin) + 
 			lock_get_mem(&table->array[0].lock));
 #endif
+	if(table->admit)
+		s += sizeof(*table->admit) + 63 + table->admit->blocks*64;
+	if(table->readers)
+		s += LRUHASH_READER_STRIPES * sizeof(struct lruhash_readers);
 	lock_quick_unlock(&table->lock);
 	s += lock_get_mem(&table->lock);
 	return s;
@@ -527,6 +1380,26 @@ lruhash_traverse(struct lruhash* h, int wr,
 	struct lruhash_entry* e;
 
 	lock_quick_lock(&h->lock);
+	if(h->index) {
+		for(i=0; i<h->size; i++) {
+			struct lruhash_group* grp = &h->index->groups[
+				i/LRUHASH_GROUP];
+			if(grp->tags[i%LRUHASH_GROUP] == TAG_EMPTY)
+				continue;
+			e = grp->entries[i%LRUHASH_GROUP];
+			lock_quick_lock(stripe_of(h, e->hash));
+			if(wr) {
+				lock_rw_wrlock(&e->lock);
+			} else {
+				lock_rw_rdlock(&e->lock);
+			}
+			(*func)(e, arg);
+			lock_rw_unlock(&e->lock);
+			lock_quick_unlock(stripe_of(h, e->hash));
+		}
+		lock_quick_unlock(&h->lock);
+		return;
+	}
 	for(i=0; i<h->size; i++) {
 		lock_quick_lock(&h->array[i].lock);
 		for(e = h->array[i].overflow_list; e; e = e->overflow_next) {
@@ -542,3 +1415,233 @@ lruhash_traverse(struct lruhash* h, int wr,
 	}
 	lock_quick_unlock(&h->lock);
 }
+
+size_t
+lruhash_traverse_part(struct lruhash* h, int wr, size_t pos, size_t max,
+	void (*func)(struct lruhash_entry*, void*), void* arg)
+{
+	size_t n = 0;
+	struct lruhash_entry* e;
+
+	lock_quick_lock(&h->lock);
+	if(h->index) {
+		for(; pos<h->size && n<max; pos++) {
+			struct lruhash_group* grp = &h->index->groups[
+				pos/LRUHASH_GROUP];
+			if(grp->tags[pos%LRUHASH_GROUP] == TAG_EMPTY)
+				continue;
+			e = grp->entries[pos%LRUHASH_GROUP];
+			lock_quick_lock(stripe_of(h, e->hash));
+			if(wr) {
+				lock_rw_wrlock(&e->lock);
+			} else {
+				lock_rw_rdlock(&e->lock);
+			}
+			(*func)(e, arg);
+			lock_rw_unlock(&e->lock);
+			lock_quick_unlock(stripe_of(h, e->hash));
+			n++;
+		}
+	} else {
+		/* a bin is visited whole, so n can end up above max */
+		for(; pos<h->size && n<max; pos++) {
+			lock_quick_lock(&h->array[pos].lock);
+			for(e = h->array[pos].overflow_list; e;
+				e = e->overflow_next) {
+				if(wr) {
+					lock_rw_wrlock(&e->lock);
+				} else {
+					lock_rw_rdlock(&e->lock);
+				}
+				(*func)(e, arg);
+				lock_rw_unlock(&e->lock);
+				n++;
+			}
+			lock_quick_unlock(&h->array[pos].lock);
+		}
+	}
+	if(pos >= h->size)
+		pos = 0;
+	lock_quick_unlock(&h->lock);
+	return pos;
+}
+
+void
+lruhash_epoch_advance(struct lruhash* table, struct lruhash_entry** list,
+	struct lruhash_retired_array** arrays)
+{
+#ifdef LRUHASH_READ_MOSTLY
+	size_t i, busy = 0;
+	unsigned int epoch = table->epoch;
+	*list = NULL;
+	*arrays = NULL;
+	if(!table->readers || (!table->retired && !table->retired_old &&
+		!table->retired_array && !table->retired_array_old))
+		return;
+	/* are the lookups of the previous epoch done? (that is the other
+	 * parity). Lookups of this epoch started after the items on
+	 * retired_old were removed, so those cannot be seen any more. */
+	for(i=0; i<LRUHASH_READER_STRIPES; i++)
+		busy += __atomic_load_n(&table->readers[i].count[(epoch+1)&1],
+			__ATOMIC_SEQ_CST);
+	if(busy)
+		return;
+	*list = table->retired_old;
+	*arrays = table->retired_array_old;
+	table->retired_old = table->retired;
+	table->retired_array_old = table->retired_array;
+	table->retired = NULL;
+	table->retired_array = NULL;
+	__atomic_store_n(&table->epoch, epoch+1, __ATOMIC_SEQ_CST);
+#else
+	(void)table;
+	*list = NULL;
+	*arrays = NULL;
+#endif /* LRUHASH_READ_MOSTLY */
+}
+
+int
+lruhash_set_read_mostly(struct lruhash* table, int on)
+{
+#ifdef LRUHASH_READ_MOSTLY
+	struct lruhash_entry* list = NULL, *list_old = NULL;
+	struct lruhash_retired_array* arrays = NULL, *arrays_old = NULL;
+	lock_quick_lock(&table->lock);
+	if(on && !table->readers) {
+		table->readers = (struct lruhash_readers*)calloc(
+			LRUHASH_READER_STRIPES, sizeof(struct lruhash_readers));
+		if(!table->readers) {
+			lock_quick_unlock(&table->lock);
+			log_err("lruhash read-mostly: malloc failed");
+			return 0;
+		}
+	} else if(!on && table->readers) {
+		/* no other threads use the table, delete the retired items */
+		list = table->retired;
+		list_old = table->retired_old;
+		arrays = table->retired_array;
+		arrays_old = table->retired_array_old;
+		table->retired = NULL;
+		table->retired_old = NULL;
+		table->retired_array = NULL;
+		table->retired_array_old = NULL;
+		free(table->readers);
+		table->readers = NULL;
+	}
+	lock_quick_unlock(&table->lock);
+	lruhash_free_retired(table, list, arrays, table->cb_arg);
+	lruhash_free_retired(table, list_old, arrays_old, table->cb_arg);
+	return 1;
+#else
+	(void)table;
+	return !on;
+#endif /* LRUHASH_READ_MOSTLY */
+}
+
+int
+lruhash_set_open_addressing(struct lruhash* table, int on)
+{
+	struct lruhash_entry* e;
+	size_t i;
+	lock_quick_lock(&table->lock);
+	if(on && !table->index) {
+		/* the same number of slots as bins, and below 7/8 full */
+		size_t slots = table->size;
+		struct lruhash_index* idx;
+		lock_quick_t* stripes;
+		if(slots < LRUHASH_GROUP)
+			slots = LRUHASH_GROUP;
+		while((table->num+1)*8 > slots*7)
+			slots *= 2;
+		idx = index_create(slots);
+		stripes = stripes_create();
+		if(!idx || !stripes) {
+			lock_quick_unlock(&table->lock);
+			free(idx);
+			stripes_delete(stripes);
+			log_err("lruhash open addressing: malloc failed");
+			return 0;
+		}
+		for(e = table->lru_start; e; e = e->lru_next)
+			(void)index_place(idx, e->hash, e);
+		lock_unprotect(&table->lock, table->array);
+		for(i=0; i<table->size; i++) {
+			lock_quick_destroy(&table->array[i].lock);
+		}
+		free(table->array);
+		table->array = NULL;
+		table->index = idx;
+		table->stripes = stripes;
+		table->size = slots;
+		table->size_mask = (int)(slots-1);
+	} else if(!on && table->index) {
+		struct lruhash_bin* array = calloc(table->size,
+			sizeof(struct lruhash_bin));
+		if(!array) {
+			lock_quick_unlock(&table->lock);
+			log_err("lruhash open addressing: malloc failed");
+			return 0;
+		}
+		for(e = table->lru_start; e; e = e->lru_next) {
+			struct lruhash_bin* bin = &array[e->hash &
+				table->size_mask];
+			e->overflow_next = bin->overflow_list;
+			bin->overflow_list = e;
+		}
+		/* after the lists are made, the bin locks protect them */
+		bin_init(array, table->size);
+		free(table->index);
+		stripes_delete(table->stripes);
+		table->index = NULL;
+		table->stripes = NULL;
+		table->array = array;
+		lock_protect(&table->lock, table->array,
+			table->size*sizeof(struct lruhash_bin));
+	}
+	lock_quick_unlock(&table->lock);
+	return 1;
+}
+
+int
+lruhash_set_admission(struct lruhash* table, int on)
+{
+	struct lruhash_entry* e;
+	lock_quick_lock(&table->lock);
+	if(on && !table->admit) {
+		table->admit = admit_create(table->space_max);
+		if(!table->admit) {
+			lock_quick_unlock(&table->lock);
+			log_err("lruhash admission: malloc failed");
+			return 0;
+		}
+	} else if(!on && table->admit) {
+		/* the window entries become the front of the main list */
+		for(e = table->lru_start; e && e->window; e = e->lru_next)
+			e->window = 0;
+		free(table->admit);
+		table->admit = NULL;
+	}
+	lock_quick_unlock(&table->lock);
+	return 1;
+}
+
+void
+lruhash_get_admit_stats(struct lruhash* table,
+	struct lruhash_admit_stats* st, int reset)
+{
+	struct lruhash_admit* a;
+	lock_quick_lock(&table->lock);
+	if((a = table->admit) != NULL) {
+		st->lookups += lruhash_peek(a->stats.lookups);
+		st->hits += lruhash_peek(a->stats.hits);
+		st->admitted += a->stats.admitted;
+		st->rejected += a->stats.rejected;
+		if(reset) {
+			lruhash_store(a->stats.lookups, 0);
+			lruhash_store(a->stats.hits, 0);
+			a->stats.admitted = 0;
+			a->stats.rejected = 0;
+		}
+	}
+	lock_quick_unlock(&table->lock);
+}
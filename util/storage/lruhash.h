@@ -102,6 +102,68 @@
  *	  doing the next lookup/insert/delete/whatever.
  *	o To acquire multiple items you should use a special routine that
  *	  obtains the locks on those multiple items in one go.
+ *
+ * Read-mostly mode (lruhash_set_read_mostly), for tables where almost
+ * every access is a lookup:
+ *	o lookups do not lock the hashtable or the hash bin. They register
+ *	  in the reader count for the current epoch, walk the overflow chain
+ *	  and lock the entry. If the entry has been removed meanwhile, they
+ *	  unlock it and return NULL. Then they leave the epoch.
+ *	o instead of moving the entry to the front of the LRU list, a
+ *	  lookup sets the reference bit of the entry. Space is reclaimed
+ *	  in CLOCK order: the last entry of the list is deleted, unless its
+ *	  reference bit is set, then it gets a second chance at the front.
+ *	o insert, remove and grow lock as described above, and publish
+ *	  the overflow chain changes with release stores.
+ *	o removed entries are marked deleted (markdelfunc) and removed under
+ *	  the entry writelock as before, but they are put on a retired list.
+ *	  The delkey and deldata functions are only called once the readers
+ *	  of the epoch they were removed in are gone, so that a lookup never
+ *	  sees freed (or recycled) memory. Old bin arrays are retired too.
+ *	o a lookup that runs while the table grows can miss an entry that
+ *	  is being moved to the new array; for a cache that is a miss.
+ *
+ * Open addressing mode (lruhash_set_open_addressing), to make lookups
+ * touch fewer cache lines:
+ *	o the bins are replaced by an index, an array of groups of
+ *	  LRUHASH_GROUP slots.  Every slot has a tag, the 32 bit hash value
+ *	  of its entry, and the pointer to the entry.  The tags of a group
+ *	  are compared at once (with SSE2), and only for a slot where the
+ *	  hash value matches is the entry and its key looked at.  A group
+ *	  fits in a cache line.  Every group counts the entries that were
+ *	  placed past it because it was full; a probe sequence ends at a
+ *	  group where that count is zero, so removed slots are simply empty.
+ *	o the bin locks are replaced by LRUHASH_LOCK_STRIPES locks, the lock
+ *	  for a hash value is used like the bin lock in the sequences above.
+ *	o the index is grown when it is 7/8 full, under the hashtable lock.
+ *	  If it cannot grow (malloc failure) and is full, an insert deletes
+ *	  the LRU entry to make room, and counts that in num_full.
+ *	  The LRU list, the space accounting and the read-mostly mode work
+ *	  the same; in read-mostly mode the old index is retired like the
+ *	  old bin arrays.
+ *	o a lookup that misses is about twice as fast as with the bins.  A
+ *	  lookup that hits is not faster: its time goes to the hashtable
+ *	  lock, the move to the front of the LRU list and the entry lock,
+ *	  which are the same in both modes (see the benchmark in
+ *	  testcode/unitlruhash.c).
+ *
+ * Admission policy (lruhash_set_admission), so that a flood of entries
+ * that are used once does not push the often used entries out (TinyLFU):
+ *	o lookups count the hash value in a frequency sketch, a count-min
+ *	  sketch with LRUHASH_SKETCH_DEPTH counters of 4 bits per hash
+ *	  value, in one cache line.  The counters are halved after ten
+ *	  accesses per entry that fits in the table, so that old
+ *	  popularity fades.
+ *	o new entries go into a window, the front part of the LRU list
+ *	  up to admit->win_end, of 1/LRUHASH_ADMIT_WINDOW of the space.
+ *	  Lookups move window entries to the front of the list, and other
+ *	  entries to the front of the main part, after the window.
+ *	o when the window is full, its last entry moves to the main part.
+ *	  If the table is full, it stays only if its frequency is higher
+ *	  than that of the last entry of the main part, which is then
+ *	  deleted to make space; otherwise the new entry is deleted.
+ *	o in read-mostly mode, the lookups count with relaxed atomic
+ *	  operations, and an update that is lost in a race is not a problem.
  */
 
 #ifndef UTIL_STORAGE_LRUHASH_H
@@ -115,6 +177,24 @@ struct lruhash_entry;
 /** default max memory for hash arrays */
 #define HASH_DEFAULT_MAXMEM		4*1024*1024 /* bytes */
 
+#if defined(__ATOMIC_ACQUIRE) && defined(__ATOMIC_RELEASE)
+/** the read-mostly mode is available, it needs atomic operations */
+#define LRUHASH_READ_MOSTLY 1
+#endif
+/** number of reader counts in read-mostly mode, power of 2. Readers pick
+ * one by hash value, so that they do not all write the same cache line. */
+#define LRUHASH_READER_STRIPES 16
+/** the window of the admission policy is this part of the space */
+#define LRUHASH_ADMIT_WINDOW 100
+/** number of counters in the frequency sketch for a hash value */
+#define LRUHASH_SKETCH_DEPTH 4
+/** number of slots in a group of the open addressing index, the probe
+ * sequence visits whole groups */
+#define LRUHASH_GROUP 4
+/** number of locks that take the place of the bin locks in open addressing
+ * mode, power of 2 */
+#define LRUHASH_LOCK_STRIPES 64
+
 /** the type of a hash value */
 typedef uint32_t hashvalue_t;
 
@@ -141,6 +221,94 @@ typedef void (*lruhash_deldatafunc_t)(void*, void*);
  * called: func(key) */
 typedef void (*lruhash_markdelfunc_t)(void*);
 
+/**
+ * Reader count for the read-mostly mode, one cache line per stripe.
+ */
+struct lruhash_readers {
+	/** number of lookups busy, for even and for odd epochs */
+	size_t count[2];
+	/** pad to a cache line */
+	uint8_t pad[64 - 2*sizeof(size_t)];
+};
+
+/**
+ * Bin array or index that is no longer used, waiting for its readers to
+ * be gone.
+ */
+struct lruhash_retired_array {
+	/** next in list */
+	struct lruhash_retired_array* next;
+	/** the bin array or the index, freed with free() */
+	void* array;
+};
+
+/**
+ * Group of slots of the open addressing index.  The tags and the entry
+ * pointers of a group are in one cache line, so that probing a group
+ * and finding the entry pointer touches one cache line.
+ */
+struct lruhash_group {
+	/** tag of the slot: empty (0), or the hash value of the entry
+	 * (0 is stored as 1) */
+	hashvalue_t tags[LRUHASH_GROUP];
+	/** entry in the slot */
+	struct lruhash_entry* entries[LRUHASH_GROUP];
+	/** number of entries whose probe sequence passes this group, because
+	 * it was full when they were placed */
+	uint32_t overflow;
+	/** pad the group to the size of a cache line */
+	uint8_t pad[64 - LRUHASH_GROUP*(sizeof(hashvalue_t) +
+		sizeof(struct lruhash_entry*)) - sizeof(uint32_t)];
+};
+
+/**
+ * Index of the table in open addressing mode.  It is allocated in one
+ * piece, the groups follow the struct.
+ */
+struct lruhash_index {
+	/** number of groups minus one, the number of groups is a power of 2 */
+	size_t mask;
+	/** the groups of slots */
+	struct lruhash_group* groups;
+};
+
+/**
+ * Counters of the admission policy of a table.
+ */
+struct lruhash_admit_stats {
+	/** number of lookups */
+	size_t lookups;
+	/** number of lookups that found the entry */
+	size_t hits;
+	/** number of new entries moved from the window to the main LRU */
+	size_t admitted;
+	/** number of new entries deleted, they were used less often than
+	 * the entries they would push out */
+	size_t rejected;
+};
+
+/**
+ * Admission policy of the table. It is allocated in one piece, the
+ * sketch follows the struct.
+ */
+struct lruhash_admit {
+	/** the frequency sketch, blocks of 64 bytes with 128 counters of
+	 * 4 bits; a hash value has a counter in every part of 32 counters
+	 * of its block */
+	uint8_t* sketch;
+	/** number of blocks of the sketch */
+	size_t blocks;
+	/** number of accesses counted since the counters were halved */
+	size_t additions;
+	/** the last entry of the window, NULL if the window is empty. The
+	 * window is the part of the LRU list from lru_start up to it. */
+	struct lruhash_entry* win_end;
+	/** the space used by the entries in the window */
+	size_t win_used;
+	/** the counters */
+	struct lruhash_admit_stats stats;
+};
+
 /**
  * Hash table that keeps LRU list of entries.
  */
@@ -164,13 +332,21 @@ struct lruhash {
 	size_t size;
 	/** size bitmask - since size is a power of 2 */
 	int size_mask;
-	/** lookup array of bins */
+	/** lookup array of bins, NULL in open addressing mode */
 	struct lruhash_bin* array;
+	/** open addressing index, if not NULL it is used instead of the bins,
+	 * the size is the number of slots */
+	struct lruhash_index* index;
+	/** locks for open addressing mode, LRUHASH_LOCK_STRIPES of them, the
+	 * one for hash h is at h & (LRUHASH_LOCK_STRIPES-1) */
+	lock_quick_t* stripes;
 
 	/** the lru list, start and end, noncyclical double linked list. */
 	struct lruhash_entry* lru_start;
 	/** lru list end item (least recently used) */
 	struct lruhash_entry* lru_end;
+	/** admission policy, if NULL new entries are always admitted */
+	struct lruhash_admit* admit;
 
 	/** the number of entries in the hash table. */
 	size_t num;
@@ -178,6 +354,24 @@ struct lruhash {
 	size_t space_used;
 	/** the amount of space the hash table is maximally allowed to use. */
 	size_t space_max;
+	/** the number of inserts that deleted the LRU entry because the
+	 * open addressing index was full and could not grow */
+	size_t num_full;
+
+	/** reader counts, array of LRUHASH_READER_STRIPES, if NULL the table
+	 * is not in read-mostly mode and lookups lock the table */
+	struct lruhash_readers* readers;
+	/** epoch number, readers count themselves for its parity */
+	unsigned int epoch;
+	/** entries removed in this epoch, linked with lru_next */
+	struct lruhash_entry* retired;
+	/** entries removed in the previous epoch, linked with lru_next,
+	 * they are deleted when the readers of that epoch are gone */
+	struct lruhash_entry* retired_old;
+	/** bin arrays (or indexes) replaced in this epoch */
+	struct lruhash_retired_array* retired_array;
+	/** bin arrays (or indexes) replaced in the previous epoch */
+	struct lruhash_retired_array* retired_array_old;
 };
 
 /**
@@ -216,6 +410,14 @@ struct lruhash_entry {
 	struct lruhash_entry* lru_prev;
 	/** hash value of the key. It may not change, until entry deleted. */
 	hashvalue_t hash;
+	/** CLOCK reference bit, set by lookups in read-mostly mode */
+	uint8_t ref;
+	/** set when the entry is removed from the table, covered by the
+	 * entry writelock. Read-mostly lookups check it after locking. */
+	uint8_t removed;
+	/** set when the entry is in the window of the admission policy,
+	 * covered by the hashtable lock */
+	uint8_t window;
 	/** key */
 	void* key;
 	/** data */
@@ -291,11 +493,54 @@ struct lruhash_entry* lruhash_lookup(struct lruhash* table, hashvalue_t hash,
 /**
  * Touch entry, so it becomes the most recently used in the LRU list.
  * Caller must hold hash table lock. The entry must be inserted already.
+ * In read-mostly mode this sets the reference bit of the entry, and the
+ * caller only needs to hold the entry lock.
  * @param table: hash table.
  * @param entry: entry to make first in LRU.
  */
 void lru_touch(struct lruhash* table, struct lruhash_entry* entry);
 
+/**
+ * Turn the read-mostly mode on or off. There must not be other threads
+ * using the table, this is done at setup.
+ * @param table: hash table.
+ * @param on: true to turn the mode on.
+ * @return false if the mode could not be turned on, because of malloc
+ *	failure or no support for atomic operations. The table then stays
+ *	in the normal mode.
+ */
+int lruhash_set_read_mostly(struct lruhash* table, int on);
+
+/**
+ * Turn the open addressing mode on or off, see above. The entries are
+ * moved to the index or back to the bins.  There must not be other
+ * threads using the table, this is done at setup.
+ * @param table: hash table.
+ * @param on: true to turn the mode on.
+ * @return false on malloc failure, the table then stays in its mode.
+ */
+int lruhash_set_open_addressing(struct lruhash* table, int on);
+
+/**
+ * Turn the admission policy on or off, see above.  The entries that are
+ * in the table are in the main part of the LRU list.  There must not be
+ * other threads using the table, this is done at setup.
+ * @param table: hash table.
+ * @param on: true to turn the admission policy on.
+ * @return false on malloc failure, the table then has no admission
+ *	policy.
+ */
+int lruhash_set_admission(struct lruhash* table, int on);
+
+/**
+ * Get the counters of the admission policy.
+ * @param table: hash table.
+ * @param st: the counters of the table are added to it.
+ * @param reset: if true, the counters of the table are set to zero.
+ */
+void lruhash_get_admit_stats(struct lruhash* table,
+	struct lruhash_admit_stats* st, int reset);
+
 /**
  * Set the markdelfunction (or NULL)
  */
@@ -359,6 +604,7 @@ void bin_split(struct lruhash* table, struct lruhash_bin* newa,
  * @param table: hash table.
  * @param list: list of entries that are to be deleted later.
  *	Entries have been removed from the hash table and writelock is held.
+ *	In read-mostly mode the entries are retired instead.
  */
 void reclaim_space(struct lruhash* table, struct lruhash_entry** list);
 
@@ -386,6 +632,26 @@ void lru_front(struct lruhash* table, struct lruhash_entry* entry);
  */
 void lru_remove(struct lruhash* table, struct lruhash_entry* entry);
 
+/**
+ * Advance the epoch of a read-mostly table, if the readers of the
+ * previous epoch are gone. Caller must hold the hash table lock.
+ * @param table: hash table.
+ * @param list: entries that can be deleted are returned here, linked with
+ *	lru_next. The caller deletes them after unlocking the table.
+ * @param arrays: bin arrays that can be freed are returned here.
+ */
+void lruhash_epoch_advance(struct lruhash* table,
+	struct lruhash_entry** list, struct lruhash_retired_array** arrays);
+
+/**
+ * Take all entries out of the table, without deleting them.  The table
+ * is empty afterwards.  There must not be other threads using the table.
+ * @param table: hash table.
+ * @return the entries, the least recently used first, linked with
+ *	lru_prev.  The caller inserts or deletes them.
+ */
+struct lruhash_entry* lruhash_take_all(struct lruhash* table);
+
 /**
  * Output debug info to the log as to state of the hash table.
  * @param table: hash table.
@@ -411,4 +677,25 @@ size_t lruhash_get_mem(struct lruhash* table);
 void lruhash_traverse(struct lruhash* h, int wr,
         void (*func)(struct lruhash_entry*, void*), void* arg);
 
+/**
+ * Traverse a part of a lruhash, so that a walk over a large table does not
+ * hold the table lock for long.  Call back for the elements in the bins
+ * (or slots) from pos onwards, until max elements are visited.  The walk
+ * continues with the returned position in a next call, with the table
+ * lock released in between.  If the table changes in between, an element
+ * can be visited twice, and one that is inserted or moved by a grow of
+ * the open addressing index can be missed.
+ * @param h: hash table.  Locked before use, unlocked after.
+ * @param wr: if true writelock is obtained on element, otherwise readlock.
+ * @param pos: where to start, 0 for the first call.
+ * @param max: number of elements to visit, the bin of the last one is
+ *	visited whole.
+ * @param func: function for every element. Do not lock or unlock elements.
+ * @param arg: user argument to func.
+ * @return position to continue with, 0 when the end of the table is
+ *	reached.
+ */
+size_t lruhash_traverse_part(struct lruhash* h, int wr, size_t pos,
+	size_t max, void (*func)(struct lruhash_entry*, void*), void* arg);
+
 #endif /* UTIL_STORAGE_LRUHASH_H */
@@ -210,6 +210,88 @@ void slabhash_setmarkdel(struct slabhash* sl, lruhash_markdelfunc_t md)
 	}
 }
 
+int slabhash_set_read_mostly(struct slabhash* sl, int on)
+{
+	size_t i;
+	for(i=0; i<sl->size; i++) {
+		if(!lruhash_set_read_mostly(sl->array[i], on)) {
+			/* keep the slabs the same */
+			while(i--)
+				(void)lruhash_set_read_mostly(sl->array[i], 0);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int slabhash_set_open_addressing(struct slabhash* sl, int on)
+{
+	size_t i;
+	for(i=0; i<sl->size; i++) {
+		if(!lruhash_set_open_addressing(sl->array[i], on)) {
+			/* keep the slabs the same */
+			while(i--)
+				(void)lruhash_set_open_addressing(sl->array[i],
+					!on);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int slabhash_set_admission(struct slabhash* sl, int on)
+{
+	size_t i;
+	for(i=0; i<sl->size; i++) {
+		if(!lruhash_set_admission(sl->array[i], on)) {
+			/* keep the slabs the same */
+			while(i--)
+				(void)lruhash_set_admission(sl->array[i], 0);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+void slabhash_get_admit_stats(struct slabhash* sl,
+	struct lruhash_admit_stats* st, int reset)
+{
+	size_t i;
+	for(i=0; i<sl->size; i++)
+		lruhash_get_admit_stats(sl->array[i], st, reset);
+}
+
+void slabhash_migrate(struct slabhash* to, struct slabhash* from,
+	void* cb_arg)
+{
+	struct lruhash_entry** lists, *e;
+	size_t i, left;
+	lists = (struct lruhash_entry**)calloc(from->size, sizeof(*lists));
+	if(!lists) {
+		log_err("slabhash_migrate: malloc failed, entries dropped");
+		slabhash_clear(from);
+		return;
+	}
+	for(i=0; i<from->size; i++)
+		lists[i] = lruhash_take_all(from->array[i]);
+	/* take turns over the slabs, oldest first, so that when the new
+	 * table is smaller, the least recently used entries of every old
+	 * slab are the ones that are pushed out */
+	left = from->size;
+	while(left) {
+		left = 0;
+		for(i=0; i<from->size; i++) {
+			if(!(e = lists[i]))
+				continue;
+			lists[i] = e->lru_prev;
+			slabhash_insert(to, e->hash, e, e->data, cb_arg);
+			if(lists[i])
+				left++;
+		}
+	}
+	free(lists);
+}
+
 void slabhash_traverse(struct slabhash* sh, int wr,
 	void (*func)(struct lruhash_entry*, void*), void* arg)
 {
@@ -174,6 +174,57 @@ struct lruhash* slabhash_gettable(struct slabhash* table, hashvalue_t hash);
  */
 void slabhash_setmarkdel(struct slabhash* table, lruhash_markdelfunc_t md);
 
+/**
+ * Turn the read-mostly mode on or off for the slabs, see lruhash.h.
+ * There must not be other threads using the table.
+ * @param table: slabbed hash table.
+ * @param on: true to turn it on.
+ * @return false if it could not be turned on, the table is unchanged.
+ */
+int slabhash_set_read_mostly(struct slabhash* table, int on);
+
+/**
+ * Turn the open addressing mode on or off for the slabs, see lruhash.h.
+ * There must not be other threads using the table.
+ * @param table: slabbed hash table.
+ * @param on: true to turn it on.
+ * @return false on malloc failure, the table is unchanged.
+ */
+int slabhash_set_open_addressing(struct slabhash* table, int on);
+
+/**
+ * Turn the admission policy on or off for the slabs, see lruhash.h.
+ * There must not be other threads using the table.
+ * @param table: slabbed hash table.
+ * @param on: true to turn it on.
+ * @return false on malloc failure, the table then has no admission policy.
+ */
+int slabhash_set_admission(struct slabhash* table, int on);
+
+/**
+ * Get the counters of the admission policy, added up for the slabs.
+ * @param table: slabbed hash table.
+ * @param st: the counters are added to it.
+ * @param reset: if true, the counters of the table are set to zero.
+ */
+void slabhash_get_admit_stats(struct slabhash* table,
+	struct lruhash_admit_stats* st, int reset);
+
+/**
+ * Move all entries from one table into another one, for when the table
+ * is recreated with a different size or number of slabs.  The entries
+ * are inserted in LRU order, and if the new table is smaller, the least
+ * recently used entries are deleted.  There must not be other threads
+ * using the tables.
+ * @param to: the table that receives the entries.  It uses the same
+ *	key and data functions as the old table.
+ * @param from: the table that is emptied.  It can be deleted afterwards.
+ * @param cb_arg: user argument for the delete functions of the new table,
+ *	or NULL for its default.
+ */
+void slabhash_migrate(struct slabhash* to, struct slabhash* from,
+	void* cb_arg);
+
 /**
  * Traverse a slabhash.
  * @param table: slabbed hash table.
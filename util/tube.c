@@ -65,9 +65,11 @@ struct tube* tube_create(void)
 	}
 	tube->sr = -1;
 	tube->sw = -1;
+	lock_basic_init(&tube->write_lock);
 	if(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == -1) {
 		int err = errno;
 		log_err("socketpair: %s", strerror(errno));
+		lock_basic_destroy(&tube->write_lock);
 		free(tube);
 		errno = err;
 		return NULL;
@@ -93,6 +95,7 @@ void tube_delete(struct tube* tube)
 	 *            Also epoll does not like closing fd before event_del */
 	tube_close_read(tube);
 	tube_close_write(tube);
+	lock_basic_destroy(&tube->write_lock);
 	free(tube);
 }
 
@@ -283,7 +286,9 @@ tube_handle_write(struct comm_point* c, void* arg, int error,
 	return 0;
 }
 
-int tube_write_msg(struct tube* tube, uint8_t* buf, uint32_t len, 
+/** write a message, with the write lock held */
+static int
+tube_write_msg_locked(struct tube* tube, uint8_t* buf, uint32_t len, 
         int nonblock)
 {
 	ssize_t r, d;
@@ -325,6 +330,16 @@ int tube_write_msg(struct tube* tube, uint8_t* buf, uint32_t len,
 	return 1;
 }
 
+int tube_write_msg(struct tube* tube, uint8_t* buf, uint32_t len, 
+        int nonblock)
+{
+	int r;
+	lock_basic_lock(&tube->write_lock);
+	r = tube_write_msg_locked(tube, buf, len, nonblock);
+	lock_basic_unlock(&tube->write_lock);
+	return r;
+}
+
 int tube_read_msg(struct tube* tube, uint8_t** buf, uint32_t* len, 
         int nonblock)
 {
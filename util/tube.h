@@ -46,8 +46,8 @@ struct comm_point;
 struct comm_base;
 struct tube;
 struct tube_res_list;
-#ifdef USE_WINSOCK
 #include "util/locks.h"
+#ifdef USE_WINSOCK
 #include "util/winsock_event.h"
 #endif
 
@@ -90,6 +90,9 @@ struct tube {
 	struct tube_res_list* res_list;
 	/** last in list */
 	struct tube_res_list* res_last;
+	/** lock on the writes of tube_write_msg, so that more threads
+	 * can write messages to the tube */
+	lock_basic_t write_lock;
 
 #else /* USE_WINSOCK */
 	/** listen callback */
@@ -70,6 +70,23 @@ key_cache_create(struct config_file* cfg)
 	return kcache;
 }
 
+struct key_cache*
+key_cache_adjust(struct key_cache* kcache, struct config_file* cfg)
+{
+	struct key_cache* old = kcache;
+	if(!old || cfg->key_cache_slabs != old->slab->size ||
+		cfg->key_cache_size != slabhash_get_size(old->slab)) {
+		kcache = key_cache_create(cfg);
+		if(kcache && old)
+			slabhash_migrate(kcache->slab, old->slab, NULL);
+		key_cache_delete(old);
+	}
+	if(kcache && !slabhash_set_open_addressing(kcache->slab,
+		cfg->cache_open_addressing))
+		log_warn("cache-open-addressing could not be enabled");
+	return kcache;
+}
+
 void 
 key_cache_delete(struct key_cache* kcache)
 {
@@ -63,6 +63,18 @@ struct key_cache {
  */
 struct key_cache* key_cache_create(struct config_file* cfg);
 
+/**
+ * Adjust the key cache to the config settings.  If the size or the
+ * number of slabs changes, a new cache is made and the entries are
+ * moved into it.
+ * @param kcache: the key cache, or NULL to create a new one.
+ * @param cfg: config settings for the cache size and slabs.
+ * @return the key cache or NULL on malloc failure (the old one is
+ *	deleted then).
+ */
+struct key_cache* key_cache_adjust(struct key_cache* kcache,
+	struct config_file* cfg);
+
 /**
  * Delete the key cache
  * @param kcache: to delete
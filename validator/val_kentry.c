@@ -102,7 +102,7 @@ void
 key_entry_hash(struct key_entry_key* kk)
 {
 	kk->entry.hash = 0x654;
-	kk->entry.hash = hashlittle(&kk->key_class, sizeof(kk->key_class), 
+	kk->entry.hash = hash_bytes(&kk->key_class, sizeof(kk->key_class), 
 		kk->entry.hash);
 	kk->entry.hash = dname_query_hash(kk->name, kk->entry.hash);
 }
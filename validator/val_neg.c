@@ -60,6 +60,7 @@
 #include "services/cache/rrset.h"
 #include "services/cache/dns.h"
 #include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
 #include "sldns/sbuffer.h"
 
 int val_neg_data_compare(const void* a, const void* b)
@@ -93,7 +94,10 @@ struct val_neg_cache* val_neg_create(struct config_file* cfg, size_t maxiter)
 	}
 	neg->nsec3_max_iter = maxiter;
 	neg->max = 1024*1024; /* 1 M is thousands of entries */
-	if(cfg) neg->max = cfg->neg_cache_size;
+	if(cfg) {
+		neg->max = cfg->neg_cache_size;
+		neg->aggressive = cfg->aggressive_nsec;
+	}
 	rbtree_init(&neg->tree, &val_neg_zone_compare);
 	lock_basic_init(&neg->lock);
 	lock_protect(&neg->lock, neg, sizeof(*neg));
@@ -580,7 +584,8 @@ static int reply_has_nsec(struct reply_info* rep)
 	if(rep->security != sec_status_secure)
 		return 0;
 	for(i=rep->an_numrrsets; i< rep->an_numrrsets+rep->ns_numrrsets; i++){
-		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC) {
+		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC ||
+			ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC3) {
 			d = (struct packed_rrset_data*)rep->rrsets[i]->
 				entry.data;
 			if(d->security == sec_status_secure)
@@ -875,7 +880,8 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 
 	/* insert the NSECs */
 	for(i=rep->an_numrrsets; i< rep->an_numrrsets+rep->ns_numrrsets; i++){
-		if(ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC)
+		if(ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC &&
+			ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC3)
 			continue;
 		if(!dname_subdomain_c(rep->rrsets[i]->rk.dname, 
 			zone->name)) continue;
@@ -1173,10 +1179,11 @@ grab_nsec(struct rrset_cache* rrset_cache, uint8_t* qname, size_t qname_len,
 	return r;
 }
 
-/** find nsec3 closest encloser in neg cache */
+/** find nsec3 closest encloser in neg cache, its name is returned in ce */
 static struct val_neg_data*
 neg_find_nsec3_ce(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
-		int qlabs, sldns_buffer* buf, uint8_t* hashnc, size_t* nclen)
+		int qlabs, sldns_buffer* buf, uint8_t* hashnc, size_t* nclen,
+		uint8_t** ce, size_t* ce_len)
 {
 	struct val_neg_data* data;
 	uint8_t hashce[NSEC3_SHA_LEN];
@@ -1198,6 +1205,8 @@ neg_find_nsec3_ce(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
 		data = neg_find_data(zone, b32, b32len, zone->labs+1);
 		if(data && data->in_use) {
 			/* found ce match! */
+			*ce = qname;
+			*ce_len = qname_len;
 			return data;
 		}
 
@@ -1269,6 +1278,8 @@ neg_nsec3_proof_ds(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
 	struct ub_packed_rrset_key* ce_rrset, *nc_rrset;
 	struct nsec3_cached_hash c;
 	uint8_t nc_b32[257];
+	uint8_t* ce;
+	size_t ce_len;
 
 	/* for NSEC3 ; determine the closest encloser for which we
 	 * can find an exact match. Remember the hashed lower name,
@@ -1282,7 +1293,7 @@ neg_nsec3_proof_ds(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
 		return NULL; /* not nsec3 zone */
 
 	if(!(data=neg_find_nsec3_ce(zone, qname, qname_len, qlabs, buf,
-		hashnc, &nclen))) {
+		hashnc, &nclen, &ce, &ce_len))) {
 		return NULL;
 	}
 
@@ -1387,6 +1398,300 @@ static int add_soa(struct rrset_cache* rrset_cache, time_t now,
 	return 1;
 }
 
+/**
+ * Find the NSEC that matches or precedes qname in the zone, and copy it
+ * out of the rrset cache.
+ * @param neg: negative cache, locked.
+ * @param zone: the zone to look in, must be an NSEC zone.
+ * @param qname: name to look for.
+ * @param qname_len: length of qname.
+ * @param rrset_cache: rrset cache.
+ * @param region: where to allocate the copy.
+ * @param now: to check TTLs against.
+ * @return rrset or NULL.
+ */
+static struct ub_packed_rrset_key*
+neg_find_nsec(struct val_neg_cache* neg, struct val_neg_zone* zone,
+	uint8_t* qname, size_t qname_len, struct rrset_cache* rrset_cache,
+	struct regional* region, time_t now)
+{
+	struct ub_packed_rrset_key* nsec;
+	struct val_neg_data* data;
+	uint32_t flags = 0;
+	(void)neg_closest_data(zone, qname, qname_len,
+		dname_count_labels(qname), &data);
+	while(data && !data->in_use)
+		data = data->parent;
+	if(!data)
+		return NULL;
+	if(query_dname_compare(data->name, zone->name) == 0)
+		flags = PACKED_RRSET_NSEC_AT_APEX;
+	nsec = grab_nsec(rrset_cache, data->name, data->len,
+		LDNS_RR_TYPE_NSEC, zone->dclass, flags, region, 0, 0, now);
+	if(nsec)
+		neg_lru_touch(neg, data);
+	return nsec;
+}
+
+/**
+ * Synthesize an NXDOMAIN or NODATA answer from the NSEC records of
+ * the zone (RFC 8198).  Only proofs that the validator accepts are
+ * made, and answers that need a wildcard are left to the upstream.
+ * @param neg: negative cache, locked.
+ * @param zone: the NSEC zone that contains the qname.
+ * @param qinfo: query.
+ * @param rrset_cache: rrset cache.
+ * @param region: where to allocate the reply.
+ * @param now: to check TTLs against.
+ * @return reply without SOA record, or NULL.
+ */
+static struct dns_msg*
+neg_nsec_synth(struct val_neg_cache* neg, struct val_neg_zone* zone,
+	struct query_info* qinfo, struct rrset_cache* rrset_cache,
+	struct regional* region, time_t now)
+{
+	struct dns_msg* msg;
+	struct ub_packed_rrset_key* nsec, *wcnsec = NULL;
+	uint8_t* wc = NULL, *ce;
+	uint8_t wcname[LDNS_MAX_DOMAINLEN+3];
+	size_t ce_len;
+
+	if(!(nsec = neg_find_nsec(neg, zone, qinfo->qname, qinfo->qname_len,
+		rrset_cache, region, now)))
+		return NULL;
+	if(nsec_proves_nodata(nsec, qinfo, &wc)) {
+		/* a wildcard NODATA also needs the proof that qname
+		 * itself does not exist, leave it to the upstream */
+		if(wc)
+			return NULL;
+		if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len,
+			qinfo->qtype, qinfo->qclass, region, 2)))
+			return NULL;
+		/* TTL already subtracted in grab_nsec */
+		if(!dns_msg_authadd(msg, region, nsec, 0))
+			return NULL;
+		neg->num_neg_cache_noerror++;
+		return msg;
+	}
+	if(!val_nsec_proves_name_error(nsec, qinfo->qname))
+		return NULL;
+	if(!val_nsec_proves_no_wc(nsec, qinfo->qname, qinfo->qname_len)) {
+		/* the wildcard at the closest encloser is covered by
+		 * another NSEC */
+		if(!(ce = nsec_closest_encloser(qinfo->qname, nsec)))
+			return NULL;
+		ce_len = dname_valid(ce, LDNS_MAX_DOMAINLEN);
+		if(ce_len == 0 || ce_len > LDNS_MAX_DOMAINLEN-2)
+			return NULL;
+		wcname[0] = 1;
+		wcname[1] = (uint8_t)'*';
+		memmove(wcname+2, ce, ce_len);
+		if(!(wcnsec = neg_find_nsec(neg, zone, wcname, ce_len+2,
+			rrset_cache, region, now)))
+			return NULL;
+		if(!val_nsec_proves_no_wc(wcnsec, qinfo->qname,
+			qinfo->qname_len))
+			return NULL;
+	}
+	/* capacity=3: nsec + wildcard nsec + soa */
+	if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len,
+		qinfo->qtype, qinfo->qclass, region, 3)))
+		return NULL;
+	if(!dns_msg_authadd(msg, region, nsec, 0))
+		return NULL;
+	if(wcnsec && query_dname_compare(wcnsec->rk.dname,
+		nsec->rk.dname) != 0 &&
+		!dns_msg_authadd(msg, region, wcnsec, 0))
+		return NULL;
+	FLAGS_SET_RCODE(msg->rep->flags, LDNS_RCODE_NXDOMAIN);
+	neg->num_neg_cache_nxdomain++;
+	return msg;
+}
+
+/**
+ * Synthesize an NXDOMAIN or NODATA answer from the NSEC3 records of
+ * the zone (RFC 8198).  Opt-out spans cannot prove that a name does
+ * not exist, and are not used.
+ * @param neg: negative cache, locked.
+ * @param zone: the NSEC3 zone that contains the qname.
+ * @param qinfo: query.
+ * @param buf: temporary buffer.
+ * @param rrset_cache: rrset cache.
+ * @param region: where to allocate the reply.
+ * @param now: to check TTLs against.
+ * @return reply without SOA record, or NULL.
+ */
+static struct dns_msg*
+neg_nsec3_synth(struct val_neg_cache* neg, struct val_neg_zone* zone,
+	struct query_info* qinfo, sldns_buffer* buf,
+	struct rrset_cache* rrset_cache, struct regional* region, time_t now)
+{
+	struct dns_msg* msg;
+	struct val_neg_data* data;
+	struct ub_packed_rrset_key* ce_rrset, *nc_rrset, *wc_rrset;
+	struct nsec3_cached_hash c;
+	uint8_t hashnc[NSEC3_SHA_LEN], hashwc[NSEC3_SHA_LEN];
+	uint8_t nc_b32[257], wc_b32[257];
+	uint8_t wcname[LDNS_MAX_DOMAINLEN+3];
+	uint8_t* ce;
+	size_t nclen, wclen, ce_len;
+	int qlabs = dname_count_labels(qinfo->qname);
+
+	/* look for the closest encloser from qname up to the apex */
+	if(!(data=neg_find_nsec3_ce(zone, qinfo->qname, qinfo->qname_len,
+		qlabs - zone->labs + 1, buf, hashnc, &nclen, &ce, &ce_len)))
+		return NULL;
+	ce_rrset = grab_nsec(rrset_cache, data->name, data->len,
+		LDNS_RR_TYPE_NSEC3, zone->dclass, 0, region, nclen == 0,
+		qinfo->qtype, now);
+	if(!ce_rrset || !neg_params_ok(zone, ce_rrset))
+		return NULL;
+	neg_lru_touch(neg, data);
+
+	if(nclen == 0) {
+		/* qname exists, the type was checked in grab_nsec.
+		 * It must not be a CNAME or a delegation point */
+		if(nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_CNAME) ||
+			(nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_NS) &&
+			!nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_SOA)))
+			return NULL;
+		if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len,
+			qinfo->qtype, qinfo->qclass, region, 2)))
+			return NULL;
+		if(!dns_msg_authadd(msg, region, ce_rrset, 0))
+			return NULL;
+		neg->num_neg_cache_noerror++;
+		return msg;
+	}
+
+	/* names below a delegation or DNAME are not in this zone */
+	if(nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_DNAME) ||
+		(nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_NS) &&
+		!nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_SOA)))
+		return NULL;
+
+	/* the next closer name is covered, and not by an opt-out span */
+	nc_rrset = neg_nsec3_getnc(zone, hashnc, nclen, rrset_cache,
+		region, now, nc_b32, sizeof(nc_b32));
+	if(!nc_rrset || nsec3_has_optout(nc_rrset, 0))
+		return NULL;
+	c.hash = hashnc;
+	c.hash_len = nclen;
+	c.b32 = nc_b32+1;
+	c.b32_len = (size_t)nc_b32[0];
+	if(!nsec3_covers(zone->name, &c, nc_rrset, 0, buf))
+		return NULL;
+
+	/* the wildcard at the closest encloser is covered */
+	if(ce_len > LDNS_MAX_DOMAINLEN-2)
+		return NULL;
+	wcname[0] = 1;
+	wcname[1] = (uint8_t)'*';
+	memmove(wcname+2, ce, ce_len);
+	if(!(wclen=nsec3_get_hashed(buf, wcname, ce_len+2, zone->nsec3_hash,
+		zone->nsec3_iter, zone->nsec3_salt, zone->nsec3_saltlen,
+		hashwc, sizeof(hashwc))))
+		return NULL;
+	wc_rrset = neg_nsec3_getnc(zone, hashwc, wclen, rrset_cache,
+		region, now, wc_b32, sizeof(wc_b32));
+	if(!wc_rrset)
+		return NULL;
+	c.hash = hashwc;
+	c.hash_len = wclen;
+	c.b32 = wc_b32+1;
+	c.b32_len = (size_t)wc_b32[0];
+	if(!nsec3_covers(zone->name, &c, wc_rrset, 0, buf))
+		return NULL;
+
+	/* capacity=4: ce + nc + wc + soa */
+	if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len,
+		qinfo->qtype, qinfo->qclass, region, 4)))
+		return NULL;
+	if(!dns_msg_authadd(msg, region, ce_rrset, 0))
+		return NULL;
+	if(!dns_msg_authadd(msg, region, nc_rrset, 0))
+		return NULL;
+	if(query_dname_compare(wc_rrset->rk.dname, nc_rrset->rk.dname) != 0
+		&& query_dname_compare(wc_rrset->rk.dname,
+		ce_rrset->rk.dname) != 0 &&
+		!dns_msg_authadd(msg, region, wc_rrset, 0))
+		return NULL;
+	FLAGS_SET_RCODE(msg->rep->flags, LDNS_RCODE_NXDOMAIN);
+	neg->num_neg_cache_nxdomain++;
+	return msg;
+}
+
+/**
+ * Set the TTL of a synthesized reply to the lowest TTL of its rrsets,
+ * that includes the negative TTL from the SOA record.
+ * @param msg: the reply, TTLs are relative.
+ */
+static void
+neg_msg_set_ttl(struct dns_msg* msg)
+{
+	struct reply_info* rep = msg->rep;
+	time_t ttl;
+	size_t i;
+	for(i=0; i<rep->rrset_count; i++) {
+		ttl = ((struct packed_rrset_data*)rep->rrsets[i]->
+			entry.data)->ttl;
+		if(i == 0 || ttl < rep->ttl)
+			rep->ttl = ttl;
+	}
+	rep->prefetch_ttl = PREFETCH_TTL_CALC(rep->ttl);
+}
+
+/**
+ * Aggressive use of the negative cache for all query types, RFC 8198.
+ * @param neg: negative cache.
+ * @param qinfo: query, not type DS.
+ * @param region: where to allocate reply.
+ * @param rrset_cache: rrset cache.
+ * @param buf: temporary buffer.
+ * @param now: to check TTLs against.
+ * @param addsoa: if true, add the SOA record.
+ * @param topname: do not look higher than this name, or NULL.
+ * @return reply or NULL.
+ */
+static struct dns_msg*
+neg_getmsg_aggressive(struct val_neg_cache* neg, struct query_info* qinfo,
+	struct regional* region, struct rrset_cache* rrset_cache,
+	sldns_buffer* buf, time_t now, int addsoa, uint8_t* topname)
+{
+	struct dns_msg* msg;
+	struct val_neg_zone* zone;
+
+	if(qinfo->qtype == LDNS_RR_TYPE_ANY)
+		return NULL;
+	lock_basic_lock(&neg->lock);
+	zone = neg_closest_zone_parent(neg, qinfo->qname, qinfo->qname_len,
+		dname_count_labels(qinfo->qname), qinfo->qclass);
+	while(zone && !zone->in_use)
+		zone = zone->parent;
+	if(zone && topname && !dname_subdomain_c(zone->name, topname))
+		zone = NULL;
+	if(!zone) {
+		lock_basic_unlock(&neg->lock);
+		return NULL;
+	}
+	if(zone->nsec3_hash)
+		msg = neg_nsec3_synth(neg, zone, qinfo, buf, rrset_cache,
+			region, now);
+	else	msg = neg_nsec_synth(neg, zone, qinfo, rrset_cache, region,
+			now);
+	if(msg && addsoa && !add_soa(rrset_cache, now, region, msg, zone)) {
+		lock_basic_unlock(&neg->lock);
+		return NULL;
+	}
+	lock_basic_unlock(&neg->lock);
+	if(msg) {
+		neg_msg_set_ttl(msg);
+		log_nametypeclass(VERB_ALGO, "negcache synthesized answer for",
+			qinfo->qname, qinfo->qtype, qinfo->qclass);
+	}
+	return msg;
+}
+
 struct dns_msg* 
 val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo, 
 	struct regional* region, struct rrset_cache* rrset_cache, 
@@ -1399,9 +1704,13 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 	int zname_labs;
 	struct val_neg_zone* zone;
 
-	/* only for DS queries */
-	if(qinfo->qtype != LDNS_RR_TYPE_DS)
-		return NULL;
+	/* other types only with aggressive use of the cache */
+	if(qinfo->qtype != LDNS_RR_TYPE_DS) {
+		if(!neg->aggressive)
+			return NULL;
+		return neg_getmsg_aggressive(neg, qinfo, region, rrset_cache,
+			buf, now, addsoa, topname);
+	}
 	log_assert(!topname || dname_subdomain_c(qinfo->qname, topname));
 
 	/* see if info from neg cache is available 
@@ -80,6 +80,14 @@ struct val_neg_cache {
 	size_t max;
 	/** max nsec3 iterations allowed */
 	size_t nsec3_max_iter;
+	/** if true, cached NSEC and NSEC3 records are used to synthesize
+	 * NXDOMAIN and NODATA answers for all query types (RFC 8198),
+	 * and not only for type DS */
+	int aggressive;
+	/** number of NOERROR (nodata) answers synthesized, for statistics */
+	size_t num_neg_cache_noerror;
+	/** number of NXDOMAIN answers synthesized, for statistics */
+	size_t num_neg_cache_nxdomain;
 };
 
 /**
@@ -195,7 +203,8 @@ int val_neg_data_compare(const void* a, const void* b);
 int val_neg_zone_compare(const void* a, const void* b);
 
 /**
- * Insert NSECs from this message into the negative cache for reference.
+ * Insert NSECs and NSEC3s from this message into the negative cache for
+ * reference.
  * @param neg: negative cache
  * @param rep: reply with NSECs.
  * Errors are ignored, means that storage is omitted.
@@ -235,6 +244,9 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 /**
  * For the given query, try to get a reply out of the negative cache.
  * The reply still needs to be validated.
+ * Type DS is always looked up. Other types are only looked up when
+ * aggressive use of the cache is enabled, and then an NXDOMAIN or
+ * NODATA answer is synthesized from the covering NSEC or NSEC3 records.
  * @param neg: negative cache.
  * @param qinfo: query
  * @param region: where to allocate reply.
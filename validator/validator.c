@@ -120,13 +120,13 @@ val_apply_cfg(struct module_env* env, struct val_env* val_env,
 		log_err("out of memory");
 		return 0;
 	}
-	if(!val_env->kcache)
-		val_env->kcache = key_cache_create(cfg);
+	/* the key cache is kept in the env over module restarts */
+	val_env->kcache = key_cache_adjust(env->key_cache, cfg);
+	env->key_cache = val_env->kcache;
 	if(!val_env->kcache) {
 		log_err("out of memory");
 		return 0;
 	}
-	env->key_cache = val_env->kcache;
 	if(!anchors_apply_cfg(env->anchors, cfg)) {
 		log_err("validator: error in trustanchors config");
 		return 0;
@@ -188,7 +188,8 @@ val_deinit(struct module_env* env, int id)
 	lock_basic_destroy(&val_env->bogus_lock);
 	anchors_delete(env->anchors);
 	env->anchors = NULL;
-	key_cache_delete(val_env->kcache);
+	/* the key cache is not deleted, it stays in env->key_cache for the
+	 * next module setup; the owner of the env deletes it */
 	neg_cache_delete(val_env->neg_cache);
 	free(val_env->nsec3_keysize);
 	free(val_env->nsec3_maxiter);
@@ -1809,6 +1810,11 @@ processValidate(struct module_qstate* qstate, struct val_qstate* vq,
 		errinf(qstate, "proof failed");
 		errinf_origin(qstate, qstate->reply_origin);
 	}
+	/* keep the denial proofs for aggressive use of the neg cache */
+	if(ve->neg_cache->aggressive &&
+		vq->chase_reply->security == sec_status_secure &&
+		(subtype == VAL_CLASS_NAMEERROR || subtype == VAL_CLASS_NODATA))
+		val_neg_addreply(ve->neg_cache, vq->chase_reply);
 
 	return 1;
 }